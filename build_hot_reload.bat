@@ -48,19 +48,29 @@ setlocal enabledelayedexpansion
 
 :: Collect game source files
 set GAME_SOURCES=
+:: Everything under src\hot_reload is host-only code, and src\runtime is linked
+:: into the host, which hands it to the game library through HostAPI. Each
+:: directory of src\modules is a library of its own.
 for /r src %%f in (*.c) do (
     set "FILE=%%~nxf"
+    set "DIR=%%~dpf"
     if not "!FILE!"=="main.c" (
         if not "!FILE!"=="main_hot_reload.c" (
-            if not "!FILE!"=="file_version_builder.c" (
-                if not "!FILE!"=="platform_tools.c" (
-                    set "GAME_SOURCES=!GAME_SOURCES! %%f"
+            if "!DIR:\hot_reload\=!"=="!DIR!" (
+                if "!DIR:\runtime\=!"=="!DIR!" (
+                    if "!DIR:\modules\=!"=="!DIR!" (
+                        set "GAME_SOURCES=!GAME_SOURCES! %%f"
+                    )
                 )
             )
         )
     )
 )
 
+:: Runtime sources, linked into the host
+set RUNTIME_SOURCES=
+for %%f in (src\runtime\*.c) do set "RUNTIME_SOURCES=!RUNTIME_SOURCES! %%f"
+
 :: Build file version builder
 echo Building file version builder...
 gcc -g -O0 -std=c99 ^
@@ -73,6 +83,38 @@ IF %ERRORLEVEL% NEQ 0 exit /b 1
 %OUT_DIR%\file_version_builder.exe
 IF %ERRORLEVEL% NEQ 0 exit /b 1
 
+:: Pack resources\ into texture atlases. The packer only rewrites the atlas
+:: when an image changed, so it's cheap to run on every hot reload.
+if not exist %OUT_DIR%\atlas_packer.exe (
+    echo Building atlas_packer.exe
+    gcc -O2 -std=c99 ^
+        -DPLATFORM_DESKTOP -DGRAPHICS_API_OPENGL_33 ^
+        -Ideps\raylib\src ^
+        tools\atlas_packer.c ^
+        deps\raylib\src\libraylib.a ^
+        -lopengl32 -lgdi32 -lwinmm ^
+        -o %OUT_DIR%\atlas_packer.exe
+    IF !ERRORLEVEL! NEQ 0 exit /b 1
+)
+%OUT_DIR%\atlas_packer.exe resources
+IF %ERRORLEVEL% NEQ 0 exit /b 1
+
+:: Pack the decoded images (atlas pages included) into resources\assets.pack,
+:: which the asset registry maps instead of decoding PNGs at startup
+if not exist %OUT_DIR%\asset_packer.exe (
+    echo Building asset_packer.exe
+    gcc -O2 -std=c99 ^
+        -DPLATFORM_DESKTOP -DGRAPHICS_API_OPENGL_33 ^
+        -Ideps\raylib\src -Isrc ^
+        tools\asset_packer.c ^
+        deps\raylib\src\libraylib.a ^
+        -lopengl32 -lgdi32 -lwinmm ^
+        -o %OUT_DIR%\asset_packer.exe
+    IF !ERRORLEVEL! NEQ 0 exit /b 1
+)
+:: The running game keeps the pack mapped, so it can't be replaced until restart
+%OUT_DIR%\asset_packer.exe resources
+
 :: Build game dll WITHOUT linking raylib (raylib symbols will come from main executable)
 :: Note: No raylib linking here - the main executable will provide raylib symbols
 echo Building game.dll
@@ -87,6 +129,21 @@ IF %ERRORLEVEL% NEQ 0 exit /b 1
 move %OUT_DIR%\game_tmp.dll %OUT_DIR%\game.dll >nul
 IF %ERRORLEVEL% NEQ 0 exit /b 1
 
+:: Game modules, one dll per directory of src\modules (see src\runtime\modules.h).
+:: All of them are rebuilt, the host reloads each one whose dll changed.
+for /d %%m in (src\modules\*) do (
+    set MODULE_SOURCES=
+    for /r %%m %%f in (*.c) do set "MODULE_SOURCES=!MODULE_SOURCES! %%f"
+    echo Building module_%%~nxm.dll
+    gcc -shared -g -O0 -std=c99 ^
+        -DPLATFORM_DESKTOP -DGRAPHICS_API_OPENGL_33 -DHOT_RELOAD ^
+        -Ideps\raylib\src -Isrc ^
+        !MODULE_SOURCES! ^
+        -o %OUT_DIR%\module_%%~nxm_tmp.dll
+    IF !ERRORLEVEL! NEQ 0 exit /b 1
+    move %OUT_DIR%\module_%%~nxm_tmp.dll %OUT_DIR%\module_%%~nxm.dll >nul
+)
+
 :: If game.exe already running: Then only compile game.dll and exit cleanly
 if %GAME_RUNNING% == true (
 	echo Hot reloading... && exit /b 0
@@ -100,15 +157,47 @@ gcc -g -O0 -std=c99 ^
     -Ideps\raylib\src -Isrc ^
     src\main_hot_reload.c ^
     src\hot_reload\platform_tools.c ^
+    src\hot_reload\raylib_call_stats.c ^
+    src\hot_reload\raylib_capture.c ^
+    src\hot_reload\elf_symbols.c ^
+    src\hot_reload\sampling_profiler.c ^
+    src\hot_reload\frame_stats.c ^
+    src\hot_reload\reload_telemetry.c ^
+    src\hot_reload\live_patch.c ^
+    src\hot_reload\dir_watcher.c ^
+    src\hot_reload\crash_guard.c ^
+    src\hot_reload\frame_pacer.c ^
+    !RUNTIME_SOURCES! ^
     deps\raylib\src\libraylib.a ^
     -Wl,--export-all-symbols ^
     -lopengl32 -lgdi32 -lwinmm ^
     -o %OUT_DIR%\%EXE%
 IF %ERRORLEVEL% NEQ 0 exit /b 1
 
+echo Building raylib_replay.exe
+gcc -O2 -std=c99 ^
+    -DPLATFORM_DESKTOP -DGRAPHICS_API_OPENGL_33 ^
+    -Ideps\raylib\src -Isrc ^
+    tools\raylib_replay.c ^
+    deps\raylib\src\libraylib.a ^
+    -lopengl32 -lgdi32 -lwinmm ^
+    -o %OUT_DIR%\raylib_replay.exe
+IF %ERRORLEVEL% NEQ 0 exit /b 1
+
+echo Building sim_runner.exe
+gcc -O2 -std=c99 ^
+    -Isrc ^
+    tools\sim_runner.c src\hot_reload\platform_tools.c src\runtime\jobs.c ^
+    -o %OUT_DIR%\sim_runner.exe
+IF %ERRORLEVEL% NEQ 0 exit /b 1
+
 echo Build complete!
 echo   Main executable: %OUT_DIR%\%EXE%
 echo   Game library: %OUT_DIR%\game.dll
+echo   Replayer: %OUT_DIR%\raylib_replay.exe
+echo   Batch runner: %OUT_DIR%\sim_runner.exe
+echo   Atlas: resources\atlas\atlas.txt
+echo   Asset pack: resources\assets.pack
 echo.
 
 if "%~1"=="run" (
@@ -33,11 +33,55 @@ case $(uname) in
     ;;
 esac
 
+case $(uname) in
+"Darwin")
+    RAYLIB_LIBS="deps/raylib/src/libraylib.a -framework OpenGL -framework Cocoa -framework IOKit -framework CoreVideo -framework CoreAudio"
+    ;;
+"Linux")
+    RAYLIB_LIBS="deps/raylib/src/libraylib.a -lGL -lm -lpthread -ldl -lrt -lX11"
+    ;;
+*)
+    RAYLIB_LIBS="deps/raylib/src/libraylib.a -lGL -lm -lpthread -ldl -lrt -lX11"
+    ;;
+esac
+
+# Pack resources/ into texture atlases. The packer only rewrites the atlas
+# when an image changed, so it's cheap to run on every hot reload.
+if [ ! -f $OUT_DIR/atlas_packer ] || [ tools/atlas_packer.c -nt $OUT_DIR/atlas_packer ]; then
+    echo "Building atlas_packer"
+    $CC -O2 -std=c99 \
+        -DPLATFORM_DESKTOP -DGRAPHICS_API_OPENGL_33 \
+        -Ideps/raylib/src \
+        tools/atlas_packer.c \
+        $RAYLIB_LIBS \
+        -o $OUT_DIR/atlas_packer
+fi
+./$OUT_DIR/atlas_packer resources
+
+# Pack the decoded images (atlas pages included) into resources/assets.pack,
+# which the asset registry maps instead of decoding PNGs at startup
+if [ ! -f $OUT_DIR/asset_packer ] || [ tools/asset_packer.c -nt $OUT_DIR/asset_packer ] || [ src/runtime/asset_pack.h -nt $OUT_DIR/asset_packer ]; then
+    echo "Building asset_packer"
+    $CC -O2 -std=c99 \
+        -DPLATFORM_DESKTOP -DGRAPHICS_API_OPENGL_33 \
+        -Ideps/raylib/src -Isrc \
+        tools/asset_packer.c \
+        $RAYLIB_LIBS \
+        -o $OUT_DIR/asset_packer
+fi
+./$OUT_DIR/asset_packer resources
+
 # Build the game DLL with weak symbols (will resolve from main executable)
 echo "Building game$DLL_EXT"
 
-# Find all C files except main.c and main_hot_reload.c for the game library
-GAME_SOURCES=$(find src -name "*.c" -not -name "main.c" -not -name "main_hot_reload.c" -not -name "file_version_builder.c" -not -name "platform_tools.c")
+# Find all C files except main.c and main_hot_reload.c for the game library.
+# Everything under src/hot_reload is host-only code, and src/runtime is linked
+# into the host, which hands it to the game library through HostAPI. Each
+# directory of src/modules is a library of its own.
+GAME_SOURCES=$(find src -name "*.c" -not -name "main.c" -not -name "main_hot_reload.c" -not -path "src/hot_reload/*" -not -path "src/runtime/*" -not -path "src/modules/*")
+
+# Sources of the hot reload host executable
+HOST_SOURCES="src/main_hot_reload.c src/hot_reload/platform_tools.c src/hot_reload/raylib_call_stats.c src/hot_reload/raylib_capture.c src/hot_reload/elf_symbols.c src/hot_reload/sampling_profiler.c src/hot_reload/frame_stats.c src/hot_reload/reload_telemetry.c src/hot_reload/live_patch.c src/hot_reload/dir_watcher.c src/hot_reload/crash_guard.c src/hot_reload/frame_pacer.c $(find src/runtime -name "*.c")"
 
 # Building file version builder
 $CC -g -O0 -std=c99 \
@@ -46,17 +90,196 @@ $CC -g -O0 -std=c99 \
     -o $OUT_DIR/file_version_builder
 ./$OUT_DIR/file_version_builder
 
+GAME_FLAGS="-fPIC -g -std=c99 -DPLATFORM_DESKTOP -DGRAPHICS_API_OPENGL_33 -DHOT_RELOAD -Ideps/raylib/src -Isrc"
+
+# True when <target> is missing or older than any of the files its dependency
+# file (-MMD) lists
+needs_rebuild() {
+    [ -f "$1" ] && [ -f "$1.d" ] || return 0
+    for dep in $(sed -e 's/^[^:]*://' -e 's/\\$//' "$1.d"); do
+        [ "$dep" -nt "$1" ] && return 0
+    done
+    return 1
+}
+
+# HOT_RELOAD_PCH=1: precompile the raylib and host API headers once
+# (src/hot_reload/game_pch.h), instead of parsing them in every game source.
+# Sets PCH_FLAGS for the given optimization level, since a header
+# precompiled at another level isn't used.
+PCH_FLAGS=""
+use_pch() {
+    [ "${HOT_RELOAD_PCH:-0}" == "1" ] || return 0
+    local pch_dir=$OUT_DIR/pch/$1
+    mkdir -p $pch_dir
+    cp -p src/hot_reload/game_pch.h $pch_dir/game_pch.h
+    if needs_rebuild $pch_dir/game_pch.h.gch; then
+        echo "Precompiling game_pch.h (-$1)"
+        $CC $GAME_FLAGS -$1 -x c-header $pch_dir/game_pch.h -MMD -MF $pch_dir/game_pch.h.gch.d -o $pch_dir/game_pch.h.gch
+    fi
+    PCH_FLAGS="-include $pch_dir/game_pch.h"
+}
+
+# HOT_RELOAD_MIXED_OPT=1: units (sources, or modules in unity builds) edited
+# in the last HOT_RELOAD_STABLE_BUILDS builds (3 by default) are compiled at
+# -O0, quick to compile and to debug. The others are compiled once more at
+# -O2 and that object is kept. Units matching HOT_RELOAD_O2_PATTERNS or
+# HOT_RELOAD_O0_PATTERNS (shell patterns, e.g. "src/physics/*") always use
+# that level. Without it everything is compiled at -O0.
+STABLE_BUILDS=${HOT_RELOAD_STABLE_BUILDS:-3}
+OBJ_DIR=$OUT_DIR/obj
+OPT_STATE=$OBJ_DIR/opt_state # <object> <build of its last edit> <level>
+OPT_LEVELS=$OUT_DIR/game_opt_levels.txt # <level> <unit>, shown in the F10 overlay
+mkdir -p $OBJ_DIR
+BUILD_NUMBER=$(( $(cat $OBJ_DIR/build_number 2>/dev/null || echo 0) + 1 ))
+echo $BUILD_NUMBER > $OBJ_DIR/build_number
+: > $OPT_STATE.new
+: > $OPT_LEVELS.new
+
+matches_any() {
+    local name=$1
+    set -f
+    for pattern in $2; do
+        case "$name" in
+        $pattern) set +f; return 0 ;;
+        esac
+    done
+    set +f
+    return 1
+}
+
+# compile_unit <source> <object> <unit name>, appends the object to OBJECTS
+OBJECTS=""
+compile_unit() {
+    local source=$1 object=$2 name=$3
+    local state=$([ -f $OPT_STATE ] && awk -v object=$object '$1 == object' $OPT_STATE)
+    local last_edit=$(echo "$state" | cut -d' ' -f2)
+    local old_level=$(echo "$state" | cut -d' ' -f3)
+    local edited=false
+    needs_rebuild $object && edited=true
+
+    # On the first build nothing counts as recently edited, afterwards new
+    # units do
+    if [ -z "$state" ]; then
+        [ -s $OPT_STATE ] && last_edit=$BUILD_NUMBER || last_edit=$(( BUILD_NUMBER - STABLE_BUILDS ))
+    elif $edited; then
+        last_edit=$BUILD_NUMBER
+    fi
+
+    local level=O0
+    if [ "${HOT_RELOAD_MIXED_OPT:-0}" == "1" ]; then
+        if matches_any $name "${HOT_RELOAD_O2_PATTERNS:-}"; then
+            level=O2
+        elif matches_any $name "${HOT_RELOAD_O0_PATTERNS:-}"; then
+            level=O0
+        elif [ $(( BUILD_NUMBER - last_edit )) -ge $STABLE_BUILDS ]; then
+            level=O2
+        fi
+    fi
+
+    if $edited || [ "$level" != "$old_level" ]; then
+        echo "Compiling $name (-$level)"
+        use_pch $level
+        $CC -c $GAME_FLAGS -$level $PCH_FLAGS $source -MMD -MF $object.d -o $object
+        UNIT_COMPILED=true
+    fi
+
+    echo "$object $last_edit $level" >> $OPT_STATE.new
+    echo "$level $name" >> $OPT_LEVELS.new
+    OBJECTS="$OBJECTS $object"
+}
+
+# Saves the state of the units compiled by this build. A module-only build
+# keeps the entries of the units it didn't build.
+save_opt_state() {
+    if [ "${1:-}" == "merge" ]; then
+        touch $OPT_STATE $OPT_LEVELS
+        awk 'NR == FNR { seen[$1] = 1; print; next } !($1 in seen)' $OPT_STATE.new $OPT_STATE > $OPT_STATE.merged
+        awk 'NR == FNR { seen[$2] = 1; print; next } !($2 in seen)' $OPT_LEVELS.new $OPT_LEVELS > $OPT_LEVELS.merged
+        mv $OPT_STATE.merged $OPT_STATE.new
+        mv $OPT_LEVELS.merged $OPT_LEVELS.new
+    fi
+    mv $OPT_STATE.new $OPT_STATE
+    mv $OPT_LEVELS.new $OPT_LEVELS
+}
+
+# build_module <name>: src/modules/<name>/ into module_<name>$DLL_EXT, one
+# object per source. The library is only relinked when an object was compiled
+# again, so the host only reloads the modules that changed.
+build_module() {
+    OBJECTS=""
+    UNIT_COMPILED=false
+    for source in $(find src/modules/$1 -name "*.c"); do
+        compile_unit $source $OBJ_DIR/$(echo ${source%.c} | tr '/' '_').o $source
+    done
+    if $UNIT_COMPILED || [ ! -f $OUT_DIR/module_$1$DLL_EXT ]; then
+        echo "Linking module_$1$DLL_EXT"
+        $CC $SHARED_FLAGS $OBJECTS -o $OUT_DIR/module_$1_tmp$DLL_EXT
+        mv $OUT_DIR/module_$1_tmp$DLL_EXT $OUT_DIR/module_$1$DLL_EXT
+    fi
+}
+
+# `./build_hot_reload.sh module <name>`: what the host runs when every changed
+# file is inside src/modules/<name>/. The game library is left as it is.
+if [ "${1:-}" == "module" ]; then
+    build_module $2
+    save_opt_state merge
+    exit 0
+fi
+
 # Compile game as shared library
-$CC $SHARED_FLAGS -g -O0 -std=c99 \
-    -DPLATFORM_DESKTOP -DGRAPHICS_API_OPENGL_33 -DHOT_RELOAD \
-    -Ideps/raylib/src -Isrc \
-    $GAME_SOURCES \
-    -o $OUT_DIR/game_tmp$DLL_EXT
+OBJECTS=""
+if [ "${HOT_RELOAD_UNITY:-0}" == "1" ]; then
+    # HOT_RELOAD_UNITY=1: one translation unit per directory under src/,
+    # which includes all of its sources. Only the directories with a changed
+    # source or header are compiled again, then everything is linked.
+    UNITY_DIR=$OUT_DIR/unity
+    mkdir -p $UNITY_DIR
+    for module_dir in $(for source in $GAME_SOURCES; do dirname $source; done | sort -u); do
+        module=$(echo $module_dir | tr '/' '_')
+        unity_source=$UNITY_DIR/$module.c
+
+        # Only rewritten when a source is added or removed, to keep its date
+        contents=""
+        for source in $(ls $module_dir/*.c); do
+            case " $GAME_SOURCES " in
+            *" $source "*) contents="$contents#include \"${source#src/}\""$'\n' ;;
+            esac
+        done
+        if [ ! -f $unity_source ] || [ "$(cat $unity_source)"$'\n' != "$contents" ]; then
+            printf "%s" "$contents" > $unity_source
+        fi
+
+        compile_unit $unity_source $UNITY_DIR/$module.o $module_dir/
+    done
+elif [ "${HOT_RELOAD_MIXED_OPT:-0}" == "1" ]; then
+    # One object per source, so each one keeps its own level
+    for source in $GAME_SOURCES; do
+        compile_unit $source $OBJ_DIR/$(echo ${source%.c} | tr '/' '_').o $source
+    done
+fi
+
+if [ -n "$OBJECTS" ]; then
+    $CC $SHARED_FLAGS $OBJECTS -o $OUT_DIR/game_tmp$DLL_EXT
+else
+    use_pch O0
+    for source in $GAME_SOURCES; do echo "O0 $source" >> $OPT_LEVELS.new; done
+    $CC $SHARED_FLAGS $GAME_FLAGS -O0 $PCH_FLAGS \
+        $GAME_SOURCES \
+        -o $OUT_DIR/game_tmp$DLL_EXT
+fi
 
 # Need to use a temp file because the loader might try to load the DLL
 # before it's fully written
 mv $OUT_DIR/game_tmp$DLL_EXT $OUT_DIR/game$DLL_EXT
 
+# Game modules, see src/runtime/modules.h
+for module_dir in src/modules/*/; do
+    [ -d "$module_dir" ] || continue
+    build_module $(basename $module_dir)
+done
+
+save_opt_state
+
 # If the executable is already running, then don't try to build and start it.
 if pgrep -f $EXE > /dev/null; then
     echo "Hot reloading..."
@@ -64,18 +287,7 @@ if pgrep -f $EXE > /dev/null; then
 fi
 
 echo "Building $EXE"
-# Link raylib ONLY to the main executable
-case $(uname) in
-"Darwin")
-    RAYLIB_LIBS="deps/raylib/src/libraylib.a -framework OpenGL -framework Cocoa -framework IOKit -framework CoreVideo -framework CoreAudio"
-    ;;
-"Linux")
-    RAYLIB_LIBS="deps/raylib/src/libraylib.a -lGL -lm -lpthread -ldl -lrt -lX11"
-    ;;
-*)
-    RAYLIB_LIBS="deps/raylib/src/libraylib.a -lGL -lm -lpthread -ldl -lrt -lX11"
-    ;;
-esac
+# Link raylib ONLY to the main executable (and the tools)
 
 # Set export flags for main executable
 case $(uname) in
@@ -93,15 +305,32 @@ esac
 $CC -g -O0 -std=c99 \
     -DPLATFORM_DESKTOP -DGRAPHICS_API_OPENGL_33 -DHOT_RELOAD_FILE_WATCHER \
     -Ideps/raylib/src -Isrc \
-    src/main_hot_reload.c \
-    src/hot_reload/platform_tools.c \
+    $HOST_SOURCES \
     $RAYLIB_LIBS \
     $EXPORT_FLAGS \
     -o $OUT_DIR/$EXE -ldl
 
+echo "Building raylib_replay"
+$CC -O2 -std=c99 \
+    -DPLATFORM_DESKTOP -DGRAPHICS_API_OPENGL_33 \
+    -Ideps/raylib/src -Isrc \
+    tools/raylib_replay.c \
+    $RAYLIB_LIBS \
+    -o $OUT_DIR/raylib_replay
+
+echo "Building sim_runner"
+$CC -O2 -std=c99 \
+    -Isrc \
+    tools/sim_runner.c src/hot_reload/platform_tools.c src/runtime/jobs.c \
+    -o $OUT_DIR/sim_runner -ldl -lpthread
+
 echo "Build complete!"
 echo "  Executable: $OUT_DIR/$EXE"
 echo "  Game library: $OUT_DIR/game$DLL_EXT"
+echo "  Replayer: $OUT_DIR/raylib_replay"
+echo "  Batch runner: $OUT_DIR/sim_runner"
+echo "  Atlas: resources/atlas/atlas.txt"
+echo "  Asset pack: resources/assets.pack"
 echo ""
 
 if [ $# -ge 1 ] && [ "$1" == "run" ]; then
@@ -0,0 +1,161 @@
+#!/bin/bash -eu
+
+# Shipping build (Mac/Linux): src/main.c, the game, the runtime services and
+# raylib compiled from source into one statically linked executable with -O3
+# and LTO, then rebuilt with a profile collected while replaying a gameplay
+# session (PGO).
+#
+#   ./build_shipping.sh [session.rae]
+#
+# Record a session with any regular build, e.g.
+#   GAME_RECORD_INPUT=session.rae ./build/game
+# Without one, the training and benchmark runs play SHIPPING_FRAMES frames
+# (1200 by default) without input. The runs open a window, so they need a
+# display.
+#
+# Outputs:
+#   build/shipping/release/game   -O3 + LTO
+#   build/shipping/pgo/game       -O3 + LTO + PGO, the one to ship
+#   build/shipping/benchmark.txt  frame times of both on the same session
+
+OUT_DIR=build/shipping
+PGO_DIR=$(pwd)/$OUT_DIR/pgo/profile
+SESSION=${1:-}
+FRAMES=${SHIPPING_FRAMES:-1200}
+
+RAYLIB_SOURCES="rcore rshapes rtextures rtext rmodels raudio utils rglfw"
+GAME_SOURCES="$(ls src/*.c | grep -v main_hot_reload.c) $(ls src/runtime/*.c) $(find src/modules -name "*.c")"
+
+case $(uname) in
+"Darwin")
+    CC=${CC:-clang}
+    SYSTEM_LIBS="-framework OpenGL -framework Cocoa -framework IOKit -framework CoreVideo -framework CoreAudio"
+    PROFDATA="xcrun llvm-profdata"
+    ;;
+*)
+    CC=${CC:-gcc}
+    SYSTEM_LIBS="-lGL -lm -lpthread -ldl -lrt -lX11"
+    PROFDATA="llvm-profdata"
+    ;;
+esac
+
+OPT_FLAGS="-O3 -flto -DNDEBUG"
+
+# gcc keeps one profile per object file, clang one merged profile for the program
+if $CC --version | grep -q clang; then
+    PGO_GENERATE="-fprofile-generate=$PGO_DIR"
+    PGO_USE="-fprofile-use=$PGO_DIR/default.profdata"
+else
+    PGO_GENERATE="-fprofile-generate=$PGO_DIR"
+    PGO_USE="-fprofile-use=$PGO_DIR -fprofile-correction -Wno-missing-profile"
+fi
+
+# build <dir> <extra flags>
+# Objects of a variant always go to the same paths, which gcc uses to match
+# profiles to objects between the instrumented and the optimized build.
+build() {
+    local dir=$OUT_DIR/$1
+    local flags="$OPT_FLAGS $2"
+    local objects=""
+    mkdir -p $dir/obj
+
+    for name in $RAYLIB_SOURCES; do
+        local lang=""
+        if [ "$name" == "rglfw" ] && [ "$(uname)" == "Darwin" ]; then
+            lang="-x objective-c"
+        fi
+        $CC -c $lang -std=gnu99 -D_GNU_SOURCE -DPLATFORM_DESKTOP -DGRAPHICS_API_OPENGL_33 \
+            -Ideps/raylib/src -Ideps/raylib/src/external/glfw/include \
+            -Wno-missing-braces $flags \
+            deps/raylib/src/$name.c -o $dir/obj/raylib_$name.o
+        objects="$objects $dir/obj/raylib_$name.o"
+    done
+
+    for source in $GAME_SOURCES; do
+        local object=$dir/obj/$(echo ${source%.c} | tr '/' '_').o
+        $CC -c -std=c99 -Wall -DPLATFORM_DESKTOP -DGRAPHICS_API_OPENGL_33 \
+            -Ideps/raylib/src -Isrc $flags \
+            $source -o $object
+        objects="$objects $object"
+    done
+
+    $CC $flags $objects $SYSTEM_LIBS -o $dir/game
+}
+
+# Packs resources/ (texture atlas, then asset pack) with packers linked
+# against the release raylib objects
+pack_resources() {
+    local raylib_objects=$(ls $OUT_DIR/release/obj/raylib_*.o)
+    for tool in atlas_packer asset_packer; do
+        $CC -std=c99 -DPLATFORM_DESKTOP -DGRAPHICS_API_OPENGL_33 \
+            -Ideps/raylib/src -Isrc $OPT_FLAGS \
+            tools/$tool.c $raylib_objects $SYSTEM_LIBS \
+            -o $OUT_DIR/$tool
+        ./$OUT_DIR/$tool resources
+    done
+}
+
+# run <exe> <frame times csv>, from the root folder so it sees resources/
+run() {
+    if [ -n "$SESSION" ]; then
+        GAME_REPLAY_INPUT=$SESSION GAME_FRAME_TIMES=$2 ./$1
+    else
+        GAME_BENCHMARK_FRAMES=$FRAMES GAME_FRAME_TIMES=$2 ./$1
+    fi
+}
+
+# frame_stats <csv>: mean, p50, p95 and p99 in ms
+frame_stats() {
+    tail -n +2 $1 | cut -d, -f2 | sort -n | awk '
+        { ms[NR] = $1; total += $1 }
+        END {
+            printf "mean %.3f ms, p50 %.3f ms, p95 %.3f ms, p99 %.3f ms",
+                total / NR, ms[int((NR - 1) * 0.50) + 1], ms[int((NR - 1) * 0.95) + 1], ms[int((NR - 1) * 0.99) + 1]
+        }'
+}
+
+mean_ms() {
+    tail -n +2 $1 | cut -d, -f2 | awk '{ total += $1 } END { printf "%.4f", total / NR }'
+}
+
+if [ ! -f deps/raylib/src/rcore.c ]; then
+    echo "raylib sources not found, run: git submodule update --init"
+    exit 1
+fi
+if [ -n "$SESSION" ] && [ ! -f "$SESSION" ]; then
+    echo "Session $SESSION not found"
+    exit 1
+fi
+
+echo "Building release (-O3, LTO)"
+build release ""
+pack_resources
+
+echo "Building instrumented (-O3, LTO, profile generation)"
+rm -rf $PGO_DIR
+build pgo "$PGO_GENERATE"
+
+echo "Training run"
+run $OUT_DIR/pgo/game $OUT_DIR/pgo/training_frame_times.csv
+if $CC --version | grep -q clang; then
+    $PROFDATA merge -output=$PGO_DIR/default.profdata $PGO_DIR/*.profraw
+fi
+
+echo "Building optimized (-O3, LTO, PGO)"
+build pgo "$PGO_USE"
+
+echo "Benchmark runs"
+run $OUT_DIR/release/game $OUT_DIR/release/frame_times.csv
+run $OUT_DIR/pgo/game $OUT_DIR/pgo/frame_times.csv
+
+{
+    echo "Session: ${SESSION:-$FRAMES frames without input}"
+    echo "release: $(frame_stats $OUT_DIR/release/frame_times.csv)"
+    echo "pgo:     $(frame_stats $OUT_DIR/pgo/frame_times.csv)"
+    awk -v release=$(mean_ms $OUT_DIR/release/frame_times.csv) -v pgo=$(mean_ms $OUT_DIR/pgo/frame_times.csv) \
+        'BEGIN { printf "PGO mean frame time is %.1f%% of release\n", pgo / release * 100 }'
+} | tee $OUT_DIR/benchmark.txt
+
+echo "Shipping build complete!"
+echo "  Executable: $OUT_DIR/pgo/game"
+echo "  Benchmark: $OUT_DIR/benchmark.txt"
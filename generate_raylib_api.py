@@ -186,6 +186,355 @@ def generate_macros(functions):
         lines.append(line)
     return '\n'.join(lines)
 
+def is_variadic(func):
+    """Variadic functions can't be forwarded by a wrapper, so they are left uninstrumented"""
+    return any('...' in param for param in func['params'])
+
+def generate_call_ids(functions):
+    """Generate the enum of call ids used to index the call stats"""
+    lines = []
+    for func in functions:
+        lines.append(f"    RL_CALL_{func['snake_name'].upper()},")
+    return '\n'.join(lines)
+
+def generate_call_names(functions):
+    """Generate the table of raylib function names, indexed by call id"""
+    lines = []
+    for func in functions:
+        lines.append(f"    \"{func['name']}\",")
+    return '\n'.join(lines)
+
+def generate_instrumented_wrappers(functions):
+    """Generate the counting/timing wrapper for every non-variadic function"""
+    blocks = []
+    for func in functions:
+        if is_variadic(func):
+            continue
+
+        params_str = ', '.join(func['params']) if func['params'] else 'void'
+        call_id = f"RL_CALL_{func['snake_name'].upper()}"
+        call = f"raylib_instrumented_target->{func['snake_name']}({', '.join(func['param_names'])})"
+
+        lines = [f"static {func['return_type']} rl_instrumented_{func['snake_name']}({params_str}) {{"]
+        lines.append(f"    RL_CALL_BEGIN({call_id});")
+        if func['return_type'] == 'void':
+            lines.append(f"    {call};")
+            lines.append(f"    RL_CALL_END({call_id});")
+        else:
+            lines.append(f"    {func['return_type']} result = {call};")
+            lines.append(f"    RL_CALL_END({call_id});")
+            lines.append("    return result;")
+        lines.append("}")
+        blocks.append('\n'.join(lines))
+    return '\n\n'.join(blocks)
+
+def generate_instrumented_assignments(functions):
+    """Generate the wrapper assignments in create_raylib_api_instrumented"""
+    lines = []
+    for func in functions:
+        if is_variadic(func):
+            continue
+        lines.append(f"    api.{func['snake_name']} = rl_instrumented_{func['snake_name']};")
+    return '\n'.join(lines)
+
+def generate_raylib_api_instrumented_h(functions):
+    """Generate the complete raylib_api_instrumented.gen.h file content"""
+
+    wrappers = generate_instrumented_wrappers(functions)
+    assignments = generate_instrumented_assignments(functions)
+
+    content = f'''#ifndef RAYLIB_API_INSTRUMENTED_GEN_H
+#define RAYLIB_API_INSTRUMENTED_GEN_H
+
+// DO NOT EDIT THIS FILE, CHANGES WILL BE LOST
+// Auto-generated by generate_raylib_api.py from raylib.h
+// Timestamp: {datetime.now().strftime("%Y-%m-%d %H:%M:%S")}
+//
+// Host only. A RaylibAPI table where every entry counts (and optionally times)
+// its calls before forwarding to a target table. Variadic functions can't be
+// forwarded, so they keep pointing straight to the target.
+
+#include "raylib_api.gen.h"
+#include "raylib_api_calls.gen.h"
+#include "raylib_call_stats.h"
+
+static RaylibAPI* raylib_instrumented_target = NULL;
+
+{wrappers}
+
+static inline RaylibAPI* create_raylib_api_instrumented(RaylibAPI* target) {{
+    static RaylibAPI api;
+    raylib_instrumented_target = target;
+    raylib_call_stats_init(raylib_call_names, RL_CALL_COUNT);
+
+    api = *target;
+{assignments}
+    return &api;
+}}
+
+#endif // RAYLIB_API_INSTRUMENTED_GEN_H
+'''
+
+    return content
+
+def generate_raylib_api_calls_h(functions):
+    """Generate raylib_api_calls.gen.h: call ids and names shared by the host tools"""
+
+    call_ids = generate_call_ids(functions)
+    call_names = generate_call_names(functions)
+
+    content = f'''#ifndef RAYLIB_API_CALLS_GEN_H
+#define RAYLIB_API_CALLS_GEN_H
+
+// DO NOT EDIT THIS FILE, CHANGES WILL BE LOST
+// Auto-generated by generate_raylib_api.py from raylib.h
+// Timestamp: {datetime.now().strftime("%Y-%m-%d %H:%M:%S")}
+//
+// One id per RaylibAPI entry, in table order, and the matching raylib names.
+
+enum {{
+{call_ids}
+    RL_CALL_COUNT
+}};
+
+static const char* raylib_call_names[RL_CALL_COUNT] = {{
+{call_names}
+}};
+
+#endif // RAYLIB_API_CALLS_GEN_H
+'''
+
+    return content
+
+# Call capture/replay (raylib_api_capture.gen.h and raylib_replay.gen.h).
+#
+# Arguments are serialized by kind. Plain values are copied as raw bytes and
+# strings are length prefixed. Textures, render textures and shaders are also
+# copied as raw bytes, but the replayer remaps their ids to the resources it
+# created itself. Anything else (pointers, Image, Font, Model...) can't be
+# replayed in another process, so those calls are only recorded as unsupported.
+TRACE_PLAIN_TYPES = {
+    'bool', 'char', 'int', 'unsigned int', 'float', 'double',
+    'Color', 'Vector2', 'Vector3', 'Vector4', 'Quaternion', 'Matrix', 'Rectangle',
+    'Camera', 'Camera2D', 'Camera3D', 'Ray', 'BoundingBox', 'NPatchInfo',
+}
+
+TRACE_RESOURCE_TYPES = {
+    'Texture2D': 'texture',
+    'RenderTexture2D': 'render_texture',
+    'Shader': 'shader',
+}
+
+# Calls that release a resource, so the id can be forgotten (GL reuses ids)
+TRACE_FORGET_CALLS = {
+    'UnloadTexture': 'texture',
+    'UnloadRenderTexture': 'render_texture',
+    'UnloadShader': 'shader',
+}
+
+# Recorded, but not re-issued: the replayer owns the window and the frame pacing,
+# and must not touch the filesystem or the desktop.
+REPLAY_SKIPPED_CALLS = {
+    'InitWindow', 'CloseWindow', 'SetConfigFlags', 'SetTargetFPS', 'WaitTime',
+    'SetWindowState', 'ClearWindowState', 'ToggleFullscreen', 'ToggleBorderlessWindowed',
+    'MaximizeWindow', 'MinimizeWindow', 'RestoreWindow', 'SetWindowPosition',
+    'SetWindowMonitor', 'SetWindowSize', 'EnableEventWaiting',
+    'TakeScreenshot', 'OpenURL', 'MakeDirectory', 'ChangeDirectory',
+}
+
+def normalize_type(type_str):
+    """Collapse whitespace and attach pointer stars to the type: 'const char *' -> 'const char*'"""
+    return ' '.join(type_str.replace('*', ' * ').split()).replace(' *', '*')
+
+def param_type(param):
+    """Type of a parameter declaration, e.g. 'const char *fileName' -> 'const char*'"""
+    name = param.split()[-1]
+    return normalize_type(param[:len(param) - len(name)] + '*' * name.count('*'))
+
+def trace_kind(type_str):
+    """How a value of this type is serialized, or None when it can't be replayed"""
+    type_str = normalize_type(type_str)
+    if type_str == 'const char*':
+        return 'string'
+    if '*' in type_str:
+        return None
+    if type_str.startswith('const '):
+        type_str = type_str[len('const '):]
+    if type_str in TRACE_PLAIN_TYPES:
+        return 'plain'
+    return TRACE_RESOURCE_TYPES.get(type_str)
+
+def is_capturable(func):
+    """A call is replayable when every argument and the return value can be serialized"""
+    if is_variadic(func):
+        return False
+    if any(trace_kind(param_type(param)) is None for param in func['params']):
+        return False
+    return func['return_type'] == 'void' or trace_kind(func['return_type']) is not None
+
+def generate_capture_wrappers(functions):
+    """Generate the capture wrapper for every non-variadic function"""
+    blocks = []
+    for func in functions:
+        if is_variadic(func):
+            continue
+
+        params_str = ', '.join(func['params']) if func['params'] else 'void'
+        call_id = f"RL_CALL_{func['snake_name'].upper()}"
+        call = f"raylib_capture_target->{func['snake_name']}({', '.join(func['param_names'])})"
+
+        lines = [f"static {func['return_type']} rl_capture_{func['snake_name']}({params_str}) {{"]
+        if not is_capturable(func):
+            lines.append(f"    rl_capture_unsupported({call_id});")
+            lines.append(f"    {'' if func['return_type'] == 'void' else 'return '}{call};")
+            lines.append("}")
+            blocks.append('\n'.join(lines))
+            continue
+
+        lines.append(f"    rl_capture_begin({call_id});")
+        for param, name in zip(func['params'], func['param_names']):
+            kind = trace_kind(param_type(param))
+            if kind == 'plain':
+                lines.append(f"    rl_capture_value(&{name}, sizeof({name}));")
+            else:
+                lines.append(f"    rl_capture_{kind}({name});")
+
+        result_kind = trace_kind(func['return_type']) if func['return_type'] != 'void' else None
+        if func['return_type'] == 'void':
+            lines.append(f"    {call};")
+        else:
+            lines.append(f"    {func['return_type']} result = {call};")
+        if result_kind in TRACE_RESOURCE_TYPES.values():
+            lines.append(f"    rl_capture_result_{result_kind}(result);")
+        if func['name'] in TRACE_FORGET_CALLS:
+            lines.append(f"    rl_capture_forget_{TRACE_FORGET_CALLS[func['name']]}({func['param_names'][0]});")
+        lines.append("    rl_capture_end();")
+        if func['return_type'] != 'void':
+            lines.append("    return result;")
+        lines.append("}")
+        blocks.append('\n'.join(lines))
+    return '\n\n'.join(blocks)
+
+def generate_capture_assignments(functions):
+    """Generate the wrapper assignments in create_raylib_api_capture"""
+    lines = []
+    for func in functions:
+        if is_variadic(func):
+            continue
+        lines.append(f"    api.{func['snake_name']} = rl_capture_{func['snake_name']};")
+    return '\n'.join(lines)
+
+def generate_raylib_api_capture_h(functions):
+    """Generate the complete raylib_api_capture.gen.h file content"""
+
+    wrappers = generate_capture_wrappers(functions)
+    assignments = generate_capture_assignments(functions)
+
+    content = f'''#ifndef RAYLIB_API_CAPTURE_GEN_H
+#define RAYLIB_API_CAPTURE_GEN_H
+
+// DO NOT EDIT THIS FILE, CHANGES WILL BE LOST
+// Auto-generated by generate_raylib_api.py from raylib.h
+// Timestamp: {datetime.now().strftime("%Y-%m-%d %H:%M:%S")}
+//
+// Host only. A RaylibAPI table that records every call and its arguments
+// (see raylib_capture.h) before forwarding to a target table. Variadic
+// functions can't be forwarded, so they keep pointing straight to the target.
+
+#include "raylib_api.gen.h"
+#include "raylib_api_calls.gen.h"
+#include "raylib_capture.h"
+
+static RaylibAPI* raylib_capture_target = NULL;
+
+{wrappers}
+
+static inline RaylibAPI* create_raylib_api_capture(RaylibAPI* target) {{
+    static RaylibAPI api;
+    raylib_capture_target = target;
+
+    api = *target;
+{assignments}
+    return &api;
+}}
+
+#endif // RAYLIB_API_CAPTURE_GEN_H
+'''
+
+    return content
+
+def generate_replay_cases(functions):
+    """Generate the switch cases that decode and re-issue each replayable call"""
+    blocks = []
+    for func in functions:
+        if not is_capturable(func) or func['name'] in REPLAY_SKIPPED_CALLS:
+            continue
+
+        lines = [f"        case RL_CALL_{func['snake_name'].upper()}: {{"]
+        for param, name in zip(func['params'], func['param_names']):
+            type_str = param_type(param)
+            kind = trace_kind(type_str)
+            if kind == 'plain':
+                if type_str.startswith('const '):
+                    type_str = type_str[len('const '):]
+                lines.append(f"            {type_str} {name};")
+                lines.append(f"            rl_replay_value(reader, &{name}, sizeof({name}));")
+            elif kind == 'string':
+                lines.append(f"            const char *{name} = rl_replay_string(reader);")
+            else:
+                resource_type = [t for t, k in TRACE_RESOURCE_TYPES.items() if k == kind][0]
+                lines.append(f"            {resource_type} {name} = rl_replay_{kind}(reader);")
+
+        call = f"{func['name']}({', '.join(func['param_names'])})"
+        result_kind = trace_kind(func['return_type']) if func['return_type'] != 'void' else None
+        if result_kind in TRACE_RESOURCE_TYPES.values():
+            lines.append(f"            {func['return_type']} result = {call};")
+            lines.append(f"            rl_replay_result_{result_kind}(reader, result);")
+        elif func['return_type'] == 'void':
+            lines.append(f"            {call};")
+        else:
+            lines.append(f"            (void){call};")
+        if func['name'] in TRACE_FORGET_CALLS:
+            lines.append(f"            rl_replay_forget_{TRACE_FORGET_CALLS[func['name']]}({func['param_names'][0]});")
+        lines.append("        } return true;")
+        blocks.append('\n'.join(lines))
+    return '\n'.join(blocks)
+
+def generate_raylib_replay_h(functions):
+    """Generate the complete raylib_replay.gen.h file content"""
+
+    cases = generate_replay_cases(functions)
+
+    content = f'''#ifndef RAYLIB_REPLAY_GEN_H
+#define RAYLIB_REPLAY_GEN_H
+
+// DO NOT EDIT THIS FILE, CHANGES WILL BE LOST
+// Auto-generated by generate_raylib_api.py from raylib.h
+// Timestamp: {datetime.now().strftime("%Y-%m-%d %H:%M:%S")}
+//
+// Decodes a captured call (see raylib_capture.h) and issues it against raylib.
+// Used by the standalone replayer, tools/raylib_replay.c, which defines the
+// rl_replay_* readers.
+
+#include "raylib.h"
+#include "raymath.h"
+#include "raylib_api_calls.gen.h"
+#include "raylib_trace.h"
+
+// Returns false when the call is not replayed (unsupported or skipped)
+static bool rl_replay_call(int call_id, RlTraceReader* reader) {{
+    switch (call_id) {{
+{cases}
+        default:
+            return false;
+    }}
+}}
+
+#endif // RAYLIB_REPLAY_GEN_H
+'''
+
+    return content
+
 def generate_raylib_api_h(functions):
     """Generate the complete raylib_api.h file content"""
     
@@ -255,6 +604,17 @@ def main():
     
     print(f"Generated {output_path} with {len(functions)} functions")
 
+    host_headers = {
+        "src/hot_reload/raylib_api_calls.gen.h": generate_raylib_api_calls_h,
+        "src/hot_reload/raylib_api_instrumented.gen.h": generate_raylib_api_instrumented_h,
+        "src/hot_reload/raylib_api_capture.gen.h": generate_raylib_api_capture_h,
+        "src/hot_reload/raylib_replay.gen.h": generate_raylib_replay_h,
+    }
+    for path, generate in host_headers.items():
+        with open(path, 'w') as f:
+            f.write(generate(functions))
+        print(f"Generated {path}")
+
     print("\nExtracted functions:")
     for i, func in enumerate(functions[:5]):
         print(f"  {func['name']} -> {func['snake_name']}")
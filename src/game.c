@@ -5,6 +5,11 @@
 
 #define TOP_BAR_HEIGHT 60
 
+// The window and sprite size the simulation runs with, without a window
+#define SIM_SCREEN_WIDTH 800
+#define SIM_SCREEN_HEIGHT 450
+#define SIM_BUNNY_SIZE 32
+
 typedef struct Bunny {
     Vector2 position;
     Vector2 speed;
@@ -14,7 +19,7 @@ typedef struct Bunny {
 typedef struct GameMemory {
     int counter;
     bool should_run;
-    Texture2D tex_bunny;
+    SpriteHandle bunny_sprite;
     int bunny_width;
     int bunny_height;
     Bunny bunny;
@@ -23,17 +28,11 @@ typedef struct GameMemory {
 
 static GameMemory* g_mem = NULL;
 
-void game_hot_reloaded(void* mem) {
-    g_mem = (GameMemory*)mem;
-}
-
-void game_init() {
-    g_mem = malloc(sizeof(GameMemory));
-
-    *g_mem = (GameMemory){
+static void game_memory_init(GameMemory* mem, SpriteHandle bunny_sprite) {
+    *mem = (GameMemory){
         .counter = 0,
         .should_run = true,
-        .tex_bunny = LoadTexture("resources/wabbit_alpha.png"),
+        .bunny_sprite = bunny_sprite,
         .bunny = (Bunny){
             .position = (Vector2){100, 100},
             .speed = (Vector2){200, 200}
@@ -42,72 +41,119 @@ void game_init() {
             .position = (Vector2){200, 200}
         }
     };
-
-    g_mem->bunny_width = g_mem->tex_bunny.width;
-    g_mem->bunny_height = g_mem->tex_bunny.height;
 }
 
-void game_init_window() {
-    InitWindow(800, 450, "Raylib Hot Reload!");
-    SetTargetFPS(144);
-}
-
-void game_update() {
-    if (!g_mem) return;
-
-    float dt = GetFrameTime();
-
-    g_mem->counter++;
+// Gameplay of one frame. Only touches mem, so it runs the same for the window
+// and for batch simulations.
+static void game_simulate(GameMemory* mem, unsigned int keys, float dt, int screen_width, int screen_height) {
+    mem->counter++;
 
-    if (IsKeyPressed(KEY_ESCAPE)) {
-        g_mem->should_run = false;
+    if (keys & GAME_SIM_KEY_QUIT) {
+        mem->should_run = false;
     }
 
-    if(IsKeyDown(KEY_W)) {
-        g_mem->bunny.position.y -= g_mem->bunny.speed.y * dt;
+    if (keys & GAME_SIM_KEY_UP) {
+        mem->bunny.position.y -= mem->bunny.speed.y * dt;
+    }
+    if (keys & GAME_SIM_KEY_DOWN) {
+        mem->bunny.position.y += mem->bunny.speed.y * dt;
     }
-    if(IsKeyDown(KEY_S)) {
-        g_mem->bunny.position.y += g_mem->bunny.speed.y * dt;
+    if (keys & GAME_SIM_KEY_LEFT) {
+        mem->bunny.position.x -= mem->bunny.speed.x * dt;
     }
-    if(IsKeyDown(KEY_A)) {
-        g_mem->bunny.position.x -= g_mem->bunny.speed.x * dt;
-    }    
-    if(IsKeyDown(KEY_D)) {
-        g_mem->bunny.position.x += g_mem->bunny.speed.x * dt;
+    if (keys & GAME_SIM_KEY_RIGHT) {
+        mem->bunny.position.x += mem->bunny.speed.x * dt;
     }
 
-    if(IsKeyDown(KEY_Q)) {
-        g_mem->bunny.rotation -= g_mem->bunny.speed.y * dt;
+    if (keys & GAME_SIM_KEY_ROTATE_LEFT) {
+        mem->bunny.rotation -= mem->bunny.speed.y * dt;
     }
-    if(IsKeyDown(KEY_E)) {
-        g_mem->bunny.rotation += g_mem->bunny.speed.y * dt;
+    if (keys & GAME_SIM_KEY_ROTATE_RIGHT) {
+        mem->bunny.rotation += mem->bunny.speed.y * dt;
     }
 
     // Boundaries
-    if(g_mem->bunny.position.x < 0) {
-        g_mem->bunny.position.x = 0;
+    if(mem->bunny.position.x < 0) {
+        mem->bunny.position.x = 0;
     }
-    if(g_mem->bunny.position.y < TOP_BAR_HEIGHT - g_mem->bunny_height) {
-        g_mem->bunny.position.y = TOP_BAR_HEIGHT - g_mem->bunny_height;
+    if(mem->bunny.position.y < TOP_BAR_HEIGHT - mem->bunny_height) {
+        mem->bunny.position.y = TOP_BAR_HEIGHT - mem->bunny_height;
     }
-    if(g_mem->bunny.position.y + g_mem->bunny_height > GetScreenHeight()) {
-        g_mem->bunny.position.y = GetScreenHeight() - g_mem->bunny_height;
+    if(mem->bunny.position.y + mem->bunny_height > screen_height) {
+        mem->bunny.position.y = screen_height - mem->bunny_height;
     }
-    if(g_mem->bunny.position.x + g_mem->bunny_width > GetScreenWidth()) {
-        g_mem->bunny.position.x = GetScreenWidth() - g_mem->bunny_width;
+    if(mem->bunny.position.x + mem->bunny_width > screen_width) {
+        mem->bunny.position.x = screen_width - mem->bunny_width;
     }
+}
+
+void game_hot_reloaded(void* mem) {
+    g_mem = (GameMemory*)mem;
+}
+
+void game_init() {
+    g_mem = malloc(sizeof(GameMemory));
+
+    // Sprites packed by tools/atlas_packer.c draw from the atlas
+    sprites_load_atlas(SPRITES_ATLAS_INDEX);
+
+    game_memory_init(g_mem, sprite_load("resources/wabbit_alpha.png"));
+}
+
+void game_init_window() {
+    InitWindow(800, 450, "Raylib Hot Reload!");
+    SetTargetFPS(144);
+}
+
+void game_update() {
+    if (!g_mem) return;
+
+    PROFILE_ZONE_BEGIN(update);
+
+    float dt = GetFrameTime();
+
+    // Without an atlas the texture loads in the background, and the sprite
+    // size changes once it's uploaded
+    Rectangle bunny_rect = sprite_rect(g_mem->bunny_sprite);
+    g_mem->bunny_width = (int)bunny_rect.width;
+    g_mem->bunny_height = (int)bunny_rect.height;
+
+    unsigned int keys = 0;
+    if (IsKeyPressed(KEY_ESCAPE)) keys |= GAME_SIM_KEY_QUIT;
+    if (IsKeyDown(KEY_W)) keys |= GAME_SIM_KEY_UP;
+    if (IsKeyDown(KEY_S)) keys |= GAME_SIM_KEY_DOWN;
+    if (IsKeyDown(KEY_A)) keys |= GAME_SIM_KEY_LEFT;
+    if (IsKeyDown(KEY_D)) keys |= GAME_SIM_KEY_RIGHT;
+    if (IsKeyDown(KEY_Q)) keys |= GAME_SIM_KEY_ROTATE_LEFT;
+    if (IsKeyDown(KEY_E)) keys |= GAME_SIM_KEY_ROTATE_RIGHT;
+
+    game_simulate(g_mem, keys, dt, GetScreenWidth(), GetScreenHeight());
+
+    // Game modules (src/modules), each reloaded on its own
+    modules_update();
+
+    PROFILE_ZONE_END(update);
+    PROFILE_ZONE_BEGIN(draw);
     
     BeginDrawing();
         ClearBackground(SKYBLUE);
 
-        DrawTextureEx(g_mem->tex_bunny, g_mem->bunny.position, g_mem->bunny.rotation, 1, WHITE);
-        DrawTexture(g_mem->tex_bunny, (int)g_mem->blue_bunny.position.x, (int)g_mem->blue_bunny.position.y, BLUE);
+        sprite_draw(g_mem->bunny_sprite, g_mem->bunny.position, g_mem->bunny.rotation, 1, WHITE);
+        sprite_draw(g_mem->bunny_sprite, g_mem->blue_bunny.position, 0, 1, BLUE);
 
         DrawRectangle(0, 0, GetScreenWidth(), TOP_BAR_HEIGHT, BLACK);
-        DrawText(TextFormat("Counter: %i\nPosition: %.2f, %.2f", g_mem->counter, g_mem->bunny.position.x, g_mem->bunny.position.y), 120, 10, 20, WHITE);
-        DrawText("F5=Reload F6=Restart ESC=Exit", 10, GetScreenHeight() - 30, 20, WHITE);
+        // Cached per line, only the lines that changed are laid out again
+        text_draw(TextFormat("Counter: %i\nPosition: %.2f, %.2f", g_mem->counter, g_mem->bunny.position.x, g_mem->bunny.position.y), 120, 10, 20, WHITE);
+        text_draw(TextFormat("Batch breaks: %i", sprites_batch_breaks()), 400, 10, 20, WHITE);
+        text_draw("F5=Reload F6=Restart ESC=Exit", 10, GetScreenHeight() - 30, 20, WHITE);
         DrawFPS(10, 10);
+        modules_draw();
+
+    PROFILE_ZONE_BEGIN(end_drawing);
     EndDrawing();
+    PROFILE_ZONE_END(end_drawing);
+
+    PROFILE_ZONE_END(draw);
 }
 
 bool game_should_run() {
@@ -123,7 +169,6 @@ bool game_should_run() {
 void game_shutdown() {
     if (!g_mem) return;
 
-    UnloadTexture(g_mem->tex_bunny);
     printf("[GAME] Game shutdown - had %d counter\n", g_mem->counter);
     free(g_mem);
     g_mem = NULL;
@@ -148,4 +193,31 @@ bool game_force_reload() {
 
 bool game_force_restart() {
     return IsKeyPressed(KEY_F6);
+}
+
+int game_sim_memory_size() {
+    return sizeof(GameMemory);
+}
+
+void game_sim_init(void* mem) {
+    GameMemory* sim = (GameMemory*)mem;
+    game_memory_init(sim, (SpriteHandle){0});
+    sim->bunny_width = SIM_BUNNY_SIZE;
+    sim->bunny_height = SIM_BUNNY_SIZE;
+}
+
+// Returns false once the session ended
+bool game_sim_step(void* mem, unsigned int keys, float dt) {
+    GameMemory* sim = (GameMemory*)mem;
+    if (!sim->should_run) return false;
+    game_simulate(sim, keys, dt, SIM_SCREEN_WIDTH, SIM_SCREEN_HEIGHT);
+    return sim->should_run;
+}
+
+void game_sim_result(void* mem, GameSimResult* result) {
+    GameMemory* sim = (GameMemory*)mem;
+    result->frames = sim->counter;
+    result->x = sim->bunny.position.x;
+    result->y = sim->bunny.position.y;
+    result->rotation = sim->bunny.rotation;
 }
\ No newline at end of file
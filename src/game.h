@@ -4,9 +4,11 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdbool.h>
+#include "game_sim.h"
 
 #ifdef HOT_RELOAD
     #include "hot_reload/raylib_api.gen.h"
+    #include "runtime/host_api.h"
 
     #ifdef _WIN32
         #define EXPORT __declspec(dllexport)
@@ -15,15 +17,26 @@
     #endif
 
     EXPORT void game_set_raylib_api(RaylibAPI* api);
+    EXPORT void game_set_host_api(HostAPI* api);
 
     RaylibAPI* rl = NULL;
     void game_set_raylib_api(RaylibAPI* api) {
         rl = api;
     }
+
+    HostAPI* host = NULL;
+    void game_set_host_api(HostAPI* api) {
+        host = api;
+    }
 #else
     #define EXPORT
     #include "raylib.h"
     #include "raymath.h"
+    #include "runtime/profiler.h"
+    #include "runtime/assets.h"
+    #include "runtime/sprites.h"
+    #include "runtime/text_cache.h"
+    #include "runtime/modules.h"
 #endif
 
 EXPORT void game_hot_reloaded(void* mem);
@@ -38,4 +51,10 @@ EXPORT int game_memory_size();
 EXPORT bool game_force_reload();
 EXPORT bool game_force_restart();
 
+// Batch simulation, see game_sim.h
+EXPORT int game_sim_memory_size();
+EXPORT void game_sim_init(void* mem);
+EXPORT bool game_sim_step(void* mem, unsigned int keys, float dt);
+EXPORT void game_sim_result(void* mem, GameSimResult* result);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,31 @@
+#ifndef GAME_SIM_H
+#define GAME_SIM_H
+
+#include <stdbool.h>
+
+// Headless simulation of the game, for batch runs (tools/sim_runner.c).
+//
+// The game_sim_* entry points only touch the memory block they're given:
+// no globals, no raylib, no window. So a runner can load the game library
+// once, allocate any number of blocks of game_sim_memory_size() bytes and
+// step them on as many threads. Input is a mask of held keys per step, and
+// the same inputs and dt give the same results.
+typedef enum {
+    GAME_SIM_KEY_UP = 1 << 0,
+    GAME_SIM_KEY_DOWN = 1 << 1,
+    GAME_SIM_KEY_LEFT = 1 << 2,
+    GAME_SIM_KEY_RIGHT = 1 << 3,
+    GAME_SIM_KEY_ROTATE_LEFT = 1 << 4,
+    GAME_SIM_KEY_ROTATE_RIGHT = 1 << 5,
+    // Ends the session, like ESC
+    GAME_SIM_KEY_QUIT = 1 << 6,
+} GameSimKey;
+
+typedef struct {
+    int frames;
+    float x;
+    float y;
+    float rotation;
+} GameSimResult;
+
+#endif // GAME_SIM_H
@@ -0,0 +1,162 @@
+#define _GNU_SOURCE
+
+#include "crash_guard.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+    #include <pthread.h>
+    #include <setjmp.h>
+    #include <signal.h>
+#endif
+
+#ifndef _WIN32
+
+// Big enough for the handler after a stack overflow
+#define CRASH_GUARD_STACK_SIZE (64 * 1024)
+
+static const int crash_guard_signals[] = { SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT };
+#define CRASH_GUARD_SIGNAL_COUNT ((int)(sizeof(crash_guard_signals) / sizeof(crash_guard_signals[0])))
+
+typedef struct {
+    int enabled;
+    pthread_t thread;
+    struct sigaction previous[CRASH_GUARD_SIGNAL_COUNT];
+
+    sigjmp_buf jump;
+    volatile sig_atomic_t active;
+    volatile int signal;
+    void* volatile address;
+} CrashGuard;
+
+static CrashGuard crash_guard = { .enabled = -1 };
+
+static void crash_guard_handler(int signal, siginfo_t* info, void* context) {
+    (void)context;
+    if (crash_guard.active && pthread_equal(pthread_self(), crash_guard.thread)) {
+        crash_guard.active = 0;
+        crash_guard.signal = signal;
+        crash_guard.address = info ? info->si_addr : NULL;
+        siglongjmp(crash_guard.jump, 1);
+    }
+
+    // Outside a guarded call, whatever handled it before does
+    for (int i = 0; i < CRASH_GUARD_SIGNAL_COUNT; i++) {
+        if (crash_guard_signals[i] == signal) {
+            sigaction(signal, &crash_guard.previous[i], NULL);
+            break;
+        }
+    }
+    raise(signal);
+}
+
+// On the first guarded call, from the thread that makes them
+static bool crash_guard_install(void) {
+    if (crash_guard.enabled >= 0) return crash_guard.enabled;
+
+    const char* value = getenv("HOT_RELOAD_CRASH_GUARD");
+    crash_guard.enabled = !(value && strcmp(value, "0") == 0);
+    if (!crash_guard.enabled) return false;
+
+    // Stack overflows can only be handled on a stack of their own
+    stack_t stack = {0};
+    stack.ss_sp = malloc(CRASH_GUARD_STACK_SIZE);
+    stack.ss_size = CRASH_GUARD_STACK_SIZE;
+    if (!stack.ss_sp || sigaltstack(&stack, NULL) != 0) {
+        printf("[CRASH_GUARD] No alternate signal stack, stack overflows won't be caught\n");
+        free(stack.ss_sp);
+    }
+
+    // SA_NODEFER, since jumping out of the handler doesn't unblock the signal
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = crash_guard_handler;
+    action.sa_flags = SA_SIGINFO | SA_ONSTACK | SA_NODEFER;
+    sigemptyset(&action.sa_mask);
+    for (int i = 0; i < CRASH_GUARD_SIGNAL_COUNT; i++) {
+        sigaction(crash_guard_signals[i], &action, &crash_guard.previous[i]);
+    }
+
+    crash_guard.thread = pthread_self();
+    return true;
+}
+
+// The signal mask isn't saved, which would be a system call per call
+bool crash_guard_call(void (*fn)(void)) {
+    if (!crash_guard_install()) {
+        fn();
+        return true;
+    }
+
+    if (sigsetjmp(crash_guard.jump, 0)) return false;
+    crash_guard.active = 1;
+    fn();
+    crash_guard.active = 0;
+    return true;
+}
+
+bool crash_guard_call_arg(void (*fn)(void*), void* arg) {
+    if (!crash_guard_install()) {
+        fn(arg);
+        return true;
+    }
+
+    if (sigsetjmp(crash_guard.jump, 0)) return false;
+    crash_guard.active = 1;
+    fn(arg);
+    crash_guard.active = 0;
+    return true;
+}
+
+const char* crash_guard_signal_name(void) {
+    switch (crash_guard.signal) {
+        case SIGSEGV: return "SIGSEGV";
+        case SIGBUS: return "SIGBUS";
+        case SIGFPE: return "SIGFPE";
+        case SIGILL: return "SIGILL";
+        case SIGABRT: return "SIGABRT";
+        default: return "no signal";
+    }
+}
+
+void* crash_guard_fault_address(void) {
+    return crash_guard.address;
+}
+
+void crash_guard_fatal(void) {
+    int signal = crash_guard.signal ? crash_guard.signal : SIGABRT;
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = SIG_DFL;
+    sigemptyset(&action.sa_mask);
+    sigaction(signal, &action, NULL);
+    raise(signal);
+    abort();
+}
+
+#else
+
+bool crash_guard_call(void (*fn)(void)) {
+    fn();
+    return true;
+}
+
+bool crash_guard_call_arg(void (*fn)(void*), void* arg) {
+    fn(arg);
+    return true;
+}
+
+const char* crash_guard_signal_name(void) {
+    return "no signal";
+}
+
+void* crash_guard_fault_address(void) {
+    return NULL;
+}
+
+void crash_guard_fatal(void) {
+    abort();
+}
+
+#endif
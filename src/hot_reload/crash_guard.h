@@ -0,0 +1,31 @@
+#ifndef HOT_RELOAD_CRASH_GUARD_H
+#define HOT_RELOAD_CRASH_GUARD_H
+
+#include <stdbool.h>
+
+// Crash guard for calls into the game library (Mac/Linux).
+//
+// A guarded call that crashes (SIGSEGV, SIGBUS, SIGFPE, SIGILL or SIGABRT,
+// stack overflows included) returns false instead of killing the host, which
+// can then restore game memory and go back to the previous library version.
+// Only the thread that made the guarded call is guarded. A crash anywhere
+// else goes to the previous handler, usually the default one that kills the
+// process. Entering a guarded call makes no system call, so the host guards
+// update() every frame.
+//
+// The crashed call is cut short wherever it was, so anything it left half
+// done outside game memory (an open BeginDrawing, an allocation) stays that
+// way, except for profiler zones, which the host unwinds. Set HOT_RELOAD_CRASH_GUARD=0 to turn it off, e.g. under a debugger
+// or a sanitizer with its own handlers. On Windows calls are not guarded.
+bool crash_guard_call(void (*fn)(void));
+bool crash_guard_call_arg(void (*fn)(void*), void* arg);
+
+// Name of the signal that ended the last crashed call, and the faulting address
+const char* crash_guard_signal_name(void);
+void* crash_guard_fault_address(void);
+
+// When the crash can't be recovered from: raises the signal again with its
+// default action, so the host dies as it would have without the guard
+void crash_guard_fatal(void);
+
+#endif // HOT_RELOAD_CRASH_GUARD_H
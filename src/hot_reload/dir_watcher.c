@@ -0,0 +1,243 @@
+#define _GNU_SOURCE
+
+#include "dir_watcher.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __linux__
+    #include <dirent.h>
+    #include <errno.h>
+    #include <pthread.h>
+    #include <sys/inotify.h>
+    #include <sys/stat.h>
+    #include <time.h>
+    #include <unistd.h>
+
+#define DIR_WATCHER_MASK (IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE | IN_CREATE)
+
+typedef struct {
+    bool recursive;
+    volatile int changed;
+} DirWatchRoot;
+
+typedef struct {
+    int wd;
+    int root;
+    char path[256];
+} WatchedDirectory;
+
+typedef struct {
+    int fd;
+    bool started;
+    DirWatchRoot roots[DIR_WATCHER_MAX_ROOTS];
+    int root_count;
+    // Only the watcher thread touches this once it's started
+    WatchedDirectory directories[DIR_WATCHER_MAX_DIRECTORIES];
+    int directory_count;
+
+    // Bumped on every batch of events, dir_watcher_wait() sleeps until it moves
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    unsigned generation;
+    unsigned waited_generation;
+} DirWatcher;
+
+static DirWatcher dir_watcher = { .fd = -1, .mutex = PTHREAD_MUTEX_INITIALIZER };
+
+static bool is_directory(const char* path) {
+    struct stat st;
+    return stat(path, &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+static bool watch_directory(const char* path, int root) {
+    if (dir_watcher.directory_count >= DIR_WATCHER_MAX_DIRECTORIES) {
+        printf("[DIR_WATCHER] Too many directories, %s isn't watched\n", path);
+        return false;
+    }
+
+    if (strlen(path) >= sizeof(dir_watcher.directories[0].path)) {
+        printf("[DIR_WATCHER] Path too long, %s isn't watched\n", path);
+        return false;
+    }
+
+    int wd = inotify_add_watch(dir_watcher.fd, path, DIR_WATCHER_MASK | IN_ONLYDIR);
+    if (wd < 0) return false;
+
+    WatchedDirectory* directory = &dir_watcher.directories[dir_watcher.directory_count++];
+    directory->wd = wd;
+    directory->root = root;
+    snprintf(directory->path, sizeof(directory->path), "%s", path);
+
+    if (!dir_watcher.roots[root].recursive) return true;
+
+    DIR* dir = opendir(path);
+    if (!dir) return true;
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) continue;
+
+        char child[512];
+        snprintf(child, sizeof(child), "%s/%s", path, entry->d_name);
+        if (entry->d_type == DT_DIR || (entry->d_type == DT_UNKNOWN && is_directory(child))) {
+            watch_directory(child, root);
+        }
+    }
+    closedir(dir);
+    return true;
+}
+
+static WatchedDirectory* find_directory(int wd) {
+    for (int i = 0; i < dir_watcher.directory_count; i++) {
+        if (dir_watcher.directories[i].wd == wd) return &dir_watcher.directories[i];
+    }
+    return NULL;
+}
+
+static void* dir_watcher_thread(void* data) {
+    (void)data;
+    char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+
+    for (;;) {
+        ssize_t length = read(dir_watcher.fd, buffer, sizeof(buffer));
+        if (length < 0 && errno == EINTR) continue;
+        if (length <= 0) break;
+
+        bool changed = false;
+        for (char* cursor = buffer; cursor < buffer + length; ) {
+            const struct inotify_event* event = (const struct inotify_event*)cursor;
+            cursor += sizeof(struct inotify_event) + event->len;
+
+            // Events were dropped, anything could have changed
+            if (event->mask & IN_Q_OVERFLOW) {
+                for (int i = 0; i < dir_watcher.root_count; i++) {
+                    __sync_lock_test_and_set(&dir_watcher.roots[i].changed, 1);
+                }
+                changed = true;
+                continue;
+            }
+
+            WatchedDirectory* directory = find_directory(event->wd);
+            if (!directory) continue;
+            if (event->mask & IN_IGNORED) {
+                directory->wd = -1;
+                continue;
+            }
+
+            int root = directory->root;
+            if ((event->mask & IN_ISDIR) && (event->mask & (IN_CREATE | IN_MOVED_TO)) && event->len > 0 &&
+                dir_watcher.roots[root].recursive) {
+                char path[512];
+                snprintf(path, sizeof(path), "%s/%s", directory->path, event->name);
+                watch_directory(path, root);
+            }
+
+            // A new file is reported once it's written, not while it's half written
+            if ((event->mask & IN_CREATE) && !(event->mask & IN_ISDIR)) continue;
+
+            __sync_lock_test_and_set(&dir_watcher.roots[root].changed, 1);
+            changed = true;
+        }
+
+        if (changed) {
+            pthread_mutex_lock(&dir_watcher.mutex);
+            dir_watcher.generation++;
+            pthread_cond_broadcast(&dir_watcher.cond);
+            pthread_mutex_unlock(&dir_watcher.mutex);
+        }
+    }
+
+    printf("[DIR_WATCHER] Stopped watching\n");
+    return NULL;
+}
+
+int dir_watcher_add(const char* path, bool recursive) {
+    if (dir_watcher.started || dir_watcher.root_count >= DIR_WATCHER_MAX_ROOTS) return -1;
+
+    if (dir_watcher.fd < 0) {
+        dir_watcher.fd = inotify_init1(IN_CLOEXEC);
+        if (dir_watcher.fd < 0) {
+            printf("[DIR_WATCHER] inotify unavailable, polling instead\n");
+            return -1;
+        }
+    }
+
+    // Reported changed once, for whatever changed before the watch was set up
+    int root = dir_watcher.root_count;
+    dir_watcher.roots[root] = (DirWatchRoot){ recursive, 1 };
+    if (!watch_directory(path, root)) {
+        printf("[DIR_WATCHER] Failed to watch %s\n", path);
+        return -1;
+    }
+    dir_watcher.root_count++;
+    return root;
+}
+
+// The thread lives until the host exits
+bool dir_watcher_start(void) {
+    if (dir_watcher.started) return true;
+    if (dir_watcher.fd < 0 || dir_watcher.root_count == 0) return false;
+
+    // Waits time out on the monotonic clock, wall clock jumps don't matter
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&dir_watcher.cond, &attr);
+    pthread_condattr_destroy(&attr);
+
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, dir_watcher_thread, NULL) != 0) {
+        printf("[DIR_WATCHER] Failed to start the watcher thread, polling instead\n");
+        return false;
+    }
+    pthread_detach(thread);
+    dir_watcher.started = true;
+    printf("[DIR_WATCHER] Watching %d directories\n", dir_watcher.directory_count);
+    return true;
+}
+
+bool dir_watcher_changed(int watch) {
+    if (watch < 0 || !dir_watcher.roots[watch].changed) return false;
+    return __sync_lock_test_and_set(&dir_watcher.roots[watch].changed, 0) != 0;
+}
+
+bool dir_watcher_wait(double seconds) {
+    if (!dir_watcher.started) return false;
+
+    struct timespec until;
+    clock_gettime(CLOCK_MONOTONIC, &until);
+    long long nanoseconds = until.tv_nsec + (long long)(seconds * 1e9);
+    until.tv_sec += (time_t)(nanoseconds / 1000000000);
+    until.tv_nsec = (long)(nanoseconds % 1000000000);
+
+    pthread_mutex_lock(&dir_watcher.mutex);
+    while (dir_watcher.generation == dir_watcher.waited_generation) {
+        if (pthread_cond_timedwait(&dir_watcher.cond, &dir_watcher.mutex, &until) == ETIMEDOUT) break;
+    }
+    dir_watcher.waited_generation = dir_watcher.generation;
+    pthread_mutex_unlock(&dir_watcher.mutex);
+    return true;
+}
+
+#else
+
+int dir_watcher_add(const char* path, bool recursive) {
+    (void)path;
+    (void)recursive;
+    return -1;
+}
+
+bool dir_watcher_start(void) {
+    return false;
+}
+
+bool dir_watcher_changed(int watch) {
+    (void)watch;
+    return false;
+}
+
+bool dir_watcher_wait(double seconds) {
+    (void)seconds;
+    return false;
+}
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef HOT_RELOAD_DIR_WATCHER_H
+#define HOT_RELOAD_DIR_WATCHER_H
+
+#include <stdbool.h>
+
+// Directory change notification for the hot reload host (Linux inotify).
+//
+// Polling the game library, the sources and the assets costs a stat() per
+// file, every frame or every few seconds. Instead, the host adds the
+// directories it cares about and starts the watcher, whose thread sleeps in
+// read() until something in them is written, created, moved or deleted.
+// dir_watcher_changed() only reads a flag, so frames where nothing changed
+// make no filesystem calls. The host then stats the files of that directory
+// as it did before, to find out what changed.
+//
+// Elsewhere dir_watcher_add() returns -1, dir_watcher_start() returns false,
+// and the host keeps polling.
+#define DIR_WATCHER_MAX_ROOTS 8
+#define DIR_WATCHER_MAX_DIRECTORIES 256
+
+// Returns the watch to pass to dir_watcher_changed(), -1 if it can't be watched
+int dir_watcher_add(const char* path, bool recursive);
+bool dir_watcher_start(void);
+// True once after anything changed in the watched directory
+bool dir_watcher_changed(int watch);
+// Sleeps until something changes in any watched directory, or for at most
+// the given time. Every change wakes one wait, even one made before it was
+// called. Returns false at once when the watcher isn't running, and the
+// caller sleeps on its own.
+bool dir_watcher_wait(double seconds);
+
+#endif // HOT_RELOAD_DIR_WATCHER_H
@@ -0,0 +1,228 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "elf_symbols.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+    #include <elf.h>
+#endif
+
+static int compare_symbols(const void* a, const void* b) {
+    const ElfSymbol* sa = (const ElfSymbol*)a;
+    const ElfSymbol* sb = (const ElfSymbol*)b;
+    if (sa->address != sb->address) return sa->address < sb->address ? -1 : 1;
+    return 0;
+}
+
+static unsigned char* read_whole_file(const char* path, size_t* size) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return NULL;
+
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    unsigned char* data = length > 0 ? malloc((size_t)length) : NULL;
+    if (data && fread(data, 1, (size_t)length, file) != (size_t)length) {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+
+    *size = data ? (size_t)length : 0;
+    return data;
+}
+
+// FNV-1a
+static uint64_t hash_bytes(uint64_t hash, const void* data, size_t size) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+#ifdef __linux__
+
+// Prefers .symtab, which also has static functions, and falls back to
+// .dynsym for stripped libraries
+bool elf_symbols_load(const char* path, ElfSymbolTable* table) {
+    memset(table, 0, sizeof(*table));
+
+    size_t size = 0;
+    unsigned char* data = read_whole_file(path, &size);
+    if (!data) {
+        printf("[ELF] Failed to read %s\n", path);
+        return false;
+    }
+
+    const Elf64_Ehdr* header = (const Elf64_Ehdr*)data;
+    if (size < sizeof(Elf64_Ehdr) || memcmp(header->e_ident, ELFMAG, SELFMAG) != 0 ||
+        header->e_ident[EI_CLASS] != ELFCLASS64 ||
+        header->e_shoff == 0 || header->e_shoff + (uint64_t)header->e_shnum * sizeof(Elf64_Shdr) > size) {
+        printf("[ELF] %s is not a 64-bit ELF file\n", path);
+        free(data);
+        return false;
+    }
+
+    const Elf64_Shdr* sections = (const Elf64_Shdr*)(data + header->e_shoff);
+    const Elf64_Shdr* symtab = NULL;
+    for (int i = 0; i < header->e_shnum; i++) {
+        if (sections[i].sh_type == SHT_SYMTAB) {
+            symtab = &sections[i];
+            break;
+        }
+        if (sections[i].sh_type == SHT_DYNSYM && !symtab) {
+            symtab = &sections[i];
+        }
+    }
+
+    if (!symtab || symtab->sh_link >= header->e_shnum ||
+        symtab->sh_offset + symtab->sh_size > size) {
+        free(data);
+        return false;
+    }
+
+    const Elf64_Shdr* strtab = &sections[symtab->sh_link];
+    if (strtab->sh_offset + strtab->sh_size > size) {
+        free(data);
+        return false;
+    }
+
+    const Elf64_Sym* symbols = (const Elf64_Sym*)(data + symtab->sh_offset);
+    const char* strings = (const char*)(data + strtab->sh_offset);
+    int symbol_count = (int)(symtab->sh_size / sizeof(Elf64_Sym));
+
+    // Two passes: count functions and name bytes, then copy them out
+    int function_count = 0;
+    size_t names_size = 0;
+    for (int i = 0; i < symbol_count; i++) {
+        if (ELF64_ST_TYPE(symbols[i].st_info) != STT_FUNC || symbols[i].st_value == 0) continue;
+        if (symbols[i].st_name >= strtab->sh_size) continue;
+        function_count++;
+        names_size += strnlen(strings + symbols[i].st_name, strtab->sh_size - symbols[i].st_name) + 1;
+    }
+
+    table->symbols = calloc(function_count > 0 ? function_count : 1, sizeof(ElfSymbol));
+    table->names = malloc(names_size > 0 ? names_size : 1);
+    if (!table->symbols || !table->names) {
+        elf_symbols_free(table);
+        free(data);
+        return false;
+    }
+
+    char* name_cursor = table->names;
+    for (int i = 0; i < symbol_count; i++) {
+        if (ELF64_ST_TYPE(symbols[i].st_info) != STT_FUNC || symbols[i].st_value == 0) continue;
+        if (symbols[i].st_name >= strtab->sh_size) continue;
+
+        size_t length = strnlen(strings + symbols[i].st_name, strtab->sh_size - symbols[i].st_name);
+        memcpy(name_cursor, strings + symbols[i].st_name, length);
+        name_cursor[length] = '\0';
+
+        ElfSymbol* symbol = &table->symbols[table->count++];
+        symbol->address = symbols[i].st_value;
+        symbol->size = symbols[i].st_size;
+        symbol->name = name_cursor;
+        name_cursor += length + 1;
+    }
+
+    qsort(table->symbols, table->count, sizeof(ElfSymbol), compare_symbols);
+
+    free(data);
+    return true;
+}
+
+// Hashes what the loader maps: every allocated section but the notes, whose
+// build id also covers the debug info, which changes with line numbers
+static bool elf_hash_loaded_sections(const unsigned char* data, size_t size, uint64_t* hash) {
+    const Elf64_Ehdr* header = (const Elf64_Ehdr*)data;
+    if (size < sizeof(Elf64_Ehdr) || memcmp(header->e_ident, ELFMAG, SELFMAG) != 0 ||
+        header->e_ident[EI_CLASS] != ELFCLASS64 ||
+        header->e_shoff == 0 || header->e_shoff + (uint64_t)header->e_shnum * sizeof(Elf64_Shdr) > size) {
+        return false;
+    }
+
+    const Elf64_Shdr* sections = (const Elf64_Shdr*)(data + header->e_shoff);
+    uint64_t result = 14695981039346656037ULL;
+    for (int i = 0; i < header->e_shnum; i++) {
+        const Elf64_Shdr* section = &sections[i];
+        if (!(section->sh_flags & SHF_ALLOC) || section->sh_type == SHT_NOTE) continue;
+
+        result = hash_bytes(result, &section->sh_addr, sizeof(section->sh_addr));
+        result = hash_bytes(result, &section->sh_size, sizeof(section->sh_size));
+        if (section->sh_type == SHT_NOBITS) continue;
+        if (section->sh_offset + section->sh_size > size) return false;
+        result = hash_bytes(result, data + section->sh_offset, (size_t)section->sh_size);
+    }
+    *hash = result;
+    return true;
+}
+
+#else
+
+bool elf_symbols_load(const char* path, ElfSymbolTable* table) {
+    (void)path;
+    memset(table, 0, sizeof(*table));
+    return false;
+}
+
+#endif
+
+// Other files (.dylib, .dll) are hashed whole. A .dll has its link time in
+// its header, so two builds of one never hash the same.
+bool elf_content_hash(const char* path, uint64_t* hash) {
+    size_t size = 0;
+    unsigned char* data = read_whole_file(path, &size);
+    if (!data) return false;
+
+#ifdef __linux__
+    bool hashed = elf_hash_loaded_sections(data, size, hash);
+#else
+    bool hashed = false;
+#endif
+    if (!hashed) {
+        *hash = hash_bytes(14695981039346656037ULL, data, size);
+    }
+
+    free(data);
+    return true;
+}
+
+// Symbols without a size (hand written assembly...) cover everything up to
+// the next symbol
+const ElfSymbol* elf_symbols_find(const ElfSymbolTable* table, uint64_t address) {
+    int low = 0;
+    int high = table->count - 1;
+    int found = -1;
+
+    while (low <= high) {
+        int middle = low + (high - low) / 2;
+        if (table->symbols[middle].address <= address) {
+            found = middle;
+            low = middle + 1;
+        } else {
+            high = middle - 1;
+        }
+    }
+
+    if (found < 0) return NULL;
+
+    const ElfSymbol* symbol = &table->symbols[found];
+    if (symbol->size > 0) {
+        return address < symbol->address + symbol->size ? symbol : NULL;
+    }
+    if (found + 1 < table->count && address >= table->symbols[found + 1].address) {
+        return NULL;
+    }
+    return symbol;
+}
+
+void elf_symbols_free(ElfSymbolTable* table) {
+    free(table->symbols);
+    free(table->names);
+    memset(table, 0, sizeof(*table));
+}
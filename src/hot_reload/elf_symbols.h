@@ -0,0 +1,33 @@
+#ifndef HOT_RELOAD_ELF_SYMBOLS_H
+#define HOT_RELOAD_ELF_SYMBOLS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Minimal ELF64 function symbol reader.
+//
+// The host copies every game library version to its own file and deletes it
+// when it's unloaded, so anything that wants to name code from an old version
+// has to read its symbols while the file still exists. Only function symbols
+// are kept, sorted by address (relative to the library's load base).
+typedef struct {
+    uint64_t address;
+    uint64_t size;
+    const char* name;
+} ElfSymbol;
+
+typedef struct {
+    ElfSymbol* symbols;
+    int count;
+    char* names;
+} ElfSymbolTable;
+
+bool elf_symbols_load(const char* path, ElfSymbolTable* table);
+const ElfSymbol* elf_symbols_find(const ElfSymbolTable* table, uint64_t address);
+void elf_symbols_free(ElfSymbolTable* table);
+
+// Hash of the code and data of a library, without the debug info and build
+// id, so rebuilds that only moved lines or comments hash the same
+bool elf_content_hash(const char* path, uint64_t* hash);
+
+#endif // HOT_RELOAD_ELF_SYMBOLS_H
@@ -28,7 +28,9 @@ int should_ignore_file(const char* filename) {
 }
 
 int should_ignore_directory(const char* dirname) {
-    return strcmp(dirname, "hot_reload") == 0;
+    // Host code, a game library rebuild wouldn't pick up changes there
+    return strcmp(dirname, "hot_reload") == 0 ||
+           strcmp(dirname, "runtime") == 0;
 }
 
 int has_extension(const char* filename, const char* ext) {
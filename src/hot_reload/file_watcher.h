@@ -12,6 +12,28 @@ typedef struct {
 
 FileVersion *file_watcher;
 int file_watcher_count;
+// Modification time of the last changed file found by file_watcher_check()
+time_t file_watcher_changed_time;
+// When every changed file is inside src/modules/<name>/, that name, so only
+// that module needs to be rebuilt. Empty otherwise.
+char file_watcher_changed_module[64];
+
+// Name of the module a source belongs to, empty outside src/modules
+static void file_watcher_module_of(const char* path, char* module, size_t size) {
+    module[0] = '\0';
+    const char* prefix = "src/modules/";
+    size_t prefix_length = strlen(prefix);
+    for (size_t i = 0; i < prefix_length; i++) {
+        char c = path[i] == '\\' ? '/' : path[i];
+        if (c != prefix[i]) return;
+    }
+
+    const char* name = path + prefix_length;
+    size_t length = strcspn(name, "/\\");
+    if (name[length] == '\0' || length >= size) return;
+    memcpy(module, name, length);
+    module[length] = '\0';
+}
 
 bool file_watcher_reload() {
     FILE *file = fopen("src/hot_reload/file_versions.dat", "r");
@@ -52,6 +74,7 @@ bool file_watcher_reload() {
 }
 
 bool file_watcher_check() {
+    bool changed = false;
     for (int i = 0; i < file_watcher_count; i++) {
         time_t mod_time = platform_get_modification_time(file_watcher[i].path);
         if (mod_time == 0) {
@@ -75,10 +98,20 @@ bool file_watcher_check() {
             }
         }
         if (mod_time != file_watcher[i].modification_time) {
+            file_watcher_changed_time = mod_time;
             printf("[FILE_WATCHER] File %s has changed (disk: %lld, memory: %lld)\n", 
                    file_watcher[i].path, (long long)mod_time, (long long)file_watcher[i].modification_time);
-            return true;
+
+            // Keep scanning, a module can only be rebuilt alone if nothing else changed
+            char module[sizeof(file_watcher_changed_module)];
+            file_watcher_module_of(file_watcher[i].path, module, sizeof(module));
+            if (!changed) {
+                strcpy(file_watcher_changed_module, module);
+            } else if (strcmp(file_watcher_changed_module, module) != 0) {
+                file_watcher_changed_module[0] = '\0';
+            }
+            changed = true;
         }
     }
-    return false;
+    return changed;
 }
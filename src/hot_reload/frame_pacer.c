@@ -0,0 +1,219 @@
+#define _GNU_SOURCE
+
+#include "frame_pacer.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+    #include <errno.h>
+    #include <time.h>
+#endif
+#ifdef __linux__
+    #include <sys/prctl.h>
+#endif
+
+#ifndef _WIN32
+
+// How long to spin before a deadline is learned from how late sleeps end.
+// It grows at once when a sleep ends later, and shrinks slowly.
+#define FRAME_PACER_INITIAL_SPIN_NS 500000
+#define FRAME_PACER_MIN_SPIN_NS 20000
+#define FRAME_PACER_MAX_SPIN_NS 2000000
+#define FRAME_PACER_SPIN_MARGIN_NS 20000
+// Frames starting later than this count as jittery in the summary
+#define FRAME_PACER_JITTER_LIMIT_US 100.0f
+
+typedef struct {
+    int enabled;
+    void (*set_target_fps)(int fps);
+
+    int target_fps;
+    int64_t period;
+    // 0 until the first paced frame
+    int64_t deadline;
+    int64_t spin;
+
+    float jitter_us[FRAME_PACER_WINDOW];
+    int jitter_count;
+    int jitter_next;
+    double jitter_sum;
+
+    unsigned long long frames;
+    unsigned long long missed;
+    unsigned long long over_limit;
+    double total_jitter_us;
+    float max_jitter_us;
+} FramePacer;
+
+static FramePacer frame_pacer = { .enabled = -1, .spin = FRAME_PACER_INITIAL_SPIN_NS };
+
+static int64_t frame_pacer_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void frame_pacer_sleep_until(int64_t target) {
+#ifdef __linux__
+    struct timespec ts = { (time_t)(target / 1000000000), (long)(target % 1000000000) };
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {}
+#else
+    // No absolute sleep on macOS
+    int64_t left = target - frame_pacer_now();
+    if (left <= 0) return;
+    struct timespec ts = { (time_t)(left / 1000000000), (long)(left % 1000000000) };
+    nanosleep(&ts, NULL);
+#endif
+}
+
+static inline void frame_pacer_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ volatile("yield");
+#endif
+}
+
+static void frame_pacer_record(float jitter_us) {
+    if (frame_pacer.jitter_count == FRAME_PACER_WINDOW) {
+        frame_pacer.jitter_sum -= frame_pacer.jitter_us[frame_pacer.jitter_next];
+    } else {
+        frame_pacer.jitter_count++;
+    }
+    frame_pacer.jitter_us[frame_pacer.jitter_next] = jitter_us;
+    frame_pacer.jitter_next = (frame_pacer.jitter_next + 1) % FRAME_PACER_WINDOW;
+    frame_pacer.jitter_sum += jitter_us;
+
+    frame_pacer.total_jitter_us += jitter_us;
+    if (jitter_us > frame_pacer.max_jitter_us) frame_pacer.max_jitter_us = jitter_us;
+    if (jitter_us > FRAME_PACER_JITTER_LIMIT_US) frame_pacer.over_limit++;
+}
+
+// Stands in for the game's SetTargetFPS()
+static void frame_pacer_set_target_fps(int fps) {
+    frame_pacer.target_fps = fps > 0 ? fps : 0;
+    frame_pacer.period = fps > 0 ? 1000000000 / fps : 0;
+    frame_pacer.deadline = 0;
+    frame_pacer.set_target_fps(0);
+    if (fps > 0) {
+        printf("[FRAME_PACER] Pacing at %d FPS\n", fps);
+    } else {
+        printf("[FRAME_PACER] Unlimited FPS, not pacing\n");
+    }
+}
+
+void frame_pacer_hook(RaylibAPI* api) {
+    if (frame_pacer.enabled < 0) {
+        const char* value = getenv("HOT_RELOAD_FRAME_PACER");
+        frame_pacer.enabled = !(value && strcmp(value, "0") == 0);
+    }
+    if (!frame_pacer.enabled || api->set_target_fps == frame_pacer_set_target_fps) return;
+
+    frame_pacer.set_target_fps = api->set_target_fps;
+    api->set_target_fps = frame_pacer_set_target_fps;
+#ifdef __linux__
+    // Sleeps of this thread end within a microsecond of their deadline,
+    // instead of the default 50
+    prctl(PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL);
+#endif
+}
+
+void frame_pacer_wait(void) {
+    if (frame_pacer.period == 0) return;
+
+    int64_t now = frame_pacer_now();
+    if (frame_pacer.deadline == 0 || now > frame_pacer.deadline) {
+        if (frame_pacer.deadline != 0) {
+            frame_pacer.frames++;
+            frame_pacer.missed++;
+        }
+        frame_pacer.deadline = now + frame_pacer.period;
+        return;
+    }
+
+    int64_t wake = frame_pacer.deadline - frame_pacer.spin;
+    if (wake > now) {
+        frame_pacer_sleep_until(wake);
+        int64_t late = frame_pacer_now() - wake + FRAME_PACER_SPIN_MARGIN_NS;
+        if (late > frame_pacer.spin) {
+            frame_pacer.spin = late;
+        } else {
+            frame_pacer.spin -= (frame_pacer.spin - late) / 64;
+        }
+        if (frame_pacer.spin < FRAME_PACER_MIN_SPIN_NS) frame_pacer.spin = FRAME_PACER_MIN_SPIN_NS;
+        if (frame_pacer.spin > FRAME_PACER_MAX_SPIN_NS) frame_pacer.spin = FRAME_PACER_MAX_SPIN_NS;
+    }
+
+    while ((now = frame_pacer_now()) < frame_pacer.deadline) {
+        frame_pacer_relax();
+    }
+
+    frame_pacer.frames++;
+    frame_pacer_record((float)(now - frame_pacer.deadline) / 1000.0f);
+    frame_pacer.deadline += frame_pacer.period;
+}
+
+void frame_pacer_reset(void) {
+    frame_pacer.deadline = 0;
+}
+
+bool frame_pacer_active(void) {
+    return frame_pacer.period != 0;
+}
+
+FramePacerStats frame_pacer_stats(void) {
+    FramePacerStats stats = {0};
+    stats.target_fps = frame_pacer.target_fps;
+    stats.spin_us = (float)frame_pacer.spin / 1000.0f;
+    stats.frames = frame_pacer.frames;
+    stats.missed = frame_pacer.missed;
+    if (frame_pacer.jitter_count > 0) {
+        stats.jitter_avg_us = (float)(frame_pacer.jitter_sum / frame_pacer.jitter_count);
+        for (int i = 0; i < frame_pacer.jitter_count; i++) {
+            if (frame_pacer.jitter_us[i] > stats.jitter_max_us) stats.jitter_max_us = frame_pacer.jitter_us[i];
+        }
+    }
+    return stats;
+}
+
+void frame_pacer_print_summary(void) {
+    if (frame_pacer.frames == 0) return;
+
+    unsigned long long paced = frame_pacer.frames - frame_pacer.missed;
+    printf("[FRAME_PACER] %llu frames at %d FPS, %llu missed deadlines (%.1f%%)\n",
+           frame_pacer.frames, frame_pacer.target_fps, frame_pacer.missed,
+           100.0 * (double)frame_pacer.missed / (double)frame_pacer.frames);
+    if (paced > 0) {
+        printf("[FRAME_PACER] Frame start jitter avg %.1f us, max %.1f us, %llu frames over %.0f us\n",
+               frame_pacer.total_jitter_us / (double)paced, frame_pacer.max_jitter_us,
+               frame_pacer.over_limit, FRAME_PACER_JITTER_LIMIT_US);
+    }
+}
+
+#else
+
+void frame_pacer_hook(RaylibAPI* api) {
+    (void)api;
+}
+
+void frame_pacer_wait(void) {
+}
+
+void frame_pacer_reset(void) {
+}
+
+bool frame_pacer_active(void) {
+    return false;
+}
+
+FramePacerStats frame_pacer_stats(void) {
+    FramePacerStats stats = {0};
+    return stats;
+}
+
+void frame_pacer_print_summary(void) {
+}
+
+#endif
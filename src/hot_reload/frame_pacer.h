@@ -0,0 +1,43 @@
+#ifndef HOT_RELOAD_FRAME_PACER_H
+#define HOT_RELOAD_FRAME_PACER_H
+
+#include <stdbool.h>
+#include "raylib_api.gen.h"
+
+// Frame pacing for the hot reload host (Mac/Linux).
+//
+// raylib waits for the target FPS inside EndDrawing(), after the frame's
+// update and draw but before the host's own work, so whatever the host does
+// around update() (watchers, reloads) shifts when the next frame starts.
+// frame_pacer_hook() takes over the game's SetTargetFPS(): raylib is told to
+// not wait at all, and the host calls frame_pacer_wait() at the top of its
+// loop instead. Frames start on deadlines a fixed period apart on the
+// monotonic clock. The wait sleeps until shortly before the deadline and
+// spins the rest, the spin being as long as sleeps have recently overslept.
+// A frame that starts past its deadline is a missed deadline, and the next
+// ones are scheduled from it instead of rushing to catch up.
+//
+// Set HOT_RELOAD_FRAME_PACER=0 to let raylib wait as before. On Windows
+// SetTargetFPS() is left alone.
+#define FRAME_PACER_WINDOW 600
+
+typedef struct {
+    int target_fps;
+    // Frame start minus deadline, over the last FRAME_PACER_WINDOW paced frames
+    float jitter_avg_us;
+    float jitter_max_us;
+    float spin_us;
+    unsigned long long frames;
+    unsigned long long missed;
+} FramePacerStats;
+
+// Replaces set_target_fps in the table, in place
+void frame_pacer_hook(RaylibAPI* api);
+void frame_pacer_wait(void);
+// After the host slept on its own, the next frame starts a new schedule
+void frame_pacer_reset(void);
+bool frame_pacer_active(void);
+FramePacerStats frame_pacer_stats(void);
+void frame_pacer_print_summary(void);
+
+#endif // HOT_RELOAD_FRAME_PACER_H
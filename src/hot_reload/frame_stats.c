@@ -0,0 +1,282 @@
+#include "frame_stats.h"
+#include "frame_pacer.h"
+#include "raylib.h"
+#include <stdio.h>
+#include <string.h>
+
+#define FRAME_STATS_TIMELINE_FRAMES 120
+#define FRAME_STATS_OVERLAY_WIDTH 240
+// The stats and the timeline fit in the sample's top bar (TOP_BAR_HEIGHT in
+// game.c), the unit list below it gets a background of its own
+#define FRAME_STATS_OVERLAY_HEIGHT 60
+#define FRAME_STATS_LINE_HEIGHT 10
+#define FRAME_STATS_TIMELINE_MS 33.3f
+#define FRAME_STATS_MAX_UNITS 12
+#define FRAME_STATS_ERROR_SECONDS 10.0
+
+// Optimization level of a unit of the game library
+typedef struct {
+    char level[8];
+    char name[64];
+} FrameStatsUnit;
+
+typedef struct {
+    RaylibAPI api;
+    RaylibAPI* target;
+
+    FrameStatsFrame frames[FRAME_STATS_HISTORY];
+    unsigned long long frame_count;
+    FrameStatsFrame current;
+
+    double frame_start;
+    double draw_start;
+
+    // Rolling histogram of the last FRAME_STATS_WINDOW frame times, the last
+    // bucket holds everything slower
+    int buckets[FRAME_STATS_BUCKETS + 1];
+    int window_count;
+
+    FrameStatsUnit units[FRAME_STATS_MAX_UNITS];
+    int unit_count;
+    int unit_total;
+
+    bool overlay;
+
+    // Shown whether the overlay is on or not
+    char error[256];
+    double error_until;
+} FrameStats;
+
+static FrameStats frame_stats = {0};
+
+static int frame_stats_bucket(float ms) {
+    int bucket = (int)(ms / FRAME_STATS_BUCKET_MS);
+    if (bucket < 0) return 0;
+    return bucket > FRAME_STATS_BUCKETS ? FRAME_STATS_BUCKETS : bucket;
+}
+
+static const FrameStatsFrame* frame_stats_frame(unsigned long long age) {
+    return &frame_stats.frames[(frame_stats.frame_count - 1 - age) % FRAME_STATS_HISTORY];
+}
+
+// Upper edge of the bucket holding the given fraction of the window
+static float frame_stats_percentile(float fraction) {
+    if (frame_stats.window_count == 0) return 0.0f;
+
+    int target = (int)(fraction * (float)frame_stats.window_count);
+    int seen = 0;
+    for (int i = 0; i <= FRAME_STATS_BUCKETS; i++) {
+        seen += frame_stats.buckets[i];
+        if (seen > target) return (float)((i + 1) * FRAME_STATS_BUCKET_MS);
+    }
+    return (float)(FRAME_STATS_BUCKETS * FRAME_STATS_BUCKET_MS);
+}
+
+static float frame_stats_window_max(void) {
+    float max = 0.0f;
+    for (int i = 0; i < frame_stats.window_count; i++) {
+        float ms = frame_stats_frame(i)->frame_ms;
+        if (ms > max) max = ms;
+    }
+    return max;
+}
+
+static void frame_stats_push(const FrameStatsFrame* frame) {
+    // The frame leaving the window leaves the histogram too
+    if (frame_stats.window_count == FRAME_STATS_WINDOW) {
+        frame_stats.buckets[frame_stats_bucket(frame_stats_frame(FRAME_STATS_WINDOW - 1)->frame_ms)]--;
+    } else {
+        frame_stats.window_count++;
+    }
+
+    frame_stats.frames[frame_stats.frame_count % FRAME_STATS_HISTORY] = *frame;
+    frame_stats.frame_count++;
+    frame_stats.buckets[frame_stats_bucket(frame->frame_ms)]++;
+}
+
+// A hitch is colored by what most likely caused it
+static Color frame_stats_color(const FrameStatsFrame* frame, float p50) {
+    if (frame->marks & FRAME_MARK_ROLLBACK) return MAGENTA;
+    if (frame->marks & FRAME_MARK_SWAP) return RED;
+    if (frame->marks & FRAME_MARK_REBUILD) return ORANGE;
+    if (frame->frame_ms < p50 * 1.5f) return DARKGREEN;
+    if ((frame->marks & FRAME_MARK_WATCHER) && frame->host_ms > frame->frame_ms * 0.25f) return YELLOW;
+    return RAYWHITE;
+}
+
+static void frame_stats_draw_overlay(void) {
+    int x = GetScreenWidth() - FRAME_STATS_OVERLAY_WIDTH - 10;
+    float max = frame_stats_window_max();
+    float p50 = frame_stats_percentile(0.50f);
+    float p95 = frame_stats_percentile(0.95f);
+    float p99 = frame_stats_percentile(0.99f);
+
+    // Bucket edges can overshoot the slowest frame
+    if (p50 > max) p50 = max;
+    if (p95 > max) p95 = max;
+    if (p99 > max) p99 = max;
+
+    int y = 4;
+    DrawText(TextFormat("p50 %.1f  p95 %.1f  p99 %.1f  max %.1f ms", p50, p95, p99, max), x, y, 10, RAYWHITE);
+    y += FRAME_STATS_LINE_HEIGHT;
+
+    if (frame_stats.frame_count > 0) {
+        const FrameStatsFrame* last = frame_stats_frame(0);
+        DrawText(TextFormat("upd %.2f  draw %.2f  pres %.2f  host %.2f",
+                            last->update_ms, last->draw_ms, last->present_ms, last->host_ms),
+                 x, y, 10, LIGHTGRAY);
+        y += FRAME_STATS_LINE_HEIGHT;
+    }
+
+    if (frame_pacer_active()) {
+        FramePacerStats pacer = frame_pacer_stats();
+        DrawText(TextFormat("pace %d  jit %.0f/%.0f us  spin %.0f  miss %llu",
+                            pacer.target_fps, pacer.jitter_avg_us, pacer.jitter_max_us, pacer.spin_us, pacer.missed),
+                 x, y, 10, pacer.jitter_max_us > 100.0f ? YELLOW : LIGHTGRAY);
+        y += FRAME_STATS_LINE_HEIGHT;
+    }
+
+    // One 2px bar per frame, newest on the right, full height is
+    // FRAME_STATS_TIMELINE_MS. It takes what the text left of the bar.
+    int bottom = FRAME_STATS_OVERLAY_HEIGHT - 2;
+    int height = bottom - (y + 2);
+    unsigned long long count = frame_stats.frame_count < FRAME_STATS_TIMELINE_FRAMES ? frame_stats.frame_count : FRAME_STATS_TIMELINE_FRAMES;
+    for (unsigned long long age = 0; age < count; age++) {
+        const FrameStatsFrame* frame = frame_stats_frame(age);
+        int bar = (int)(frame->frame_ms / FRAME_STATS_TIMELINE_MS * (float)height);
+        if (bar < 1) bar = 1;
+        if (bar > height) bar = height;
+        int bar_x = x + FRAME_STATS_OVERLAY_WIDTH - 2 * (int)(age + 1);
+        DrawRectangle(bar_x, bottom - bar, 2, bar, frame_stats_color(frame, p50));
+    }
+
+    // Units still at -O0 run slower than they will once they're stable
+    int units = frame_stats.unit_count + (frame_stats.unit_total > frame_stats.unit_count ? 1 : 0);
+    y = FRAME_STATS_OVERLAY_HEIGHT + 4;
+    if (units > 0) {
+        DrawRectangle(x - 4, FRAME_STATS_OVERLAY_HEIGHT, FRAME_STATS_OVERLAY_WIDTH + 8, units * 12 + 6, Fade(BLACK, 0.8f));
+    }
+    for (int i = 0; i < frame_stats.unit_count; i++, y += 12) {
+        const FrameStatsUnit* unit = &frame_stats.units[i];
+        DrawText(TextFormat("-%s %s", unit->level, unit->name), x, y, 10,
+                 strcmp(unit->level, "O0") == 0 ? ORANGE : LIGHTGRAY);
+    }
+    if (frame_stats.unit_total > frame_stats.unit_count) {
+        DrawText(TextFormat("+%d more", frame_stats.unit_total - frame_stats.unit_count), x, y, 10, GRAY);
+    }
+}
+
+static void frame_stats_draw_error(void) {
+    int height = 24;
+    int y = GetScreenHeight() - height;
+    DrawRectangle(0, y, GetScreenWidth(), height, Fade(MAROON, 0.9f));
+    DrawText(frame_stats.error, 8, y + 7, 10, RAYWHITE);
+}
+
+static void frame_stats_begin_drawing(void) {
+    frame_stats.draw_start = GetTime();
+    frame_stats.current.update_ms = (float)((frame_stats.draw_start - frame_stats.frame_start) * 1000.0);
+    frame_stats.target->begin_drawing();
+}
+
+static void frame_stats_end_drawing(void) {
+    double draw_end = GetTime();
+    frame_stats.current.draw_ms = (float)((draw_end - frame_stats.draw_start) * 1000.0);
+
+    if (frame_stats.overlay) {
+        frame_stats_draw_overlay();
+    }
+    if (draw_end < frame_stats.error_until) {
+        frame_stats_draw_error();
+    }
+
+    double present_start = GetTime();
+    frame_stats.target->end_drawing();
+    frame_stats.current.present_ms = (float)((GetTime() - present_start) * 1000.0);
+}
+
+// Returns a table forwarding everything to target, except the drawing calls
+// it times. Calling it again only swaps the target, the table pointer the
+// game holds stays the same.
+RaylibAPI* frame_stats_wrap(RaylibAPI* target) {
+    frame_stats.target = target;
+    frame_stats.api = *target;
+    frame_stats.api.begin_drawing = frame_stats_begin_drawing;
+    frame_stats.api.end_drawing = frame_stats_end_drawing;
+    return &frame_stats.api;
+}
+
+// Called at the top of the host loop, closes the previous frame
+void frame_stats_frame_begin(void) {
+    double now = GetTime();
+
+    if (frame_stats.frame_start > 0.0 && !(frame_stats.current.marks & FRAME_MARK_IDLE)) {
+        frame_stats.current.frame_ms = (float)((now - frame_stats.frame_start) * 1000.0);
+        frame_stats_push(&frame_stats.current);
+    }
+
+    memset(&frame_stats.current, 0, sizeof(frame_stats.current));
+    frame_stats.frame_start = now;
+}
+
+void frame_stats_mark(int mark, double seconds) {
+    frame_stats.current.marks |= mark;
+    frame_stats.current.host_ms += (float)(seconds * 1000.0);
+}
+
+// Reads the "<level> <unit>" lines written by build_hot_reload.sh next to the
+// game library. Without the file, no levels are shown.
+void frame_stats_load_opt_levels(const char* path) {
+    frame_stats.unit_count = 0;
+    frame_stats.unit_total = 0;
+
+    FILE* file = fopen(path, "r");
+    if (!file) return;
+
+    char level[8];
+    char name[256];
+    while (fscanf(file, "%7s %255s", level, name) == 2) {
+        if (frame_stats.unit_count < FRAME_STATS_MAX_UNITS) {
+            FrameStatsUnit* unit = &frame_stats.units[frame_stats.unit_count++];
+            snprintf(unit->level, sizeof(unit->level), "%s", level);
+            snprintf(unit->name, sizeof(unit->name), "%.*s", (int)sizeof(unit->name) - 1, name);
+        }
+        frame_stats.unit_total++;
+    }
+    fclose(file);
+}
+
+void frame_stats_report_error(const char* message) {
+    snprintf(frame_stats.error, sizeof(frame_stats.error), "%s", message);
+    frame_stats.error_until = GetTime() + FRAME_STATS_ERROR_SECONDS;
+}
+
+void frame_stats_toggle_overlay(void) {
+    frame_stats.overlay = !frame_stats.overlay;
+}
+
+bool frame_stats_write_csv(const char* path) {
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        printf("[FRAME_STATS] Failed to open %s\n", path);
+        return false;
+    }
+
+    fprintf(file, "frame,frame_ms,update_ms,draw_ms,present_ms,host_ms,watcher,rebuild,swap,rollback\n");
+
+    unsigned long long count = frame_stats.frame_count < FRAME_STATS_HISTORY ? frame_stats.frame_count : FRAME_STATS_HISTORY;
+    for (unsigned long long age = count; age > 0; age--) {
+        const FrameStatsFrame* frame = frame_stats_frame(age - 1);
+        fprintf(file, "%llu,%.3f,%.3f,%.3f,%.3f,%.3f,%d,%d,%d,%d\n",
+                frame_stats.frame_count - age,
+                frame->frame_ms, frame->update_ms, frame->draw_ms, frame->present_ms, frame->host_ms,
+                (frame->marks & FRAME_MARK_WATCHER) != 0,
+                (frame->marks & FRAME_MARK_REBUILD) != 0,
+                (frame->marks & FRAME_MARK_SWAP) != 0,
+                (frame->marks & FRAME_MARK_ROLLBACK) != 0);
+    }
+
+    fclose(file);
+    printf("[FRAME_STATS] Wrote %llu frames to %s\n", count, path);
+    return true;
+}
@@ -0,0 +1,46 @@
+#ifndef HOT_RELOAD_FRAME_STATS_H
+#define HOT_RELOAD_FRAME_STATS_H
+
+#include <stdbool.h>
+#include "raylib_api.gen.h"
+
+// Frame timing collected by the host.
+//
+// The game's BeginDrawing/EndDrawing go through frame_stats_wrap(), which
+// splits every frame into update (frame start to BeginDrawing), draw
+// (BeginDrawing to EndDrawing) and present (EndDrawing itself, including the
+// target FPS wait). Host work is reported with frame_stats_mark(), so hitches
+// can be told apart: reloads, rebuilds and watcher scans, or the game itself.
+#define FRAME_STATS_HISTORY 4096
+#define FRAME_STATS_WINDOW 600
+#define FRAME_STATS_BUCKET_MS 0.1
+#define FRAME_STATS_BUCKETS 1000
+
+typedef enum {
+    FRAME_MARK_WATCHER = 1 << 0,
+    FRAME_MARK_REBUILD = 1 << 1,
+    FRAME_MARK_SWAP = 1 << 2,
+    FRAME_MARK_ROLLBACK = 1 << 3,
+    // Throttled while the window is in the background, not recorded
+    FRAME_MARK_IDLE = 1 << 4,
+} FrameMark;
+
+typedef struct {
+    float frame_ms;
+    float update_ms;
+    float draw_ms;
+    float present_ms;
+    float host_ms;
+    int marks;
+} FrameStatsFrame;
+
+RaylibAPI* frame_stats_wrap(RaylibAPI* target);
+void frame_stats_frame_begin(void);
+void frame_stats_mark(int mark, double seconds);
+void frame_stats_load_opt_levels(const char* path);
+void frame_stats_toggle_overlay(void);
+// Shown at the bottom of the screen for a few seconds, overlay or not
+void frame_stats_report_error(const char* message);
+bool frame_stats_write_csv(const char* path);
+
+#endif // HOT_RELOAD_FRAME_STATS_H
@@ -0,0 +1,18 @@
+#ifndef HOT_RELOAD_GAME_PCH_H
+#define HOT_RELOAD_GAME_PCH_H
+
+// Precompiled header of the game library in hot reload builds
+// (HOT_RELOAD_PCH=1 with build_hot_reload.sh, GAME_PCH with CMake).
+//
+// Only the headers that rarely change: the C library, raylib and the raylib
+// and host API tables. game.h includes the same ones, which then cost nothing
+// since their include guards are already defined. Must be compiled with the
+// same flags as the game sources, HOT_RELOAD included.
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "hot_reload/raylib_api.gen.h"
+#include "runtime/host_api.h"
+
+#endif // HOT_RELOAD_GAME_PCH_H
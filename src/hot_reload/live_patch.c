@@ -0,0 +1,415 @@
+#define _GNU_SOURCE
+
+#include "live_patch.h"
+#include "elf_symbols.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__linux__) && (defined(__x86_64__) || defined(__aarch64__))
+    #define LIVE_PATCH_SUPPORTED
+    #include <dlfcn.h>
+    #include <link.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+// Old game library versions and patch libraries, both capped at 32 by the
+// host, and the versions of the game modules
+#define LIVE_PATCH_MAX_LIBRARIES 160
+#define LIVE_PATCH_GROUP_LENGTH 64
+#define LIVE_PATCH_MAX_JUMP 16
+#define LIVE_PATCH_REPORT_NAMES 8
+
+typedef struct {
+    // Versions of the same library share a group, and are only compared
+    // with and patched into each other
+    char group[LIVE_PATCH_GROUP_LENGTH];
+    char path[256];
+    uintptr_t base;
+    ElfSymbolTable symbols;
+    const ElfSymbol** by_name;
+} LivePatchLibrary;
+
+typedef struct {
+    uintptr_t at;
+    uintptr_t to;
+    // What the jump overwrote, to revert it
+    uint8_t original[LIVE_PATCH_MAX_JUMP];
+    int size;
+} LivePatchJump;
+
+typedef struct {
+    int enabled;
+    LivePatchLibrary libraries[LIVE_PATCH_MAX_LIBRARIES];
+    int library_count;
+
+    // Jumps of the last live_patch_apply(), into last_path
+    LivePatchJump* last_jumps;
+    int last_jump_count;
+    char last_path[256];
+} LivePatch;
+
+static LivePatch live_patch = { .enabled = -1 };
+
+bool live_patch_enabled(void) {
+    if (live_patch.enabled < 0) {
+        const char* value = getenv("HOT_RELOAD_LIVE_PATCH");
+        live_patch.enabled = value && strcmp(value, "1") == 0;
+#ifndef LIVE_PATCH_SUPPORTED
+        if (live_patch.enabled) {
+            printf("[LIVE_PATCH] Only supported on Linux x86-64 and arm64, reloads swap the whole library\n");
+            live_patch.enabled = 0;
+        }
+#endif
+    }
+    return live_patch.enabled;
+}
+
+#ifdef LIVE_PATCH_SUPPORTED
+
+static int compare_symbol_names(const void* a, const void* b) {
+    const ElfSymbol* sa = *(const ElfSymbol* const*)a;
+    const ElfSymbol* sb = *(const ElfSymbol* const*)b;
+    int order = strcmp(sa->name, sb->name);
+    if (order != 0) return order;
+    if (sa->address != sb->address) return sa->address < sb->address ? -1 : 1;
+    return 0;
+}
+
+// Index of the first symbol named name[0..length) in by_name, and how many
+// there are (static functions of different files can share a name)
+static int find_symbols(const LivePatchLibrary* library, const char* name, size_t length, int* count) {
+    int low = 0;
+    int high = library->symbols.count;
+    while (low < high) {
+        int middle = low + (high - low) / 2;
+        const char* other = library->by_name[middle]->name;
+        int order = strncmp(other, name, length);
+        if (order == 0 && other[length] != '\0') order = 1;
+        if (order < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    int end = low;
+    while (end < library->symbols.count) {
+        const char* other = library->by_name[end]->name;
+        if (strncmp(other, name, length) != 0 || other[length] != '\0') break;
+        end++;
+    }
+    *count = end - low;
+    return low;
+}
+
+static bool same_code(const LivePatchLibrary* a, const ElfSymbol* sa, const LivePatchLibrary* b, const ElfSymbol* sb) {
+    return sa->size == sb->size &&
+           memcmp((const void*)(a->base + sa->address), (const void*)(b->base + sb->address), sa->size) == 0;
+}
+
+// Compiler and C runtime functions, run by the loader for that version only
+static bool is_runtime_function(const char* name) {
+    static const char* names[] = {
+        "_init", "_fini", "_start", "frame_dummy", "register_tm_clones",
+        "deregister_tm_clones", "__do_global_dtors_aux",
+    };
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        if (strcmp(name, names[i]) == 0) return true;
+    }
+    return false;
+}
+
+// Bytes a jump can overwrite: the function, plus the alignment padding up to
+// the next one
+static uint64_t patch_room(const LivePatchLibrary* library, const ElfSymbol* symbol) {
+    const ElfSymbol* end = library->symbols.symbols + library->symbols.count;
+    const ElfSymbol* next = symbol + 1;
+    while (next < end && next->address == symbol->address) next++;
+
+    uint64_t room = symbol->size;
+    if (next < end) {
+        uint64_t gap = next->address - symbol->address;
+        uint64_t aligned = (symbol->size + 15) & ~(uint64_t)15;
+        if (gap > room && gap <= aligned) room = gap;
+    }
+    return room;
+}
+
+// A near jump when the target is in range, an absolute one otherwise. Neither
+// touches a register the called function could be reading its arguments from.
+static int encode_jump(uint8_t* code, uintptr_t from, uintptr_t to) {
+#if defined(__x86_64__)
+    int64_t offset = (int64_t)to - (int64_t)(from + 5);
+    if (offset >= INT32_MIN && offset <= INT32_MAX) {
+        int32_t rel = (int32_t)offset;
+        code[0] = 0xe9;                                  // jmp rel32
+        memcpy(code + 1, &rel, 4);
+        return 5;
+    }
+    code[0] = 0xff; code[1] = 0x25;                      // jmp [rip + 0]
+    memset(code + 2, 0, 4);
+    uint64_t target = to;
+    memcpy(code + 6, &target, 8);
+    return 14;
+#else
+    int64_t offset = (int64_t)to - (int64_t)from;
+    if (offset >= -(1LL << 27) && offset < (1LL << 27)) {
+        uint32_t branch = 0x14000000u | (uint32_t)((offset >> 2) & 0x03ffffff); // b
+        memcpy(code, &branch, 4);
+        return 4;
+    }
+    uint32_t load = 0x58000050u;                         // ldr x16, #8
+    uint32_t branch = 0xd61f0200u;                       // br x16
+    uint64_t target = to;
+    memcpy(code, &load, 4);
+    memcpy(code + 4, &branch, 4);
+    memcpy(code + 8, &target, 8);
+    return 16;
+#endif
+}
+
+static bool write_code(uintptr_t at, const uint8_t* code, int size) {
+    uintptr_t page_size = (uintptr_t)sysconf(_SC_PAGESIZE);
+    uintptr_t start = at & ~(page_size - 1);
+    size_t length = (size_t)(((at + (uintptr_t)size + page_size - 1) & ~(page_size - 1)) - start);
+
+    if (mprotect((void*)start, length, PROT_READ | PROT_WRITE | PROT_EXEC) != 0) {
+        printf("[LIVE_PATCH] Can't make the code at %p writable\n", (void*)at);
+        return false;
+    }
+    memcpy((void*)at, code, (size_t)size);
+    mprotect((void*)start, length, PROT_READ | PROT_EXEC);
+    __builtin___clear_cache((char*)at, (char*)at + size);
+    return true;
+}
+
+static bool write_jump(LivePatchJump* jump) {
+    uint8_t code[LIVE_PATCH_MAX_JUMP];
+    jump->size = encode_jump(code, jump->at, jump->to);
+    memcpy(jump->original, (const void*)jump->at, (size_t)jump->size);
+    return write_code(jump->at, code, jump->size);
+}
+
+void live_patch_add_library(const char* group, const char* path, void* lib) {
+    if (!live_patch_enabled() || !lib) return;
+    if (live_patch.library_count >= LIVE_PATCH_MAX_LIBRARIES) {
+        printf("[LIVE_PATCH] Too many library versions, %s won't be patched\n", path);
+        return;
+    }
+
+    struct link_map* map = NULL;
+    if (dlinfo(lib, RTLD_DI_LINKMAP, &map) != 0 || !map) {
+        printf("[LIVE_PATCH] %s is not mapped\n", path);
+        return;
+    }
+
+    LivePatchLibrary* library = &live_patch.libraries[live_patch.library_count];
+    memset(library, 0, sizeof(*library));
+    snprintf(library->group, sizeof(library->group), "%s", group);
+    snprintf(library->path, sizeof(library->path), "%s", path);
+    library->base = (uintptr_t)map->l_addr;
+
+    if (!elf_symbols_load(path, &library->symbols)) return;
+    library->by_name = malloc((size_t)(library->symbols.count > 0 ? library->symbols.count : 1) * sizeof(ElfSymbol*));
+    if (!library->by_name) {
+        elf_symbols_free(&library->symbols);
+        return;
+    }
+    for (int i = 0; i < library->symbols.count; i++) {
+        library->by_name[i] = &library->symbols.symbols[i];
+    }
+    qsort(library->by_name, (size_t)library->symbols.count, sizeof(ElfSymbol*), compare_symbol_names);
+
+    live_patch.library_count++;
+}
+
+// The last patch can't be reverted anymore, some of its jumps may have been
+// in that library
+void live_patch_remove_library(const char* path) {
+    free(live_patch.last_jumps);
+    live_patch.last_jumps = NULL;
+    live_patch.last_jump_count = 0;
+    live_patch.last_path[0] = '\0';
+
+    for (int i = 0; i < live_patch.library_count; i++) {
+        LivePatchLibrary* library = &live_patch.libraries[i];
+        if (strcmp(library->path, path) != 0) continue;
+
+        elf_symbols_free(&library->symbols);
+        free(library->by_name);
+        memmove(library, library + 1, (size_t)(live_patch.library_count - i - 1) * sizeof(LivePatchLibrary));
+        live_patch.library_count--;
+        return;
+    }
+}
+
+// Marks in `changed` (indexed like newest->by_name) the functions to redirect.
+// A compiler-made part (foo.part.0, foo.cold...) is only ever entered from its
+// function, so when one changes, its function is redirected instead.
+static bool find_changed_functions(const LivePatchLibrary* newest, const LivePatchLibrary* previous, bool* changed) {
+    int i = 0;
+    while (i < newest->symbols.count) {
+        const char* name = newest->by_name[i]->name;
+        int new_count = 1;
+        while (i + new_count < newest->symbols.count && strcmp(newest->by_name[i + new_count]->name, name) == 0) {
+            new_count++;
+        }
+
+        int old_count = 0;
+        int old_first = find_symbols(previous, name, strlen(name), &old_count);
+
+        bool same = old_count == new_count;
+        for (int k = 0; same && k < new_count; k++) {
+            same = same_code(newest, newest->by_name[i + k], previous, previous->by_name[old_first + k]);
+        }
+
+        // Functions that didn't exist before are only called by new code
+        if (old_count > 0 && !same && !is_runtime_function(name)) {
+            const char* dot = strchr(name, '.');
+            int target = i;
+            int target_count = new_count;
+            if (dot) {
+                target = find_symbols(newest, name, (size_t)(dot - name), &target_count);
+            }
+            if (target_count != 1) {
+                printf("[LIVE_PATCH] Can't patch %.*s: %s\n", dot ? (int)(dot - name) : (int)strlen(name), name,
+                       target_count == 0 ? "no such function" : "several static functions have that name");
+                return false;
+            }
+            changed[target] = true;
+        }
+        i += new_count;
+    }
+    return true;
+}
+
+int live_patch_apply(const char* path) {
+    if (live_patch.library_count < 2) return -1;
+
+    const LivePatchLibrary* newest = &live_patch.libraries[live_patch.library_count - 1];
+    if (strcmp(newest->path, path) != 0) return -1;
+
+    // Older versions of the same library, the last of them is the one compared with
+    const LivePatchLibrary* previous = NULL;
+    int older_count = 0;
+    for (int l = 0; l < live_patch.library_count - 1; l++) {
+        if (strcmp(live_patch.libraries[l].group, newest->group) != 0) continue;
+        previous = &live_patch.libraries[l];
+        older_count++;
+    }
+    if (!previous) return -1;
+
+    bool* changed = calloc((size_t)(newest->symbols.count > 0 ? newest->symbols.count : 1), sizeof(bool));
+    LivePatchJump* jumps = malloc((size_t)(newest->symbols.count > 0 ? newest->symbols.count : 1) * (size_t)older_count * sizeof(LivePatchJump));
+    if (!changed || !jumps) {
+        free(changed);
+        free(jumps);
+        return -1;
+    }
+
+    if (!find_changed_functions(newest, previous, changed)) {
+        free(changed);
+        free(jumps);
+        return -1;
+    }
+
+    // Every jump is checked before the first one is written
+    int jump_count = 0;
+    int function_count = 0;
+    for (int i = 0; i < newest->symbols.count; i++) {
+        if (!changed[i]) continue;
+        const ElfSymbol* symbol = newest->by_name[i];
+        uintptr_t to = newest->base + symbol->address;
+        function_count++;
+
+        for (int l = 0; l < live_patch.library_count - 1; l++) {
+            const LivePatchLibrary* library = &live_patch.libraries[l];
+            if (strcmp(library->group, newest->group) != 0) continue;
+            int count = 0;
+            int first = find_symbols(library, symbol->name, strlen(symbol->name), &count);
+            if (count == 0) continue;
+
+            uint8_t code[LIVE_PATCH_MAX_JUMP];
+            const ElfSymbol* old = library->by_name[first];
+            uintptr_t at = library->base + old->address;
+            if (count > 1 || (uint64_t)encode_jump(code, at, to) > patch_room(library, old)) {
+                printf("[LIVE_PATCH] Can't patch %s in %s: %s\n", symbol->name, library->path,
+                       count > 1 ? "several static functions have that name" : "too small for a jump");
+                free(changed);
+                free(jumps);
+                return -1;
+            }
+            jumps[jump_count++] = (LivePatchJump){ .at = at, .to = to };
+        }
+    }
+
+    // Whatever was written stays, the new version is set up either way
+    free(live_patch.last_jumps);
+    live_patch.last_jumps = jumps;
+    live_patch.last_jump_count = 0;
+    snprintf(live_patch.last_path, sizeof(live_patch.last_path), "%s", path);
+    for (int i = 0; i < jump_count; i++) {
+        if (!write_jump(&jumps[i])) {
+            free(changed);
+            return -1;
+        }
+        live_patch.last_jump_count++;
+    }
+
+    printf("[LIVE_PATCH] %d functions changed, %d entry points patched:", function_count, jump_count);
+    int listed = 0;
+    for (int i = 0; i < newest->symbols.count && listed < LIVE_PATCH_REPORT_NAMES; i++) {
+        if (!changed[i]) continue;
+        printf("%s %s", listed ? "," : "", newest->by_name[i]->name);
+        listed++;
+    }
+    printf("%s\n", function_count > listed ? ", ..." : "");
+
+    free(changed);
+    return function_count;
+}
+
+// Last written first, so an entry point patched twice gets its original code back
+bool live_patch_revert(const char* path) {
+    if (strcmp(live_patch.last_path, path) != 0) return false;
+
+    bool reverted = true;
+    for (int i = live_patch.last_jump_count - 1; i >= 0; i--) {
+        const LivePatchJump* jump = &live_patch.last_jumps[i];
+        reverted = write_code(jump->at, jump->original, jump->size) && reverted;
+    }
+    printf("[LIVE_PATCH] Reverted %d entry points patched into %s\n", live_patch.last_jump_count, path);
+
+    free(live_patch.last_jumps);
+    live_patch.last_jumps = NULL;
+    live_patch.last_jump_count = 0;
+    live_patch.last_path[0] = '\0';
+    return reverted;
+}
+
+#else
+
+void live_patch_add_library(const char* group, const char* path, void* lib) {
+    (void)group;
+    (void)path;
+    (void)lib;
+}
+
+void live_patch_remove_library(const char* path) {
+    (void)path;
+}
+
+int live_patch_apply(const char* path) {
+    (void)path;
+    return -1;
+}
+
+bool live_patch_revert(const char* path) {
+    (void)path;
+    return false;
+}
+
+#endif
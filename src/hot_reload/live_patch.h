@@ -0,0 +1,42 @@
+#ifndef HOT_RELOAD_LIVE_PATCH_H
+#define HOT_RELOAD_LIVE_PATCH_H
+
+#include <stdbool.h>
+
+// Function-level live patching (Linux x86-64 and arm64 only).
+//
+// A regular reload swaps the whole game library, and every function pointer
+// kept in game memory still points into the old version. With
+// HOT_RELOAD_LIVE_PATCH=1 the host keeps calling the library it started with
+// instead: the new version is loaded next to it, its functions are compared
+// with the previous version's, and the entry point of every changed function,
+// in every loaded version, is overwritten with a jump to the new code. Stored
+// function pointers keep working and run the edited code, and the cost of a
+// reload follows the number of changed functions.
+//
+// Functions are compared by name and machine code. Code that moved without
+// changing (rip-relative addresses) counts as changed, which is harmless. A
+// function whose code didn't change but reads a static variable that moved
+// keeps reading the old version's copy, so game state should stay in game
+// memory, as it already has to for regular reloads.
+bool live_patch_enabled(void);
+
+// Called right after a game library is loaded and right before it's
+// unloaded, like sampling_profiler_add_module(). Versions of one library
+// (the game, a game module) share a group, and are only patched into each
+// other.
+void live_patch_add_library(const char* group, const char* path, void* lib);
+void live_patch_remove_library(const char* path);
+
+// Redirects the functions of the older libraries that differ in the library
+// at path, which has to be the last one added, in the older versions of its
+// group. Returns the number of
+// functions patched, or -1 if some changed function can't be patched, in
+// which case the host swaps the whole library.
+int live_patch_apply(const char* path);
+
+// Puts back the code the last live_patch_apply(path) overwrote, when that
+// version turned out to crash
+bool live_patch_revert(const char* path);
+
+#endif // HOT_RELOAD_LIVE_PATCH_H
@@ -1,6 +1,7 @@
 #include "platform_tools.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #ifdef _WIN32
     #include <windows.h>
@@ -74,14 +75,51 @@ bool platform_delete_file(const char* path) {
 #endif
 }
 
+// Same as `mkdir -p`, without spawning a shell
 void platform_create_directory(const char* path) {
+    char partial[512];
+    size_t length = strlen(path);
+    if (length >= sizeof(partial)) return;
+
+    // Every prefix ending at a separator, then the whole path. Existing
+    // directories just fail to be created.
+    for (size_t i = 1; i <= length; i++) {
+        if (path[i] != '/' && path[i] != '\\' && path[i] != '\0') continue;
+        memcpy(partial, path, i);
+        partial[i] = '\0';
 #ifdef _WIN32
-    char cmd[512];
-    snprintf(cmd, sizeof(cmd), "if not exist \"%s\" mkdir \"%s\"", path, path);
-    system(cmd);
+        CreateDirectoryA(partial, NULL);
 #else
-    char cmd[512];
-    snprintf(cmd, sizeof(cmd), "mkdir -p \"%s\"", path);
-    system(cmd);
+        mkdir(partial, 0755);
+#endif
+    }
+}
+
+bool platform_copy_file(const char* from, const char* to) {
+#ifdef _WIN32
+    return CopyFileA(from, to, FALSE) != 0;
+#else
+    FILE* in = fopen(from, "rb");
+    if (!in) return false;
+    FILE* out = fopen(to, "wb");
+    if (!out) {
+        fclose(in);
+        return false;
+    }
+
+    char buffer[64 * 1024];
+    bool copied = true;
+    size_t read;
+    while ((read = fread(buffer, 1, sizeof(buffer), in)) > 0) {
+        if (fwrite(buffer, 1, read, out) != read) {
+            copied = false;
+            break;
+        }
+    }
+    if (ferror(in)) copied = false;
+
+    fclose(in);
+    if (fclose(out) != 0) copied = false;
+    return copied;
 #endif
 }
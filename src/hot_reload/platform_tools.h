@@ -15,5 +15,6 @@ void platform_free_library(dll_handle_t handle);
 time_t platform_get_modification_time(const char* path);
 bool platform_delete_file(const char* path);
 void platform_create_directory(const char* path);
+bool platform_copy_file(const char* from, const char* to);
 
 #endif // HOT_RELOAD_PLATFORM_TOOLS_H
\ No newline at end of file
@@ -0,0 +1,1465 @@
+#ifndef RAYLIB_API_CALLS_GEN_H
+#define RAYLIB_API_CALLS_GEN_H
+
+// DO NOT EDIT THIS FILE, CHANGES WILL BE LOST
+// Auto-generated by generate_raylib_api.py from raylib.h
+// Timestamp: 2026-10-19 10:29:30
+//
+// One id per RaylibAPI entry, in table order, and the matching raylib names.
+
+enum {
+    RL_CALL_INIT_WINDOW,
+    RL_CALL_CLOSE_WINDOW,
+    RL_CALL_WINDOW_SHOULD_CLOSE,
+    RL_CALL_IS_WINDOW_READY,
+    RL_CALL_IS_WINDOW_FULLSCREEN,
+    RL_CALL_IS_WINDOW_HIDDEN,
+    RL_CALL_IS_WINDOW_MINIMIZED,
+    RL_CALL_IS_WINDOW_MAXIMIZED,
+    RL_CALL_IS_WINDOW_FOCUSED,
+    RL_CALL_IS_WINDOW_RESIZED,
+    RL_CALL_IS_WINDOW_STATE,
+    RL_CALL_SET_WINDOW_STATE,
+    RL_CALL_CLEAR_WINDOW_STATE,
+    RL_CALL_TOGGLE_FULLSCREEN,
+    RL_CALL_TOGGLE_BORDERLESS_WINDOWED,
+    RL_CALL_MAXIMIZE_WINDOW,
+    RL_CALL_MINIMIZE_WINDOW,
+    RL_CALL_RESTORE_WINDOW,
+    RL_CALL_SET_WINDOW_ICON,
+    RL_CALL_SET_WINDOW_ICONS,
+    RL_CALL_SET_WINDOW_TITLE,
+    RL_CALL_SET_WINDOW_POSITION,
+    RL_CALL_SET_WINDOW_MONITOR,
+    RL_CALL_SET_WINDOW_MIN_SIZE,
+    RL_CALL_SET_WINDOW_MAX_SIZE,
+    RL_CALL_SET_WINDOW_SIZE,
+    RL_CALL_SET_WINDOW_OPACITY,
+    RL_CALL_SET_WINDOW_FOCUSED,
+    RL_CALL_GET_WINDOW_HANDLE,
+    RL_CALL_GET_SCREEN_WIDTH,
+    RL_CALL_GET_SCREEN_HEIGHT,
+    RL_CALL_GET_RENDER_WIDTH,
+    RL_CALL_GET_RENDER_HEIGHT,
+    RL_CALL_GET_MONITOR_COUNT,
+    RL_CALL_GET_CURRENT_MONITOR,
+    RL_CALL_GET_MONITOR_POSITION,
+    RL_CALL_GET_MONITOR_WIDTH,
+    RL_CALL_GET_MONITOR_HEIGHT,
+    RL_CALL_GET_MONITOR_PHYSICAL_WIDTH,
+    RL_CALL_GET_MONITOR_PHYSICAL_HEIGHT,
+    RL_CALL_GET_MONITOR_REFRESH_RATE,
+    RL_CALL_GET_WINDOW_POSITION,
+    RL_CALL_GET_WINDOW_SCALE_DPI,
+    RL_CALL_GET_MONITOR_NAME,
+    RL_CALL_SET_CLIPBOARD_TEXT,
+    RL_CALL_GET_CLIPBOARD_TEXT,
+    RL_CALL_GET_CLIPBOARD_IMAGE,
+    RL_CALL_ENABLE_EVENT_WAITING,
+    RL_CALL_DISABLE_EVENT_WAITING,
+    RL_CALL_SHOW_CURSOR,
+    RL_CALL_HIDE_CURSOR,
+    RL_CALL_IS_CURSOR_HIDDEN,
+    RL_CALL_ENABLE_CURSOR,
+    RL_CALL_DISABLE_CURSOR,
+    RL_CALL_IS_CURSOR_ON_SCREEN,
+    RL_CALL_CLEAR_BACKGROUND,
+    RL_CALL_BEGIN_DRAWING,
+    RL_CALL_END_DRAWING,
+    RL_CALL_BEGIN_MODE2_D,
+    RL_CALL_END_MODE2_D,
+    RL_CALL_BEGIN_MODE3_D,
+    RL_CALL_END_MODE3_D,
+    RL_CALL_BEGIN_TEXTURE_MODE,
+    RL_CALL_END_TEXTURE_MODE,
+    RL_CALL_BEGIN_SHADER_MODE,
+    RL_CALL_END_SHADER_MODE,
+    RL_CALL_BEGIN_BLEND_MODE,
+    RL_CALL_END_BLEND_MODE,
+    RL_CALL_BEGIN_SCISSOR_MODE,
+    RL_CALL_END_SCISSOR_MODE,
+    RL_CALL_BEGIN_VR_STEREO_MODE,
+    RL_CALL_END_VR_STEREO_MODE,
+    RL_CALL_LOAD_VR_STEREO_CONFIG,
+    RL_CALL_UNLOAD_VR_STEREO_CONFIG,
+    RL_CALL_LOAD_SHADER,
+    RL_CALL_LOAD_SHADER_FROM_MEMORY,
+    RL_CALL_IS_SHADER_VALID,
+    RL_CALL_GET_SHADER_LOCATION,
+    RL_CALL_GET_SHADER_LOCATION_ATTRIB,
+    RL_CALL_SET_SHADER_VALUE,
+    RL_CALL_SET_SHADER_VALUE_V,
+    RL_CALL_SET_SHADER_VALUE_MATRIX,
+    RL_CALL_SET_SHADER_VALUE_TEXTURE,
+    RL_CALL_UNLOAD_SHADER,
+    RL_CALL_GET_SCREEN_TO_WORLD_RAY,
+    RL_CALL_GET_SCREEN_TO_WORLD_RAY_EX,
+    RL_CALL_GET_WORLD_TO_SCREEN,
+    RL_CALL_GET_WORLD_TO_SCREEN_EX,
+    RL_CALL_GET_WORLD_TO_SCREEN2_D,
+    RL_CALL_GET_SCREEN_TO_WORLD2_D,
+    RL_CALL_GET_CAMERA_MATRIX,
+    RL_CALL_GET_CAMERA_MATRIX2_D,
+    RL_CALL_SET_TARGET_FPS,
+    RL_CALL_GET_FRAME_TIME,
+    RL_CALL_GET_TIME,
+    RL_CALL_GET_FPS,
+    RL_CALL_SWAP_SCREEN_BUFFER,
+    RL_CALL_POLL_INPUT_EVENTS,
+    RL_CALL_WAIT_TIME,
+    RL_CALL_SET_RANDOM_SEED,
+    RL_CALL_GET_RANDOM_VALUE,
+    RL_CALL_LOAD_RANDOM_SEQUENCE,
+    RL_CALL_UNLOAD_RANDOM_SEQUENCE,
+    RL_CALL_TAKE_SCREENSHOT,
+    RL_CALL_SET_CONFIG_FLAGS,
+    RL_CALL_OPEN_URL,
+    RL_CALL_TRACE_LOG,
+    RL_CALL_SET_TRACE_LOG_LEVEL,
+    RL_CALL_MEM_ALLOC,
+    RL_CALL_MEM_REALLOC,
+    RL_CALL_MEM_FREE,
+    RL_CALL_SET_TRACE_LOG_CALLBACK,
+    RL_CALL_SET_LOAD_FILE_DATA_CALLBACK,
+    RL_CALL_SET_SAVE_FILE_DATA_CALLBACK,
+    RL_CALL_SET_LOAD_FILE_TEXT_CALLBACK,
+    RL_CALL_SET_SAVE_FILE_TEXT_CALLBACK,
+    RL_CALL_LOAD_FILE_DATA,
+    RL_CALL_UNLOAD_FILE_DATA,
+    RL_CALL_SAVE_FILE_DATA,
+    RL_CALL_EXPORT_DATA_AS_CODE,
+    RL_CALL_LOAD_FILE_TEXT,
+    RL_CALL_UNLOAD_FILE_TEXT,
+    RL_CALL_SAVE_FILE_TEXT,
+    RL_CALL_FILE_EXISTS,
+    RL_CALL_DIRECTORY_EXISTS,
+    RL_CALL_IS_FILE_EXTENSION,
+    RL_CALL_GET_FILE_LENGTH,
+    RL_CALL_GET_FILE_EXTENSION,
+    RL_CALL_GET_FILE_NAME,
+    RL_CALL_GET_FILE_NAME_WITHOUT_EXT,
+    RL_CALL_GET_DIRECTORY_PATH,
+    RL_CALL_GET_PREV_DIRECTORY_PATH,
+    RL_CALL_GET_WORKING_DIRECTORY,
+    RL_CALL_GET_APPLICATION_DIRECTORY,
+    RL_CALL_MAKE_DIRECTORY,
+    RL_CALL_CHANGE_DIRECTORY,
+    RL_CALL_IS_PATH_FILE,
+    RL_CALL_IS_FILE_NAME_VALID,
+    RL_CALL_LOAD_DIRECTORY_FILES,
+    RL_CALL_LOAD_DIRECTORY_FILES_EX,
+    RL_CALL_UNLOAD_DIRECTORY_FILES,
+    RL_CALL_IS_FILE_DROPPED,
+    RL_CALL_LOAD_DROPPED_FILES,
+    RL_CALL_UNLOAD_DROPPED_FILES,
+    RL_CALL_GET_FILE_MOD_TIME,
+    RL_CALL_COMPRESS_DATA,
+    RL_CALL_DECOMPRESS_DATA,
+    RL_CALL_ENCODE_DATA_BASE64,
+    RL_CALL_DECODE_DATA_BASE64,
+    RL_CALL_COMPUTE_CRC32,
+    RL_CALL_COMPUTE_MD5,
+    RL_CALL_COMPUTE_SHA1,
+    RL_CALL_LOAD_AUTOMATION_EVENT_LIST,
+    RL_CALL_UNLOAD_AUTOMATION_EVENT_LIST,
+    RL_CALL_EXPORT_AUTOMATION_EVENT_LIST,
+    RL_CALL_SET_AUTOMATION_EVENT_LIST,
+    RL_CALL_SET_AUTOMATION_EVENT_BASE_FRAME,
+    RL_CALL_START_AUTOMATION_EVENT_RECORDING,
+    RL_CALL_STOP_AUTOMATION_EVENT_RECORDING,
+    RL_CALL_PLAY_AUTOMATION_EVENT,
+    RL_CALL_IS_KEY_PRESSED,
+    RL_CALL_IS_KEY_PRESSED_REPEAT,
+    RL_CALL_IS_KEY_DOWN,
+    RL_CALL_IS_KEY_RELEASED,
+    RL_CALL_IS_KEY_UP,
+    RL_CALL_GET_KEY_PRESSED,
+    RL_CALL_GET_CHAR_PRESSED,
+    RL_CALL_SET_EXIT_KEY,
+    RL_CALL_IS_GAMEPAD_AVAILABLE,
+    RL_CALL_GET_GAMEPAD_NAME,
+    RL_CALL_IS_GAMEPAD_BUTTON_PRESSED,
+    RL_CALL_IS_GAMEPAD_BUTTON_DOWN,
+    RL_CALL_IS_GAMEPAD_BUTTON_RELEASED,
+    RL_CALL_IS_GAMEPAD_BUTTON_UP,
+    RL_CALL_GET_GAMEPAD_BUTTON_PRESSED,
+    RL_CALL_GET_GAMEPAD_AXIS_COUNT,
+    RL_CALL_GET_GAMEPAD_AXIS_MOVEMENT,
+    RL_CALL_SET_GAMEPAD_MAPPINGS,
+    RL_CALL_SET_GAMEPAD_VIBRATION,
+    RL_CALL_IS_MOUSE_BUTTON_PRESSED,
+    RL_CALL_IS_MOUSE_BUTTON_DOWN,
+    RL_CALL_IS_MOUSE_BUTTON_RELEASED,
+    RL_CALL_IS_MOUSE_BUTTON_UP,
+    RL_CALL_GET_MOUSE_X,
+    RL_CALL_GET_MOUSE_Y,
+    RL_CALL_GET_MOUSE_POSITION,
+    RL_CALL_GET_MOUSE_DELTA,
+    RL_CALL_SET_MOUSE_POSITION,
+    RL_CALL_SET_MOUSE_OFFSET,
+    RL_CALL_SET_MOUSE_SCALE,
+    RL_CALL_GET_MOUSE_WHEEL_MOVE,
+    RL_CALL_GET_MOUSE_WHEEL_MOVE_V,
+    RL_CALL_SET_MOUSE_CURSOR,
+    RL_CALL_GET_TOUCH_X,
+    RL_CALL_GET_TOUCH_Y,
+    RL_CALL_GET_TOUCH_POSITION,
+    RL_CALL_GET_TOUCH_POINT_ID,
+    RL_CALL_GET_TOUCH_POINT_COUNT,
+    RL_CALL_SET_GESTURES_ENABLED,
+    RL_CALL_IS_GESTURE_DETECTED,
+    RL_CALL_GET_GESTURE_DETECTED,
+    RL_CALL_GET_GESTURE_HOLD_DURATION,
+    RL_CALL_GET_GESTURE_DRAG_VECTOR,
+    RL_CALL_GET_GESTURE_DRAG_ANGLE,
+    RL_CALL_GET_GESTURE_PINCH_VECTOR,
+    RL_CALL_GET_GESTURE_PINCH_ANGLE,
+    RL_CALL_UPDATE_CAMERA,
+    RL_CALL_UPDATE_CAMERA_PRO,
+    RL_CALL_SET_SHAPES_TEXTURE,
+    RL_CALL_GET_SHAPES_TEXTURE,
+    RL_CALL_GET_SHAPES_TEXTURE_RECTANGLE,
+    RL_CALL_DRAW_PIXEL,
+    RL_CALL_DRAW_PIXEL_V,
+    RL_CALL_DRAW_LINE,
+    RL_CALL_DRAW_LINE_V,
+    RL_CALL_DRAW_LINE_EX,
+    RL_CALL_DRAW_LINE_STRIP,
+    RL_CALL_DRAW_LINE_BEZIER,
+    RL_CALL_DRAW_CIRCLE,
+    RL_CALL_DRAW_CIRCLE_SECTOR,
+    RL_CALL_DRAW_CIRCLE_SECTOR_LINES,
+    RL_CALL_DRAW_CIRCLE_GRADIENT,
+    RL_CALL_DRAW_CIRCLE_V,
+    RL_CALL_DRAW_CIRCLE_LINES,
+    RL_CALL_DRAW_CIRCLE_LINES_V,
+    RL_CALL_DRAW_ELLIPSE,
+    RL_CALL_DRAW_ELLIPSE_LINES,
+    RL_CALL_DRAW_RING,
+    RL_CALL_DRAW_RING_LINES,
+    RL_CALL_DRAW_RECTANGLE,
+    RL_CALL_DRAW_RECTANGLE_V,
+    RL_CALL_DRAW_RECTANGLE_REC,
+    RL_CALL_DRAW_RECTANGLE_PRO,
+    RL_CALL_DRAW_RECTANGLE_GRADIENT_V,
+    RL_CALL_DRAW_RECTANGLE_GRADIENT_H,
+    RL_CALL_DRAW_RECTANGLE_GRADIENT_EX,
+    RL_CALL_DRAW_RECTANGLE_LINES,
+    RL_CALL_DRAW_RECTANGLE_LINES_EX,
+    RL_CALL_DRAW_RECTANGLE_ROUNDED,
+    RL_CALL_DRAW_RECTANGLE_ROUNDED_LINES,
+    RL_CALL_DRAW_RECTANGLE_ROUNDED_LINES_EX,
+    RL_CALL_DRAW_TRIANGLE,
+    RL_CALL_DRAW_TRIANGLE_LINES,
+    RL_CALL_DRAW_TRIANGLE_FAN,
+    RL_CALL_DRAW_TRIANGLE_STRIP,
+    RL_CALL_DRAW_POLY,
+    RL_CALL_DRAW_POLY_LINES,
+    RL_CALL_DRAW_POLY_LINES_EX,
+    RL_CALL_DRAW_SPLINE_LINEAR,
+    RL_CALL_DRAW_SPLINE_BASIS,
+    RL_CALL_DRAW_SPLINE_CATMULL_ROM,
+    RL_CALL_DRAW_SPLINE_BEZIER_QUADRATIC,
+    RL_CALL_DRAW_SPLINE_BEZIER_CUBIC,
+    RL_CALL_DRAW_SPLINE_SEGMENT_LINEAR,
+    RL_CALL_DRAW_SPLINE_SEGMENT_BASIS,
+    RL_CALL_DRAW_SPLINE_SEGMENT_CATMULL_ROM,
+    RL_CALL_DRAW_SPLINE_SEGMENT_BEZIER_QUADRATIC,
+    RL_CALL_DRAW_SPLINE_SEGMENT_BEZIER_CUBIC,
+    RL_CALL_GET_SPLINE_POINT_LINEAR,
+    RL_CALL_GET_SPLINE_POINT_BASIS,
+    RL_CALL_GET_SPLINE_POINT_CATMULL_ROM,
+    RL_CALL_GET_SPLINE_POINT_BEZIER_QUAD,
+    RL_CALL_GET_SPLINE_POINT_BEZIER_CUBIC,
+    RL_CALL_CHECK_COLLISION_RECS,
+    RL_CALL_CHECK_COLLISION_CIRCLES,
+    RL_CALL_CHECK_COLLISION_CIRCLE_REC,
+    RL_CALL_CHECK_COLLISION_CIRCLE_LINE,
+    RL_CALL_CHECK_COLLISION_POINT_REC,
+    RL_CALL_CHECK_COLLISION_POINT_CIRCLE,
+    RL_CALL_CHECK_COLLISION_POINT_TRIANGLE,
+    RL_CALL_CHECK_COLLISION_POINT_LINE,
+    RL_CALL_CHECK_COLLISION_POINT_POLY,
+    RL_CALL_CHECK_COLLISION_LINES,
+    RL_CALL_GET_COLLISION_REC,
+    RL_CALL_LOAD_IMAGE,
+    RL_CALL_LOAD_IMAGE_RAW,
+    RL_CALL_LOAD_IMAGE_ANIM,
+    RL_CALL_LOAD_IMAGE_ANIM_FROM_MEMORY,
+    RL_CALL_LOAD_IMAGE_FROM_MEMORY,
+    RL_CALL_LOAD_IMAGE_FROM_TEXTURE,
+    RL_CALL_LOAD_IMAGE_FROM_SCREEN,
+    RL_CALL_IS_IMAGE_VALID,
+    RL_CALL_UNLOAD_IMAGE,
+    RL_CALL_EXPORT_IMAGE,
+    RL_CALL_EXPORT_IMAGE_TO_MEMORY,
+    RL_CALL_EXPORT_IMAGE_AS_CODE,
+    RL_CALL_GEN_IMAGE_COLOR,
+    RL_CALL_GEN_IMAGE_GRADIENT_LINEAR,
+    RL_CALL_GEN_IMAGE_GRADIENT_RADIAL,
+    RL_CALL_GEN_IMAGE_GRADIENT_SQUARE,
+    RL_CALL_GEN_IMAGE_CHECKED,
+    RL_CALL_GEN_IMAGE_WHITE_NOISE,
+    RL_CALL_GEN_IMAGE_PERLIN_NOISE,
+    RL_CALL_GEN_IMAGE_CELLULAR,
+    RL_CALL_GEN_IMAGE_TEXT,
+    RL_CALL_IMAGE_COPY,
+    RL_CALL_IMAGE_FROM_IMAGE,
+    RL_CALL_IMAGE_FROM_CHANNEL,
+    RL_CALL_IMAGE_TEXT,
+    RL_CALL_IMAGE_TEXT_EX,
+    RL_CALL_IMAGE_FORMAT,
+    RL_CALL_IMAGE_TO_POT,
+    RL_CALL_IMAGE_CROP,
+    RL_CALL_IMAGE_ALPHA_CROP,
+    RL_CALL_IMAGE_ALPHA_CLEAR,
+    RL_CALL_IMAGE_ALPHA_MASK,
+    RL_CALL_IMAGE_ALPHA_PREMULTIPLY,
+    RL_CALL_IMAGE_BLUR_GAUSSIAN,
+    RL_CALL_IMAGE_KERNEL_CONVOLUTION,
+    RL_CALL_IMAGE_RESIZE,
+    RL_CALL_IMAGE_RESIZE_NN,
+    RL_CALL_IMAGE_RESIZE_CANVAS,
+    RL_CALL_IMAGE_MIPMAPS,
+    RL_CALL_IMAGE_DITHER,
+    RL_CALL_IMAGE_FLIP_VERTICAL,
+    RL_CALL_IMAGE_FLIP_HORIZONTAL,
+    RL_CALL_IMAGE_ROTATE,
+    RL_CALL_IMAGE_ROTATE_CW,
+    RL_CALL_IMAGE_ROTATE_CCW,
+    RL_CALL_IMAGE_COLOR_TINT,
+    RL_CALL_IMAGE_COLOR_INVERT,
+    RL_CALL_IMAGE_COLOR_GRAYSCALE,
+    RL_CALL_IMAGE_COLOR_CONTRAST,
+    RL_CALL_IMAGE_COLOR_BRIGHTNESS,
+    RL_CALL_IMAGE_COLOR_REPLACE,
+    RL_CALL_LOAD_IMAGE_COLORS,
+    RL_CALL_LOAD_IMAGE_PALETTE,
+    RL_CALL_UNLOAD_IMAGE_COLORS,
+    RL_CALL_UNLOAD_IMAGE_PALETTE,
+    RL_CALL_GET_IMAGE_ALPHA_BORDER,
+    RL_CALL_GET_IMAGE_COLOR,
+    RL_CALL_IMAGE_CLEAR_BACKGROUND,
+    RL_CALL_IMAGE_DRAW_PIXEL,
+    RL_CALL_IMAGE_DRAW_PIXEL_V,
+    RL_CALL_IMAGE_DRAW_LINE,
+    RL_CALL_IMAGE_DRAW_LINE_V,
+    RL_CALL_IMAGE_DRAW_LINE_EX,
+    RL_CALL_IMAGE_DRAW_CIRCLE,
+    RL_CALL_IMAGE_DRAW_CIRCLE_V,
+    RL_CALL_IMAGE_DRAW_CIRCLE_LINES,
+    RL_CALL_IMAGE_DRAW_CIRCLE_LINES_V,
+    RL_CALL_IMAGE_DRAW_RECTANGLE,
+    RL_CALL_IMAGE_DRAW_RECTANGLE_V,
+    RL_CALL_IMAGE_DRAW_RECTANGLE_REC,
+    RL_CALL_IMAGE_DRAW_RECTANGLE_LINES,
+    RL_CALL_IMAGE_DRAW_TRIANGLE,
+    RL_CALL_IMAGE_DRAW_TRIANGLE_EX,
+    RL_CALL_IMAGE_DRAW_TRIANGLE_LINES,
+    RL_CALL_IMAGE_DRAW_TRIANGLE_FAN,
+    RL_CALL_IMAGE_DRAW_TRIANGLE_STRIP,
+    RL_CALL_IMAGE_DRAW,
+    RL_CALL_IMAGE_DRAW_TEXT,
+    RL_CALL_IMAGE_DRAW_TEXT_EX,
+    RL_CALL_LOAD_TEXTURE,
+    RL_CALL_LOAD_TEXTURE_FROM_IMAGE,
+    RL_CALL_LOAD_TEXTURE_CUBEMAP,
+    RL_CALL_LOAD_RENDER_TEXTURE,
+    RL_CALL_IS_TEXTURE_VALID,
+    RL_CALL_UNLOAD_TEXTURE,
+    RL_CALL_IS_RENDER_TEXTURE_VALID,
+    RL_CALL_UNLOAD_RENDER_TEXTURE,
+    RL_CALL_UPDATE_TEXTURE,
+    RL_CALL_UPDATE_TEXTURE_REC,
+    RL_CALL_GEN_TEXTURE_MIPMAPS,
+    RL_CALL_SET_TEXTURE_FILTER,
+    RL_CALL_SET_TEXTURE_WRAP,
+    RL_CALL_DRAW_TEXTURE,
+    RL_CALL_DRAW_TEXTURE_V,
+    RL_CALL_DRAW_TEXTURE_EX,
+    RL_CALL_DRAW_TEXTURE_REC,
+    RL_CALL_DRAW_TEXTURE_PRO,
+    RL_CALL_DRAW_TEXTURE_N_PATCH,
+    RL_CALL_COLOR_IS_EQUAL,
+    RL_CALL_FADE,
+    RL_CALL_COLOR_TO_INT,
+    RL_CALL_COLOR_NORMALIZE,
+    RL_CALL_COLOR_FROM_NORMALIZED,
+    RL_CALL_COLOR_TO_HSV,
+    RL_CALL_COLOR_FROM_HSV,
+    RL_CALL_COLOR_TINT,
+    RL_CALL_COLOR_BRIGHTNESS,
+    RL_CALL_COLOR_CONTRAST,
+    RL_CALL_COLOR_ALPHA,
+    RL_CALL_COLOR_ALPHA_BLEND,
+    RL_CALL_COLOR_LERP,
+    RL_CALL_GET_COLOR,
+    RL_CALL_GET_PIXEL_COLOR,
+    RL_CALL_SET_PIXEL_COLOR,
+    RL_CALL_GET_PIXEL_DATA_SIZE,
+    RL_CALL_GET_FONT_DEFAULT,
+    RL_CALL_LOAD_FONT,
+    RL_CALL_LOAD_FONT_EX,
+    RL_CALL_LOAD_FONT_FROM_IMAGE,
+    RL_CALL_LOAD_FONT_FROM_MEMORY,
+    RL_CALL_IS_FONT_VALID,
+    RL_CALL_LOAD_FONT_DATA,
+    RL_CALL_GEN_IMAGE_FONT_ATLAS,
+    RL_CALL_UNLOAD_FONT_DATA,
+    RL_CALL_UNLOAD_FONT,
+    RL_CALL_EXPORT_FONT_AS_CODE,
+    RL_CALL_DRAW_FPS,
+    RL_CALL_DRAW_TEXT,
+    RL_CALL_DRAW_TEXT_EX,
+    RL_CALL_DRAW_TEXT_PRO,
+    RL_CALL_DRAW_TEXT_CODEPOINT,
+    RL_CALL_DRAW_TEXT_CODEPOINTS,
+    RL_CALL_SET_TEXT_LINE_SPACING,
+    RL_CALL_MEASURE_TEXT,
+    RL_CALL_MEASURE_TEXT_EX,
+    RL_CALL_GET_GLYPH_INDEX,
+    RL_CALL_GET_GLYPH_INFO,
+    RL_CALL_GET_GLYPH_ATLAS_REC,
+    RL_CALL_LOAD_UTF8,
+    RL_CALL_UNLOAD_UTF8,
+    RL_CALL_LOAD_CODEPOINTS,
+    RL_CALL_UNLOAD_CODEPOINTS,
+    RL_CALL_GET_CODEPOINT_COUNT,
+    RL_CALL_GET_CODEPOINT,
+    RL_CALL_GET_CODEPOINT_NEXT,
+    RL_CALL_GET_CODEPOINT_PREVIOUS,
+    RL_CALL_CODEPOINT_TO_UTF8,
+    RL_CALL_TEXT_COPY,
+    RL_CALL_TEXT_IS_EQUAL,
+    RL_CALL_TEXT_LENGTH,
+    RL_CALL_TEXT_FORMAT,
+    RL_CALL_TEXT_SUBTEXT,
+    RL_CALL_TEXT_REPLACE,
+    RL_CALL_TEXT_INSERT,
+    RL_CALL_TEXT_JOIN,
+    RL_CALL_TEXT_SPLIT,
+    RL_CALL_TEXT_APPEND,
+    RL_CALL_TEXT_FIND_INDEX,
+    RL_CALL_TEXT_TO_UPPER,
+    RL_CALL_TEXT_TO_LOWER,
+    RL_CALL_TEXT_TO_PASCAL,
+    RL_CALL_TEXT_TO_SNAKE,
+    RL_CALL_TEXT_TO_CAMEL,
+    RL_CALL_TEXT_TO_INTEGER,
+    RL_CALL_TEXT_TO_FLOAT,
+    RL_CALL_DRAW_LINE3_D,
+    RL_CALL_DRAW_POINT3_D,
+    RL_CALL_DRAW_CIRCLE3_D,
+    RL_CALL_DRAW_TRIANGLE3_D,
+    RL_CALL_DRAW_TRIANGLE_STRIP3_D,
+    RL_CALL_DRAW_CUBE,
+    RL_CALL_DRAW_CUBE_V,
+    RL_CALL_DRAW_CUBE_WIRES,
+    RL_CALL_DRAW_CUBE_WIRES_V,
+    RL_CALL_DRAW_SPHERE,
+    RL_CALL_DRAW_SPHERE_EX,
+    RL_CALL_DRAW_SPHERE_WIRES,
+    RL_CALL_DRAW_CYLINDER,
+    RL_CALL_DRAW_CYLINDER_EX,
+    RL_CALL_DRAW_CYLINDER_WIRES,
+    RL_CALL_DRAW_CYLINDER_WIRES_EX,
+    RL_CALL_DRAW_CAPSULE,
+    RL_CALL_DRAW_CAPSULE_WIRES,
+    RL_CALL_DRAW_PLANE,
+    RL_CALL_DRAW_RAY,
+    RL_CALL_DRAW_GRID,
+    RL_CALL_LOAD_MODEL,
+    RL_CALL_LOAD_MODEL_FROM_MESH,
+    RL_CALL_IS_MODEL_VALID,
+    RL_CALL_UNLOAD_MODEL,
+    RL_CALL_GET_MODEL_BOUNDING_BOX,
+    RL_CALL_DRAW_MODEL,
+    RL_CALL_DRAW_MODEL_EX,
+    RL_CALL_DRAW_MODEL_WIRES,
+    RL_CALL_DRAW_MODEL_WIRES_EX,
+    RL_CALL_DRAW_MODEL_POINTS,
+    RL_CALL_DRAW_MODEL_POINTS_EX,
+    RL_CALL_DRAW_BOUNDING_BOX,
+    RL_CALL_DRAW_BILLBOARD,
+    RL_CALL_DRAW_BILLBOARD_REC,
+    RL_CALL_DRAW_BILLBOARD_PRO,
+    RL_CALL_UPLOAD_MESH,
+    RL_CALL_UPDATE_MESH_BUFFER,
+    RL_CALL_UNLOAD_MESH,
+    RL_CALL_DRAW_MESH,
+    RL_CALL_DRAW_MESH_INSTANCED,
+    RL_CALL_GET_MESH_BOUNDING_BOX,
+    RL_CALL_GEN_MESH_TANGENTS,
+    RL_CALL_EXPORT_MESH,
+    RL_CALL_EXPORT_MESH_AS_CODE,
+    RL_CALL_GEN_MESH_POLY,
+    RL_CALL_GEN_MESH_PLANE,
+    RL_CALL_GEN_MESH_CUBE,
+    RL_CALL_GEN_MESH_SPHERE,
+    RL_CALL_GEN_MESH_HEMI_SPHERE,
+    RL_CALL_GEN_MESH_CYLINDER,
+    RL_CALL_GEN_MESH_CONE,
+    RL_CALL_GEN_MESH_TORUS,
+    RL_CALL_GEN_MESH_KNOT,
+    RL_CALL_GEN_MESH_HEIGHTMAP,
+    RL_CALL_GEN_MESH_CUBICMAP,
+    RL_CALL_LOAD_MATERIALS,
+    RL_CALL_LOAD_MATERIAL_DEFAULT,
+    RL_CALL_IS_MATERIAL_VALID,
+    RL_CALL_UNLOAD_MATERIAL,
+    RL_CALL_SET_MATERIAL_TEXTURE,
+    RL_CALL_SET_MODEL_MESH_MATERIAL,
+    RL_CALL_LOAD_MODEL_ANIMATIONS,
+    RL_CALL_UPDATE_MODEL_ANIMATION,
+    RL_CALL_UPDATE_MODEL_ANIMATION_BONES,
+    RL_CALL_UNLOAD_MODEL_ANIMATION,
+    RL_CALL_UNLOAD_MODEL_ANIMATIONS,
+    RL_CALL_IS_MODEL_ANIMATION_VALID,
+    RL_CALL_CHECK_COLLISION_SPHERES,
+    RL_CALL_CHECK_COLLISION_BOXES,
+    RL_CALL_CHECK_COLLISION_BOX_SPHERE,
+    RL_CALL_GET_RAY_COLLISION_SPHERE,
+    RL_CALL_GET_RAY_COLLISION_BOX,
+    RL_CALL_GET_RAY_COLLISION_MESH,
+    RL_CALL_GET_RAY_COLLISION_TRIANGLE,
+    RL_CALL_GET_RAY_COLLISION_QUAD,
+    RL_CALL_INIT_AUDIO_DEVICE,
+    RL_CALL_CLOSE_AUDIO_DEVICE,
+    RL_CALL_IS_AUDIO_DEVICE_READY,
+    RL_CALL_SET_MASTER_VOLUME,
+    RL_CALL_GET_MASTER_VOLUME,
+    RL_CALL_LOAD_WAVE,
+    RL_CALL_LOAD_WAVE_FROM_MEMORY,
+    RL_CALL_IS_WAVE_VALID,
+    RL_CALL_LOAD_SOUND,
+    RL_CALL_LOAD_SOUND_FROM_WAVE,
+    RL_CALL_LOAD_SOUND_ALIAS,
+    RL_CALL_IS_SOUND_VALID,
+    RL_CALL_UPDATE_SOUND,
+    RL_CALL_UNLOAD_WAVE,
+    RL_CALL_UNLOAD_SOUND,
+    RL_CALL_UNLOAD_SOUND_ALIAS,
+    RL_CALL_EXPORT_WAVE,
+    RL_CALL_EXPORT_WAVE_AS_CODE,
+    RL_CALL_PLAY_SOUND,
+    RL_CALL_STOP_SOUND,
+    RL_CALL_PAUSE_SOUND,
+    RL_CALL_RESUME_SOUND,
+    RL_CALL_IS_SOUND_PLAYING,
+    RL_CALL_SET_SOUND_VOLUME,
+    RL_CALL_SET_SOUND_PITCH,
+    RL_CALL_SET_SOUND_PAN,
+    RL_CALL_WAVE_COPY,
+    RL_CALL_WAVE_CROP,
+    RL_CALL_WAVE_FORMAT,
+    RL_CALL_LOAD_WAVE_SAMPLES,
+    RL_CALL_UNLOAD_WAVE_SAMPLES,
+    RL_CALL_LOAD_MUSIC_STREAM,
+    RL_CALL_LOAD_MUSIC_STREAM_FROM_MEMORY,
+    RL_CALL_IS_MUSIC_VALID,
+    RL_CALL_UNLOAD_MUSIC_STREAM,
+    RL_CALL_PLAY_MUSIC_STREAM,
+    RL_CALL_IS_MUSIC_STREAM_PLAYING,
+    RL_CALL_UPDATE_MUSIC_STREAM,
+    RL_CALL_STOP_MUSIC_STREAM,
+    RL_CALL_PAUSE_MUSIC_STREAM,
+    RL_CALL_RESUME_MUSIC_STREAM,
+    RL_CALL_SEEK_MUSIC_STREAM,
+    RL_CALL_SET_MUSIC_VOLUME,
+    RL_CALL_SET_MUSIC_PITCH,
+    RL_CALL_SET_MUSIC_PAN,
+    RL_CALL_GET_MUSIC_TIME_LENGTH,
+    RL_CALL_GET_MUSIC_TIME_PLAYED,
+    RL_CALL_LOAD_AUDIO_STREAM,
+    RL_CALL_IS_AUDIO_STREAM_VALID,
+    RL_CALL_UNLOAD_AUDIO_STREAM,
+    RL_CALL_UPDATE_AUDIO_STREAM,
+    RL_CALL_IS_AUDIO_STREAM_PROCESSED,
+    RL_CALL_PLAY_AUDIO_STREAM,
+    RL_CALL_PAUSE_AUDIO_STREAM,
+    RL_CALL_RESUME_AUDIO_STREAM,
+    RL_CALL_IS_AUDIO_STREAM_PLAYING,
+    RL_CALL_STOP_AUDIO_STREAM,
+    RL_CALL_SET_AUDIO_STREAM_VOLUME,
+    RL_CALL_SET_AUDIO_STREAM_PITCH,
+    RL_CALL_SET_AUDIO_STREAM_PAN,
+    RL_CALL_SET_AUDIO_STREAM_BUFFER_SIZE_DEFAULT,
+    RL_CALL_SET_AUDIO_STREAM_CALLBACK,
+    RL_CALL_ATTACH_AUDIO_STREAM_PROCESSOR,
+    RL_CALL_DETACH_AUDIO_STREAM_PROCESSOR,
+    RL_CALL_ATTACH_AUDIO_MIXED_PROCESSOR,
+    RL_CALL_DETACH_AUDIO_MIXED_PROCESSOR,
+    RL_CALL_CLAMP,
+    RL_CALL_LERP,
+    RL_CALL_NORMALIZE,
+    RL_CALL_REMAP,
+    RL_CALL_WRAP,
+    RL_CALL_FLOAT_EQUALS,
+    RL_CALL_VECTOR2_ZERO,
+    RL_CALL_VECTOR2_ONE,
+    RL_CALL_VECTOR2_ADD,
+    RL_CALL_VECTOR2_ADD_VALUE,
+    RL_CALL_VECTOR2_SUBTRACT,
+    RL_CALL_VECTOR2_SUBTRACT_VALUE,
+    RL_CALL_VECTOR2_LENGTH,
+    RL_CALL_VECTOR2_LENGTH_SQR,
+    RL_CALL_VECTOR2_DOT_PRODUCT,
+    RL_CALL_VECTOR2_DISTANCE,
+    RL_CALL_VECTOR2_DISTANCE_SQR,
+    RL_CALL_VECTOR2_ANGLE,
+    RL_CALL_VECTOR2_LINE_ANGLE,
+    RL_CALL_VECTOR2_SCALE,
+    RL_CALL_VECTOR2_MULTIPLY,
+    RL_CALL_VECTOR2_NEGATE,
+    RL_CALL_VECTOR2_DIVIDE,
+    RL_CALL_VECTOR2_NORMALIZE,
+    RL_CALL_VECTOR2_TRANSFORM,
+    RL_CALL_VECTOR2_LERP,
+    RL_CALL_VECTOR2_REFLECT,
+    RL_CALL_VECTOR2_MIN,
+    RL_CALL_VECTOR2_MAX,
+    RL_CALL_VECTOR2_ROTATE,
+    RL_CALL_VECTOR2_MOVE_TOWARDS,
+    RL_CALL_VECTOR2_INVERT,
+    RL_CALL_VECTOR2_CLAMP,
+    RL_CALL_VECTOR2_CLAMP_VALUE,
+    RL_CALL_VECTOR2_EQUALS,
+    RL_CALL_VECTOR2_REFRACT,
+    RL_CALL_VECTOR3_ZERO,
+    RL_CALL_VECTOR3_ONE,
+    RL_CALL_VECTOR3_ADD,
+    RL_CALL_VECTOR3_ADD_VALUE,
+    RL_CALL_VECTOR3_SUBTRACT,
+    RL_CALL_VECTOR3_SUBTRACT_VALUE,
+    RL_CALL_VECTOR3_SCALE,
+    RL_CALL_VECTOR3_MULTIPLY,
+    RL_CALL_VECTOR3_CROSS_PRODUCT,
+    RL_CALL_VECTOR3_PERPENDICULAR,
+    RL_CALL_VECTOR3_LENGTH,
+    RL_CALL_VECTOR3_LENGTH_SQR,
+    RL_CALL_VECTOR3_DOT_PRODUCT,
+    RL_CALL_VECTOR3_DISTANCE,
+    RL_CALL_VECTOR3_DISTANCE_SQR,
+    RL_CALL_VECTOR3_ANGLE,
+    RL_CALL_VECTOR3_NEGATE,
+    RL_CALL_VECTOR3_DIVIDE,
+    RL_CALL_VECTOR3_NORMALIZE,
+    RL_CALL_VECTOR3_PROJECT,
+    RL_CALL_VECTOR3_REJECT,
+    RL_CALL_VECTOR3_ORTHO_NORMALIZE,
+    RL_CALL_VECTOR3_TRANSFORM,
+    RL_CALL_VECTOR3_ROTATE_BY_QUATERNION,
+    RL_CALL_VECTOR3_ROTATE_BY_AXIS_ANGLE,
+    RL_CALL_VECTOR3_MOVE_TOWARDS,
+    RL_CALL_VECTOR3_LERP,
+    RL_CALL_VECTOR3_CUBIC_HERMITE,
+    RL_CALL_VECTOR3_REFLECT,
+    RL_CALL_VECTOR3_MIN,
+    RL_CALL_VECTOR3_MAX,
+    RL_CALL_VECTOR3_BARYCENTER,
+    RL_CALL_VECTOR3_UNPROJECT,
+    RL_CALL_VECTOR3_TO_FLOAT_V,
+    RL_CALL_VECTOR3_INVERT,
+    RL_CALL_VECTOR3_CLAMP,
+    RL_CALL_VECTOR3_CLAMP_VALUE,
+    RL_CALL_VECTOR3_EQUALS,
+    RL_CALL_VECTOR3_REFRACT,
+    RL_CALL_VECTOR4_ZERO,
+    RL_CALL_VECTOR4_ONE,
+    RL_CALL_VECTOR4_ADD,
+    RL_CALL_VECTOR4_ADD_VALUE,
+    RL_CALL_VECTOR4_SUBTRACT,
+    RL_CALL_VECTOR4_SUBTRACT_VALUE,
+    RL_CALL_VECTOR4_LENGTH,
+    RL_CALL_VECTOR4_LENGTH_SQR,
+    RL_CALL_VECTOR4_DOT_PRODUCT,
+    RL_CALL_VECTOR4_DISTANCE,
+    RL_CALL_VECTOR4_DISTANCE_SQR,
+    RL_CALL_VECTOR4_SCALE,
+    RL_CALL_VECTOR4_MULTIPLY,
+    RL_CALL_VECTOR4_NEGATE,
+    RL_CALL_VECTOR4_DIVIDE,
+    RL_CALL_VECTOR4_NORMALIZE,
+    RL_CALL_VECTOR4_MIN,
+    RL_CALL_VECTOR4_MAX,
+    RL_CALL_VECTOR4_LERP,
+    RL_CALL_VECTOR4_MOVE_TOWARDS,
+    RL_CALL_VECTOR4_INVERT,
+    RL_CALL_VECTOR4_EQUALS,
+    RL_CALL_MATRIX_DETERMINANT,
+    RL_CALL_MATRIX_TRACE,
+    RL_CALL_MATRIX_TRANSPOSE,
+    RL_CALL_MATRIX_INVERT,
+    RL_CALL_MATRIX_IDENTITY,
+    RL_CALL_MATRIX_ADD,
+    RL_CALL_MATRIX_SUBTRACT,
+    RL_CALL_MATRIX_MULTIPLY,
+    RL_CALL_MATRIX_TRANSLATE,
+    RL_CALL_MATRIX_ROTATE,
+    RL_CALL_MATRIX_ROTATE_X,
+    RL_CALL_MATRIX_ROTATE_Y,
+    RL_CALL_MATRIX_ROTATE_Z,
+    RL_CALL_MATRIX_ROTATE_XYZ,
+    RL_CALL_MATRIX_ROTATE_ZYX,
+    RL_CALL_MATRIX_SCALE,
+    RL_CALL_MATRIX_FRUSTUM,
+    RL_CALL_MATRIX_PERSPECTIVE,
+    RL_CALL_MATRIX_ORTHO,
+    RL_CALL_MATRIX_LOOK_AT,
+    RL_CALL_MATRIX_TO_FLOAT_V,
+    RL_CALL_QUATERNION_ADD,
+    RL_CALL_QUATERNION_ADD_VALUE,
+    RL_CALL_QUATERNION_SUBTRACT,
+    RL_CALL_QUATERNION_SUBTRACT_VALUE,
+    RL_CALL_QUATERNION_IDENTITY,
+    RL_CALL_QUATERNION_LENGTH,
+    RL_CALL_QUATERNION_NORMALIZE,
+    RL_CALL_QUATERNION_INVERT,
+    RL_CALL_QUATERNION_MULTIPLY,
+    RL_CALL_QUATERNION_SCALE,
+    RL_CALL_QUATERNION_DIVIDE,
+    RL_CALL_QUATERNION_LERP,
+    RL_CALL_QUATERNION_NLERP,
+    RL_CALL_QUATERNION_SLERP,
+    RL_CALL_QUATERNION_CUBIC_HERMITE_SPLINE,
+    RL_CALL_QUATERNION_FROM_VECTOR3_TO_VECTOR3,
+    RL_CALL_QUATERNION_FROM_MATRIX,
+    RL_CALL_QUATERNION_TO_MATRIX,
+    RL_CALL_QUATERNION_FROM_AXIS_ANGLE,
+    RL_CALL_QUATERNION_TO_AXIS_ANGLE,
+    RL_CALL_QUATERNION_FROM_EULER,
+    RL_CALL_QUATERNION_TO_EULER,
+    RL_CALL_QUATERNION_TRANSFORM,
+    RL_CALL_QUATERNION_EQUALS,
+    RL_CALL_MATRIX_DECOMPOSE,
+    RL_CALL_COUNT
+};
+
+static const char* raylib_call_names[RL_CALL_COUNT] = {
+    "InitWindow",
+    "CloseWindow",
+    "WindowShouldClose",
+    "IsWindowReady",
+    "IsWindowFullscreen",
+    "IsWindowHidden",
+    "IsWindowMinimized",
+    "IsWindowMaximized",
+    "IsWindowFocused",
+    "IsWindowResized",
+    "IsWindowState",
+    "SetWindowState",
+    "ClearWindowState",
+    "ToggleFullscreen",
+    "ToggleBorderlessWindowed",
+    "MaximizeWindow",
+    "MinimizeWindow",
+    "RestoreWindow",
+    "SetWindowIcon",
+    "SetWindowIcons",
+    "SetWindowTitle",
+    "SetWindowPosition",
+    "SetWindowMonitor",
+    "SetWindowMinSize",
+    "SetWindowMaxSize",
+    "SetWindowSize",
+    "SetWindowOpacity",
+    "SetWindowFocused",
+    "GetWindowHandle",
+    "GetScreenWidth",
+    "GetScreenHeight",
+    "GetRenderWidth",
+    "GetRenderHeight",
+    "GetMonitorCount",
+    "GetCurrentMonitor",
+    "GetMonitorPosition",
+    "GetMonitorWidth",
+    "GetMonitorHeight",
+    "GetMonitorPhysicalWidth",
+    "GetMonitorPhysicalHeight",
+    "GetMonitorRefreshRate",
+    "GetWindowPosition",
+    "GetWindowScaleDPI",
+    "GetMonitorName",
+    "SetClipboardText",
+    "GetClipboardText",
+    "GetClipboardImage",
+    "EnableEventWaiting",
+    "DisableEventWaiting",
+    "ShowCursor",
+    "HideCursor",
+    "IsCursorHidden",
+    "EnableCursor",
+    "DisableCursor",
+    "IsCursorOnScreen",
+    "ClearBackground",
+    "BeginDrawing",
+    "EndDrawing",
+    "BeginMode2D",
+    "EndMode2D",
+    "BeginMode3D",
+    "EndMode3D",
+    "BeginTextureMode",
+    "EndTextureMode",
+    "BeginShaderMode",
+    "EndShaderMode",
+    "BeginBlendMode",
+    "EndBlendMode",
+    "BeginScissorMode",
+    "EndScissorMode",
+    "BeginVrStereoMode",
+    "EndVrStereoMode",
+    "LoadVrStereoConfig",
+    "UnloadVrStereoConfig",
+    "LoadShader",
+    "LoadShaderFromMemory",
+    "IsShaderValid",
+    "GetShaderLocation",
+    "GetShaderLocationAttrib",
+    "SetShaderValue",
+    "SetShaderValueV",
+    "SetShaderValueMatrix",
+    "SetShaderValueTexture",
+    "UnloadShader",
+    "GetScreenToWorldRay",
+    "GetScreenToWorldRayEx",
+    "GetWorldToScreen",
+    "GetWorldToScreenEx",
+    "GetWorldToScreen2D",
+    "GetScreenToWorld2D",
+    "GetCameraMatrix",
+    "GetCameraMatrix2D",
+    "SetTargetFPS",
+    "GetFrameTime",
+    "GetTime",
+    "GetFPS",
+    "SwapScreenBuffer",
+    "PollInputEvents",
+    "WaitTime",
+    "SetRandomSeed",
+    "GetRandomValue",
+    "LoadRandomSequence",
+    "UnloadRandomSequence",
+    "TakeScreenshot",
+    "SetConfigFlags",
+    "OpenURL",
+    "TraceLog",
+    "SetTraceLogLevel",
+    "MemAlloc",
+    "MemRealloc",
+    "MemFree",
+    "SetTraceLogCallback",
+    "SetLoadFileDataCallback",
+    "SetSaveFileDataCallback",
+    "SetLoadFileTextCallback",
+    "SetSaveFileTextCallback",
+    "LoadFileData",
+    "UnloadFileData",
+    "SaveFileData",
+    "ExportDataAsCode",
+    "LoadFileText",
+    "UnloadFileText",
+    "SaveFileText",
+    "FileExists",
+    "DirectoryExists",
+    "IsFileExtension",
+    "GetFileLength",
+    "GetFileExtension",
+    "GetFileName",
+    "GetFileNameWithoutExt",
+    "GetDirectoryPath",
+    "GetPrevDirectoryPath",
+    "GetWorkingDirectory",
+    "GetApplicationDirectory",
+    "MakeDirectory",
+    "ChangeDirectory",
+    "IsPathFile",
+    "IsFileNameValid",
+    "LoadDirectoryFiles",
+    "LoadDirectoryFilesEx",
+    "UnloadDirectoryFiles",
+    "IsFileDropped",
+    "LoadDroppedFiles",
+    "UnloadDroppedFiles",
+    "GetFileModTime",
+    "CompressData",
+    "DecompressData",
+    "EncodeDataBase64",
+    "DecodeDataBase64",
+    "ComputeCRC32",
+    "ComputeMD5",
+    "ComputeSHA1",
+    "LoadAutomationEventList",
+    "UnloadAutomationEventList",
+    "ExportAutomationEventList",
+    "SetAutomationEventList",
+    "SetAutomationEventBaseFrame",
+    "StartAutomationEventRecording",
+    "StopAutomationEventRecording",
+    "PlayAutomationEvent",
+    "IsKeyPressed",
+    "IsKeyPressedRepeat",
+    "IsKeyDown",
+    "IsKeyReleased",
+    "IsKeyUp",
+    "GetKeyPressed",
+    "GetCharPressed",
+    "SetExitKey",
+    "IsGamepadAvailable",
+    "GetGamepadName",
+    "IsGamepadButtonPressed",
+    "IsGamepadButtonDown",
+    "IsGamepadButtonReleased",
+    "IsGamepadButtonUp",
+    "GetGamepadButtonPressed",
+    "GetGamepadAxisCount",
+    "GetGamepadAxisMovement",
+    "SetGamepadMappings",
+    "SetGamepadVibration",
+    "IsMouseButtonPressed",
+    "IsMouseButtonDown",
+    "IsMouseButtonReleased",
+    "IsMouseButtonUp",
+    "GetMouseX",
+    "GetMouseY",
+    "GetMousePosition",
+    "GetMouseDelta",
+    "SetMousePosition",
+    "SetMouseOffset",
+    "SetMouseScale",
+    "GetMouseWheelMove",
+    "GetMouseWheelMoveV",
+    "SetMouseCursor",
+    "GetTouchX",
+    "GetTouchY",
+    "GetTouchPosition",
+    "GetTouchPointId",
+    "GetTouchPointCount",
+    "SetGesturesEnabled",
+    "IsGestureDetected",
+    "GetGestureDetected",
+    "GetGestureHoldDuration",
+    "GetGestureDragVector",
+    "GetGestureDragAngle",
+    "GetGesturePinchVector",
+    "GetGesturePinchAngle",
+    "UpdateCamera",
+    "UpdateCameraPro",
+    "SetShapesTexture",
+    "GetShapesTexture",
+    "GetShapesTextureRectangle",
+    "DrawPixel",
+    "DrawPixelV",
+    "DrawLine",
+    "DrawLineV",
+    "DrawLineEx",
+    "DrawLineStrip",
+    "DrawLineBezier",
+    "DrawCircle",
+    "DrawCircleSector",
+    "DrawCircleSectorLines",
+    "DrawCircleGradient",
+    "DrawCircleV",
+    "DrawCircleLines",
+    "DrawCircleLinesV",
+    "DrawEllipse",
+    "DrawEllipseLines",
+    "DrawRing",
+    "DrawRingLines",
+    "DrawRectangle",
+    "DrawRectangleV",
+    "DrawRectangleRec",
+    "DrawRectanglePro",
+    "DrawRectangleGradientV",
+    "DrawRectangleGradientH",
+    "DrawRectangleGradientEx",
+    "DrawRectangleLines",
+    "DrawRectangleLinesEx",
+    "DrawRectangleRounded",
+    "DrawRectangleRoundedLines",
+    "DrawRectangleRoundedLinesEx",
+    "DrawTriangle",
+    "DrawTriangleLines",
+    "DrawTriangleFan",
+    "DrawTriangleStrip",
+    "DrawPoly",
+    "DrawPolyLines",
+    "DrawPolyLinesEx",
+    "DrawSplineLinear",
+    "DrawSplineBasis",
+    "DrawSplineCatmullRom",
+    "DrawSplineBezierQuadratic",
+    "DrawSplineBezierCubic",
+    "DrawSplineSegmentLinear",
+    "DrawSplineSegmentBasis",
+    "DrawSplineSegmentCatmullRom",
+    "DrawSplineSegmentBezierQuadratic",
+    "DrawSplineSegmentBezierCubic",
+    "GetSplinePointLinear",
+    "GetSplinePointBasis",
+    "GetSplinePointCatmullRom",
+    "GetSplinePointBezierQuad",
+    "GetSplinePointBezierCubic",
+    "CheckCollisionRecs",
+    "CheckCollisionCircles",
+    "CheckCollisionCircleRec",
+    "CheckCollisionCircleLine",
+    "CheckCollisionPointRec",
+    "CheckCollisionPointCircle",
+    "CheckCollisionPointTriangle",
+    "CheckCollisionPointLine",
+    "CheckCollisionPointPoly",
+    "CheckCollisionLines",
+    "GetCollisionRec",
+    "LoadImage",
+    "LoadImageRaw",
+    "LoadImageAnim",
+    "LoadImageAnimFromMemory",
+    "LoadImageFromMemory",
+    "LoadImageFromTexture",
+    "LoadImageFromScreen",
+    "IsImageValid",
+    "UnloadImage",
+    "ExportImage",
+    "ExportImageToMemory",
+    "ExportImageAsCode",
+    "GenImageColor",
+    "GenImageGradientLinear",
+    "GenImageGradientRadial",
+    "GenImageGradientSquare",
+    "GenImageChecked",
+    "GenImageWhiteNoise",
+    "GenImagePerlinNoise",
+    "GenImageCellular",
+    "GenImageText",
+    "ImageCopy",
+    "ImageFromImage",
+    "ImageFromChannel",
+    "ImageText",
+    "ImageTextEx",
+    "ImageFormat",
+    "ImageToPOT",
+    "ImageCrop",
+    "ImageAlphaCrop",
+    "ImageAlphaClear",
+    "ImageAlphaMask",
+    "ImageAlphaPremultiply",
+    "ImageBlurGaussian",
+    "ImageKernelConvolution",
+    "ImageResize",
+    "ImageResizeNN",
+    "ImageResizeCanvas",
+    "ImageMipmaps",
+    "ImageDither",
+    "ImageFlipVertical",
+    "ImageFlipHorizontal",
+    "ImageRotate",
+    "ImageRotateCW",
+    "ImageRotateCCW",
+    "ImageColorTint",
+    "ImageColorInvert",
+    "ImageColorGrayscale",
+    "ImageColorContrast",
+    "ImageColorBrightness",
+    "ImageColorReplace",
+    "LoadImageColors",
+    "LoadImagePalette",
+    "UnloadImageColors",
+    "UnloadImagePalette",
+    "GetImageAlphaBorder",
+    "GetImageColor",
+    "ImageClearBackground",
+    "ImageDrawPixel",
+    "ImageDrawPixelV",
+    "ImageDrawLine",
+    "ImageDrawLineV",
+    "ImageDrawLineEx",
+    "ImageDrawCircle",
+    "ImageDrawCircleV",
+    "ImageDrawCircleLines",
+    "ImageDrawCircleLinesV",
+    "ImageDrawRectangle",
+    "ImageDrawRectangleV",
+    "ImageDrawRectangleRec",
+    "ImageDrawRectangleLines",
+    "ImageDrawTriangle",
+    "ImageDrawTriangleEx",
+    "ImageDrawTriangleLines",
+    "ImageDrawTriangleFan",
+    "ImageDrawTriangleStrip",
+    "ImageDraw",
+    "ImageDrawText",
+    "ImageDrawTextEx",
+    "LoadTexture",
+    "LoadTextureFromImage",
+    "LoadTextureCubemap",
+    "LoadRenderTexture",
+    "IsTextureValid",
+    "UnloadTexture",
+    "IsRenderTextureValid",
+    "UnloadRenderTexture",
+    "UpdateTexture",
+    "UpdateTextureRec",
+    "GenTextureMipmaps",
+    "SetTextureFilter",
+    "SetTextureWrap",
+    "DrawTexture",
+    "DrawTextureV",
+    "DrawTextureEx",
+    "DrawTextureRec",
+    "DrawTexturePro",
+    "DrawTextureNPatch",
+    "ColorIsEqual",
+    "Fade",
+    "ColorToInt",
+    "ColorNormalize",
+    "ColorFromNormalized",
+    "ColorToHSV",
+    "ColorFromHSV",
+    "ColorTint",
+    "ColorBrightness",
+    "ColorContrast",
+    "ColorAlpha",
+    "ColorAlphaBlend",
+    "ColorLerp",
+    "GetColor",
+    "GetPixelColor",
+    "SetPixelColor",
+    "GetPixelDataSize",
+    "GetFontDefault",
+    "LoadFont",
+    "LoadFontEx",
+    "LoadFontFromImage",
+    "LoadFontFromMemory",
+    "IsFontValid",
+    "LoadFontData",
+    "GenImageFontAtlas",
+    "UnloadFontData",
+    "UnloadFont",
+    "ExportFontAsCode",
+    "DrawFPS",
+    "DrawText",
+    "DrawTextEx",
+    "DrawTextPro",
+    "DrawTextCodepoint",
+    "DrawTextCodepoints",
+    "SetTextLineSpacing",
+    "MeasureText",
+    "MeasureTextEx",
+    "GetGlyphIndex",
+    "GetGlyphInfo",
+    "GetGlyphAtlasRec",
+    "LoadUTF8",
+    "UnloadUTF8",
+    "LoadCodepoints",
+    "UnloadCodepoints",
+    "GetCodepointCount",
+    "GetCodepoint",
+    "GetCodepointNext",
+    "GetCodepointPrevious",
+    "CodepointToUTF8",
+    "TextCopy",
+    "TextIsEqual",
+    "TextLength",
+    "TextFormat",
+    "TextSubtext",
+    "TextReplace",
+    "TextInsert",
+    "TextJoin",
+    "TextSplit",
+    "TextAppend",
+    "TextFindIndex",
+    "TextToUpper",
+    "TextToLower",
+    "TextToPascal",
+    "TextToSnake",
+    "TextToCamel",
+    "TextToInteger",
+    "TextToFloat",
+    "DrawLine3D",
+    "DrawPoint3D",
+    "DrawCircle3D",
+    "DrawTriangle3D",
+    "DrawTriangleStrip3D",
+    "DrawCube",
+    "DrawCubeV",
+    "DrawCubeWires",
+    "DrawCubeWiresV",
+    "DrawSphere",
+    "DrawSphereEx",
+    "DrawSphereWires",
+    "DrawCylinder",
+    "DrawCylinderEx",
+    "DrawCylinderWires",
+    "DrawCylinderWiresEx",
+    "DrawCapsule",
+    "DrawCapsuleWires",
+    "DrawPlane",
+    "DrawRay",
+    "DrawGrid",
+    "LoadModel",
+    "LoadModelFromMesh",
+    "IsModelValid",
+    "UnloadModel",
+    "GetModelBoundingBox",
+    "DrawModel",
+    "DrawModelEx",
+    "DrawModelWires",
+    "DrawModelWiresEx",
+    "DrawModelPoints",
+    "DrawModelPointsEx",
+    "DrawBoundingBox",
+    "DrawBillboard",
+    "DrawBillboardRec",
+    "DrawBillboardPro",
+    "UploadMesh",
+    "UpdateMeshBuffer",
+    "UnloadMesh",
+    "DrawMesh",
+    "DrawMeshInstanced",
+    "GetMeshBoundingBox",
+    "GenMeshTangents",
+    "ExportMesh",
+    "ExportMeshAsCode",
+    "GenMeshPoly",
+    "GenMeshPlane",
+    "GenMeshCube",
+    "GenMeshSphere",
+    "GenMeshHemiSphere",
+    "GenMeshCylinder",
+    "GenMeshCone",
+    "GenMeshTorus",
+    "GenMeshKnot",
+    "GenMeshHeightmap",
+    "GenMeshCubicmap",
+    "LoadMaterials",
+    "LoadMaterialDefault",
+    "IsMaterialValid",
+    "UnloadMaterial",
+    "SetMaterialTexture",
+    "SetModelMeshMaterial",
+    "LoadModelAnimations",
+    "UpdateModelAnimation",
+    "UpdateModelAnimationBones",
+    "UnloadModelAnimation",
+    "UnloadModelAnimations",
+    "IsModelAnimationValid",
+    "CheckCollisionSpheres",
+    "CheckCollisionBoxes",
+    "CheckCollisionBoxSphere",
+    "GetRayCollisionSphere",
+    "GetRayCollisionBox",
+    "GetRayCollisionMesh",
+    "GetRayCollisionTriangle",
+    "GetRayCollisionQuad",
+    "InitAudioDevice",
+    "CloseAudioDevice",
+    "IsAudioDeviceReady",
+    "SetMasterVolume",
+    "GetMasterVolume",
+    "LoadWave",
+    "LoadWaveFromMemory",
+    "IsWaveValid",
+    "LoadSound",
+    "LoadSoundFromWave",
+    "LoadSoundAlias",
+    "IsSoundValid",
+    "UpdateSound",
+    "UnloadWave",
+    "UnloadSound",
+    "UnloadSoundAlias",
+    "ExportWave",
+    "ExportWaveAsCode",
+    "PlaySound",
+    "StopSound",
+    "PauseSound",
+    "ResumeSound",
+    "IsSoundPlaying",
+    "SetSoundVolume",
+    "SetSoundPitch",
+    "SetSoundPan",
+    "WaveCopy",
+    "WaveCrop",
+    "WaveFormat",
+    "LoadWaveSamples",
+    "UnloadWaveSamples",
+    "LoadMusicStream",
+    "LoadMusicStreamFromMemory",
+    "IsMusicValid",
+    "UnloadMusicStream",
+    "PlayMusicStream",
+    "IsMusicStreamPlaying",
+    "UpdateMusicStream",
+    "StopMusicStream",
+    "PauseMusicStream",
+    "ResumeMusicStream",
+    "SeekMusicStream",
+    "SetMusicVolume",
+    "SetMusicPitch",
+    "SetMusicPan",
+    "GetMusicTimeLength",
+    "GetMusicTimePlayed",
+    "LoadAudioStream",
+    "IsAudioStreamValid",
+    "UnloadAudioStream",
+    "UpdateAudioStream",
+    "IsAudioStreamProcessed",
+    "PlayAudioStream",
+    "PauseAudioStream",
+    "ResumeAudioStream",
+    "IsAudioStreamPlaying",
+    "StopAudioStream",
+    "SetAudioStreamVolume",
+    "SetAudioStreamPitch",
+    "SetAudioStreamPan",
+    "SetAudioStreamBufferSizeDefault",
+    "SetAudioStreamCallback",
+    "AttachAudioStreamProcessor",
+    "DetachAudioStreamProcessor",
+    "AttachAudioMixedProcessor",
+    "DetachAudioMixedProcessor",
+    "Clamp",
+    "Lerp",
+    "Normalize",
+    "Remap",
+    "Wrap",
+    "FloatEquals",
+    "Vector2Zero",
+    "Vector2One",
+    "Vector2Add",
+    "Vector2AddValue",
+    "Vector2Subtract",
+    "Vector2SubtractValue",
+    "Vector2Length",
+    "Vector2LengthSqr",
+    "Vector2DotProduct",
+    "Vector2Distance",
+    "Vector2DistanceSqr",
+    "Vector2Angle",
+    "Vector2LineAngle",
+    "Vector2Scale",
+    "Vector2Multiply",
+    "Vector2Negate",
+    "Vector2Divide",
+    "Vector2Normalize",
+    "Vector2Transform",
+    "Vector2Lerp",
+    "Vector2Reflect",
+    "Vector2Min",
+    "Vector2Max",
+    "Vector2Rotate",
+    "Vector2MoveTowards",
+    "Vector2Invert",
+    "Vector2Clamp",
+    "Vector2ClampValue",
+    "Vector2Equals",
+    "Vector2Refract",
+    "Vector3Zero",
+    "Vector3One",
+    "Vector3Add",
+    "Vector3AddValue",
+    "Vector3Subtract",
+    "Vector3SubtractValue",
+    "Vector3Scale",
+    "Vector3Multiply",
+    "Vector3CrossProduct",
+    "Vector3Perpendicular",
+    "Vector3Length",
+    "Vector3LengthSqr",
+    "Vector3DotProduct",
+    "Vector3Distance",
+    "Vector3DistanceSqr",
+    "Vector3Angle",
+    "Vector3Negate",
+    "Vector3Divide",
+    "Vector3Normalize",
+    "Vector3Project",
+    "Vector3Reject",
+    "Vector3OrthoNormalize",
+    "Vector3Transform",
+    "Vector3RotateByQuaternion",
+    "Vector3RotateByAxisAngle",
+    "Vector3MoveTowards",
+    "Vector3Lerp",
+    "Vector3CubicHermite",
+    "Vector3Reflect",
+    "Vector3Min",
+    "Vector3Max",
+    "Vector3Barycenter",
+    "Vector3Unproject",
+    "Vector3ToFloatV",
+    "Vector3Invert",
+    "Vector3Clamp",
+    "Vector3ClampValue",
+    "Vector3Equals",
+    "Vector3Refract",
+    "Vector4Zero",
+    "Vector4One",
+    "Vector4Add",
+    "Vector4AddValue",
+    "Vector4Subtract",
+    "Vector4SubtractValue",
+    "Vector4Length",
+    "Vector4LengthSqr",
+    "Vector4DotProduct",
+    "Vector4Distance",
+    "Vector4DistanceSqr",
+    "Vector4Scale",
+    "Vector4Multiply",
+    "Vector4Negate",
+    "Vector4Divide",
+    "Vector4Normalize",
+    "Vector4Min",
+    "Vector4Max",
+    "Vector4Lerp",
+    "Vector4MoveTowards",
+    "Vector4Invert",
+    "Vector4Equals",
+    "MatrixDeterminant",
+    "MatrixTrace",
+    "MatrixTranspose",
+    "MatrixInvert",
+    "MatrixIdentity",
+    "MatrixAdd",
+    "MatrixSubtract",
+    "MatrixMultiply",
+    "MatrixTranslate",
+    "MatrixRotate",
+    "MatrixRotateX",
+    "MatrixRotateY",
+    "MatrixRotateZ",
+    "MatrixRotateXYZ",
+    "MatrixRotateZYX",
+    "MatrixScale",
+    "MatrixFrustum",
+    "MatrixPerspective",
+    "MatrixOrtho",
+    "MatrixLookAt",
+    "MatrixToFloatV",
+    "QuaternionAdd",
+    "QuaternionAddValue",
+    "QuaternionSubtract",
+    "QuaternionSubtractValue",
+    "QuaternionIdentity",
+    "QuaternionLength",
+    "QuaternionNormalize",
+    "QuaternionInvert",
+    "QuaternionMultiply",
+    "QuaternionScale",
+    "QuaternionDivide",
+    "QuaternionLerp",
+    "QuaternionNlerp",
+    "QuaternionSlerp",
+    "QuaternionCubicHermiteSpline",
+    "QuaternionFromVector3ToVector3",
+    "QuaternionFromMatrix",
+    "QuaternionToMatrix",
+    "QuaternionFromAxisAngle",
+    "QuaternionToAxisAngle",
+    "QuaternionFromEuler",
+    "QuaternionToEuler",
+    "QuaternionTransform",
+    "QuaternionEquals",
+    "MatrixDecompose",
+};
+
+#endif // RAYLIB_API_CALLS_GEN_H
@@ -0,0 +1,5940 @@
+#ifndef RAYLIB_API_CAPTURE_GEN_H
+#define RAYLIB_API_CAPTURE_GEN_H
+
+// DO NOT EDIT THIS FILE, CHANGES WILL BE LOST
+// Auto-generated by generate_raylib_api.py from raylib.h
+// Timestamp: 2026-10-19 10:29:30
+//
+// Host only. A RaylibAPI table that records every call and its arguments
+// (see raylib_capture.h) before forwarding to a target table. Variadic
+// functions can't be forwarded, so they keep pointing straight to the target.
+
+#include "raylib_api.gen.h"
+#include "raylib_api_calls.gen.h"
+#include "raylib_capture.h"
+
+static RaylibAPI* raylib_capture_target = NULL;
+
+static void rl_capture_init_window(int width, int height, const char *title) {
+    rl_capture_begin(RL_CALL_INIT_WINDOW);
+    rl_capture_value(&width, sizeof(width));
+    rl_capture_value(&height, sizeof(height));
+    rl_capture_string(title);
+    raylib_capture_target->init_window(width, height, title);
+    rl_capture_end();
+}
+
+static void rl_capture_close_window(void) {
+    rl_capture_begin(RL_CALL_CLOSE_WINDOW);
+    raylib_capture_target->close_window();
+    rl_capture_end();
+}
+
+static bool rl_capture_window_should_close(void) {
+    rl_capture_begin(RL_CALL_WINDOW_SHOULD_CLOSE);
+    bool result = raylib_capture_target->window_should_close();
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_window_ready(void) {
+    rl_capture_begin(RL_CALL_IS_WINDOW_READY);
+    bool result = raylib_capture_target->is_window_ready();
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_window_fullscreen(void) {
+    rl_capture_begin(RL_CALL_IS_WINDOW_FULLSCREEN);
+    bool result = raylib_capture_target->is_window_fullscreen();
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_window_hidden(void) {
+    rl_capture_begin(RL_CALL_IS_WINDOW_HIDDEN);
+    bool result = raylib_capture_target->is_window_hidden();
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_window_minimized(void) {
+    rl_capture_begin(RL_CALL_IS_WINDOW_MINIMIZED);
+    bool result = raylib_capture_target->is_window_minimized();
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_window_maximized(void) {
+    rl_capture_begin(RL_CALL_IS_WINDOW_MAXIMIZED);
+    bool result = raylib_capture_target->is_window_maximized();
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_window_focused(void) {
+    rl_capture_begin(RL_CALL_IS_WINDOW_FOCUSED);
+    bool result = raylib_capture_target->is_window_focused();
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_window_resized(void) {
+    rl_capture_begin(RL_CALL_IS_WINDOW_RESIZED);
+    bool result = raylib_capture_target->is_window_resized();
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_window_state(unsigned int flag) {
+    rl_capture_begin(RL_CALL_IS_WINDOW_STATE);
+    rl_capture_value(&flag, sizeof(flag));
+    bool result = raylib_capture_target->is_window_state(flag);
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_set_window_state(unsigned int flags) {
+    rl_capture_begin(RL_CALL_SET_WINDOW_STATE);
+    rl_capture_value(&flags, sizeof(flags));
+    raylib_capture_target->set_window_state(flags);
+    rl_capture_end();
+}
+
+static void rl_capture_clear_window_state(unsigned int flags) {
+    rl_capture_begin(RL_CALL_CLEAR_WINDOW_STATE);
+    rl_capture_value(&flags, sizeof(flags));
+    raylib_capture_target->clear_window_state(flags);
+    rl_capture_end();
+}
+
+static void rl_capture_toggle_fullscreen(void) {
+    rl_capture_begin(RL_CALL_TOGGLE_FULLSCREEN);
+    raylib_capture_target->toggle_fullscreen();
+    rl_capture_end();
+}
+
+static void rl_capture_toggle_borderless_windowed(void) {
+    rl_capture_begin(RL_CALL_TOGGLE_BORDERLESS_WINDOWED);
+    raylib_capture_target->toggle_borderless_windowed();
+    rl_capture_end();
+}
+
+static void rl_capture_maximize_window(void) {
+    rl_capture_begin(RL_CALL_MAXIMIZE_WINDOW);
+    raylib_capture_target->maximize_window();
+    rl_capture_end();
+}
+
+static void rl_capture_minimize_window(void) {
+    rl_capture_begin(RL_CALL_MINIMIZE_WINDOW);
+    raylib_capture_target->minimize_window();
+    rl_capture_end();
+}
+
+static void rl_capture_restore_window(void) {
+    rl_capture_begin(RL_CALL_RESTORE_WINDOW);
+    raylib_capture_target->restore_window();
+    rl_capture_end();
+}
+
+static void rl_capture_set_window_icon(Image image) {
+    rl_capture_unsupported(RL_CALL_SET_WINDOW_ICON);
+    raylib_capture_target->set_window_icon(image);
+}
+
+static void rl_capture_set_window_icons(Image *images, int count) {
+    rl_capture_unsupported(RL_CALL_SET_WINDOW_ICONS);
+    raylib_capture_target->set_window_icons(images, count);
+}
+
+static void rl_capture_set_window_title(const char *title) {
+    rl_capture_begin(RL_CALL_SET_WINDOW_TITLE);
+    rl_capture_string(title);
+    raylib_capture_target->set_window_title(title);
+    rl_capture_end();
+}
+
+static void rl_capture_set_window_position(int x, int y) {
+    rl_capture_begin(RL_CALL_SET_WINDOW_POSITION);
+    rl_capture_value(&x, sizeof(x));
+    rl_capture_value(&y, sizeof(y));
+    raylib_capture_target->set_window_position(x, y);
+    rl_capture_end();
+}
+
+static void rl_capture_set_window_monitor(int monitor) {
+    rl_capture_begin(RL_CALL_SET_WINDOW_MONITOR);
+    rl_capture_value(&monitor, sizeof(monitor));
+    raylib_capture_target->set_window_monitor(monitor);
+    rl_capture_end();
+}
+
+static void rl_capture_set_window_min_size(int width, int height) {
+    rl_capture_begin(RL_CALL_SET_WINDOW_MIN_SIZE);
+    rl_capture_value(&width, sizeof(width));
+    rl_capture_value(&height, sizeof(height));
+    raylib_capture_target->set_window_min_size(width, height);
+    rl_capture_end();
+}
+
+static void rl_capture_set_window_max_size(int width, int height) {
+    rl_capture_begin(RL_CALL_SET_WINDOW_MAX_SIZE);
+    rl_capture_value(&width, sizeof(width));
+    rl_capture_value(&height, sizeof(height));
+    raylib_capture_target->set_window_max_size(width, height);
+    rl_capture_end();
+}
+
+static void rl_capture_set_window_size(int width, int height) {
+    rl_capture_begin(RL_CALL_SET_WINDOW_SIZE);
+    rl_capture_value(&width, sizeof(width));
+    rl_capture_value(&height, sizeof(height));
+    raylib_capture_target->set_window_size(width, height);
+    rl_capture_end();
+}
+
+static void rl_capture_set_window_opacity(float opacity) {
+    rl_capture_begin(RL_CALL_SET_WINDOW_OPACITY);
+    rl_capture_value(&opacity, sizeof(opacity));
+    raylib_capture_target->set_window_opacity(opacity);
+    rl_capture_end();
+}
+
+static void rl_capture_set_window_focused(void) {
+    rl_capture_begin(RL_CALL_SET_WINDOW_FOCUSED);
+    raylib_capture_target->set_window_focused();
+    rl_capture_end();
+}
+
+static void * rl_capture_get_window_handle(void) {
+    rl_capture_unsupported(RL_CALL_GET_WINDOW_HANDLE);
+    return raylib_capture_target->get_window_handle();
+}
+
+static int rl_capture_get_screen_width(void) {
+    rl_capture_begin(RL_CALL_GET_SCREEN_WIDTH);
+    int result = raylib_capture_target->get_screen_width();
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_screen_height(void) {
+    rl_capture_begin(RL_CALL_GET_SCREEN_HEIGHT);
+    int result = raylib_capture_target->get_screen_height();
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_render_width(void) {
+    rl_capture_begin(RL_CALL_GET_RENDER_WIDTH);
+    int result = raylib_capture_target->get_render_width();
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_render_height(void) {
+    rl_capture_begin(RL_CALL_GET_RENDER_HEIGHT);
+    int result = raylib_capture_target->get_render_height();
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_monitor_count(void) {
+    rl_capture_begin(RL_CALL_GET_MONITOR_COUNT);
+    int result = raylib_capture_target->get_monitor_count();
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_current_monitor(void) {
+    rl_capture_begin(RL_CALL_GET_CURRENT_MONITOR);
+    int result = raylib_capture_target->get_current_monitor();
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_get_monitor_position(int monitor) {
+    rl_capture_begin(RL_CALL_GET_MONITOR_POSITION);
+    rl_capture_value(&monitor, sizeof(monitor));
+    Vector2 result = raylib_capture_target->get_monitor_position(monitor);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_monitor_width(int monitor) {
+    rl_capture_begin(RL_CALL_GET_MONITOR_WIDTH);
+    rl_capture_value(&monitor, sizeof(monitor));
+    int result = raylib_capture_target->get_monitor_width(monitor);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_monitor_height(int monitor) {
+    rl_capture_begin(RL_CALL_GET_MONITOR_HEIGHT);
+    rl_capture_value(&monitor, sizeof(monitor));
+    int result = raylib_capture_target->get_monitor_height(monitor);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_monitor_physical_width(int monitor) {
+    rl_capture_begin(RL_CALL_GET_MONITOR_PHYSICAL_WIDTH);
+    rl_capture_value(&monitor, sizeof(monitor));
+    int result = raylib_capture_target->get_monitor_physical_width(monitor);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_monitor_physical_height(int monitor) {
+    rl_capture_begin(RL_CALL_GET_MONITOR_PHYSICAL_HEIGHT);
+    rl_capture_value(&monitor, sizeof(monitor));
+    int result = raylib_capture_target->get_monitor_physical_height(monitor);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_monitor_refresh_rate(int monitor) {
+    rl_capture_begin(RL_CALL_GET_MONITOR_REFRESH_RATE);
+    rl_capture_value(&monitor, sizeof(monitor));
+    int result = raylib_capture_target->get_monitor_refresh_rate(monitor);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_get_window_position(void) {
+    rl_capture_begin(RL_CALL_GET_WINDOW_POSITION);
+    Vector2 result = raylib_capture_target->get_window_position();
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_get_window_scale_dpi(void) {
+    rl_capture_begin(RL_CALL_GET_WINDOW_SCALE_DPI);
+    Vector2 result = raylib_capture_target->get_window_scale_dpi();
+    rl_capture_end();
+    return result;
+}
+
+static const char * rl_capture_get_monitor_name(int monitor) {
+    rl_capture_begin(RL_CALL_GET_MONITOR_NAME);
+    rl_capture_value(&monitor, sizeof(monitor));
+    const char * result = raylib_capture_target->get_monitor_name(monitor);
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_set_clipboard_text(const char *text) {
+    rl_capture_begin(RL_CALL_SET_CLIPBOARD_TEXT);
+    rl_capture_string(text);
+    raylib_capture_target->set_clipboard_text(text);
+    rl_capture_end();
+}
+
+static const char * rl_capture_get_clipboard_text(void) {
+    rl_capture_begin(RL_CALL_GET_CLIPBOARD_TEXT);
+    const char * result = raylib_capture_target->get_clipboard_text();
+    rl_capture_end();
+    return result;
+}
+
+static Image rl_capture_get_clipboard_image(void) {
+    rl_capture_unsupported(RL_CALL_GET_CLIPBOARD_IMAGE);
+    return raylib_capture_target->get_clipboard_image();
+}
+
+static void rl_capture_enable_event_waiting(void) {
+    rl_capture_begin(RL_CALL_ENABLE_EVENT_WAITING);
+    raylib_capture_target->enable_event_waiting();
+    rl_capture_end();
+}
+
+static void rl_capture_disable_event_waiting(void) {
+    rl_capture_begin(RL_CALL_DISABLE_EVENT_WAITING);
+    raylib_capture_target->disable_event_waiting();
+    rl_capture_end();
+}
+
+static void rl_capture_show_cursor(void) {
+    rl_capture_begin(RL_CALL_SHOW_CURSOR);
+    raylib_capture_target->show_cursor();
+    rl_capture_end();
+}
+
+static void rl_capture_hide_cursor(void) {
+    rl_capture_begin(RL_CALL_HIDE_CURSOR);
+    raylib_capture_target->hide_cursor();
+    rl_capture_end();
+}
+
+static bool rl_capture_is_cursor_hidden(void) {
+    rl_capture_begin(RL_CALL_IS_CURSOR_HIDDEN);
+    bool result = raylib_capture_target->is_cursor_hidden();
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_enable_cursor(void) {
+    rl_capture_begin(RL_CALL_ENABLE_CURSOR);
+    raylib_capture_target->enable_cursor();
+    rl_capture_end();
+}
+
+static void rl_capture_disable_cursor(void) {
+    rl_capture_begin(RL_CALL_DISABLE_CURSOR);
+    raylib_capture_target->disable_cursor();
+    rl_capture_end();
+}
+
+static bool rl_capture_is_cursor_on_screen(void) {
+    rl_capture_begin(RL_CALL_IS_CURSOR_ON_SCREEN);
+    bool result = raylib_capture_target->is_cursor_on_screen();
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_clear_background(Color color) {
+    rl_capture_begin(RL_CALL_CLEAR_BACKGROUND);
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->clear_background(color);
+    rl_capture_end();
+}
+
+static void rl_capture_begin_drawing(void) {
+    rl_capture_begin(RL_CALL_BEGIN_DRAWING);
+    raylib_capture_target->begin_drawing();
+    rl_capture_end();
+}
+
+static void rl_capture_end_drawing(void) {
+    rl_capture_begin(RL_CALL_END_DRAWING);
+    raylib_capture_target->end_drawing();
+    rl_capture_end();
+}
+
+static void rl_capture_begin_mode2_d(Camera2D camera) {
+    rl_capture_begin(RL_CALL_BEGIN_MODE2_D);
+    rl_capture_value(&camera, sizeof(camera));
+    raylib_capture_target->begin_mode2_d(camera);
+    rl_capture_end();
+}
+
+static void rl_capture_end_mode2_d(void) {
+    rl_capture_begin(RL_CALL_END_MODE2_D);
+    raylib_capture_target->end_mode2_d();
+    rl_capture_end();
+}
+
+static void rl_capture_begin_mode3_d(Camera3D camera) {
+    rl_capture_begin(RL_CALL_BEGIN_MODE3_D);
+    rl_capture_value(&camera, sizeof(camera));
+    raylib_capture_target->begin_mode3_d(camera);
+    rl_capture_end();
+}
+
+static void rl_capture_end_mode3_d(void) {
+    rl_capture_begin(RL_CALL_END_MODE3_D);
+    raylib_capture_target->end_mode3_d();
+    rl_capture_end();
+}
+
+static void rl_capture_begin_texture_mode(RenderTexture2D target) {
+    rl_capture_begin(RL_CALL_BEGIN_TEXTURE_MODE);
+    rl_capture_render_texture(target);
+    raylib_capture_target->begin_texture_mode(target);
+    rl_capture_end();
+}
+
+static void rl_capture_end_texture_mode(void) {
+    rl_capture_begin(RL_CALL_END_TEXTURE_MODE);
+    raylib_capture_target->end_texture_mode();
+    rl_capture_end();
+}
+
+static void rl_capture_begin_shader_mode(Shader shader) {
+    rl_capture_begin(RL_CALL_BEGIN_SHADER_MODE);
+    rl_capture_shader(shader);
+    raylib_capture_target->begin_shader_mode(shader);
+    rl_capture_end();
+}
+
+static void rl_capture_end_shader_mode(void) {
+    rl_capture_begin(RL_CALL_END_SHADER_MODE);
+    raylib_capture_target->end_shader_mode();
+    rl_capture_end();
+}
+
+static void rl_capture_begin_blend_mode(int mode) {
+    rl_capture_begin(RL_CALL_BEGIN_BLEND_MODE);
+    rl_capture_value(&mode, sizeof(mode));
+    raylib_capture_target->begin_blend_mode(mode);
+    rl_capture_end();
+}
+
+static void rl_capture_end_blend_mode(void) {
+    rl_capture_begin(RL_CALL_END_BLEND_MODE);
+    raylib_capture_target->end_blend_mode();
+    rl_capture_end();
+}
+
+static void rl_capture_begin_scissor_mode(int x, int y, int width, int height) {
+    rl_capture_begin(RL_CALL_BEGIN_SCISSOR_MODE);
+    rl_capture_value(&x, sizeof(x));
+    rl_capture_value(&y, sizeof(y));
+    rl_capture_value(&width, sizeof(width));
+    rl_capture_value(&height, sizeof(height));
+    raylib_capture_target->begin_scissor_mode(x, y, width, height);
+    rl_capture_end();
+}
+
+static void rl_capture_end_scissor_mode(void) {
+    rl_capture_begin(RL_CALL_END_SCISSOR_MODE);
+    raylib_capture_target->end_scissor_mode();
+    rl_capture_end();
+}
+
+static void rl_capture_begin_vr_stereo_mode(VrStereoConfig config) {
+    rl_capture_unsupported(RL_CALL_BEGIN_VR_STEREO_MODE);
+    raylib_capture_target->begin_vr_stereo_mode(config);
+}
+
+static void rl_capture_end_vr_stereo_mode(void) {
+    rl_capture_begin(RL_CALL_END_VR_STEREO_MODE);
+    raylib_capture_target->end_vr_stereo_mode();
+    rl_capture_end();
+}
+
+static VrStereoConfig rl_capture_load_vr_stereo_config(VrDeviceInfo device) {
+    rl_capture_unsupported(RL_CALL_LOAD_VR_STEREO_CONFIG);
+    return raylib_capture_target->load_vr_stereo_config(device);
+}
+
+static void rl_capture_unload_vr_stereo_config(VrStereoConfig config) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_VR_STEREO_CONFIG);
+    raylib_capture_target->unload_vr_stereo_config(config);
+}
+
+static Shader rl_capture_load_shader(const char *vsFileName, const char *fsFileName) {
+    rl_capture_begin(RL_CALL_LOAD_SHADER);
+    rl_capture_string(vsFileName);
+    rl_capture_string(fsFileName);
+    Shader result = raylib_capture_target->load_shader(vsFileName, fsFileName);
+    rl_capture_result_shader(result);
+    rl_capture_end();
+    return result;
+}
+
+static Shader rl_capture_load_shader_from_memory(const char *vsCode, const char *fsCode) {
+    rl_capture_begin(RL_CALL_LOAD_SHADER_FROM_MEMORY);
+    rl_capture_string(vsCode);
+    rl_capture_string(fsCode);
+    Shader result = raylib_capture_target->load_shader_from_memory(vsCode, fsCode);
+    rl_capture_result_shader(result);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_shader_valid(Shader shader) {
+    rl_capture_begin(RL_CALL_IS_SHADER_VALID);
+    rl_capture_shader(shader);
+    bool result = raylib_capture_target->is_shader_valid(shader);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_shader_location(Shader shader, const char *uniformName) {
+    rl_capture_begin(RL_CALL_GET_SHADER_LOCATION);
+    rl_capture_shader(shader);
+    rl_capture_string(uniformName);
+    int result = raylib_capture_target->get_shader_location(shader, uniformName);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_shader_location_attrib(Shader shader, const char *attribName) {
+    rl_capture_begin(RL_CALL_GET_SHADER_LOCATION_ATTRIB);
+    rl_capture_shader(shader);
+    rl_capture_string(attribName);
+    int result = raylib_capture_target->get_shader_location_attrib(shader, attribName);
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_set_shader_value(Shader shader, int locIndex, const void *value, int uniformType) {
+    rl_capture_unsupported(RL_CALL_SET_SHADER_VALUE);
+    raylib_capture_target->set_shader_value(shader, locIndex, value, uniformType);
+}
+
+static void rl_capture_set_shader_value_v(Shader shader, int locIndex, const void *value, int uniformType, int count) {
+    rl_capture_unsupported(RL_CALL_SET_SHADER_VALUE_V);
+    raylib_capture_target->set_shader_value_v(shader, locIndex, value, uniformType, count);
+}
+
+static void rl_capture_set_shader_value_matrix(Shader shader, int locIndex, Matrix mat) {
+    rl_capture_begin(RL_CALL_SET_SHADER_VALUE_MATRIX);
+    rl_capture_shader(shader);
+    rl_capture_value(&locIndex, sizeof(locIndex));
+    rl_capture_value(&mat, sizeof(mat));
+    raylib_capture_target->set_shader_value_matrix(shader, locIndex, mat);
+    rl_capture_end();
+}
+
+static void rl_capture_set_shader_value_texture(Shader shader, int locIndex, Texture2D texture) {
+    rl_capture_begin(RL_CALL_SET_SHADER_VALUE_TEXTURE);
+    rl_capture_shader(shader);
+    rl_capture_value(&locIndex, sizeof(locIndex));
+    rl_capture_texture(texture);
+    raylib_capture_target->set_shader_value_texture(shader, locIndex, texture);
+    rl_capture_end();
+}
+
+static void rl_capture_unload_shader(Shader shader) {
+    rl_capture_begin(RL_CALL_UNLOAD_SHADER);
+    rl_capture_shader(shader);
+    raylib_capture_target->unload_shader(shader);
+    rl_capture_forget_shader(shader);
+    rl_capture_end();
+}
+
+static Ray rl_capture_get_screen_to_world_ray(Vector2 position, Camera camera) {
+    rl_capture_begin(RL_CALL_GET_SCREEN_TO_WORLD_RAY);
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&camera, sizeof(camera));
+    Ray result = raylib_capture_target->get_screen_to_world_ray(position, camera);
+    rl_capture_end();
+    return result;
+}
+
+static Ray rl_capture_get_screen_to_world_ray_ex(Vector2 position, Camera camera, int width, int height) {
+    rl_capture_begin(RL_CALL_GET_SCREEN_TO_WORLD_RAY_EX);
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&camera, sizeof(camera));
+    rl_capture_value(&width, sizeof(width));
+    rl_capture_value(&height, sizeof(height));
+    Ray result = raylib_capture_target->get_screen_to_world_ray_ex(position, camera, width, height);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_get_world_to_screen(Vector3 position, Camera camera) {
+    rl_capture_begin(RL_CALL_GET_WORLD_TO_SCREEN);
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&camera, sizeof(camera));
+    Vector2 result = raylib_capture_target->get_world_to_screen(position, camera);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_get_world_to_screen_ex(Vector3 position, Camera camera, int width, int height) {
+    rl_capture_begin(RL_CALL_GET_WORLD_TO_SCREEN_EX);
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&camera, sizeof(camera));
+    rl_capture_value(&width, sizeof(width));
+    rl_capture_value(&height, sizeof(height));
+    Vector2 result = raylib_capture_target->get_world_to_screen_ex(position, camera, width, height);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_get_world_to_screen2_d(Vector2 position, Camera2D camera) {
+    rl_capture_begin(RL_CALL_GET_WORLD_TO_SCREEN2_D);
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&camera, sizeof(camera));
+    Vector2 result = raylib_capture_target->get_world_to_screen2_d(position, camera);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_get_screen_to_world2_d(Vector2 position, Camera2D camera) {
+    rl_capture_begin(RL_CALL_GET_SCREEN_TO_WORLD2_D);
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&camera, sizeof(camera));
+    Vector2 result = raylib_capture_target->get_screen_to_world2_d(position, camera);
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_get_camera_matrix(Camera camera) {
+    rl_capture_begin(RL_CALL_GET_CAMERA_MATRIX);
+    rl_capture_value(&camera, sizeof(camera));
+    Matrix result = raylib_capture_target->get_camera_matrix(camera);
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_get_camera_matrix2_d(Camera2D camera) {
+    rl_capture_begin(RL_CALL_GET_CAMERA_MATRIX2_D);
+    rl_capture_value(&camera, sizeof(camera));
+    Matrix result = raylib_capture_target->get_camera_matrix2_d(camera);
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_set_target_fps(int fps) {
+    rl_capture_begin(RL_CALL_SET_TARGET_FPS);
+    rl_capture_value(&fps, sizeof(fps));
+    raylib_capture_target->set_target_fps(fps);
+    rl_capture_end();
+}
+
+static float rl_capture_get_frame_time(void) {
+    rl_capture_begin(RL_CALL_GET_FRAME_TIME);
+    float result = raylib_capture_target->get_frame_time();
+    rl_capture_end();
+    return result;
+}
+
+static double rl_capture_get_time(void) {
+    rl_capture_begin(RL_CALL_GET_TIME);
+    double result = raylib_capture_target->get_time();
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_fps(void) {
+    rl_capture_begin(RL_CALL_GET_FPS);
+    int result = raylib_capture_target->get_fps();
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_swap_screen_buffer(void) {
+    rl_capture_begin(RL_CALL_SWAP_SCREEN_BUFFER);
+    raylib_capture_target->swap_screen_buffer();
+    rl_capture_end();
+}
+
+static void rl_capture_poll_input_events(void) {
+    rl_capture_begin(RL_CALL_POLL_INPUT_EVENTS);
+    raylib_capture_target->poll_input_events();
+    rl_capture_end();
+}
+
+static void rl_capture_wait_time(double seconds) {
+    rl_capture_begin(RL_CALL_WAIT_TIME);
+    rl_capture_value(&seconds, sizeof(seconds));
+    raylib_capture_target->wait_time(seconds);
+    rl_capture_end();
+}
+
+static void rl_capture_set_random_seed(unsigned int seed) {
+    rl_capture_begin(RL_CALL_SET_RANDOM_SEED);
+    rl_capture_value(&seed, sizeof(seed));
+    raylib_capture_target->set_random_seed(seed);
+    rl_capture_end();
+}
+
+static int rl_capture_get_random_value(int min, int max) {
+    rl_capture_begin(RL_CALL_GET_RANDOM_VALUE);
+    rl_capture_value(&min, sizeof(min));
+    rl_capture_value(&max, sizeof(max));
+    int result = raylib_capture_target->get_random_value(min, max);
+    rl_capture_end();
+    return result;
+}
+
+static int * rl_capture_load_random_sequence(unsigned int count, int min, int max) {
+    rl_capture_unsupported(RL_CALL_LOAD_RANDOM_SEQUENCE);
+    return raylib_capture_target->load_random_sequence(count, min, max);
+}
+
+static void rl_capture_unload_random_sequence(int *sequence) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_RANDOM_SEQUENCE);
+    raylib_capture_target->unload_random_sequence(sequence);
+}
+
+static void rl_capture_take_screenshot(const char *fileName) {
+    rl_capture_begin(RL_CALL_TAKE_SCREENSHOT);
+    rl_capture_string(fileName);
+    raylib_capture_target->take_screenshot(fileName);
+    rl_capture_end();
+}
+
+static void rl_capture_set_config_flags(unsigned int flags) {
+    rl_capture_begin(RL_CALL_SET_CONFIG_FLAGS);
+    rl_capture_value(&flags, sizeof(flags));
+    raylib_capture_target->set_config_flags(flags);
+    rl_capture_end();
+}
+
+static void rl_capture_open_url(const char *url) {
+    rl_capture_begin(RL_CALL_OPEN_URL);
+    rl_capture_string(url);
+    raylib_capture_target->open_url(url);
+    rl_capture_end();
+}
+
+static void rl_capture_set_trace_log_level(int logLevel) {
+    rl_capture_begin(RL_CALL_SET_TRACE_LOG_LEVEL);
+    rl_capture_value(&logLevel, sizeof(logLevel));
+    raylib_capture_target->set_trace_log_level(logLevel);
+    rl_capture_end();
+}
+
+static void * rl_capture_mem_alloc(unsigned int size) {
+    rl_capture_unsupported(RL_CALL_MEM_ALLOC);
+    return raylib_capture_target->mem_alloc(size);
+}
+
+static void * rl_capture_mem_realloc(void *ptr, unsigned int size) {
+    rl_capture_unsupported(RL_CALL_MEM_REALLOC);
+    return raylib_capture_target->mem_realloc(ptr, size);
+}
+
+static void rl_capture_mem_free(void *ptr) {
+    rl_capture_unsupported(RL_CALL_MEM_FREE);
+    raylib_capture_target->mem_free(ptr);
+}
+
+static void rl_capture_set_trace_log_callback(TraceLogCallback callback) {
+    rl_capture_unsupported(RL_CALL_SET_TRACE_LOG_CALLBACK);
+    raylib_capture_target->set_trace_log_callback(callback);
+}
+
+static void rl_capture_set_load_file_data_callback(LoadFileDataCallback callback) {
+    rl_capture_unsupported(RL_CALL_SET_LOAD_FILE_DATA_CALLBACK);
+    raylib_capture_target->set_load_file_data_callback(callback);
+}
+
+static void rl_capture_set_save_file_data_callback(SaveFileDataCallback callback) {
+    rl_capture_unsupported(RL_CALL_SET_SAVE_FILE_DATA_CALLBACK);
+    raylib_capture_target->set_save_file_data_callback(callback);
+}
+
+static void rl_capture_set_load_file_text_callback(LoadFileTextCallback callback) {
+    rl_capture_unsupported(RL_CALL_SET_LOAD_FILE_TEXT_CALLBACK);
+    raylib_capture_target->set_load_file_text_callback(callback);
+}
+
+static void rl_capture_set_save_file_text_callback(SaveFileTextCallback callback) {
+    rl_capture_unsupported(RL_CALL_SET_SAVE_FILE_TEXT_CALLBACK);
+    raylib_capture_target->set_save_file_text_callback(callback);
+}
+
+static unsigned char * rl_capture_load_file_data(const char *fileName, int *dataSize) {
+    rl_capture_unsupported(RL_CALL_LOAD_FILE_DATA);
+    return raylib_capture_target->load_file_data(fileName, dataSize);
+}
+
+static void rl_capture_unload_file_data(unsigned char *data) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_FILE_DATA);
+    raylib_capture_target->unload_file_data(data);
+}
+
+static bool rl_capture_save_file_data(const char *fileName, void *data, int dataSize) {
+    rl_capture_unsupported(RL_CALL_SAVE_FILE_DATA);
+    return raylib_capture_target->save_file_data(fileName, data, dataSize);
+}
+
+static bool rl_capture_export_data_as_code(const unsigned char *data, int dataSize, const char *fileName) {
+    rl_capture_unsupported(RL_CALL_EXPORT_DATA_AS_CODE);
+    return raylib_capture_target->export_data_as_code(data, dataSize, fileName);
+}
+
+static char * rl_capture_load_file_text(const char *fileName) {
+    rl_capture_unsupported(RL_CALL_LOAD_FILE_TEXT);
+    return raylib_capture_target->load_file_text(fileName);
+}
+
+static void rl_capture_unload_file_text(char *text) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_FILE_TEXT);
+    raylib_capture_target->unload_file_text(text);
+}
+
+static bool rl_capture_save_file_text(const char *fileName, char *text) {
+    rl_capture_unsupported(RL_CALL_SAVE_FILE_TEXT);
+    return raylib_capture_target->save_file_text(fileName, text);
+}
+
+static bool rl_capture_file_exists(const char *fileName) {
+    rl_capture_begin(RL_CALL_FILE_EXISTS);
+    rl_capture_string(fileName);
+    bool result = raylib_capture_target->file_exists(fileName);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_directory_exists(const char *dirPath) {
+    rl_capture_begin(RL_CALL_DIRECTORY_EXISTS);
+    rl_capture_string(dirPath);
+    bool result = raylib_capture_target->directory_exists(dirPath);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_file_extension(const char *fileName, const char *ext) {
+    rl_capture_begin(RL_CALL_IS_FILE_EXTENSION);
+    rl_capture_string(fileName);
+    rl_capture_string(ext);
+    bool result = raylib_capture_target->is_file_extension(fileName, ext);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_file_length(const char *fileName) {
+    rl_capture_begin(RL_CALL_GET_FILE_LENGTH);
+    rl_capture_string(fileName);
+    int result = raylib_capture_target->get_file_length(fileName);
+    rl_capture_end();
+    return result;
+}
+
+static const char * rl_capture_get_file_extension(const char *fileName) {
+    rl_capture_begin(RL_CALL_GET_FILE_EXTENSION);
+    rl_capture_string(fileName);
+    const char * result = raylib_capture_target->get_file_extension(fileName);
+    rl_capture_end();
+    return result;
+}
+
+static const char * rl_capture_get_file_name(const char *filePath) {
+    rl_capture_begin(RL_CALL_GET_FILE_NAME);
+    rl_capture_string(filePath);
+    const char * result = raylib_capture_target->get_file_name(filePath);
+    rl_capture_end();
+    return result;
+}
+
+static const char * rl_capture_get_file_name_without_ext(const char *filePath) {
+    rl_capture_begin(RL_CALL_GET_FILE_NAME_WITHOUT_EXT);
+    rl_capture_string(filePath);
+    const char * result = raylib_capture_target->get_file_name_without_ext(filePath);
+    rl_capture_end();
+    return result;
+}
+
+static const char * rl_capture_get_directory_path(const char *filePath) {
+    rl_capture_begin(RL_CALL_GET_DIRECTORY_PATH);
+    rl_capture_string(filePath);
+    const char * result = raylib_capture_target->get_directory_path(filePath);
+    rl_capture_end();
+    return result;
+}
+
+static const char * rl_capture_get_prev_directory_path(const char *dirPath) {
+    rl_capture_begin(RL_CALL_GET_PREV_DIRECTORY_PATH);
+    rl_capture_string(dirPath);
+    const char * result = raylib_capture_target->get_prev_directory_path(dirPath);
+    rl_capture_end();
+    return result;
+}
+
+static const char * rl_capture_get_working_directory(void) {
+    rl_capture_begin(RL_CALL_GET_WORKING_DIRECTORY);
+    const char * result = raylib_capture_target->get_working_directory();
+    rl_capture_end();
+    return result;
+}
+
+static const char * rl_capture_get_application_directory(void) {
+    rl_capture_begin(RL_CALL_GET_APPLICATION_DIRECTORY);
+    const char * result = raylib_capture_target->get_application_directory();
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_make_directory(const char *dirPath) {
+    rl_capture_begin(RL_CALL_MAKE_DIRECTORY);
+    rl_capture_string(dirPath);
+    int result = raylib_capture_target->make_directory(dirPath);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_change_directory(const char *dir) {
+    rl_capture_begin(RL_CALL_CHANGE_DIRECTORY);
+    rl_capture_string(dir);
+    bool result = raylib_capture_target->change_directory(dir);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_path_file(const char *path) {
+    rl_capture_begin(RL_CALL_IS_PATH_FILE);
+    rl_capture_string(path);
+    bool result = raylib_capture_target->is_path_file(path);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_file_name_valid(const char *fileName) {
+    rl_capture_begin(RL_CALL_IS_FILE_NAME_VALID);
+    rl_capture_string(fileName);
+    bool result = raylib_capture_target->is_file_name_valid(fileName);
+    rl_capture_end();
+    return result;
+}
+
+static FilePathList rl_capture_load_directory_files(const char *dirPath) {
+    rl_capture_unsupported(RL_CALL_LOAD_DIRECTORY_FILES);
+    return raylib_capture_target->load_directory_files(dirPath);
+}
+
+static FilePathList rl_capture_load_directory_files_ex(const char *basePath, const char *filter, bool scanSubdirs) {
+    rl_capture_unsupported(RL_CALL_LOAD_DIRECTORY_FILES_EX);
+    return raylib_capture_target->load_directory_files_ex(basePath, filter, scanSubdirs);
+}
+
+static void rl_capture_unload_directory_files(FilePathList files) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_DIRECTORY_FILES);
+    raylib_capture_target->unload_directory_files(files);
+}
+
+static bool rl_capture_is_file_dropped(void) {
+    rl_capture_begin(RL_CALL_IS_FILE_DROPPED);
+    bool result = raylib_capture_target->is_file_dropped();
+    rl_capture_end();
+    return result;
+}
+
+static FilePathList rl_capture_load_dropped_files(void) {
+    rl_capture_unsupported(RL_CALL_LOAD_DROPPED_FILES);
+    return raylib_capture_target->load_dropped_files();
+}
+
+static void rl_capture_unload_dropped_files(FilePathList files) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_DROPPED_FILES);
+    raylib_capture_target->unload_dropped_files(files);
+}
+
+static long rl_capture_get_file_mod_time(const char *fileName) {
+    rl_capture_unsupported(RL_CALL_GET_FILE_MOD_TIME);
+    return raylib_capture_target->get_file_mod_time(fileName);
+}
+
+static unsigned char * rl_capture_compress_data(const unsigned char *data, int dataSize, int *compDataSize) {
+    rl_capture_unsupported(RL_CALL_COMPRESS_DATA);
+    return raylib_capture_target->compress_data(data, dataSize, compDataSize);
+}
+
+static unsigned char * rl_capture_decompress_data(const unsigned char *compData, int compDataSize, int *dataSize) {
+    rl_capture_unsupported(RL_CALL_DECOMPRESS_DATA);
+    return raylib_capture_target->decompress_data(compData, compDataSize, dataSize);
+}
+
+static char * rl_capture_encode_data_base64(const unsigned char *data, int dataSize, int *outputSize) {
+    rl_capture_unsupported(RL_CALL_ENCODE_DATA_BASE64);
+    return raylib_capture_target->encode_data_base64(data, dataSize, outputSize);
+}
+
+static unsigned char * rl_capture_decode_data_base64(const unsigned char *data, int *outputSize) {
+    rl_capture_unsupported(RL_CALL_DECODE_DATA_BASE64);
+    return raylib_capture_target->decode_data_base64(data, outputSize);
+}
+
+static unsigned int rl_capture_compute_crc32(unsigned char *data, int dataSize) {
+    rl_capture_unsupported(RL_CALL_COMPUTE_CRC32);
+    return raylib_capture_target->compute_crc32(data, dataSize);
+}
+
+static unsigned int * rl_capture_compute_md5(unsigned char *data, int dataSize) {
+    rl_capture_unsupported(RL_CALL_COMPUTE_MD5);
+    return raylib_capture_target->compute_md5(data, dataSize);
+}
+
+static unsigned int * rl_capture_compute_sha1(unsigned char *data, int dataSize) {
+    rl_capture_unsupported(RL_CALL_COMPUTE_SHA1);
+    return raylib_capture_target->compute_sha1(data, dataSize);
+}
+
+static AutomationEventList rl_capture_load_automation_event_list(const char *fileName) {
+    rl_capture_unsupported(RL_CALL_LOAD_AUTOMATION_EVENT_LIST);
+    return raylib_capture_target->load_automation_event_list(fileName);
+}
+
+static void rl_capture_unload_automation_event_list(AutomationEventList list) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_AUTOMATION_EVENT_LIST);
+    raylib_capture_target->unload_automation_event_list(list);
+}
+
+static bool rl_capture_export_automation_event_list(AutomationEventList list, const char *fileName) {
+    rl_capture_unsupported(RL_CALL_EXPORT_AUTOMATION_EVENT_LIST);
+    return raylib_capture_target->export_automation_event_list(list, fileName);
+}
+
+static void rl_capture_set_automation_event_list(AutomationEventList *list) {
+    rl_capture_unsupported(RL_CALL_SET_AUTOMATION_EVENT_LIST);
+    raylib_capture_target->set_automation_event_list(list);
+}
+
+static void rl_capture_set_automation_event_base_frame(int frame) {
+    rl_capture_begin(RL_CALL_SET_AUTOMATION_EVENT_BASE_FRAME);
+    rl_capture_value(&frame, sizeof(frame));
+    raylib_capture_target->set_automation_event_base_frame(frame);
+    rl_capture_end();
+}
+
+static void rl_capture_start_automation_event_recording(void) {
+    rl_capture_begin(RL_CALL_START_AUTOMATION_EVENT_RECORDING);
+    raylib_capture_target->start_automation_event_recording();
+    rl_capture_end();
+}
+
+static void rl_capture_stop_automation_event_recording(void) {
+    rl_capture_begin(RL_CALL_STOP_AUTOMATION_EVENT_RECORDING);
+    raylib_capture_target->stop_automation_event_recording();
+    rl_capture_end();
+}
+
+static void rl_capture_play_automation_event(AutomationEvent event) {
+    rl_capture_unsupported(RL_CALL_PLAY_AUTOMATION_EVENT);
+    raylib_capture_target->play_automation_event(event);
+}
+
+static bool rl_capture_is_key_pressed(int key) {
+    rl_capture_begin(RL_CALL_IS_KEY_PRESSED);
+    rl_capture_value(&key, sizeof(key));
+    bool result = raylib_capture_target->is_key_pressed(key);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_key_pressed_repeat(int key) {
+    rl_capture_begin(RL_CALL_IS_KEY_PRESSED_REPEAT);
+    rl_capture_value(&key, sizeof(key));
+    bool result = raylib_capture_target->is_key_pressed_repeat(key);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_key_down(int key) {
+    rl_capture_begin(RL_CALL_IS_KEY_DOWN);
+    rl_capture_value(&key, sizeof(key));
+    bool result = raylib_capture_target->is_key_down(key);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_key_released(int key) {
+    rl_capture_begin(RL_CALL_IS_KEY_RELEASED);
+    rl_capture_value(&key, sizeof(key));
+    bool result = raylib_capture_target->is_key_released(key);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_key_up(int key) {
+    rl_capture_begin(RL_CALL_IS_KEY_UP);
+    rl_capture_value(&key, sizeof(key));
+    bool result = raylib_capture_target->is_key_up(key);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_key_pressed(void) {
+    rl_capture_begin(RL_CALL_GET_KEY_PRESSED);
+    int result = raylib_capture_target->get_key_pressed();
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_char_pressed(void) {
+    rl_capture_begin(RL_CALL_GET_CHAR_PRESSED);
+    int result = raylib_capture_target->get_char_pressed();
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_set_exit_key(int key) {
+    rl_capture_begin(RL_CALL_SET_EXIT_KEY);
+    rl_capture_value(&key, sizeof(key));
+    raylib_capture_target->set_exit_key(key);
+    rl_capture_end();
+}
+
+static bool rl_capture_is_gamepad_available(int gamepad) {
+    rl_capture_begin(RL_CALL_IS_GAMEPAD_AVAILABLE);
+    rl_capture_value(&gamepad, sizeof(gamepad));
+    bool result = raylib_capture_target->is_gamepad_available(gamepad);
+    rl_capture_end();
+    return result;
+}
+
+static const char * rl_capture_get_gamepad_name(int gamepad) {
+    rl_capture_begin(RL_CALL_GET_GAMEPAD_NAME);
+    rl_capture_value(&gamepad, sizeof(gamepad));
+    const char * result = raylib_capture_target->get_gamepad_name(gamepad);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_gamepad_button_pressed(int gamepad, int button) {
+    rl_capture_begin(RL_CALL_IS_GAMEPAD_BUTTON_PRESSED);
+    rl_capture_value(&gamepad, sizeof(gamepad));
+    rl_capture_value(&button, sizeof(button));
+    bool result = raylib_capture_target->is_gamepad_button_pressed(gamepad, button);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_gamepad_button_down(int gamepad, int button) {
+    rl_capture_begin(RL_CALL_IS_GAMEPAD_BUTTON_DOWN);
+    rl_capture_value(&gamepad, sizeof(gamepad));
+    rl_capture_value(&button, sizeof(button));
+    bool result = raylib_capture_target->is_gamepad_button_down(gamepad, button);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_gamepad_button_released(int gamepad, int button) {
+    rl_capture_begin(RL_CALL_IS_GAMEPAD_BUTTON_RELEASED);
+    rl_capture_value(&gamepad, sizeof(gamepad));
+    rl_capture_value(&button, sizeof(button));
+    bool result = raylib_capture_target->is_gamepad_button_released(gamepad, button);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_gamepad_button_up(int gamepad, int button) {
+    rl_capture_begin(RL_CALL_IS_GAMEPAD_BUTTON_UP);
+    rl_capture_value(&gamepad, sizeof(gamepad));
+    rl_capture_value(&button, sizeof(button));
+    bool result = raylib_capture_target->is_gamepad_button_up(gamepad, button);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_gamepad_button_pressed(void) {
+    rl_capture_begin(RL_CALL_GET_GAMEPAD_BUTTON_PRESSED);
+    int result = raylib_capture_target->get_gamepad_button_pressed();
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_gamepad_axis_count(int gamepad) {
+    rl_capture_begin(RL_CALL_GET_GAMEPAD_AXIS_COUNT);
+    rl_capture_value(&gamepad, sizeof(gamepad));
+    int result = raylib_capture_target->get_gamepad_axis_count(gamepad);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_get_gamepad_axis_movement(int gamepad, int axis) {
+    rl_capture_begin(RL_CALL_GET_GAMEPAD_AXIS_MOVEMENT);
+    rl_capture_value(&gamepad, sizeof(gamepad));
+    rl_capture_value(&axis, sizeof(axis));
+    float result = raylib_capture_target->get_gamepad_axis_movement(gamepad, axis);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_set_gamepad_mappings(const char *mappings) {
+    rl_capture_begin(RL_CALL_SET_GAMEPAD_MAPPINGS);
+    rl_capture_string(mappings);
+    int result = raylib_capture_target->set_gamepad_mappings(mappings);
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_set_gamepad_vibration(int gamepad, float leftMotor, float rightMotor, float duration) {
+    rl_capture_begin(RL_CALL_SET_GAMEPAD_VIBRATION);
+    rl_capture_value(&gamepad, sizeof(gamepad));
+    rl_capture_value(&leftMotor, sizeof(leftMotor));
+    rl_capture_value(&rightMotor, sizeof(rightMotor));
+    rl_capture_value(&duration, sizeof(duration));
+    raylib_capture_target->set_gamepad_vibration(gamepad, leftMotor, rightMotor, duration);
+    rl_capture_end();
+}
+
+static bool rl_capture_is_mouse_button_pressed(int button) {
+    rl_capture_begin(RL_CALL_IS_MOUSE_BUTTON_PRESSED);
+    rl_capture_value(&button, sizeof(button));
+    bool result = raylib_capture_target->is_mouse_button_pressed(button);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_mouse_button_down(int button) {
+    rl_capture_begin(RL_CALL_IS_MOUSE_BUTTON_DOWN);
+    rl_capture_value(&button, sizeof(button));
+    bool result = raylib_capture_target->is_mouse_button_down(button);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_mouse_button_released(int button) {
+    rl_capture_begin(RL_CALL_IS_MOUSE_BUTTON_RELEASED);
+    rl_capture_value(&button, sizeof(button));
+    bool result = raylib_capture_target->is_mouse_button_released(button);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_mouse_button_up(int button) {
+    rl_capture_begin(RL_CALL_IS_MOUSE_BUTTON_UP);
+    rl_capture_value(&button, sizeof(button));
+    bool result = raylib_capture_target->is_mouse_button_up(button);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_mouse_x(void) {
+    rl_capture_begin(RL_CALL_GET_MOUSE_X);
+    int result = raylib_capture_target->get_mouse_x();
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_mouse_y(void) {
+    rl_capture_begin(RL_CALL_GET_MOUSE_Y);
+    int result = raylib_capture_target->get_mouse_y();
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_get_mouse_position(void) {
+    rl_capture_begin(RL_CALL_GET_MOUSE_POSITION);
+    Vector2 result = raylib_capture_target->get_mouse_position();
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_get_mouse_delta(void) {
+    rl_capture_begin(RL_CALL_GET_MOUSE_DELTA);
+    Vector2 result = raylib_capture_target->get_mouse_delta();
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_set_mouse_position(int x, int y) {
+    rl_capture_begin(RL_CALL_SET_MOUSE_POSITION);
+    rl_capture_value(&x, sizeof(x));
+    rl_capture_value(&y, sizeof(y));
+    raylib_capture_target->set_mouse_position(x, y);
+    rl_capture_end();
+}
+
+static void rl_capture_set_mouse_offset(int offsetX, int offsetY) {
+    rl_capture_begin(RL_CALL_SET_MOUSE_OFFSET);
+    rl_capture_value(&offsetX, sizeof(offsetX));
+    rl_capture_value(&offsetY, sizeof(offsetY));
+    raylib_capture_target->set_mouse_offset(offsetX, offsetY);
+    rl_capture_end();
+}
+
+static void rl_capture_set_mouse_scale(float scaleX, float scaleY) {
+    rl_capture_begin(RL_CALL_SET_MOUSE_SCALE);
+    rl_capture_value(&scaleX, sizeof(scaleX));
+    rl_capture_value(&scaleY, sizeof(scaleY));
+    raylib_capture_target->set_mouse_scale(scaleX, scaleY);
+    rl_capture_end();
+}
+
+static float rl_capture_get_mouse_wheel_move(void) {
+    rl_capture_begin(RL_CALL_GET_MOUSE_WHEEL_MOVE);
+    float result = raylib_capture_target->get_mouse_wheel_move();
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_get_mouse_wheel_move_v(void) {
+    rl_capture_begin(RL_CALL_GET_MOUSE_WHEEL_MOVE_V);
+    Vector2 result = raylib_capture_target->get_mouse_wheel_move_v();
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_set_mouse_cursor(int cursor) {
+    rl_capture_begin(RL_CALL_SET_MOUSE_CURSOR);
+    rl_capture_value(&cursor, sizeof(cursor));
+    raylib_capture_target->set_mouse_cursor(cursor);
+    rl_capture_end();
+}
+
+static int rl_capture_get_touch_x(void) {
+    rl_capture_begin(RL_CALL_GET_TOUCH_X);
+    int result = raylib_capture_target->get_touch_x();
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_touch_y(void) {
+    rl_capture_begin(RL_CALL_GET_TOUCH_Y);
+    int result = raylib_capture_target->get_touch_y();
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_get_touch_position(int index) {
+    rl_capture_begin(RL_CALL_GET_TOUCH_POSITION);
+    rl_capture_value(&index, sizeof(index));
+    Vector2 result = raylib_capture_target->get_touch_position(index);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_touch_point_id(int index) {
+    rl_capture_begin(RL_CALL_GET_TOUCH_POINT_ID);
+    rl_capture_value(&index, sizeof(index));
+    int result = raylib_capture_target->get_touch_point_id(index);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_touch_point_count(void) {
+    rl_capture_begin(RL_CALL_GET_TOUCH_POINT_COUNT);
+    int result = raylib_capture_target->get_touch_point_count();
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_set_gestures_enabled(unsigned int flags) {
+    rl_capture_begin(RL_CALL_SET_GESTURES_ENABLED);
+    rl_capture_value(&flags, sizeof(flags));
+    raylib_capture_target->set_gestures_enabled(flags);
+    rl_capture_end();
+}
+
+static bool rl_capture_is_gesture_detected(unsigned int gesture) {
+    rl_capture_begin(RL_CALL_IS_GESTURE_DETECTED);
+    rl_capture_value(&gesture, sizeof(gesture));
+    bool result = raylib_capture_target->is_gesture_detected(gesture);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_gesture_detected(void) {
+    rl_capture_begin(RL_CALL_GET_GESTURE_DETECTED);
+    int result = raylib_capture_target->get_gesture_detected();
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_get_gesture_hold_duration(void) {
+    rl_capture_begin(RL_CALL_GET_GESTURE_HOLD_DURATION);
+    float result = raylib_capture_target->get_gesture_hold_duration();
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_get_gesture_drag_vector(void) {
+    rl_capture_begin(RL_CALL_GET_GESTURE_DRAG_VECTOR);
+    Vector2 result = raylib_capture_target->get_gesture_drag_vector();
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_get_gesture_drag_angle(void) {
+    rl_capture_begin(RL_CALL_GET_GESTURE_DRAG_ANGLE);
+    float result = raylib_capture_target->get_gesture_drag_angle();
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_get_gesture_pinch_vector(void) {
+    rl_capture_begin(RL_CALL_GET_GESTURE_PINCH_VECTOR);
+    Vector2 result = raylib_capture_target->get_gesture_pinch_vector();
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_get_gesture_pinch_angle(void) {
+    rl_capture_begin(RL_CALL_GET_GESTURE_PINCH_ANGLE);
+    float result = raylib_capture_target->get_gesture_pinch_angle();
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_update_camera(Camera *camera, int mode) {
+    rl_capture_unsupported(RL_CALL_UPDATE_CAMERA);
+    raylib_capture_target->update_camera(camera, mode);
+}
+
+static void rl_capture_update_camera_pro(Camera *camera, Vector3 movement, Vector3 rotation, float zoom) {
+    rl_capture_unsupported(RL_CALL_UPDATE_CAMERA_PRO);
+    raylib_capture_target->update_camera_pro(camera, movement, rotation, zoom);
+}
+
+static void rl_capture_set_shapes_texture(Texture2D texture, Rectangle source) {
+    rl_capture_begin(RL_CALL_SET_SHAPES_TEXTURE);
+    rl_capture_texture(texture);
+    rl_capture_value(&source, sizeof(source));
+    raylib_capture_target->set_shapes_texture(texture, source);
+    rl_capture_end();
+}
+
+static Texture2D rl_capture_get_shapes_texture(void) {
+    rl_capture_begin(RL_CALL_GET_SHAPES_TEXTURE);
+    Texture2D result = raylib_capture_target->get_shapes_texture();
+    rl_capture_result_texture(result);
+    rl_capture_end();
+    return result;
+}
+
+static Rectangle rl_capture_get_shapes_texture_rectangle(void) {
+    rl_capture_begin(RL_CALL_GET_SHAPES_TEXTURE_RECTANGLE);
+    Rectangle result = raylib_capture_target->get_shapes_texture_rectangle();
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_draw_pixel(int posX, int posY, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_PIXEL);
+    rl_capture_value(&posX, sizeof(posX));
+    rl_capture_value(&posY, sizeof(posY));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_pixel(posX, posY, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_pixel_v(Vector2 position, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_PIXEL_V);
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_pixel_v(position, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_line(int startPosX, int startPosY, int endPosX, int endPosY, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_LINE);
+    rl_capture_value(&startPosX, sizeof(startPosX));
+    rl_capture_value(&startPosY, sizeof(startPosY));
+    rl_capture_value(&endPosX, sizeof(endPosX));
+    rl_capture_value(&endPosY, sizeof(endPosY));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_line(startPosX, startPosY, endPosX, endPosY, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_line_v(Vector2 startPos, Vector2 endPos, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_LINE_V);
+    rl_capture_value(&startPos, sizeof(startPos));
+    rl_capture_value(&endPos, sizeof(endPos));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_line_v(startPos, endPos, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_line_ex(Vector2 startPos, Vector2 endPos, float thick, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_LINE_EX);
+    rl_capture_value(&startPos, sizeof(startPos));
+    rl_capture_value(&endPos, sizeof(endPos));
+    rl_capture_value(&thick, sizeof(thick));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_line_ex(startPos, endPos, thick, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_line_strip(const Vector2 *points, int pointCount, Color color) {
+    rl_capture_unsupported(RL_CALL_DRAW_LINE_STRIP);
+    raylib_capture_target->draw_line_strip(points, pointCount, color);
+}
+
+static void rl_capture_draw_line_bezier(Vector2 startPos, Vector2 endPos, float thick, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_LINE_BEZIER);
+    rl_capture_value(&startPos, sizeof(startPos));
+    rl_capture_value(&endPos, sizeof(endPos));
+    rl_capture_value(&thick, sizeof(thick));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_line_bezier(startPos, endPos, thick, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_circle(int centerX, int centerY, float radius, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_CIRCLE);
+    rl_capture_value(&centerX, sizeof(centerX));
+    rl_capture_value(&centerY, sizeof(centerY));
+    rl_capture_value(&radius, sizeof(radius));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_circle(centerX, centerY, radius, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_circle_sector(Vector2 center, float radius, float startAngle, float endAngle, int segments, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_CIRCLE_SECTOR);
+    rl_capture_value(&center, sizeof(center));
+    rl_capture_value(&radius, sizeof(radius));
+    rl_capture_value(&startAngle, sizeof(startAngle));
+    rl_capture_value(&endAngle, sizeof(endAngle));
+    rl_capture_value(&segments, sizeof(segments));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_circle_sector(center, radius, startAngle, endAngle, segments, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_circle_sector_lines(Vector2 center, float radius, float startAngle, float endAngle, int segments, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_CIRCLE_SECTOR_LINES);
+    rl_capture_value(&center, sizeof(center));
+    rl_capture_value(&radius, sizeof(radius));
+    rl_capture_value(&startAngle, sizeof(startAngle));
+    rl_capture_value(&endAngle, sizeof(endAngle));
+    rl_capture_value(&segments, sizeof(segments));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_circle_sector_lines(center, radius, startAngle, endAngle, segments, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_circle_gradient(int centerX, int centerY, float radius, Color inner, Color outer) {
+    rl_capture_begin(RL_CALL_DRAW_CIRCLE_GRADIENT);
+    rl_capture_value(&centerX, sizeof(centerX));
+    rl_capture_value(&centerY, sizeof(centerY));
+    rl_capture_value(&radius, sizeof(radius));
+    rl_capture_value(&inner, sizeof(inner));
+    rl_capture_value(&outer, sizeof(outer));
+    raylib_capture_target->draw_circle_gradient(centerX, centerY, radius, inner, outer);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_circle_v(Vector2 center, float radius, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_CIRCLE_V);
+    rl_capture_value(&center, sizeof(center));
+    rl_capture_value(&radius, sizeof(radius));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_circle_v(center, radius, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_circle_lines(int centerX, int centerY, float radius, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_CIRCLE_LINES);
+    rl_capture_value(&centerX, sizeof(centerX));
+    rl_capture_value(&centerY, sizeof(centerY));
+    rl_capture_value(&radius, sizeof(radius));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_circle_lines(centerX, centerY, radius, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_circle_lines_v(Vector2 center, float radius, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_CIRCLE_LINES_V);
+    rl_capture_value(&center, sizeof(center));
+    rl_capture_value(&radius, sizeof(radius));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_circle_lines_v(center, radius, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_ellipse(int centerX, int centerY, float radiusH, float radiusV, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_ELLIPSE);
+    rl_capture_value(&centerX, sizeof(centerX));
+    rl_capture_value(&centerY, sizeof(centerY));
+    rl_capture_value(&radiusH, sizeof(radiusH));
+    rl_capture_value(&radiusV, sizeof(radiusV));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_ellipse(centerX, centerY, radiusH, radiusV, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_ellipse_lines(int centerX, int centerY, float radiusH, float radiusV, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_ELLIPSE_LINES);
+    rl_capture_value(&centerX, sizeof(centerX));
+    rl_capture_value(&centerY, sizeof(centerY));
+    rl_capture_value(&radiusH, sizeof(radiusH));
+    rl_capture_value(&radiusV, sizeof(radiusV));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_ellipse_lines(centerX, centerY, radiusH, radiusV, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_ring(Vector2 center, float innerRadius, float outerRadius, float startAngle, float endAngle, int segments, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_RING);
+    rl_capture_value(&center, sizeof(center));
+    rl_capture_value(&innerRadius, sizeof(innerRadius));
+    rl_capture_value(&outerRadius, sizeof(outerRadius));
+    rl_capture_value(&startAngle, sizeof(startAngle));
+    rl_capture_value(&endAngle, sizeof(endAngle));
+    rl_capture_value(&segments, sizeof(segments));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_ring(center, innerRadius, outerRadius, startAngle, endAngle, segments, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_ring_lines(Vector2 center, float innerRadius, float outerRadius, float startAngle, float endAngle, int segments, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_RING_LINES);
+    rl_capture_value(&center, sizeof(center));
+    rl_capture_value(&innerRadius, sizeof(innerRadius));
+    rl_capture_value(&outerRadius, sizeof(outerRadius));
+    rl_capture_value(&startAngle, sizeof(startAngle));
+    rl_capture_value(&endAngle, sizeof(endAngle));
+    rl_capture_value(&segments, sizeof(segments));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_ring_lines(center, innerRadius, outerRadius, startAngle, endAngle, segments, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_rectangle(int posX, int posY, int width, int height, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_RECTANGLE);
+    rl_capture_value(&posX, sizeof(posX));
+    rl_capture_value(&posY, sizeof(posY));
+    rl_capture_value(&width, sizeof(width));
+    rl_capture_value(&height, sizeof(height));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_rectangle(posX, posY, width, height, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_rectangle_v(Vector2 position, Vector2 size, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_RECTANGLE_V);
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&size, sizeof(size));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_rectangle_v(position, size, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_rectangle_rec(Rectangle rec, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_RECTANGLE_REC);
+    rl_capture_value(&rec, sizeof(rec));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_rectangle_rec(rec, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_rectangle_pro(Rectangle rec, Vector2 origin, float rotation, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_RECTANGLE_PRO);
+    rl_capture_value(&rec, sizeof(rec));
+    rl_capture_value(&origin, sizeof(origin));
+    rl_capture_value(&rotation, sizeof(rotation));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_rectangle_pro(rec, origin, rotation, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_rectangle_gradient_v(int posX, int posY, int width, int height, Color top, Color bottom) {
+    rl_capture_begin(RL_CALL_DRAW_RECTANGLE_GRADIENT_V);
+    rl_capture_value(&posX, sizeof(posX));
+    rl_capture_value(&posY, sizeof(posY));
+    rl_capture_value(&width, sizeof(width));
+    rl_capture_value(&height, sizeof(height));
+    rl_capture_value(&top, sizeof(top));
+    rl_capture_value(&bottom, sizeof(bottom));
+    raylib_capture_target->draw_rectangle_gradient_v(posX, posY, width, height, top, bottom);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_rectangle_gradient_h(int posX, int posY, int width, int height, Color left, Color right) {
+    rl_capture_begin(RL_CALL_DRAW_RECTANGLE_GRADIENT_H);
+    rl_capture_value(&posX, sizeof(posX));
+    rl_capture_value(&posY, sizeof(posY));
+    rl_capture_value(&width, sizeof(width));
+    rl_capture_value(&height, sizeof(height));
+    rl_capture_value(&left, sizeof(left));
+    rl_capture_value(&right, sizeof(right));
+    raylib_capture_target->draw_rectangle_gradient_h(posX, posY, width, height, left, right);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_rectangle_gradient_ex(Rectangle rec, Color topLeft, Color bottomLeft, Color topRight, Color bottomRight) {
+    rl_capture_begin(RL_CALL_DRAW_RECTANGLE_GRADIENT_EX);
+    rl_capture_value(&rec, sizeof(rec));
+    rl_capture_value(&topLeft, sizeof(topLeft));
+    rl_capture_value(&bottomLeft, sizeof(bottomLeft));
+    rl_capture_value(&topRight, sizeof(topRight));
+    rl_capture_value(&bottomRight, sizeof(bottomRight));
+    raylib_capture_target->draw_rectangle_gradient_ex(rec, topLeft, bottomLeft, topRight, bottomRight);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_rectangle_lines(int posX, int posY, int width, int height, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_RECTANGLE_LINES);
+    rl_capture_value(&posX, sizeof(posX));
+    rl_capture_value(&posY, sizeof(posY));
+    rl_capture_value(&width, sizeof(width));
+    rl_capture_value(&height, sizeof(height));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_rectangle_lines(posX, posY, width, height, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_rectangle_lines_ex(Rectangle rec, float lineThick, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_RECTANGLE_LINES_EX);
+    rl_capture_value(&rec, sizeof(rec));
+    rl_capture_value(&lineThick, sizeof(lineThick));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_rectangle_lines_ex(rec, lineThick, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_rectangle_rounded(Rectangle rec, float roundness, int segments, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_RECTANGLE_ROUNDED);
+    rl_capture_value(&rec, sizeof(rec));
+    rl_capture_value(&roundness, sizeof(roundness));
+    rl_capture_value(&segments, sizeof(segments));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_rectangle_rounded(rec, roundness, segments, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_rectangle_rounded_lines(Rectangle rec, float roundness, int segments, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_RECTANGLE_ROUNDED_LINES);
+    rl_capture_value(&rec, sizeof(rec));
+    rl_capture_value(&roundness, sizeof(roundness));
+    rl_capture_value(&segments, sizeof(segments));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_rectangle_rounded_lines(rec, roundness, segments, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_rectangle_rounded_lines_ex(Rectangle rec, float roundness, int segments, float lineThick, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_RECTANGLE_ROUNDED_LINES_EX);
+    rl_capture_value(&rec, sizeof(rec));
+    rl_capture_value(&roundness, sizeof(roundness));
+    rl_capture_value(&segments, sizeof(segments));
+    rl_capture_value(&lineThick, sizeof(lineThick));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_rectangle_rounded_lines_ex(rec, roundness, segments, lineThick, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_triangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_TRIANGLE);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    rl_capture_value(&v3, sizeof(v3));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_triangle(v1, v2, v3, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_triangle_lines(Vector2 v1, Vector2 v2, Vector2 v3, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_TRIANGLE_LINES);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    rl_capture_value(&v3, sizeof(v3));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_triangle_lines(v1, v2, v3, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_triangle_fan(const Vector2 *points, int pointCount, Color color) {
+    rl_capture_unsupported(RL_CALL_DRAW_TRIANGLE_FAN);
+    raylib_capture_target->draw_triangle_fan(points, pointCount, color);
+}
+
+static void rl_capture_draw_triangle_strip(const Vector2 *points, int pointCount, Color color) {
+    rl_capture_unsupported(RL_CALL_DRAW_TRIANGLE_STRIP);
+    raylib_capture_target->draw_triangle_strip(points, pointCount, color);
+}
+
+static void rl_capture_draw_poly(Vector2 center, int sides, float radius, float rotation, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_POLY);
+    rl_capture_value(&center, sizeof(center));
+    rl_capture_value(&sides, sizeof(sides));
+    rl_capture_value(&radius, sizeof(radius));
+    rl_capture_value(&rotation, sizeof(rotation));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_poly(center, sides, radius, rotation, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_poly_lines(Vector2 center, int sides, float radius, float rotation, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_POLY_LINES);
+    rl_capture_value(&center, sizeof(center));
+    rl_capture_value(&sides, sizeof(sides));
+    rl_capture_value(&radius, sizeof(radius));
+    rl_capture_value(&rotation, sizeof(rotation));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_poly_lines(center, sides, radius, rotation, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_poly_lines_ex(Vector2 center, int sides, float radius, float rotation, float lineThick, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_POLY_LINES_EX);
+    rl_capture_value(&center, sizeof(center));
+    rl_capture_value(&sides, sizeof(sides));
+    rl_capture_value(&radius, sizeof(radius));
+    rl_capture_value(&rotation, sizeof(rotation));
+    rl_capture_value(&lineThick, sizeof(lineThick));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_poly_lines_ex(center, sides, radius, rotation, lineThick, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_spline_linear(const Vector2 *points, int pointCount, float thick, Color color) {
+    rl_capture_unsupported(RL_CALL_DRAW_SPLINE_LINEAR);
+    raylib_capture_target->draw_spline_linear(points, pointCount, thick, color);
+}
+
+static void rl_capture_draw_spline_basis(const Vector2 *points, int pointCount, float thick, Color color) {
+    rl_capture_unsupported(RL_CALL_DRAW_SPLINE_BASIS);
+    raylib_capture_target->draw_spline_basis(points, pointCount, thick, color);
+}
+
+static void rl_capture_draw_spline_catmull_rom(const Vector2 *points, int pointCount, float thick, Color color) {
+    rl_capture_unsupported(RL_CALL_DRAW_SPLINE_CATMULL_ROM);
+    raylib_capture_target->draw_spline_catmull_rom(points, pointCount, thick, color);
+}
+
+static void rl_capture_draw_spline_bezier_quadratic(const Vector2 *points, int pointCount, float thick, Color color) {
+    rl_capture_unsupported(RL_CALL_DRAW_SPLINE_BEZIER_QUADRATIC);
+    raylib_capture_target->draw_spline_bezier_quadratic(points, pointCount, thick, color);
+}
+
+static void rl_capture_draw_spline_bezier_cubic(const Vector2 *points, int pointCount, float thick, Color color) {
+    rl_capture_unsupported(RL_CALL_DRAW_SPLINE_BEZIER_CUBIC);
+    raylib_capture_target->draw_spline_bezier_cubic(points, pointCount, thick, color);
+}
+
+static void rl_capture_draw_spline_segment_linear(Vector2 p1, Vector2 p2, float thick, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_SPLINE_SEGMENT_LINEAR);
+    rl_capture_value(&p1, sizeof(p1));
+    rl_capture_value(&p2, sizeof(p2));
+    rl_capture_value(&thick, sizeof(thick));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_spline_segment_linear(p1, p2, thick, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_spline_segment_basis(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float thick, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_SPLINE_SEGMENT_BASIS);
+    rl_capture_value(&p1, sizeof(p1));
+    rl_capture_value(&p2, sizeof(p2));
+    rl_capture_value(&p3, sizeof(p3));
+    rl_capture_value(&p4, sizeof(p4));
+    rl_capture_value(&thick, sizeof(thick));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_spline_segment_basis(p1, p2, p3, p4, thick, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_spline_segment_catmull_rom(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float thick, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_SPLINE_SEGMENT_CATMULL_ROM);
+    rl_capture_value(&p1, sizeof(p1));
+    rl_capture_value(&p2, sizeof(p2));
+    rl_capture_value(&p3, sizeof(p3));
+    rl_capture_value(&p4, sizeof(p4));
+    rl_capture_value(&thick, sizeof(thick));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_spline_segment_catmull_rom(p1, p2, p3, p4, thick, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_spline_segment_bezier_quadratic(Vector2 p1, Vector2 c2, Vector2 p3, float thick, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_SPLINE_SEGMENT_BEZIER_QUADRATIC);
+    rl_capture_value(&p1, sizeof(p1));
+    rl_capture_value(&c2, sizeof(c2));
+    rl_capture_value(&p3, sizeof(p3));
+    rl_capture_value(&thick, sizeof(thick));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_spline_segment_bezier_quadratic(p1, c2, p3, thick, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_spline_segment_bezier_cubic(Vector2 p1, Vector2 c2, Vector2 c3, Vector2 p4, float thick, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_SPLINE_SEGMENT_BEZIER_CUBIC);
+    rl_capture_value(&p1, sizeof(p1));
+    rl_capture_value(&c2, sizeof(c2));
+    rl_capture_value(&c3, sizeof(c3));
+    rl_capture_value(&p4, sizeof(p4));
+    rl_capture_value(&thick, sizeof(thick));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_spline_segment_bezier_cubic(p1, c2, c3, p4, thick, color);
+    rl_capture_end();
+}
+
+static Vector2 rl_capture_get_spline_point_linear(Vector2 startPos, Vector2 endPos, float t) {
+    rl_capture_begin(RL_CALL_GET_SPLINE_POINT_LINEAR);
+    rl_capture_value(&startPos, sizeof(startPos));
+    rl_capture_value(&endPos, sizeof(endPos));
+    rl_capture_value(&t, sizeof(t));
+    Vector2 result = raylib_capture_target->get_spline_point_linear(startPos, endPos, t);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_get_spline_point_basis(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float t) {
+    rl_capture_begin(RL_CALL_GET_SPLINE_POINT_BASIS);
+    rl_capture_value(&p1, sizeof(p1));
+    rl_capture_value(&p2, sizeof(p2));
+    rl_capture_value(&p3, sizeof(p3));
+    rl_capture_value(&p4, sizeof(p4));
+    rl_capture_value(&t, sizeof(t));
+    Vector2 result = raylib_capture_target->get_spline_point_basis(p1, p2, p3, p4, t);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_get_spline_point_catmull_rom(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float t) {
+    rl_capture_begin(RL_CALL_GET_SPLINE_POINT_CATMULL_ROM);
+    rl_capture_value(&p1, sizeof(p1));
+    rl_capture_value(&p2, sizeof(p2));
+    rl_capture_value(&p3, sizeof(p3));
+    rl_capture_value(&p4, sizeof(p4));
+    rl_capture_value(&t, sizeof(t));
+    Vector2 result = raylib_capture_target->get_spline_point_catmull_rom(p1, p2, p3, p4, t);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_get_spline_point_bezier_quad(Vector2 p1, Vector2 c2, Vector2 p3, float t) {
+    rl_capture_begin(RL_CALL_GET_SPLINE_POINT_BEZIER_QUAD);
+    rl_capture_value(&p1, sizeof(p1));
+    rl_capture_value(&c2, sizeof(c2));
+    rl_capture_value(&p3, sizeof(p3));
+    rl_capture_value(&t, sizeof(t));
+    Vector2 result = raylib_capture_target->get_spline_point_bezier_quad(p1, c2, p3, t);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_get_spline_point_bezier_cubic(Vector2 p1, Vector2 c2, Vector2 c3, Vector2 p4, float t) {
+    rl_capture_begin(RL_CALL_GET_SPLINE_POINT_BEZIER_CUBIC);
+    rl_capture_value(&p1, sizeof(p1));
+    rl_capture_value(&c2, sizeof(c2));
+    rl_capture_value(&c3, sizeof(c3));
+    rl_capture_value(&p4, sizeof(p4));
+    rl_capture_value(&t, sizeof(t));
+    Vector2 result = raylib_capture_target->get_spline_point_bezier_cubic(p1, c2, c3, p4, t);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_check_collision_recs(Rectangle rec1, Rectangle rec2) {
+    rl_capture_begin(RL_CALL_CHECK_COLLISION_RECS);
+    rl_capture_value(&rec1, sizeof(rec1));
+    rl_capture_value(&rec2, sizeof(rec2));
+    bool result = raylib_capture_target->check_collision_recs(rec1, rec2);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_check_collision_circles(Vector2 center1, float radius1, Vector2 center2, float radius2) {
+    rl_capture_begin(RL_CALL_CHECK_COLLISION_CIRCLES);
+    rl_capture_value(&center1, sizeof(center1));
+    rl_capture_value(&radius1, sizeof(radius1));
+    rl_capture_value(&center2, sizeof(center2));
+    rl_capture_value(&radius2, sizeof(radius2));
+    bool result = raylib_capture_target->check_collision_circles(center1, radius1, center2, radius2);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_check_collision_circle_rec(Vector2 center, float radius, Rectangle rec) {
+    rl_capture_begin(RL_CALL_CHECK_COLLISION_CIRCLE_REC);
+    rl_capture_value(&center, sizeof(center));
+    rl_capture_value(&radius, sizeof(radius));
+    rl_capture_value(&rec, sizeof(rec));
+    bool result = raylib_capture_target->check_collision_circle_rec(center, radius, rec);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_check_collision_circle_line(Vector2 center, float radius, Vector2 p1, Vector2 p2) {
+    rl_capture_begin(RL_CALL_CHECK_COLLISION_CIRCLE_LINE);
+    rl_capture_value(&center, sizeof(center));
+    rl_capture_value(&radius, sizeof(radius));
+    rl_capture_value(&p1, sizeof(p1));
+    rl_capture_value(&p2, sizeof(p2));
+    bool result = raylib_capture_target->check_collision_circle_line(center, radius, p1, p2);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_check_collision_point_rec(Vector2 point, Rectangle rec) {
+    rl_capture_begin(RL_CALL_CHECK_COLLISION_POINT_REC);
+    rl_capture_value(&point, sizeof(point));
+    rl_capture_value(&rec, sizeof(rec));
+    bool result = raylib_capture_target->check_collision_point_rec(point, rec);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_check_collision_point_circle(Vector2 point, Vector2 center, float radius) {
+    rl_capture_begin(RL_CALL_CHECK_COLLISION_POINT_CIRCLE);
+    rl_capture_value(&point, sizeof(point));
+    rl_capture_value(&center, sizeof(center));
+    rl_capture_value(&radius, sizeof(radius));
+    bool result = raylib_capture_target->check_collision_point_circle(point, center, radius);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_check_collision_point_triangle(Vector2 point, Vector2 p1, Vector2 p2, Vector2 p3) {
+    rl_capture_begin(RL_CALL_CHECK_COLLISION_POINT_TRIANGLE);
+    rl_capture_value(&point, sizeof(point));
+    rl_capture_value(&p1, sizeof(p1));
+    rl_capture_value(&p2, sizeof(p2));
+    rl_capture_value(&p3, sizeof(p3));
+    bool result = raylib_capture_target->check_collision_point_triangle(point, p1, p2, p3);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_check_collision_point_line(Vector2 point, Vector2 p1, Vector2 p2, int threshold) {
+    rl_capture_begin(RL_CALL_CHECK_COLLISION_POINT_LINE);
+    rl_capture_value(&point, sizeof(point));
+    rl_capture_value(&p1, sizeof(p1));
+    rl_capture_value(&p2, sizeof(p2));
+    rl_capture_value(&threshold, sizeof(threshold));
+    bool result = raylib_capture_target->check_collision_point_line(point, p1, p2, threshold);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_check_collision_point_poly(Vector2 point, const Vector2 *points, int pointCount) {
+    rl_capture_unsupported(RL_CALL_CHECK_COLLISION_POINT_POLY);
+    return raylib_capture_target->check_collision_point_poly(point, points, pointCount);
+}
+
+static bool rl_capture_check_collision_lines(Vector2 startPos1, Vector2 endPos1, Vector2 startPos2, Vector2 endPos2, Vector2 *collisionPoint) {
+    rl_capture_unsupported(RL_CALL_CHECK_COLLISION_LINES);
+    return raylib_capture_target->check_collision_lines(startPos1, endPos1, startPos2, endPos2, collisionPoint);
+}
+
+static Rectangle rl_capture_get_collision_rec(Rectangle rec1, Rectangle rec2) {
+    rl_capture_begin(RL_CALL_GET_COLLISION_REC);
+    rl_capture_value(&rec1, sizeof(rec1));
+    rl_capture_value(&rec2, sizeof(rec2));
+    Rectangle result = raylib_capture_target->get_collision_rec(rec1, rec2);
+    rl_capture_end();
+    return result;
+}
+
+static Image rl_capture_load_image(const char *fileName) {
+    rl_capture_unsupported(RL_CALL_LOAD_IMAGE);
+    return raylib_capture_target->load_image(fileName);
+}
+
+static Image rl_capture_load_image_raw(const char *fileName, int width, int height, int format, int headerSize) {
+    rl_capture_unsupported(RL_CALL_LOAD_IMAGE_RAW);
+    return raylib_capture_target->load_image_raw(fileName, width, height, format, headerSize);
+}
+
+static Image rl_capture_load_image_anim(const char *fileName, int *frames) {
+    rl_capture_unsupported(RL_CALL_LOAD_IMAGE_ANIM);
+    return raylib_capture_target->load_image_anim(fileName, frames);
+}
+
+static Image rl_capture_load_image_anim_from_memory(const char *fileType, const unsigned char *fileData, int dataSize, int *frames) {
+    rl_capture_unsupported(RL_CALL_LOAD_IMAGE_ANIM_FROM_MEMORY);
+    return raylib_capture_target->load_image_anim_from_memory(fileType, fileData, dataSize, frames);
+}
+
+static Image rl_capture_load_image_from_memory(const char *fileType, const unsigned char *fileData, int dataSize) {
+    rl_capture_unsupported(RL_CALL_LOAD_IMAGE_FROM_MEMORY);
+    return raylib_capture_target->load_image_from_memory(fileType, fileData, dataSize);
+}
+
+static Image rl_capture_load_image_from_texture(Texture2D texture) {
+    rl_capture_unsupported(RL_CALL_LOAD_IMAGE_FROM_TEXTURE);
+    return raylib_capture_target->load_image_from_texture(texture);
+}
+
+static Image rl_capture_load_image_from_screen(void) {
+    rl_capture_unsupported(RL_CALL_LOAD_IMAGE_FROM_SCREEN);
+    return raylib_capture_target->load_image_from_screen();
+}
+
+static bool rl_capture_is_image_valid(Image image) {
+    rl_capture_unsupported(RL_CALL_IS_IMAGE_VALID);
+    return raylib_capture_target->is_image_valid(image);
+}
+
+static void rl_capture_unload_image(Image image) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_IMAGE);
+    raylib_capture_target->unload_image(image);
+}
+
+static bool rl_capture_export_image(Image image, const char *fileName) {
+    rl_capture_unsupported(RL_CALL_EXPORT_IMAGE);
+    return raylib_capture_target->export_image(image, fileName);
+}
+
+static unsigned char * rl_capture_export_image_to_memory(Image image, const char *fileType, int *fileSize) {
+    rl_capture_unsupported(RL_CALL_EXPORT_IMAGE_TO_MEMORY);
+    return raylib_capture_target->export_image_to_memory(image, fileType, fileSize);
+}
+
+static bool rl_capture_export_image_as_code(Image image, const char *fileName) {
+    rl_capture_unsupported(RL_CALL_EXPORT_IMAGE_AS_CODE);
+    return raylib_capture_target->export_image_as_code(image, fileName);
+}
+
+static Image rl_capture_gen_image_color(int width, int height, Color color) {
+    rl_capture_unsupported(RL_CALL_GEN_IMAGE_COLOR);
+    return raylib_capture_target->gen_image_color(width, height, color);
+}
+
+static Image rl_capture_gen_image_gradient_linear(int width, int height, int direction, Color start, Color end) {
+    rl_capture_unsupported(RL_CALL_GEN_IMAGE_GRADIENT_LINEAR);
+    return raylib_capture_target->gen_image_gradient_linear(width, height, direction, start, end);
+}
+
+static Image rl_capture_gen_image_gradient_radial(int width, int height, float density, Color inner, Color outer) {
+    rl_capture_unsupported(RL_CALL_GEN_IMAGE_GRADIENT_RADIAL);
+    return raylib_capture_target->gen_image_gradient_radial(width, height, density, inner, outer);
+}
+
+static Image rl_capture_gen_image_gradient_square(int width, int height, float density, Color inner, Color outer) {
+    rl_capture_unsupported(RL_CALL_GEN_IMAGE_GRADIENT_SQUARE);
+    return raylib_capture_target->gen_image_gradient_square(width, height, density, inner, outer);
+}
+
+static Image rl_capture_gen_image_checked(int width, int height, int checksX, int checksY, Color col1, Color col2) {
+    rl_capture_unsupported(RL_CALL_GEN_IMAGE_CHECKED);
+    return raylib_capture_target->gen_image_checked(width, height, checksX, checksY, col1, col2);
+}
+
+static Image rl_capture_gen_image_white_noise(int width, int height, float factor) {
+    rl_capture_unsupported(RL_CALL_GEN_IMAGE_WHITE_NOISE);
+    return raylib_capture_target->gen_image_white_noise(width, height, factor);
+}
+
+static Image rl_capture_gen_image_perlin_noise(int width, int height, int offsetX, int offsetY, float scale) {
+    rl_capture_unsupported(RL_CALL_GEN_IMAGE_PERLIN_NOISE);
+    return raylib_capture_target->gen_image_perlin_noise(width, height, offsetX, offsetY, scale);
+}
+
+static Image rl_capture_gen_image_cellular(int width, int height, int tileSize) {
+    rl_capture_unsupported(RL_CALL_GEN_IMAGE_CELLULAR);
+    return raylib_capture_target->gen_image_cellular(width, height, tileSize);
+}
+
+static Image rl_capture_gen_image_text(int width, int height, const char *text) {
+    rl_capture_unsupported(RL_CALL_GEN_IMAGE_TEXT);
+    return raylib_capture_target->gen_image_text(width, height, text);
+}
+
+static Image rl_capture_image_copy(Image image) {
+    rl_capture_unsupported(RL_CALL_IMAGE_COPY);
+    return raylib_capture_target->image_copy(image);
+}
+
+static Image rl_capture_image_from_image(Image image, Rectangle rec) {
+    rl_capture_unsupported(RL_CALL_IMAGE_FROM_IMAGE);
+    return raylib_capture_target->image_from_image(image, rec);
+}
+
+static Image rl_capture_image_from_channel(Image image, int selectedChannel) {
+    rl_capture_unsupported(RL_CALL_IMAGE_FROM_CHANNEL);
+    return raylib_capture_target->image_from_channel(image, selectedChannel);
+}
+
+static Image rl_capture_image_text(const char *text, int fontSize, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_TEXT);
+    return raylib_capture_target->image_text(text, fontSize, color);
+}
+
+static Image rl_capture_image_text_ex(Font font, const char *text, float fontSize, float spacing, Color tint) {
+    rl_capture_unsupported(RL_CALL_IMAGE_TEXT_EX);
+    return raylib_capture_target->image_text_ex(font, text, fontSize, spacing, tint);
+}
+
+static void rl_capture_image_format(Image *image, int newFormat) {
+    rl_capture_unsupported(RL_CALL_IMAGE_FORMAT);
+    raylib_capture_target->image_format(image, newFormat);
+}
+
+static void rl_capture_image_to_pot(Image *image, Color fill) {
+    rl_capture_unsupported(RL_CALL_IMAGE_TO_POT);
+    raylib_capture_target->image_to_pot(image, fill);
+}
+
+static void rl_capture_image_crop(Image *image, Rectangle crop) {
+    rl_capture_unsupported(RL_CALL_IMAGE_CROP);
+    raylib_capture_target->image_crop(image, crop);
+}
+
+static void rl_capture_image_alpha_crop(Image *image, float threshold) {
+    rl_capture_unsupported(RL_CALL_IMAGE_ALPHA_CROP);
+    raylib_capture_target->image_alpha_crop(image, threshold);
+}
+
+static void rl_capture_image_alpha_clear(Image *image, Color color, float threshold) {
+    rl_capture_unsupported(RL_CALL_IMAGE_ALPHA_CLEAR);
+    raylib_capture_target->image_alpha_clear(image, color, threshold);
+}
+
+static void rl_capture_image_alpha_mask(Image *image, Image alphaMask) {
+    rl_capture_unsupported(RL_CALL_IMAGE_ALPHA_MASK);
+    raylib_capture_target->image_alpha_mask(image, alphaMask);
+}
+
+static void rl_capture_image_alpha_premultiply(Image *image) {
+    rl_capture_unsupported(RL_CALL_IMAGE_ALPHA_PREMULTIPLY);
+    raylib_capture_target->image_alpha_premultiply(image);
+}
+
+static void rl_capture_image_blur_gaussian(Image *image, int blurSize) {
+    rl_capture_unsupported(RL_CALL_IMAGE_BLUR_GAUSSIAN);
+    raylib_capture_target->image_blur_gaussian(image, blurSize);
+}
+
+static void rl_capture_image_kernel_convolution(Image *image, const float *kernel, int kernelSize) {
+    rl_capture_unsupported(RL_CALL_IMAGE_KERNEL_CONVOLUTION);
+    raylib_capture_target->image_kernel_convolution(image, kernel, kernelSize);
+}
+
+static void rl_capture_image_resize(Image *image, int newWidth, int newHeight) {
+    rl_capture_unsupported(RL_CALL_IMAGE_RESIZE);
+    raylib_capture_target->image_resize(image, newWidth, newHeight);
+}
+
+static void rl_capture_image_resize_nn(Image *image, int newWidth, int newHeight) {
+    rl_capture_unsupported(RL_CALL_IMAGE_RESIZE_NN);
+    raylib_capture_target->image_resize_nn(image, newWidth, newHeight);
+}
+
+static void rl_capture_image_resize_canvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill) {
+    rl_capture_unsupported(RL_CALL_IMAGE_RESIZE_CANVAS);
+    raylib_capture_target->image_resize_canvas(image, newWidth, newHeight, offsetX, offsetY, fill);
+}
+
+static void rl_capture_image_mipmaps(Image *image) {
+    rl_capture_unsupported(RL_CALL_IMAGE_MIPMAPS);
+    raylib_capture_target->image_mipmaps(image);
+}
+
+static void rl_capture_image_dither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DITHER);
+    raylib_capture_target->image_dither(image, rBpp, gBpp, bBpp, aBpp);
+}
+
+static void rl_capture_image_flip_vertical(Image *image) {
+    rl_capture_unsupported(RL_CALL_IMAGE_FLIP_VERTICAL);
+    raylib_capture_target->image_flip_vertical(image);
+}
+
+static void rl_capture_image_flip_horizontal(Image *image) {
+    rl_capture_unsupported(RL_CALL_IMAGE_FLIP_HORIZONTAL);
+    raylib_capture_target->image_flip_horizontal(image);
+}
+
+static void rl_capture_image_rotate(Image *image, int degrees) {
+    rl_capture_unsupported(RL_CALL_IMAGE_ROTATE);
+    raylib_capture_target->image_rotate(image, degrees);
+}
+
+static void rl_capture_image_rotate_cw(Image *image) {
+    rl_capture_unsupported(RL_CALL_IMAGE_ROTATE_CW);
+    raylib_capture_target->image_rotate_cw(image);
+}
+
+static void rl_capture_image_rotate_ccw(Image *image) {
+    rl_capture_unsupported(RL_CALL_IMAGE_ROTATE_CCW);
+    raylib_capture_target->image_rotate_ccw(image);
+}
+
+static void rl_capture_image_color_tint(Image *image, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_COLOR_TINT);
+    raylib_capture_target->image_color_tint(image, color);
+}
+
+static void rl_capture_image_color_invert(Image *image) {
+    rl_capture_unsupported(RL_CALL_IMAGE_COLOR_INVERT);
+    raylib_capture_target->image_color_invert(image);
+}
+
+static void rl_capture_image_color_grayscale(Image *image) {
+    rl_capture_unsupported(RL_CALL_IMAGE_COLOR_GRAYSCALE);
+    raylib_capture_target->image_color_grayscale(image);
+}
+
+static void rl_capture_image_color_contrast(Image *image, float contrast) {
+    rl_capture_unsupported(RL_CALL_IMAGE_COLOR_CONTRAST);
+    raylib_capture_target->image_color_contrast(image, contrast);
+}
+
+static void rl_capture_image_color_brightness(Image *image, int brightness) {
+    rl_capture_unsupported(RL_CALL_IMAGE_COLOR_BRIGHTNESS);
+    raylib_capture_target->image_color_brightness(image, brightness);
+}
+
+static void rl_capture_image_color_replace(Image *image, Color color, Color replace) {
+    rl_capture_unsupported(RL_CALL_IMAGE_COLOR_REPLACE);
+    raylib_capture_target->image_color_replace(image, color, replace);
+}
+
+static Color * rl_capture_load_image_colors(Image image) {
+    rl_capture_unsupported(RL_CALL_LOAD_IMAGE_COLORS);
+    return raylib_capture_target->load_image_colors(image);
+}
+
+static Color * rl_capture_load_image_palette(Image image, int maxPaletteSize, int *colorCount) {
+    rl_capture_unsupported(RL_CALL_LOAD_IMAGE_PALETTE);
+    return raylib_capture_target->load_image_palette(image, maxPaletteSize, colorCount);
+}
+
+static void rl_capture_unload_image_colors(Color *colors) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_IMAGE_COLORS);
+    raylib_capture_target->unload_image_colors(colors);
+}
+
+static void rl_capture_unload_image_palette(Color *colors) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_IMAGE_PALETTE);
+    raylib_capture_target->unload_image_palette(colors);
+}
+
+static Rectangle rl_capture_get_image_alpha_border(Image image, float threshold) {
+    rl_capture_unsupported(RL_CALL_GET_IMAGE_ALPHA_BORDER);
+    return raylib_capture_target->get_image_alpha_border(image, threshold);
+}
+
+static Color rl_capture_get_image_color(Image image, int x, int y) {
+    rl_capture_unsupported(RL_CALL_GET_IMAGE_COLOR);
+    return raylib_capture_target->get_image_color(image, x, y);
+}
+
+static void rl_capture_image_clear_background(Image *dst, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_CLEAR_BACKGROUND);
+    raylib_capture_target->image_clear_background(dst, color);
+}
+
+static void rl_capture_image_draw_pixel(Image *dst, int posX, int posY, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW_PIXEL);
+    raylib_capture_target->image_draw_pixel(dst, posX, posY, color);
+}
+
+static void rl_capture_image_draw_pixel_v(Image *dst, Vector2 position, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW_PIXEL_V);
+    raylib_capture_target->image_draw_pixel_v(dst, position, color);
+}
+
+static void rl_capture_image_draw_line(Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW_LINE);
+    raylib_capture_target->image_draw_line(dst, startPosX, startPosY, endPosX, endPosY, color);
+}
+
+static void rl_capture_image_draw_line_v(Image *dst, Vector2 start, Vector2 end, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW_LINE_V);
+    raylib_capture_target->image_draw_line_v(dst, start, end, color);
+}
+
+static void rl_capture_image_draw_line_ex(Image *dst, Vector2 start, Vector2 end, int thick, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW_LINE_EX);
+    raylib_capture_target->image_draw_line_ex(dst, start, end, thick, color);
+}
+
+static void rl_capture_image_draw_circle(Image *dst, int centerX, int centerY, int radius, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW_CIRCLE);
+    raylib_capture_target->image_draw_circle(dst, centerX, centerY, radius, color);
+}
+
+static void rl_capture_image_draw_circle_v(Image *dst, Vector2 center, int radius, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW_CIRCLE_V);
+    raylib_capture_target->image_draw_circle_v(dst, center, radius, color);
+}
+
+static void rl_capture_image_draw_circle_lines(Image *dst, int centerX, int centerY, int radius, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW_CIRCLE_LINES);
+    raylib_capture_target->image_draw_circle_lines(dst, centerX, centerY, radius, color);
+}
+
+static void rl_capture_image_draw_circle_lines_v(Image *dst, Vector2 center, int radius, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW_CIRCLE_LINES_V);
+    raylib_capture_target->image_draw_circle_lines_v(dst, center, radius, color);
+}
+
+static void rl_capture_image_draw_rectangle(Image *dst, int posX, int posY, int width, int height, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW_RECTANGLE);
+    raylib_capture_target->image_draw_rectangle(dst, posX, posY, width, height, color);
+}
+
+static void rl_capture_image_draw_rectangle_v(Image *dst, Vector2 position, Vector2 size, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW_RECTANGLE_V);
+    raylib_capture_target->image_draw_rectangle_v(dst, position, size, color);
+}
+
+static void rl_capture_image_draw_rectangle_rec(Image *dst, Rectangle rec, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW_RECTANGLE_REC);
+    raylib_capture_target->image_draw_rectangle_rec(dst, rec, color);
+}
+
+static void rl_capture_image_draw_rectangle_lines(Image *dst, Rectangle rec, int thick, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW_RECTANGLE_LINES);
+    raylib_capture_target->image_draw_rectangle_lines(dst, rec, thick, color);
+}
+
+static void rl_capture_image_draw_triangle(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW_TRIANGLE);
+    raylib_capture_target->image_draw_triangle(dst, v1, v2, v3, color);
+}
+
+static void rl_capture_image_draw_triangle_ex(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color c1, Color c2, Color c3) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW_TRIANGLE_EX);
+    raylib_capture_target->image_draw_triangle_ex(dst, v1, v2, v3, c1, c2, c3);
+}
+
+static void rl_capture_image_draw_triangle_lines(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW_TRIANGLE_LINES);
+    raylib_capture_target->image_draw_triangle_lines(dst, v1, v2, v3, color);
+}
+
+static void rl_capture_image_draw_triangle_fan(Image *dst, Vector2 *points, int pointCount, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW_TRIANGLE_FAN);
+    raylib_capture_target->image_draw_triangle_fan(dst, points, pointCount, color);
+}
+
+static void rl_capture_image_draw_triangle_strip(Image *dst, Vector2 *points, int pointCount, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW_TRIANGLE_STRIP);
+    raylib_capture_target->image_draw_triangle_strip(dst, points, pointCount, color);
+}
+
+static void rl_capture_image_draw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW);
+    raylib_capture_target->image_draw(dst, src, srcRec, dstRec, tint);
+}
+
+static void rl_capture_image_draw_text(Image *dst, const char *text, int posX, int posY, int fontSize, Color color) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW_TEXT);
+    raylib_capture_target->image_draw_text(dst, text, posX, posY, fontSize, color);
+}
+
+static void rl_capture_image_draw_text_ex(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint) {
+    rl_capture_unsupported(RL_CALL_IMAGE_DRAW_TEXT_EX);
+    raylib_capture_target->image_draw_text_ex(dst, font, text, position, fontSize, spacing, tint);
+}
+
+static Texture2D rl_capture_load_texture(const char *fileName) {
+    rl_capture_begin(RL_CALL_LOAD_TEXTURE);
+    rl_capture_string(fileName);
+    Texture2D result = raylib_capture_target->load_texture(fileName);
+    rl_capture_result_texture(result);
+    rl_capture_end();
+    return result;
+}
+
+static Texture2D rl_capture_load_texture_from_image(Image image) {
+    rl_capture_unsupported(RL_CALL_LOAD_TEXTURE_FROM_IMAGE);
+    return raylib_capture_target->load_texture_from_image(image);
+}
+
+static TextureCubemap rl_capture_load_texture_cubemap(Image image, int layout) {
+    rl_capture_unsupported(RL_CALL_LOAD_TEXTURE_CUBEMAP);
+    return raylib_capture_target->load_texture_cubemap(image, layout);
+}
+
+static RenderTexture2D rl_capture_load_render_texture(int width, int height) {
+    rl_capture_begin(RL_CALL_LOAD_RENDER_TEXTURE);
+    rl_capture_value(&width, sizeof(width));
+    rl_capture_value(&height, sizeof(height));
+    RenderTexture2D result = raylib_capture_target->load_render_texture(width, height);
+    rl_capture_result_render_texture(result);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_is_texture_valid(Texture2D texture) {
+    rl_capture_begin(RL_CALL_IS_TEXTURE_VALID);
+    rl_capture_texture(texture);
+    bool result = raylib_capture_target->is_texture_valid(texture);
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_unload_texture(Texture2D texture) {
+    rl_capture_begin(RL_CALL_UNLOAD_TEXTURE);
+    rl_capture_texture(texture);
+    raylib_capture_target->unload_texture(texture);
+    rl_capture_forget_texture(texture);
+    rl_capture_end();
+}
+
+static bool rl_capture_is_render_texture_valid(RenderTexture2D target) {
+    rl_capture_begin(RL_CALL_IS_RENDER_TEXTURE_VALID);
+    rl_capture_render_texture(target);
+    bool result = raylib_capture_target->is_render_texture_valid(target);
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_unload_render_texture(RenderTexture2D target) {
+    rl_capture_begin(RL_CALL_UNLOAD_RENDER_TEXTURE);
+    rl_capture_render_texture(target);
+    raylib_capture_target->unload_render_texture(target);
+    rl_capture_forget_render_texture(target);
+    rl_capture_end();
+}
+
+static void rl_capture_update_texture(Texture2D texture, const void *pixels) {
+    rl_capture_unsupported(RL_CALL_UPDATE_TEXTURE);
+    raylib_capture_target->update_texture(texture, pixels);
+}
+
+static void rl_capture_update_texture_rec(Texture2D texture, Rectangle rec, const void *pixels) {
+    rl_capture_unsupported(RL_CALL_UPDATE_TEXTURE_REC);
+    raylib_capture_target->update_texture_rec(texture, rec, pixels);
+}
+
+static void rl_capture_gen_texture_mipmaps(Texture2D *texture) {
+    rl_capture_unsupported(RL_CALL_GEN_TEXTURE_MIPMAPS);
+    raylib_capture_target->gen_texture_mipmaps(texture);
+}
+
+static void rl_capture_set_texture_filter(Texture2D texture, int filter) {
+    rl_capture_begin(RL_CALL_SET_TEXTURE_FILTER);
+    rl_capture_texture(texture);
+    rl_capture_value(&filter, sizeof(filter));
+    raylib_capture_target->set_texture_filter(texture, filter);
+    rl_capture_end();
+}
+
+static void rl_capture_set_texture_wrap(Texture2D texture, int wrap) {
+    rl_capture_begin(RL_CALL_SET_TEXTURE_WRAP);
+    rl_capture_texture(texture);
+    rl_capture_value(&wrap, sizeof(wrap));
+    raylib_capture_target->set_texture_wrap(texture, wrap);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_texture(Texture2D texture, int posX, int posY, Color tint) {
+    rl_capture_begin(RL_CALL_DRAW_TEXTURE);
+    rl_capture_texture(texture);
+    rl_capture_value(&posX, sizeof(posX));
+    rl_capture_value(&posY, sizeof(posY));
+    rl_capture_value(&tint, sizeof(tint));
+    raylib_capture_target->draw_texture(texture, posX, posY, tint);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_texture_v(Texture2D texture, Vector2 position, Color tint) {
+    rl_capture_begin(RL_CALL_DRAW_TEXTURE_V);
+    rl_capture_texture(texture);
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&tint, sizeof(tint));
+    raylib_capture_target->draw_texture_v(texture, position, tint);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_texture_ex(Texture2D texture, Vector2 position, float rotation, float scale, Color tint) {
+    rl_capture_begin(RL_CALL_DRAW_TEXTURE_EX);
+    rl_capture_texture(texture);
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&rotation, sizeof(rotation));
+    rl_capture_value(&scale, sizeof(scale));
+    rl_capture_value(&tint, sizeof(tint));
+    raylib_capture_target->draw_texture_ex(texture, position, rotation, scale, tint);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_texture_rec(Texture2D texture, Rectangle source, Vector2 position, Color tint) {
+    rl_capture_begin(RL_CALL_DRAW_TEXTURE_REC);
+    rl_capture_texture(texture);
+    rl_capture_value(&source, sizeof(source));
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&tint, sizeof(tint));
+    raylib_capture_target->draw_texture_rec(texture, source, position, tint);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_texture_pro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) {
+    rl_capture_begin(RL_CALL_DRAW_TEXTURE_PRO);
+    rl_capture_texture(texture);
+    rl_capture_value(&source, sizeof(source));
+    rl_capture_value(&dest, sizeof(dest));
+    rl_capture_value(&origin, sizeof(origin));
+    rl_capture_value(&rotation, sizeof(rotation));
+    rl_capture_value(&tint, sizeof(tint));
+    raylib_capture_target->draw_texture_pro(texture, source, dest, origin, rotation, tint);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_texture_n_patch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint) {
+    rl_capture_begin(RL_CALL_DRAW_TEXTURE_N_PATCH);
+    rl_capture_texture(texture);
+    rl_capture_value(&nPatchInfo, sizeof(nPatchInfo));
+    rl_capture_value(&dest, sizeof(dest));
+    rl_capture_value(&origin, sizeof(origin));
+    rl_capture_value(&rotation, sizeof(rotation));
+    rl_capture_value(&tint, sizeof(tint));
+    raylib_capture_target->draw_texture_n_patch(texture, nPatchInfo, dest, origin, rotation, tint);
+    rl_capture_end();
+}
+
+static bool rl_capture_color_is_equal(Color col1, Color col2) {
+    rl_capture_begin(RL_CALL_COLOR_IS_EQUAL);
+    rl_capture_value(&col1, sizeof(col1));
+    rl_capture_value(&col2, sizeof(col2));
+    bool result = raylib_capture_target->color_is_equal(col1, col2);
+    rl_capture_end();
+    return result;
+}
+
+static Color rl_capture_fade(Color color, float alpha) {
+    rl_capture_begin(RL_CALL_FADE);
+    rl_capture_value(&color, sizeof(color));
+    rl_capture_value(&alpha, sizeof(alpha));
+    Color result = raylib_capture_target->fade(color, alpha);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_color_to_int(Color color) {
+    rl_capture_begin(RL_CALL_COLOR_TO_INT);
+    rl_capture_value(&color, sizeof(color));
+    int result = raylib_capture_target->color_to_int(color);
+    rl_capture_end();
+    return result;
+}
+
+static Vector4 rl_capture_color_normalize(Color color) {
+    rl_capture_begin(RL_CALL_COLOR_NORMALIZE);
+    rl_capture_value(&color, sizeof(color));
+    Vector4 result = raylib_capture_target->color_normalize(color);
+    rl_capture_end();
+    return result;
+}
+
+static Color rl_capture_color_from_normalized(Vector4 normalized) {
+    rl_capture_begin(RL_CALL_COLOR_FROM_NORMALIZED);
+    rl_capture_value(&normalized, sizeof(normalized));
+    Color result = raylib_capture_target->color_from_normalized(normalized);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_color_to_hsv(Color color) {
+    rl_capture_begin(RL_CALL_COLOR_TO_HSV);
+    rl_capture_value(&color, sizeof(color));
+    Vector3 result = raylib_capture_target->color_to_hsv(color);
+    rl_capture_end();
+    return result;
+}
+
+static Color rl_capture_color_from_hsv(float hue, float saturation, float value) {
+    rl_capture_begin(RL_CALL_COLOR_FROM_HSV);
+    rl_capture_value(&hue, sizeof(hue));
+    rl_capture_value(&saturation, sizeof(saturation));
+    rl_capture_value(&value, sizeof(value));
+    Color result = raylib_capture_target->color_from_hsv(hue, saturation, value);
+    rl_capture_end();
+    return result;
+}
+
+static Color rl_capture_color_tint(Color color, Color tint) {
+    rl_capture_begin(RL_CALL_COLOR_TINT);
+    rl_capture_value(&color, sizeof(color));
+    rl_capture_value(&tint, sizeof(tint));
+    Color result = raylib_capture_target->color_tint(color, tint);
+    rl_capture_end();
+    return result;
+}
+
+static Color rl_capture_color_brightness(Color color, float factor) {
+    rl_capture_begin(RL_CALL_COLOR_BRIGHTNESS);
+    rl_capture_value(&color, sizeof(color));
+    rl_capture_value(&factor, sizeof(factor));
+    Color result = raylib_capture_target->color_brightness(color, factor);
+    rl_capture_end();
+    return result;
+}
+
+static Color rl_capture_color_contrast(Color color, float contrast) {
+    rl_capture_begin(RL_CALL_COLOR_CONTRAST);
+    rl_capture_value(&color, sizeof(color));
+    rl_capture_value(&contrast, sizeof(contrast));
+    Color result = raylib_capture_target->color_contrast(color, contrast);
+    rl_capture_end();
+    return result;
+}
+
+static Color rl_capture_color_alpha(Color color, float alpha) {
+    rl_capture_begin(RL_CALL_COLOR_ALPHA);
+    rl_capture_value(&color, sizeof(color));
+    rl_capture_value(&alpha, sizeof(alpha));
+    Color result = raylib_capture_target->color_alpha(color, alpha);
+    rl_capture_end();
+    return result;
+}
+
+static Color rl_capture_color_alpha_blend(Color dst, Color src, Color tint) {
+    rl_capture_begin(RL_CALL_COLOR_ALPHA_BLEND);
+    rl_capture_value(&dst, sizeof(dst));
+    rl_capture_value(&src, sizeof(src));
+    rl_capture_value(&tint, sizeof(tint));
+    Color result = raylib_capture_target->color_alpha_blend(dst, src, tint);
+    rl_capture_end();
+    return result;
+}
+
+static Color rl_capture_color_lerp(Color color1, Color color2, float factor) {
+    rl_capture_begin(RL_CALL_COLOR_LERP);
+    rl_capture_value(&color1, sizeof(color1));
+    rl_capture_value(&color2, sizeof(color2));
+    rl_capture_value(&factor, sizeof(factor));
+    Color result = raylib_capture_target->color_lerp(color1, color2, factor);
+    rl_capture_end();
+    return result;
+}
+
+static Color rl_capture_get_color(unsigned int hexValue) {
+    rl_capture_begin(RL_CALL_GET_COLOR);
+    rl_capture_value(&hexValue, sizeof(hexValue));
+    Color result = raylib_capture_target->get_color(hexValue);
+    rl_capture_end();
+    return result;
+}
+
+static Color rl_capture_get_pixel_color(void *srcPtr, int format) {
+    rl_capture_unsupported(RL_CALL_GET_PIXEL_COLOR);
+    return raylib_capture_target->get_pixel_color(srcPtr, format);
+}
+
+static void rl_capture_set_pixel_color(void *dstPtr, Color color, int format) {
+    rl_capture_unsupported(RL_CALL_SET_PIXEL_COLOR);
+    raylib_capture_target->set_pixel_color(dstPtr, color, format);
+}
+
+static int rl_capture_get_pixel_data_size(int width, int height, int format) {
+    rl_capture_begin(RL_CALL_GET_PIXEL_DATA_SIZE);
+    rl_capture_value(&width, sizeof(width));
+    rl_capture_value(&height, sizeof(height));
+    rl_capture_value(&format, sizeof(format));
+    int result = raylib_capture_target->get_pixel_data_size(width, height, format);
+    rl_capture_end();
+    return result;
+}
+
+static Font rl_capture_get_font_default(void) {
+    rl_capture_unsupported(RL_CALL_GET_FONT_DEFAULT);
+    return raylib_capture_target->get_font_default();
+}
+
+static Font rl_capture_load_font(const char *fileName) {
+    rl_capture_unsupported(RL_CALL_LOAD_FONT);
+    return raylib_capture_target->load_font(fileName);
+}
+
+static Font rl_capture_load_font_ex(const char *fileName, int fontSize, int *codepoints, int codepointCount) {
+    rl_capture_unsupported(RL_CALL_LOAD_FONT_EX);
+    return raylib_capture_target->load_font_ex(fileName, fontSize, codepoints, codepointCount);
+}
+
+static Font rl_capture_load_font_from_image(Image image, Color key, int firstChar) {
+    rl_capture_unsupported(RL_CALL_LOAD_FONT_FROM_IMAGE);
+    return raylib_capture_target->load_font_from_image(image, key, firstChar);
+}
+
+static Font rl_capture_load_font_from_memory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount) {
+    rl_capture_unsupported(RL_CALL_LOAD_FONT_FROM_MEMORY);
+    return raylib_capture_target->load_font_from_memory(fileType, fileData, dataSize, fontSize, codepoints, codepointCount);
+}
+
+static bool rl_capture_is_font_valid(Font font) {
+    rl_capture_unsupported(RL_CALL_IS_FONT_VALID);
+    return raylib_capture_target->is_font_valid(font);
+}
+
+static GlyphInfo * rl_capture_load_font_data(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type) {
+    rl_capture_unsupported(RL_CALL_LOAD_FONT_DATA);
+    return raylib_capture_target->load_font_data(fileData, dataSize, fontSize, codepoints, codepointCount, type);
+}
+
+static Image rl_capture_gen_image_font_atlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod) {
+    rl_capture_unsupported(RL_CALL_GEN_IMAGE_FONT_ATLAS);
+    return raylib_capture_target->gen_image_font_atlas(glyphs, glyphRecs, glyphCount, fontSize, padding, packMethod);
+}
+
+static void rl_capture_unload_font_data(GlyphInfo *glyphs, int glyphCount) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_FONT_DATA);
+    raylib_capture_target->unload_font_data(glyphs, glyphCount);
+}
+
+static void rl_capture_unload_font(Font font) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_FONT);
+    raylib_capture_target->unload_font(font);
+}
+
+static bool rl_capture_export_font_as_code(Font font, const char *fileName) {
+    rl_capture_unsupported(RL_CALL_EXPORT_FONT_AS_CODE);
+    return raylib_capture_target->export_font_as_code(font, fileName);
+}
+
+static void rl_capture_draw_fps(int posX, int posY) {
+    rl_capture_begin(RL_CALL_DRAW_FPS);
+    rl_capture_value(&posX, sizeof(posX));
+    rl_capture_value(&posY, sizeof(posY));
+    raylib_capture_target->draw_fps(posX, posY);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_text(const char *text, int posX, int posY, int fontSize, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_TEXT);
+    rl_capture_string(text);
+    rl_capture_value(&posX, sizeof(posX));
+    rl_capture_value(&posY, sizeof(posY));
+    rl_capture_value(&fontSize, sizeof(fontSize));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_text(text, posX, posY, fontSize, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_text_ex(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint) {
+    rl_capture_unsupported(RL_CALL_DRAW_TEXT_EX);
+    raylib_capture_target->draw_text_ex(font, text, position, fontSize, spacing, tint);
+}
+
+static void rl_capture_draw_text_pro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint) {
+    rl_capture_unsupported(RL_CALL_DRAW_TEXT_PRO);
+    raylib_capture_target->draw_text_pro(font, text, position, origin, rotation, fontSize, spacing, tint);
+}
+
+static void rl_capture_draw_text_codepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint) {
+    rl_capture_unsupported(RL_CALL_DRAW_TEXT_CODEPOINT);
+    raylib_capture_target->draw_text_codepoint(font, codepoint, position, fontSize, tint);
+}
+
+static void rl_capture_draw_text_codepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint) {
+    rl_capture_unsupported(RL_CALL_DRAW_TEXT_CODEPOINTS);
+    raylib_capture_target->draw_text_codepoints(font, codepoints, codepointCount, position, fontSize, spacing, tint);
+}
+
+static void rl_capture_set_text_line_spacing(int spacing) {
+    rl_capture_begin(RL_CALL_SET_TEXT_LINE_SPACING);
+    rl_capture_value(&spacing, sizeof(spacing));
+    raylib_capture_target->set_text_line_spacing(spacing);
+    rl_capture_end();
+}
+
+static int rl_capture_measure_text(const char *text, int fontSize) {
+    rl_capture_begin(RL_CALL_MEASURE_TEXT);
+    rl_capture_string(text);
+    rl_capture_value(&fontSize, sizeof(fontSize));
+    int result = raylib_capture_target->measure_text(text, fontSize);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_measure_text_ex(Font font, const char *text, float fontSize, float spacing) {
+    rl_capture_unsupported(RL_CALL_MEASURE_TEXT_EX);
+    return raylib_capture_target->measure_text_ex(font, text, fontSize, spacing);
+}
+
+static int rl_capture_get_glyph_index(Font font, int codepoint) {
+    rl_capture_unsupported(RL_CALL_GET_GLYPH_INDEX);
+    return raylib_capture_target->get_glyph_index(font, codepoint);
+}
+
+static GlyphInfo rl_capture_get_glyph_info(Font font, int codepoint) {
+    rl_capture_unsupported(RL_CALL_GET_GLYPH_INFO);
+    return raylib_capture_target->get_glyph_info(font, codepoint);
+}
+
+static Rectangle rl_capture_get_glyph_atlas_rec(Font font, int codepoint) {
+    rl_capture_unsupported(RL_CALL_GET_GLYPH_ATLAS_REC);
+    return raylib_capture_target->get_glyph_atlas_rec(font, codepoint);
+}
+
+static char * rl_capture_load_utf8(const int *codepoints, int length) {
+    rl_capture_unsupported(RL_CALL_LOAD_UTF8);
+    return raylib_capture_target->load_utf8(codepoints, length);
+}
+
+static void rl_capture_unload_utf8(char *text) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_UTF8);
+    raylib_capture_target->unload_utf8(text);
+}
+
+static int * rl_capture_load_codepoints(const char *text, int *count) {
+    rl_capture_unsupported(RL_CALL_LOAD_CODEPOINTS);
+    return raylib_capture_target->load_codepoints(text, count);
+}
+
+static void rl_capture_unload_codepoints(int *codepoints) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_CODEPOINTS);
+    raylib_capture_target->unload_codepoints(codepoints);
+}
+
+static int rl_capture_get_codepoint_count(const char *text) {
+    rl_capture_begin(RL_CALL_GET_CODEPOINT_COUNT);
+    rl_capture_string(text);
+    int result = raylib_capture_target->get_codepoint_count(text);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_get_codepoint(const char *text, int *codepointSize) {
+    rl_capture_unsupported(RL_CALL_GET_CODEPOINT);
+    return raylib_capture_target->get_codepoint(text, codepointSize);
+}
+
+static int rl_capture_get_codepoint_next(const char *text, int *codepointSize) {
+    rl_capture_unsupported(RL_CALL_GET_CODEPOINT_NEXT);
+    return raylib_capture_target->get_codepoint_next(text, codepointSize);
+}
+
+static int rl_capture_get_codepoint_previous(const char *text, int *codepointSize) {
+    rl_capture_unsupported(RL_CALL_GET_CODEPOINT_PREVIOUS);
+    return raylib_capture_target->get_codepoint_previous(text, codepointSize);
+}
+
+static const char * rl_capture_codepoint_to_utf8(int codepoint, int *utf8Size) {
+    rl_capture_unsupported(RL_CALL_CODEPOINT_TO_UTF8);
+    return raylib_capture_target->codepoint_to_utf8(codepoint, utf8Size);
+}
+
+static int rl_capture_text_copy(char *dst, const char *src) {
+    rl_capture_unsupported(RL_CALL_TEXT_COPY);
+    return raylib_capture_target->text_copy(dst, src);
+}
+
+static bool rl_capture_text_is_equal(const char *text1, const char *text2) {
+    rl_capture_begin(RL_CALL_TEXT_IS_EQUAL);
+    rl_capture_string(text1);
+    rl_capture_string(text2);
+    bool result = raylib_capture_target->text_is_equal(text1, text2);
+    rl_capture_end();
+    return result;
+}
+
+static unsigned int rl_capture_text_length(const char *text) {
+    rl_capture_begin(RL_CALL_TEXT_LENGTH);
+    rl_capture_string(text);
+    unsigned int result = raylib_capture_target->text_length(text);
+    rl_capture_end();
+    return result;
+}
+
+static const char * rl_capture_text_subtext(const char *text, int position, int length) {
+    rl_capture_begin(RL_CALL_TEXT_SUBTEXT);
+    rl_capture_string(text);
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&length, sizeof(length));
+    const char * result = raylib_capture_target->text_subtext(text, position, length);
+    rl_capture_end();
+    return result;
+}
+
+static char * rl_capture_text_replace(const char *text, const char *replace, const char *by) {
+    rl_capture_unsupported(RL_CALL_TEXT_REPLACE);
+    return raylib_capture_target->text_replace(text, replace, by);
+}
+
+static char * rl_capture_text_insert(const char *text, const char *insert, int position) {
+    rl_capture_unsupported(RL_CALL_TEXT_INSERT);
+    return raylib_capture_target->text_insert(text, insert, position);
+}
+
+static const char * rl_capture_text_join(const char **textList, int count, const char *delimiter) {
+    rl_capture_unsupported(RL_CALL_TEXT_JOIN);
+    return raylib_capture_target->text_join(textList, count, delimiter);
+}
+
+static const char ** rl_capture_text_split(const char *text, char delimiter, int *count) {
+    rl_capture_unsupported(RL_CALL_TEXT_SPLIT);
+    return raylib_capture_target->text_split(text, delimiter, count);
+}
+
+static void rl_capture_text_append(char *text, const char *append, int *position) {
+    rl_capture_unsupported(RL_CALL_TEXT_APPEND);
+    raylib_capture_target->text_append(text, append, position);
+}
+
+static int rl_capture_text_find_index(const char *text, const char *find) {
+    rl_capture_begin(RL_CALL_TEXT_FIND_INDEX);
+    rl_capture_string(text);
+    rl_capture_string(find);
+    int result = raylib_capture_target->text_find_index(text, find);
+    rl_capture_end();
+    return result;
+}
+
+static const char * rl_capture_text_to_upper(const char *text) {
+    rl_capture_begin(RL_CALL_TEXT_TO_UPPER);
+    rl_capture_string(text);
+    const char * result = raylib_capture_target->text_to_upper(text);
+    rl_capture_end();
+    return result;
+}
+
+static const char * rl_capture_text_to_lower(const char *text) {
+    rl_capture_begin(RL_CALL_TEXT_TO_LOWER);
+    rl_capture_string(text);
+    const char * result = raylib_capture_target->text_to_lower(text);
+    rl_capture_end();
+    return result;
+}
+
+static const char * rl_capture_text_to_pascal(const char *text) {
+    rl_capture_begin(RL_CALL_TEXT_TO_PASCAL);
+    rl_capture_string(text);
+    const char * result = raylib_capture_target->text_to_pascal(text);
+    rl_capture_end();
+    return result;
+}
+
+static const char * rl_capture_text_to_snake(const char *text) {
+    rl_capture_begin(RL_CALL_TEXT_TO_SNAKE);
+    rl_capture_string(text);
+    const char * result = raylib_capture_target->text_to_snake(text);
+    rl_capture_end();
+    return result;
+}
+
+static const char * rl_capture_text_to_camel(const char *text) {
+    rl_capture_begin(RL_CALL_TEXT_TO_CAMEL);
+    rl_capture_string(text);
+    const char * result = raylib_capture_target->text_to_camel(text);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_text_to_integer(const char *text) {
+    rl_capture_begin(RL_CALL_TEXT_TO_INTEGER);
+    rl_capture_string(text);
+    int result = raylib_capture_target->text_to_integer(text);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_text_to_float(const char *text) {
+    rl_capture_begin(RL_CALL_TEXT_TO_FLOAT);
+    rl_capture_string(text);
+    float result = raylib_capture_target->text_to_float(text);
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_draw_line3_d(Vector3 startPos, Vector3 endPos, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_LINE3_D);
+    rl_capture_value(&startPos, sizeof(startPos));
+    rl_capture_value(&endPos, sizeof(endPos));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_line3_d(startPos, endPos, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_point3_d(Vector3 position, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_POINT3_D);
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_point3_d(position, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_circle3_d(Vector3 center, float radius, Vector3 rotationAxis, float rotationAngle, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_CIRCLE3_D);
+    rl_capture_value(&center, sizeof(center));
+    rl_capture_value(&radius, sizeof(radius));
+    rl_capture_value(&rotationAxis, sizeof(rotationAxis));
+    rl_capture_value(&rotationAngle, sizeof(rotationAngle));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_circle3_d(center, radius, rotationAxis, rotationAngle, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_triangle3_d(Vector3 v1, Vector3 v2, Vector3 v3, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_TRIANGLE3_D);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    rl_capture_value(&v3, sizeof(v3));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_triangle3_d(v1, v2, v3, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_triangle_strip3_d(const Vector3 *points, int pointCount, Color color) {
+    rl_capture_unsupported(RL_CALL_DRAW_TRIANGLE_STRIP3_D);
+    raylib_capture_target->draw_triangle_strip3_d(points, pointCount, color);
+}
+
+static void rl_capture_draw_cube(Vector3 position, float width, float height, float length, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_CUBE);
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&width, sizeof(width));
+    rl_capture_value(&height, sizeof(height));
+    rl_capture_value(&length, sizeof(length));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_cube(position, width, height, length, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_cube_v(Vector3 position, Vector3 size, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_CUBE_V);
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&size, sizeof(size));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_cube_v(position, size, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_cube_wires(Vector3 position, float width, float height, float length, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_CUBE_WIRES);
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&width, sizeof(width));
+    rl_capture_value(&height, sizeof(height));
+    rl_capture_value(&length, sizeof(length));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_cube_wires(position, width, height, length, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_cube_wires_v(Vector3 position, Vector3 size, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_CUBE_WIRES_V);
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&size, sizeof(size));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_cube_wires_v(position, size, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_sphere(Vector3 centerPos, float radius, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_SPHERE);
+    rl_capture_value(&centerPos, sizeof(centerPos));
+    rl_capture_value(&radius, sizeof(radius));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_sphere(centerPos, radius, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_sphere_ex(Vector3 centerPos, float radius, int rings, int slices, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_SPHERE_EX);
+    rl_capture_value(&centerPos, sizeof(centerPos));
+    rl_capture_value(&radius, sizeof(radius));
+    rl_capture_value(&rings, sizeof(rings));
+    rl_capture_value(&slices, sizeof(slices));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_sphere_ex(centerPos, radius, rings, slices, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_sphere_wires(Vector3 centerPos, float radius, int rings, int slices, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_SPHERE_WIRES);
+    rl_capture_value(&centerPos, sizeof(centerPos));
+    rl_capture_value(&radius, sizeof(radius));
+    rl_capture_value(&rings, sizeof(rings));
+    rl_capture_value(&slices, sizeof(slices));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_sphere_wires(centerPos, radius, rings, slices, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_cylinder(Vector3 position, float radiusTop, float radiusBottom, float height, int slices, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_CYLINDER);
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&radiusTop, sizeof(radiusTop));
+    rl_capture_value(&radiusBottom, sizeof(radiusBottom));
+    rl_capture_value(&height, sizeof(height));
+    rl_capture_value(&slices, sizeof(slices));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_cylinder(position, radiusTop, radiusBottom, height, slices, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_cylinder_ex(Vector3 startPos, Vector3 endPos, float startRadius, float endRadius, int sides, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_CYLINDER_EX);
+    rl_capture_value(&startPos, sizeof(startPos));
+    rl_capture_value(&endPos, sizeof(endPos));
+    rl_capture_value(&startRadius, sizeof(startRadius));
+    rl_capture_value(&endRadius, sizeof(endRadius));
+    rl_capture_value(&sides, sizeof(sides));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_cylinder_ex(startPos, endPos, startRadius, endRadius, sides, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_cylinder_wires(Vector3 position, float radiusTop, float radiusBottom, float height, int slices, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_CYLINDER_WIRES);
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&radiusTop, sizeof(radiusTop));
+    rl_capture_value(&radiusBottom, sizeof(radiusBottom));
+    rl_capture_value(&height, sizeof(height));
+    rl_capture_value(&slices, sizeof(slices));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_cylinder_wires(position, radiusTop, radiusBottom, height, slices, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_cylinder_wires_ex(Vector3 startPos, Vector3 endPos, float startRadius, float endRadius, int sides, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_CYLINDER_WIRES_EX);
+    rl_capture_value(&startPos, sizeof(startPos));
+    rl_capture_value(&endPos, sizeof(endPos));
+    rl_capture_value(&startRadius, sizeof(startRadius));
+    rl_capture_value(&endRadius, sizeof(endRadius));
+    rl_capture_value(&sides, sizeof(sides));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_cylinder_wires_ex(startPos, endPos, startRadius, endRadius, sides, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_capsule(Vector3 startPos, Vector3 endPos, float radius, int slices, int rings, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_CAPSULE);
+    rl_capture_value(&startPos, sizeof(startPos));
+    rl_capture_value(&endPos, sizeof(endPos));
+    rl_capture_value(&radius, sizeof(radius));
+    rl_capture_value(&slices, sizeof(slices));
+    rl_capture_value(&rings, sizeof(rings));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_capsule(startPos, endPos, radius, slices, rings, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_capsule_wires(Vector3 startPos, Vector3 endPos, float radius, int slices, int rings, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_CAPSULE_WIRES);
+    rl_capture_value(&startPos, sizeof(startPos));
+    rl_capture_value(&endPos, sizeof(endPos));
+    rl_capture_value(&radius, sizeof(radius));
+    rl_capture_value(&slices, sizeof(slices));
+    rl_capture_value(&rings, sizeof(rings));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_capsule_wires(startPos, endPos, radius, slices, rings, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_plane(Vector3 centerPos, Vector2 size, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_PLANE);
+    rl_capture_value(&centerPos, sizeof(centerPos));
+    rl_capture_value(&size, sizeof(size));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_plane(centerPos, size, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_ray(Ray ray, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_RAY);
+    rl_capture_value(&ray, sizeof(ray));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_ray(ray, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_grid(int slices, float spacing) {
+    rl_capture_begin(RL_CALL_DRAW_GRID);
+    rl_capture_value(&slices, sizeof(slices));
+    rl_capture_value(&spacing, sizeof(spacing));
+    raylib_capture_target->draw_grid(slices, spacing);
+    rl_capture_end();
+}
+
+static Model rl_capture_load_model(const char *fileName) {
+    rl_capture_unsupported(RL_CALL_LOAD_MODEL);
+    return raylib_capture_target->load_model(fileName);
+}
+
+static Model rl_capture_load_model_from_mesh(Mesh mesh) {
+    rl_capture_unsupported(RL_CALL_LOAD_MODEL_FROM_MESH);
+    return raylib_capture_target->load_model_from_mesh(mesh);
+}
+
+static bool rl_capture_is_model_valid(Model model) {
+    rl_capture_unsupported(RL_CALL_IS_MODEL_VALID);
+    return raylib_capture_target->is_model_valid(model);
+}
+
+static void rl_capture_unload_model(Model model) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_MODEL);
+    raylib_capture_target->unload_model(model);
+}
+
+static BoundingBox rl_capture_get_model_bounding_box(Model model) {
+    rl_capture_unsupported(RL_CALL_GET_MODEL_BOUNDING_BOX);
+    return raylib_capture_target->get_model_bounding_box(model);
+}
+
+static void rl_capture_draw_model(Model model, Vector3 position, float scale, Color tint) {
+    rl_capture_unsupported(RL_CALL_DRAW_MODEL);
+    raylib_capture_target->draw_model(model, position, scale, tint);
+}
+
+static void rl_capture_draw_model_ex(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint) {
+    rl_capture_unsupported(RL_CALL_DRAW_MODEL_EX);
+    raylib_capture_target->draw_model_ex(model, position, rotationAxis, rotationAngle, scale, tint);
+}
+
+static void rl_capture_draw_model_wires(Model model, Vector3 position, float scale, Color tint) {
+    rl_capture_unsupported(RL_CALL_DRAW_MODEL_WIRES);
+    raylib_capture_target->draw_model_wires(model, position, scale, tint);
+}
+
+static void rl_capture_draw_model_wires_ex(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint) {
+    rl_capture_unsupported(RL_CALL_DRAW_MODEL_WIRES_EX);
+    raylib_capture_target->draw_model_wires_ex(model, position, rotationAxis, rotationAngle, scale, tint);
+}
+
+static void rl_capture_draw_model_points(Model model, Vector3 position, float scale, Color tint) {
+    rl_capture_unsupported(RL_CALL_DRAW_MODEL_POINTS);
+    raylib_capture_target->draw_model_points(model, position, scale, tint);
+}
+
+static void rl_capture_draw_model_points_ex(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint) {
+    rl_capture_unsupported(RL_CALL_DRAW_MODEL_POINTS_EX);
+    raylib_capture_target->draw_model_points_ex(model, position, rotationAxis, rotationAngle, scale, tint);
+}
+
+static void rl_capture_draw_bounding_box(BoundingBox box, Color color) {
+    rl_capture_begin(RL_CALL_DRAW_BOUNDING_BOX);
+    rl_capture_value(&box, sizeof(box));
+    rl_capture_value(&color, sizeof(color));
+    raylib_capture_target->draw_bounding_box(box, color);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_billboard(Camera camera, Texture2D texture, Vector3 position, float scale, Color tint) {
+    rl_capture_begin(RL_CALL_DRAW_BILLBOARD);
+    rl_capture_value(&camera, sizeof(camera));
+    rl_capture_texture(texture);
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&scale, sizeof(scale));
+    rl_capture_value(&tint, sizeof(tint));
+    raylib_capture_target->draw_billboard(camera, texture, position, scale, tint);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_billboard_rec(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector2 size, Color tint) {
+    rl_capture_begin(RL_CALL_DRAW_BILLBOARD_REC);
+    rl_capture_value(&camera, sizeof(camera));
+    rl_capture_texture(texture);
+    rl_capture_value(&source, sizeof(source));
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&size, sizeof(size));
+    rl_capture_value(&tint, sizeof(tint));
+    raylib_capture_target->draw_billboard_rec(camera, texture, source, position, size, tint);
+    rl_capture_end();
+}
+
+static void rl_capture_draw_billboard_pro(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector3 up, Vector2 size, Vector2 origin, float rotation, Color tint) {
+    rl_capture_begin(RL_CALL_DRAW_BILLBOARD_PRO);
+    rl_capture_value(&camera, sizeof(camera));
+    rl_capture_texture(texture);
+    rl_capture_value(&source, sizeof(source));
+    rl_capture_value(&position, sizeof(position));
+    rl_capture_value(&up, sizeof(up));
+    rl_capture_value(&size, sizeof(size));
+    rl_capture_value(&origin, sizeof(origin));
+    rl_capture_value(&rotation, sizeof(rotation));
+    rl_capture_value(&tint, sizeof(tint));
+    raylib_capture_target->draw_billboard_pro(camera, texture, source, position, up, size, origin, rotation, tint);
+    rl_capture_end();
+}
+
+static void rl_capture_upload_mesh(Mesh *mesh, bool dynamic) {
+    rl_capture_unsupported(RL_CALL_UPLOAD_MESH);
+    raylib_capture_target->upload_mesh(mesh, dynamic);
+}
+
+static void rl_capture_update_mesh_buffer(Mesh mesh, int index, const void *data, int dataSize, int offset) {
+    rl_capture_unsupported(RL_CALL_UPDATE_MESH_BUFFER);
+    raylib_capture_target->update_mesh_buffer(mesh, index, data, dataSize, offset);
+}
+
+static void rl_capture_unload_mesh(Mesh mesh) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_MESH);
+    raylib_capture_target->unload_mesh(mesh);
+}
+
+static void rl_capture_draw_mesh(Mesh mesh, Material material, Matrix transform) {
+    rl_capture_unsupported(RL_CALL_DRAW_MESH);
+    raylib_capture_target->draw_mesh(mesh, material, transform);
+}
+
+static void rl_capture_draw_mesh_instanced(Mesh mesh, Material material, const Matrix *transforms, int instances) {
+    rl_capture_unsupported(RL_CALL_DRAW_MESH_INSTANCED);
+    raylib_capture_target->draw_mesh_instanced(mesh, material, transforms, instances);
+}
+
+static BoundingBox rl_capture_get_mesh_bounding_box(Mesh mesh) {
+    rl_capture_unsupported(RL_CALL_GET_MESH_BOUNDING_BOX);
+    return raylib_capture_target->get_mesh_bounding_box(mesh);
+}
+
+static void rl_capture_gen_mesh_tangents(Mesh *mesh) {
+    rl_capture_unsupported(RL_CALL_GEN_MESH_TANGENTS);
+    raylib_capture_target->gen_mesh_tangents(mesh);
+}
+
+static bool rl_capture_export_mesh(Mesh mesh, const char *fileName) {
+    rl_capture_unsupported(RL_CALL_EXPORT_MESH);
+    return raylib_capture_target->export_mesh(mesh, fileName);
+}
+
+static bool rl_capture_export_mesh_as_code(Mesh mesh, const char *fileName) {
+    rl_capture_unsupported(RL_CALL_EXPORT_MESH_AS_CODE);
+    return raylib_capture_target->export_mesh_as_code(mesh, fileName);
+}
+
+static Mesh rl_capture_gen_mesh_poly(int sides, float radius) {
+    rl_capture_unsupported(RL_CALL_GEN_MESH_POLY);
+    return raylib_capture_target->gen_mesh_poly(sides, radius);
+}
+
+static Mesh rl_capture_gen_mesh_plane(float width, float length, int resX, int resZ) {
+    rl_capture_unsupported(RL_CALL_GEN_MESH_PLANE);
+    return raylib_capture_target->gen_mesh_plane(width, length, resX, resZ);
+}
+
+static Mesh rl_capture_gen_mesh_cube(float width, float height, float length) {
+    rl_capture_unsupported(RL_CALL_GEN_MESH_CUBE);
+    return raylib_capture_target->gen_mesh_cube(width, height, length);
+}
+
+static Mesh rl_capture_gen_mesh_sphere(float radius, int rings, int slices) {
+    rl_capture_unsupported(RL_CALL_GEN_MESH_SPHERE);
+    return raylib_capture_target->gen_mesh_sphere(radius, rings, slices);
+}
+
+static Mesh rl_capture_gen_mesh_hemi_sphere(float radius, int rings, int slices) {
+    rl_capture_unsupported(RL_CALL_GEN_MESH_HEMI_SPHERE);
+    return raylib_capture_target->gen_mesh_hemi_sphere(radius, rings, slices);
+}
+
+static Mesh rl_capture_gen_mesh_cylinder(float radius, float height, int slices) {
+    rl_capture_unsupported(RL_CALL_GEN_MESH_CYLINDER);
+    return raylib_capture_target->gen_mesh_cylinder(radius, height, slices);
+}
+
+static Mesh rl_capture_gen_mesh_cone(float radius, float height, int slices) {
+    rl_capture_unsupported(RL_CALL_GEN_MESH_CONE);
+    return raylib_capture_target->gen_mesh_cone(radius, height, slices);
+}
+
+static Mesh rl_capture_gen_mesh_torus(float radius, float size, int radSeg, int sides) {
+    rl_capture_unsupported(RL_CALL_GEN_MESH_TORUS);
+    return raylib_capture_target->gen_mesh_torus(radius, size, radSeg, sides);
+}
+
+static Mesh rl_capture_gen_mesh_knot(float radius, float size, int radSeg, int sides) {
+    rl_capture_unsupported(RL_CALL_GEN_MESH_KNOT);
+    return raylib_capture_target->gen_mesh_knot(radius, size, radSeg, sides);
+}
+
+static Mesh rl_capture_gen_mesh_heightmap(Image heightmap, Vector3 size) {
+    rl_capture_unsupported(RL_CALL_GEN_MESH_HEIGHTMAP);
+    return raylib_capture_target->gen_mesh_heightmap(heightmap, size);
+}
+
+static Mesh rl_capture_gen_mesh_cubicmap(Image cubicmap, Vector3 cubeSize) {
+    rl_capture_unsupported(RL_CALL_GEN_MESH_CUBICMAP);
+    return raylib_capture_target->gen_mesh_cubicmap(cubicmap, cubeSize);
+}
+
+static Material * rl_capture_load_materials(const char *fileName, int *materialCount) {
+    rl_capture_unsupported(RL_CALL_LOAD_MATERIALS);
+    return raylib_capture_target->load_materials(fileName, materialCount);
+}
+
+static Material rl_capture_load_material_default(void) {
+    rl_capture_unsupported(RL_CALL_LOAD_MATERIAL_DEFAULT);
+    return raylib_capture_target->load_material_default();
+}
+
+static bool rl_capture_is_material_valid(Material material) {
+    rl_capture_unsupported(RL_CALL_IS_MATERIAL_VALID);
+    return raylib_capture_target->is_material_valid(material);
+}
+
+static void rl_capture_unload_material(Material material) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_MATERIAL);
+    raylib_capture_target->unload_material(material);
+}
+
+static void rl_capture_set_material_texture(Material *material, int mapType, Texture2D texture) {
+    rl_capture_unsupported(RL_CALL_SET_MATERIAL_TEXTURE);
+    raylib_capture_target->set_material_texture(material, mapType, texture);
+}
+
+static void rl_capture_set_model_mesh_material(Model *model, int meshId, int materialId) {
+    rl_capture_unsupported(RL_CALL_SET_MODEL_MESH_MATERIAL);
+    raylib_capture_target->set_model_mesh_material(model, meshId, materialId);
+}
+
+static ModelAnimation * rl_capture_load_model_animations(const char *fileName, int *animCount) {
+    rl_capture_unsupported(RL_CALL_LOAD_MODEL_ANIMATIONS);
+    return raylib_capture_target->load_model_animations(fileName, animCount);
+}
+
+static void rl_capture_update_model_animation(Model model, ModelAnimation anim, int frame) {
+    rl_capture_unsupported(RL_CALL_UPDATE_MODEL_ANIMATION);
+    raylib_capture_target->update_model_animation(model, anim, frame);
+}
+
+static void rl_capture_update_model_animation_bones(Model model, ModelAnimation anim, int frame) {
+    rl_capture_unsupported(RL_CALL_UPDATE_MODEL_ANIMATION_BONES);
+    raylib_capture_target->update_model_animation_bones(model, anim, frame);
+}
+
+static void rl_capture_unload_model_animation(ModelAnimation anim) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_MODEL_ANIMATION);
+    raylib_capture_target->unload_model_animation(anim);
+}
+
+static void rl_capture_unload_model_animations(ModelAnimation *animations, int animCount) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_MODEL_ANIMATIONS);
+    raylib_capture_target->unload_model_animations(animations, animCount);
+}
+
+static bool rl_capture_is_model_animation_valid(Model model, ModelAnimation anim) {
+    rl_capture_unsupported(RL_CALL_IS_MODEL_ANIMATION_VALID);
+    return raylib_capture_target->is_model_animation_valid(model, anim);
+}
+
+static bool rl_capture_check_collision_spheres(Vector3 center1, float radius1, Vector3 center2, float radius2) {
+    rl_capture_begin(RL_CALL_CHECK_COLLISION_SPHERES);
+    rl_capture_value(&center1, sizeof(center1));
+    rl_capture_value(&radius1, sizeof(radius1));
+    rl_capture_value(&center2, sizeof(center2));
+    rl_capture_value(&radius2, sizeof(radius2));
+    bool result = raylib_capture_target->check_collision_spheres(center1, radius1, center2, radius2);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_check_collision_boxes(BoundingBox box1, BoundingBox box2) {
+    rl_capture_begin(RL_CALL_CHECK_COLLISION_BOXES);
+    rl_capture_value(&box1, sizeof(box1));
+    rl_capture_value(&box2, sizeof(box2));
+    bool result = raylib_capture_target->check_collision_boxes(box1, box2);
+    rl_capture_end();
+    return result;
+}
+
+static bool rl_capture_check_collision_box_sphere(BoundingBox box, Vector3 center, float radius) {
+    rl_capture_begin(RL_CALL_CHECK_COLLISION_BOX_SPHERE);
+    rl_capture_value(&box, sizeof(box));
+    rl_capture_value(&center, sizeof(center));
+    rl_capture_value(&radius, sizeof(radius));
+    bool result = raylib_capture_target->check_collision_box_sphere(box, center, radius);
+    rl_capture_end();
+    return result;
+}
+
+static RayCollision rl_capture_get_ray_collision_sphere(Ray ray, Vector3 center, float radius) {
+    rl_capture_unsupported(RL_CALL_GET_RAY_COLLISION_SPHERE);
+    return raylib_capture_target->get_ray_collision_sphere(ray, center, radius);
+}
+
+static RayCollision rl_capture_get_ray_collision_box(Ray ray, BoundingBox box) {
+    rl_capture_unsupported(RL_CALL_GET_RAY_COLLISION_BOX);
+    return raylib_capture_target->get_ray_collision_box(ray, box);
+}
+
+static RayCollision rl_capture_get_ray_collision_mesh(Ray ray, Mesh mesh, Matrix transform) {
+    rl_capture_unsupported(RL_CALL_GET_RAY_COLLISION_MESH);
+    return raylib_capture_target->get_ray_collision_mesh(ray, mesh, transform);
+}
+
+static RayCollision rl_capture_get_ray_collision_triangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3) {
+    rl_capture_unsupported(RL_CALL_GET_RAY_COLLISION_TRIANGLE);
+    return raylib_capture_target->get_ray_collision_triangle(ray, p1, p2, p3);
+}
+
+static RayCollision rl_capture_get_ray_collision_quad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4) {
+    rl_capture_unsupported(RL_CALL_GET_RAY_COLLISION_QUAD);
+    return raylib_capture_target->get_ray_collision_quad(ray, p1, p2, p3, p4);
+}
+
+static void rl_capture_init_audio_device(void) {
+    rl_capture_begin(RL_CALL_INIT_AUDIO_DEVICE);
+    raylib_capture_target->init_audio_device();
+    rl_capture_end();
+}
+
+static void rl_capture_close_audio_device(void) {
+    rl_capture_begin(RL_CALL_CLOSE_AUDIO_DEVICE);
+    raylib_capture_target->close_audio_device();
+    rl_capture_end();
+}
+
+static bool rl_capture_is_audio_device_ready(void) {
+    rl_capture_begin(RL_CALL_IS_AUDIO_DEVICE_READY);
+    bool result = raylib_capture_target->is_audio_device_ready();
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_set_master_volume(float volume) {
+    rl_capture_begin(RL_CALL_SET_MASTER_VOLUME);
+    rl_capture_value(&volume, sizeof(volume));
+    raylib_capture_target->set_master_volume(volume);
+    rl_capture_end();
+}
+
+static float rl_capture_get_master_volume(void) {
+    rl_capture_begin(RL_CALL_GET_MASTER_VOLUME);
+    float result = raylib_capture_target->get_master_volume();
+    rl_capture_end();
+    return result;
+}
+
+static Wave rl_capture_load_wave(const char *fileName) {
+    rl_capture_unsupported(RL_CALL_LOAD_WAVE);
+    return raylib_capture_target->load_wave(fileName);
+}
+
+static Wave rl_capture_load_wave_from_memory(const char *fileType, const unsigned char *fileData, int dataSize) {
+    rl_capture_unsupported(RL_CALL_LOAD_WAVE_FROM_MEMORY);
+    return raylib_capture_target->load_wave_from_memory(fileType, fileData, dataSize);
+}
+
+static bool rl_capture_is_wave_valid(Wave wave) {
+    rl_capture_unsupported(RL_CALL_IS_WAVE_VALID);
+    return raylib_capture_target->is_wave_valid(wave);
+}
+
+static Sound rl_capture_load_sound(const char *fileName) {
+    rl_capture_unsupported(RL_CALL_LOAD_SOUND);
+    return raylib_capture_target->load_sound(fileName);
+}
+
+static Sound rl_capture_load_sound_from_wave(Wave wave) {
+    rl_capture_unsupported(RL_CALL_LOAD_SOUND_FROM_WAVE);
+    return raylib_capture_target->load_sound_from_wave(wave);
+}
+
+static Sound rl_capture_load_sound_alias(Sound source) {
+    rl_capture_unsupported(RL_CALL_LOAD_SOUND_ALIAS);
+    return raylib_capture_target->load_sound_alias(source);
+}
+
+static bool rl_capture_is_sound_valid(Sound sound) {
+    rl_capture_unsupported(RL_CALL_IS_SOUND_VALID);
+    return raylib_capture_target->is_sound_valid(sound);
+}
+
+static void rl_capture_update_sound(Sound sound, const void *data, int sampleCount) {
+    rl_capture_unsupported(RL_CALL_UPDATE_SOUND);
+    raylib_capture_target->update_sound(sound, data, sampleCount);
+}
+
+static void rl_capture_unload_wave(Wave wave) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_WAVE);
+    raylib_capture_target->unload_wave(wave);
+}
+
+static void rl_capture_unload_sound(Sound sound) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_SOUND);
+    raylib_capture_target->unload_sound(sound);
+}
+
+static void rl_capture_unload_sound_alias(Sound alias) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_SOUND_ALIAS);
+    raylib_capture_target->unload_sound_alias(alias);
+}
+
+static bool rl_capture_export_wave(Wave wave, const char *fileName) {
+    rl_capture_unsupported(RL_CALL_EXPORT_WAVE);
+    return raylib_capture_target->export_wave(wave, fileName);
+}
+
+static bool rl_capture_export_wave_as_code(Wave wave, const char *fileName) {
+    rl_capture_unsupported(RL_CALL_EXPORT_WAVE_AS_CODE);
+    return raylib_capture_target->export_wave_as_code(wave, fileName);
+}
+
+static void rl_capture_play_sound(Sound sound) {
+    rl_capture_unsupported(RL_CALL_PLAY_SOUND);
+    raylib_capture_target->play_sound(sound);
+}
+
+static void rl_capture_stop_sound(Sound sound) {
+    rl_capture_unsupported(RL_CALL_STOP_SOUND);
+    raylib_capture_target->stop_sound(sound);
+}
+
+static void rl_capture_pause_sound(Sound sound) {
+    rl_capture_unsupported(RL_CALL_PAUSE_SOUND);
+    raylib_capture_target->pause_sound(sound);
+}
+
+static void rl_capture_resume_sound(Sound sound) {
+    rl_capture_unsupported(RL_CALL_RESUME_SOUND);
+    raylib_capture_target->resume_sound(sound);
+}
+
+static bool rl_capture_is_sound_playing(Sound sound) {
+    rl_capture_unsupported(RL_CALL_IS_SOUND_PLAYING);
+    return raylib_capture_target->is_sound_playing(sound);
+}
+
+static void rl_capture_set_sound_volume(Sound sound, float volume) {
+    rl_capture_unsupported(RL_CALL_SET_SOUND_VOLUME);
+    raylib_capture_target->set_sound_volume(sound, volume);
+}
+
+static void rl_capture_set_sound_pitch(Sound sound, float pitch) {
+    rl_capture_unsupported(RL_CALL_SET_SOUND_PITCH);
+    raylib_capture_target->set_sound_pitch(sound, pitch);
+}
+
+static void rl_capture_set_sound_pan(Sound sound, float pan) {
+    rl_capture_unsupported(RL_CALL_SET_SOUND_PAN);
+    raylib_capture_target->set_sound_pan(sound, pan);
+}
+
+static Wave rl_capture_wave_copy(Wave wave) {
+    rl_capture_unsupported(RL_CALL_WAVE_COPY);
+    return raylib_capture_target->wave_copy(wave);
+}
+
+static void rl_capture_wave_crop(Wave *wave, int initFrame, int finalFrame) {
+    rl_capture_unsupported(RL_CALL_WAVE_CROP);
+    raylib_capture_target->wave_crop(wave, initFrame, finalFrame);
+}
+
+static void rl_capture_wave_format(Wave *wave, int sampleRate, int sampleSize, int channels) {
+    rl_capture_unsupported(RL_CALL_WAVE_FORMAT);
+    raylib_capture_target->wave_format(wave, sampleRate, sampleSize, channels);
+}
+
+static float * rl_capture_load_wave_samples(Wave wave) {
+    rl_capture_unsupported(RL_CALL_LOAD_WAVE_SAMPLES);
+    return raylib_capture_target->load_wave_samples(wave);
+}
+
+static void rl_capture_unload_wave_samples(float *samples) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_WAVE_SAMPLES);
+    raylib_capture_target->unload_wave_samples(samples);
+}
+
+static Music rl_capture_load_music_stream(const char *fileName) {
+    rl_capture_unsupported(RL_CALL_LOAD_MUSIC_STREAM);
+    return raylib_capture_target->load_music_stream(fileName);
+}
+
+static Music rl_capture_load_music_stream_from_memory(const char *fileType, const unsigned char *data, int dataSize) {
+    rl_capture_unsupported(RL_CALL_LOAD_MUSIC_STREAM_FROM_MEMORY);
+    return raylib_capture_target->load_music_stream_from_memory(fileType, data, dataSize);
+}
+
+static bool rl_capture_is_music_valid(Music music) {
+    rl_capture_unsupported(RL_CALL_IS_MUSIC_VALID);
+    return raylib_capture_target->is_music_valid(music);
+}
+
+static void rl_capture_unload_music_stream(Music music) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_MUSIC_STREAM);
+    raylib_capture_target->unload_music_stream(music);
+}
+
+static void rl_capture_play_music_stream(Music music) {
+    rl_capture_unsupported(RL_CALL_PLAY_MUSIC_STREAM);
+    raylib_capture_target->play_music_stream(music);
+}
+
+static bool rl_capture_is_music_stream_playing(Music music) {
+    rl_capture_unsupported(RL_CALL_IS_MUSIC_STREAM_PLAYING);
+    return raylib_capture_target->is_music_stream_playing(music);
+}
+
+static void rl_capture_update_music_stream(Music music) {
+    rl_capture_unsupported(RL_CALL_UPDATE_MUSIC_STREAM);
+    raylib_capture_target->update_music_stream(music);
+}
+
+static void rl_capture_stop_music_stream(Music music) {
+    rl_capture_unsupported(RL_CALL_STOP_MUSIC_STREAM);
+    raylib_capture_target->stop_music_stream(music);
+}
+
+static void rl_capture_pause_music_stream(Music music) {
+    rl_capture_unsupported(RL_CALL_PAUSE_MUSIC_STREAM);
+    raylib_capture_target->pause_music_stream(music);
+}
+
+static void rl_capture_resume_music_stream(Music music) {
+    rl_capture_unsupported(RL_CALL_RESUME_MUSIC_STREAM);
+    raylib_capture_target->resume_music_stream(music);
+}
+
+static void rl_capture_seek_music_stream(Music music, float position) {
+    rl_capture_unsupported(RL_CALL_SEEK_MUSIC_STREAM);
+    raylib_capture_target->seek_music_stream(music, position);
+}
+
+static void rl_capture_set_music_volume(Music music, float volume) {
+    rl_capture_unsupported(RL_CALL_SET_MUSIC_VOLUME);
+    raylib_capture_target->set_music_volume(music, volume);
+}
+
+static void rl_capture_set_music_pitch(Music music, float pitch) {
+    rl_capture_unsupported(RL_CALL_SET_MUSIC_PITCH);
+    raylib_capture_target->set_music_pitch(music, pitch);
+}
+
+static void rl_capture_set_music_pan(Music music, float pan) {
+    rl_capture_unsupported(RL_CALL_SET_MUSIC_PAN);
+    raylib_capture_target->set_music_pan(music, pan);
+}
+
+static float rl_capture_get_music_time_length(Music music) {
+    rl_capture_unsupported(RL_CALL_GET_MUSIC_TIME_LENGTH);
+    return raylib_capture_target->get_music_time_length(music);
+}
+
+static float rl_capture_get_music_time_played(Music music) {
+    rl_capture_unsupported(RL_CALL_GET_MUSIC_TIME_PLAYED);
+    return raylib_capture_target->get_music_time_played(music);
+}
+
+static AudioStream rl_capture_load_audio_stream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels) {
+    rl_capture_unsupported(RL_CALL_LOAD_AUDIO_STREAM);
+    return raylib_capture_target->load_audio_stream(sampleRate, sampleSize, channels);
+}
+
+static bool rl_capture_is_audio_stream_valid(AudioStream stream) {
+    rl_capture_unsupported(RL_CALL_IS_AUDIO_STREAM_VALID);
+    return raylib_capture_target->is_audio_stream_valid(stream);
+}
+
+static void rl_capture_unload_audio_stream(AudioStream stream) {
+    rl_capture_unsupported(RL_CALL_UNLOAD_AUDIO_STREAM);
+    raylib_capture_target->unload_audio_stream(stream);
+}
+
+static void rl_capture_update_audio_stream(AudioStream stream, const void *data, int frameCount) {
+    rl_capture_unsupported(RL_CALL_UPDATE_AUDIO_STREAM);
+    raylib_capture_target->update_audio_stream(stream, data, frameCount);
+}
+
+static bool rl_capture_is_audio_stream_processed(AudioStream stream) {
+    rl_capture_unsupported(RL_CALL_IS_AUDIO_STREAM_PROCESSED);
+    return raylib_capture_target->is_audio_stream_processed(stream);
+}
+
+static void rl_capture_play_audio_stream(AudioStream stream) {
+    rl_capture_unsupported(RL_CALL_PLAY_AUDIO_STREAM);
+    raylib_capture_target->play_audio_stream(stream);
+}
+
+static void rl_capture_pause_audio_stream(AudioStream stream) {
+    rl_capture_unsupported(RL_CALL_PAUSE_AUDIO_STREAM);
+    raylib_capture_target->pause_audio_stream(stream);
+}
+
+static void rl_capture_resume_audio_stream(AudioStream stream) {
+    rl_capture_unsupported(RL_CALL_RESUME_AUDIO_STREAM);
+    raylib_capture_target->resume_audio_stream(stream);
+}
+
+static bool rl_capture_is_audio_stream_playing(AudioStream stream) {
+    rl_capture_unsupported(RL_CALL_IS_AUDIO_STREAM_PLAYING);
+    return raylib_capture_target->is_audio_stream_playing(stream);
+}
+
+static void rl_capture_stop_audio_stream(AudioStream stream) {
+    rl_capture_unsupported(RL_CALL_STOP_AUDIO_STREAM);
+    raylib_capture_target->stop_audio_stream(stream);
+}
+
+static void rl_capture_set_audio_stream_volume(AudioStream stream, float volume) {
+    rl_capture_unsupported(RL_CALL_SET_AUDIO_STREAM_VOLUME);
+    raylib_capture_target->set_audio_stream_volume(stream, volume);
+}
+
+static void rl_capture_set_audio_stream_pitch(AudioStream stream, float pitch) {
+    rl_capture_unsupported(RL_CALL_SET_AUDIO_STREAM_PITCH);
+    raylib_capture_target->set_audio_stream_pitch(stream, pitch);
+}
+
+static void rl_capture_set_audio_stream_pan(AudioStream stream, float pan) {
+    rl_capture_unsupported(RL_CALL_SET_AUDIO_STREAM_PAN);
+    raylib_capture_target->set_audio_stream_pan(stream, pan);
+}
+
+static void rl_capture_set_audio_stream_buffer_size_default(int size) {
+    rl_capture_begin(RL_CALL_SET_AUDIO_STREAM_BUFFER_SIZE_DEFAULT);
+    rl_capture_value(&size, sizeof(size));
+    raylib_capture_target->set_audio_stream_buffer_size_default(size);
+    rl_capture_end();
+}
+
+static void rl_capture_set_audio_stream_callback(AudioStream stream, AudioCallback callback) {
+    rl_capture_unsupported(RL_CALL_SET_AUDIO_STREAM_CALLBACK);
+    raylib_capture_target->set_audio_stream_callback(stream, callback);
+}
+
+static void rl_capture_attach_audio_stream_processor(AudioStream stream, AudioCallback processor) {
+    rl_capture_unsupported(RL_CALL_ATTACH_AUDIO_STREAM_PROCESSOR);
+    raylib_capture_target->attach_audio_stream_processor(stream, processor);
+}
+
+static void rl_capture_detach_audio_stream_processor(AudioStream stream, AudioCallback processor) {
+    rl_capture_unsupported(RL_CALL_DETACH_AUDIO_STREAM_PROCESSOR);
+    raylib_capture_target->detach_audio_stream_processor(stream, processor);
+}
+
+static void rl_capture_attach_audio_mixed_processor(AudioCallback processor) {
+    rl_capture_unsupported(RL_CALL_ATTACH_AUDIO_MIXED_PROCESSOR);
+    raylib_capture_target->attach_audio_mixed_processor(processor);
+}
+
+static void rl_capture_detach_audio_mixed_processor(AudioCallback processor) {
+    rl_capture_unsupported(RL_CALL_DETACH_AUDIO_MIXED_PROCESSOR);
+    raylib_capture_target->detach_audio_mixed_processor(processor);
+}
+
+static float rl_capture_clamp(float value, float min, float max) {
+    rl_capture_begin(RL_CALL_CLAMP);
+    rl_capture_value(&value, sizeof(value));
+    rl_capture_value(&min, sizeof(min));
+    rl_capture_value(&max, sizeof(max));
+    float result = raylib_capture_target->clamp(value, min, max);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_lerp(float start, float end, float amount) {
+    rl_capture_begin(RL_CALL_LERP);
+    rl_capture_value(&start, sizeof(start));
+    rl_capture_value(&end, sizeof(end));
+    rl_capture_value(&amount, sizeof(amount));
+    float result = raylib_capture_target->lerp(start, end, amount);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_normalize(float value, float start, float end) {
+    rl_capture_begin(RL_CALL_NORMALIZE);
+    rl_capture_value(&value, sizeof(value));
+    rl_capture_value(&start, sizeof(start));
+    rl_capture_value(&end, sizeof(end));
+    float result = raylib_capture_target->normalize(value, start, end);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_remap(float value, float inputStart, float inputEnd, float outputStart, float outputEnd) {
+    rl_capture_begin(RL_CALL_REMAP);
+    rl_capture_value(&value, sizeof(value));
+    rl_capture_value(&inputStart, sizeof(inputStart));
+    rl_capture_value(&inputEnd, sizeof(inputEnd));
+    rl_capture_value(&outputStart, sizeof(outputStart));
+    rl_capture_value(&outputEnd, sizeof(outputEnd));
+    float result = raylib_capture_target->remap(value, inputStart, inputEnd, outputStart, outputEnd);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_wrap(float value, float min, float max) {
+    rl_capture_begin(RL_CALL_WRAP);
+    rl_capture_value(&value, sizeof(value));
+    rl_capture_value(&min, sizeof(min));
+    rl_capture_value(&max, sizeof(max));
+    float result = raylib_capture_target->wrap(value, min, max);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_float_equals(float x, float y) {
+    rl_capture_begin(RL_CALL_FLOAT_EQUALS);
+    rl_capture_value(&x, sizeof(x));
+    rl_capture_value(&y, sizeof(y));
+    int result = raylib_capture_target->float_equals(x, y);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_zero(void) {
+    rl_capture_begin(RL_CALL_VECTOR2_ZERO);
+    Vector2 result = raylib_capture_target->vector2_zero();
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_one(void) {
+    rl_capture_begin(RL_CALL_VECTOR2_ONE);
+    Vector2 result = raylib_capture_target->vector2_one();
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_add(Vector2 v1, Vector2 v2) {
+    rl_capture_begin(RL_CALL_VECTOR2_ADD);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector2 result = raylib_capture_target->vector2_add(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_add_value(Vector2 v, float add) {
+    rl_capture_begin(RL_CALL_VECTOR2_ADD_VALUE);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&add, sizeof(add));
+    Vector2 result = raylib_capture_target->vector2_add_value(v, add);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_subtract(Vector2 v1, Vector2 v2) {
+    rl_capture_begin(RL_CALL_VECTOR2_SUBTRACT);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector2 result = raylib_capture_target->vector2_subtract(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_subtract_value(Vector2 v, float sub) {
+    rl_capture_begin(RL_CALL_VECTOR2_SUBTRACT_VALUE);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&sub, sizeof(sub));
+    Vector2 result = raylib_capture_target->vector2_subtract_value(v, sub);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_vector2_length(Vector2 v) {
+    rl_capture_begin(RL_CALL_VECTOR2_LENGTH);
+    rl_capture_value(&v, sizeof(v));
+    float result = raylib_capture_target->vector2_length(v);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_vector2_length_sqr(Vector2 v) {
+    rl_capture_begin(RL_CALL_VECTOR2_LENGTH_SQR);
+    rl_capture_value(&v, sizeof(v));
+    float result = raylib_capture_target->vector2_length_sqr(v);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_vector2_dot_product(Vector2 v1, Vector2 v2) {
+    rl_capture_begin(RL_CALL_VECTOR2_DOT_PRODUCT);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    float result = raylib_capture_target->vector2_dot_product(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_vector2_distance(Vector2 v1, Vector2 v2) {
+    rl_capture_begin(RL_CALL_VECTOR2_DISTANCE);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    float result = raylib_capture_target->vector2_distance(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_vector2_distance_sqr(Vector2 v1, Vector2 v2) {
+    rl_capture_begin(RL_CALL_VECTOR2_DISTANCE_SQR);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    float result = raylib_capture_target->vector2_distance_sqr(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_vector2_angle(Vector2 v1, Vector2 v2) {
+    rl_capture_begin(RL_CALL_VECTOR2_ANGLE);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    float result = raylib_capture_target->vector2_angle(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_vector2_line_angle(Vector2 start, Vector2 end) {
+    rl_capture_begin(RL_CALL_VECTOR2_LINE_ANGLE);
+    rl_capture_value(&start, sizeof(start));
+    rl_capture_value(&end, sizeof(end));
+    float result = raylib_capture_target->vector2_line_angle(start, end);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_scale(Vector2 v, float scale) {
+    rl_capture_begin(RL_CALL_VECTOR2_SCALE);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&scale, sizeof(scale));
+    Vector2 result = raylib_capture_target->vector2_scale(v, scale);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_multiply(Vector2 v1, Vector2 v2) {
+    rl_capture_begin(RL_CALL_VECTOR2_MULTIPLY);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector2 result = raylib_capture_target->vector2_multiply(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_negate(Vector2 v) {
+    rl_capture_begin(RL_CALL_VECTOR2_NEGATE);
+    rl_capture_value(&v, sizeof(v));
+    Vector2 result = raylib_capture_target->vector2_negate(v);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_divide(Vector2 v1, Vector2 v2) {
+    rl_capture_begin(RL_CALL_VECTOR2_DIVIDE);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector2 result = raylib_capture_target->vector2_divide(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_normalize(Vector2 v) {
+    rl_capture_begin(RL_CALL_VECTOR2_NORMALIZE);
+    rl_capture_value(&v, sizeof(v));
+    Vector2 result = raylib_capture_target->vector2_normalize(v);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_transform(Vector2 v, Matrix mat) {
+    rl_capture_begin(RL_CALL_VECTOR2_TRANSFORM);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&mat, sizeof(mat));
+    Vector2 result = raylib_capture_target->vector2_transform(v, mat);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_lerp(Vector2 v1, Vector2 v2, float amount) {
+    rl_capture_begin(RL_CALL_VECTOR2_LERP);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    rl_capture_value(&amount, sizeof(amount));
+    Vector2 result = raylib_capture_target->vector2_lerp(v1, v2, amount);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_reflect(Vector2 v, Vector2 normal) {
+    rl_capture_begin(RL_CALL_VECTOR2_REFLECT);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&normal, sizeof(normal));
+    Vector2 result = raylib_capture_target->vector2_reflect(v, normal);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_min(Vector2 v1, Vector2 v2) {
+    rl_capture_begin(RL_CALL_VECTOR2_MIN);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector2 result = raylib_capture_target->vector2_min(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_max(Vector2 v1, Vector2 v2) {
+    rl_capture_begin(RL_CALL_VECTOR2_MAX);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector2 result = raylib_capture_target->vector2_max(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_rotate(Vector2 v, float angle) {
+    rl_capture_begin(RL_CALL_VECTOR2_ROTATE);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&angle, sizeof(angle));
+    Vector2 result = raylib_capture_target->vector2_rotate(v, angle);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_move_towards(Vector2 v, Vector2 target, float maxDistance) {
+    rl_capture_begin(RL_CALL_VECTOR2_MOVE_TOWARDS);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&target, sizeof(target));
+    rl_capture_value(&maxDistance, sizeof(maxDistance));
+    Vector2 result = raylib_capture_target->vector2_move_towards(v, target, maxDistance);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_invert(Vector2 v) {
+    rl_capture_begin(RL_CALL_VECTOR2_INVERT);
+    rl_capture_value(&v, sizeof(v));
+    Vector2 result = raylib_capture_target->vector2_invert(v);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_clamp(Vector2 v, Vector2 min, Vector2 max) {
+    rl_capture_begin(RL_CALL_VECTOR2_CLAMP);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&min, sizeof(min));
+    rl_capture_value(&max, sizeof(max));
+    Vector2 result = raylib_capture_target->vector2_clamp(v, min, max);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_clamp_value(Vector2 v, float min, float max) {
+    rl_capture_begin(RL_CALL_VECTOR2_CLAMP_VALUE);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&min, sizeof(min));
+    rl_capture_value(&max, sizeof(max));
+    Vector2 result = raylib_capture_target->vector2_clamp_value(v, min, max);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_vector2_equals(Vector2 p, Vector2 q) {
+    rl_capture_begin(RL_CALL_VECTOR2_EQUALS);
+    rl_capture_value(&p, sizeof(p));
+    rl_capture_value(&q, sizeof(q));
+    int result = raylib_capture_target->vector2_equals(p, q);
+    rl_capture_end();
+    return result;
+}
+
+static Vector2 rl_capture_vector2_refract(Vector2 v, Vector2 n, float r) {
+    rl_capture_begin(RL_CALL_VECTOR2_REFRACT);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&n, sizeof(n));
+    rl_capture_value(&r, sizeof(r));
+    Vector2 result = raylib_capture_target->vector2_refract(v, n, r);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_zero(void) {
+    rl_capture_begin(RL_CALL_VECTOR3_ZERO);
+    Vector3 result = raylib_capture_target->vector3_zero();
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_one(void) {
+    rl_capture_begin(RL_CALL_VECTOR3_ONE);
+    Vector3 result = raylib_capture_target->vector3_one();
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_add(Vector3 v1, Vector3 v2) {
+    rl_capture_begin(RL_CALL_VECTOR3_ADD);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector3 result = raylib_capture_target->vector3_add(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_add_value(Vector3 v, float add) {
+    rl_capture_begin(RL_CALL_VECTOR3_ADD_VALUE);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&add, sizeof(add));
+    Vector3 result = raylib_capture_target->vector3_add_value(v, add);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_subtract(Vector3 v1, Vector3 v2) {
+    rl_capture_begin(RL_CALL_VECTOR3_SUBTRACT);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector3 result = raylib_capture_target->vector3_subtract(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_subtract_value(Vector3 v, float sub) {
+    rl_capture_begin(RL_CALL_VECTOR3_SUBTRACT_VALUE);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&sub, sizeof(sub));
+    Vector3 result = raylib_capture_target->vector3_subtract_value(v, sub);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_scale(Vector3 v, float scalar) {
+    rl_capture_begin(RL_CALL_VECTOR3_SCALE);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&scalar, sizeof(scalar));
+    Vector3 result = raylib_capture_target->vector3_scale(v, scalar);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_multiply(Vector3 v1, Vector3 v2) {
+    rl_capture_begin(RL_CALL_VECTOR3_MULTIPLY);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector3 result = raylib_capture_target->vector3_multiply(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_cross_product(Vector3 v1, Vector3 v2) {
+    rl_capture_begin(RL_CALL_VECTOR3_CROSS_PRODUCT);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector3 result = raylib_capture_target->vector3_cross_product(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_perpendicular(Vector3 v) {
+    rl_capture_begin(RL_CALL_VECTOR3_PERPENDICULAR);
+    rl_capture_value(&v, sizeof(v));
+    Vector3 result = raylib_capture_target->vector3_perpendicular(v);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_vector3_length(const Vector3 v) {
+    rl_capture_begin(RL_CALL_VECTOR3_LENGTH);
+    rl_capture_value(&v, sizeof(v));
+    float result = raylib_capture_target->vector3_length(v);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_vector3_length_sqr(const Vector3 v) {
+    rl_capture_begin(RL_CALL_VECTOR3_LENGTH_SQR);
+    rl_capture_value(&v, sizeof(v));
+    float result = raylib_capture_target->vector3_length_sqr(v);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_vector3_dot_product(Vector3 v1, Vector3 v2) {
+    rl_capture_begin(RL_CALL_VECTOR3_DOT_PRODUCT);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    float result = raylib_capture_target->vector3_dot_product(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_vector3_distance(Vector3 v1, Vector3 v2) {
+    rl_capture_begin(RL_CALL_VECTOR3_DISTANCE);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    float result = raylib_capture_target->vector3_distance(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_vector3_distance_sqr(Vector3 v1, Vector3 v2) {
+    rl_capture_begin(RL_CALL_VECTOR3_DISTANCE_SQR);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    float result = raylib_capture_target->vector3_distance_sqr(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_vector3_angle(Vector3 v1, Vector3 v2) {
+    rl_capture_begin(RL_CALL_VECTOR3_ANGLE);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    float result = raylib_capture_target->vector3_angle(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_negate(Vector3 v) {
+    rl_capture_begin(RL_CALL_VECTOR3_NEGATE);
+    rl_capture_value(&v, sizeof(v));
+    Vector3 result = raylib_capture_target->vector3_negate(v);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_divide(Vector3 v1, Vector3 v2) {
+    rl_capture_begin(RL_CALL_VECTOR3_DIVIDE);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector3 result = raylib_capture_target->vector3_divide(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_normalize(Vector3 v) {
+    rl_capture_begin(RL_CALL_VECTOR3_NORMALIZE);
+    rl_capture_value(&v, sizeof(v));
+    Vector3 result = raylib_capture_target->vector3_normalize(v);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_project(Vector3 v1, Vector3 v2) {
+    rl_capture_begin(RL_CALL_VECTOR3_PROJECT);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector3 result = raylib_capture_target->vector3_project(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_reject(Vector3 v1, Vector3 v2) {
+    rl_capture_begin(RL_CALL_VECTOR3_REJECT);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector3 result = raylib_capture_target->vector3_reject(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_vector3_ortho_normalize(Vector3 *v1, Vector3 *v2) {
+    rl_capture_unsupported(RL_CALL_VECTOR3_ORTHO_NORMALIZE);
+    raylib_capture_target->vector3_ortho_normalize(v1, v2);
+}
+
+static Vector3 rl_capture_vector3_transform(Vector3 v, Matrix mat) {
+    rl_capture_begin(RL_CALL_VECTOR3_TRANSFORM);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&mat, sizeof(mat));
+    Vector3 result = raylib_capture_target->vector3_transform(v, mat);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_rotate_by_quaternion(Vector3 v, Quaternion q) {
+    rl_capture_begin(RL_CALL_VECTOR3_ROTATE_BY_QUATERNION);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&q, sizeof(q));
+    Vector3 result = raylib_capture_target->vector3_rotate_by_quaternion(v, q);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_rotate_by_axis_angle(Vector3 v, Vector3 axis, float angle) {
+    rl_capture_begin(RL_CALL_VECTOR3_ROTATE_BY_AXIS_ANGLE);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&axis, sizeof(axis));
+    rl_capture_value(&angle, sizeof(angle));
+    Vector3 result = raylib_capture_target->vector3_rotate_by_axis_angle(v, axis, angle);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_move_towards(Vector3 v, Vector3 target, float maxDistance) {
+    rl_capture_begin(RL_CALL_VECTOR3_MOVE_TOWARDS);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&target, sizeof(target));
+    rl_capture_value(&maxDistance, sizeof(maxDistance));
+    Vector3 result = raylib_capture_target->vector3_move_towards(v, target, maxDistance);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_lerp(Vector3 v1, Vector3 v2, float amount) {
+    rl_capture_begin(RL_CALL_VECTOR3_LERP);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    rl_capture_value(&amount, sizeof(amount));
+    Vector3 result = raylib_capture_target->vector3_lerp(v1, v2, amount);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_cubic_hermite(Vector3 v1, Vector3 tangent1, Vector3 v2, Vector3 tangent2, float amount) {
+    rl_capture_begin(RL_CALL_VECTOR3_CUBIC_HERMITE);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&tangent1, sizeof(tangent1));
+    rl_capture_value(&v2, sizeof(v2));
+    rl_capture_value(&tangent2, sizeof(tangent2));
+    rl_capture_value(&amount, sizeof(amount));
+    Vector3 result = raylib_capture_target->vector3_cubic_hermite(v1, tangent1, v2, tangent2, amount);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_reflect(Vector3 v, Vector3 normal) {
+    rl_capture_begin(RL_CALL_VECTOR3_REFLECT);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&normal, sizeof(normal));
+    Vector3 result = raylib_capture_target->vector3_reflect(v, normal);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_min(Vector3 v1, Vector3 v2) {
+    rl_capture_begin(RL_CALL_VECTOR3_MIN);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector3 result = raylib_capture_target->vector3_min(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_max(Vector3 v1, Vector3 v2) {
+    rl_capture_begin(RL_CALL_VECTOR3_MAX);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector3 result = raylib_capture_target->vector3_max(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_barycenter(Vector3 p, Vector3 a, Vector3 b, Vector3 c) {
+    rl_capture_begin(RL_CALL_VECTOR3_BARYCENTER);
+    rl_capture_value(&p, sizeof(p));
+    rl_capture_value(&a, sizeof(a));
+    rl_capture_value(&b, sizeof(b));
+    rl_capture_value(&c, sizeof(c));
+    Vector3 result = raylib_capture_target->vector3_barycenter(p, a, b, c);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_unproject(Vector3 source, Matrix projection, Matrix view) {
+    rl_capture_begin(RL_CALL_VECTOR3_UNPROJECT);
+    rl_capture_value(&source, sizeof(source));
+    rl_capture_value(&projection, sizeof(projection));
+    rl_capture_value(&view, sizeof(view));
+    Vector3 result = raylib_capture_target->vector3_unproject(source, projection, view);
+    rl_capture_end();
+    return result;
+}
+
+static float3 rl_capture_vector3_to_float_v(Vector3 v) {
+    rl_capture_unsupported(RL_CALL_VECTOR3_TO_FLOAT_V);
+    return raylib_capture_target->vector3_to_float_v(v);
+}
+
+static Vector3 rl_capture_vector3_invert(Vector3 v) {
+    rl_capture_begin(RL_CALL_VECTOR3_INVERT);
+    rl_capture_value(&v, sizeof(v));
+    Vector3 result = raylib_capture_target->vector3_invert(v);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_clamp(Vector3 v, Vector3 min, Vector3 max) {
+    rl_capture_begin(RL_CALL_VECTOR3_CLAMP);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&min, sizeof(min));
+    rl_capture_value(&max, sizeof(max));
+    Vector3 result = raylib_capture_target->vector3_clamp(v, min, max);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_clamp_value(Vector3 v, float min, float max) {
+    rl_capture_begin(RL_CALL_VECTOR3_CLAMP_VALUE);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&min, sizeof(min));
+    rl_capture_value(&max, sizeof(max));
+    Vector3 result = raylib_capture_target->vector3_clamp_value(v, min, max);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_vector3_equals(Vector3 p, Vector3 q) {
+    rl_capture_begin(RL_CALL_VECTOR3_EQUALS);
+    rl_capture_value(&p, sizeof(p));
+    rl_capture_value(&q, sizeof(q));
+    int result = raylib_capture_target->vector3_equals(p, q);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_vector3_refract(Vector3 v, Vector3 n, float r) {
+    rl_capture_begin(RL_CALL_VECTOR3_REFRACT);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&n, sizeof(n));
+    rl_capture_value(&r, sizeof(r));
+    Vector3 result = raylib_capture_target->vector3_refract(v, n, r);
+    rl_capture_end();
+    return result;
+}
+
+static Vector4 rl_capture_vector4_zero(void) {
+    rl_capture_begin(RL_CALL_VECTOR4_ZERO);
+    Vector4 result = raylib_capture_target->vector4_zero();
+    rl_capture_end();
+    return result;
+}
+
+static Vector4 rl_capture_vector4_one(void) {
+    rl_capture_begin(RL_CALL_VECTOR4_ONE);
+    Vector4 result = raylib_capture_target->vector4_one();
+    rl_capture_end();
+    return result;
+}
+
+static Vector4 rl_capture_vector4_add(Vector4 v1, Vector4 v2) {
+    rl_capture_begin(RL_CALL_VECTOR4_ADD);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector4 result = raylib_capture_target->vector4_add(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector4 rl_capture_vector4_add_value(Vector4 v, float add) {
+    rl_capture_begin(RL_CALL_VECTOR4_ADD_VALUE);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&add, sizeof(add));
+    Vector4 result = raylib_capture_target->vector4_add_value(v, add);
+    rl_capture_end();
+    return result;
+}
+
+static Vector4 rl_capture_vector4_subtract(Vector4 v1, Vector4 v2) {
+    rl_capture_begin(RL_CALL_VECTOR4_SUBTRACT);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector4 result = raylib_capture_target->vector4_subtract(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector4 rl_capture_vector4_subtract_value(Vector4 v, float add) {
+    rl_capture_begin(RL_CALL_VECTOR4_SUBTRACT_VALUE);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&add, sizeof(add));
+    Vector4 result = raylib_capture_target->vector4_subtract_value(v, add);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_vector4_length(Vector4 v) {
+    rl_capture_begin(RL_CALL_VECTOR4_LENGTH);
+    rl_capture_value(&v, sizeof(v));
+    float result = raylib_capture_target->vector4_length(v);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_vector4_length_sqr(Vector4 v) {
+    rl_capture_begin(RL_CALL_VECTOR4_LENGTH_SQR);
+    rl_capture_value(&v, sizeof(v));
+    float result = raylib_capture_target->vector4_length_sqr(v);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_vector4_dot_product(Vector4 v1, Vector4 v2) {
+    rl_capture_begin(RL_CALL_VECTOR4_DOT_PRODUCT);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    float result = raylib_capture_target->vector4_dot_product(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_vector4_distance(Vector4 v1, Vector4 v2) {
+    rl_capture_begin(RL_CALL_VECTOR4_DISTANCE);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    float result = raylib_capture_target->vector4_distance(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_vector4_distance_sqr(Vector4 v1, Vector4 v2) {
+    rl_capture_begin(RL_CALL_VECTOR4_DISTANCE_SQR);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    float result = raylib_capture_target->vector4_distance_sqr(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector4 rl_capture_vector4_scale(Vector4 v, float scale) {
+    rl_capture_begin(RL_CALL_VECTOR4_SCALE);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&scale, sizeof(scale));
+    Vector4 result = raylib_capture_target->vector4_scale(v, scale);
+    rl_capture_end();
+    return result;
+}
+
+static Vector4 rl_capture_vector4_multiply(Vector4 v1, Vector4 v2) {
+    rl_capture_begin(RL_CALL_VECTOR4_MULTIPLY);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector4 result = raylib_capture_target->vector4_multiply(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector4 rl_capture_vector4_negate(Vector4 v) {
+    rl_capture_begin(RL_CALL_VECTOR4_NEGATE);
+    rl_capture_value(&v, sizeof(v));
+    Vector4 result = raylib_capture_target->vector4_negate(v);
+    rl_capture_end();
+    return result;
+}
+
+static Vector4 rl_capture_vector4_divide(Vector4 v1, Vector4 v2) {
+    rl_capture_begin(RL_CALL_VECTOR4_DIVIDE);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector4 result = raylib_capture_target->vector4_divide(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector4 rl_capture_vector4_normalize(Vector4 v) {
+    rl_capture_begin(RL_CALL_VECTOR4_NORMALIZE);
+    rl_capture_value(&v, sizeof(v));
+    Vector4 result = raylib_capture_target->vector4_normalize(v);
+    rl_capture_end();
+    return result;
+}
+
+static Vector4 rl_capture_vector4_min(Vector4 v1, Vector4 v2) {
+    rl_capture_begin(RL_CALL_VECTOR4_MIN);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector4 result = raylib_capture_target->vector4_min(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector4 rl_capture_vector4_max(Vector4 v1, Vector4 v2) {
+    rl_capture_begin(RL_CALL_VECTOR4_MAX);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    Vector4 result = raylib_capture_target->vector4_max(v1, v2);
+    rl_capture_end();
+    return result;
+}
+
+static Vector4 rl_capture_vector4_lerp(Vector4 v1, Vector4 v2, float amount) {
+    rl_capture_begin(RL_CALL_VECTOR4_LERP);
+    rl_capture_value(&v1, sizeof(v1));
+    rl_capture_value(&v2, sizeof(v2));
+    rl_capture_value(&amount, sizeof(amount));
+    Vector4 result = raylib_capture_target->vector4_lerp(v1, v2, amount);
+    rl_capture_end();
+    return result;
+}
+
+static Vector4 rl_capture_vector4_move_towards(Vector4 v, Vector4 target, float maxDistance) {
+    rl_capture_begin(RL_CALL_VECTOR4_MOVE_TOWARDS);
+    rl_capture_value(&v, sizeof(v));
+    rl_capture_value(&target, sizeof(target));
+    rl_capture_value(&maxDistance, sizeof(maxDistance));
+    Vector4 result = raylib_capture_target->vector4_move_towards(v, target, maxDistance);
+    rl_capture_end();
+    return result;
+}
+
+static Vector4 rl_capture_vector4_invert(Vector4 v) {
+    rl_capture_begin(RL_CALL_VECTOR4_INVERT);
+    rl_capture_value(&v, sizeof(v));
+    Vector4 result = raylib_capture_target->vector4_invert(v);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_vector4_equals(Vector4 p, Vector4 q) {
+    rl_capture_begin(RL_CALL_VECTOR4_EQUALS);
+    rl_capture_value(&p, sizeof(p));
+    rl_capture_value(&q, sizeof(q));
+    int result = raylib_capture_target->vector4_equals(p, q);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_matrix_determinant(Matrix mat) {
+    rl_capture_begin(RL_CALL_MATRIX_DETERMINANT);
+    rl_capture_value(&mat, sizeof(mat));
+    float result = raylib_capture_target->matrix_determinant(mat);
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_matrix_trace(Matrix mat) {
+    rl_capture_begin(RL_CALL_MATRIX_TRACE);
+    rl_capture_value(&mat, sizeof(mat));
+    float result = raylib_capture_target->matrix_trace(mat);
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_matrix_transpose(Matrix mat) {
+    rl_capture_begin(RL_CALL_MATRIX_TRANSPOSE);
+    rl_capture_value(&mat, sizeof(mat));
+    Matrix result = raylib_capture_target->matrix_transpose(mat);
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_matrix_invert(Matrix mat) {
+    rl_capture_begin(RL_CALL_MATRIX_INVERT);
+    rl_capture_value(&mat, sizeof(mat));
+    Matrix result = raylib_capture_target->matrix_invert(mat);
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_matrix_identity(void) {
+    rl_capture_begin(RL_CALL_MATRIX_IDENTITY);
+    Matrix result = raylib_capture_target->matrix_identity();
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_matrix_add(Matrix left, Matrix right) {
+    rl_capture_begin(RL_CALL_MATRIX_ADD);
+    rl_capture_value(&left, sizeof(left));
+    rl_capture_value(&right, sizeof(right));
+    Matrix result = raylib_capture_target->matrix_add(left, right);
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_matrix_subtract(Matrix left, Matrix right) {
+    rl_capture_begin(RL_CALL_MATRIX_SUBTRACT);
+    rl_capture_value(&left, sizeof(left));
+    rl_capture_value(&right, sizeof(right));
+    Matrix result = raylib_capture_target->matrix_subtract(left, right);
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_matrix_multiply(Matrix left, Matrix right) {
+    rl_capture_begin(RL_CALL_MATRIX_MULTIPLY);
+    rl_capture_value(&left, sizeof(left));
+    rl_capture_value(&right, sizeof(right));
+    Matrix result = raylib_capture_target->matrix_multiply(left, right);
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_matrix_translate(float x, float y, float z) {
+    rl_capture_begin(RL_CALL_MATRIX_TRANSLATE);
+    rl_capture_value(&x, sizeof(x));
+    rl_capture_value(&y, sizeof(y));
+    rl_capture_value(&z, sizeof(z));
+    Matrix result = raylib_capture_target->matrix_translate(x, y, z);
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_matrix_rotate(Vector3 axis, float angle) {
+    rl_capture_begin(RL_CALL_MATRIX_ROTATE);
+    rl_capture_value(&axis, sizeof(axis));
+    rl_capture_value(&angle, sizeof(angle));
+    Matrix result = raylib_capture_target->matrix_rotate(axis, angle);
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_matrix_rotate_x(float angle) {
+    rl_capture_begin(RL_CALL_MATRIX_ROTATE_X);
+    rl_capture_value(&angle, sizeof(angle));
+    Matrix result = raylib_capture_target->matrix_rotate_x(angle);
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_matrix_rotate_y(float angle) {
+    rl_capture_begin(RL_CALL_MATRIX_ROTATE_Y);
+    rl_capture_value(&angle, sizeof(angle));
+    Matrix result = raylib_capture_target->matrix_rotate_y(angle);
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_matrix_rotate_z(float angle) {
+    rl_capture_begin(RL_CALL_MATRIX_ROTATE_Z);
+    rl_capture_value(&angle, sizeof(angle));
+    Matrix result = raylib_capture_target->matrix_rotate_z(angle);
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_matrix_rotate_xyz(Vector3 angle) {
+    rl_capture_begin(RL_CALL_MATRIX_ROTATE_XYZ);
+    rl_capture_value(&angle, sizeof(angle));
+    Matrix result = raylib_capture_target->matrix_rotate_xyz(angle);
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_matrix_rotate_zyx(Vector3 angle) {
+    rl_capture_begin(RL_CALL_MATRIX_ROTATE_ZYX);
+    rl_capture_value(&angle, sizeof(angle));
+    Matrix result = raylib_capture_target->matrix_rotate_zyx(angle);
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_matrix_scale(float x, float y, float z) {
+    rl_capture_begin(RL_CALL_MATRIX_SCALE);
+    rl_capture_value(&x, sizeof(x));
+    rl_capture_value(&y, sizeof(y));
+    rl_capture_value(&z, sizeof(z));
+    Matrix result = raylib_capture_target->matrix_scale(x, y, z);
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_matrix_frustum(double left, double right, double bottom, double top, double nearPlane, double farPlane) {
+    rl_capture_begin(RL_CALL_MATRIX_FRUSTUM);
+    rl_capture_value(&left, sizeof(left));
+    rl_capture_value(&right, sizeof(right));
+    rl_capture_value(&bottom, sizeof(bottom));
+    rl_capture_value(&top, sizeof(top));
+    rl_capture_value(&nearPlane, sizeof(nearPlane));
+    rl_capture_value(&farPlane, sizeof(farPlane));
+    Matrix result = raylib_capture_target->matrix_frustum(left, right, bottom, top, nearPlane, farPlane);
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_matrix_perspective(double fovY, double aspect, double nearPlane, double farPlane) {
+    rl_capture_begin(RL_CALL_MATRIX_PERSPECTIVE);
+    rl_capture_value(&fovY, sizeof(fovY));
+    rl_capture_value(&aspect, sizeof(aspect));
+    rl_capture_value(&nearPlane, sizeof(nearPlane));
+    rl_capture_value(&farPlane, sizeof(farPlane));
+    Matrix result = raylib_capture_target->matrix_perspective(fovY, aspect, nearPlane, farPlane);
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_matrix_ortho(double left, double right, double bottom, double top, double nearPlane, double farPlane) {
+    rl_capture_begin(RL_CALL_MATRIX_ORTHO);
+    rl_capture_value(&left, sizeof(left));
+    rl_capture_value(&right, sizeof(right));
+    rl_capture_value(&bottom, sizeof(bottom));
+    rl_capture_value(&top, sizeof(top));
+    rl_capture_value(&nearPlane, sizeof(nearPlane));
+    rl_capture_value(&farPlane, sizeof(farPlane));
+    Matrix result = raylib_capture_target->matrix_ortho(left, right, bottom, top, nearPlane, farPlane);
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_matrix_look_at(Vector3 eye, Vector3 target, Vector3 up) {
+    rl_capture_begin(RL_CALL_MATRIX_LOOK_AT);
+    rl_capture_value(&eye, sizeof(eye));
+    rl_capture_value(&target, sizeof(target));
+    rl_capture_value(&up, sizeof(up));
+    Matrix result = raylib_capture_target->matrix_look_at(eye, target, up);
+    rl_capture_end();
+    return result;
+}
+
+static float16 rl_capture_matrix_to_float_v(Matrix mat) {
+    rl_capture_unsupported(RL_CALL_MATRIX_TO_FLOAT_V);
+    return raylib_capture_target->matrix_to_float_v(mat);
+}
+
+static Quaternion rl_capture_quaternion_add(Quaternion q1, Quaternion q2) {
+    rl_capture_begin(RL_CALL_QUATERNION_ADD);
+    rl_capture_value(&q1, sizeof(q1));
+    rl_capture_value(&q2, sizeof(q2));
+    Quaternion result = raylib_capture_target->quaternion_add(q1, q2);
+    rl_capture_end();
+    return result;
+}
+
+static Quaternion rl_capture_quaternion_add_value(Quaternion q, float add) {
+    rl_capture_begin(RL_CALL_QUATERNION_ADD_VALUE);
+    rl_capture_value(&q, sizeof(q));
+    rl_capture_value(&add, sizeof(add));
+    Quaternion result = raylib_capture_target->quaternion_add_value(q, add);
+    rl_capture_end();
+    return result;
+}
+
+static Quaternion rl_capture_quaternion_subtract(Quaternion q1, Quaternion q2) {
+    rl_capture_begin(RL_CALL_QUATERNION_SUBTRACT);
+    rl_capture_value(&q1, sizeof(q1));
+    rl_capture_value(&q2, sizeof(q2));
+    Quaternion result = raylib_capture_target->quaternion_subtract(q1, q2);
+    rl_capture_end();
+    return result;
+}
+
+static Quaternion rl_capture_quaternion_subtract_value(Quaternion q, float sub) {
+    rl_capture_begin(RL_CALL_QUATERNION_SUBTRACT_VALUE);
+    rl_capture_value(&q, sizeof(q));
+    rl_capture_value(&sub, sizeof(sub));
+    Quaternion result = raylib_capture_target->quaternion_subtract_value(q, sub);
+    rl_capture_end();
+    return result;
+}
+
+static Quaternion rl_capture_quaternion_identity(void) {
+    rl_capture_begin(RL_CALL_QUATERNION_IDENTITY);
+    Quaternion result = raylib_capture_target->quaternion_identity();
+    rl_capture_end();
+    return result;
+}
+
+static float rl_capture_quaternion_length(Quaternion q) {
+    rl_capture_begin(RL_CALL_QUATERNION_LENGTH);
+    rl_capture_value(&q, sizeof(q));
+    float result = raylib_capture_target->quaternion_length(q);
+    rl_capture_end();
+    return result;
+}
+
+static Quaternion rl_capture_quaternion_normalize(Quaternion q) {
+    rl_capture_begin(RL_CALL_QUATERNION_NORMALIZE);
+    rl_capture_value(&q, sizeof(q));
+    Quaternion result = raylib_capture_target->quaternion_normalize(q);
+    rl_capture_end();
+    return result;
+}
+
+static Quaternion rl_capture_quaternion_invert(Quaternion q) {
+    rl_capture_begin(RL_CALL_QUATERNION_INVERT);
+    rl_capture_value(&q, sizeof(q));
+    Quaternion result = raylib_capture_target->quaternion_invert(q);
+    rl_capture_end();
+    return result;
+}
+
+static Quaternion rl_capture_quaternion_multiply(Quaternion q1, Quaternion q2) {
+    rl_capture_begin(RL_CALL_QUATERNION_MULTIPLY);
+    rl_capture_value(&q1, sizeof(q1));
+    rl_capture_value(&q2, sizeof(q2));
+    Quaternion result = raylib_capture_target->quaternion_multiply(q1, q2);
+    rl_capture_end();
+    return result;
+}
+
+static Quaternion rl_capture_quaternion_scale(Quaternion q, float mul) {
+    rl_capture_begin(RL_CALL_QUATERNION_SCALE);
+    rl_capture_value(&q, sizeof(q));
+    rl_capture_value(&mul, sizeof(mul));
+    Quaternion result = raylib_capture_target->quaternion_scale(q, mul);
+    rl_capture_end();
+    return result;
+}
+
+static Quaternion rl_capture_quaternion_divide(Quaternion q1, Quaternion q2) {
+    rl_capture_begin(RL_CALL_QUATERNION_DIVIDE);
+    rl_capture_value(&q1, sizeof(q1));
+    rl_capture_value(&q2, sizeof(q2));
+    Quaternion result = raylib_capture_target->quaternion_divide(q1, q2);
+    rl_capture_end();
+    return result;
+}
+
+static Quaternion rl_capture_quaternion_lerp(Quaternion q1, Quaternion q2, float amount) {
+    rl_capture_begin(RL_CALL_QUATERNION_LERP);
+    rl_capture_value(&q1, sizeof(q1));
+    rl_capture_value(&q2, sizeof(q2));
+    rl_capture_value(&amount, sizeof(amount));
+    Quaternion result = raylib_capture_target->quaternion_lerp(q1, q2, amount);
+    rl_capture_end();
+    return result;
+}
+
+static Quaternion rl_capture_quaternion_nlerp(Quaternion q1, Quaternion q2, float amount) {
+    rl_capture_begin(RL_CALL_QUATERNION_NLERP);
+    rl_capture_value(&q1, sizeof(q1));
+    rl_capture_value(&q2, sizeof(q2));
+    rl_capture_value(&amount, sizeof(amount));
+    Quaternion result = raylib_capture_target->quaternion_nlerp(q1, q2, amount);
+    rl_capture_end();
+    return result;
+}
+
+static Quaternion rl_capture_quaternion_slerp(Quaternion q1, Quaternion q2, float amount) {
+    rl_capture_begin(RL_CALL_QUATERNION_SLERP);
+    rl_capture_value(&q1, sizeof(q1));
+    rl_capture_value(&q2, sizeof(q2));
+    rl_capture_value(&amount, sizeof(amount));
+    Quaternion result = raylib_capture_target->quaternion_slerp(q1, q2, amount);
+    rl_capture_end();
+    return result;
+}
+
+static Quaternion rl_capture_quaternion_cubic_hermite_spline(Quaternion q1, Quaternion outTangent1, Quaternion q2, Quaternion inTangent2, float t) {
+    rl_capture_begin(RL_CALL_QUATERNION_CUBIC_HERMITE_SPLINE);
+    rl_capture_value(&q1, sizeof(q1));
+    rl_capture_value(&outTangent1, sizeof(outTangent1));
+    rl_capture_value(&q2, sizeof(q2));
+    rl_capture_value(&inTangent2, sizeof(inTangent2));
+    rl_capture_value(&t, sizeof(t));
+    Quaternion result = raylib_capture_target->quaternion_cubic_hermite_spline(q1, outTangent1, q2, inTangent2, t);
+    rl_capture_end();
+    return result;
+}
+
+static Quaternion rl_capture_quaternion_from_vector3_to_vector3(Vector3 from, Vector3 to) {
+    rl_capture_begin(RL_CALL_QUATERNION_FROM_VECTOR3_TO_VECTOR3);
+    rl_capture_value(&from, sizeof(from));
+    rl_capture_value(&to, sizeof(to));
+    Quaternion result = raylib_capture_target->quaternion_from_vector3_to_vector3(from, to);
+    rl_capture_end();
+    return result;
+}
+
+static Quaternion rl_capture_quaternion_from_matrix(Matrix mat) {
+    rl_capture_begin(RL_CALL_QUATERNION_FROM_MATRIX);
+    rl_capture_value(&mat, sizeof(mat));
+    Quaternion result = raylib_capture_target->quaternion_from_matrix(mat);
+    rl_capture_end();
+    return result;
+}
+
+static Matrix rl_capture_quaternion_to_matrix(Quaternion q) {
+    rl_capture_begin(RL_CALL_QUATERNION_TO_MATRIX);
+    rl_capture_value(&q, sizeof(q));
+    Matrix result = raylib_capture_target->quaternion_to_matrix(q);
+    rl_capture_end();
+    return result;
+}
+
+static Quaternion rl_capture_quaternion_from_axis_angle(Vector3 axis, float angle) {
+    rl_capture_begin(RL_CALL_QUATERNION_FROM_AXIS_ANGLE);
+    rl_capture_value(&axis, sizeof(axis));
+    rl_capture_value(&angle, sizeof(angle));
+    Quaternion result = raylib_capture_target->quaternion_from_axis_angle(axis, angle);
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_quaternion_to_axis_angle(Quaternion q, Vector3 *outAxis, float *outAngle) {
+    rl_capture_unsupported(RL_CALL_QUATERNION_TO_AXIS_ANGLE);
+    raylib_capture_target->quaternion_to_axis_angle(q, outAxis, outAngle);
+}
+
+static Quaternion rl_capture_quaternion_from_euler(float pitch, float yaw, float roll) {
+    rl_capture_begin(RL_CALL_QUATERNION_FROM_EULER);
+    rl_capture_value(&pitch, sizeof(pitch));
+    rl_capture_value(&yaw, sizeof(yaw));
+    rl_capture_value(&roll, sizeof(roll));
+    Quaternion result = raylib_capture_target->quaternion_from_euler(pitch, yaw, roll);
+    rl_capture_end();
+    return result;
+}
+
+static Vector3 rl_capture_quaternion_to_euler(Quaternion q) {
+    rl_capture_begin(RL_CALL_QUATERNION_TO_EULER);
+    rl_capture_value(&q, sizeof(q));
+    Vector3 result = raylib_capture_target->quaternion_to_euler(q);
+    rl_capture_end();
+    return result;
+}
+
+static Quaternion rl_capture_quaternion_transform(Quaternion q, Matrix mat) {
+    rl_capture_begin(RL_CALL_QUATERNION_TRANSFORM);
+    rl_capture_value(&q, sizeof(q));
+    rl_capture_value(&mat, sizeof(mat));
+    Quaternion result = raylib_capture_target->quaternion_transform(q, mat);
+    rl_capture_end();
+    return result;
+}
+
+static int rl_capture_quaternion_equals(Quaternion p, Quaternion q) {
+    rl_capture_begin(RL_CALL_QUATERNION_EQUALS);
+    rl_capture_value(&p, sizeof(p));
+    rl_capture_value(&q, sizeof(q));
+    int result = raylib_capture_target->quaternion_equals(p, q);
+    rl_capture_end();
+    return result;
+}
+
+static void rl_capture_matrix_decompose(Matrix mat, Vector3 *translation, Quaternion *rotation, Vector3 *scale) {
+    rl_capture_unsupported(RL_CALL_MATRIX_DECOMPOSE);
+    raylib_capture_target->matrix_decompose(mat, translation, rotation, scale);
+}
+
+static inline RaylibAPI* create_raylib_api_capture(RaylibAPI* target) {
+    static RaylibAPI api;
+    raylib_capture_target = target;
+
+    api = *target;
+    api.init_window = rl_capture_init_window;
+    api.close_window = rl_capture_close_window;
+    api.window_should_close = rl_capture_window_should_close;
+    api.is_window_ready = rl_capture_is_window_ready;
+    api.is_window_fullscreen = rl_capture_is_window_fullscreen;
+    api.is_window_hidden = rl_capture_is_window_hidden;
+    api.is_window_minimized = rl_capture_is_window_minimized;
+    api.is_window_maximized = rl_capture_is_window_maximized;
+    api.is_window_focused = rl_capture_is_window_focused;
+    api.is_window_resized = rl_capture_is_window_resized;
+    api.is_window_state = rl_capture_is_window_state;
+    api.set_window_state = rl_capture_set_window_state;
+    api.clear_window_state = rl_capture_clear_window_state;
+    api.toggle_fullscreen = rl_capture_toggle_fullscreen;
+    api.toggle_borderless_windowed = rl_capture_toggle_borderless_windowed;
+    api.maximize_window = rl_capture_maximize_window;
+    api.minimize_window = rl_capture_minimize_window;
+    api.restore_window = rl_capture_restore_window;
+    api.set_window_icon = rl_capture_set_window_icon;
+    api.set_window_icons = rl_capture_set_window_icons;
+    api.set_window_title = rl_capture_set_window_title;
+    api.set_window_position = rl_capture_set_window_position;
+    api.set_window_monitor = rl_capture_set_window_monitor;
+    api.set_window_min_size = rl_capture_set_window_min_size;
+    api.set_window_max_size = rl_capture_set_window_max_size;
+    api.set_window_size = rl_capture_set_window_size;
+    api.set_window_opacity = rl_capture_set_window_opacity;
+    api.set_window_focused = rl_capture_set_window_focused;
+    api.get_window_handle = rl_capture_get_window_handle;
+    api.get_screen_width = rl_capture_get_screen_width;
+    api.get_screen_height = rl_capture_get_screen_height;
+    api.get_render_width = rl_capture_get_render_width;
+    api.get_render_height = rl_capture_get_render_height;
+    api.get_monitor_count = rl_capture_get_monitor_count;
+    api.get_current_monitor = rl_capture_get_current_monitor;
+    api.get_monitor_position = rl_capture_get_monitor_position;
+    api.get_monitor_width = rl_capture_get_monitor_width;
+    api.get_monitor_height = rl_capture_get_monitor_height;
+    api.get_monitor_physical_width = rl_capture_get_monitor_physical_width;
+    api.get_monitor_physical_height = rl_capture_get_monitor_physical_height;
+    api.get_monitor_refresh_rate = rl_capture_get_monitor_refresh_rate;
+    api.get_window_position = rl_capture_get_window_position;
+    api.get_window_scale_dpi = rl_capture_get_window_scale_dpi;
+    api.get_monitor_name = rl_capture_get_monitor_name;
+    api.set_clipboard_text = rl_capture_set_clipboard_text;
+    api.get_clipboard_text = rl_capture_get_clipboard_text;
+    api.get_clipboard_image = rl_capture_get_clipboard_image;
+    api.enable_event_waiting = rl_capture_enable_event_waiting;
+    api.disable_event_waiting = rl_capture_disable_event_waiting;
+    api.show_cursor = rl_capture_show_cursor;
+    api.hide_cursor = rl_capture_hide_cursor;
+    api.is_cursor_hidden = rl_capture_is_cursor_hidden;
+    api.enable_cursor = rl_capture_enable_cursor;
+    api.disable_cursor = rl_capture_disable_cursor;
+    api.is_cursor_on_screen = rl_capture_is_cursor_on_screen;
+    api.clear_background = rl_capture_clear_background;
+    api.begin_drawing = rl_capture_begin_drawing;
+    api.end_drawing = rl_capture_end_drawing;
+    api.begin_mode2_d = rl_capture_begin_mode2_d;
+    api.end_mode2_d = rl_capture_end_mode2_d;
+    api.begin_mode3_d = rl_capture_begin_mode3_d;
+    api.end_mode3_d = rl_capture_end_mode3_d;
+    api.begin_texture_mode = rl_capture_begin_texture_mode;
+    api.end_texture_mode = rl_capture_end_texture_mode;
+    api.begin_shader_mode = rl_capture_begin_shader_mode;
+    api.end_shader_mode = rl_capture_end_shader_mode;
+    api.begin_blend_mode = rl_capture_begin_blend_mode;
+    api.end_blend_mode = rl_capture_end_blend_mode;
+    api.begin_scissor_mode = rl_capture_begin_scissor_mode;
+    api.end_scissor_mode = rl_capture_end_scissor_mode;
+    api.begin_vr_stereo_mode = rl_capture_begin_vr_stereo_mode;
+    api.end_vr_stereo_mode = rl_capture_end_vr_stereo_mode;
+    api.load_vr_stereo_config = rl_capture_load_vr_stereo_config;
+    api.unload_vr_stereo_config = rl_capture_unload_vr_stereo_config;
+    api.load_shader = rl_capture_load_shader;
+    api.load_shader_from_memory = rl_capture_load_shader_from_memory;
+    api.is_shader_valid = rl_capture_is_shader_valid;
+    api.get_shader_location = rl_capture_get_shader_location;
+    api.get_shader_location_attrib = rl_capture_get_shader_location_attrib;
+    api.set_shader_value = rl_capture_set_shader_value;
+    api.set_shader_value_v = rl_capture_set_shader_value_v;
+    api.set_shader_value_matrix = rl_capture_set_shader_value_matrix;
+    api.set_shader_value_texture = rl_capture_set_shader_value_texture;
+    api.unload_shader = rl_capture_unload_shader;
+    api.get_screen_to_world_ray = rl_capture_get_screen_to_world_ray;
+    api.get_screen_to_world_ray_ex = rl_capture_get_screen_to_world_ray_ex;
+    api.get_world_to_screen = rl_capture_get_world_to_screen;
+    api.get_world_to_screen_ex = rl_capture_get_world_to_screen_ex;
+    api.get_world_to_screen2_d = rl_capture_get_world_to_screen2_d;
+    api.get_screen_to_world2_d = rl_capture_get_screen_to_world2_d;
+    api.get_camera_matrix = rl_capture_get_camera_matrix;
+    api.get_camera_matrix2_d = rl_capture_get_camera_matrix2_d;
+    api.set_target_fps = rl_capture_set_target_fps;
+    api.get_frame_time = rl_capture_get_frame_time;
+    api.get_time = rl_capture_get_time;
+    api.get_fps = rl_capture_get_fps;
+    api.swap_screen_buffer = rl_capture_swap_screen_buffer;
+    api.poll_input_events = rl_capture_poll_input_events;
+    api.wait_time = rl_capture_wait_time;
+    api.set_random_seed = rl_capture_set_random_seed;
+    api.get_random_value = rl_capture_get_random_value;
+    api.load_random_sequence = rl_capture_load_random_sequence;
+    api.unload_random_sequence = rl_capture_unload_random_sequence;
+    api.take_screenshot = rl_capture_take_screenshot;
+    api.set_config_flags = rl_capture_set_config_flags;
+    api.open_url = rl_capture_open_url;
+    api.set_trace_log_level = rl_capture_set_trace_log_level;
+    api.mem_alloc = rl_capture_mem_alloc;
+    api.mem_realloc = rl_capture_mem_realloc;
+    api.mem_free = rl_capture_mem_free;
+    api.set_trace_log_callback = rl_capture_set_trace_log_callback;
+    api.set_load_file_data_callback = rl_capture_set_load_file_data_callback;
+    api.set_save_file_data_callback = rl_capture_set_save_file_data_callback;
+    api.set_load_file_text_callback = rl_capture_set_load_file_text_callback;
+    api.set_save_file_text_callback = rl_capture_set_save_file_text_callback;
+    api.load_file_data = rl_capture_load_file_data;
+    api.unload_file_data = rl_capture_unload_file_data;
+    api.save_file_data = rl_capture_save_file_data;
+    api.export_data_as_code = rl_capture_export_data_as_code;
+    api.load_file_text = rl_capture_load_file_text;
+    api.unload_file_text = rl_capture_unload_file_text;
+    api.save_file_text = rl_capture_save_file_text;
+    api.file_exists = rl_capture_file_exists;
+    api.directory_exists = rl_capture_directory_exists;
+    api.is_file_extension = rl_capture_is_file_extension;
+    api.get_file_length = rl_capture_get_file_length;
+    api.get_file_extension = rl_capture_get_file_extension;
+    api.get_file_name = rl_capture_get_file_name;
+    api.get_file_name_without_ext = rl_capture_get_file_name_without_ext;
+    api.get_directory_path = rl_capture_get_directory_path;
+    api.get_prev_directory_path = rl_capture_get_prev_directory_path;
+    api.get_working_directory = rl_capture_get_working_directory;
+    api.get_application_directory = rl_capture_get_application_directory;
+    api.make_directory = rl_capture_make_directory;
+    api.change_directory = rl_capture_change_directory;
+    api.is_path_file = rl_capture_is_path_file;
+    api.is_file_name_valid = rl_capture_is_file_name_valid;
+    api.load_directory_files = rl_capture_load_directory_files;
+    api.load_directory_files_ex = rl_capture_load_directory_files_ex;
+    api.unload_directory_files = rl_capture_unload_directory_files;
+    api.is_file_dropped = rl_capture_is_file_dropped;
+    api.load_dropped_files = rl_capture_load_dropped_files;
+    api.unload_dropped_files = rl_capture_unload_dropped_files;
+    api.get_file_mod_time = rl_capture_get_file_mod_time;
+    api.compress_data = rl_capture_compress_data;
+    api.decompress_data = rl_capture_decompress_data;
+    api.encode_data_base64 = rl_capture_encode_data_base64;
+    api.decode_data_base64 = rl_capture_decode_data_base64;
+    api.compute_crc32 = rl_capture_compute_crc32;
+    api.compute_md5 = rl_capture_compute_md5;
+    api.compute_sha1 = rl_capture_compute_sha1;
+    api.load_automation_event_list = rl_capture_load_automation_event_list;
+    api.unload_automation_event_list = rl_capture_unload_automation_event_list;
+    api.export_automation_event_list = rl_capture_export_automation_event_list;
+    api.set_automation_event_list = rl_capture_set_automation_event_list;
+    api.set_automation_event_base_frame = rl_capture_set_automation_event_base_frame;
+    api.start_automation_event_recording = rl_capture_start_automation_event_recording;
+    api.stop_automation_event_recording = rl_capture_stop_automation_event_recording;
+    api.play_automation_event = rl_capture_play_automation_event;
+    api.is_key_pressed = rl_capture_is_key_pressed;
+    api.is_key_pressed_repeat = rl_capture_is_key_pressed_repeat;
+    api.is_key_down = rl_capture_is_key_down;
+    api.is_key_released = rl_capture_is_key_released;
+    api.is_key_up = rl_capture_is_key_up;
+    api.get_key_pressed = rl_capture_get_key_pressed;
+    api.get_char_pressed = rl_capture_get_char_pressed;
+    api.set_exit_key = rl_capture_set_exit_key;
+    api.is_gamepad_available = rl_capture_is_gamepad_available;
+    api.get_gamepad_name = rl_capture_get_gamepad_name;
+    api.is_gamepad_button_pressed = rl_capture_is_gamepad_button_pressed;
+    api.is_gamepad_button_down = rl_capture_is_gamepad_button_down;
+    api.is_gamepad_button_released = rl_capture_is_gamepad_button_released;
+    api.is_gamepad_button_up = rl_capture_is_gamepad_button_up;
+    api.get_gamepad_button_pressed = rl_capture_get_gamepad_button_pressed;
+    api.get_gamepad_axis_count = rl_capture_get_gamepad_axis_count;
+    api.get_gamepad_axis_movement = rl_capture_get_gamepad_axis_movement;
+    api.set_gamepad_mappings = rl_capture_set_gamepad_mappings;
+    api.set_gamepad_vibration = rl_capture_set_gamepad_vibration;
+    api.is_mouse_button_pressed = rl_capture_is_mouse_button_pressed;
+    api.is_mouse_button_down = rl_capture_is_mouse_button_down;
+    api.is_mouse_button_released = rl_capture_is_mouse_button_released;
+    api.is_mouse_button_up = rl_capture_is_mouse_button_up;
+    api.get_mouse_x = rl_capture_get_mouse_x;
+    api.get_mouse_y = rl_capture_get_mouse_y;
+    api.get_mouse_position = rl_capture_get_mouse_position;
+    api.get_mouse_delta = rl_capture_get_mouse_delta;
+    api.set_mouse_position = rl_capture_set_mouse_position;
+    api.set_mouse_offset = rl_capture_set_mouse_offset;
+    api.set_mouse_scale = rl_capture_set_mouse_scale;
+    api.get_mouse_wheel_move = rl_capture_get_mouse_wheel_move;
+    api.get_mouse_wheel_move_v = rl_capture_get_mouse_wheel_move_v;
+    api.set_mouse_cursor = rl_capture_set_mouse_cursor;
+    api.get_touch_x = rl_capture_get_touch_x;
+    api.get_touch_y = rl_capture_get_touch_y;
+    api.get_touch_position = rl_capture_get_touch_position;
+    api.get_touch_point_id = rl_capture_get_touch_point_id;
+    api.get_touch_point_count = rl_capture_get_touch_point_count;
+    api.set_gestures_enabled = rl_capture_set_gestures_enabled;
+    api.is_gesture_detected = rl_capture_is_gesture_detected;
+    api.get_gesture_detected = rl_capture_get_gesture_detected;
+    api.get_gesture_hold_duration = rl_capture_get_gesture_hold_duration;
+    api.get_gesture_drag_vector = rl_capture_get_gesture_drag_vector;
+    api.get_gesture_drag_angle = rl_capture_get_gesture_drag_angle;
+    api.get_gesture_pinch_vector = rl_capture_get_gesture_pinch_vector;
+    api.get_gesture_pinch_angle = rl_capture_get_gesture_pinch_angle;
+    api.update_camera = rl_capture_update_camera;
+    api.update_camera_pro = rl_capture_update_camera_pro;
+    api.set_shapes_texture = rl_capture_set_shapes_texture;
+    api.get_shapes_texture = rl_capture_get_shapes_texture;
+    api.get_shapes_texture_rectangle = rl_capture_get_shapes_texture_rectangle;
+    api.draw_pixel = rl_capture_draw_pixel;
+    api.draw_pixel_v = rl_capture_draw_pixel_v;
+    api.draw_line = rl_capture_draw_line;
+    api.draw_line_v = rl_capture_draw_line_v;
+    api.draw_line_ex = rl_capture_draw_line_ex;
+    api.draw_line_strip = rl_capture_draw_line_strip;
+    api.draw_line_bezier = rl_capture_draw_line_bezier;
+    api.draw_circle = rl_capture_draw_circle;
+    api.draw_circle_sector = rl_capture_draw_circle_sector;
+    api.draw_circle_sector_lines = rl_capture_draw_circle_sector_lines;
+    api.draw_circle_gradient = rl_capture_draw_circle_gradient;
+    api.draw_circle_v = rl_capture_draw_circle_v;
+    api.draw_circle_lines = rl_capture_draw_circle_lines;
+    api.draw_circle_lines_v = rl_capture_draw_circle_lines_v;
+    api.draw_ellipse = rl_capture_draw_ellipse;
+    api.draw_ellipse_lines = rl_capture_draw_ellipse_lines;
+    api.draw_ring = rl_capture_draw_ring;
+    api.draw_ring_lines = rl_capture_draw_ring_lines;
+    api.draw_rectangle = rl_capture_draw_rectangle;
+    api.draw_rectangle_v = rl_capture_draw_rectangle_v;
+    api.draw_rectangle_rec = rl_capture_draw_rectangle_rec;
+    api.draw_rectangle_pro = rl_capture_draw_rectangle_pro;
+    api.draw_rectangle_gradient_v = rl_capture_draw_rectangle_gradient_v;
+    api.draw_rectangle_gradient_h = rl_capture_draw_rectangle_gradient_h;
+    api.draw_rectangle_gradient_ex = rl_capture_draw_rectangle_gradient_ex;
+    api.draw_rectangle_lines = rl_capture_draw_rectangle_lines;
+    api.draw_rectangle_lines_ex = rl_capture_draw_rectangle_lines_ex;
+    api.draw_rectangle_rounded = rl_capture_draw_rectangle_rounded;
+    api.draw_rectangle_rounded_lines = rl_capture_draw_rectangle_rounded_lines;
+    api.draw_rectangle_rounded_lines_ex = rl_capture_draw_rectangle_rounded_lines_ex;
+    api.draw_triangle = rl_capture_draw_triangle;
+    api.draw_triangle_lines = rl_capture_draw_triangle_lines;
+    api.draw_triangle_fan = rl_capture_draw_triangle_fan;
+    api.draw_triangle_strip = rl_capture_draw_triangle_strip;
+    api.draw_poly = rl_capture_draw_poly;
+    api.draw_poly_lines = rl_capture_draw_poly_lines;
+    api.draw_poly_lines_ex = rl_capture_draw_poly_lines_ex;
+    api.draw_spline_linear = rl_capture_draw_spline_linear;
+    api.draw_spline_basis = rl_capture_draw_spline_basis;
+    api.draw_spline_catmull_rom = rl_capture_draw_spline_catmull_rom;
+    api.draw_spline_bezier_quadratic = rl_capture_draw_spline_bezier_quadratic;
+    api.draw_spline_bezier_cubic = rl_capture_draw_spline_bezier_cubic;
+    api.draw_spline_segment_linear = rl_capture_draw_spline_segment_linear;
+    api.draw_spline_segment_basis = rl_capture_draw_spline_segment_basis;
+    api.draw_spline_segment_catmull_rom = rl_capture_draw_spline_segment_catmull_rom;
+    api.draw_spline_segment_bezier_quadratic = rl_capture_draw_spline_segment_bezier_quadratic;
+    api.draw_spline_segment_bezier_cubic = rl_capture_draw_spline_segment_bezier_cubic;
+    api.get_spline_point_linear = rl_capture_get_spline_point_linear;
+    api.get_spline_point_basis = rl_capture_get_spline_point_basis;
+    api.get_spline_point_catmull_rom = rl_capture_get_spline_point_catmull_rom;
+    api.get_spline_point_bezier_quad = rl_capture_get_spline_point_bezier_quad;
+    api.get_spline_point_bezier_cubic = rl_capture_get_spline_point_bezier_cubic;
+    api.check_collision_recs = rl_capture_check_collision_recs;
+    api.check_collision_circles = rl_capture_check_collision_circles;
+    api.check_collision_circle_rec = rl_capture_check_collision_circle_rec;
+    api.check_collision_circle_line = rl_capture_check_collision_circle_line;
+    api.check_collision_point_rec = rl_capture_check_collision_point_rec;
+    api.check_collision_point_circle = rl_capture_check_collision_point_circle;
+    api.check_collision_point_triangle = rl_capture_check_collision_point_triangle;
+    api.check_collision_point_line = rl_capture_check_collision_point_line;
+    api.check_collision_point_poly = rl_capture_check_collision_point_poly;
+    api.check_collision_lines = rl_capture_check_collision_lines;
+    api.get_collision_rec = rl_capture_get_collision_rec;
+    api.load_image = rl_capture_load_image;
+    api.load_image_raw = rl_capture_load_image_raw;
+    api.load_image_anim = rl_capture_load_image_anim;
+    api.load_image_anim_from_memory = rl_capture_load_image_anim_from_memory;
+    api.load_image_from_memory = rl_capture_load_image_from_memory;
+    api.load_image_from_texture = rl_capture_load_image_from_texture;
+    api.load_image_from_screen = rl_capture_load_image_from_screen;
+    api.is_image_valid = rl_capture_is_image_valid;
+    api.unload_image = rl_capture_unload_image;
+    api.export_image = rl_capture_export_image;
+    api.export_image_to_memory = rl_capture_export_image_to_memory;
+    api.export_image_as_code = rl_capture_export_image_as_code;
+    api.gen_image_color = rl_capture_gen_image_color;
+    api.gen_image_gradient_linear = rl_capture_gen_image_gradient_linear;
+    api.gen_image_gradient_radial = rl_capture_gen_image_gradient_radial;
+    api.gen_image_gradient_square = rl_capture_gen_image_gradient_square;
+    api.gen_image_checked = rl_capture_gen_image_checked;
+    api.gen_image_white_noise = rl_capture_gen_image_white_noise;
+    api.gen_image_perlin_noise = rl_capture_gen_image_perlin_noise;
+    api.gen_image_cellular = rl_capture_gen_image_cellular;
+    api.gen_image_text = rl_capture_gen_image_text;
+    api.image_copy = rl_capture_image_copy;
+    api.image_from_image = rl_capture_image_from_image;
+    api.image_from_channel = rl_capture_image_from_channel;
+    api.image_text = rl_capture_image_text;
+    api.image_text_ex = rl_capture_image_text_ex;
+    api.image_format = rl_capture_image_format;
+    api.image_to_pot = rl_capture_image_to_pot;
+    api.image_crop = rl_capture_image_crop;
+    api.image_alpha_crop = rl_capture_image_alpha_crop;
+    api.image_alpha_clear = rl_capture_image_alpha_clear;
+    api.image_alpha_mask = rl_capture_image_alpha_mask;
+    api.image_alpha_premultiply = rl_capture_image_alpha_premultiply;
+    api.image_blur_gaussian = rl_capture_image_blur_gaussian;
+    api.image_kernel_convolution = rl_capture_image_kernel_convolution;
+    api.image_resize = rl_capture_image_resize;
+    api.image_resize_nn = rl_capture_image_resize_nn;
+    api.image_resize_canvas = rl_capture_image_resize_canvas;
+    api.image_mipmaps = rl_capture_image_mipmaps;
+    api.image_dither = rl_capture_image_dither;
+    api.image_flip_vertical = rl_capture_image_flip_vertical;
+    api.image_flip_horizontal = rl_capture_image_flip_horizontal;
+    api.image_rotate = rl_capture_image_rotate;
+    api.image_rotate_cw = rl_capture_image_rotate_cw;
+    api.image_rotate_ccw = rl_capture_image_rotate_ccw;
+    api.image_color_tint = rl_capture_image_color_tint;
+    api.image_color_invert = rl_capture_image_color_invert;
+    api.image_color_grayscale = rl_capture_image_color_grayscale;
+    api.image_color_contrast = rl_capture_image_color_contrast;
+    api.image_color_brightness = rl_capture_image_color_brightness;
+    api.image_color_replace = rl_capture_image_color_replace;
+    api.load_image_colors = rl_capture_load_image_colors;
+    api.load_image_palette = rl_capture_load_image_palette;
+    api.unload_image_colors = rl_capture_unload_image_colors;
+    api.unload_image_palette = rl_capture_unload_image_palette;
+    api.get_image_alpha_border = rl_capture_get_image_alpha_border;
+    api.get_image_color = rl_capture_get_image_color;
+    api.image_clear_background = rl_capture_image_clear_background;
+    api.image_draw_pixel = rl_capture_image_draw_pixel;
+    api.image_draw_pixel_v = rl_capture_image_draw_pixel_v;
+    api.image_draw_line = rl_capture_image_draw_line;
+    api.image_draw_line_v = rl_capture_image_draw_line_v;
+    api.image_draw_line_ex = rl_capture_image_draw_line_ex;
+    api.image_draw_circle = rl_capture_image_draw_circle;
+    api.image_draw_circle_v = rl_capture_image_draw_circle_v;
+    api.image_draw_circle_lines = rl_capture_image_draw_circle_lines;
+    api.image_draw_circle_lines_v = rl_capture_image_draw_circle_lines_v;
+    api.image_draw_rectangle = rl_capture_image_draw_rectangle;
+    api.image_draw_rectangle_v = rl_capture_image_draw_rectangle_v;
+    api.image_draw_rectangle_rec = rl_capture_image_draw_rectangle_rec;
+    api.image_draw_rectangle_lines = rl_capture_image_draw_rectangle_lines;
+    api.image_draw_triangle = rl_capture_image_draw_triangle;
+    api.image_draw_triangle_ex = rl_capture_image_draw_triangle_ex;
+    api.image_draw_triangle_lines = rl_capture_image_draw_triangle_lines;
+    api.image_draw_triangle_fan = rl_capture_image_draw_triangle_fan;
+    api.image_draw_triangle_strip = rl_capture_image_draw_triangle_strip;
+    api.image_draw = rl_capture_image_draw;
+    api.image_draw_text = rl_capture_image_draw_text;
+    api.image_draw_text_ex = rl_capture_image_draw_text_ex;
+    api.load_texture = rl_capture_load_texture;
+    api.load_texture_from_image = rl_capture_load_texture_from_image;
+    api.load_texture_cubemap = rl_capture_load_texture_cubemap;
+    api.load_render_texture = rl_capture_load_render_texture;
+    api.is_texture_valid = rl_capture_is_texture_valid;
+    api.unload_texture = rl_capture_unload_texture;
+    api.is_render_texture_valid = rl_capture_is_render_texture_valid;
+    api.unload_render_texture = rl_capture_unload_render_texture;
+    api.update_texture = rl_capture_update_texture;
+    api.update_texture_rec = rl_capture_update_texture_rec;
+    api.gen_texture_mipmaps = rl_capture_gen_texture_mipmaps;
+    api.set_texture_filter = rl_capture_set_texture_filter;
+    api.set_texture_wrap = rl_capture_set_texture_wrap;
+    api.draw_texture = rl_capture_draw_texture;
+    api.draw_texture_v = rl_capture_draw_texture_v;
+    api.draw_texture_ex = rl_capture_draw_texture_ex;
+    api.draw_texture_rec = rl_capture_draw_texture_rec;
+    api.draw_texture_pro = rl_capture_draw_texture_pro;
+    api.draw_texture_n_patch = rl_capture_draw_texture_n_patch;
+    api.color_is_equal = rl_capture_color_is_equal;
+    api.fade = rl_capture_fade;
+    api.color_to_int = rl_capture_color_to_int;
+    api.color_normalize = rl_capture_color_normalize;
+    api.color_from_normalized = rl_capture_color_from_normalized;
+    api.color_to_hsv = rl_capture_color_to_hsv;
+    api.color_from_hsv = rl_capture_color_from_hsv;
+    api.color_tint = rl_capture_color_tint;
+    api.color_brightness = rl_capture_color_brightness;
+    api.color_contrast = rl_capture_color_contrast;
+    api.color_alpha = rl_capture_color_alpha;
+    api.color_alpha_blend = rl_capture_color_alpha_blend;
+    api.color_lerp = rl_capture_color_lerp;
+    api.get_color = rl_capture_get_color;
+    api.get_pixel_color = rl_capture_get_pixel_color;
+    api.set_pixel_color = rl_capture_set_pixel_color;
+    api.get_pixel_data_size = rl_capture_get_pixel_data_size;
+    api.get_font_default = rl_capture_get_font_default;
+    api.load_font = rl_capture_load_font;
+    api.load_font_ex = rl_capture_load_font_ex;
+    api.load_font_from_image = rl_capture_load_font_from_image;
+    api.load_font_from_memory = rl_capture_load_font_from_memory;
+    api.is_font_valid = rl_capture_is_font_valid;
+    api.load_font_data = rl_capture_load_font_data;
+    api.gen_image_font_atlas = rl_capture_gen_image_font_atlas;
+    api.unload_font_data = rl_capture_unload_font_data;
+    api.unload_font = rl_capture_unload_font;
+    api.export_font_as_code = rl_capture_export_font_as_code;
+    api.draw_fps = rl_capture_draw_fps;
+    api.draw_text = rl_capture_draw_text;
+    api.draw_text_ex = rl_capture_draw_text_ex;
+    api.draw_text_pro = rl_capture_draw_text_pro;
+    api.draw_text_codepoint = rl_capture_draw_text_codepoint;
+    api.draw_text_codepoints = rl_capture_draw_text_codepoints;
+    api.set_text_line_spacing = rl_capture_set_text_line_spacing;
+    api.measure_text = rl_capture_measure_text;
+    api.measure_text_ex = rl_capture_measure_text_ex;
+    api.get_glyph_index = rl_capture_get_glyph_index;
+    api.get_glyph_info = rl_capture_get_glyph_info;
+    api.get_glyph_atlas_rec = rl_capture_get_glyph_atlas_rec;
+    api.load_utf8 = rl_capture_load_utf8;
+    api.unload_utf8 = rl_capture_unload_utf8;
+    api.load_codepoints = rl_capture_load_codepoints;
+    api.unload_codepoints = rl_capture_unload_codepoints;
+    api.get_codepoint_count = rl_capture_get_codepoint_count;
+    api.get_codepoint = rl_capture_get_codepoint;
+    api.get_codepoint_next = rl_capture_get_codepoint_next;
+    api.get_codepoint_previous = rl_capture_get_codepoint_previous;
+    api.codepoint_to_utf8 = rl_capture_codepoint_to_utf8;
+    api.text_copy = rl_capture_text_copy;
+    api.text_is_equal = rl_capture_text_is_equal;
+    api.text_length = rl_capture_text_length;
+    api.text_subtext = rl_capture_text_subtext;
+    api.text_replace = rl_capture_text_replace;
+    api.text_insert = rl_capture_text_insert;
+    api.text_join = rl_capture_text_join;
+    api.text_split = rl_capture_text_split;
+    api.text_append = rl_capture_text_append;
+    api.text_find_index = rl_capture_text_find_index;
+    api.text_to_upper = rl_capture_text_to_upper;
+    api.text_to_lower = rl_capture_text_to_lower;
+    api.text_to_pascal = rl_capture_text_to_pascal;
+    api.text_to_snake = rl_capture_text_to_snake;
+    api.text_to_camel = rl_capture_text_to_camel;
+    api.text_to_integer = rl_capture_text_to_integer;
+    api.text_to_float = rl_capture_text_to_float;
+    api.draw_line3_d = rl_capture_draw_line3_d;
+    api.draw_point3_d = rl_capture_draw_point3_d;
+    api.draw_circle3_d = rl_capture_draw_circle3_d;
+    api.draw_triangle3_d = rl_capture_draw_triangle3_d;
+    api.draw_triangle_strip3_d = rl_capture_draw_triangle_strip3_d;
+    api.draw_cube = rl_capture_draw_cube;
+    api.draw_cube_v = rl_capture_draw_cube_v;
+    api.draw_cube_wires = rl_capture_draw_cube_wires;
+    api.draw_cube_wires_v = rl_capture_draw_cube_wires_v;
+    api.draw_sphere = rl_capture_draw_sphere;
+    api.draw_sphere_ex = rl_capture_draw_sphere_ex;
+    api.draw_sphere_wires = rl_capture_draw_sphere_wires;
+    api.draw_cylinder = rl_capture_draw_cylinder;
+    api.draw_cylinder_ex = rl_capture_draw_cylinder_ex;
+    api.draw_cylinder_wires = rl_capture_draw_cylinder_wires;
+    api.draw_cylinder_wires_ex = rl_capture_draw_cylinder_wires_ex;
+    api.draw_capsule = rl_capture_draw_capsule;
+    api.draw_capsule_wires = rl_capture_draw_capsule_wires;
+    api.draw_plane = rl_capture_draw_plane;
+    api.draw_ray = rl_capture_draw_ray;
+    api.draw_grid = rl_capture_draw_grid;
+    api.load_model = rl_capture_load_model;
+    api.load_model_from_mesh = rl_capture_load_model_from_mesh;
+    api.is_model_valid = rl_capture_is_model_valid;
+    api.unload_model = rl_capture_unload_model;
+    api.get_model_bounding_box = rl_capture_get_model_bounding_box;
+    api.draw_model = rl_capture_draw_model;
+    api.draw_model_ex = rl_capture_draw_model_ex;
+    api.draw_model_wires = rl_capture_draw_model_wires;
+    api.draw_model_wires_ex = rl_capture_draw_model_wires_ex;
+    api.draw_model_points = rl_capture_draw_model_points;
+    api.draw_model_points_ex = rl_capture_draw_model_points_ex;
+    api.draw_bounding_box = rl_capture_draw_bounding_box;
+    api.draw_billboard = rl_capture_draw_billboard;
+    api.draw_billboard_rec = rl_capture_draw_billboard_rec;
+    api.draw_billboard_pro = rl_capture_draw_billboard_pro;
+    api.upload_mesh = rl_capture_upload_mesh;
+    api.update_mesh_buffer = rl_capture_update_mesh_buffer;
+    api.unload_mesh = rl_capture_unload_mesh;
+    api.draw_mesh = rl_capture_draw_mesh;
+    api.draw_mesh_instanced = rl_capture_draw_mesh_instanced;
+    api.get_mesh_bounding_box = rl_capture_get_mesh_bounding_box;
+    api.gen_mesh_tangents = rl_capture_gen_mesh_tangents;
+    api.export_mesh = rl_capture_export_mesh;
+    api.export_mesh_as_code = rl_capture_export_mesh_as_code;
+    api.gen_mesh_poly = rl_capture_gen_mesh_poly;
+    api.gen_mesh_plane = rl_capture_gen_mesh_plane;
+    api.gen_mesh_cube = rl_capture_gen_mesh_cube;
+    api.gen_mesh_sphere = rl_capture_gen_mesh_sphere;
+    api.gen_mesh_hemi_sphere = rl_capture_gen_mesh_hemi_sphere;
+    api.gen_mesh_cylinder = rl_capture_gen_mesh_cylinder;
+    api.gen_mesh_cone = rl_capture_gen_mesh_cone;
+    api.gen_mesh_torus = rl_capture_gen_mesh_torus;
+    api.gen_mesh_knot = rl_capture_gen_mesh_knot;
+    api.gen_mesh_heightmap = rl_capture_gen_mesh_heightmap;
+    api.gen_mesh_cubicmap = rl_capture_gen_mesh_cubicmap;
+    api.load_materials = rl_capture_load_materials;
+    api.load_material_default = rl_capture_load_material_default;
+    api.is_material_valid = rl_capture_is_material_valid;
+    api.unload_material = rl_capture_unload_material;
+    api.set_material_texture = rl_capture_set_material_texture;
+    api.set_model_mesh_material = rl_capture_set_model_mesh_material;
+    api.load_model_animations = rl_capture_load_model_animations;
+    api.update_model_animation = rl_capture_update_model_animation;
+    api.update_model_animation_bones = rl_capture_update_model_animation_bones;
+    api.unload_model_animation = rl_capture_unload_model_animation;
+    api.unload_model_animations = rl_capture_unload_model_animations;
+    api.is_model_animation_valid = rl_capture_is_model_animation_valid;
+    api.check_collision_spheres = rl_capture_check_collision_spheres;
+    api.check_collision_boxes = rl_capture_check_collision_boxes;
+    api.check_collision_box_sphere = rl_capture_check_collision_box_sphere;
+    api.get_ray_collision_sphere = rl_capture_get_ray_collision_sphere;
+    api.get_ray_collision_box = rl_capture_get_ray_collision_box;
+    api.get_ray_collision_mesh = rl_capture_get_ray_collision_mesh;
+    api.get_ray_collision_triangle = rl_capture_get_ray_collision_triangle;
+    api.get_ray_collision_quad = rl_capture_get_ray_collision_quad;
+    api.init_audio_device = rl_capture_init_audio_device;
+    api.close_audio_device = rl_capture_close_audio_device;
+    api.is_audio_device_ready = rl_capture_is_audio_device_ready;
+    api.set_master_volume = rl_capture_set_master_volume;
+    api.get_master_volume = rl_capture_get_master_volume;
+    api.load_wave = rl_capture_load_wave;
+    api.load_wave_from_memory = rl_capture_load_wave_from_memory;
+    api.is_wave_valid = rl_capture_is_wave_valid;
+    api.load_sound = rl_capture_load_sound;
+    api.load_sound_from_wave = rl_capture_load_sound_from_wave;
+    api.load_sound_alias = rl_capture_load_sound_alias;
+    api.is_sound_valid = rl_capture_is_sound_valid;
+    api.update_sound = rl_capture_update_sound;
+    api.unload_wave = rl_capture_unload_wave;
+    api.unload_sound = rl_capture_unload_sound;
+    api.unload_sound_alias = rl_capture_unload_sound_alias;
+    api.export_wave = rl_capture_export_wave;
+    api.export_wave_as_code = rl_capture_export_wave_as_code;
+    api.play_sound = rl_capture_play_sound;
+    api.stop_sound = rl_capture_stop_sound;
+    api.pause_sound = rl_capture_pause_sound;
+    api.resume_sound = rl_capture_resume_sound;
+    api.is_sound_playing = rl_capture_is_sound_playing;
+    api.set_sound_volume = rl_capture_set_sound_volume;
+    api.set_sound_pitch = rl_capture_set_sound_pitch;
+    api.set_sound_pan = rl_capture_set_sound_pan;
+    api.wave_copy = rl_capture_wave_copy;
+    api.wave_crop = rl_capture_wave_crop;
+    api.wave_format = rl_capture_wave_format;
+    api.load_wave_samples = rl_capture_load_wave_samples;
+    api.unload_wave_samples = rl_capture_unload_wave_samples;
+    api.load_music_stream = rl_capture_load_music_stream;
+    api.load_music_stream_from_memory = rl_capture_load_music_stream_from_memory;
+    api.is_music_valid = rl_capture_is_music_valid;
+    api.unload_music_stream = rl_capture_unload_music_stream;
+    api.play_music_stream = rl_capture_play_music_stream;
+    api.is_music_stream_playing = rl_capture_is_music_stream_playing;
+    api.update_music_stream = rl_capture_update_music_stream;
+    api.stop_music_stream = rl_capture_stop_music_stream;
+    api.pause_music_stream = rl_capture_pause_music_stream;
+    api.resume_music_stream = rl_capture_resume_music_stream;
+    api.seek_music_stream = rl_capture_seek_music_stream;
+    api.set_music_volume = rl_capture_set_music_volume;
+    api.set_music_pitch = rl_capture_set_music_pitch;
+    api.set_music_pan = rl_capture_set_music_pan;
+    api.get_music_time_length = rl_capture_get_music_time_length;
+    api.get_music_time_played = rl_capture_get_music_time_played;
+    api.load_audio_stream = rl_capture_load_audio_stream;
+    api.is_audio_stream_valid = rl_capture_is_audio_stream_valid;
+    api.unload_audio_stream = rl_capture_unload_audio_stream;
+    api.update_audio_stream = rl_capture_update_audio_stream;
+    api.is_audio_stream_processed = rl_capture_is_audio_stream_processed;
+    api.play_audio_stream = rl_capture_play_audio_stream;
+    api.pause_audio_stream = rl_capture_pause_audio_stream;
+    api.resume_audio_stream = rl_capture_resume_audio_stream;
+    api.is_audio_stream_playing = rl_capture_is_audio_stream_playing;
+    api.stop_audio_stream = rl_capture_stop_audio_stream;
+    api.set_audio_stream_volume = rl_capture_set_audio_stream_volume;
+    api.set_audio_stream_pitch = rl_capture_set_audio_stream_pitch;
+    api.set_audio_stream_pan = rl_capture_set_audio_stream_pan;
+    api.set_audio_stream_buffer_size_default = rl_capture_set_audio_stream_buffer_size_default;
+    api.set_audio_stream_callback = rl_capture_set_audio_stream_callback;
+    api.attach_audio_stream_processor = rl_capture_attach_audio_stream_processor;
+    api.detach_audio_stream_processor = rl_capture_detach_audio_stream_processor;
+    api.attach_audio_mixed_processor = rl_capture_attach_audio_mixed_processor;
+    api.detach_audio_mixed_processor = rl_capture_detach_audio_mixed_processor;
+    api.clamp = rl_capture_clamp;
+    api.lerp = rl_capture_lerp;
+    api.normalize = rl_capture_normalize;
+    api.remap = rl_capture_remap;
+    api.wrap = rl_capture_wrap;
+    api.float_equals = rl_capture_float_equals;
+    api.vector2_zero = rl_capture_vector2_zero;
+    api.vector2_one = rl_capture_vector2_one;
+    api.vector2_add = rl_capture_vector2_add;
+    api.vector2_add_value = rl_capture_vector2_add_value;
+    api.vector2_subtract = rl_capture_vector2_subtract;
+    api.vector2_subtract_value = rl_capture_vector2_subtract_value;
+    api.vector2_length = rl_capture_vector2_length;
+    api.vector2_length_sqr = rl_capture_vector2_length_sqr;
+    api.vector2_dot_product = rl_capture_vector2_dot_product;
+    api.vector2_distance = rl_capture_vector2_distance;
+    api.vector2_distance_sqr = rl_capture_vector2_distance_sqr;
+    api.vector2_angle = rl_capture_vector2_angle;
+    api.vector2_line_angle = rl_capture_vector2_line_angle;
+    api.vector2_scale = rl_capture_vector2_scale;
+    api.vector2_multiply = rl_capture_vector2_multiply;
+    api.vector2_negate = rl_capture_vector2_negate;
+    api.vector2_divide = rl_capture_vector2_divide;
+    api.vector2_normalize = rl_capture_vector2_normalize;
+    api.vector2_transform = rl_capture_vector2_transform;
+    api.vector2_lerp = rl_capture_vector2_lerp;
+    api.vector2_reflect = rl_capture_vector2_reflect;
+    api.vector2_min = rl_capture_vector2_min;
+    api.vector2_max = rl_capture_vector2_max;
+    api.vector2_rotate = rl_capture_vector2_rotate;
+    api.vector2_move_towards = rl_capture_vector2_move_towards;
+    api.vector2_invert = rl_capture_vector2_invert;
+    api.vector2_clamp = rl_capture_vector2_clamp;
+    api.vector2_clamp_value = rl_capture_vector2_clamp_value;
+    api.vector2_equals = rl_capture_vector2_equals;
+    api.vector2_refract = rl_capture_vector2_refract;
+    api.vector3_zero = rl_capture_vector3_zero;
+    api.vector3_one = rl_capture_vector3_one;
+    api.vector3_add = rl_capture_vector3_add;
+    api.vector3_add_value = rl_capture_vector3_add_value;
+    api.vector3_subtract = rl_capture_vector3_subtract;
+    api.vector3_subtract_value = rl_capture_vector3_subtract_value;
+    api.vector3_scale = rl_capture_vector3_scale;
+    api.vector3_multiply = rl_capture_vector3_multiply;
+    api.vector3_cross_product = rl_capture_vector3_cross_product;
+    api.vector3_perpendicular = rl_capture_vector3_perpendicular;
+    api.vector3_length = rl_capture_vector3_length;
+    api.vector3_length_sqr = rl_capture_vector3_length_sqr;
+    api.vector3_dot_product = rl_capture_vector3_dot_product;
+    api.vector3_distance = rl_capture_vector3_distance;
+    api.vector3_distance_sqr = rl_capture_vector3_distance_sqr;
+    api.vector3_angle = rl_capture_vector3_angle;
+    api.vector3_negate = rl_capture_vector3_negate;
+    api.vector3_divide = rl_capture_vector3_divide;
+    api.vector3_normalize = rl_capture_vector3_normalize;
+    api.vector3_project = rl_capture_vector3_project;
+    api.vector3_reject = rl_capture_vector3_reject;
+    api.vector3_ortho_normalize = rl_capture_vector3_ortho_normalize;
+    api.vector3_transform = rl_capture_vector3_transform;
+    api.vector3_rotate_by_quaternion = rl_capture_vector3_rotate_by_quaternion;
+    api.vector3_rotate_by_axis_angle = rl_capture_vector3_rotate_by_axis_angle;
+    api.vector3_move_towards = rl_capture_vector3_move_towards;
+    api.vector3_lerp = rl_capture_vector3_lerp;
+    api.vector3_cubic_hermite = rl_capture_vector3_cubic_hermite;
+    api.vector3_reflect = rl_capture_vector3_reflect;
+    api.vector3_min = rl_capture_vector3_min;
+    api.vector3_max = rl_capture_vector3_max;
+    api.vector3_barycenter = rl_capture_vector3_barycenter;
+    api.vector3_unproject = rl_capture_vector3_unproject;
+    api.vector3_to_float_v = rl_capture_vector3_to_float_v;
+    api.vector3_invert = rl_capture_vector3_invert;
+    api.vector3_clamp = rl_capture_vector3_clamp;
+    api.vector3_clamp_value = rl_capture_vector3_clamp_value;
+    api.vector3_equals = rl_capture_vector3_equals;
+    api.vector3_refract = rl_capture_vector3_refract;
+    api.vector4_zero = rl_capture_vector4_zero;
+    api.vector4_one = rl_capture_vector4_one;
+    api.vector4_add = rl_capture_vector4_add;
+    api.vector4_add_value = rl_capture_vector4_add_value;
+    api.vector4_subtract = rl_capture_vector4_subtract;
+    api.vector4_subtract_value = rl_capture_vector4_subtract_value;
+    api.vector4_length = rl_capture_vector4_length;
+    api.vector4_length_sqr = rl_capture_vector4_length_sqr;
+    api.vector4_dot_product = rl_capture_vector4_dot_product;
+    api.vector4_distance = rl_capture_vector4_distance;
+    api.vector4_distance_sqr = rl_capture_vector4_distance_sqr;
+    api.vector4_scale = rl_capture_vector4_scale;
+    api.vector4_multiply = rl_capture_vector4_multiply;
+    api.vector4_negate = rl_capture_vector4_negate;
+    api.vector4_divide = rl_capture_vector4_divide;
+    api.vector4_normalize = rl_capture_vector4_normalize;
+    api.vector4_min = rl_capture_vector4_min;
+    api.vector4_max = rl_capture_vector4_max;
+    api.vector4_lerp = rl_capture_vector4_lerp;
+    api.vector4_move_towards = rl_capture_vector4_move_towards;
+    api.vector4_invert = rl_capture_vector4_invert;
+    api.vector4_equals = rl_capture_vector4_equals;
+    api.matrix_determinant = rl_capture_matrix_determinant;
+    api.matrix_trace = rl_capture_matrix_trace;
+    api.matrix_transpose = rl_capture_matrix_transpose;
+    api.matrix_invert = rl_capture_matrix_invert;
+    api.matrix_identity = rl_capture_matrix_identity;
+    api.matrix_add = rl_capture_matrix_add;
+    api.matrix_subtract = rl_capture_matrix_subtract;
+    api.matrix_multiply = rl_capture_matrix_multiply;
+    api.matrix_translate = rl_capture_matrix_translate;
+    api.matrix_rotate = rl_capture_matrix_rotate;
+    api.matrix_rotate_x = rl_capture_matrix_rotate_x;
+    api.matrix_rotate_y = rl_capture_matrix_rotate_y;
+    api.matrix_rotate_z = rl_capture_matrix_rotate_z;
+    api.matrix_rotate_xyz = rl_capture_matrix_rotate_xyz;
+    api.matrix_rotate_zyx = rl_capture_matrix_rotate_zyx;
+    api.matrix_scale = rl_capture_matrix_scale;
+    api.matrix_frustum = rl_capture_matrix_frustum;
+    api.matrix_perspective = rl_capture_matrix_perspective;
+    api.matrix_ortho = rl_capture_matrix_ortho;
+    api.matrix_look_at = rl_capture_matrix_look_at;
+    api.matrix_to_float_v = rl_capture_matrix_to_float_v;
+    api.quaternion_add = rl_capture_quaternion_add;
+    api.quaternion_add_value = rl_capture_quaternion_add_value;
+    api.quaternion_subtract = rl_capture_quaternion_subtract;
+    api.quaternion_subtract_value = rl_capture_quaternion_subtract_value;
+    api.quaternion_identity = rl_capture_quaternion_identity;
+    api.quaternion_length = rl_capture_quaternion_length;
+    api.quaternion_normalize = rl_capture_quaternion_normalize;
+    api.quaternion_invert = rl_capture_quaternion_invert;
+    api.quaternion_multiply = rl_capture_quaternion_multiply;
+    api.quaternion_scale = rl_capture_quaternion_scale;
+    api.quaternion_divide = rl_capture_quaternion_divide;
+    api.quaternion_lerp = rl_capture_quaternion_lerp;
+    api.quaternion_nlerp = rl_capture_quaternion_nlerp;
+    api.quaternion_slerp = rl_capture_quaternion_slerp;
+    api.quaternion_cubic_hermite_spline = rl_capture_quaternion_cubic_hermite_spline;
+    api.quaternion_from_vector3_to_vector3 = rl_capture_quaternion_from_vector3_to_vector3;
+    api.quaternion_from_matrix = rl_capture_quaternion_from_matrix;
+    api.quaternion_to_matrix = rl_capture_quaternion_to_matrix;
+    api.quaternion_from_axis_angle = rl_capture_quaternion_from_axis_angle;
+    api.quaternion_to_axis_angle = rl_capture_quaternion_to_axis_angle;
+    api.quaternion_from_euler = rl_capture_quaternion_from_euler;
+    api.quaternion_to_euler = rl_capture_quaternion_to_euler;
+    api.quaternion_transform = rl_capture_quaternion_transform;
+    api.quaternion_equals = rl_capture_quaternion_equals;
+    api.matrix_decompose = rl_capture_matrix_decompose;
+    return &api;
+}
+
+#endif // RAYLIB_API_CAPTURE_GEN_H
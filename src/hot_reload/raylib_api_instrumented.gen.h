@@ -0,0 +1,5505 @@
+#ifndef RAYLIB_API_INSTRUMENTED_GEN_H
+#define RAYLIB_API_INSTRUMENTED_GEN_H
+
+// DO NOT EDIT THIS FILE, CHANGES WILL BE LOST
+// Auto-generated by generate_raylib_api.py from raylib.h
+// Timestamp: 2026-10-19 10:29:30
+//
+// Host only. A RaylibAPI table where every entry counts (and optionally times)
+// its calls before forwarding to a target table. Variadic functions can't be
+// forwarded, so they keep pointing straight to the target.
+
+#include "raylib_api.gen.h"
+#include "raylib_api_calls.gen.h"
+#include "raylib_call_stats.h"
+
+static RaylibAPI* raylib_instrumented_target = NULL;
+
+static void rl_instrumented_init_window(int width, int height, const char *title) {
+    RL_CALL_BEGIN(RL_CALL_INIT_WINDOW);
+    raylib_instrumented_target->init_window(width, height, title);
+    RL_CALL_END(RL_CALL_INIT_WINDOW);
+}
+
+static void rl_instrumented_close_window(void) {
+    RL_CALL_BEGIN(RL_CALL_CLOSE_WINDOW);
+    raylib_instrumented_target->close_window();
+    RL_CALL_END(RL_CALL_CLOSE_WINDOW);
+}
+
+static bool rl_instrumented_window_should_close(void) {
+    RL_CALL_BEGIN(RL_CALL_WINDOW_SHOULD_CLOSE);
+    bool result = raylib_instrumented_target->window_should_close();
+    RL_CALL_END(RL_CALL_WINDOW_SHOULD_CLOSE);
+    return result;
+}
+
+static bool rl_instrumented_is_window_ready(void) {
+    RL_CALL_BEGIN(RL_CALL_IS_WINDOW_READY);
+    bool result = raylib_instrumented_target->is_window_ready();
+    RL_CALL_END(RL_CALL_IS_WINDOW_READY);
+    return result;
+}
+
+static bool rl_instrumented_is_window_fullscreen(void) {
+    RL_CALL_BEGIN(RL_CALL_IS_WINDOW_FULLSCREEN);
+    bool result = raylib_instrumented_target->is_window_fullscreen();
+    RL_CALL_END(RL_CALL_IS_WINDOW_FULLSCREEN);
+    return result;
+}
+
+static bool rl_instrumented_is_window_hidden(void) {
+    RL_CALL_BEGIN(RL_CALL_IS_WINDOW_HIDDEN);
+    bool result = raylib_instrumented_target->is_window_hidden();
+    RL_CALL_END(RL_CALL_IS_WINDOW_HIDDEN);
+    return result;
+}
+
+static bool rl_instrumented_is_window_minimized(void) {
+    RL_CALL_BEGIN(RL_CALL_IS_WINDOW_MINIMIZED);
+    bool result = raylib_instrumented_target->is_window_minimized();
+    RL_CALL_END(RL_CALL_IS_WINDOW_MINIMIZED);
+    return result;
+}
+
+static bool rl_instrumented_is_window_maximized(void) {
+    RL_CALL_BEGIN(RL_CALL_IS_WINDOW_MAXIMIZED);
+    bool result = raylib_instrumented_target->is_window_maximized();
+    RL_CALL_END(RL_CALL_IS_WINDOW_MAXIMIZED);
+    return result;
+}
+
+static bool rl_instrumented_is_window_focused(void) {
+    RL_CALL_BEGIN(RL_CALL_IS_WINDOW_FOCUSED);
+    bool result = raylib_instrumented_target->is_window_focused();
+    RL_CALL_END(RL_CALL_IS_WINDOW_FOCUSED);
+    return result;
+}
+
+static bool rl_instrumented_is_window_resized(void) {
+    RL_CALL_BEGIN(RL_CALL_IS_WINDOW_RESIZED);
+    bool result = raylib_instrumented_target->is_window_resized();
+    RL_CALL_END(RL_CALL_IS_WINDOW_RESIZED);
+    return result;
+}
+
+static bool rl_instrumented_is_window_state(unsigned int flag) {
+    RL_CALL_BEGIN(RL_CALL_IS_WINDOW_STATE);
+    bool result = raylib_instrumented_target->is_window_state(flag);
+    RL_CALL_END(RL_CALL_IS_WINDOW_STATE);
+    return result;
+}
+
+static void rl_instrumented_set_window_state(unsigned int flags) {
+    RL_CALL_BEGIN(RL_CALL_SET_WINDOW_STATE);
+    raylib_instrumented_target->set_window_state(flags);
+    RL_CALL_END(RL_CALL_SET_WINDOW_STATE);
+}
+
+static void rl_instrumented_clear_window_state(unsigned int flags) {
+    RL_CALL_BEGIN(RL_CALL_CLEAR_WINDOW_STATE);
+    raylib_instrumented_target->clear_window_state(flags);
+    RL_CALL_END(RL_CALL_CLEAR_WINDOW_STATE);
+}
+
+static void rl_instrumented_toggle_fullscreen(void) {
+    RL_CALL_BEGIN(RL_CALL_TOGGLE_FULLSCREEN);
+    raylib_instrumented_target->toggle_fullscreen();
+    RL_CALL_END(RL_CALL_TOGGLE_FULLSCREEN);
+}
+
+static void rl_instrumented_toggle_borderless_windowed(void) {
+    RL_CALL_BEGIN(RL_CALL_TOGGLE_BORDERLESS_WINDOWED);
+    raylib_instrumented_target->toggle_borderless_windowed();
+    RL_CALL_END(RL_CALL_TOGGLE_BORDERLESS_WINDOWED);
+}
+
+static void rl_instrumented_maximize_window(void) {
+    RL_CALL_BEGIN(RL_CALL_MAXIMIZE_WINDOW);
+    raylib_instrumented_target->maximize_window();
+    RL_CALL_END(RL_CALL_MAXIMIZE_WINDOW);
+}
+
+static void rl_instrumented_minimize_window(void) {
+    RL_CALL_BEGIN(RL_CALL_MINIMIZE_WINDOW);
+    raylib_instrumented_target->minimize_window();
+    RL_CALL_END(RL_CALL_MINIMIZE_WINDOW);
+}
+
+static void rl_instrumented_restore_window(void) {
+    RL_CALL_BEGIN(RL_CALL_RESTORE_WINDOW);
+    raylib_instrumented_target->restore_window();
+    RL_CALL_END(RL_CALL_RESTORE_WINDOW);
+}
+
+static void rl_instrumented_set_window_icon(Image image) {
+    RL_CALL_BEGIN(RL_CALL_SET_WINDOW_ICON);
+    raylib_instrumented_target->set_window_icon(image);
+    RL_CALL_END(RL_CALL_SET_WINDOW_ICON);
+}
+
+static void rl_instrumented_set_window_icons(Image *images, int count) {
+    RL_CALL_BEGIN(RL_CALL_SET_WINDOW_ICONS);
+    raylib_instrumented_target->set_window_icons(images, count);
+    RL_CALL_END(RL_CALL_SET_WINDOW_ICONS);
+}
+
+static void rl_instrumented_set_window_title(const char *title) {
+    RL_CALL_BEGIN(RL_CALL_SET_WINDOW_TITLE);
+    raylib_instrumented_target->set_window_title(title);
+    RL_CALL_END(RL_CALL_SET_WINDOW_TITLE);
+}
+
+static void rl_instrumented_set_window_position(int x, int y) {
+    RL_CALL_BEGIN(RL_CALL_SET_WINDOW_POSITION);
+    raylib_instrumented_target->set_window_position(x, y);
+    RL_CALL_END(RL_CALL_SET_WINDOW_POSITION);
+}
+
+static void rl_instrumented_set_window_monitor(int monitor) {
+    RL_CALL_BEGIN(RL_CALL_SET_WINDOW_MONITOR);
+    raylib_instrumented_target->set_window_monitor(monitor);
+    RL_CALL_END(RL_CALL_SET_WINDOW_MONITOR);
+}
+
+static void rl_instrumented_set_window_min_size(int width, int height) {
+    RL_CALL_BEGIN(RL_CALL_SET_WINDOW_MIN_SIZE);
+    raylib_instrumented_target->set_window_min_size(width, height);
+    RL_CALL_END(RL_CALL_SET_WINDOW_MIN_SIZE);
+}
+
+static void rl_instrumented_set_window_max_size(int width, int height) {
+    RL_CALL_BEGIN(RL_CALL_SET_WINDOW_MAX_SIZE);
+    raylib_instrumented_target->set_window_max_size(width, height);
+    RL_CALL_END(RL_CALL_SET_WINDOW_MAX_SIZE);
+}
+
+static void rl_instrumented_set_window_size(int width, int height) {
+    RL_CALL_BEGIN(RL_CALL_SET_WINDOW_SIZE);
+    raylib_instrumented_target->set_window_size(width, height);
+    RL_CALL_END(RL_CALL_SET_WINDOW_SIZE);
+}
+
+static void rl_instrumented_set_window_opacity(float opacity) {
+    RL_CALL_BEGIN(RL_CALL_SET_WINDOW_OPACITY);
+    raylib_instrumented_target->set_window_opacity(opacity);
+    RL_CALL_END(RL_CALL_SET_WINDOW_OPACITY);
+}
+
+static void rl_instrumented_set_window_focused(void) {
+    RL_CALL_BEGIN(RL_CALL_SET_WINDOW_FOCUSED);
+    raylib_instrumented_target->set_window_focused();
+    RL_CALL_END(RL_CALL_SET_WINDOW_FOCUSED);
+}
+
+static void * rl_instrumented_get_window_handle(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_WINDOW_HANDLE);
+    void * result = raylib_instrumented_target->get_window_handle();
+    RL_CALL_END(RL_CALL_GET_WINDOW_HANDLE);
+    return result;
+}
+
+static int rl_instrumented_get_screen_width(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_SCREEN_WIDTH);
+    int result = raylib_instrumented_target->get_screen_width();
+    RL_CALL_END(RL_CALL_GET_SCREEN_WIDTH);
+    return result;
+}
+
+static int rl_instrumented_get_screen_height(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_SCREEN_HEIGHT);
+    int result = raylib_instrumented_target->get_screen_height();
+    RL_CALL_END(RL_CALL_GET_SCREEN_HEIGHT);
+    return result;
+}
+
+static int rl_instrumented_get_render_width(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_RENDER_WIDTH);
+    int result = raylib_instrumented_target->get_render_width();
+    RL_CALL_END(RL_CALL_GET_RENDER_WIDTH);
+    return result;
+}
+
+static int rl_instrumented_get_render_height(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_RENDER_HEIGHT);
+    int result = raylib_instrumented_target->get_render_height();
+    RL_CALL_END(RL_CALL_GET_RENDER_HEIGHT);
+    return result;
+}
+
+static int rl_instrumented_get_monitor_count(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_MONITOR_COUNT);
+    int result = raylib_instrumented_target->get_monitor_count();
+    RL_CALL_END(RL_CALL_GET_MONITOR_COUNT);
+    return result;
+}
+
+static int rl_instrumented_get_current_monitor(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_CURRENT_MONITOR);
+    int result = raylib_instrumented_target->get_current_monitor();
+    RL_CALL_END(RL_CALL_GET_CURRENT_MONITOR);
+    return result;
+}
+
+static Vector2 rl_instrumented_get_monitor_position(int monitor) {
+    RL_CALL_BEGIN(RL_CALL_GET_MONITOR_POSITION);
+    Vector2 result = raylib_instrumented_target->get_monitor_position(monitor);
+    RL_CALL_END(RL_CALL_GET_MONITOR_POSITION);
+    return result;
+}
+
+static int rl_instrumented_get_monitor_width(int monitor) {
+    RL_CALL_BEGIN(RL_CALL_GET_MONITOR_WIDTH);
+    int result = raylib_instrumented_target->get_monitor_width(monitor);
+    RL_CALL_END(RL_CALL_GET_MONITOR_WIDTH);
+    return result;
+}
+
+static int rl_instrumented_get_monitor_height(int monitor) {
+    RL_CALL_BEGIN(RL_CALL_GET_MONITOR_HEIGHT);
+    int result = raylib_instrumented_target->get_monitor_height(monitor);
+    RL_CALL_END(RL_CALL_GET_MONITOR_HEIGHT);
+    return result;
+}
+
+static int rl_instrumented_get_monitor_physical_width(int monitor) {
+    RL_CALL_BEGIN(RL_CALL_GET_MONITOR_PHYSICAL_WIDTH);
+    int result = raylib_instrumented_target->get_monitor_physical_width(monitor);
+    RL_CALL_END(RL_CALL_GET_MONITOR_PHYSICAL_WIDTH);
+    return result;
+}
+
+static int rl_instrumented_get_monitor_physical_height(int monitor) {
+    RL_CALL_BEGIN(RL_CALL_GET_MONITOR_PHYSICAL_HEIGHT);
+    int result = raylib_instrumented_target->get_monitor_physical_height(monitor);
+    RL_CALL_END(RL_CALL_GET_MONITOR_PHYSICAL_HEIGHT);
+    return result;
+}
+
+static int rl_instrumented_get_monitor_refresh_rate(int monitor) {
+    RL_CALL_BEGIN(RL_CALL_GET_MONITOR_REFRESH_RATE);
+    int result = raylib_instrumented_target->get_monitor_refresh_rate(monitor);
+    RL_CALL_END(RL_CALL_GET_MONITOR_REFRESH_RATE);
+    return result;
+}
+
+static Vector2 rl_instrumented_get_window_position(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_WINDOW_POSITION);
+    Vector2 result = raylib_instrumented_target->get_window_position();
+    RL_CALL_END(RL_CALL_GET_WINDOW_POSITION);
+    return result;
+}
+
+static Vector2 rl_instrumented_get_window_scale_dpi(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_WINDOW_SCALE_DPI);
+    Vector2 result = raylib_instrumented_target->get_window_scale_dpi();
+    RL_CALL_END(RL_CALL_GET_WINDOW_SCALE_DPI);
+    return result;
+}
+
+static const char * rl_instrumented_get_monitor_name(int monitor) {
+    RL_CALL_BEGIN(RL_CALL_GET_MONITOR_NAME);
+    const char * result = raylib_instrumented_target->get_monitor_name(monitor);
+    RL_CALL_END(RL_CALL_GET_MONITOR_NAME);
+    return result;
+}
+
+static void rl_instrumented_set_clipboard_text(const char *text) {
+    RL_CALL_BEGIN(RL_CALL_SET_CLIPBOARD_TEXT);
+    raylib_instrumented_target->set_clipboard_text(text);
+    RL_CALL_END(RL_CALL_SET_CLIPBOARD_TEXT);
+}
+
+static const char * rl_instrumented_get_clipboard_text(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_CLIPBOARD_TEXT);
+    const char * result = raylib_instrumented_target->get_clipboard_text();
+    RL_CALL_END(RL_CALL_GET_CLIPBOARD_TEXT);
+    return result;
+}
+
+static Image rl_instrumented_get_clipboard_image(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_CLIPBOARD_IMAGE);
+    Image result = raylib_instrumented_target->get_clipboard_image();
+    RL_CALL_END(RL_CALL_GET_CLIPBOARD_IMAGE);
+    return result;
+}
+
+static void rl_instrumented_enable_event_waiting(void) {
+    RL_CALL_BEGIN(RL_CALL_ENABLE_EVENT_WAITING);
+    raylib_instrumented_target->enable_event_waiting();
+    RL_CALL_END(RL_CALL_ENABLE_EVENT_WAITING);
+}
+
+static void rl_instrumented_disable_event_waiting(void) {
+    RL_CALL_BEGIN(RL_CALL_DISABLE_EVENT_WAITING);
+    raylib_instrumented_target->disable_event_waiting();
+    RL_CALL_END(RL_CALL_DISABLE_EVENT_WAITING);
+}
+
+static void rl_instrumented_show_cursor(void) {
+    RL_CALL_BEGIN(RL_CALL_SHOW_CURSOR);
+    raylib_instrumented_target->show_cursor();
+    RL_CALL_END(RL_CALL_SHOW_CURSOR);
+}
+
+static void rl_instrumented_hide_cursor(void) {
+    RL_CALL_BEGIN(RL_CALL_HIDE_CURSOR);
+    raylib_instrumented_target->hide_cursor();
+    RL_CALL_END(RL_CALL_HIDE_CURSOR);
+}
+
+static bool rl_instrumented_is_cursor_hidden(void) {
+    RL_CALL_BEGIN(RL_CALL_IS_CURSOR_HIDDEN);
+    bool result = raylib_instrumented_target->is_cursor_hidden();
+    RL_CALL_END(RL_CALL_IS_CURSOR_HIDDEN);
+    return result;
+}
+
+static void rl_instrumented_enable_cursor(void) {
+    RL_CALL_BEGIN(RL_CALL_ENABLE_CURSOR);
+    raylib_instrumented_target->enable_cursor();
+    RL_CALL_END(RL_CALL_ENABLE_CURSOR);
+}
+
+static void rl_instrumented_disable_cursor(void) {
+    RL_CALL_BEGIN(RL_CALL_DISABLE_CURSOR);
+    raylib_instrumented_target->disable_cursor();
+    RL_CALL_END(RL_CALL_DISABLE_CURSOR);
+}
+
+static bool rl_instrumented_is_cursor_on_screen(void) {
+    RL_CALL_BEGIN(RL_CALL_IS_CURSOR_ON_SCREEN);
+    bool result = raylib_instrumented_target->is_cursor_on_screen();
+    RL_CALL_END(RL_CALL_IS_CURSOR_ON_SCREEN);
+    return result;
+}
+
+static void rl_instrumented_clear_background(Color color) {
+    RL_CALL_BEGIN(RL_CALL_CLEAR_BACKGROUND);
+    raylib_instrumented_target->clear_background(color);
+    RL_CALL_END(RL_CALL_CLEAR_BACKGROUND);
+}
+
+static void rl_instrumented_begin_drawing(void) {
+    RL_CALL_BEGIN(RL_CALL_BEGIN_DRAWING);
+    raylib_instrumented_target->begin_drawing();
+    RL_CALL_END(RL_CALL_BEGIN_DRAWING);
+}
+
+static void rl_instrumented_end_drawing(void) {
+    RL_CALL_BEGIN(RL_CALL_END_DRAWING);
+    raylib_instrumented_target->end_drawing();
+    RL_CALL_END(RL_CALL_END_DRAWING);
+}
+
+static void rl_instrumented_begin_mode2_d(Camera2D camera) {
+    RL_CALL_BEGIN(RL_CALL_BEGIN_MODE2_D);
+    raylib_instrumented_target->begin_mode2_d(camera);
+    RL_CALL_END(RL_CALL_BEGIN_MODE2_D);
+}
+
+static void rl_instrumented_end_mode2_d(void) {
+    RL_CALL_BEGIN(RL_CALL_END_MODE2_D);
+    raylib_instrumented_target->end_mode2_d();
+    RL_CALL_END(RL_CALL_END_MODE2_D);
+}
+
+static void rl_instrumented_begin_mode3_d(Camera3D camera) {
+    RL_CALL_BEGIN(RL_CALL_BEGIN_MODE3_D);
+    raylib_instrumented_target->begin_mode3_d(camera);
+    RL_CALL_END(RL_CALL_BEGIN_MODE3_D);
+}
+
+static void rl_instrumented_end_mode3_d(void) {
+    RL_CALL_BEGIN(RL_CALL_END_MODE3_D);
+    raylib_instrumented_target->end_mode3_d();
+    RL_CALL_END(RL_CALL_END_MODE3_D);
+}
+
+static void rl_instrumented_begin_texture_mode(RenderTexture2D target) {
+    RL_CALL_BEGIN(RL_CALL_BEGIN_TEXTURE_MODE);
+    raylib_instrumented_target->begin_texture_mode(target);
+    RL_CALL_END(RL_CALL_BEGIN_TEXTURE_MODE);
+}
+
+static void rl_instrumented_end_texture_mode(void) {
+    RL_CALL_BEGIN(RL_CALL_END_TEXTURE_MODE);
+    raylib_instrumented_target->end_texture_mode();
+    RL_CALL_END(RL_CALL_END_TEXTURE_MODE);
+}
+
+static void rl_instrumented_begin_shader_mode(Shader shader) {
+    RL_CALL_BEGIN(RL_CALL_BEGIN_SHADER_MODE);
+    raylib_instrumented_target->begin_shader_mode(shader);
+    RL_CALL_END(RL_CALL_BEGIN_SHADER_MODE);
+}
+
+static void rl_instrumented_end_shader_mode(void) {
+    RL_CALL_BEGIN(RL_CALL_END_SHADER_MODE);
+    raylib_instrumented_target->end_shader_mode();
+    RL_CALL_END(RL_CALL_END_SHADER_MODE);
+}
+
+static void rl_instrumented_begin_blend_mode(int mode) {
+    RL_CALL_BEGIN(RL_CALL_BEGIN_BLEND_MODE);
+    raylib_instrumented_target->begin_blend_mode(mode);
+    RL_CALL_END(RL_CALL_BEGIN_BLEND_MODE);
+}
+
+static void rl_instrumented_end_blend_mode(void) {
+    RL_CALL_BEGIN(RL_CALL_END_BLEND_MODE);
+    raylib_instrumented_target->end_blend_mode();
+    RL_CALL_END(RL_CALL_END_BLEND_MODE);
+}
+
+static void rl_instrumented_begin_scissor_mode(int x, int y, int width, int height) {
+    RL_CALL_BEGIN(RL_CALL_BEGIN_SCISSOR_MODE);
+    raylib_instrumented_target->begin_scissor_mode(x, y, width, height);
+    RL_CALL_END(RL_CALL_BEGIN_SCISSOR_MODE);
+}
+
+static void rl_instrumented_end_scissor_mode(void) {
+    RL_CALL_BEGIN(RL_CALL_END_SCISSOR_MODE);
+    raylib_instrumented_target->end_scissor_mode();
+    RL_CALL_END(RL_CALL_END_SCISSOR_MODE);
+}
+
+static void rl_instrumented_begin_vr_stereo_mode(VrStereoConfig config) {
+    RL_CALL_BEGIN(RL_CALL_BEGIN_VR_STEREO_MODE);
+    raylib_instrumented_target->begin_vr_stereo_mode(config);
+    RL_CALL_END(RL_CALL_BEGIN_VR_STEREO_MODE);
+}
+
+static void rl_instrumented_end_vr_stereo_mode(void) {
+    RL_CALL_BEGIN(RL_CALL_END_VR_STEREO_MODE);
+    raylib_instrumented_target->end_vr_stereo_mode();
+    RL_CALL_END(RL_CALL_END_VR_STEREO_MODE);
+}
+
+static VrStereoConfig rl_instrumented_load_vr_stereo_config(VrDeviceInfo device) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_VR_STEREO_CONFIG);
+    VrStereoConfig result = raylib_instrumented_target->load_vr_stereo_config(device);
+    RL_CALL_END(RL_CALL_LOAD_VR_STEREO_CONFIG);
+    return result;
+}
+
+static void rl_instrumented_unload_vr_stereo_config(VrStereoConfig config) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_VR_STEREO_CONFIG);
+    raylib_instrumented_target->unload_vr_stereo_config(config);
+    RL_CALL_END(RL_CALL_UNLOAD_VR_STEREO_CONFIG);
+}
+
+static Shader rl_instrumented_load_shader(const char *vsFileName, const char *fsFileName) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_SHADER);
+    Shader result = raylib_instrumented_target->load_shader(vsFileName, fsFileName);
+    RL_CALL_END(RL_CALL_LOAD_SHADER);
+    return result;
+}
+
+static Shader rl_instrumented_load_shader_from_memory(const char *vsCode, const char *fsCode) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_SHADER_FROM_MEMORY);
+    Shader result = raylib_instrumented_target->load_shader_from_memory(vsCode, fsCode);
+    RL_CALL_END(RL_CALL_LOAD_SHADER_FROM_MEMORY);
+    return result;
+}
+
+static bool rl_instrumented_is_shader_valid(Shader shader) {
+    RL_CALL_BEGIN(RL_CALL_IS_SHADER_VALID);
+    bool result = raylib_instrumented_target->is_shader_valid(shader);
+    RL_CALL_END(RL_CALL_IS_SHADER_VALID);
+    return result;
+}
+
+static int rl_instrumented_get_shader_location(Shader shader, const char *uniformName) {
+    RL_CALL_BEGIN(RL_CALL_GET_SHADER_LOCATION);
+    int result = raylib_instrumented_target->get_shader_location(shader, uniformName);
+    RL_CALL_END(RL_CALL_GET_SHADER_LOCATION);
+    return result;
+}
+
+static int rl_instrumented_get_shader_location_attrib(Shader shader, const char *attribName) {
+    RL_CALL_BEGIN(RL_CALL_GET_SHADER_LOCATION_ATTRIB);
+    int result = raylib_instrumented_target->get_shader_location_attrib(shader, attribName);
+    RL_CALL_END(RL_CALL_GET_SHADER_LOCATION_ATTRIB);
+    return result;
+}
+
+static void rl_instrumented_set_shader_value(Shader shader, int locIndex, const void *value, int uniformType) {
+    RL_CALL_BEGIN(RL_CALL_SET_SHADER_VALUE);
+    raylib_instrumented_target->set_shader_value(shader, locIndex, value, uniformType);
+    RL_CALL_END(RL_CALL_SET_SHADER_VALUE);
+}
+
+static void rl_instrumented_set_shader_value_v(Shader shader, int locIndex, const void *value, int uniformType, int count) {
+    RL_CALL_BEGIN(RL_CALL_SET_SHADER_VALUE_V);
+    raylib_instrumented_target->set_shader_value_v(shader, locIndex, value, uniformType, count);
+    RL_CALL_END(RL_CALL_SET_SHADER_VALUE_V);
+}
+
+static void rl_instrumented_set_shader_value_matrix(Shader shader, int locIndex, Matrix mat) {
+    RL_CALL_BEGIN(RL_CALL_SET_SHADER_VALUE_MATRIX);
+    raylib_instrumented_target->set_shader_value_matrix(shader, locIndex, mat);
+    RL_CALL_END(RL_CALL_SET_SHADER_VALUE_MATRIX);
+}
+
+static void rl_instrumented_set_shader_value_texture(Shader shader, int locIndex, Texture2D texture) {
+    RL_CALL_BEGIN(RL_CALL_SET_SHADER_VALUE_TEXTURE);
+    raylib_instrumented_target->set_shader_value_texture(shader, locIndex, texture);
+    RL_CALL_END(RL_CALL_SET_SHADER_VALUE_TEXTURE);
+}
+
+static void rl_instrumented_unload_shader(Shader shader) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_SHADER);
+    raylib_instrumented_target->unload_shader(shader);
+    RL_CALL_END(RL_CALL_UNLOAD_SHADER);
+}
+
+static Ray rl_instrumented_get_screen_to_world_ray(Vector2 position, Camera camera) {
+    RL_CALL_BEGIN(RL_CALL_GET_SCREEN_TO_WORLD_RAY);
+    Ray result = raylib_instrumented_target->get_screen_to_world_ray(position, camera);
+    RL_CALL_END(RL_CALL_GET_SCREEN_TO_WORLD_RAY);
+    return result;
+}
+
+static Ray rl_instrumented_get_screen_to_world_ray_ex(Vector2 position, Camera camera, int width, int height) {
+    RL_CALL_BEGIN(RL_CALL_GET_SCREEN_TO_WORLD_RAY_EX);
+    Ray result = raylib_instrumented_target->get_screen_to_world_ray_ex(position, camera, width, height);
+    RL_CALL_END(RL_CALL_GET_SCREEN_TO_WORLD_RAY_EX);
+    return result;
+}
+
+static Vector2 rl_instrumented_get_world_to_screen(Vector3 position, Camera camera) {
+    RL_CALL_BEGIN(RL_CALL_GET_WORLD_TO_SCREEN);
+    Vector2 result = raylib_instrumented_target->get_world_to_screen(position, camera);
+    RL_CALL_END(RL_CALL_GET_WORLD_TO_SCREEN);
+    return result;
+}
+
+static Vector2 rl_instrumented_get_world_to_screen_ex(Vector3 position, Camera camera, int width, int height) {
+    RL_CALL_BEGIN(RL_CALL_GET_WORLD_TO_SCREEN_EX);
+    Vector2 result = raylib_instrumented_target->get_world_to_screen_ex(position, camera, width, height);
+    RL_CALL_END(RL_CALL_GET_WORLD_TO_SCREEN_EX);
+    return result;
+}
+
+static Vector2 rl_instrumented_get_world_to_screen2_d(Vector2 position, Camera2D camera) {
+    RL_CALL_BEGIN(RL_CALL_GET_WORLD_TO_SCREEN2_D);
+    Vector2 result = raylib_instrumented_target->get_world_to_screen2_d(position, camera);
+    RL_CALL_END(RL_CALL_GET_WORLD_TO_SCREEN2_D);
+    return result;
+}
+
+static Vector2 rl_instrumented_get_screen_to_world2_d(Vector2 position, Camera2D camera) {
+    RL_CALL_BEGIN(RL_CALL_GET_SCREEN_TO_WORLD2_D);
+    Vector2 result = raylib_instrumented_target->get_screen_to_world2_d(position, camera);
+    RL_CALL_END(RL_CALL_GET_SCREEN_TO_WORLD2_D);
+    return result;
+}
+
+static Matrix rl_instrumented_get_camera_matrix(Camera camera) {
+    RL_CALL_BEGIN(RL_CALL_GET_CAMERA_MATRIX);
+    Matrix result = raylib_instrumented_target->get_camera_matrix(camera);
+    RL_CALL_END(RL_CALL_GET_CAMERA_MATRIX);
+    return result;
+}
+
+static Matrix rl_instrumented_get_camera_matrix2_d(Camera2D camera) {
+    RL_CALL_BEGIN(RL_CALL_GET_CAMERA_MATRIX2_D);
+    Matrix result = raylib_instrumented_target->get_camera_matrix2_d(camera);
+    RL_CALL_END(RL_CALL_GET_CAMERA_MATRIX2_D);
+    return result;
+}
+
+static void rl_instrumented_set_target_fps(int fps) {
+    RL_CALL_BEGIN(RL_CALL_SET_TARGET_FPS);
+    raylib_instrumented_target->set_target_fps(fps);
+    RL_CALL_END(RL_CALL_SET_TARGET_FPS);
+}
+
+static float rl_instrumented_get_frame_time(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_FRAME_TIME);
+    float result = raylib_instrumented_target->get_frame_time();
+    RL_CALL_END(RL_CALL_GET_FRAME_TIME);
+    return result;
+}
+
+static double rl_instrumented_get_time(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_TIME);
+    double result = raylib_instrumented_target->get_time();
+    RL_CALL_END(RL_CALL_GET_TIME);
+    return result;
+}
+
+static int rl_instrumented_get_fps(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_FPS);
+    int result = raylib_instrumented_target->get_fps();
+    RL_CALL_END(RL_CALL_GET_FPS);
+    return result;
+}
+
+static void rl_instrumented_swap_screen_buffer(void) {
+    RL_CALL_BEGIN(RL_CALL_SWAP_SCREEN_BUFFER);
+    raylib_instrumented_target->swap_screen_buffer();
+    RL_CALL_END(RL_CALL_SWAP_SCREEN_BUFFER);
+}
+
+static void rl_instrumented_poll_input_events(void) {
+    RL_CALL_BEGIN(RL_CALL_POLL_INPUT_EVENTS);
+    raylib_instrumented_target->poll_input_events();
+    RL_CALL_END(RL_CALL_POLL_INPUT_EVENTS);
+}
+
+static void rl_instrumented_wait_time(double seconds) {
+    RL_CALL_BEGIN(RL_CALL_WAIT_TIME);
+    raylib_instrumented_target->wait_time(seconds);
+    RL_CALL_END(RL_CALL_WAIT_TIME);
+}
+
+static void rl_instrumented_set_random_seed(unsigned int seed) {
+    RL_CALL_BEGIN(RL_CALL_SET_RANDOM_SEED);
+    raylib_instrumented_target->set_random_seed(seed);
+    RL_CALL_END(RL_CALL_SET_RANDOM_SEED);
+}
+
+static int rl_instrumented_get_random_value(int min, int max) {
+    RL_CALL_BEGIN(RL_CALL_GET_RANDOM_VALUE);
+    int result = raylib_instrumented_target->get_random_value(min, max);
+    RL_CALL_END(RL_CALL_GET_RANDOM_VALUE);
+    return result;
+}
+
+static int * rl_instrumented_load_random_sequence(unsigned int count, int min, int max) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_RANDOM_SEQUENCE);
+    int * result = raylib_instrumented_target->load_random_sequence(count, min, max);
+    RL_CALL_END(RL_CALL_LOAD_RANDOM_SEQUENCE);
+    return result;
+}
+
+static void rl_instrumented_unload_random_sequence(int *sequence) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_RANDOM_SEQUENCE);
+    raylib_instrumented_target->unload_random_sequence(sequence);
+    RL_CALL_END(RL_CALL_UNLOAD_RANDOM_SEQUENCE);
+}
+
+static void rl_instrumented_take_screenshot(const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_TAKE_SCREENSHOT);
+    raylib_instrumented_target->take_screenshot(fileName);
+    RL_CALL_END(RL_CALL_TAKE_SCREENSHOT);
+}
+
+static void rl_instrumented_set_config_flags(unsigned int flags) {
+    RL_CALL_BEGIN(RL_CALL_SET_CONFIG_FLAGS);
+    raylib_instrumented_target->set_config_flags(flags);
+    RL_CALL_END(RL_CALL_SET_CONFIG_FLAGS);
+}
+
+static void rl_instrumented_open_url(const char *url) {
+    RL_CALL_BEGIN(RL_CALL_OPEN_URL);
+    raylib_instrumented_target->open_url(url);
+    RL_CALL_END(RL_CALL_OPEN_URL);
+}
+
+static void rl_instrumented_set_trace_log_level(int logLevel) {
+    RL_CALL_BEGIN(RL_CALL_SET_TRACE_LOG_LEVEL);
+    raylib_instrumented_target->set_trace_log_level(logLevel);
+    RL_CALL_END(RL_CALL_SET_TRACE_LOG_LEVEL);
+}
+
+static void * rl_instrumented_mem_alloc(unsigned int size) {
+    RL_CALL_BEGIN(RL_CALL_MEM_ALLOC);
+    void * result = raylib_instrumented_target->mem_alloc(size);
+    RL_CALL_END(RL_CALL_MEM_ALLOC);
+    return result;
+}
+
+static void * rl_instrumented_mem_realloc(void *ptr, unsigned int size) {
+    RL_CALL_BEGIN(RL_CALL_MEM_REALLOC);
+    void * result = raylib_instrumented_target->mem_realloc(ptr, size);
+    RL_CALL_END(RL_CALL_MEM_REALLOC);
+    return result;
+}
+
+static void rl_instrumented_mem_free(void *ptr) {
+    RL_CALL_BEGIN(RL_CALL_MEM_FREE);
+    raylib_instrumented_target->mem_free(ptr);
+    RL_CALL_END(RL_CALL_MEM_FREE);
+}
+
+static void rl_instrumented_set_trace_log_callback(TraceLogCallback callback) {
+    RL_CALL_BEGIN(RL_CALL_SET_TRACE_LOG_CALLBACK);
+    raylib_instrumented_target->set_trace_log_callback(callback);
+    RL_CALL_END(RL_CALL_SET_TRACE_LOG_CALLBACK);
+}
+
+static void rl_instrumented_set_load_file_data_callback(LoadFileDataCallback callback) {
+    RL_CALL_BEGIN(RL_CALL_SET_LOAD_FILE_DATA_CALLBACK);
+    raylib_instrumented_target->set_load_file_data_callback(callback);
+    RL_CALL_END(RL_CALL_SET_LOAD_FILE_DATA_CALLBACK);
+}
+
+static void rl_instrumented_set_save_file_data_callback(SaveFileDataCallback callback) {
+    RL_CALL_BEGIN(RL_CALL_SET_SAVE_FILE_DATA_CALLBACK);
+    raylib_instrumented_target->set_save_file_data_callback(callback);
+    RL_CALL_END(RL_CALL_SET_SAVE_FILE_DATA_CALLBACK);
+}
+
+static void rl_instrumented_set_load_file_text_callback(LoadFileTextCallback callback) {
+    RL_CALL_BEGIN(RL_CALL_SET_LOAD_FILE_TEXT_CALLBACK);
+    raylib_instrumented_target->set_load_file_text_callback(callback);
+    RL_CALL_END(RL_CALL_SET_LOAD_FILE_TEXT_CALLBACK);
+}
+
+static void rl_instrumented_set_save_file_text_callback(SaveFileTextCallback callback) {
+    RL_CALL_BEGIN(RL_CALL_SET_SAVE_FILE_TEXT_CALLBACK);
+    raylib_instrumented_target->set_save_file_text_callback(callback);
+    RL_CALL_END(RL_CALL_SET_SAVE_FILE_TEXT_CALLBACK);
+}
+
+static unsigned char * rl_instrumented_load_file_data(const char *fileName, int *dataSize) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_FILE_DATA);
+    unsigned char * result = raylib_instrumented_target->load_file_data(fileName, dataSize);
+    RL_CALL_END(RL_CALL_LOAD_FILE_DATA);
+    return result;
+}
+
+static void rl_instrumented_unload_file_data(unsigned char *data) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_FILE_DATA);
+    raylib_instrumented_target->unload_file_data(data);
+    RL_CALL_END(RL_CALL_UNLOAD_FILE_DATA);
+}
+
+static bool rl_instrumented_save_file_data(const char *fileName, void *data, int dataSize) {
+    RL_CALL_BEGIN(RL_CALL_SAVE_FILE_DATA);
+    bool result = raylib_instrumented_target->save_file_data(fileName, data, dataSize);
+    RL_CALL_END(RL_CALL_SAVE_FILE_DATA);
+    return result;
+}
+
+static bool rl_instrumented_export_data_as_code(const unsigned char *data, int dataSize, const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_EXPORT_DATA_AS_CODE);
+    bool result = raylib_instrumented_target->export_data_as_code(data, dataSize, fileName);
+    RL_CALL_END(RL_CALL_EXPORT_DATA_AS_CODE);
+    return result;
+}
+
+static char * rl_instrumented_load_file_text(const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_FILE_TEXT);
+    char * result = raylib_instrumented_target->load_file_text(fileName);
+    RL_CALL_END(RL_CALL_LOAD_FILE_TEXT);
+    return result;
+}
+
+static void rl_instrumented_unload_file_text(char *text) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_FILE_TEXT);
+    raylib_instrumented_target->unload_file_text(text);
+    RL_CALL_END(RL_CALL_UNLOAD_FILE_TEXT);
+}
+
+static bool rl_instrumented_save_file_text(const char *fileName, char *text) {
+    RL_CALL_BEGIN(RL_CALL_SAVE_FILE_TEXT);
+    bool result = raylib_instrumented_target->save_file_text(fileName, text);
+    RL_CALL_END(RL_CALL_SAVE_FILE_TEXT);
+    return result;
+}
+
+static bool rl_instrumented_file_exists(const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_FILE_EXISTS);
+    bool result = raylib_instrumented_target->file_exists(fileName);
+    RL_CALL_END(RL_CALL_FILE_EXISTS);
+    return result;
+}
+
+static bool rl_instrumented_directory_exists(const char *dirPath) {
+    RL_CALL_BEGIN(RL_CALL_DIRECTORY_EXISTS);
+    bool result = raylib_instrumented_target->directory_exists(dirPath);
+    RL_CALL_END(RL_CALL_DIRECTORY_EXISTS);
+    return result;
+}
+
+static bool rl_instrumented_is_file_extension(const char *fileName, const char *ext) {
+    RL_CALL_BEGIN(RL_CALL_IS_FILE_EXTENSION);
+    bool result = raylib_instrumented_target->is_file_extension(fileName, ext);
+    RL_CALL_END(RL_CALL_IS_FILE_EXTENSION);
+    return result;
+}
+
+static int rl_instrumented_get_file_length(const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_GET_FILE_LENGTH);
+    int result = raylib_instrumented_target->get_file_length(fileName);
+    RL_CALL_END(RL_CALL_GET_FILE_LENGTH);
+    return result;
+}
+
+static const char * rl_instrumented_get_file_extension(const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_GET_FILE_EXTENSION);
+    const char * result = raylib_instrumented_target->get_file_extension(fileName);
+    RL_CALL_END(RL_CALL_GET_FILE_EXTENSION);
+    return result;
+}
+
+static const char * rl_instrumented_get_file_name(const char *filePath) {
+    RL_CALL_BEGIN(RL_CALL_GET_FILE_NAME);
+    const char * result = raylib_instrumented_target->get_file_name(filePath);
+    RL_CALL_END(RL_CALL_GET_FILE_NAME);
+    return result;
+}
+
+static const char * rl_instrumented_get_file_name_without_ext(const char *filePath) {
+    RL_CALL_BEGIN(RL_CALL_GET_FILE_NAME_WITHOUT_EXT);
+    const char * result = raylib_instrumented_target->get_file_name_without_ext(filePath);
+    RL_CALL_END(RL_CALL_GET_FILE_NAME_WITHOUT_EXT);
+    return result;
+}
+
+static const char * rl_instrumented_get_directory_path(const char *filePath) {
+    RL_CALL_BEGIN(RL_CALL_GET_DIRECTORY_PATH);
+    const char * result = raylib_instrumented_target->get_directory_path(filePath);
+    RL_CALL_END(RL_CALL_GET_DIRECTORY_PATH);
+    return result;
+}
+
+static const char * rl_instrumented_get_prev_directory_path(const char *dirPath) {
+    RL_CALL_BEGIN(RL_CALL_GET_PREV_DIRECTORY_PATH);
+    const char * result = raylib_instrumented_target->get_prev_directory_path(dirPath);
+    RL_CALL_END(RL_CALL_GET_PREV_DIRECTORY_PATH);
+    return result;
+}
+
+static const char * rl_instrumented_get_working_directory(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_WORKING_DIRECTORY);
+    const char * result = raylib_instrumented_target->get_working_directory();
+    RL_CALL_END(RL_CALL_GET_WORKING_DIRECTORY);
+    return result;
+}
+
+static const char * rl_instrumented_get_application_directory(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_APPLICATION_DIRECTORY);
+    const char * result = raylib_instrumented_target->get_application_directory();
+    RL_CALL_END(RL_CALL_GET_APPLICATION_DIRECTORY);
+    return result;
+}
+
+static int rl_instrumented_make_directory(const char *dirPath) {
+    RL_CALL_BEGIN(RL_CALL_MAKE_DIRECTORY);
+    int result = raylib_instrumented_target->make_directory(dirPath);
+    RL_CALL_END(RL_CALL_MAKE_DIRECTORY);
+    return result;
+}
+
+static bool rl_instrumented_change_directory(const char *dir) {
+    RL_CALL_BEGIN(RL_CALL_CHANGE_DIRECTORY);
+    bool result = raylib_instrumented_target->change_directory(dir);
+    RL_CALL_END(RL_CALL_CHANGE_DIRECTORY);
+    return result;
+}
+
+static bool rl_instrumented_is_path_file(const char *path) {
+    RL_CALL_BEGIN(RL_CALL_IS_PATH_FILE);
+    bool result = raylib_instrumented_target->is_path_file(path);
+    RL_CALL_END(RL_CALL_IS_PATH_FILE);
+    return result;
+}
+
+static bool rl_instrumented_is_file_name_valid(const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_IS_FILE_NAME_VALID);
+    bool result = raylib_instrumented_target->is_file_name_valid(fileName);
+    RL_CALL_END(RL_CALL_IS_FILE_NAME_VALID);
+    return result;
+}
+
+static FilePathList rl_instrumented_load_directory_files(const char *dirPath) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_DIRECTORY_FILES);
+    FilePathList result = raylib_instrumented_target->load_directory_files(dirPath);
+    RL_CALL_END(RL_CALL_LOAD_DIRECTORY_FILES);
+    return result;
+}
+
+static FilePathList rl_instrumented_load_directory_files_ex(const char *basePath, const char *filter, bool scanSubdirs) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_DIRECTORY_FILES_EX);
+    FilePathList result = raylib_instrumented_target->load_directory_files_ex(basePath, filter, scanSubdirs);
+    RL_CALL_END(RL_CALL_LOAD_DIRECTORY_FILES_EX);
+    return result;
+}
+
+static void rl_instrumented_unload_directory_files(FilePathList files) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_DIRECTORY_FILES);
+    raylib_instrumented_target->unload_directory_files(files);
+    RL_CALL_END(RL_CALL_UNLOAD_DIRECTORY_FILES);
+}
+
+static bool rl_instrumented_is_file_dropped(void) {
+    RL_CALL_BEGIN(RL_CALL_IS_FILE_DROPPED);
+    bool result = raylib_instrumented_target->is_file_dropped();
+    RL_CALL_END(RL_CALL_IS_FILE_DROPPED);
+    return result;
+}
+
+static FilePathList rl_instrumented_load_dropped_files(void) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_DROPPED_FILES);
+    FilePathList result = raylib_instrumented_target->load_dropped_files();
+    RL_CALL_END(RL_CALL_LOAD_DROPPED_FILES);
+    return result;
+}
+
+static void rl_instrumented_unload_dropped_files(FilePathList files) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_DROPPED_FILES);
+    raylib_instrumented_target->unload_dropped_files(files);
+    RL_CALL_END(RL_CALL_UNLOAD_DROPPED_FILES);
+}
+
+static long rl_instrumented_get_file_mod_time(const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_GET_FILE_MOD_TIME);
+    long result = raylib_instrumented_target->get_file_mod_time(fileName);
+    RL_CALL_END(RL_CALL_GET_FILE_MOD_TIME);
+    return result;
+}
+
+static unsigned char * rl_instrumented_compress_data(const unsigned char *data, int dataSize, int *compDataSize) {
+    RL_CALL_BEGIN(RL_CALL_COMPRESS_DATA);
+    unsigned char * result = raylib_instrumented_target->compress_data(data, dataSize, compDataSize);
+    RL_CALL_END(RL_CALL_COMPRESS_DATA);
+    return result;
+}
+
+static unsigned char * rl_instrumented_decompress_data(const unsigned char *compData, int compDataSize, int *dataSize) {
+    RL_CALL_BEGIN(RL_CALL_DECOMPRESS_DATA);
+    unsigned char * result = raylib_instrumented_target->decompress_data(compData, compDataSize, dataSize);
+    RL_CALL_END(RL_CALL_DECOMPRESS_DATA);
+    return result;
+}
+
+static char * rl_instrumented_encode_data_base64(const unsigned char *data, int dataSize, int *outputSize) {
+    RL_CALL_BEGIN(RL_CALL_ENCODE_DATA_BASE64);
+    char * result = raylib_instrumented_target->encode_data_base64(data, dataSize, outputSize);
+    RL_CALL_END(RL_CALL_ENCODE_DATA_BASE64);
+    return result;
+}
+
+static unsigned char * rl_instrumented_decode_data_base64(const unsigned char *data, int *outputSize) {
+    RL_CALL_BEGIN(RL_CALL_DECODE_DATA_BASE64);
+    unsigned char * result = raylib_instrumented_target->decode_data_base64(data, outputSize);
+    RL_CALL_END(RL_CALL_DECODE_DATA_BASE64);
+    return result;
+}
+
+static unsigned int rl_instrumented_compute_crc32(unsigned char *data, int dataSize) {
+    RL_CALL_BEGIN(RL_CALL_COMPUTE_CRC32);
+    unsigned int result = raylib_instrumented_target->compute_crc32(data, dataSize);
+    RL_CALL_END(RL_CALL_COMPUTE_CRC32);
+    return result;
+}
+
+static unsigned int * rl_instrumented_compute_md5(unsigned char *data, int dataSize) {
+    RL_CALL_BEGIN(RL_CALL_COMPUTE_MD5);
+    unsigned int * result = raylib_instrumented_target->compute_md5(data, dataSize);
+    RL_CALL_END(RL_CALL_COMPUTE_MD5);
+    return result;
+}
+
+static unsigned int * rl_instrumented_compute_sha1(unsigned char *data, int dataSize) {
+    RL_CALL_BEGIN(RL_CALL_COMPUTE_SHA1);
+    unsigned int * result = raylib_instrumented_target->compute_sha1(data, dataSize);
+    RL_CALL_END(RL_CALL_COMPUTE_SHA1);
+    return result;
+}
+
+static AutomationEventList rl_instrumented_load_automation_event_list(const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_AUTOMATION_EVENT_LIST);
+    AutomationEventList result = raylib_instrumented_target->load_automation_event_list(fileName);
+    RL_CALL_END(RL_CALL_LOAD_AUTOMATION_EVENT_LIST);
+    return result;
+}
+
+static void rl_instrumented_unload_automation_event_list(AutomationEventList list) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_AUTOMATION_EVENT_LIST);
+    raylib_instrumented_target->unload_automation_event_list(list);
+    RL_CALL_END(RL_CALL_UNLOAD_AUTOMATION_EVENT_LIST);
+}
+
+static bool rl_instrumented_export_automation_event_list(AutomationEventList list, const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_EXPORT_AUTOMATION_EVENT_LIST);
+    bool result = raylib_instrumented_target->export_automation_event_list(list, fileName);
+    RL_CALL_END(RL_CALL_EXPORT_AUTOMATION_EVENT_LIST);
+    return result;
+}
+
+static void rl_instrumented_set_automation_event_list(AutomationEventList *list) {
+    RL_CALL_BEGIN(RL_CALL_SET_AUTOMATION_EVENT_LIST);
+    raylib_instrumented_target->set_automation_event_list(list);
+    RL_CALL_END(RL_CALL_SET_AUTOMATION_EVENT_LIST);
+}
+
+static void rl_instrumented_set_automation_event_base_frame(int frame) {
+    RL_CALL_BEGIN(RL_CALL_SET_AUTOMATION_EVENT_BASE_FRAME);
+    raylib_instrumented_target->set_automation_event_base_frame(frame);
+    RL_CALL_END(RL_CALL_SET_AUTOMATION_EVENT_BASE_FRAME);
+}
+
+static void rl_instrumented_start_automation_event_recording(void) {
+    RL_CALL_BEGIN(RL_CALL_START_AUTOMATION_EVENT_RECORDING);
+    raylib_instrumented_target->start_automation_event_recording();
+    RL_CALL_END(RL_CALL_START_AUTOMATION_EVENT_RECORDING);
+}
+
+static void rl_instrumented_stop_automation_event_recording(void) {
+    RL_CALL_BEGIN(RL_CALL_STOP_AUTOMATION_EVENT_RECORDING);
+    raylib_instrumented_target->stop_automation_event_recording();
+    RL_CALL_END(RL_CALL_STOP_AUTOMATION_EVENT_RECORDING);
+}
+
+static void rl_instrumented_play_automation_event(AutomationEvent event) {
+    RL_CALL_BEGIN(RL_CALL_PLAY_AUTOMATION_EVENT);
+    raylib_instrumented_target->play_automation_event(event);
+    RL_CALL_END(RL_CALL_PLAY_AUTOMATION_EVENT);
+}
+
+static bool rl_instrumented_is_key_pressed(int key) {
+    RL_CALL_BEGIN(RL_CALL_IS_KEY_PRESSED);
+    bool result = raylib_instrumented_target->is_key_pressed(key);
+    RL_CALL_END(RL_CALL_IS_KEY_PRESSED);
+    return result;
+}
+
+static bool rl_instrumented_is_key_pressed_repeat(int key) {
+    RL_CALL_BEGIN(RL_CALL_IS_KEY_PRESSED_REPEAT);
+    bool result = raylib_instrumented_target->is_key_pressed_repeat(key);
+    RL_CALL_END(RL_CALL_IS_KEY_PRESSED_REPEAT);
+    return result;
+}
+
+static bool rl_instrumented_is_key_down(int key) {
+    RL_CALL_BEGIN(RL_CALL_IS_KEY_DOWN);
+    bool result = raylib_instrumented_target->is_key_down(key);
+    RL_CALL_END(RL_CALL_IS_KEY_DOWN);
+    return result;
+}
+
+static bool rl_instrumented_is_key_released(int key) {
+    RL_CALL_BEGIN(RL_CALL_IS_KEY_RELEASED);
+    bool result = raylib_instrumented_target->is_key_released(key);
+    RL_CALL_END(RL_CALL_IS_KEY_RELEASED);
+    return result;
+}
+
+static bool rl_instrumented_is_key_up(int key) {
+    RL_CALL_BEGIN(RL_CALL_IS_KEY_UP);
+    bool result = raylib_instrumented_target->is_key_up(key);
+    RL_CALL_END(RL_CALL_IS_KEY_UP);
+    return result;
+}
+
+static int rl_instrumented_get_key_pressed(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_KEY_PRESSED);
+    int result = raylib_instrumented_target->get_key_pressed();
+    RL_CALL_END(RL_CALL_GET_KEY_PRESSED);
+    return result;
+}
+
+static int rl_instrumented_get_char_pressed(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_CHAR_PRESSED);
+    int result = raylib_instrumented_target->get_char_pressed();
+    RL_CALL_END(RL_CALL_GET_CHAR_PRESSED);
+    return result;
+}
+
+static void rl_instrumented_set_exit_key(int key) {
+    RL_CALL_BEGIN(RL_CALL_SET_EXIT_KEY);
+    raylib_instrumented_target->set_exit_key(key);
+    RL_CALL_END(RL_CALL_SET_EXIT_KEY);
+}
+
+static bool rl_instrumented_is_gamepad_available(int gamepad) {
+    RL_CALL_BEGIN(RL_CALL_IS_GAMEPAD_AVAILABLE);
+    bool result = raylib_instrumented_target->is_gamepad_available(gamepad);
+    RL_CALL_END(RL_CALL_IS_GAMEPAD_AVAILABLE);
+    return result;
+}
+
+static const char * rl_instrumented_get_gamepad_name(int gamepad) {
+    RL_CALL_BEGIN(RL_CALL_GET_GAMEPAD_NAME);
+    const char * result = raylib_instrumented_target->get_gamepad_name(gamepad);
+    RL_CALL_END(RL_CALL_GET_GAMEPAD_NAME);
+    return result;
+}
+
+static bool rl_instrumented_is_gamepad_button_pressed(int gamepad, int button) {
+    RL_CALL_BEGIN(RL_CALL_IS_GAMEPAD_BUTTON_PRESSED);
+    bool result = raylib_instrumented_target->is_gamepad_button_pressed(gamepad, button);
+    RL_CALL_END(RL_CALL_IS_GAMEPAD_BUTTON_PRESSED);
+    return result;
+}
+
+static bool rl_instrumented_is_gamepad_button_down(int gamepad, int button) {
+    RL_CALL_BEGIN(RL_CALL_IS_GAMEPAD_BUTTON_DOWN);
+    bool result = raylib_instrumented_target->is_gamepad_button_down(gamepad, button);
+    RL_CALL_END(RL_CALL_IS_GAMEPAD_BUTTON_DOWN);
+    return result;
+}
+
+static bool rl_instrumented_is_gamepad_button_released(int gamepad, int button) {
+    RL_CALL_BEGIN(RL_CALL_IS_GAMEPAD_BUTTON_RELEASED);
+    bool result = raylib_instrumented_target->is_gamepad_button_released(gamepad, button);
+    RL_CALL_END(RL_CALL_IS_GAMEPAD_BUTTON_RELEASED);
+    return result;
+}
+
+static bool rl_instrumented_is_gamepad_button_up(int gamepad, int button) {
+    RL_CALL_BEGIN(RL_CALL_IS_GAMEPAD_BUTTON_UP);
+    bool result = raylib_instrumented_target->is_gamepad_button_up(gamepad, button);
+    RL_CALL_END(RL_CALL_IS_GAMEPAD_BUTTON_UP);
+    return result;
+}
+
+static int rl_instrumented_get_gamepad_button_pressed(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_GAMEPAD_BUTTON_PRESSED);
+    int result = raylib_instrumented_target->get_gamepad_button_pressed();
+    RL_CALL_END(RL_CALL_GET_GAMEPAD_BUTTON_PRESSED);
+    return result;
+}
+
+static int rl_instrumented_get_gamepad_axis_count(int gamepad) {
+    RL_CALL_BEGIN(RL_CALL_GET_GAMEPAD_AXIS_COUNT);
+    int result = raylib_instrumented_target->get_gamepad_axis_count(gamepad);
+    RL_CALL_END(RL_CALL_GET_GAMEPAD_AXIS_COUNT);
+    return result;
+}
+
+static float rl_instrumented_get_gamepad_axis_movement(int gamepad, int axis) {
+    RL_CALL_BEGIN(RL_CALL_GET_GAMEPAD_AXIS_MOVEMENT);
+    float result = raylib_instrumented_target->get_gamepad_axis_movement(gamepad, axis);
+    RL_CALL_END(RL_CALL_GET_GAMEPAD_AXIS_MOVEMENT);
+    return result;
+}
+
+static int rl_instrumented_set_gamepad_mappings(const char *mappings) {
+    RL_CALL_BEGIN(RL_CALL_SET_GAMEPAD_MAPPINGS);
+    int result = raylib_instrumented_target->set_gamepad_mappings(mappings);
+    RL_CALL_END(RL_CALL_SET_GAMEPAD_MAPPINGS);
+    return result;
+}
+
+static void rl_instrumented_set_gamepad_vibration(int gamepad, float leftMotor, float rightMotor, float duration) {
+    RL_CALL_BEGIN(RL_CALL_SET_GAMEPAD_VIBRATION);
+    raylib_instrumented_target->set_gamepad_vibration(gamepad, leftMotor, rightMotor, duration);
+    RL_CALL_END(RL_CALL_SET_GAMEPAD_VIBRATION);
+}
+
+static bool rl_instrumented_is_mouse_button_pressed(int button) {
+    RL_CALL_BEGIN(RL_CALL_IS_MOUSE_BUTTON_PRESSED);
+    bool result = raylib_instrumented_target->is_mouse_button_pressed(button);
+    RL_CALL_END(RL_CALL_IS_MOUSE_BUTTON_PRESSED);
+    return result;
+}
+
+static bool rl_instrumented_is_mouse_button_down(int button) {
+    RL_CALL_BEGIN(RL_CALL_IS_MOUSE_BUTTON_DOWN);
+    bool result = raylib_instrumented_target->is_mouse_button_down(button);
+    RL_CALL_END(RL_CALL_IS_MOUSE_BUTTON_DOWN);
+    return result;
+}
+
+static bool rl_instrumented_is_mouse_button_released(int button) {
+    RL_CALL_BEGIN(RL_CALL_IS_MOUSE_BUTTON_RELEASED);
+    bool result = raylib_instrumented_target->is_mouse_button_released(button);
+    RL_CALL_END(RL_CALL_IS_MOUSE_BUTTON_RELEASED);
+    return result;
+}
+
+static bool rl_instrumented_is_mouse_button_up(int button) {
+    RL_CALL_BEGIN(RL_CALL_IS_MOUSE_BUTTON_UP);
+    bool result = raylib_instrumented_target->is_mouse_button_up(button);
+    RL_CALL_END(RL_CALL_IS_MOUSE_BUTTON_UP);
+    return result;
+}
+
+static int rl_instrumented_get_mouse_x(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_MOUSE_X);
+    int result = raylib_instrumented_target->get_mouse_x();
+    RL_CALL_END(RL_CALL_GET_MOUSE_X);
+    return result;
+}
+
+static int rl_instrumented_get_mouse_y(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_MOUSE_Y);
+    int result = raylib_instrumented_target->get_mouse_y();
+    RL_CALL_END(RL_CALL_GET_MOUSE_Y);
+    return result;
+}
+
+static Vector2 rl_instrumented_get_mouse_position(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_MOUSE_POSITION);
+    Vector2 result = raylib_instrumented_target->get_mouse_position();
+    RL_CALL_END(RL_CALL_GET_MOUSE_POSITION);
+    return result;
+}
+
+static Vector2 rl_instrumented_get_mouse_delta(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_MOUSE_DELTA);
+    Vector2 result = raylib_instrumented_target->get_mouse_delta();
+    RL_CALL_END(RL_CALL_GET_MOUSE_DELTA);
+    return result;
+}
+
+static void rl_instrumented_set_mouse_position(int x, int y) {
+    RL_CALL_BEGIN(RL_CALL_SET_MOUSE_POSITION);
+    raylib_instrumented_target->set_mouse_position(x, y);
+    RL_CALL_END(RL_CALL_SET_MOUSE_POSITION);
+}
+
+static void rl_instrumented_set_mouse_offset(int offsetX, int offsetY) {
+    RL_CALL_BEGIN(RL_CALL_SET_MOUSE_OFFSET);
+    raylib_instrumented_target->set_mouse_offset(offsetX, offsetY);
+    RL_CALL_END(RL_CALL_SET_MOUSE_OFFSET);
+}
+
+static void rl_instrumented_set_mouse_scale(float scaleX, float scaleY) {
+    RL_CALL_BEGIN(RL_CALL_SET_MOUSE_SCALE);
+    raylib_instrumented_target->set_mouse_scale(scaleX, scaleY);
+    RL_CALL_END(RL_CALL_SET_MOUSE_SCALE);
+}
+
+static float rl_instrumented_get_mouse_wheel_move(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_MOUSE_WHEEL_MOVE);
+    float result = raylib_instrumented_target->get_mouse_wheel_move();
+    RL_CALL_END(RL_CALL_GET_MOUSE_WHEEL_MOVE);
+    return result;
+}
+
+static Vector2 rl_instrumented_get_mouse_wheel_move_v(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_MOUSE_WHEEL_MOVE_V);
+    Vector2 result = raylib_instrumented_target->get_mouse_wheel_move_v();
+    RL_CALL_END(RL_CALL_GET_MOUSE_WHEEL_MOVE_V);
+    return result;
+}
+
+static void rl_instrumented_set_mouse_cursor(int cursor) {
+    RL_CALL_BEGIN(RL_CALL_SET_MOUSE_CURSOR);
+    raylib_instrumented_target->set_mouse_cursor(cursor);
+    RL_CALL_END(RL_CALL_SET_MOUSE_CURSOR);
+}
+
+static int rl_instrumented_get_touch_x(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_TOUCH_X);
+    int result = raylib_instrumented_target->get_touch_x();
+    RL_CALL_END(RL_CALL_GET_TOUCH_X);
+    return result;
+}
+
+static int rl_instrumented_get_touch_y(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_TOUCH_Y);
+    int result = raylib_instrumented_target->get_touch_y();
+    RL_CALL_END(RL_CALL_GET_TOUCH_Y);
+    return result;
+}
+
+static Vector2 rl_instrumented_get_touch_position(int index) {
+    RL_CALL_BEGIN(RL_CALL_GET_TOUCH_POSITION);
+    Vector2 result = raylib_instrumented_target->get_touch_position(index);
+    RL_CALL_END(RL_CALL_GET_TOUCH_POSITION);
+    return result;
+}
+
+static int rl_instrumented_get_touch_point_id(int index) {
+    RL_CALL_BEGIN(RL_CALL_GET_TOUCH_POINT_ID);
+    int result = raylib_instrumented_target->get_touch_point_id(index);
+    RL_CALL_END(RL_CALL_GET_TOUCH_POINT_ID);
+    return result;
+}
+
+static int rl_instrumented_get_touch_point_count(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_TOUCH_POINT_COUNT);
+    int result = raylib_instrumented_target->get_touch_point_count();
+    RL_CALL_END(RL_CALL_GET_TOUCH_POINT_COUNT);
+    return result;
+}
+
+static void rl_instrumented_set_gestures_enabled(unsigned int flags) {
+    RL_CALL_BEGIN(RL_CALL_SET_GESTURES_ENABLED);
+    raylib_instrumented_target->set_gestures_enabled(flags);
+    RL_CALL_END(RL_CALL_SET_GESTURES_ENABLED);
+}
+
+static bool rl_instrumented_is_gesture_detected(unsigned int gesture) {
+    RL_CALL_BEGIN(RL_CALL_IS_GESTURE_DETECTED);
+    bool result = raylib_instrumented_target->is_gesture_detected(gesture);
+    RL_CALL_END(RL_CALL_IS_GESTURE_DETECTED);
+    return result;
+}
+
+static int rl_instrumented_get_gesture_detected(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_GESTURE_DETECTED);
+    int result = raylib_instrumented_target->get_gesture_detected();
+    RL_CALL_END(RL_CALL_GET_GESTURE_DETECTED);
+    return result;
+}
+
+static float rl_instrumented_get_gesture_hold_duration(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_GESTURE_HOLD_DURATION);
+    float result = raylib_instrumented_target->get_gesture_hold_duration();
+    RL_CALL_END(RL_CALL_GET_GESTURE_HOLD_DURATION);
+    return result;
+}
+
+static Vector2 rl_instrumented_get_gesture_drag_vector(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_GESTURE_DRAG_VECTOR);
+    Vector2 result = raylib_instrumented_target->get_gesture_drag_vector();
+    RL_CALL_END(RL_CALL_GET_GESTURE_DRAG_VECTOR);
+    return result;
+}
+
+static float rl_instrumented_get_gesture_drag_angle(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_GESTURE_DRAG_ANGLE);
+    float result = raylib_instrumented_target->get_gesture_drag_angle();
+    RL_CALL_END(RL_CALL_GET_GESTURE_DRAG_ANGLE);
+    return result;
+}
+
+static Vector2 rl_instrumented_get_gesture_pinch_vector(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_GESTURE_PINCH_VECTOR);
+    Vector2 result = raylib_instrumented_target->get_gesture_pinch_vector();
+    RL_CALL_END(RL_CALL_GET_GESTURE_PINCH_VECTOR);
+    return result;
+}
+
+static float rl_instrumented_get_gesture_pinch_angle(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_GESTURE_PINCH_ANGLE);
+    float result = raylib_instrumented_target->get_gesture_pinch_angle();
+    RL_CALL_END(RL_CALL_GET_GESTURE_PINCH_ANGLE);
+    return result;
+}
+
+static void rl_instrumented_update_camera(Camera *camera, int mode) {
+    RL_CALL_BEGIN(RL_CALL_UPDATE_CAMERA);
+    raylib_instrumented_target->update_camera(camera, mode);
+    RL_CALL_END(RL_CALL_UPDATE_CAMERA);
+}
+
+static void rl_instrumented_update_camera_pro(Camera *camera, Vector3 movement, Vector3 rotation, float zoom) {
+    RL_CALL_BEGIN(RL_CALL_UPDATE_CAMERA_PRO);
+    raylib_instrumented_target->update_camera_pro(camera, movement, rotation, zoom);
+    RL_CALL_END(RL_CALL_UPDATE_CAMERA_PRO);
+}
+
+static void rl_instrumented_set_shapes_texture(Texture2D texture, Rectangle source) {
+    RL_CALL_BEGIN(RL_CALL_SET_SHAPES_TEXTURE);
+    raylib_instrumented_target->set_shapes_texture(texture, source);
+    RL_CALL_END(RL_CALL_SET_SHAPES_TEXTURE);
+}
+
+static Texture2D rl_instrumented_get_shapes_texture(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_SHAPES_TEXTURE);
+    Texture2D result = raylib_instrumented_target->get_shapes_texture();
+    RL_CALL_END(RL_CALL_GET_SHAPES_TEXTURE);
+    return result;
+}
+
+static Rectangle rl_instrumented_get_shapes_texture_rectangle(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_SHAPES_TEXTURE_RECTANGLE);
+    Rectangle result = raylib_instrumented_target->get_shapes_texture_rectangle();
+    RL_CALL_END(RL_CALL_GET_SHAPES_TEXTURE_RECTANGLE);
+    return result;
+}
+
+static void rl_instrumented_draw_pixel(int posX, int posY, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_PIXEL);
+    raylib_instrumented_target->draw_pixel(posX, posY, color);
+    RL_CALL_END(RL_CALL_DRAW_PIXEL);
+}
+
+static void rl_instrumented_draw_pixel_v(Vector2 position, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_PIXEL_V);
+    raylib_instrumented_target->draw_pixel_v(position, color);
+    RL_CALL_END(RL_CALL_DRAW_PIXEL_V);
+}
+
+static void rl_instrumented_draw_line(int startPosX, int startPosY, int endPosX, int endPosY, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_LINE);
+    raylib_instrumented_target->draw_line(startPosX, startPosY, endPosX, endPosY, color);
+    RL_CALL_END(RL_CALL_DRAW_LINE);
+}
+
+static void rl_instrumented_draw_line_v(Vector2 startPos, Vector2 endPos, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_LINE_V);
+    raylib_instrumented_target->draw_line_v(startPos, endPos, color);
+    RL_CALL_END(RL_CALL_DRAW_LINE_V);
+}
+
+static void rl_instrumented_draw_line_ex(Vector2 startPos, Vector2 endPos, float thick, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_LINE_EX);
+    raylib_instrumented_target->draw_line_ex(startPos, endPos, thick, color);
+    RL_CALL_END(RL_CALL_DRAW_LINE_EX);
+}
+
+static void rl_instrumented_draw_line_strip(const Vector2 *points, int pointCount, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_LINE_STRIP);
+    raylib_instrumented_target->draw_line_strip(points, pointCount, color);
+    RL_CALL_END(RL_CALL_DRAW_LINE_STRIP);
+}
+
+static void rl_instrumented_draw_line_bezier(Vector2 startPos, Vector2 endPos, float thick, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_LINE_BEZIER);
+    raylib_instrumented_target->draw_line_bezier(startPos, endPos, thick, color);
+    RL_CALL_END(RL_CALL_DRAW_LINE_BEZIER);
+}
+
+static void rl_instrumented_draw_circle(int centerX, int centerY, float radius, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_CIRCLE);
+    raylib_instrumented_target->draw_circle(centerX, centerY, radius, color);
+    RL_CALL_END(RL_CALL_DRAW_CIRCLE);
+}
+
+static void rl_instrumented_draw_circle_sector(Vector2 center, float radius, float startAngle, float endAngle, int segments, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_CIRCLE_SECTOR);
+    raylib_instrumented_target->draw_circle_sector(center, radius, startAngle, endAngle, segments, color);
+    RL_CALL_END(RL_CALL_DRAW_CIRCLE_SECTOR);
+}
+
+static void rl_instrumented_draw_circle_sector_lines(Vector2 center, float radius, float startAngle, float endAngle, int segments, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_CIRCLE_SECTOR_LINES);
+    raylib_instrumented_target->draw_circle_sector_lines(center, radius, startAngle, endAngle, segments, color);
+    RL_CALL_END(RL_CALL_DRAW_CIRCLE_SECTOR_LINES);
+}
+
+static void rl_instrumented_draw_circle_gradient(int centerX, int centerY, float radius, Color inner, Color outer) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_CIRCLE_GRADIENT);
+    raylib_instrumented_target->draw_circle_gradient(centerX, centerY, radius, inner, outer);
+    RL_CALL_END(RL_CALL_DRAW_CIRCLE_GRADIENT);
+}
+
+static void rl_instrumented_draw_circle_v(Vector2 center, float radius, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_CIRCLE_V);
+    raylib_instrumented_target->draw_circle_v(center, radius, color);
+    RL_CALL_END(RL_CALL_DRAW_CIRCLE_V);
+}
+
+static void rl_instrumented_draw_circle_lines(int centerX, int centerY, float radius, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_CIRCLE_LINES);
+    raylib_instrumented_target->draw_circle_lines(centerX, centerY, radius, color);
+    RL_CALL_END(RL_CALL_DRAW_CIRCLE_LINES);
+}
+
+static void rl_instrumented_draw_circle_lines_v(Vector2 center, float radius, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_CIRCLE_LINES_V);
+    raylib_instrumented_target->draw_circle_lines_v(center, radius, color);
+    RL_CALL_END(RL_CALL_DRAW_CIRCLE_LINES_V);
+}
+
+static void rl_instrumented_draw_ellipse(int centerX, int centerY, float radiusH, float radiusV, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_ELLIPSE);
+    raylib_instrumented_target->draw_ellipse(centerX, centerY, radiusH, radiusV, color);
+    RL_CALL_END(RL_CALL_DRAW_ELLIPSE);
+}
+
+static void rl_instrumented_draw_ellipse_lines(int centerX, int centerY, float radiusH, float radiusV, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_ELLIPSE_LINES);
+    raylib_instrumented_target->draw_ellipse_lines(centerX, centerY, radiusH, radiusV, color);
+    RL_CALL_END(RL_CALL_DRAW_ELLIPSE_LINES);
+}
+
+static void rl_instrumented_draw_ring(Vector2 center, float innerRadius, float outerRadius, float startAngle, float endAngle, int segments, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_RING);
+    raylib_instrumented_target->draw_ring(center, innerRadius, outerRadius, startAngle, endAngle, segments, color);
+    RL_CALL_END(RL_CALL_DRAW_RING);
+}
+
+static void rl_instrumented_draw_ring_lines(Vector2 center, float innerRadius, float outerRadius, float startAngle, float endAngle, int segments, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_RING_LINES);
+    raylib_instrumented_target->draw_ring_lines(center, innerRadius, outerRadius, startAngle, endAngle, segments, color);
+    RL_CALL_END(RL_CALL_DRAW_RING_LINES);
+}
+
+static void rl_instrumented_draw_rectangle(int posX, int posY, int width, int height, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_RECTANGLE);
+    raylib_instrumented_target->draw_rectangle(posX, posY, width, height, color);
+    RL_CALL_END(RL_CALL_DRAW_RECTANGLE);
+}
+
+static void rl_instrumented_draw_rectangle_v(Vector2 position, Vector2 size, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_RECTANGLE_V);
+    raylib_instrumented_target->draw_rectangle_v(position, size, color);
+    RL_CALL_END(RL_CALL_DRAW_RECTANGLE_V);
+}
+
+static void rl_instrumented_draw_rectangle_rec(Rectangle rec, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_RECTANGLE_REC);
+    raylib_instrumented_target->draw_rectangle_rec(rec, color);
+    RL_CALL_END(RL_CALL_DRAW_RECTANGLE_REC);
+}
+
+static void rl_instrumented_draw_rectangle_pro(Rectangle rec, Vector2 origin, float rotation, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_RECTANGLE_PRO);
+    raylib_instrumented_target->draw_rectangle_pro(rec, origin, rotation, color);
+    RL_CALL_END(RL_CALL_DRAW_RECTANGLE_PRO);
+}
+
+static void rl_instrumented_draw_rectangle_gradient_v(int posX, int posY, int width, int height, Color top, Color bottom) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_RECTANGLE_GRADIENT_V);
+    raylib_instrumented_target->draw_rectangle_gradient_v(posX, posY, width, height, top, bottom);
+    RL_CALL_END(RL_CALL_DRAW_RECTANGLE_GRADIENT_V);
+}
+
+static void rl_instrumented_draw_rectangle_gradient_h(int posX, int posY, int width, int height, Color left, Color right) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_RECTANGLE_GRADIENT_H);
+    raylib_instrumented_target->draw_rectangle_gradient_h(posX, posY, width, height, left, right);
+    RL_CALL_END(RL_CALL_DRAW_RECTANGLE_GRADIENT_H);
+}
+
+static void rl_instrumented_draw_rectangle_gradient_ex(Rectangle rec, Color topLeft, Color bottomLeft, Color topRight, Color bottomRight) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_RECTANGLE_GRADIENT_EX);
+    raylib_instrumented_target->draw_rectangle_gradient_ex(rec, topLeft, bottomLeft, topRight, bottomRight);
+    RL_CALL_END(RL_CALL_DRAW_RECTANGLE_GRADIENT_EX);
+}
+
+static void rl_instrumented_draw_rectangle_lines(int posX, int posY, int width, int height, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_RECTANGLE_LINES);
+    raylib_instrumented_target->draw_rectangle_lines(posX, posY, width, height, color);
+    RL_CALL_END(RL_CALL_DRAW_RECTANGLE_LINES);
+}
+
+static void rl_instrumented_draw_rectangle_lines_ex(Rectangle rec, float lineThick, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_RECTANGLE_LINES_EX);
+    raylib_instrumented_target->draw_rectangle_lines_ex(rec, lineThick, color);
+    RL_CALL_END(RL_CALL_DRAW_RECTANGLE_LINES_EX);
+}
+
+static void rl_instrumented_draw_rectangle_rounded(Rectangle rec, float roundness, int segments, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_RECTANGLE_ROUNDED);
+    raylib_instrumented_target->draw_rectangle_rounded(rec, roundness, segments, color);
+    RL_CALL_END(RL_CALL_DRAW_RECTANGLE_ROUNDED);
+}
+
+static void rl_instrumented_draw_rectangle_rounded_lines(Rectangle rec, float roundness, int segments, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_RECTANGLE_ROUNDED_LINES);
+    raylib_instrumented_target->draw_rectangle_rounded_lines(rec, roundness, segments, color);
+    RL_CALL_END(RL_CALL_DRAW_RECTANGLE_ROUNDED_LINES);
+}
+
+static void rl_instrumented_draw_rectangle_rounded_lines_ex(Rectangle rec, float roundness, int segments, float lineThick, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_RECTANGLE_ROUNDED_LINES_EX);
+    raylib_instrumented_target->draw_rectangle_rounded_lines_ex(rec, roundness, segments, lineThick, color);
+    RL_CALL_END(RL_CALL_DRAW_RECTANGLE_ROUNDED_LINES_EX);
+}
+
+static void rl_instrumented_draw_triangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_TRIANGLE);
+    raylib_instrumented_target->draw_triangle(v1, v2, v3, color);
+    RL_CALL_END(RL_CALL_DRAW_TRIANGLE);
+}
+
+static void rl_instrumented_draw_triangle_lines(Vector2 v1, Vector2 v2, Vector2 v3, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_TRIANGLE_LINES);
+    raylib_instrumented_target->draw_triangle_lines(v1, v2, v3, color);
+    RL_CALL_END(RL_CALL_DRAW_TRIANGLE_LINES);
+}
+
+static void rl_instrumented_draw_triangle_fan(const Vector2 *points, int pointCount, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_TRIANGLE_FAN);
+    raylib_instrumented_target->draw_triangle_fan(points, pointCount, color);
+    RL_CALL_END(RL_CALL_DRAW_TRIANGLE_FAN);
+}
+
+static void rl_instrumented_draw_triangle_strip(const Vector2 *points, int pointCount, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_TRIANGLE_STRIP);
+    raylib_instrumented_target->draw_triangle_strip(points, pointCount, color);
+    RL_CALL_END(RL_CALL_DRAW_TRIANGLE_STRIP);
+}
+
+static void rl_instrumented_draw_poly(Vector2 center, int sides, float radius, float rotation, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_POLY);
+    raylib_instrumented_target->draw_poly(center, sides, radius, rotation, color);
+    RL_CALL_END(RL_CALL_DRAW_POLY);
+}
+
+static void rl_instrumented_draw_poly_lines(Vector2 center, int sides, float radius, float rotation, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_POLY_LINES);
+    raylib_instrumented_target->draw_poly_lines(center, sides, radius, rotation, color);
+    RL_CALL_END(RL_CALL_DRAW_POLY_LINES);
+}
+
+static void rl_instrumented_draw_poly_lines_ex(Vector2 center, int sides, float radius, float rotation, float lineThick, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_POLY_LINES_EX);
+    raylib_instrumented_target->draw_poly_lines_ex(center, sides, radius, rotation, lineThick, color);
+    RL_CALL_END(RL_CALL_DRAW_POLY_LINES_EX);
+}
+
+static void rl_instrumented_draw_spline_linear(const Vector2 *points, int pointCount, float thick, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_SPLINE_LINEAR);
+    raylib_instrumented_target->draw_spline_linear(points, pointCount, thick, color);
+    RL_CALL_END(RL_CALL_DRAW_SPLINE_LINEAR);
+}
+
+static void rl_instrumented_draw_spline_basis(const Vector2 *points, int pointCount, float thick, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_SPLINE_BASIS);
+    raylib_instrumented_target->draw_spline_basis(points, pointCount, thick, color);
+    RL_CALL_END(RL_CALL_DRAW_SPLINE_BASIS);
+}
+
+static void rl_instrumented_draw_spline_catmull_rom(const Vector2 *points, int pointCount, float thick, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_SPLINE_CATMULL_ROM);
+    raylib_instrumented_target->draw_spline_catmull_rom(points, pointCount, thick, color);
+    RL_CALL_END(RL_CALL_DRAW_SPLINE_CATMULL_ROM);
+}
+
+static void rl_instrumented_draw_spline_bezier_quadratic(const Vector2 *points, int pointCount, float thick, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_SPLINE_BEZIER_QUADRATIC);
+    raylib_instrumented_target->draw_spline_bezier_quadratic(points, pointCount, thick, color);
+    RL_CALL_END(RL_CALL_DRAW_SPLINE_BEZIER_QUADRATIC);
+}
+
+static void rl_instrumented_draw_spline_bezier_cubic(const Vector2 *points, int pointCount, float thick, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_SPLINE_BEZIER_CUBIC);
+    raylib_instrumented_target->draw_spline_bezier_cubic(points, pointCount, thick, color);
+    RL_CALL_END(RL_CALL_DRAW_SPLINE_BEZIER_CUBIC);
+}
+
+static void rl_instrumented_draw_spline_segment_linear(Vector2 p1, Vector2 p2, float thick, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_SPLINE_SEGMENT_LINEAR);
+    raylib_instrumented_target->draw_spline_segment_linear(p1, p2, thick, color);
+    RL_CALL_END(RL_CALL_DRAW_SPLINE_SEGMENT_LINEAR);
+}
+
+static void rl_instrumented_draw_spline_segment_basis(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float thick, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_SPLINE_SEGMENT_BASIS);
+    raylib_instrumented_target->draw_spline_segment_basis(p1, p2, p3, p4, thick, color);
+    RL_CALL_END(RL_CALL_DRAW_SPLINE_SEGMENT_BASIS);
+}
+
+static void rl_instrumented_draw_spline_segment_catmull_rom(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float thick, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_SPLINE_SEGMENT_CATMULL_ROM);
+    raylib_instrumented_target->draw_spline_segment_catmull_rom(p1, p2, p3, p4, thick, color);
+    RL_CALL_END(RL_CALL_DRAW_SPLINE_SEGMENT_CATMULL_ROM);
+}
+
+static void rl_instrumented_draw_spline_segment_bezier_quadratic(Vector2 p1, Vector2 c2, Vector2 p3, float thick, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_SPLINE_SEGMENT_BEZIER_QUADRATIC);
+    raylib_instrumented_target->draw_spline_segment_bezier_quadratic(p1, c2, p3, thick, color);
+    RL_CALL_END(RL_CALL_DRAW_SPLINE_SEGMENT_BEZIER_QUADRATIC);
+}
+
+static void rl_instrumented_draw_spline_segment_bezier_cubic(Vector2 p1, Vector2 c2, Vector2 c3, Vector2 p4, float thick, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_SPLINE_SEGMENT_BEZIER_CUBIC);
+    raylib_instrumented_target->draw_spline_segment_bezier_cubic(p1, c2, c3, p4, thick, color);
+    RL_CALL_END(RL_CALL_DRAW_SPLINE_SEGMENT_BEZIER_CUBIC);
+}
+
+static Vector2 rl_instrumented_get_spline_point_linear(Vector2 startPos, Vector2 endPos, float t) {
+    RL_CALL_BEGIN(RL_CALL_GET_SPLINE_POINT_LINEAR);
+    Vector2 result = raylib_instrumented_target->get_spline_point_linear(startPos, endPos, t);
+    RL_CALL_END(RL_CALL_GET_SPLINE_POINT_LINEAR);
+    return result;
+}
+
+static Vector2 rl_instrumented_get_spline_point_basis(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float t) {
+    RL_CALL_BEGIN(RL_CALL_GET_SPLINE_POINT_BASIS);
+    Vector2 result = raylib_instrumented_target->get_spline_point_basis(p1, p2, p3, p4, t);
+    RL_CALL_END(RL_CALL_GET_SPLINE_POINT_BASIS);
+    return result;
+}
+
+static Vector2 rl_instrumented_get_spline_point_catmull_rom(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float t) {
+    RL_CALL_BEGIN(RL_CALL_GET_SPLINE_POINT_CATMULL_ROM);
+    Vector2 result = raylib_instrumented_target->get_spline_point_catmull_rom(p1, p2, p3, p4, t);
+    RL_CALL_END(RL_CALL_GET_SPLINE_POINT_CATMULL_ROM);
+    return result;
+}
+
+static Vector2 rl_instrumented_get_spline_point_bezier_quad(Vector2 p1, Vector2 c2, Vector2 p3, float t) {
+    RL_CALL_BEGIN(RL_CALL_GET_SPLINE_POINT_BEZIER_QUAD);
+    Vector2 result = raylib_instrumented_target->get_spline_point_bezier_quad(p1, c2, p3, t);
+    RL_CALL_END(RL_CALL_GET_SPLINE_POINT_BEZIER_QUAD);
+    return result;
+}
+
+static Vector2 rl_instrumented_get_spline_point_bezier_cubic(Vector2 p1, Vector2 c2, Vector2 c3, Vector2 p4, float t) {
+    RL_CALL_BEGIN(RL_CALL_GET_SPLINE_POINT_BEZIER_CUBIC);
+    Vector2 result = raylib_instrumented_target->get_spline_point_bezier_cubic(p1, c2, c3, p4, t);
+    RL_CALL_END(RL_CALL_GET_SPLINE_POINT_BEZIER_CUBIC);
+    return result;
+}
+
+static bool rl_instrumented_check_collision_recs(Rectangle rec1, Rectangle rec2) {
+    RL_CALL_BEGIN(RL_CALL_CHECK_COLLISION_RECS);
+    bool result = raylib_instrumented_target->check_collision_recs(rec1, rec2);
+    RL_CALL_END(RL_CALL_CHECK_COLLISION_RECS);
+    return result;
+}
+
+static bool rl_instrumented_check_collision_circles(Vector2 center1, float radius1, Vector2 center2, float radius2) {
+    RL_CALL_BEGIN(RL_CALL_CHECK_COLLISION_CIRCLES);
+    bool result = raylib_instrumented_target->check_collision_circles(center1, radius1, center2, radius2);
+    RL_CALL_END(RL_CALL_CHECK_COLLISION_CIRCLES);
+    return result;
+}
+
+static bool rl_instrumented_check_collision_circle_rec(Vector2 center, float radius, Rectangle rec) {
+    RL_CALL_BEGIN(RL_CALL_CHECK_COLLISION_CIRCLE_REC);
+    bool result = raylib_instrumented_target->check_collision_circle_rec(center, radius, rec);
+    RL_CALL_END(RL_CALL_CHECK_COLLISION_CIRCLE_REC);
+    return result;
+}
+
+static bool rl_instrumented_check_collision_circle_line(Vector2 center, float radius, Vector2 p1, Vector2 p2) {
+    RL_CALL_BEGIN(RL_CALL_CHECK_COLLISION_CIRCLE_LINE);
+    bool result = raylib_instrumented_target->check_collision_circle_line(center, radius, p1, p2);
+    RL_CALL_END(RL_CALL_CHECK_COLLISION_CIRCLE_LINE);
+    return result;
+}
+
+static bool rl_instrumented_check_collision_point_rec(Vector2 point, Rectangle rec) {
+    RL_CALL_BEGIN(RL_CALL_CHECK_COLLISION_POINT_REC);
+    bool result = raylib_instrumented_target->check_collision_point_rec(point, rec);
+    RL_CALL_END(RL_CALL_CHECK_COLLISION_POINT_REC);
+    return result;
+}
+
+static bool rl_instrumented_check_collision_point_circle(Vector2 point, Vector2 center, float radius) {
+    RL_CALL_BEGIN(RL_CALL_CHECK_COLLISION_POINT_CIRCLE);
+    bool result = raylib_instrumented_target->check_collision_point_circle(point, center, radius);
+    RL_CALL_END(RL_CALL_CHECK_COLLISION_POINT_CIRCLE);
+    return result;
+}
+
+static bool rl_instrumented_check_collision_point_triangle(Vector2 point, Vector2 p1, Vector2 p2, Vector2 p3) {
+    RL_CALL_BEGIN(RL_CALL_CHECK_COLLISION_POINT_TRIANGLE);
+    bool result = raylib_instrumented_target->check_collision_point_triangle(point, p1, p2, p3);
+    RL_CALL_END(RL_CALL_CHECK_COLLISION_POINT_TRIANGLE);
+    return result;
+}
+
+static bool rl_instrumented_check_collision_point_line(Vector2 point, Vector2 p1, Vector2 p2, int threshold) {
+    RL_CALL_BEGIN(RL_CALL_CHECK_COLLISION_POINT_LINE);
+    bool result = raylib_instrumented_target->check_collision_point_line(point, p1, p2, threshold);
+    RL_CALL_END(RL_CALL_CHECK_COLLISION_POINT_LINE);
+    return result;
+}
+
+static bool rl_instrumented_check_collision_point_poly(Vector2 point, const Vector2 *points, int pointCount) {
+    RL_CALL_BEGIN(RL_CALL_CHECK_COLLISION_POINT_POLY);
+    bool result = raylib_instrumented_target->check_collision_point_poly(point, points, pointCount);
+    RL_CALL_END(RL_CALL_CHECK_COLLISION_POINT_POLY);
+    return result;
+}
+
+static bool rl_instrumented_check_collision_lines(Vector2 startPos1, Vector2 endPos1, Vector2 startPos2, Vector2 endPos2, Vector2 *collisionPoint) {
+    RL_CALL_BEGIN(RL_CALL_CHECK_COLLISION_LINES);
+    bool result = raylib_instrumented_target->check_collision_lines(startPos1, endPos1, startPos2, endPos2, collisionPoint);
+    RL_CALL_END(RL_CALL_CHECK_COLLISION_LINES);
+    return result;
+}
+
+static Rectangle rl_instrumented_get_collision_rec(Rectangle rec1, Rectangle rec2) {
+    RL_CALL_BEGIN(RL_CALL_GET_COLLISION_REC);
+    Rectangle result = raylib_instrumented_target->get_collision_rec(rec1, rec2);
+    RL_CALL_END(RL_CALL_GET_COLLISION_REC);
+    return result;
+}
+
+static Image rl_instrumented_load_image(const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_IMAGE);
+    Image result = raylib_instrumented_target->load_image(fileName);
+    RL_CALL_END(RL_CALL_LOAD_IMAGE);
+    return result;
+}
+
+static Image rl_instrumented_load_image_raw(const char *fileName, int width, int height, int format, int headerSize) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_IMAGE_RAW);
+    Image result = raylib_instrumented_target->load_image_raw(fileName, width, height, format, headerSize);
+    RL_CALL_END(RL_CALL_LOAD_IMAGE_RAW);
+    return result;
+}
+
+static Image rl_instrumented_load_image_anim(const char *fileName, int *frames) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_IMAGE_ANIM);
+    Image result = raylib_instrumented_target->load_image_anim(fileName, frames);
+    RL_CALL_END(RL_CALL_LOAD_IMAGE_ANIM);
+    return result;
+}
+
+static Image rl_instrumented_load_image_anim_from_memory(const char *fileType, const unsigned char *fileData, int dataSize, int *frames) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_IMAGE_ANIM_FROM_MEMORY);
+    Image result = raylib_instrumented_target->load_image_anim_from_memory(fileType, fileData, dataSize, frames);
+    RL_CALL_END(RL_CALL_LOAD_IMAGE_ANIM_FROM_MEMORY);
+    return result;
+}
+
+static Image rl_instrumented_load_image_from_memory(const char *fileType, const unsigned char *fileData, int dataSize) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_IMAGE_FROM_MEMORY);
+    Image result = raylib_instrumented_target->load_image_from_memory(fileType, fileData, dataSize);
+    RL_CALL_END(RL_CALL_LOAD_IMAGE_FROM_MEMORY);
+    return result;
+}
+
+static Image rl_instrumented_load_image_from_texture(Texture2D texture) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_IMAGE_FROM_TEXTURE);
+    Image result = raylib_instrumented_target->load_image_from_texture(texture);
+    RL_CALL_END(RL_CALL_LOAD_IMAGE_FROM_TEXTURE);
+    return result;
+}
+
+static Image rl_instrumented_load_image_from_screen(void) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_IMAGE_FROM_SCREEN);
+    Image result = raylib_instrumented_target->load_image_from_screen();
+    RL_CALL_END(RL_CALL_LOAD_IMAGE_FROM_SCREEN);
+    return result;
+}
+
+static bool rl_instrumented_is_image_valid(Image image) {
+    RL_CALL_BEGIN(RL_CALL_IS_IMAGE_VALID);
+    bool result = raylib_instrumented_target->is_image_valid(image);
+    RL_CALL_END(RL_CALL_IS_IMAGE_VALID);
+    return result;
+}
+
+static void rl_instrumented_unload_image(Image image) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_IMAGE);
+    raylib_instrumented_target->unload_image(image);
+    RL_CALL_END(RL_CALL_UNLOAD_IMAGE);
+}
+
+static bool rl_instrumented_export_image(Image image, const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_EXPORT_IMAGE);
+    bool result = raylib_instrumented_target->export_image(image, fileName);
+    RL_CALL_END(RL_CALL_EXPORT_IMAGE);
+    return result;
+}
+
+static unsigned char * rl_instrumented_export_image_to_memory(Image image, const char *fileType, int *fileSize) {
+    RL_CALL_BEGIN(RL_CALL_EXPORT_IMAGE_TO_MEMORY);
+    unsigned char * result = raylib_instrumented_target->export_image_to_memory(image, fileType, fileSize);
+    RL_CALL_END(RL_CALL_EXPORT_IMAGE_TO_MEMORY);
+    return result;
+}
+
+static bool rl_instrumented_export_image_as_code(Image image, const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_EXPORT_IMAGE_AS_CODE);
+    bool result = raylib_instrumented_target->export_image_as_code(image, fileName);
+    RL_CALL_END(RL_CALL_EXPORT_IMAGE_AS_CODE);
+    return result;
+}
+
+static Image rl_instrumented_gen_image_color(int width, int height, Color color) {
+    RL_CALL_BEGIN(RL_CALL_GEN_IMAGE_COLOR);
+    Image result = raylib_instrumented_target->gen_image_color(width, height, color);
+    RL_CALL_END(RL_CALL_GEN_IMAGE_COLOR);
+    return result;
+}
+
+static Image rl_instrumented_gen_image_gradient_linear(int width, int height, int direction, Color start, Color end) {
+    RL_CALL_BEGIN(RL_CALL_GEN_IMAGE_GRADIENT_LINEAR);
+    Image result = raylib_instrumented_target->gen_image_gradient_linear(width, height, direction, start, end);
+    RL_CALL_END(RL_CALL_GEN_IMAGE_GRADIENT_LINEAR);
+    return result;
+}
+
+static Image rl_instrumented_gen_image_gradient_radial(int width, int height, float density, Color inner, Color outer) {
+    RL_CALL_BEGIN(RL_CALL_GEN_IMAGE_GRADIENT_RADIAL);
+    Image result = raylib_instrumented_target->gen_image_gradient_radial(width, height, density, inner, outer);
+    RL_CALL_END(RL_CALL_GEN_IMAGE_GRADIENT_RADIAL);
+    return result;
+}
+
+static Image rl_instrumented_gen_image_gradient_square(int width, int height, float density, Color inner, Color outer) {
+    RL_CALL_BEGIN(RL_CALL_GEN_IMAGE_GRADIENT_SQUARE);
+    Image result = raylib_instrumented_target->gen_image_gradient_square(width, height, density, inner, outer);
+    RL_CALL_END(RL_CALL_GEN_IMAGE_GRADIENT_SQUARE);
+    return result;
+}
+
+static Image rl_instrumented_gen_image_checked(int width, int height, int checksX, int checksY, Color col1, Color col2) {
+    RL_CALL_BEGIN(RL_CALL_GEN_IMAGE_CHECKED);
+    Image result = raylib_instrumented_target->gen_image_checked(width, height, checksX, checksY, col1, col2);
+    RL_CALL_END(RL_CALL_GEN_IMAGE_CHECKED);
+    return result;
+}
+
+static Image rl_instrumented_gen_image_white_noise(int width, int height, float factor) {
+    RL_CALL_BEGIN(RL_CALL_GEN_IMAGE_WHITE_NOISE);
+    Image result = raylib_instrumented_target->gen_image_white_noise(width, height, factor);
+    RL_CALL_END(RL_CALL_GEN_IMAGE_WHITE_NOISE);
+    return result;
+}
+
+static Image rl_instrumented_gen_image_perlin_noise(int width, int height, int offsetX, int offsetY, float scale) {
+    RL_CALL_BEGIN(RL_CALL_GEN_IMAGE_PERLIN_NOISE);
+    Image result = raylib_instrumented_target->gen_image_perlin_noise(width, height, offsetX, offsetY, scale);
+    RL_CALL_END(RL_CALL_GEN_IMAGE_PERLIN_NOISE);
+    return result;
+}
+
+static Image rl_instrumented_gen_image_cellular(int width, int height, int tileSize) {
+    RL_CALL_BEGIN(RL_CALL_GEN_IMAGE_CELLULAR);
+    Image result = raylib_instrumented_target->gen_image_cellular(width, height, tileSize);
+    RL_CALL_END(RL_CALL_GEN_IMAGE_CELLULAR);
+    return result;
+}
+
+static Image rl_instrumented_gen_image_text(int width, int height, const char *text) {
+    RL_CALL_BEGIN(RL_CALL_GEN_IMAGE_TEXT);
+    Image result = raylib_instrumented_target->gen_image_text(width, height, text);
+    RL_CALL_END(RL_CALL_GEN_IMAGE_TEXT);
+    return result;
+}
+
+static Image rl_instrumented_image_copy(Image image) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_COPY);
+    Image result = raylib_instrumented_target->image_copy(image);
+    RL_CALL_END(RL_CALL_IMAGE_COPY);
+    return result;
+}
+
+static Image rl_instrumented_image_from_image(Image image, Rectangle rec) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_FROM_IMAGE);
+    Image result = raylib_instrumented_target->image_from_image(image, rec);
+    RL_CALL_END(RL_CALL_IMAGE_FROM_IMAGE);
+    return result;
+}
+
+static Image rl_instrumented_image_from_channel(Image image, int selectedChannel) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_FROM_CHANNEL);
+    Image result = raylib_instrumented_target->image_from_channel(image, selectedChannel);
+    RL_CALL_END(RL_CALL_IMAGE_FROM_CHANNEL);
+    return result;
+}
+
+static Image rl_instrumented_image_text(const char *text, int fontSize, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_TEXT);
+    Image result = raylib_instrumented_target->image_text(text, fontSize, color);
+    RL_CALL_END(RL_CALL_IMAGE_TEXT);
+    return result;
+}
+
+static Image rl_instrumented_image_text_ex(Font font, const char *text, float fontSize, float spacing, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_TEXT_EX);
+    Image result = raylib_instrumented_target->image_text_ex(font, text, fontSize, spacing, tint);
+    RL_CALL_END(RL_CALL_IMAGE_TEXT_EX);
+    return result;
+}
+
+static void rl_instrumented_image_format(Image *image, int newFormat) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_FORMAT);
+    raylib_instrumented_target->image_format(image, newFormat);
+    RL_CALL_END(RL_CALL_IMAGE_FORMAT);
+}
+
+static void rl_instrumented_image_to_pot(Image *image, Color fill) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_TO_POT);
+    raylib_instrumented_target->image_to_pot(image, fill);
+    RL_CALL_END(RL_CALL_IMAGE_TO_POT);
+}
+
+static void rl_instrumented_image_crop(Image *image, Rectangle crop) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_CROP);
+    raylib_instrumented_target->image_crop(image, crop);
+    RL_CALL_END(RL_CALL_IMAGE_CROP);
+}
+
+static void rl_instrumented_image_alpha_crop(Image *image, float threshold) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_ALPHA_CROP);
+    raylib_instrumented_target->image_alpha_crop(image, threshold);
+    RL_CALL_END(RL_CALL_IMAGE_ALPHA_CROP);
+}
+
+static void rl_instrumented_image_alpha_clear(Image *image, Color color, float threshold) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_ALPHA_CLEAR);
+    raylib_instrumented_target->image_alpha_clear(image, color, threshold);
+    RL_CALL_END(RL_CALL_IMAGE_ALPHA_CLEAR);
+}
+
+static void rl_instrumented_image_alpha_mask(Image *image, Image alphaMask) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_ALPHA_MASK);
+    raylib_instrumented_target->image_alpha_mask(image, alphaMask);
+    RL_CALL_END(RL_CALL_IMAGE_ALPHA_MASK);
+}
+
+static void rl_instrumented_image_alpha_premultiply(Image *image) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_ALPHA_PREMULTIPLY);
+    raylib_instrumented_target->image_alpha_premultiply(image);
+    RL_CALL_END(RL_CALL_IMAGE_ALPHA_PREMULTIPLY);
+}
+
+static void rl_instrumented_image_blur_gaussian(Image *image, int blurSize) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_BLUR_GAUSSIAN);
+    raylib_instrumented_target->image_blur_gaussian(image, blurSize);
+    RL_CALL_END(RL_CALL_IMAGE_BLUR_GAUSSIAN);
+}
+
+static void rl_instrumented_image_kernel_convolution(Image *image, const float *kernel, int kernelSize) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_KERNEL_CONVOLUTION);
+    raylib_instrumented_target->image_kernel_convolution(image, kernel, kernelSize);
+    RL_CALL_END(RL_CALL_IMAGE_KERNEL_CONVOLUTION);
+}
+
+static void rl_instrumented_image_resize(Image *image, int newWidth, int newHeight) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_RESIZE);
+    raylib_instrumented_target->image_resize(image, newWidth, newHeight);
+    RL_CALL_END(RL_CALL_IMAGE_RESIZE);
+}
+
+static void rl_instrumented_image_resize_nn(Image *image, int newWidth, int newHeight) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_RESIZE_NN);
+    raylib_instrumented_target->image_resize_nn(image, newWidth, newHeight);
+    RL_CALL_END(RL_CALL_IMAGE_RESIZE_NN);
+}
+
+static void rl_instrumented_image_resize_canvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_RESIZE_CANVAS);
+    raylib_instrumented_target->image_resize_canvas(image, newWidth, newHeight, offsetX, offsetY, fill);
+    RL_CALL_END(RL_CALL_IMAGE_RESIZE_CANVAS);
+}
+
+static void rl_instrumented_image_mipmaps(Image *image) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_MIPMAPS);
+    raylib_instrumented_target->image_mipmaps(image);
+    RL_CALL_END(RL_CALL_IMAGE_MIPMAPS);
+}
+
+static void rl_instrumented_image_dither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DITHER);
+    raylib_instrumented_target->image_dither(image, rBpp, gBpp, bBpp, aBpp);
+    RL_CALL_END(RL_CALL_IMAGE_DITHER);
+}
+
+static void rl_instrumented_image_flip_vertical(Image *image) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_FLIP_VERTICAL);
+    raylib_instrumented_target->image_flip_vertical(image);
+    RL_CALL_END(RL_CALL_IMAGE_FLIP_VERTICAL);
+}
+
+static void rl_instrumented_image_flip_horizontal(Image *image) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_FLIP_HORIZONTAL);
+    raylib_instrumented_target->image_flip_horizontal(image);
+    RL_CALL_END(RL_CALL_IMAGE_FLIP_HORIZONTAL);
+}
+
+static void rl_instrumented_image_rotate(Image *image, int degrees) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_ROTATE);
+    raylib_instrumented_target->image_rotate(image, degrees);
+    RL_CALL_END(RL_CALL_IMAGE_ROTATE);
+}
+
+static void rl_instrumented_image_rotate_cw(Image *image) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_ROTATE_CW);
+    raylib_instrumented_target->image_rotate_cw(image);
+    RL_CALL_END(RL_CALL_IMAGE_ROTATE_CW);
+}
+
+static void rl_instrumented_image_rotate_ccw(Image *image) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_ROTATE_CCW);
+    raylib_instrumented_target->image_rotate_ccw(image);
+    RL_CALL_END(RL_CALL_IMAGE_ROTATE_CCW);
+}
+
+static void rl_instrumented_image_color_tint(Image *image, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_COLOR_TINT);
+    raylib_instrumented_target->image_color_tint(image, color);
+    RL_CALL_END(RL_CALL_IMAGE_COLOR_TINT);
+}
+
+static void rl_instrumented_image_color_invert(Image *image) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_COLOR_INVERT);
+    raylib_instrumented_target->image_color_invert(image);
+    RL_CALL_END(RL_CALL_IMAGE_COLOR_INVERT);
+}
+
+static void rl_instrumented_image_color_grayscale(Image *image) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_COLOR_GRAYSCALE);
+    raylib_instrumented_target->image_color_grayscale(image);
+    RL_CALL_END(RL_CALL_IMAGE_COLOR_GRAYSCALE);
+}
+
+static void rl_instrumented_image_color_contrast(Image *image, float contrast) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_COLOR_CONTRAST);
+    raylib_instrumented_target->image_color_contrast(image, contrast);
+    RL_CALL_END(RL_CALL_IMAGE_COLOR_CONTRAST);
+}
+
+static void rl_instrumented_image_color_brightness(Image *image, int brightness) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_COLOR_BRIGHTNESS);
+    raylib_instrumented_target->image_color_brightness(image, brightness);
+    RL_CALL_END(RL_CALL_IMAGE_COLOR_BRIGHTNESS);
+}
+
+static void rl_instrumented_image_color_replace(Image *image, Color color, Color replace) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_COLOR_REPLACE);
+    raylib_instrumented_target->image_color_replace(image, color, replace);
+    RL_CALL_END(RL_CALL_IMAGE_COLOR_REPLACE);
+}
+
+static Color * rl_instrumented_load_image_colors(Image image) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_IMAGE_COLORS);
+    Color * result = raylib_instrumented_target->load_image_colors(image);
+    RL_CALL_END(RL_CALL_LOAD_IMAGE_COLORS);
+    return result;
+}
+
+static Color * rl_instrumented_load_image_palette(Image image, int maxPaletteSize, int *colorCount) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_IMAGE_PALETTE);
+    Color * result = raylib_instrumented_target->load_image_palette(image, maxPaletteSize, colorCount);
+    RL_CALL_END(RL_CALL_LOAD_IMAGE_PALETTE);
+    return result;
+}
+
+static void rl_instrumented_unload_image_colors(Color *colors) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_IMAGE_COLORS);
+    raylib_instrumented_target->unload_image_colors(colors);
+    RL_CALL_END(RL_CALL_UNLOAD_IMAGE_COLORS);
+}
+
+static void rl_instrumented_unload_image_palette(Color *colors) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_IMAGE_PALETTE);
+    raylib_instrumented_target->unload_image_palette(colors);
+    RL_CALL_END(RL_CALL_UNLOAD_IMAGE_PALETTE);
+}
+
+static Rectangle rl_instrumented_get_image_alpha_border(Image image, float threshold) {
+    RL_CALL_BEGIN(RL_CALL_GET_IMAGE_ALPHA_BORDER);
+    Rectangle result = raylib_instrumented_target->get_image_alpha_border(image, threshold);
+    RL_CALL_END(RL_CALL_GET_IMAGE_ALPHA_BORDER);
+    return result;
+}
+
+static Color rl_instrumented_get_image_color(Image image, int x, int y) {
+    RL_CALL_BEGIN(RL_CALL_GET_IMAGE_COLOR);
+    Color result = raylib_instrumented_target->get_image_color(image, x, y);
+    RL_CALL_END(RL_CALL_GET_IMAGE_COLOR);
+    return result;
+}
+
+static void rl_instrumented_image_clear_background(Image *dst, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_CLEAR_BACKGROUND);
+    raylib_instrumented_target->image_clear_background(dst, color);
+    RL_CALL_END(RL_CALL_IMAGE_CLEAR_BACKGROUND);
+}
+
+static void rl_instrumented_image_draw_pixel(Image *dst, int posX, int posY, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW_PIXEL);
+    raylib_instrumented_target->image_draw_pixel(dst, posX, posY, color);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW_PIXEL);
+}
+
+static void rl_instrumented_image_draw_pixel_v(Image *dst, Vector2 position, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW_PIXEL_V);
+    raylib_instrumented_target->image_draw_pixel_v(dst, position, color);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW_PIXEL_V);
+}
+
+static void rl_instrumented_image_draw_line(Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW_LINE);
+    raylib_instrumented_target->image_draw_line(dst, startPosX, startPosY, endPosX, endPosY, color);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW_LINE);
+}
+
+static void rl_instrumented_image_draw_line_v(Image *dst, Vector2 start, Vector2 end, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW_LINE_V);
+    raylib_instrumented_target->image_draw_line_v(dst, start, end, color);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW_LINE_V);
+}
+
+static void rl_instrumented_image_draw_line_ex(Image *dst, Vector2 start, Vector2 end, int thick, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW_LINE_EX);
+    raylib_instrumented_target->image_draw_line_ex(dst, start, end, thick, color);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW_LINE_EX);
+}
+
+static void rl_instrumented_image_draw_circle(Image *dst, int centerX, int centerY, int radius, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW_CIRCLE);
+    raylib_instrumented_target->image_draw_circle(dst, centerX, centerY, radius, color);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW_CIRCLE);
+}
+
+static void rl_instrumented_image_draw_circle_v(Image *dst, Vector2 center, int radius, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW_CIRCLE_V);
+    raylib_instrumented_target->image_draw_circle_v(dst, center, radius, color);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW_CIRCLE_V);
+}
+
+static void rl_instrumented_image_draw_circle_lines(Image *dst, int centerX, int centerY, int radius, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW_CIRCLE_LINES);
+    raylib_instrumented_target->image_draw_circle_lines(dst, centerX, centerY, radius, color);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW_CIRCLE_LINES);
+}
+
+static void rl_instrumented_image_draw_circle_lines_v(Image *dst, Vector2 center, int radius, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW_CIRCLE_LINES_V);
+    raylib_instrumented_target->image_draw_circle_lines_v(dst, center, radius, color);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW_CIRCLE_LINES_V);
+}
+
+static void rl_instrumented_image_draw_rectangle(Image *dst, int posX, int posY, int width, int height, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW_RECTANGLE);
+    raylib_instrumented_target->image_draw_rectangle(dst, posX, posY, width, height, color);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW_RECTANGLE);
+}
+
+static void rl_instrumented_image_draw_rectangle_v(Image *dst, Vector2 position, Vector2 size, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW_RECTANGLE_V);
+    raylib_instrumented_target->image_draw_rectangle_v(dst, position, size, color);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW_RECTANGLE_V);
+}
+
+static void rl_instrumented_image_draw_rectangle_rec(Image *dst, Rectangle rec, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW_RECTANGLE_REC);
+    raylib_instrumented_target->image_draw_rectangle_rec(dst, rec, color);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW_RECTANGLE_REC);
+}
+
+static void rl_instrumented_image_draw_rectangle_lines(Image *dst, Rectangle rec, int thick, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW_RECTANGLE_LINES);
+    raylib_instrumented_target->image_draw_rectangle_lines(dst, rec, thick, color);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW_RECTANGLE_LINES);
+}
+
+static void rl_instrumented_image_draw_triangle(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW_TRIANGLE);
+    raylib_instrumented_target->image_draw_triangle(dst, v1, v2, v3, color);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW_TRIANGLE);
+}
+
+static void rl_instrumented_image_draw_triangle_ex(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color c1, Color c2, Color c3) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW_TRIANGLE_EX);
+    raylib_instrumented_target->image_draw_triangle_ex(dst, v1, v2, v3, c1, c2, c3);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW_TRIANGLE_EX);
+}
+
+static void rl_instrumented_image_draw_triangle_lines(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW_TRIANGLE_LINES);
+    raylib_instrumented_target->image_draw_triangle_lines(dst, v1, v2, v3, color);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW_TRIANGLE_LINES);
+}
+
+static void rl_instrumented_image_draw_triangle_fan(Image *dst, Vector2 *points, int pointCount, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW_TRIANGLE_FAN);
+    raylib_instrumented_target->image_draw_triangle_fan(dst, points, pointCount, color);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW_TRIANGLE_FAN);
+}
+
+static void rl_instrumented_image_draw_triangle_strip(Image *dst, Vector2 *points, int pointCount, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW_TRIANGLE_STRIP);
+    raylib_instrumented_target->image_draw_triangle_strip(dst, points, pointCount, color);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW_TRIANGLE_STRIP);
+}
+
+static void rl_instrumented_image_draw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW);
+    raylib_instrumented_target->image_draw(dst, src, srcRec, dstRec, tint);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW);
+}
+
+static void rl_instrumented_image_draw_text(Image *dst, const char *text, int posX, int posY, int fontSize, Color color) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW_TEXT);
+    raylib_instrumented_target->image_draw_text(dst, text, posX, posY, fontSize, color);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW_TEXT);
+}
+
+static void rl_instrumented_image_draw_text_ex(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_IMAGE_DRAW_TEXT_EX);
+    raylib_instrumented_target->image_draw_text_ex(dst, font, text, position, fontSize, spacing, tint);
+    RL_CALL_END(RL_CALL_IMAGE_DRAW_TEXT_EX);
+}
+
+static Texture2D rl_instrumented_load_texture(const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_TEXTURE);
+    Texture2D result = raylib_instrumented_target->load_texture(fileName);
+    RL_CALL_END(RL_CALL_LOAD_TEXTURE);
+    return result;
+}
+
+static Texture2D rl_instrumented_load_texture_from_image(Image image) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_TEXTURE_FROM_IMAGE);
+    Texture2D result = raylib_instrumented_target->load_texture_from_image(image);
+    RL_CALL_END(RL_CALL_LOAD_TEXTURE_FROM_IMAGE);
+    return result;
+}
+
+static TextureCubemap rl_instrumented_load_texture_cubemap(Image image, int layout) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_TEXTURE_CUBEMAP);
+    TextureCubemap result = raylib_instrumented_target->load_texture_cubemap(image, layout);
+    RL_CALL_END(RL_CALL_LOAD_TEXTURE_CUBEMAP);
+    return result;
+}
+
+static RenderTexture2D rl_instrumented_load_render_texture(int width, int height) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_RENDER_TEXTURE);
+    RenderTexture2D result = raylib_instrumented_target->load_render_texture(width, height);
+    RL_CALL_END(RL_CALL_LOAD_RENDER_TEXTURE);
+    return result;
+}
+
+static bool rl_instrumented_is_texture_valid(Texture2D texture) {
+    RL_CALL_BEGIN(RL_CALL_IS_TEXTURE_VALID);
+    bool result = raylib_instrumented_target->is_texture_valid(texture);
+    RL_CALL_END(RL_CALL_IS_TEXTURE_VALID);
+    return result;
+}
+
+static void rl_instrumented_unload_texture(Texture2D texture) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_TEXTURE);
+    raylib_instrumented_target->unload_texture(texture);
+    RL_CALL_END(RL_CALL_UNLOAD_TEXTURE);
+}
+
+static bool rl_instrumented_is_render_texture_valid(RenderTexture2D target) {
+    RL_CALL_BEGIN(RL_CALL_IS_RENDER_TEXTURE_VALID);
+    bool result = raylib_instrumented_target->is_render_texture_valid(target);
+    RL_CALL_END(RL_CALL_IS_RENDER_TEXTURE_VALID);
+    return result;
+}
+
+static void rl_instrumented_unload_render_texture(RenderTexture2D target) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_RENDER_TEXTURE);
+    raylib_instrumented_target->unload_render_texture(target);
+    RL_CALL_END(RL_CALL_UNLOAD_RENDER_TEXTURE);
+}
+
+static void rl_instrumented_update_texture(Texture2D texture, const void *pixels) {
+    RL_CALL_BEGIN(RL_CALL_UPDATE_TEXTURE);
+    raylib_instrumented_target->update_texture(texture, pixels);
+    RL_CALL_END(RL_CALL_UPDATE_TEXTURE);
+}
+
+static void rl_instrumented_update_texture_rec(Texture2D texture, Rectangle rec, const void *pixels) {
+    RL_CALL_BEGIN(RL_CALL_UPDATE_TEXTURE_REC);
+    raylib_instrumented_target->update_texture_rec(texture, rec, pixels);
+    RL_CALL_END(RL_CALL_UPDATE_TEXTURE_REC);
+}
+
+static void rl_instrumented_gen_texture_mipmaps(Texture2D *texture) {
+    RL_CALL_BEGIN(RL_CALL_GEN_TEXTURE_MIPMAPS);
+    raylib_instrumented_target->gen_texture_mipmaps(texture);
+    RL_CALL_END(RL_CALL_GEN_TEXTURE_MIPMAPS);
+}
+
+static void rl_instrumented_set_texture_filter(Texture2D texture, int filter) {
+    RL_CALL_BEGIN(RL_CALL_SET_TEXTURE_FILTER);
+    raylib_instrumented_target->set_texture_filter(texture, filter);
+    RL_CALL_END(RL_CALL_SET_TEXTURE_FILTER);
+}
+
+static void rl_instrumented_set_texture_wrap(Texture2D texture, int wrap) {
+    RL_CALL_BEGIN(RL_CALL_SET_TEXTURE_WRAP);
+    raylib_instrumented_target->set_texture_wrap(texture, wrap);
+    RL_CALL_END(RL_CALL_SET_TEXTURE_WRAP);
+}
+
+static void rl_instrumented_draw_texture(Texture2D texture, int posX, int posY, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_TEXTURE);
+    raylib_instrumented_target->draw_texture(texture, posX, posY, tint);
+    RL_CALL_END(RL_CALL_DRAW_TEXTURE);
+}
+
+static void rl_instrumented_draw_texture_v(Texture2D texture, Vector2 position, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_TEXTURE_V);
+    raylib_instrumented_target->draw_texture_v(texture, position, tint);
+    RL_CALL_END(RL_CALL_DRAW_TEXTURE_V);
+}
+
+static void rl_instrumented_draw_texture_ex(Texture2D texture, Vector2 position, float rotation, float scale, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_TEXTURE_EX);
+    raylib_instrumented_target->draw_texture_ex(texture, position, rotation, scale, tint);
+    RL_CALL_END(RL_CALL_DRAW_TEXTURE_EX);
+}
+
+static void rl_instrumented_draw_texture_rec(Texture2D texture, Rectangle source, Vector2 position, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_TEXTURE_REC);
+    raylib_instrumented_target->draw_texture_rec(texture, source, position, tint);
+    RL_CALL_END(RL_CALL_DRAW_TEXTURE_REC);
+}
+
+static void rl_instrumented_draw_texture_pro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_TEXTURE_PRO);
+    raylib_instrumented_target->draw_texture_pro(texture, source, dest, origin, rotation, tint);
+    RL_CALL_END(RL_CALL_DRAW_TEXTURE_PRO);
+}
+
+static void rl_instrumented_draw_texture_n_patch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_TEXTURE_N_PATCH);
+    raylib_instrumented_target->draw_texture_n_patch(texture, nPatchInfo, dest, origin, rotation, tint);
+    RL_CALL_END(RL_CALL_DRAW_TEXTURE_N_PATCH);
+}
+
+static bool rl_instrumented_color_is_equal(Color col1, Color col2) {
+    RL_CALL_BEGIN(RL_CALL_COLOR_IS_EQUAL);
+    bool result = raylib_instrumented_target->color_is_equal(col1, col2);
+    RL_CALL_END(RL_CALL_COLOR_IS_EQUAL);
+    return result;
+}
+
+static Color rl_instrumented_fade(Color color, float alpha) {
+    RL_CALL_BEGIN(RL_CALL_FADE);
+    Color result = raylib_instrumented_target->fade(color, alpha);
+    RL_CALL_END(RL_CALL_FADE);
+    return result;
+}
+
+static int rl_instrumented_color_to_int(Color color) {
+    RL_CALL_BEGIN(RL_CALL_COLOR_TO_INT);
+    int result = raylib_instrumented_target->color_to_int(color);
+    RL_CALL_END(RL_CALL_COLOR_TO_INT);
+    return result;
+}
+
+static Vector4 rl_instrumented_color_normalize(Color color) {
+    RL_CALL_BEGIN(RL_CALL_COLOR_NORMALIZE);
+    Vector4 result = raylib_instrumented_target->color_normalize(color);
+    RL_CALL_END(RL_CALL_COLOR_NORMALIZE);
+    return result;
+}
+
+static Color rl_instrumented_color_from_normalized(Vector4 normalized) {
+    RL_CALL_BEGIN(RL_CALL_COLOR_FROM_NORMALIZED);
+    Color result = raylib_instrumented_target->color_from_normalized(normalized);
+    RL_CALL_END(RL_CALL_COLOR_FROM_NORMALIZED);
+    return result;
+}
+
+static Vector3 rl_instrumented_color_to_hsv(Color color) {
+    RL_CALL_BEGIN(RL_CALL_COLOR_TO_HSV);
+    Vector3 result = raylib_instrumented_target->color_to_hsv(color);
+    RL_CALL_END(RL_CALL_COLOR_TO_HSV);
+    return result;
+}
+
+static Color rl_instrumented_color_from_hsv(float hue, float saturation, float value) {
+    RL_CALL_BEGIN(RL_CALL_COLOR_FROM_HSV);
+    Color result = raylib_instrumented_target->color_from_hsv(hue, saturation, value);
+    RL_CALL_END(RL_CALL_COLOR_FROM_HSV);
+    return result;
+}
+
+static Color rl_instrumented_color_tint(Color color, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_COLOR_TINT);
+    Color result = raylib_instrumented_target->color_tint(color, tint);
+    RL_CALL_END(RL_CALL_COLOR_TINT);
+    return result;
+}
+
+static Color rl_instrumented_color_brightness(Color color, float factor) {
+    RL_CALL_BEGIN(RL_CALL_COLOR_BRIGHTNESS);
+    Color result = raylib_instrumented_target->color_brightness(color, factor);
+    RL_CALL_END(RL_CALL_COLOR_BRIGHTNESS);
+    return result;
+}
+
+static Color rl_instrumented_color_contrast(Color color, float contrast) {
+    RL_CALL_BEGIN(RL_CALL_COLOR_CONTRAST);
+    Color result = raylib_instrumented_target->color_contrast(color, contrast);
+    RL_CALL_END(RL_CALL_COLOR_CONTRAST);
+    return result;
+}
+
+static Color rl_instrumented_color_alpha(Color color, float alpha) {
+    RL_CALL_BEGIN(RL_CALL_COLOR_ALPHA);
+    Color result = raylib_instrumented_target->color_alpha(color, alpha);
+    RL_CALL_END(RL_CALL_COLOR_ALPHA);
+    return result;
+}
+
+static Color rl_instrumented_color_alpha_blend(Color dst, Color src, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_COLOR_ALPHA_BLEND);
+    Color result = raylib_instrumented_target->color_alpha_blend(dst, src, tint);
+    RL_CALL_END(RL_CALL_COLOR_ALPHA_BLEND);
+    return result;
+}
+
+static Color rl_instrumented_color_lerp(Color color1, Color color2, float factor) {
+    RL_CALL_BEGIN(RL_CALL_COLOR_LERP);
+    Color result = raylib_instrumented_target->color_lerp(color1, color2, factor);
+    RL_CALL_END(RL_CALL_COLOR_LERP);
+    return result;
+}
+
+static Color rl_instrumented_get_color(unsigned int hexValue) {
+    RL_CALL_BEGIN(RL_CALL_GET_COLOR);
+    Color result = raylib_instrumented_target->get_color(hexValue);
+    RL_CALL_END(RL_CALL_GET_COLOR);
+    return result;
+}
+
+static Color rl_instrumented_get_pixel_color(void *srcPtr, int format) {
+    RL_CALL_BEGIN(RL_CALL_GET_PIXEL_COLOR);
+    Color result = raylib_instrumented_target->get_pixel_color(srcPtr, format);
+    RL_CALL_END(RL_CALL_GET_PIXEL_COLOR);
+    return result;
+}
+
+static void rl_instrumented_set_pixel_color(void *dstPtr, Color color, int format) {
+    RL_CALL_BEGIN(RL_CALL_SET_PIXEL_COLOR);
+    raylib_instrumented_target->set_pixel_color(dstPtr, color, format);
+    RL_CALL_END(RL_CALL_SET_PIXEL_COLOR);
+}
+
+static int rl_instrumented_get_pixel_data_size(int width, int height, int format) {
+    RL_CALL_BEGIN(RL_CALL_GET_PIXEL_DATA_SIZE);
+    int result = raylib_instrumented_target->get_pixel_data_size(width, height, format);
+    RL_CALL_END(RL_CALL_GET_PIXEL_DATA_SIZE);
+    return result;
+}
+
+static Font rl_instrumented_get_font_default(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_FONT_DEFAULT);
+    Font result = raylib_instrumented_target->get_font_default();
+    RL_CALL_END(RL_CALL_GET_FONT_DEFAULT);
+    return result;
+}
+
+static Font rl_instrumented_load_font(const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_FONT);
+    Font result = raylib_instrumented_target->load_font(fileName);
+    RL_CALL_END(RL_CALL_LOAD_FONT);
+    return result;
+}
+
+static Font rl_instrumented_load_font_ex(const char *fileName, int fontSize, int *codepoints, int codepointCount) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_FONT_EX);
+    Font result = raylib_instrumented_target->load_font_ex(fileName, fontSize, codepoints, codepointCount);
+    RL_CALL_END(RL_CALL_LOAD_FONT_EX);
+    return result;
+}
+
+static Font rl_instrumented_load_font_from_image(Image image, Color key, int firstChar) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_FONT_FROM_IMAGE);
+    Font result = raylib_instrumented_target->load_font_from_image(image, key, firstChar);
+    RL_CALL_END(RL_CALL_LOAD_FONT_FROM_IMAGE);
+    return result;
+}
+
+static Font rl_instrumented_load_font_from_memory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_FONT_FROM_MEMORY);
+    Font result = raylib_instrumented_target->load_font_from_memory(fileType, fileData, dataSize, fontSize, codepoints, codepointCount);
+    RL_CALL_END(RL_CALL_LOAD_FONT_FROM_MEMORY);
+    return result;
+}
+
+static bool rl_instrumented_is_font_valid(Font font) {
+    RL_CALL_BEGIN(RL_CALL_IS_FONT_VALID);
+    bool result = raylib_instrumented_target->is_font_valid(font);
+    RL_CALL_END(RL_CALL_IS_FONT_VALID);
+    return result;
+}
+
+static GlyphInfo * rl_instrumented_load_font_data(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_FONT_DATA);
+    GlyphInfo * result = raylib_instrumented_target->load_font_data(fileData, dataSize, fontSize, codepoints, codepointCount, type);
+    RL_CALL_END(RL_CALL_LOAD_FONT_DATA);
+    return result;
+}
+
+static Image rl_instrumented_gen_image_font_atlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod) {
+    RL_CALL_BEGIN(RL_CALL_GEN_IMAGE_FONT_ATLAS);
+    Image result = raylib_instrumented_target->gen_image_font_atlas(glyphs, glyphRecs, glyphCount, fontSize, padding, packMethod);
+    RL_CALL_END(RL_CALL_GEN_IMAGE_FONT_ATLAS);
+    return result;
+}
+
+static void rl_instrumented_unload_font_data(GlyphInfo *glyphs, int glyphCount) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_FONT_DATA);
+    raylib_instrumented_target->unload_font_data(glyphs, glyphCount);
+    RL_CALL_END(RL_CALL_UNLOAD_FONT_DATA);
+}
+
+static void rl_instrumented_unload_font(Font font) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_FONT);
+    raylib_instrumented_target->unload_font(font);
+    RL_CALL_END(RL_CALL_UNLOAD_FONT);
+}
+
+static bool rl_instrumented_export_font_as_code(Font font, const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_EXPORT_FONT_AS_CODE);
+    bool result = raylib_instrumented_target->export_font_as_code(font, fileName);
+    RL_CALL_END(RL_CALL_EXPORT_FONT_AS_CODE);
+    return result;
+}
+
+static void rl_instrumented_draw_fps(int posX, int posY) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_FPS);
+    raylib_instrumented_target->draw_fps(posX, posY);
+    RL_CALL_END(RL_CALL_DRAW_FPS);
+}
+
+static void rl_instrumented_draw_text(const char *text, int posX, int posY, int fontSize, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_TEXT);
+    raylib_instrumented_target->draw_text(text, posX, posY, fontSize, color);
+    RL_CALL_END(RL_CALL_DRAW_TEXT);
+}
+
+static void rl_instrumented_draw_text_ex(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_TEXT_EX);
+    raylib_instrumented_target->draw_text_ex(font, text, position, fontSize, spacing, tint);
+    RL_CALL_END(RL_CALL_DRAW_TEXT_EX);
+}
+
+static void rl_instrumented_draw_text_pro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_TEXT_PRO);
+    raylib_instrumented_target->draw_text_pro(font, text, position, origin, rotation, fontSize, spacing, tint);
+    RL_CALL_END(RL_CALL_DRAW_TEXT_PRO);
+}
+
+static void rl_instrumented_draw_text_codepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_TEXT_CODEPOINT);
+    raylib_instrumented_target->draw_text_codepoint(font, codepoint, position, fontSize, tint);
+    RL_CALL_END(RL_CALL_DRAW_TEXT_CODEPOINT);
+}
+
+static void rl_instrumented_draw_text_codepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_TEXT_CODEPOINTS);
+    raylib_instrumented_target->draw_text_codepoints(font, codepoints, codepointCount, position, fontSize, spacing, tint);
+    RL_CALL_END(RL_CALL_DRAW_TEXT_CODEPOINTS);
+}
+
+static void rl_instrumented_set_text_line_spacing(int spacing) {
+    RL_CALL_BEGIN(RL_CALL_SET_TEXT_LINE_SPACING);
+    raylib_instrumented_target->set_text_line_spacing(spacing);
+    RL_CALL_END(RL_CALL_SET_TEXT_LINE_SPACING);
+}
+
+static int rl_instrumented_measure_text(const char *text, int fontSize) {
+    RL_CALL_BEGIN(RL_CALL_MEASURE_TEXT);
+    int result = raylib_instrumented_target->measure_text(text, fontSize);
+    RL_CALL_END(RL_CALL_MEASURE_TEXT);
+    return result;
+}
+
+static Vector2 rl_instrumented_measure_text_ex(Font font, const char *text, float fontSize, float spacing) {
+    RL_CALL_BEGIN(RL_CALL_MEASURE_TEXT_EX);
+    Vector2 result = raylib_instrumented_target->measure_text_ex(font, text, fontSize, spacing);
+    RL_CALL_END(RL_CALL_MEASURE_TEXT_EX);
+    return result;
+}
+
+static int rl_instrumented_get_glyph_index(Font font, int codepoint) {
+    RL_CALL_BEGIN(RL_CALL_GET_GLYPH_INDEX);
+    int result = raylib_instrumented_target->get_glyph_index(font, codepoint);
+    RL_CALL_END(RL_CALL_GET_GLYPH_INDEX);
+    return result;
+}
+
+static GlyphInfo rl_instrumented_get_glyph_info(Font font, int codepoint) {
+    RL_CALL_BEGIN(RL_CALL_GET_GLYPH_INFO);
+    GlyphInfo result = raylib_instrumented_target->get_glyph_info(font, codepoint);
+    RL_CALL_END(RL_CALL_GET_GLYPH_INFO);
+    return result;
+}
+
+static Rectangle rl_instrumented_get_glyph_atlas_rec(Font font, int codepoint) {
+    RL_CALL_BEGIN(RL_CALL_GET_GLYPH_ATLAS_REC);
+    Rectangle result = raylib_instrumented_target->get_glyph_atlas_rec(font, codepoint);
+    RL_CALL_END(RL_CALL_GET_GLYPH_ATLAS_REC);
+    return result;
+}
+
+static char * rl_instrumented_load_utf8(const int *codepoints, int length) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_UTF8);
+    char * result = raylib_instrumented_target->load_utf8(codepoints, length);
+    RL_CALL_END(RL_CALL_LOAD_UTF8);
+    return result;
+}
+
+static void rl_instrumented_unload_utf8(char *text) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_UTF8);
+    raylib_instrumented_target->unload_utf8(text);
+    RL_CALL_END(RL_CALL_UNLOAD_UTF8);
+}
+
+static int * rl_instrumented_load_codepoints(const char *text, int *count) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_CODEPOINTS);
+    int * result = raylib_instrumented_target->load_codepoints(text, count);
+    RL_CALL_END(RL_CALL_LOAD_CODEPOINTS);
+    return result;
+}
+
+static void rl_instrumented_unload_codepoints(int *codepoints) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_CODEPOINTS);
+    raylib_instrumented_target->unload_codepoints(codepoints);
+    RL_CALL_END(RL_CALL_UNLOAD_CODEPOINTS);
+}
+
+static int rl_instrumented_get_codepoint_count(const char *text) {
+    RL_CALL_BEGIN(RL_CALL_GET_CODEPOINT_COUNT);
+    int result = raylib_instrumented_target->get_codepoint_count(text);
+    RL_CALL_END(RL_CALL_GET_CODEPOINT_COUNT);
+    return result;
+}
+
+static int rl_instrumented_get_codepoint(const char *text, int *codepointSize) {
+    RL_CALL_BEGIN(RL_CALL_GET_CODEPOINT);
+    int result = raylib_instrumented_target->get_codepoint(text, codepointSize);
+    RL_CALL_END(RL_CALL_GET_CODEPOINT);
+    return result;
+}
+
+static int rl_instrumented_get_codepoint_next(const char *text, int *codepointSize) {
+    RL_CALL_BEGIN(RL_CALL_GET_CODEPOINT_NEXT);
+    int result = raylib_instrumented_target->get_codepoint_next(text, codepointSize);
+    RL_CALL_END(RL_CALL_GET_CODEPOINT_NEXT);
+    return result;
+}
+
+static int rl_instrumented_get_codepoint_previous(const char *text, int *codepointSize) {
+    RL_CALL_BEGIN(RL_CALL_GET_CODEPOINT_PREVIOUS);
+    int result = raylib_instrumented_target->get_codepoint_previous(text, codepointSize);
+    RL_CALL_END(RL_CALL_GET_CODEPOINT_PREVIOUS);
+    return result;
+}
+
+static const char * rl_instrumented_codepoint_to_utf8(int codepoint, int *utf8Size) {
+    RL_CALL_BEGIN(RL_CALL_CODEPOINT_TO_UTF8);
+    const char * result = raylib_instrumented_target->codepoint_to_utf8(codepoint, utf8Size);
+    RL_CALL_END(RL_CALL_CODEPOINT_TO_UTF8);
+    return result;
+}
+
+static int rl_instrumented_text_copy(char *dst, const char *src) {
+    RL_CALL_BEGIN(RL_CALL_TEXT_COPY);
+    int result = raylib_instrumented_target->text_copy(dst, src);
+    RL_CALL_END(RL_CALL_TEXT_COPY);
+    return result;
+}
+
+static bool rl_instrumented_text_is_equal(const char *text1, const char *text2) {
+    RL_CALL_BEGIN(RL_CALL_TEXT_IS_EQUAL);
+    bool result = raylib_instrumented_target->text_is_equal(text1, text2);
+    RL_CALL_END(RL_CALL_TEXT_IS_EQUAL);
+    return result;
+}
+
+static unsigned int rl_instrumented_text_length(const char *text) {
+    RL_CALL_BEGIN(RL_CALL_TEXT_LENGTH);
+    unsigned int result = raylib_instrumented_target->text_length(text);
+    RL_CALL_END(RL_CALL_TEXT_LENGTH);
+    return result;
+}
+
+static const char * rl_instrumented_text_subtext(const char *text, int position, int length) {
+    RL_CALL_BEGIN(RL_CALL_TEXT_SUBTEXT);
+    const char * result = raylib_instrumented_target->text_subtext(text, position, length);
+    RL_CALL_END(RL_CALL_TEXT_SUBTEXT);
+    return result;
+}
+
+static char * rl_instrumented_text_replace(const char *text, const char *replace, const char *by) {
+    RL_CALL_BEGIN(RL_CALL_TEXT_REPLACE);
+    char * result = raylib_instrumented_target->text_replace(text, replace, by);
+    RL_CALL_END(RL_CALL_TEXT_REPLACE);
+    return result;
+}
+
+static char * rl_instrumented_text_insert(const char *text, const char *insert, int position) {
+    RL_CALL_BEGIN(RL_CALL_TEXT_INSERT);
+    char * result = raylib_instrumented_target->text_insert(text, insert, position);
+    RL_CALL_END(RL_CALL_TEXT_INSERT);
+    return result;
+}
+
+static const char * rl_instrumented_text_join(const char **textList, int count, const char *delimiter) {
+    RL_CALL_BEGIN(RL_CALL_TEXT_JOIN);
+    const char * result = raylib_instrumented_target->text_join(textList, count, delimiter);
+    RL_CALL_END(RL_CALL_TEXT_JOIN);
+    return result;
+}
+
+static const char ** rl_instrumented_text_split(const char *text, char delimiter, int *count) {
+    RL_CALL_BEGIN(RL_CALL_TEXT_SPLIT);
+    const char ** result = raylib_instrumented_target->text_split(text, delimiter, count);
+    RL_CALL_END(RL_CALL_TEXT_SPLIT);
+    return result;
+}
+
+static void rl_instrumented_text_append(char *text, const char *append, int *position) {
+    RL_CALL_BEGIN(RL_CALL_TEXT_APPEND);
+    raylib_instrumented_target->text_append(text, append, position);
+    RL_CALL_END(RL_CALL_TEXT_APPEND);
+}
+
+static int rl_instrumented_text_find_index(const char *text, const char *find) {
+    RL_CALL_BEGIN(RL_CALL_TEXT_FIND_INDEX);
+    int result = raylib_instrumented_target->text_find_index(text, find);
+    RL_CALL_END(RL_CALL_TEXT_FIND_INDEX);
+    return result;
+}
+
+static const char * rl_instrumented_text_to_upper(const char *text) {
+    RL_CALL_BEGIN(RL_CALL_TEXT_TO_UPPER);
+    const char * result = raylib_instrumented_target->text_to_upper(text);
+    RL_CALL_END(RL_CALL_TEXT_TO_UPPER);
+    return result;
+}
+
+static const char * rl_instrumented_text_to_lower(const char *text) {
+    RL_CALL_BEGIN(RL_CALL_TEXT_TO_LOWER);
+    const char * result = raylib_instrumented_target->text_to_lower(text);
+    RL_CALL_END(RL_CALL_TEXT_TO_LOWER);
+    return result;
+}
+
+static const char * rl_instrumented_text_to_pascal(const char *text) {
+    RL_CALL_BEGIN(RL_CALL_TEXT_TO_PASCAL);
+    const char * result = raylib_instrumented_target->text_to_pascal(text);
+    RL_CALL_END(RL_CALL_TEXT_TO_PASCAL);
+    return result;
+}
+
+static const char * rl_instrumented_text_to_snake(const char *text) {
+    RL_CALL_BEGIN(RL_CALL_TEXT_TO_SNAKE);
+    const char * result = raylib_instrumented_target->text_to_snake(text);
+    RL_CALL_END(RL_CALL_TEXT_TO_SNAKE);
+    return result;
+}
+
+static const char * rl_instrumented_text_to_camel(const char *text) {
+    RL_CALL_BEGIN(RL_CALL_TEXT_TO_CAMEL);
+    const char * result = raylib_instrumented_target->text_to_camel(text);
+    RL_CALL_END(RL_CALL_TEXT_TO_CAMEL);
+    return result;
+}
+
+static int rl_instrumented_text_to_integer(const char *text) {
+    RL_CALL_BEGIN(RL_CALL_TEXT_TO_INTEGER);
+    int result = raylib_instrumented_target->text_to_integer(text);
+    RL_CALL_END(RL_CALL_TEXT_TO_INTEGER);
+    return result;
+}
+
+static float rl_instrumented_text_to_float(const char *text) {
+    RL_CALL_BEGIN(RL_CALL_TEXT_TO_FLOAT);
+    float result = raylib_instrumented_target->text_to_float(text);
+    RL_CALL_END(RL_CALL_TEXT_TO_FLOAT);
+    return result;
+}
+
+static void rl_instrumented_draw_line3_d(Vector3 startPos, Vector3 endPos, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_LINE3_D);
+    raylib_instrumented_target->draw_line3_d(startPos, endPos, color);
+    RL_CALL_END(RL_CALL_DRAW_LINE3_D);
+}
+
+static void rl_instrumented_draw_point3_d(Vector3 position, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_POINT3_D);
+    raylib_instrumented_target->draw_point3_d(position, color);
+    RL_CALL_END(RL_CALL_DRAW_POINT3_D);
+}
+
+static void rl_instrumented_draw_circle3_d(Vector3 center, float radius, Vector3 rotationAxis, float rotationAngle, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_CIRCLE3_D);
+    raylib_instrumented_target->draw_circle3_d(center, radius, rotationAxis, rotationAngle, color);
+    RL_CALL_END(RL_CALL_DRAW_CIRCLE3_D);
+}
+
+static void rl_instrumented_draw_triangle3_d(Vector3 v1, Vector3 v2, Vector3 v3, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_TRIANGLE3_D);
+    raylib_instrumented_target->draw_triangle3_d(v1, v2, v3, color);
+    RL_CALL_END(RL_CALL_DRAW_TRIANGLE3_D);
+}
+
+static void rl_instrumented_draw_triangle_strip3_d(const Vector3 *points, int pointCount, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_TRIANGLE_STRIP3_D);
+    raylib_instrumented_target->draw_triangle_strip3_d(points, pointCount, color);
+    RL_CALL_END(RL_CALL_DRAW_TRIANGLE_STRIP3_D);
+}
+
+static void rl_instrumented_draw_cube(Vector3 position, float width, float height, float length, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_CUBE);
+    raylib_instrumented_target->draw_cube(position, width, height, length, color);
+    RL_CALL_END(RL_CALL_DRAW_CUBE);
+}
+
+static void rl_instrumented_draw_cube_v(Vector3 position, Vector3 size, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_CUBE_V);
+    raylib_instrumented_target->draw_cube_v(position, size, color);
+    RL_CALL_END(RL_CALL_DRAW_CUBE_V);
+}
+
+static void rl_instrumented_draw_cube_wires(Vector3 position, float width, float height, float length, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_CUBE_WIRES);
+    raylib_instrumented_target->draw_cube_wires(position, width, height, length, color);
+    RL_CALL_END(RL_CALL_DRAW_CUBE_WIRES);
+}
+
+static void rl_instrumented_draw_cube_wires_v(Vector3 position, Vector3 size, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_CUBE_WIRES_V);
+    raylib_instrumented_target->draw_cube_wires_v(position, size, color);
+    RL_CALL_END(RL_CALL_DRAW_CUBE_WIRES_V);
+}
+
+static void rl_instrumented_draw_sphere(Vector3 centerPos, float radius, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_SPHERE);
+    raylib_instrumented_target->draw_sphere(centerPos, radius, color);
+    RL_CALL_END(RL_CALL_DRAW_SPHERE);
+}
+
+static void rl_instrumented_draw_sphere_ex(Vector3 centerPos, float radius, int rings, int slices, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_SPHERE_EX);
+    raylib_instrumented_target->draw_sphere_ex(centerPos, radius, rings, slices, color);
+    RL_CALL_END(RL_CALL_DRAW_SPHERE_EX);
+}
+
+static void rl_instrumented_draw_sphere_wires(Vector3 centerPos, float radius, int rings, int slices, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_SPHERE_WIRES);
+    raylib_instrumented_target->draw_sphere_wires(centerPos, radius, rings, slices, color);
+    RL_CALL_END(RL_CALL_DRAW_SPHERE_WIRES);
+}
+
+static void rl_instrumented_draw_cylinder(Vector3 position, float radiusTop, float radiusBottom, float height, int slices, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_CYLINDER);
+    raylib_instrumented_target->draw_cylinder(position, radiusTop, radiusBottom, height, slices, color);
+    RL_CALL_END(RL_CALL_DRAW_CYLINDER);
+}
+
+static void rl_instrumented_draw_cylinder_ex(Vector3 startPos, Vector3 endPos, float startRadius, float endRadius, int sides, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_CYLINDER_EX);
+    raylib_instrumented_target->draw_cylinder_ex(startPos, endPos, startRadius, endRadius, sides, color);
+    RL_CALL_END(RL_CALL_DRAW_CYLINDER_EX);
+}
+
+static void rl_instrumented_draw_cylinder_wires(Vector3 position, float radiusTop, float radiusBottom, float height, int slices, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_CYLINDER_WIRES);
+    raylib_instrumented_target->draw_cylinder_wires(position, radiusTop, radiusBottom, height, slices, color);
+    RL_CALL_END(RL_CALL_DRAW_CYLINDER_WIRES);
+}
+
+static void rl_instrumented_draw_cylinder_wires_ex(Vector3 startPos, Vector3 endPos, float startRadius, float endRadius, int sides, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_CYLINDER_WIRES_EX);
+    raylib_instrumented_target->draw_cylinder_wires_ex(startPos, endPos, startRadius, endRadius, sides, color);
+    RL_CALL_END(RL_CALL_DRAW_CYLINDER_WIRES_EX);
+}
+
+static void rl_instrumented_draw_capsule(Vector3 startPos, Vector3 endPos, float radius, int slices, int rings, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_CAPSULE);
+    raylib_instrumented_target->draw_capsule(startPos, endPos, radius, slices, rings, color);
+    RL_CALL_END(RL_CALL_DRAW_CAPSULE);
+}
+
+static void rl_instrumented_draw_capsule_wires(Vector3 startPos, Vector3 endPos, float radius, int slices, int rings, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_CAPSULE_WIRES);
+    raylib_instrumented_target->draw_capsule_wires(startPos, endPos, radius, slices, rings, color);
+    RL_CALL_END(RL_CALL_DRAW_CAPSULE_WIRES);
+}
+
+static void rl_instrumented_draw_plane(Vector3 centerPos, Vector2 size, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_PLANE);
+    raylib_instrumented_target->draw_plane(centerPos, size, color);
+    RL_CALL_END(RL_CALL_DRAW_PLANE);
+}
+
+static void rl_instrumented_draw_ray(Ray ray, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_RAY);
+    raylib_instrumented_target->draw_ray(ray, color);
+    RL_CALL_END(RL_CALL_DRAW_RAY);
+}
+
+static void rl_instrumented_draw_grid(int slices, float spacing) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_GRID);
+    raylib_instrumented_target->draw_grid(slices, spacing);
+    RL_CALL_END(RL_CALL_DRAW_GRID);
+}
+
+static Model rl_instrumented_load_model(const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_MODEL);
+    Model result = raylib_instrumented_target->load_model(fileName);
+    RL_CALL_END(RL_CALL_LOAD_MODEL);
+    return result;
+}
+
+static Model rl_instrumented_load_model_from_mesh(Mesh mesh) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_MODEL_FROM_MESH);
+    Model result = raylib_instrumented_target->load_model_from_mesh(mesh);
+    RL_CALL_END(RL_CALL_LOAD_MODEL_FROM_MESH);
+    return result;
+}
+
+static bool rl_instrumented_is_model_valid(Model model) {
+    RL_CALL_BEGIN(RL_CALL_IS_MODEL_VALID);
+    bool result = raylib_instrumented_target->is_model_valid(model);
+    RL_CALL_END(RL_CALL_IS_MODEL_VALID);
+    return result;
+}
+
+static void rl_instrumented_unload_model(Model model) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_MODEL);
+    raylib_instrumented_target->unload_model(model);
+    RL_CALL_END(RL_CALL_UNLOAD_MODEL);
+}
+
+static BoundingBox rl_instrumented_get_model_bounding_box(Model model) {
+    RL_CALL_BEGIN(RL_CALL_GET_MODEL_BOUNDING_BOX);
+    BoundingBox result = raylib_instrumented_target->get_model_bounding_box(model);
+    RL_CALL_END(RL_CALL_GET_MODEL_BOUNDING_BOX);
+    return result;
+}
+
+static void rl_instrumented_draw_model(Model model, Vector3 position, float scale, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_MODEL);
+    raylib_instrumented_target->draw_model(model, position, scale, tint);
+    RL_CALL_END(RL_CALL_DRAW_MODEL);
+}
+
+static void rl_instrumented_draw_model_ex(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_MODEL_EX);
+    raylib_instrumented_target->draw_model_ex(model, position, rotationAxis, rotationAngle, scale, tint);
+    RL_CALL_END(RL_CALL_DRAW_MODEL_EX);
+}
+
+static void rl_instrumented_draw_model_wires(Model model, Vector3 position, float scale, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_MODEL_WIRES);
+    raylib_instrumented_target->draw_model_wires(model, position, scale, tint);
+    RL_CALL_END(RL_CALL_DRAW_MODEL_WIRES);
+}
+
+static void rl_instrumented_draw_model_wires_ex(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_MODEL_WIRES_EX);
+    raylib_instrumented_target->draw_model_wires_ex(model, position, rotationAxis, rotationAngle, scale, tint);
+    RL_CALL_END(RL_CALL_DRAW_MODEL_WIRES_EX);
+}
+
+static void rl_instrumented_draw_model_points(Model model, Vector3 position, float scale, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_MODEL_POINTS);
+    raylib_instrumented_target->draw_model_points(model, position, scale, tint);
+    RL_CALL_END(RL_CALL_DRAW_MODEL_POINTS);
+}
+
+static void rl_instrumented_draw_model_points_ex(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_MODEL_POINTS_EX);
+    raylib_instrumented_target->draw_model_points_ex(model, position, rotationAxis, rotationAngle, scale, tint);
+    RL_CALL_END(RL_CALL_DRAW_MODEL_POINTS_EX);
+}
+
+static void rl_instrumented_draw_bounding_box(BoundingBox box, Color color) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_BOUNDING_BOX);
+    raylib_instrumented_target->draw_bounding_box(box, color);
+    RL_CALL_END(RL_CALL_DRAW_BOUNDING_BOX);
+}
+
+static void rl_instrumented_draw_billboard(Camera camera, Texture2D texture, Vector3 position, float scale, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_BILLBOARD);
+    raylib_instrumented_target->draw_billboard(camera, texture, position, scale, tint);
+    RL_CALL_END(RL_CALL_DRAW_BILLBOARD);
+}
+
+static void rl_instrumented_draw_billboard_rec(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector2 size, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_BILLBOARD_REC);
+    raylib_instrumented_target->draw_billboard_rec(camera, texture, source, position, size, tint);
+    RL_CALL_END(RL_CALL_DRAW_BILLBOARD_REC);
+}
+
+static void rl_instrumented_draw_billboard_pro(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector3 up, Vector2 size, Vector2 origin, float rotation, Color tint) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_BILLBOARD_PRO);
+    raylib_instrumented_target->draw_billboard_pro(camera, texture, source, position, up, size, origin, rotation, tint);
+    RL_CALL_END(RL_CALL_DRAW_BILLBOARD_PRO);
+}
+
+static void rl_instrumented_upload_mesh(Mesh *mesh, bool dynamic) {
+    RL_CALL_BEGIN(RL_CALL_UPLOAD_MESH);
+    raylib_instrumented_target->upload_mesh(mesh, dynamic);
+    RL_CALL_END(RL_CALL_UPLOAD_MESH);
+}
+
+static void rl_instrumented_update_mesh_buffer(Mesh mesh, int index, const void *data, int dataSize, int offset) {
+    RL_CALL_BEGIN(RL_CALL_UPDATE_MESH_BUFFER);
+    raylib_instrumented_target->update_mesh_buffer(mesh, index, data, dataSize, offset);
+    RL_CALL_END(RL_CALL_UPDATE_MESH_BUFFER);
+}
+
+static void rl_instrumented_unload_mesh(Mesh mesh) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_MESH);
+    raylib_instrumented_target->unload_mesh(mesh);
+    RL_CALL_END(RL_CALL_UNLOAD_MESH);
+}
+
+static void rl_instrumented_draw_mesh(Mesh mesh, Material material, Matrix transform) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_MESH);
+    raylib_instrumented_target->draw_mesh(mesh, material, transform);
+    RL_CALL_END(RL_CALL_DRAW_MESH);
+}
+
+static void rl_instrumented_draw_mesh_instanced(Mesh mesh, Material material, const Matrix *transforms, int instances) {
+    RL_CALL_BEGIN(RL_CALL_DRAW_MESH_INSTANCED);
+    raylib_instrumented_target->draw_mesh_instanced(mesh, material, transforms, instances);
+    RL_CALL_END(RL_CALL_DRAW_MESH_INSTANCED);
+}
+
+static BoundingBox rl_instrumented_get_mesh_bounding_box(Mesh mesh) {
+    RL_CALL_BEGIN(RL_CALL_GET_MESH_BOUNDING_BOX);
+    BoundingBox result = raylib_instrumented_target->get_mesh_bounding_box(mesh);
+    RL_CALL_END(RL_CALL_GET_MESH_BOUNDING_BOX);
+    return result;
+}
+
+static void rl_instrumented_gen_mesh_tangents(Mesh *mesh) {
+    RL_CALL_BEGIN(RL_CALL_GEN_MESH_TANGENTS);
+    raylib_instrumented_target->gen_mesh_tangents(mesh);
+    RL_CALL_END(RL_CALL_GEN_MESH_TANGENTS);
+}
+
+static bool rl_instrumented_export_mesh(Mesh mesh, const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_EXPORT_MESH);
+    bool result = raylib_instrumented_target->export_mesh(mesh, fileName);
+    RL_CALL_END(RL_CALL_EXPORT_MESH);
+    return result;
+}
+
+static bool rl_instrumented_export_mesh_as_code(Mesh mesh, const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_EXPORT_MESH_AS_CODE);
+    bool result = raylib_instrumented_target->export_mesh_as_code(mesh, fileName);
+    RL_CALL_END(RL_CALL_EXPORT_MESH_AS_CODE);
+    return result;
+}
+
+static Mesh rl_instrumented_gen_mesh_poly(int sides, float radius) {
+    RL_CALL_BEGIN(RL_CALL_GEN_MESH_POLY);
+    Mesh result = raylib_instrumented_target->gen_mesh_poly(sides, radius);
+    RL_CALL_END(RL_CALL_GEN_MESH_POLY);
+    return result;
+}
+
+static Mesh rl_instrumented_gen_mesh_plane(float width, float length, int resX, int resZ) {
+    RL_CALL_BEGIN(RL_CALL_GEN_MESH_PLANE);
+    Mesh result = raylib_instrumented_target->gen_mesh_plane(width, length, resX, resZ);
+    RL_CALL_END(RL_CALL_GEN_MESH_PLANE);
+    return result;
+}
+
+static Mesh rl_instrumented_gen_mesh_cube(float width, float height, float length) {
+    RL_CALL_BEGIN(RL_CALL_GEN_MESH_CUBE);
+    Mesh result = raylib_instrumented_target->gen_mesh_cube(width, height, length);
+    RL_CALL_END(RL_CALL_GEN_MESH_CUBE);
+    return result;
+}
+
+static Mesh rl_instrumented_gen_mesh_sphere(float radius, int rings, int slices) {
+    RL_CALL_BEGIN(RL_CALL_GEN_MESH_SPHERE);
+    Mesh result = raylib_instrumented_target->gen_mesh_sphere(radius, rings, slices);
+    RL_CALL_END(RL_CALL_GEN_MESH_SPHERE);
+    return result;
+}
+
+static Mesh rl_instrumented_gen_mesh_hemi_sphere(float radius, int rings, int slices) {
+    RL_CALL_BEGIN(RL_CALL_GEN_MESH_HEMI_SPHERE);
+    Mesh result = raylib_instrumented_target->gen_mesh_hemi_sphere(radius, rings, slices);
+    RL_CALL_END(RL_CALL_GEN_MESH_HEMI_SPHERE);
+    return result;
+}
+
+static Mesh rl_instrumented_gen_mesh_cylinder(float radius, float height, int slices) {
+    RL_CALL_BEGIN(RL_CALL_GEN_MESH_CYLINDER);
+    Mesh result = raylib_instrumented_target->gen_mesh_cylinder(radius, height, slices);
+    RL_CALL_END(RL_CALL_GEN_MESH_CYLINDER);
+    return result;
+}
+
+static Mesh rl_instrumented_gen_mesh_cone(float radius, float height, int slices) {
+    RL_CALL_BEGIN(RL_CALL_GEN_MESH_CONE);
+    Mesh result = raylib_instrumented_target->gen_mesh_cone(radius, height, slices);
+    RL_CALL_END(RL_CALL_GEN_MESH_CONE);
+    return result;
+}
+
+static Mesh rl_instrumented_gen_mesh_torus(float radius, float size, int radSeg, int sides) {
+    RL_CALL_BEGIN(RL_CALL_GEN_MESH_TORUS);
+    Mesh result = raylib_instrumented_target->gen_mesh_torus(radius, size, radSeg, sides);
+    RL_CALL_END(RL_CALL_GEN_MESH_TORUS);
+    return result;
+}
+
+static Mesh rl_instrumented_gen_mesh_knot(float radius, float size, int radSeg, int sides) {
+    RL_CALL_BEGIN(RL_CALL_GEN_MESH_KNOT);
+    Mesh result = raylib_instrumented_target->gen_mesh_knot(radius, size, radSeg, sides);
+    RL_CALL_END(RL_CALL_GEN_MESH_KNOT);
+    return result;
+}
+
+static Mesh rl_instrumented_gen_mesh_heightmap(Image heightmap, Vector3 size) {
+    RL_CALL_BEGIN(RL_CALL_GEN_MESH_HEIGHTMAP);
+    Mesh result = raylib_instrumented_target->gen_mesh_heightmap(heightmap, size);
+    RL_CALL_END(RL_CALL_GEN_MESH_HEIGHTMAP);
+    return result;
+}
+
+static Mesh rl_instrumented_gen_mesh_cubicmap(Image cubicmap, Vector3 cubeSize) {
+    RL_CALL_BEGIN(RL_CALL_GEN_MESH_CUBICMAP);
+    Mesh result = raylib_instrumented_target->gen_mesh_cubicmap(cubicmap, cubeSize);
+    RL_CALL_END(RL_CALL_GEN_MESH_CUBICMAP);
+    return result;
+}
+
+static Material * rl_instrumented_load_materials(const char *fileName, int *materialCount) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_MATERIALS);
+    Material * result = raylib_instrumented_target->load_materials(fileName, materialCount);
+    RL_CALL_END(RL_CALL_LOAD_MATERIALS);
+    return result;
+}
+
+static Material rl_instrumented_load_material_default(void) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_MATERIAL_DEFAULT);
+    Material result = raylib_instrumented_target->load_material_default();
+    RL_CALL_END(RL_CALL_LOAD_MATERIAL_DEFAULT);
+    return result;
+}
+
+static bool rl_instrumented_is_material_valid(Material material) {
+    RL_CALL_BEGIN(RL_CALL_IS_MATERIAL_VALID);
+    bool result = raylib_instrumented_target->is_material_valid(material);
+    RL_CALL_END(RL_CALL_IS_MATERIAL_VALID);
+    return result;
+}
+
+static void rl_instrumented_unload_material(Material material) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_MATERIAL);
+    raylib_instrumented_target->unload_material(material);
+    RL_CALL_END(RL_CALL_UNLOAD_MATERIAL);
+}
+
+static void rl_instrumented_set_material_texture(Material *material, int mapType, Texture2D texture) {
+    RL_CALL_BEGIN(RL_CALL_SET_MATERIAL_TEXTURE);
+    raylib_instrumented_target->set_material_texture(material, mapType, texture);
+    RL_CALL_END(RL_CALL_SET_MATERIAL_TEXTURE);
+}
+
+static void rl_instrumented_set_model_mesh_material(Model *model, int meshId, int materialId) {
+    RL_CALL_BEGIN(RL_CALL_SET_MODEL_MESH_MATERIAL);
+    raylib_instrumented_target->set_model_mesh_material(model, meshId, materialId);
+    RL_CALL_END(RL_CALL_SET_MODEL_MESH_MATERIAL);
+}
+
+static ModelAnimation * rl_instrumented_load_model_animations(const char *fileName, int *animCount) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_MODEL_ANIMATIONS);
+    ModelAnimation * result = raylib_instrumented_target->load_model_animations(fileName, animCount);
+    RL_CALL_END(RL_CALL_LOAD_MODEL_ANIMATIONS);
+    return result;
+}
+
+static void rl_instrumented_update_model_animation(Model model, ModelAnimation anim, int frame) {
+    RL_CALL_BEGIN(RL_CALL_UPDATE_MODEL_ANIMATION);
+    raylib_instrumented_target->update_model_animation(model, anim, frame);
+    RL_CALL_END(RL_CALL_UPDATE_MODEL_ANIMATION);
+}
+
+static void rl_instrumented_update_model_animation_bones(Model model, ModelAnimation anim, int frame) {
+    RL_CALL_BEGIN(RL_CALL_UPDATE_MODEL_ANIMATION_BONES);
+    raylib_instrumented_target->update_model_animation_bones(model, anim, frame);
+    RL_CALL_END(RL_CALL_UPDATE_MODEL_ANIMATION_BONES);
+}
+
+static void rl_instrumented_unload_model_animation(ModelAnimation anim) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_MODEL_ANIMATION);
+    raylib_instrumented_target->unload_model_animation(anim);
+    RL_CALL_END(RL_CALL_UNLOAD_MODEL_ANIMATION);
+}
+
+static void rl_instrumented_unload_model_animations(ModelAnimation *animations, int animCount) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_MODEL_ANIMATIONS);
+    raylib_instrumented_target->unload_model_animations(animations, animCount);
+    RL_CALL_END(RL_CALL_UNLOAD_MODEL_ANIMATIONS);
+}
+
+static bool rl_instrumented_is_model_animation_valid(Model model, ModelAnimation anim) {
+    RL_CALL_BEGIN(RL_CALL_IS_MODEL_ANIMATION_VALID);
+    bool result = raylib_instrumented_target->is_model_animation_valid(model, anim);
+    RL_CALL_END(RL_CALL_IS_MODEL_ANIMATION_VALID);
+    return result;
+}
+
+static bool rl_instrumented_check_collision_spheres(Vector3 center1, float radius1, Vector3 center2, float radius2) {
+    RL_CALL_BEGIN(RL_CALL_CHECK_COLLISION_SPHERES);
+    bool result = raylib_instrumented_target->check_collision_spheres(center1, radius1, center2, radius2);
+    RL_CALL_END(RL_CALL_CHECK_COLLISION_SPHERES);
+    return result;
+}
+
+static bool rl_instrumented_check_collision_boxes(BoundingBox box1, BoundingBox box2) {
+    RL_CALL_BEGIN(RL_CALL_CHECK_COLLISION_BOXES);
+    bool result = raylib_instrumented_target->check_collision_boxes(box1, box2);
+    RL_CALL_END(RL_CALL_CHECK_COLLISION_BOXES);
+    return result;
+}
+
+static bool rl_instrumented_check_collision_box_sphere(BoundingBox box, Vector3 center, float radius) {
+    RL_CALL_BEGIN(RL_CALL_CHECK_COLLISION_BOX_SPHERE);
+    bool result = raylib_instrumented_target->check_collision_box_sphere(box, center, radius);
+    RL_CALL_END(RL_CALL_CHECK_COLLISION_BOX_SPHERE);
+    return result;
+}
+
+static RayCollision rl_instrumented_get_ray_collision_sphere(Ray ray, Vector3 center, float radius) {
+    RL_CALL_BEGIN(RL_CALL_GET_RAY_COLLISION_SPHERE);
+    RayCollision result = raylib_instrumented_target->get_ray_collision_sphere(ray, center, radius);
+    RL_CALL_END(RL_CALL_GET_RAY_COLLISION_SPHERE);
+    return result;
+}
+
+static RayCollision rl_instrumented_get_ray_collision_box(Ray ray, BoundingBox box) {
+    RL_CALL_BEGIN(RL_CALL_GET_RAY_COLLISION_BOX);
+    RayCollision result = raylib_instrumented_target->get_ray_collision_box(ray, box);
+    RL_CALL_END(RL_CALL_GET_RAY_COLLISION_BOX);
+    return result;
+}
+
+static RayCollision rl_instrumented_get_ray_collision_mesh(Ray ray, Mesh mesh, Matrix transform) {
+    RL_CALL_BEGIN(RL_CALL_GET_RAY_COLLISION_MESH);
+    RayCollision result = raylib_instrumented_target->get_ray_collision_mesh(ray, mesh, transform);
+    RL_CALL_END(RL_CALL_GET_RAY_COLLISION_MESH);
+    return result;
+}
+
+static RayCollision rl_instrumented_get_ray_collision_triangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3) {
+    RL_CALL_BEGIN(RL_CALL_GET_RAY_COLLISION_TRIANGLE);
+    RayCollision result = raylib_instrumented_target->get_ray_collision_triangle(ray, p1, p2, p3);
+    RL_CALL_END(RL_CALL_GET_RAY_COLLISION_TRIANGLE);
+    return result;
+}
+
+static RayCollision rl_instrumented_get_ray_collision_quad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4) {
+    RL_CALL_BEGIN(RL_CALL_GET_RAY_COLLISION_QUAD);
+    RayCollision result = raylib_instrumented_target->get_ray_collision_quad(ray, p1, p2, p3, p4);
+    RL_CALL_END(RL_CALL_GET_RAY_COLLISION_QUAD);
+    return result;
+}
+
+static void rl_instrumented_init_audio_device(void) {
+    RL_CALL_BEGIN(RL_CALL_INIT_AUDIO_DEVICE);
+    raylib_instrumented_target->init_audio_device();
+    RL_CALL_END(RL_CALL_INIT_AUDIO_DEVICE);
+}
+
+static void rl_instrumented_close_audio_device(void) {
+    RL_CALL_BEGIN(RL_CALL_CLOSE_AUDIO_DEVICE);
+    raylib_instrumented_target->close_audio_device();
+    RL_CALL_END(RL_CALL_CLOSE_AUDIO_DEVICE);
+}
+
+static bool rl_instrumented_is_audio_device_ready(void) {
+    RL_CALL_BEGIN(RL_CALL_IS_AUDIO_DEVICE_READY);
+    bool result = raylib_instrumented_target->is_audio_device_ready();
+    RL_CALL_END(RL_CALL_IS_AUDIO_DEVICE_READY);
+    return result;
+}
+
+static void rl_instrumented_set_master_volume(float volume) {
+    RL_CALL_BEGIN(RL_CALL_SET_MASTER_VOLUME);
+    raylib_instrumented_target->set_master_volume(volume);
+    RL_CALL_END(RL_CALL_SET_MASTER_VOLUME);
+}
+
+static float rl_instrumented_get_master_volume(void) {
+    RL_CALL_BEGIN(RL_CALL_GET_MASTER_VOLUME);
+    float result = raylib_instrumented_target->get_master_volume();
+    RL_CALL_END(RL_CALL_GET_MASTER_VOLUME);
+    return result;
+}
+
+static Wave rl_instrumented_load_wave(const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_WAVE);
+    Wave result = raylib_instrumented_target->load_wave(fileName);
+    RL_CALL_END(RL_CALL_LOAD_WAVE);
+    return result;
+}
+
+static Wave rl_instrumented_load_wave_from_memory(const char *fileType, const unsigned char *fileData, int dataSize) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_WAVE_FROM_MEMORY);
+    Wave result = raylib_instrumented_target->load_wave_from_memory(fileType, fileData, dataSize);
+    RL_CALL_END(RL_CALL_LOAD_WAVE_FROM_MEMORY);
+    return result;
+}
+
+static bool rl_instrumented_is_wave_valid(Wave wave) {
+    RL_CALL_BEGIN(RL_CALL_IS_WAVE_VALID);
+    bool result = raylib_instrumented_target->is_wave_valid(wave);
+    RL_CALL_END(RL_CALL_IS_WAVE_VALID);
+    return result;
+}
+
+static Sound rl_instrumented_load_sound(const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_SOUND);
+    Sound result = raylib_instrumented_target->load_sound(fileName);
+    RL_CALL_END(RL_CALL_LOAD_SOUND);
+    return result;
+}
+
+static Sound rl_instrumented_load_sound_from_wave(Wave wave) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_SOUND_FROM_WAVE);
+    Sound result = raylib_instrumented_target->load_sound_from_wave(wave);
+    RL_CALL_END(RL_CALL_LOAD_SOUND_FROM_WAVE);
+    return result;
+}
+
+static Sound rl_instrumented_load_sound_alias(Sound source) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_SOUND_ALIAS);
+    Sound result = raylib_instrumented_target->load_sound_alias(source);
+    RL_CALL_END(RL_CALL_LOAD_SOUND_ALIAS);
+    return result;
+}
+
+static bool rl_instrumented_is_sound_valid(Sound sound) {
+    RL_CALL_BEGIN(RL_CALL_IS_SOUND_VALID);
+    bool result = raylib_instrumented_target->is_sound_valid(sound);
+    RL_CALL_END(RL_CALL_IS_SOUND_VALID);
+    return result;
+}
+
+static void rl_instrumented_update_sound(Sound sound, const void *data, int sampleCount) {
+    RL_CALL_BEGIN(RL_CALL_UPDATE_SOUND);
+    raylib_instrumented_target->update_sound(sound, data, sampleCount);
+    RL_CALL_END(RL_CALL_UPDATE_SOUND);
+}
+
+static void rl_instrumented_unload_wave(Wave wave) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_WAVE);
+    raylib_instrumented_target->unload_wave(wave);
+    RL_CALL_END(RL_CALL_UNLOAD_WAVE);
+}
+
+static void rl_instrumented_unload_sound(Sound sound) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_SOUND);
+    raylib_instrumented_target->unload_sound(sound);
+    RL_CALL_END(RL_CALL_UNLOAD_SOUND);
+}
+
+static void rl_instrumented_unload_sound_alias(Sound alias) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_SOUND_ALIAS);
+    raylib_instrumented_target->unload_sound_alias(alias);
+    RL_CALL_END(RL_CALL_UNLOAD_SOUND_ALIAS);
+}
+
+static bool rl_instrumented_export_wave(Wave wave, const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_EXPORT_WAVE);
+    bool result = raylib_instrumented_target->export_wave(wave, fileName);
+    RL_CALL_END(RL_CALL_EXPORT_WAVE);
+    return result;
+}
+
+static bool rl_instrumented_export_wave_as_code(Wave wave, const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_EXPORT_WAVE_AS_CODE);
+    bool result = raylib_instrumented_target->export_wave_as_code(wave, fileName);
+    RL_CALL_END(RL_CALL_EXPORT_WAVE_AS_CODE);
+    return result;
+}
+
+static void rl_instrumented_play_sound(Sound sound) {
+    RL_CALL_BEGIN(RL_CALL_PLAY_SOUND);
+    raylib_instrumented_target->play_sound(sound);
+    RL_CALL_END(RL_CALL_PLAY_SOUND);
+}
+
+static void rl_instrumented_stop_sound(Sound sound) {
+    RL_CALL_BEGIN(RL_CALL_STOP_SOUND);
+    raylib_instrumented_target->stop_sound(sound);
+    RL_CALL_END(RL_CALL_STOP_SOUND);
+}
+
+static void rl_instrumented_pause_sound(Sound sound) {
+    RL_CALL_BEGIN(RL_CALL_PAUSE_SOUND);
+    raylib_instrumented_target->pause_sound(sound);
+    RL_CALL_END(RL_CALL_PAUSE_SOUND);
+}
+
+static void rl_instrumented_resume_sound(Sound sound) {
+    RL_CALL_BEGIN(RL_CALL_RESUME_SOUND);
+    raylib_instrumented_target->resume_sound(sound);
+    RL_CALL_END(RL_CALL_RESUME_SOUND);
+}
+
+static bool rl_instrumented_is_sound_playing(Sound sound) {
+    RL_CALL_BEGIN(RL_CALL_IS_SOUND_PLAYING);
+    bool result = raylib_instrumented_target->is_sound_playing(sound);
+    RL_CALL_END(RL_CALL_IS_SOUND_PLAYING);
+    return result;
+}
+
+static void rl_instrumented_set_sound_volume(Sound sound, float volume) {
+    RL_CALL_BEGIN(RL_CALL_SET_SOUND_VOLUME);
+    raylib_instrumented_target->set_sound_volume(sound, volume);
+    RL_CALL_END(RL_CALL_SET_SOUND_VOLUME);
+}
+
+static void rl_instrumented_set_sound_pitch(Sound sound, float pitch) {
+    RL_CALL_BEGIN(RL_CALL_SET_SOUND_PITCH);
+    raylib_instrumented_target->set_sound_pitch(sound, pitch);
+    RL_CALL_END(RL_CALL_SET_SOUND_PITCH);
+}
+
+static void rl_instrumented_set_sound_pan(Sound sound, float pan) {
+    RL_CALL_BEGIN(RL_CALL_SET_SOUND_PAN);
+    raylib_instrumented_target->set_sound_pan(sound, pan);
+    RL_CALL_END(RL_CALL_SET_SOUND_PAN);
+}
+
+static Wave rl_instrumented_wave_copy(Wave wave) {
+    RL_CALL_BEGIN(RL_CALL_WAVE_COPY);
+    Wave result = raylib_instrumented_target->wave_copy(wave);
+    RL_CALL_END(RL_CALL_WAVE_COPY);
+    return result;
+}
+
+static void rl_instrumented_wave_crop(Wave *wave, int initFrame, int finalFrame) {
+    RL_CALL_BEGIN(RL_CALL_WAVE_CROP);
+    raylib_instrumented_target->wave_crop(wave, initFrame, finalFrame);
+    RL_CALL_END(RL_CALL_WAVE_CROP);
+}
+
+static void rl_instrumented_wave_format(Wave *wave, int sampleRate, int sampleSize, int channels) {
+    RL_CALL_BEGIN(RL_CALL_WAVE_FORMAT);
+    raylib_instrumented_target->wave_format(wave, sampleRate, sampleSize, channels);
+    RL_CALL_END(RL_CALL_WAVE_FORMAT);
+}
+
+static float * rl_instrumented_load_wave_samples(Wave wave) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_WAVE_SAMPLES);
+    float * result = raylib_instrumented_target->load_wave_samples(wave);
+    RL_CALL_END(RL_CALL_LOAD_WAVE_SAMPLES);
+    return result;
+}
+
+static void rl_instrumented_unload_wave_samples(float *samples) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_WAVE_SAMPLES);
+    raylib_instrumented_target->unload_wave_samples(samples);
+    RL_CALL_END(RL_CALL_UNLOAD_WAVE_SAMPLES);
+}
+
+static Music rl_instrumented_load_music_stream(const char *fileName) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_MUSIC_STREAM);
+    Music result = raylib_instrumented_target->load_music_stream(fileName);
+    RL_CALL_END(RL_CALL_LOAD_MUSIC_STREAM);
+    return result;
+}
+
+static Music rl_instrumented_load_music_stream_from_memory(const char *fileType, const unsigned char *data, int dataSize) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_MUSIC_STREAM_FROM_MEMORY);
+    Music result = raylib_instrumented_target->load_music_stream_from_memory(fileType, data, dataSize);
+    RL_CALL_END(RL_CALL_LOAD_MUSIC_STREAM_FROM_MEMORY);
+    return result;
+}
+
+static bool rl_instrumented_is_music_valid(Music music) {
+    RL_CALL_BEGIN(RL_CALL_IS_MUSIC_VALID);
+    bool result = raylib_instrumented_target->is_music_valid(music);
+    RL_CALL_END(RL_CALL_IS_MUSIC_VALID);
+    return result;
+}
+
+static void rl_instrumented_unload_music_stream(Music music) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_MUSIC_STREAM);
+    raylib_instrumented_target->unload_music_stream(music);
+    RL_CALL_END(RL_CALL_UNLOAD_MUSIC_STREAM);
+}
+
+static void rl_instrumented_play_music_stream(Music music) {
+    RL_CALL_BEGIN(RL_CALL_PLAY_MUSIC_STREAM);
+    raylib_instrumented_target->play_music_stream(music);
+    RL_CALL_END(RL_CALL_PLAY_MUSIC_STREAM);
+}
+
+static bool rl_instrumented_is_music_stream_playing(Music music) {
+    RL_CALL_BEGIN(RL_CALL_IS_MUSIC_STREAM_PLAYING);
+    bool result = raylib_instrumented_target->is_music_stream_playing(music);
+    RL_CALL_END(RL_CALL_IS_MUSIC_STREAM_PLAYING);
+    return result;
+}
+
+static void rl_instrumented_update_music_stream(Music music) {
+    RL_CALL_BEGIN(RL_CALL_UPDATE_MUSIC_STREAM);
+    raylib_instrumented_target->update_music_stream(music);
+    RL_CALL_END(RL_CALL_UPDATE_MUSIC_STREAM);
+}
+
+static void rl_instrumented_stop_music_stream(Music music) {
+    RL_CALL_BEGIN(RL_CALL_STOP_MUSIC_STREAM);
+    raylib_instrumented_target->stop_music_stream(music);
+    RL_CALL_END(RL_CALL_STOP_MUSIC_STREAM);
+}
+
+static void rl_instrumented_pause_music_stream(Music music) {
+    RL_CALL_BEGIN(RL_CALL_PAUSE_MUSIC_STREAM);
+    raylib_instrumented_target->pause_music_stream(music);
+    RL_CALL_END(RL_CALL_PAUSE_MUSIC_STREAM);
+}
+
+static void rl_instrumented_resume_music_stream(Music music) {
+    RL_CALL_BEGIN(RL_CALL_RESUME_MUSIC_STREAM);
+    raylib_instrumented_target->resume_music_stream(music);
+    RL_CALL_END(RL_CALL_RESUME_MUSIC_STREAM);
+}
+
+static void rl_instrumented_seek_music_stream(Music music, float position) {
+    RL_CALL_BEGIN(RL_CALL_SEEK_MUSIC_STREAM);
+    raylib_instrumented_target->seek_music_stream(music, position);
+    RL_CALL_END(RL_CALL_SEEK_MUSIC_STREAM);
+}
+
+static void rl_instrumented_set_music_volume(Music music, float volume) {
+    RL_CALL_BEGIN(RL_CALL_SET_MUSIC_VOLUME);
+    raylib_instrumented_target->set_music_volume(music, volume);
+    RL_CALL_END(RL_CALL_SET_MUSIC_VOLUME);
+}
+
+static void rl_instrumented_set_music_pitch(Music music, float pitch) {
+    RL_CALL_BEGIN(RL_CALL_SET_MUSIC_PITCH);
+    raylib_instrumented_target->set_music_pitch(music, pitch);
+    RL_CALL_END(RL_CALL_SET_MUSIC_PITCH);
+}
+
+static void rl_instrumented_set_music_pan(Music music, float pan) {
+    RL_CALL_BEGIN(RL_CALL_SET_MUSIC_PAN);
+    raylib_instrumented_target->set_music_pan(music, pan);
+    RL_CALL_END(RL_CALL_SET_MUSIC_PAN);
+}
+
+static float rl_instrumented_get_music_time_length(Music music) {
+    RL_CALL_BEGIN(RL_CALL_GET_MUSIC_TIME_LENGTH);
+    float result = raylib_instrumented_target->get_music_time_length(music);
+    RL_CALL_END(RL_CALL_GET_MUSIC_TIME_LENGTH);
+    return result;
+}
+
+static float rl_instrumented_get_music_time_played(Music music) {
+    RL_CALL_BEGIN(RL_CALL_GET_MUSIC_TIME_PLAYED);
+    float result = raylib_instrumented_target->get_music_time_played(music);
+    RL_CALL_END(RL_CALL_GET_MUSIC_TIME_PLAYED);
+    return result;
+}
+
+static AudioStream rl_instrumented_load_audio_stream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels) {
+    RL_CALL_BEGIN(RL_CALL_LOAD_AUDIO_STREAM);
+    AudioStream result = raylib_instrumented_target->load_audio_stream(sampleRate, sampleSize, channels);
+    RL_CALL_END(RL_CALL_LOAD_AUDIO_STREAM);
+    return result;
+}
+
+static bool rl_instrumented_is_audio_stream_valid(AudioStream stream) {
+    RL_CALL_BEGIN(RL_CALL_IS_AUDIO_STREAM_VALID);
+    bool result = raylib_instrumented_target->is_audio_stream_valid(stream);
+    RL_CALL_END(RL_CALL_IS_AUDIO_STREAM_VALID);
+    return result;
+}
+
+static void rl_instrumented_unload_audio_stream(AudioStream stream) {
+    RL_CALL_BEGIN(RL_CALL_UNLOAD_AUDIO_STREAM);
+    raylib_instrumented_target->unload_audio_stream(stream);
+    RL_CALL_END(RL_CALL_UNLOAD_AUDIO_STREAM);
+}
+
+static void rl_instrumented_update_audio_stream(AudioStream stream, const void *data, int frameCount) {
+    RL_CALL_BEGIN(RL_CALL_UPDATE_AUDIO_STREAM);
+    raylib_instrumented_target->update_audio_stream(stream, data, frameCount);
+    RL_CALL_END(RL_CALL_UPDATE_AUDIO_STREAM);
+}
+
+static bool rl_instrumented_is_audio_stream_processed(AudioStream stream) {
+    RL_CALL_BEGIN(RL_CALL_IS_AUDIO_STREAM_PROCESSED);
+    bool result = raylib_instrumented_target->is_audio_stream_processed(stream);
+    RL_CALL_END(RL_CALL_IS_AUDIO_STREAM_PROCESSED);
+    return result;
+}
+
+static void rl_instrumented_play_audio_stream(AudioStream stream) {
+    RL_CALL_BEGIN(RL_CALL_PLAY_AUDIO_STREAM);
+    raylib_instrumented_target->play_audio_stream(stream);
+    RL_CALL_END(RL_CALL_PLAY_AUDIO_STREAM);
+}
+
+static void rl_instrumented_pause_audio_stream(AudioStream stream) {
+    RL_CALL_BEGIN(RL_CALL_PAUSE_AUDIO_STREAM);
+    raylib_instrumented_target->pause_audio_stream(stream);
+    RL_CALL_END(RL_CALL_PAUSE_AUDIO_STREAM);
+}
+
+static void rl_instrumented_resume_audio_stream(AudioStream stream) {
+    RL_CALL_BEGIN(RL_CALL_RESUME_AUDIO_STREAM);
+    raylib_instrumented_target->resume_audio_stream(stream);
+    RL_CALL_END(RL_CALL_RESUME_AUDIO_STREAM);
+}
+
+static bool rl_instrumented_is_audio_stream_playing(AudioStream stream) {
+    RL_CALL_BEGIN(RL_CALL_IS_AUDIO_STREAM_PLAYING);
+    bool result = raylib_instrumented_target->is_audio_stream_playing(stream);
+    RL_CALL_END(RL_CALL_IS_AUDIO_STREAM_PLAYING);
+    return result;
+}
+
+static void rl_instrumented_stop_audio_stream(AudioStream stream) {
+    RL_CALL_BEGIN(RL_CALL_STOP_AUDIO_STREAM);
+    raylib_instrumented_target->stop_audio_stream(stream);
+    RL_CALL_END(RL_CALL_STOP_AUDIO_STREAM);
+}
+
+static void rl_instrumented_set_audio_stream_volume(AudioStream stream, float volume) {
+    RL_CALL_BEGIN(RL_CALL_SET_AUDIO_STREAM_VOLUME);
+    raylib_instrumented_target->set_audio_stream_volume(stream, volume);
+    RL_CALL_END(RL_CALL_SET_AUDIO_STREAM_VOLUME);
+}
+
+static void rl_instrumented_set_audio_stream_pitch(AudioStream stream, float pitch) {
+    RL_CALL_BEGIN(RL_CALL_SET_AUDIO_STREAM_PITCH);
+    raylib_instrumented_target->set_audio_stream_pitch(stream, pitch);
+    RL_CALL_END(RL_CALL_SET_AUDIO_STREAM_PITCH);
+}
+
+static void rl_instrumented_set_audio_stream_pan(AudioStream stream, float pan) {
+    RL_CALL_BEGIN(RL_CALL_SET_AUDIO_STREAM_PAN);
+    raylib_instrumented_target->set_audio_stream_pan(stream, pan);
+    RL_CALL_END(RL_CALL_SET_AUDIO_STREAM_PAN);
+}
+
+static void rl_instrumented_set_audio_stream_buffer_size_default(int size) {
+    RL_CALL_BEGIN(RL_CALL_SET_AUDIO_STREAM_BUFFER_SIZE_DEFAULT);
+    raylib_instrumented_target->set_audio_stream_buffer_size_default(size);
+    RL_CALL_END(RL_CALL_SET_AUDIO_STREAM_BUFFER_SIZE_DEFAULT);
+}
+
+static void rl_instrumented_set_audio_stream_callback(AudioStream stream, AudioCallback callback) {
+    RL_CALL_BEGIN(RL_CALL_SET_AUDIO_STREAM_CALLBACK);
+    raylib_instrumented_target->set_audio_stream_callback(stream, callback);
+    RL_CALL_END(RL_CALL_SET_AUDIO_STREAM_CALLBACK);
+}
+
+static void rl_instrumented_attach_audio_stream_processor(AudioStream stream, AudioCallback processor) {
+    RL_CALL_BEGIN(RL_CALL_ATTACH_AUDIO_STREAM_PROCESSOR);
+    raylib_instrumented_target->attach_audio_stream_processor(stream, processor);
+    RL_CALL_END(RL_CALL_ATTACH_AUDIO_STREAM_PROCESSOR);
+}
+
+static void rl_instrumented_detach_audio_stream_processor(AudioStream stream, AudioCallback processor) {
+    RL_CALL_BEGIN(RL_CALL_DETACH_AUDIO_STREAM_PROCESSOR);
+    raylib_instrumented_target->detach_audio_stream_processor(stream, processor);
+    RL_CALL_END(RL_CALL_DETACH_AUDIO_STREAM_PROCESSOR);
+}
+
+static void rl_instrumented_attach_audio_mixed_processor(AudioCallback processor) {
+    RL_CALL_BEGIN(RL_CALL_ATTACH_AUDIO_MIXED_PROCESSOR);
+    raylib_instrumented_target->attach_audio_mixed_processor(processor);
+    RL_CALL_END(RL_CALL_ATTACH_AUDIO_MIXED_PROCESSOR);
+}
+
+static void rl_instrumented_detach_audio_mixed_processor(AudioCallback processor) {
+    RL_CALL_BEGIN(RL_CALL_DETACH_AUDIO_MIXED_PROCESSOR);
+    raylib_instrumented_target->detach_audio_mixed_processor(processor);
+    RL_CALL_END(RL_CALL_DETACH_AUDIO_MIXED_PROCESSOR);
+}
+
+static float rl_instrumented_clamp(float value, float min, float max) {
+    RL_CALL_BEGIN(RL_CALL_CLAMP);
+    float result = raylib_instrumented_target->clamp(value, min, max);
+    RL_CALL_END(RL_CALL_CLAMP);
+    return result;
+}
+
+static float rl_instrumented_lerp(float start, float end, float amount) {
+    RL_CALL_BEGIN(RL_CALL_LERP);
+    float result = raylib_instrumented_target->lerp(start, end, amount);
+    RL_CALL_END(RL_CALL_LERP);
+    return result;
+}
+
+static float rl_instrumented_normalize(float value, float start, float end) {
+    RL_CALL_BEGIN(RL_CALL_NORMALIZE);
+    float result = raylib_instrumented_target->normalize(value, start, end);
+    RL_CALL_END(RL_CALL_NORMALIZE);
+    return result;
+}
+
+static float rl_instrumented_remap(float value, float inputStart, float inputEnd, float outputStart, float outputEnd) {
+    RL_CALL_BEGIN(RL_CALL_REMAP);
+    float result = raylib_instrumented_target->remap(value, inputStart, inputEnd, outputStart, outputEnd);
+    RL_CALL_END(RL_CALL_REMAP);
+    return result;
+}
+
+static float rl_instrumented_wrap(float value, float min, float max) {
+    RL_CALL_BEGIN(RL_CALL_WRAP);
+    float result = raylib_instrumented_target->wrap(value, min, max);
+    RL_CALL_END(RL_CALL_WRAP);
+    return result;
+}
+
+static int rl_instrumented_float_equals(float x, float y) {
+    RL_CALL_BEGIN(RL_CALL_FLOAT_EQUALS);
+    int result = raylib_instrumented_target->float_equals(x, y);
+    RL_CALL_END(RL_CALL_FLOAT_EQUALS);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_zero(void) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_ZERO);
+    Vector2 result = raylib_instrumented_target->vector2_zero();
+    RL_CALL_END(RL_CALL_VECTOR2_ZERO);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_one(void) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_ONE);
+    Vector2 result = raylib_instrumented_target->vector2_one();
+    RL_CALL_END(RL_CALL_VECTOR2_ONE);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_add(Vector2 v1, Vector2 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_ADD);
+    Vector2 result = raylib_instrumented_target->vector2_add(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR2_ADD);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_add_value(Vector2 v, float add) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_ADD_VALUE);
+    Vector2 result = raylib_instrumented_target->vector2_add_value(v, add);
+    RL_CALL_END(RL_CALL_VECTOR2_ADD_VALUE);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_subtract(Vector2 v1, Vector2 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_SUBTRACT);
+    Vector2 result = raylib_instrumented_target->vector2_subtract(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR2_SUBTRACT);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_subtract_value(Vector2 v, float sub) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_SUBTRACT_VALUE);
+    Vector2 result = raylib_instrumented_target->vector2_subtract_value(v, sub);
+    RL_CALL_END(RL_CALL_VECTOR2_SUBTRACT_VALUE);
+    return result;
+}
+
+static float rl_instrumented_vector2_length(Vector2 v) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_LENGTH);
+    float result = raylib_instrumented_target->vector2_length(v);
+    RL_CALL_END(RL_CALL_VECTOR2_LENGTH);
+    return result;
+}
+
+static float rl_instrumented_vector2_length_sqr(Vector2 v) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_LENGTH_SQR);
+    float result = raylib_instrumented_target->vector2_length_sqr(v);
+    RL_CALL_END(RL_CALL_VECTOR2_LENGTH_SQR);
+    return result;
+}
+
+static float rl_instrumented_vector2_dot_product(Vector2 v1, Vector2 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_DOT_PRODUCT);
+    float result = raylib_instrumented_target->vector2_dot_product(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR2_DOT_PRODUCT);
+    return result;
+}
+
+static float rl_instrumented_vector2_distance(Vector2 v1, Vector2 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_DISTANCE);
+    float result = raylib_instrumented_target->vector2_distance(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR2_DISTANCE);
+    return result;
+}
+
+static float rl_instrumented_vector2_distance_sqr(Vector2 v1, Vector2 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_DISTANCE_SQR);
+    float result = raylib_instrumented_target->vector2_distance_sqr(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR2_DISTANCE_SQR);
+    return result;
+}
+
+static float rl_instrumented_vector2_angle(Vector2 v1, Vector2 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_ANGLE);
+    float result = raylib_instrumented_target->vector2_angle(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR2_ANGLE);
+    return result;
+}
+
+static float rl_instrumented_vector2_line_angle(Vector2 start, Vector2 end) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_LINE_ANGLE);
+    float result = raylib_instrumented_target->vector2_line_angle(start, end);
+    RL_CALL_END(RL_CALL_VECTOR2_LINE_ANGLE);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_scale(Vector2 v, float scale) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_SCALE);
+    Vector2 result = raylib_instrumented_target->vector2_scale(v, scale);
+    RL_CALL_END(RL_CALL_VECTOR2_SCALE);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_multiply(Vector2 v1, Vector2 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_MULTIPLY);
+    Vector2 result = raylib_instrumented_target->vector2_multiply(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR2_MULTIPLY);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_negate(Vector2 v) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_NEGATE);
+    Vector2 result = raylib_instrumented_target->vector2_negate(v);
+    RL_CALL_END(RL_CALL_VECTOR2_NEGATE);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_divide(Vector2 v1, Vector2 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_DIVIDE);
+    Vector2 result = raylib_instrumented_target->vector2_divide(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR2_DIVIDE);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_normalize(Vector2 v) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_NORMALIZE);
+    Vector2 result = raylib_instrumented_target->vector2_normalize(v);
+    RL_CALL_END(RL_CALL_VECTOR2_NORMALIZE);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_transform(Vector2 v, Matrix mat) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_TRANSFORM);
+    Vector2 result = raylib_instrumented_target->vector2_transform(v, mat);
+    RL_CALL_END(RL_CALL_VECTOR2_TRANSFORM);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_lerp(Vector2 v1, Vector2 v2, float amount) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_LERP);
+    Vector2 result = raylib_instrumented_target->vector2_lerp(v1, v2, amount);
+    RL_CALL_END(RL_CALL_VECTOR2_LERP);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_reflect(Vector2 v, Vector2 normal) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_REFLECT);
+    Vector2 result = raylib_instrumented_target->vector2_reflect(v, normal);
+    RL_CALL_END(RL_CALL_VECTOR2_REFLECT);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_min(Vector2 v1, Vector2 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_MIN);
+    Vector2 result = raylib_instrumented_target->vector2_min(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR2_MIN);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_max(Vector2 v1, Vector2 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_MAX);
+    Vector2 result = raylib_instrumented_target->vector2_max(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR2_MAX);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_rotate(Vector2 v, float angle) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_ROTATE);
+    Vector2 result = raylib_instrumented_target->vector2_rotate(v, angle);
+    RL_CALL_END(RL_CALL_VECTOR2_ROTATE);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_move_towards(Vector2 v, Vector2 target, float maxDistance) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_MOVE_TOWARDS);
+    Vector2 result = raylib_instrumented_target->vector2_move_towards(v, target, maxDistance);
+    RL_CALL_END(RL_CALL_VECTOR2_MOVE_TOWARDS);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_invert(Vector2 v) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_INVERT);
+    Vector2 result = raylib_instrumented_target->vector2_invert(v);
+    RL_CALL_END(RL_CALL_VECTOR2_INVERT);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_clamp(Vector2 v, Vector2 min, Vector2 max) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_CLAMP);
+    Vector2 result = raylib_instrumented_target->vector2_clamp(v, min, max);
+    RL_CALL_END(RL_CALL_VECTOR2_CLAMP);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_clamp_value(Vector2 v, float min, float max) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_CLAMP_VALUE);
+    Vector2 result = raylib_instrumented_target->vector2_clamp_value(v, min, max);
+    RL_CALL_END(RL_CALL_VECTOR2_CLAMP_VALUE);
+    return result;
+}
+
+static int rl_instrumented_vector2_equals(Vector2 p, Vector2 q) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_EQUALS);
+    int result = raylib_instrumented_target->vector2_equals(p, q);
+    RL_CALL_END(RL_CALL_VECTOR2_EQUALS);
+    return result;
+}
+
+static Vector2 rl_instrumented_vector2_refract(Vector2 v, Vector2 n, float r) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR2_REFRACT);
+    Vector2 result = raylib_instrumented_target->vector2_refract(v, n, r);
+    RL_CALL_END(RL_CALL_VECTOR2_REFRACT);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_zero(void) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_ZERO);
+    Vector3 result = raylib_instrumented_target->vector3_zero();
+    RL_CALL_END(RL_CALL_VECTOR3_ZERO);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_one(void) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_ONE);
+    Vector3 result = raylib_instrumented_target->vector3_one();
+    RL_CALL_END(RL_CALL_VECTOR3_ONE);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_add(Vector3 v1, Vector3 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_ADD);
+    Vector3 result = raylib_instrumented_target->vector3_add(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR3_ADD);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_add_value(Vector3 v, float add) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_ADD_VALUE);
+    Vector3 result = raylib_instrumented_target->vector3_add_value(v, add);
+    RL_CALL_END(RL_CALL_VECTOR3_ADD_VALUE);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_subtract(Vector3 v1, Vector3 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_SUBTRACT);
+    Vector3 result = raylib_instrumented_target->vector3_subtract(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR3_SUBTRACT);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_subtract_value(Vector3 v, float sub) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_SUBTRACT_VALUE);
+    Vector3 result = raylib_instrumented_target->vector3_subtract_value(v, sub);
+    RL_CALL_END(RL_CALL_VECTOR3_SUBTRACT_VALUE);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_scale(Vector3 v, float scalar) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_SCALE);
+    Vector3 result = raylib_instrumented_target->vector3_scale(v, scalar);
+    RL_CALL_END(RL_CALL_VECTOR3_SCALE);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_multiply(Vector3 v1, Vector3 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_MULTIPLY);
+    Vector3 result = raylib_instrumented_target->vector3_multiply(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR3_MULTIPLY);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_cross_product(Vector3 v1, Vector3 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_CROSS_PRODUCT);
+    Vector3 result = raylib_instrumented_target->vector3_cross_product(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR3_CROSS_PRODUCT);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_perpendicular(Vector3 v) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_PERPENDICULAR);
+    Vector3 result = raylib_instrumented_target->vector3_perpendicular(v);
+    RL_CALL_END(RL_CALL_VECTOR3_PERPENDICULAR);
+    return result;
+}
+
+static float rl_instrumented_vector3_length(const Vector3 v) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_LENGTH);
+    float result = raylib_instrumented_target->vector3_length(v);
+    RL_CALL_END(RL_CALL_VECTOR3_LENGTH);
+    return result;
+}
+
+static float rl_instrumented_vector3_length_sqr(const Vector3 v) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_LENGTH_SQR);
+    float result = raylib_instrumented_target->vector3_length_sqr(v);
+    RL_CALL_END(RL_CALL_VECTOR3_LENGTH_SQR);
+    return result;
+}
+
+static float rl_instrumented_vector3_dot_product(Vector3 v1, Vector3 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_DOT_PRODUCT);
+    float result = raylib_instrumented_target->vector3_dot_product(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR3_DOT_PRODUCT);
+    return result;
+}
+
+static float rl_instrumented_vector3_distance(Vector3 v1, Vector3 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_DISTANCE);
+    float result = raylib_instrumented_target->vector3_distance(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR3_DISTANCE);
+    return result;
+}
+
+static float rl_instrumented_vector3_distance_sqr(Vector3 v1, Vector3 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_DISTANCE_SQR);
+    float result = raylib_instrumented_target->vector3_distance_sqr(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR3_DISTANCE_SQR);
+    return result;
+}
+
+static float rl_instrumented_vector3_angle(Vector3 v1, Vector3 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_ANGLE);
+    float result = raylib_instrumented_target->vector3_angle(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR3_ANGLE);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_negate(Vector3 v) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_NEGATE);
+    Vector3 result = raylib_instrumented_target->vector3_negate(v);
+    RL_CALL_END(RL_CALL_VECTOR3_NEGATE);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_divide(Vector3 v1, Vector3 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_DIVIDE);
+    Vector3 result = raylib_instrumented_target->vector3_divide(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR3_DIVIDE);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_normalize(Vector3 v) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_NORMALIZE);
+    Vector3 result = raylib_instrumented_target->vector3_normalize(v);
+    RL_CALL_END(RL_CALL_VECTOR3_NORMALIZE);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_project(Vector3 v1, Vector3 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_PROJECT);
+    Vector3 result = raylib_instrumented_target->vector3_project(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR3_PROJECT);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_reject(Vector3 v1, Vector3 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_REJECT);
+    Vector3 result = raylib_instrumented_target->vector3_reject(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR3_REJECT);
+    return result;
+}
+
+static void rl_instrumented_vector3_ortho_normalize(Vector3 *v1, Vector3 *v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_ORTHO_NORMALIZE);
+    raylib_instrumented_target->vector3_ortho_normalize(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR3_ORTHO_NORMALIZE);
+}
+
+static Vector3 rl_instrumented_vector3_transform(Vector3 v, Matrix mat) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_TRANSFORM);
+    Vector3 result = raylib_instrumented_target->vector3_transform(v, mat);
+    RL_CALL_END(RL_CALL_VECTOR3_TRANSFORM);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_rotate_by_quaternion(Vector3 v, Quaternion q) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_ROTATE_BY_QUATERNION);
+    Vector3 result = raylib_instrumented_target->vector3_rotate_by_quaternion(v, q);
+    RL_CALL_END(RL_CALL_VECTOR3_ROTATE_BY_QUATERNION);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_rotate_by_axis_angle(Vector3 v, Vector3 axis, float angle) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_ROTATE_BY_AXIS_ANGLE);
+    Vector3 result = raylib_instrumented_target->vector3_rotate_by_axis_angle(v, axis, angle);
+    RL_CALL_END(RL_CALL_VECTOR3_ROTATE_BY_AXIS_ANGLE);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_move_towards(Vector3 v, Vector3 target, float maxDistance) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_MOVE_TOWARDS);
+    Vector3 result = raylib_instrumented_target->vector3_move_towards(v, target, maxDistance);
+    RL_CALL_END(RL_CALL_VECTOR3_MOVE_TOWARDS);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_lerp(Vector3 v1, Vector3 v2, float amount) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_LERP);
+    Vector3 result = raylib_instrumented_target->vector3_lerp(v1, v2, amount);
+    RL_CALL_END(RL_CALL_VECTOR3_LERP);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_cubic_hermite(Vector3 v1, Vector3 tangent1, Vector3 v2, Vector3 tangent2, float amount) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_CUBIC_HERMITE);
+    Vector3 result = raylib_instrumented_target->vector3_cubic_hermite(v1, tangent1, v2, tangent2, amount);
+    RL_CALL_END(RL_CALL_VECTOR3_CUBIC_HERMITE);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_reflect(Vector3 v, Vector3 normal) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_REFLECT);
+    Vector3 result = raylib_instrumented_target->vector3_reflect(v, normal);
+    RL_CALL_END(RL_CALL_VECTOR3_REFLECT);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_min(Vector3 v1, Vector3 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_MIN);
+    Vector3 result = raylib_instrumented_target->vector3_min(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR3_MIN);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_max(Vector3 v1, Vector3 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_MAX);
+    Vector3 result = raylib_instrumented_target->vector3_max(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR3_MAX);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_barycenter(Vector3 p, Vector3 a, Vector3 b, Vector3 c) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_BARYCENTER);
+    Vector3 result = raylib_instrumented_target->vector3_barycenter(p, a, b, c);
+    RL_CALL_END(RL_CALL_VECTOR3_BARYCENTER);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_unproject(Vector3 source, Matrix projection, Matrix view) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_UNPROJECT);
+    Vector3 result = raylib_instrumented_target->vector3_unproject(source, projection, view);
+    RL_CALL_END(RL_CALL_VECTOR3_UNPROJECT);
+    return result;
+}
+
+static float3 rl_instrumented_vector3_to_float_v(Vector3 v) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_TO_FLOAT_V);
+    float3 result = raylib_instrumented_target->vector3_to_float_v(v);
+    RL_CALL_END(RL_CALL_VECTOR3_TO_FLOAT_V);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_invert(Vector3 v) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_INVERT);
+    Vector3 result = raylib_instrumented_target->vector3_invert(v);
+    RL_CALL_END(RL_CALL_VECTOR3_INVERT);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_clamp(Vector3 v, Vector3 min, Vector3 max) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_CLAMP);
+    Vector3 result = raylib_instrumented_target->vector3_clamp(v, min, max);
+    RL_CALL_END(RL_CALL_VECTOR3_CLAMP);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_clamp_value(Vector3 v, float min, float max) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_CLAMP_VALUE);
+    Vector3 result = raylib_instrumented_target->vector3_clamp_value(v, min, max);
+    RL_CALL_END(RL_CALL_VECTOR3_CLAMP_VALUE);
+    return result;
+}
+
+static int rl_instrumented_vector3_equals(Vector3 p, Vector3 q) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_EQUALS);
+    int result = raylib_instrumented_target->vector3_equals(p, q);
+    RL_CALL_END(RL_CALL_VECTOR3_EQUALS);
+    return result;
+}
+
+static Vector3 rl_instrumented_vector3_refract(Vector3 v, Vector3 n, float r) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR3_REFRACT);
+    Vector3 result = raylib_instrumented_target->vector3_refract(v, n, r);
+    RL_CALL_END(RL_CALL_VECTOR3_REFRACT);
+    return result;
+}
+
+static Vector4 rl_instrumented_vector4_zero(void) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_ZERO);
+    Vector4 result = raylib_instrumented_target->vector4_zero();
+    RL_CALL_END(RL_CALL_VECTOR4_ZERO);
+    return result;
+}
+
+static Vector4 rl_instrumented_vector4_one(void) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_ONE);
+    Vector4 result = raylib_instrumented_target->vector4_one();
+    RL_CALL_END(RL_CALL_VECTOR4_ONE);
+    return result;
+}
+
+static Vector4 rl_instrumented_vector4_add(Vector4 v1, Vector4 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_ADD);
+    Vector4 result = raylib_instrumented_target->vector4_add(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR4_ADD);
+    return result;
+}
+
+static Vector4 rl_instrumented_vector4_add_value(Vector4 v, float add) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_ADD_VALUE);
+    Vector4 result = raylib_instrumented_target->vector4_add_value(v, add);
+    RL_CALL_END(RL_CALL_VECTOR4_ADD_VALUE);
+    return result;
+}
+
+static Vector4 rl_instrumented_vector4_subtract(Vector4 v1, Vector4 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_SUBTRACT);
+    Vector4 result = raylib_instrumented_target->vector4_subtract(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR4_SUBTRACT);
+    return result;
+}
+
+static Vector4 rl_instrumented_vector4_subtract_value(Vector4 v, float add) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_SUBTRACT_VALUE);
+    Vector4 result = raylib_instrumented_target->vector4_subtract_value(v, add);
+    RL_CALL_END(RL_CALL_VECTOR4_SUBTRACT_VALUE);
+    return result;
+}
+
+static float rl_instrumented_vector4_length(Vector4 v) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_LENGTH);
+    float result = raylib_instrumented_target->vector4_length(v);
+    RL_CALL_END(RL_CALL_VECTOR4_LENGTH);
+    return result;
+}
+
+static float rl_instrumented_vector4_length_sqr(Vector4 v) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_LENGTH_SQR);
+    float result = raylib_instrumented_target->vector4_length_sqr(v);
+    RL_CALL_END(RL_CALL_VECTOR4_LENGTH_SQR);
+    return result;
+}
+
+static float rl_instrumented_vector4_dot_product(Vector4 v1, Vector4 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_DOT_PRODUCT);
+    float result = raylib_instrumented_target->vector4_dot_product(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR4_DOT_PRODUCT);
+    return result;
+}
+
+static float rl_instrumented_vector4_distance(Vector4 v1, Vector4 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_DISTANCE);
+    float result = raylib_instrumented_target->vector4_distance(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR4_DISTANCE);
+    return result;
+}
+
+static float rl_instrumented_vector4_distance_sqr(Vector4 v1, Vector4 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_DISTANCE_SQR);
+    float result = raylib_instrumented_target->vector4_distance_sqr(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR4_DISTANCE_SQR);
+    return result;
+}
+
+static Vector4 rl_instrumented_vector4_scale(Vector4 v, float scale) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_SCALE);
+    Vector4 result = raylib_instrumented_target->vector4_scale(v, scale);
+    RL_CALL_END(RL_CALL_VECTOR4_SCALE);
+    return result;
+}
+
+static Vector4 rl_instrumented_vector4_multiply(Vector4 v1, Vector4 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_MULTIPLY);
+    Vector4 result = raylib_instrumented_target->vector4_multiply(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR4_MULTIPLY);
+    return result;
+}
+
+static Vector4 rl_instrumented_vector4_negate(Vector4 v) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_NEGATE);
+    Vector4 result = raylib_instrumented_target->vector4_negate(v);
+    RL_CALL_END(RL_CALL_VECTOR4_NEGATE);
+    return result;
+}
+
+static Vector4 rl_instrumented_vector4_divide(Vector4 v1, Vector4 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_DIVIDE);
+    Vector4 result = raylib_instrumented_target->vector4_divide(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR4_DIVIDE);
+    return result;
+}
+
+static Vector4 rl_instrumented_vector4_normalize(Vector4 v) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_NORMALIZE);
+    Vector4 result = raylib_instrumented_target->vector4_normalize(v);
+    RL_CALL_END(RL_CALL_VECTOR4_NORMALIZE);
+    return result;
+}
+
+static Vector4 rl_instrumented_vector4_min(Vector4 v1, Vector4 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_MIN);
+    Vector4 result = raylib_instrumented_target->vector4_min(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR4_MIN);
+    return result;
+}
+
+static Vector4 rl_instrumented_vector4_max(Vector4 v1, Vector4 v2) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_MAX);
+    Vector4 result = raylib_instrumented_target->vector4_max(v1, v2);
+    RL_CALL_END(RL_CALL_VECTOR4_MAX);
+    return result;
+}
+
+static Vector4 rl_instrumented_vector4_lerp(Vector4 v1, Vector4 v2, float amount) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_LERP);
+    Vector4 result = raylib_instrumented_target->vector4_lerp(v1, v2, amount);
+    RL_CALL_END(RL_CALL_VECTOR4_LERP);
+    return result;
+}
+
+static Vector4 rl_instrumented_vector4_move_towards(Vector4 v, Vector4 target, float maxDistance) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_MOVE_TOWARDS);
+    Vector4 result = raylib_instrumented_target->vector4_move_towards(v, target, maxDistance);
+    RL_CALL_END(RL_CALL_VECTOR4_MOVE_TOWARDS);
+    return result;
+}
+
+static Vector4 rl_instrumented_vector4_invert(Vector4 v) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_INVERT);
+    Vector4 result = raylib_instrumented_target->vector4_invert(v);
+    RL_CALL_END(RL_CALL_VECTOR4_INVERT);
+    return result;
+}
+
+static int rl_instrumented_vector4_equals(Vector4 p, Vector4 q) {
+    RL_CALL_BEGIN(RL_CALL_VECTOR4_EQUALS);
+    int result = raylib_instrumented_target->vector4_equals(p, q);
+    RL_CALL_END(RL_CALL_VECTOR4_EQUALS);
+    return result;
+}
+
+static float rl_instrumented_matrix_determinant(Matrix mat) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_DETERMINANT);
+    float result = raylib_instrumented_target->matrix_determinant(mat);
+    RL_CALL_END(RL_CALL_MATRIX_DETERMINANT);
+    return result;
+}
+
+static float rl_instrumented_matrix_trace(Matrix mat) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_TRACE);
+    float result = raylib_instrumented_target->matrix_trace(mat);
+    RL_CALL_END(RL_CALL_MATRIX_TRACE);
+    return result;
+}
+
+static Matrix rl_instrumented_matrix_transpose(Matrix mat) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_TRANSPOSE);
+    Matrix result = raylib_instrumented_target->matrix_transpose(mat);
+    RL_CALL_END(RL_CALL_MATRIX_TRANSPOSE);
+    return result;
+}
+
+static Matrix rl_instrumented_matrix_invert(Matrix mat) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_INVERT);
+    Matrix result = raylib_instrumented_target->matrix_invert(mat);
+    RL_CALL_END(RL_CALL_MATRIX_INVERT);
+    return result;
+}
+
+static Matrix rl_instrumented_matrix_identity(void) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_IDENTITY);
+    Matrix result = raylib_instrumented_target->matrix_identity();
+    RL_CALL_END(RL_CALL_MATRIX_IDENTITY);
+    return result;
+}
+
+static Matrix rl_instrumented_matrix_add(Matrix left, Matrix right) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_ADD);
+    Matrix result = raylib_instrumented_target->matrix_add(left, right);
+    RL_CALL_END(RL_CALL_MATRIX_ADD);
+    return result;
+}
+
+static Matrix rl_instrumented_matrix_subtract(Matrix left, Matrix right) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_SUBTRACT);
+    Matrix result = raylib_instrumented_target->matrix_subtract(left, right);
+    RL_CALL_END(RL_CALL_MATRIX_SUBTRACT);
+    return result;
+}
+
+static Matrix rl_instrumented_matrix_multiply(Matrix left, Matrix right) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_MULTIPLY);
+    Matrix result = raylib_instrumented_target->matrix_multiply(left, right);
+    RL_CALL_END(RL_CALL_MATRIX_MULTIPLY);
+    return result;
+}
+
+static Matrix rl_instrumented_matrix_translate(float x, float y, float z) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_TRANSLATE);
+    Matrix result = raylib_instrumented_target->matrix_translate(x, y, z);
+    RL_CALL_END(RL_CALL_MATRIX_TRANSLATE);
+    return result;
+}
+
+static Matrix rl_instrumented_matrix_rotate(Vector3 axis, float angle) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_ROTATE);
+    Matrix result = raylib_instrumented_target->matrix_rotate(axis, angle);
+    RL_CALL_END(RL_CALL_MATRIX_ROTATE);
+    return result;
+}
+
+static Matrix rl_instrumented_matrix_rotate_x(float angle) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_ROTATE_X);
+    Matrix result = raylib_instrumented_target->matrix_rotate_x(angle);
+    RL_CALL_END(RL_CALL_MATRIX_ROTATE_X);
+    return result;
+}
+
+static Matrix rl_instrumented_matrix_rotate_y(float angle) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_ROTATE_Y);
+    Matrix result = raylib_instrumented_target->matrix_rotate_y(angle);
+    RL_CALL_END(RL_CALL_MATRIX_ROTATE_Y);
+    return result;
+}
+
+static Matrix rl_instrumented_matrix_rotate_z(float angle) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_ROTATE_Z);
+    Matrix result = raylib_instrumented_target->matrix_rotate_z(angle);
+    RL_CALL_END(RL_CALL_MATRIX_ROTATE_Z);
+    return result;
+}
+
+static Matrix rl_instrumented_matrix_rotate_xyz(Vector3 angle) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_ROTATE_XYZ);
+    Matrix result = raylib_instrumented_target->matrix_rotate_xyz(angle);
+    RL_CALL_END(RL_CALL_MATRIX_ROTATE_XYZ);
+    return result;
+}
+
+static Matrix rl_instrumented_matrix_rotate_zyx(Vector3 angle) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_ROTATE_ZYX);
+    Matrix result = raylib_instrumented_target->matrix_rotate_zyx(angle);
+    RL_CALL_END(RL_CALL_MATRIX_ROTATE_ZYX);
+    return result;
+}
+
+static Matrix rl_instrumented_matrix_scale(float x, float y, float z) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_SCALE);
+    Matrix result = raylib_instrumented_target->matrix_scale(x, y, z);
+    RL_CALL_END(RL_CALL_MATRIX_SCALE);
+    return result;
+}
+
+static Matrix rl_instrumented_matrix_frustum(double left, double right, double bottom, double top, double nearPlane, double farPlane) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_FRUSTUM);
+    Matrix result = raylib_instrumented_target->matrix_frustum(left, right, bottom, top, nearPlane, farPlane);
+    RL_CALL_END(RL_CALL_MATRIX_FRUSTUM);
+    return result;
+}
+
+static Matrix rl_instrumented_matrix_perspective(double fovY, double aspect, double nearPlane, double farPlane) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_PERSPECTIVE);
+    Matrix result = raylib_instrumented_target->matrix_perspective(fovY, aspect, nearPlane, farPlane);
+    RL_CALL_END(RL_CALL_MATRIX_PERSPECTIVE);
+    return result;
+}
+
+static Matrix rl_instrumented_matrix_ortho(double left, double right, double bottom, double top, double nearPlane, double farPlane) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_ORTHO);
+    Matrix result = raylib_instrumented_target->matrix_ortho(left, right, bottom, top, nearPlane, farPlane);
+    RL_CALL_END(RL_CALL_MATRIX_ORTHO);
+    return result;
+}
+
+static Matrix rl_instrumented_matrix_look_at(Vector3 eye, Vector3 target, Vector3 up) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_LOOK_AT);
+    Matrix result = raylib_instrumented_target->matrix_look_at(eye, target, up);
+    RL_CALL_END(RL_CALL_MATRIX_LOOK_AT);
+    return result;
+}
+
+static float16 rl_instrumented_matrix_to_float_v(Matrix mat) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_TO_FLOAT_V);
+    float16 result = raylib_instrumented_target->matrix_to_float_v(mat);
+    RL_CALL_END(RL_CALL_MATRIX_TO_FLOAT_V);
+    return result;
+}
+
+static Quaternion rl_instrumented_quaternion_add(Quaternion q1, Quaternion q2) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_ADD);
+    Quaternion result = raylib_instrumented_target->quaternion_add(q1, q2);
+    RL_CALL_END(RL_CALL_QUATERNION_ADD);
+    return result;
+}
+
+static Quaternion rl_instrumented_quaternion_add_value(Quaternion q, float add) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_ADD_VALUE);
+    Quaternion result = raylib_instrumented_target->quaternion_add_value(q, add);
+    RL_CALL_END(RL_CALL_QUATERNION_ADD_VALUE);
+    return result;
+}
+
+static Quaternion rl_instrumented_quaternion_subtract(Quaternion q1, Quaternion q2) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_SUBTRACT);
+    Quaternion result = raylib_instrumented_target->quaternion_subtract(q1, q2);
+    RL_CALL_END(RL_CALL_QUATERNION_SUBTRACT);
+    return result;
+}
+
+static Quaternion rl_instrumented_quaternion_subtract_value(Quaternion q, float sub) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_SUBTRACT_VALUE);
+    Quaternion result = raylib_instrumented_target->quaternion_subtract_value(q, sub);
+    RL_CALL_END(RL_CALL_QUATERNION_SUBTRACT_VALUE);
+    return result;
+}
+
+static Quaternion rl_instrumented_quaternion_identity(void) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_IDENTITY);
+    Quaternion result = raylib_instrumented_target->quaternion_identity();
+    RL_CALL_END(RL_CALL_QUATERNION_IDENTITY);
+    return result;
+}
+
+static float rl_instrumented_quaternion_length(Quaternion q) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_LENGTH);
+    float result = raylib_instrumented_target->quaternion_length(q);
+    RL_CALL_END(RL_CALL_QUATERNION_LENGTH);
+    return result;
+}
+
+static Quaternion rl_instrumented_quaternion_normalize(Quaternion q) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_NORMALIZE);
+    Quaternion result = raylib_instrumented_target->quaternion_normalize(q);
+    RL_CALL_END(RL_CALL_QUATERNION_NORMALIZE);
+    return result;
+}
+
+static Quaternion rl_instrumented_quaternion_invert(Quaternion q) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_INVERT);
+    Quaternion result = raylib_instrumented_target->quaternion_invert(q);
+    RL_CALL_END(RL_CALL_QUATERNION_INVERT);
+    return result;
+}
+
+static Quaternion rl_instrumented_quaternion_multiply(Quaternion q1, Quaternion q2) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_MULTIPLY);
+    Quaternion result = raylib_instrumented_target->quaternion_multiply(q1, q2);
+    RL_CALL_END(RL_CALL_QUATERNION_MULTIPLY);
+    return result;
+}
+
+static Quaternion rl_instrumented_quaternion_scale(Quaternion q, float mul) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_SCALE);
+    Quaternion result = raylib_instrumented_target->quaternion_scale(q, mul);
+    RL_CALL_END(RL_CALL_QUATERNION_SCALE);
+    return result;
+}
+
+static Quaternion rl_instrumented_quaternion_divide(Quaternion q1, Quaternion q2) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_DIVIDE);
+    Quaternion result = raylib_instrumented_target->quaternion_divide(q1, q2);
+    RL_CALL_END(RL_CALL_QUATERNION_DIVIDE);
+    return result;
+}
+
+static Quaternion rl_instrumented_quaternion_lerp(Quaternion q1, Quaternion q2, float amount) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_LERP);
+    Quaternion result = raylib_instrumented_target->quaternion_lerp(q1, q2, amount);
+    RL_CALL_END(RL_CALL_QUATERNION_LERP);
+    return result;
+}
+
+static Quaternion rl_instrumented_quaternion_nlerp(Quaternion q1, Quaternion q2, float amount) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_NLERP);
+    Quaternion result = raylib_instrumented_target->quaternion_nlerp(q1, q2, amount);
+    RL_CALL_END(RL_CALL_QUATERNION_NLERP);
+    return result;
+}
+
+static Quaternion rl_instrumented_quaternion_slerp(Quaternion q1, Quaternion q2, float amount) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_SLERP);
+    Quaternion result = raylib_instrumented_target->quaternion_slerp(q1, q2, amount);
+    RL_CALL_END(RL_CALL_QUATERNION_SLERP);
+    return result;
+}
+
+static Quaternion rl_instrumented_quaternion_cubic_hermite_spline(Quaternion q1, Quaternion outTangent1, Quaternion q2, Quaternion inTangent2, float t) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_CUBIC_HERMITE_SPLINE);
+    Quaternion result = raylib_instrumented_target->quaternion_cubic_hermite_spline(q1, outTangent1, q2, inTangent2, t);
+    RL_CALL_END(RL_CALL_QUATERNION_CUBIC_HERMITE_SPLINE);
+    return result;
+}
+
+static Quaternion rl_instrumented_quaternion_from_vector3_to_vector3(Vector3 from, Vector3 to) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_FROM_VECTOR3_TO_VECTOR3);
+    Quaternion result = raylib_instrumented_target->quaternion_from_vector3_to_vector3(from, to);
+    RL_CALL_END(RL_CALL_QUATERNION_FROM_VECTOR3_TO_VECTOR3);
+    return result;
+}
+
+static Quaternion rl_instrumented_quaternion_from_matrix(Matrix mat) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_FROM_MATRIX);
+    Quaternion result = raylib_instrumented_target->quaternion_from_matrix(mat);
+    RL_CALL_END(RL_CALL_QUATERNION_FROM_MATRIX);
+    return result;
+}
+
+static Matrix rl_instrumented_quaternion_to_matrix(Quaternion q) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_TO_MATRIX);
+    Matrix result = raylib_instrumented_target->quaternion_to_matrix(q);
+    RL_CALL_END(RL_CALL_QUATERNION_TO_MATRIX);
+    return result;
+}
+
+static Quaternion rl_instrumented_quaternion_from_axis_angle(Vector3 axis, float angle) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_FROM_AXIS_ANGLE);
+    Quaternion result = raylib_instrumented_target->quaternion_from_axis_angle(axis, angle);
+    RL_CALL_END(RL_CALL_QUATERNION_FROM_AXIS_ANGLE);
+    return result;
+}
+
+static void rl_instrumented_quaternion_to_axis_angle(Quaternion q, Vector3 *outAxis, float *outAngle) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_TO_AXIS_ANGLE);
+    raylib_instrumented_target->quaternion_to_axis_angle(q, outAxis, outAngle);
+    RL_CALL_END(RL_CALL_QUATERNION_TO_AXIS_ANGLE);
+}
+
+static Quaternion rl_instrumented_quaternion_from_euler(float pitch, float yaw, float roll) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_FROM_EULER);
+    Quaternion result = raylib_instrumented_target->quaternion_from_euler(pitch, yaw, roll);
+    RL_CALL_END(RL_CALL_QUATERNION_FROM_EULER);
+    return result;
+}
+
+static Vector3 rl_instrumented_quaternion_to_euler(Quaternion q) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_TO_EULER);
+    Vector3 result = raylib_instrumented_target->quaternion_to_euler(q);
+    RL_CALL_END(RL_CALL_QUATERNION_TO_EULER);
+    return result;
+}
+
+static Quaternion rl_instrumented_quaternion_transform(Quaternion q, Matrix mat) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_TRANSFORM);
+    Quaternion result = raylib_instrumented_target->quaternion_transform(q, mat);
+    RL_CALL_END(RL_CALL_QUATERNION_TRANSFORM);
+    return result;
+}
+
+static int rl_instrumented_quaternion_equals(Quaternion p, Quaternion q) {
+    RL_CALL_BEGIN(RL_CALL_QUATERNION_EQUALS);
+    int result = raylib_instrumented_target->quaternion_equals(p, q);
+    RL_CALL_END(RL_CALL_QUATERNION_EQUALS);
+    return result;
+}
+
+static void rl_instrumented_matrix_decompose(Matrix mat, Vector3 *translation, Quaternion *rotation, Vector3 *scale) {
+    RL_CALL_BEGIN(RL_CALL_MATRIX_DECOMPOSE);
+    raylib_instrumented_target->matrix_decompose(mat, translation, rotation, scale);
+    RL_CALL_END(RL_CALL_MATRIX_DECOMPOSE);
+}
+
+static inline RaylibAPI* create_raylib_api_instrumented(RaylibAPI* target) {
+    static RaylibAPI api;
+    raylib_instrumented_target = target;
+    raylib_call_stats_init(raylib_call_names, RL_CALL_COUNT);
+
+    api = *target;
+    api.init_window = rl_instrumented_init_window;
+    api.close_window = rl_instrumented_close_window;
+    api.window_should_close = rl_instrumented_window_should_close;
+    api.is_window_ready = rl_instrumented_is_window_ready;
+    api.is_window_fullscreen = rl_instrumented_is_window_fullscreen;
+    api.is_window_hidden = rl_instrumented_is_window_hidden;
+    api.is_window_minimized = rl_instrumented_is_window_minimized;
+    api.is_window_maximized = rl_instrumented_is_window_maximized;
+    api.is_window_focused = rl_instrumented_is_window_focused;
+    api.is_window_resized = rl_instrumented_is_window_resized;
+    api.is_window_state = rl_instrumented_is_window_state;
+    api.set_window_state = rl_instrumented_set_window_state;
+    api.clear_window_state = rl_instrumented_clear_window_state;
+    api.toggle_fullscreen = rl_instrumented_toggle_fullscreen;
+    api.toggle_borderless_windowed = rl_instrumented_toggle_borderless_windowed;
+    api.maximize_window = rl_instrumented_maximize_window;
+    api.minimize_window = rl_instrumented_minimize_window;
+    api.restore_window = rl_instrumented_restore_window;
+    api.set_window_icon = rl_instrumented_set_window_icon;
+    api.set_window_icons = rl_instrumented_set_window_icons;
+    api.set_window_title = rl_instrumented_set_window_title;
+    api.set_window_position = rl_instrumented_set_window_position;
+    api.set_window_monitor = rl_instrumented_set_window_monitor;
+    api.set_window_min_size = rl_instrumented_set_window_min_size;
+    api.set_window_max_size = rl_instrumented_set_window_max_size;
+    api.set_window_size = rl_instrumented_set_window_size;
+    api.set_window_opacity = rl_instrumented_set_window_opacity;
+    api.set_window_focused = rl_instrumented_set_window_focused;
+    api.get_window_handle = rl_instrumented_get_window_handle;
+    api.get_screen_width = rl_instrumented_get_screen_width;
+    api.get_screen_height = rl_instrumented_get_screen_height;
+    api.get_render_width = rl_instrumented_get_render_width;
+    api.get_render_height = rl_instrumented_get_render_height;
+    api.get_monitor_count = rl_instrumented_get_monitor_count;
+    api.get_current_monitor = rl_instrumented_get_current_monitor;
+    api.get_monitor_position = rl_instrumented_get_monitor_position;
+    api.get_monitor_width = rl_instrumented_get_monitor_width;
+    api.get_monitor_height = rl_instrumented_get_monitor_height;
+    api.get_monitor_physical_width = rl_instrumented_get_monitor_physical_width;
+    api.get_monitor_physical_height = rl_instrumented_get_monitor_physical_height;
+    api.get_monitor_refresh_rate = rl_instrumented_get_monitor_refresh_rate;
+    api.get_window_position = rl_instrumented_get_window_position;
+    api.get_window_scale_dpi = rl_instrumented_get_window_scale_dpi;
+    api.get_monitor_name = rl_instrumented_get_monitor_name;
+    api.set_clipboard_text = rl_instrumented_set_clipboard_text;
+    api.get_clipboard_text = rl_instrumented_get_clipboard_text;
+    api.get_clipboard_image = rl_instrumented_get_clipboard_image;
+    api.enable_event_waiting = rl_instrumented_enable_event_waiting;
+    api.disable_event_waiting = rl_instrumented_disable_event_waiting;
+    api.show_cursor = rl_instrumented_show_cursor;
+    api.hide_cursor = rl_instrumented_hide_cursor;
+    api.is_cursor_hidden = rl_instrumented_is_cursor_hidden;
+    api.enable_cursor = rl_instrumented_enable_cursor;
+    api.disable_cursor = rl_instrumented_disable_cursor;
+    api.is_cursor_on_screen = rl_instrumented_is_cursor_on_screen;
+    api.clear_background = rl_instrumented_clear_background;
+    api.begin_drawing = rl_instrumented_begin_drawing;
+    api.end_drawing = rl_instrumented_end_drawing;
+    api.begin_mode2_d = rl_instrumented_begin_mode2_d;
+    api.end_mode2_d = rl_instrumented_end_mode2_d;
+    api.begin_mode3_d = rl_instrumented_begin_mode3_d;
+    api.end_mode3_d = rl_instrumented_end_mode3_d;
+    api.begin_texture_mode = rl_instrumented_begin_texture_mode;
+    api.end_texture_mode = rl_instrumented_end_texture_mode;
+    api.begin_shader_mode = rl_instrumented_begin_shader_mode;
+    api.end_shader_mode = rl_instrumented_end_shader_mode;
+    api.begin_blend_mode = rl_instrumented_begin_blend_mode;
+    api.end_blend_mode = rl_instrumented_end_blend_mode;
+    api.begin_scissor_mode = rl_instrumented_begin_scissor_mode;
+    api.end_scissor_mode = rl_instrumented_end_scissor_mode;
+    api.begin_vr_stereo_mode = rl_instrumented_begin_vr_stereo_mode;
+    api.end_vr_stereo_mode = rl_instrumented_end_vr_stereo_mode;
+    api.load_vr_stereo_config = rl_instrumented_load_vr_stereo_config;
+    api.unload_vr_stereo_config = rl_instrumented_unload_vr_stereo_config;
+    api.load_shader = rl_instrumented_load_shader;
+    api.load_shader_from_memory = rl_instrumented_load_shader_from_memory;
+    api.is_shader_valid = rl_instrumented_is_shader_valid;
+    api.get_shader_location = rl_instrumented_get_shader_location;
+    api.get_shader_location_attrib = rl_instrumented_get_shader_location_attrib;
+    api.set_shader_value = rl_instrumented_set_shader_value;
+    api.set_shader_value_v = rl_instrumented_set_shader_value_v;
+    api.set_shader_value_matrix = rl_instrumented_set_shader_value_matrix;
+    api.set_shader_value_texture = rl_instrumented_set_shader_value_texture;
+    api.unload_shader = rl_instrumented_unload_shader;
+    api.get_screen_to_world_ray = rl_instrumented_get_screen_to_world_ray;
+    api.get_screen_to_world_ray_ex = rl_instrumented_get_screen_to_world_ray_ex;
+    api.get_world_to_screen = rl_instrumented_get_world_to_screen;
+    api.get_world_to_screen_ex = rl_instrumented_get_world_to_screen_ex;
+    api.get_world_to_screen2_d = rl_instrumented_get_world_to_screen2_d;
+    api.get_screen_to_world2_d = rl_instrumented_get_screen_to_world2_d;
+    api.get_camera_matrix = rl_instrumented_get_camera_matrix;
+    api.get_camera_matrix2_d = rl_instrumented_get_camera_matrix2_d;
+    api.set_target_fps = rl_instrumented_set_target_fps;
+    api.get_frame_time = rl_instrumented_get_frame_time;
+    api.get_time = rl_instrumented_get_time;
+    api.get_fps = rl_instrumented_get_fps;
+    api.swap_screen_buffer = rl_instrumented_swap_screen_buffer;
+    api.poll_input_events = rl_instrumented_poll_input_events;
+    api.wait_time = rl_instrumented_wait_time;
+    api.set_random_seed = rl_instrumented_set_random_seed;
+    api.get_random_value = rl_instrumented_get_random_value;
+    api.load_random_sequence = rl_instrumented_load_random_sequence;
+    api.unload_random_sequence = rl_instrumented_unload_random_sequence;
+    api.take_screenshot = rl_instrumented_take_screenshot;
+    api.set_config_flags = rl_instrumented_set_config_flags;
+    api.open_url = rl_instrumented_open_url;
+    api.set_trace_log_level = rl_instrumented_set_trace_log_level;
+    api.mem_alloc = rl_instrumented_mem_alloc;
+    api.mem_realloc = rl_instrumented_mem_realloc;
+    api.mem_free = rl_instrumented_mem_free;
+    api.set_trace_log_callback = rl_instrumented_set_trace_log_callback;
+    api.set_load_file_data_callback = rl_instrumented_set_load_file_data_callback;
+    api.set_save_file_data_callback = rl_instrumented_set_save_file_data_callback;
+    api.set_load_file_text_callback = rl_instrumented_set_load_file_text_callback;
+    api.set_save_file_text_callback = rl_instrumented_set_save_file_text_callback;
+    api.load_file_data = rl_instrumented_load_file_data;
+    api.unload_file_data = rl_instrumented_unload_file_data;
+    api.save_file_data = rl_instrumented_save_file_data;
+    api.export_data_as_code = rl_instrumented_export_data_as_code;
+    api.load_file_text = rl_instrumented_load_file_text;
+    api.unload_file_text = rl_instrumented_unload_file_text;
+    api.save_file_text = rl_instrumented_save_file_text;
+    api.file_exists = rl_instrumented_file_exists;
+    api.directory_exists = rl_instrumented_directory_exists;
+    api.is_file_extension = rl_instrumented_is_file_extension;
+    api.get_file_length = rl_instrumented_get_file_length;
+    api.get_file_extension = rl_instrumented_get_file_extension;
+    api.get_file_name = rl_instrumented_get_file_name;
+    api.get_file_name_without_ext = rl_instrumented_get_file_name_without_ext;
+    api.get_directory_path = rl_instrumented_get_directory_path;
+    api.get_prev_directory_path = rl_instrumented_get_prev_directory_path;
+    api.get_working_directory = rl_instrumented_get_working_directory;
+    api.get_application_directory = rl_instrumented_get_application_directory;
+    api.make_directory = rl_instrumented_make_directory;
+    api.change_directory = rl_instrumented_change_directory;
+    api.is_path_file = rl_instrumented_is_path_file;
+    api.is_file_name_valid = rl_instrumented_is_file_name_valid;
+    api.load_directory_files = rl_instrumented_load_directory_files;
+    api.load_directory_files_ex = rl_instrumented_load_directory_files_ex;
+    api.unload_directory_files = rl_instrumented_unload_directory_files;
+    api.is_file_dropped = rl_instrumented_is_file_dropped;
+    api.load_dropped_files = rl_instrumented_load_dropped_files;
+    api.unload_dropped_files = rl_instrumented_unload_dropped_files;
+    api.get_file_mod_time = rl_instrumented_get_file_mod_time;
+    api.compress_data = rl_instrumented_compress_data;
+    api.decompress_data = rl_instrumented_decompress_data;
+    api.encode_data_base64 = rl_instrumented_encode_data_base64;
+    api.decode_data_base64 = rl_instrumented_decode_data_base64;
+    api.compute_crc32 = rl_instrumented_compute_crc32;
+    api.compute_md5 = rl_instrumented_compute_md5;
+    api.compute_sha1 = rl_instrumented_compute_sha1;
+    api.load_automation_event_list = rl_instrumented_load_automation_event_list;
+    api.unload_automation_event_list = rl_instrumented_unload_automation_event_list;
+    api.export_automation_event_list = rl_instrumented_export_automation_event_list;
+    api.set_automation_event_list = rl_instrumented_set_automation_event_list;
+    api.set_automation_event_base_frame = rl_instrumented_set_automation_event_base_frame;
+    api.start_automation_event_recording = rl_instrumented_start_automation_event_recording;
+    api.stop_automation_event_recording = rl_instrumented_stop_automation_event_recording;
+    api.play_automation_event = rl_instrumented_play_automation_event;
+    api.is_key_pressed = rl_instrumented_is_key_pressed;
+    api.is_key_pressed_repeat = rl_instrumented_is_key_pressed_repeat;
+    api.is_key_down = rl_instrumented_is_key_down;
+    api.is_key_released = rl_instrumented_is_key_released;
+    api.is_key_up = rl_instrumented_is_key_up;
+    api.get_key_pressed = rl_instrumented_get_key_pressed;
+    api.get_char_pressed = rl_instrumented_get_char_pressed;
+    api.set_exit_key = rl_instrumented_set_exit_key;
+    api.is_gamepad_available = rl_instrumented_is_gamepad_available;
+    api.get_gamepad_name = rl_instrumented_get_gamepad_name;
+    api.is_gamepad_button_pressed = rl_instrumented_is_gamepad_button_pressed;
+    api.is_gamepad_button_down = rl_instrumented_is_gamepad_button_down;
+    api.is_gamepad_button_released = rl_instrumented_is_gamepad_button_released;
+    api.is_gamepad_button_up = rl_instrumented_is_gamepad_button_up;
+    api.get_gamepad_button_pressed = rl_instrumented_get_gamepad_button_pressed;
+    api.get_gamepad_axis_count = rl_instrumented_get_gamepad_axis_count;
+    api.get_gamepad_axis_movement = rl_instrumented_get_gamepad_axis_movement;
+    api.set_gamepad_mappings = rl_instrumented_set_gamepad_mappings;
+    api.set_gamepad_vibration = rl_instrumented_set_gamepad_vibration;
+    api.is_mouse_button_pressed = rl_instrumented_is_mouse_button_pressed;
+    api.is_mouse_button_down = rl_instrumented_is_mouse_button_down;
+    api.is_mouse_button_released = rl_instrumented_is_mouse_button_released;
+    api.is_mouse_button_up = rl_instrumented_is_mouse_button_up;
+    api.get_mouse_x = rl_instrumented_get_mouse_x;
+    api.get_mouse_y = rl_instrumented_get_mouse_y;
+    api.get_mouse_position = rl_instrumented_get_mouse_position;
+    api.get_mouse_delta = rl_instrumented_get_mouse_delta;
+    api.set_mouse_position = rl_instrumented_set_mouse_position;
+    api.set_mouse_offset = rl_instrumented_set_mouse_offset;
+    api.set_mouse_scale = rl_instrumented_set_mouse_scale;
+    api.get_mouse_wheel_move = rl_instrumented_get_mouse_wheel_move;
+    api.get_mouse_wheel_move_v = rl_instrumented_get_mouse_wheel_move_v;
+    api.set_mouse_cursor = rl_instrumented_set_mouse_cursor;
+    api.get_touch_x = rl_instrumented_get_touch_x;
+    api.get_touch_y = rl_instrumented_get_touch_y;
+    api.get_touch_position = rl_instrumented_get_touch_position;
+    api.get_touch_point_id = rl_instrumented_get_touch_point_id;
+    api.get_touch_point_count = rl_instrumented_get_touch_point_count;
+    api.set_gestures_enabled = rl_instrumented_set_gestures_enabled;
+    api.is_gesture_detected = rl_instrumented_is_gesture_detected;
+    api.get_gesture_detected = rl_instrumented_get_gesture_detected;
+    api.get_gesture_hold_duration = rl_instrumented_get_gesture_hold_duration;
+    api.get_gesture_drag_vector = rl_instrumented_get_gesture_drag_vector;
+    api.get_gesture_drag_angle = rl_instrumented_get_gesture_drag_angle;
+    api.get_gesture_pinch_vector = rl_instrumented_get_gesture_pinch_vector;
+    api.get_gesture_pinch_angle = rl_instrumented_get_gesture_pinch_angle;
+    api.update_camera = rl_instrumented_update_camera;
+    api.update_camera_pro = rl_instrumented_update_camera_pro;
+    api.set_shapes_texture = rl_instrumented_set_shapes_texture;
+    api.get_shapes_texture = rl_instrumented_get_shapes_texture;
+    api.get_shapes_texture_rectangle = rl_instrumented_get_shapes_texture_rectangle;
+    api.draw_pixel = rl_instrumented_draw_pixel;
+    api.draw_pixel_v = rl_instrumented_draw_pixel_v;
+    api.draw_line = rl_instrumented_draw_line;
+    api.draw_line_v = rl_instrumented_draw_line_v;
+    api.draw_line_ex = rl_instrumented_draw_line_ex;
+    api.draw_line_strip = rl_instrumented_draw_line_strip;
+    api.draw_line_bezier = rl_instrumented_draw_line_bezier;
+    api.draw_circle = rl_instrumented_draw_circle;
+    api.draw_circle_sector = rl_instrumented_draw_circle_sector;
+    api.draw_circle_sector_lines = rl_instrumented_draw_circle_sector_lines;
+    api.draw_circle_gradient = rl_instrumented_draw_circle_gradient;
+    api.draw_circle_v = rl_instrumented_draw_circle_v;
+    api.draw_circle_lines = rl_instrumented_draw_circle_lines;
+    api.draw_circle_lines_v = rl_instrumented_draw_circle_lines_v;
+    api.draw_ellipse = rl_instrumented_draw_ellipse;
+    api.draw_ellipse_lines = rl_instrumented_draw_ellipse_lines;
+    api.draw_ring = rl_instrumented_draw_ring;
+    api.draw_ring_lines = rl_instrumented_draw_ring_lines;
+    api.draw_rectangle = rl_instrumented_draw_rectangle;
+    api.draw_rectangle_v = rl_instrumented_draw_rectangle_v;
+    api.draw_rectangle_rec = rl_instrumented_draw_rectangle_rec;
+    api.draw_rectangle_pro = rl_instrumented_draw_rectangle_pro;
+    api.draw_rectangle_gradient_v = rl_instrumented_draw_rectangle_gradient_v;
+    api.draw_rectangle_gradient_h = rl_instrumented_draw_rectangle_gradient_h;
+    api.draw_rectangle_gradient_ex = rl_instrumented_draw_rectangle_gradient_ex;
+    api.draw_rectangle_lines = rl_instrumented_draw_rectangle_lines;
+    api.draw_rectangle_lines_ex = rl_instrumented_draw_rectangle_lines_ex;
+    api.draw_rectangle_rounded = rl_instrumented_draw_rectangle_rounded;
+    api.draw_rectangle_rounded_lines = rl_instrumented_draw_rectangle_rounded_lines;
+    api.draw_rectangle_rounded_lines_ex = rl_instrumented_draw_rectangle_rounded_lines_ex;
+    api.draw_triangle = rl_instrumented_draw_triangle;
+    api.draw_triangle_lines = rl_instrumented_draw_triangle_lines;
+    api.draw_triangle_fan = rl_instrumented_draw_triangle_fan;
+    api.draw_triangle_strip = rl_instrumented_draw_triangle_strip;
+    api.draw_poly = rl_instrumented_draw_poly;
+    api.draw_poly_lines = rl_instrumented_draw_poly_lines;
+    api.draw_poly_lines_ex = rl_instrumented_draw_poly_lines_ex;
+    api.draw_spline_linear = rl_instrumented_draw_spline_linear;
+    api.draw_spline_basis = rl_instrumented_draw_spline_basis;
+    api.draw_spline_catmull_rom = rl_instrumented_draw_spline_catmull_rom;
+    api.draw_spline_bezier_quadratic = rl_instrumented_draw_spline_bezier_quadratic;
+    api.draw_spline_bezier_cubic = rl_instrumented_draw_spline_bezier_cubic;
+    api.draw_spline_segment_linear = rl_instrumented_draw_spline_segment_linear;
+    api.draw_spline_segment_basis = rl_instrumented_draw_spline_segment_basis;
+    api.draw_spline_segment_catmull_rom = rl_instrumented_draw_spline_segment_catmull_rom;
+    api.draw_spline_segment_bezier_quadratic = rl_instrumented_draw_spline_segment_bezier_quadratic;
+    api.draw_spline_segment_bezier_cubic = rl_instrumented_draw_spline_segment_bezier_cubic;
+    api.get_spline_point_linear = rl_instrumented_get_spline_point_linear;
+    api.get_spline_point_basis = rl_instrumented_get_spline_point_basis;
+    api.get_spline_point_catmull_rom = rl_instrumented_get_spline_point_catmull_rom;
+    api.get_spline_point_bezier_quad = rl_instrumented_get_spline_point_bezier_quad;
+    api.get_spline_point_bezier_cubic = rl_instrumented_get_spline_point_bezier_cubic;
+    api.check_collision_recs = rl_instrumented_check_collision_recs;
+    api.check_collision_circles = rl_instrumented_check_collision_circles;
+    api.check_collision_circle_rec = rl_instrumented_check_collision_circle_rec;
+    api.check_collision_circle_line = rl_instrumented_check_collision_circle_line;
+    api.check_collision_point_rec = rl_instrumented_check_collision_point_rec;
+    api.check_collision_point_circle = rl_instrumented_check_collision_point_circle;
+    api.check_collision_point_triangle = rl_instrumented_check_collision_point_triangle;
+    api.check_collision_point_line = rl_instrumented_check_collision_point_line;
+    api.check_collision_point_poly = rl_instrumented_check_collision_point_poly;
+    api.check_collision_lines = rl_instrumented_check_collision_lines;
+    api.get_collision_rec = rl_instrumented_get_collision_rec;
+    api.load_image = rl_instrumented_load_image;
+    api.load_image_raw = rl_instrumented_load_image_raw;
+    api.load_image_anim = rl_instrumented_load_image_anim;
+    api.load_image_anim_from_memory = rl_instrumented_load_image_anim_from_memory;
+    api.load_image_from_memory = rl_instrumented_load_image_from_memory;
+    api.load_image_from_texture = rl_instrumented_load_image_from_texture;
+    api.load_image_from_screen = rl_instrumented_load_image_from_screen;
+    api.is_image_valid = rl_instrumented_is_image_valid;
+    api.unload_image = rl_instrumented_unload_image;
+    api.export_image = rl_instrumented_export_image;
+    api.export_image_to_memory = rl_instrumented_export_image_to_memory;
+    api.export_image_as_code = rl_instrumented_export_image_as_code;
+    api.gen_image_color = rl_instrumented_gen_image_color;
+    api.gen_image_gradient_linear = rl_instrumented_gen_image_gradient_linear;
+    api.gen_image_gradient_radial = rl_instrumented_gen_image_gradient_radial;
+    api.gen_image_gradient_square = rl_instrumented_gen_image_gradient_square;
+    api.gen_image_checked = rl_instrumented_gen_image_checked;
+    api.gen_image_white_noise = rl_instrumented_gen_image_white_noise;
+    api.gen_image_perlin_noise = rl_instrumented_gen_image_perlin_noise;
+    api.gen_image_cellular = rl_instrumented_gen_image_cellular;
+    api.gen_image_text = rl_instrumented_gen_image_text;
+    api.image_copy = rl_instrumented_image_copy;
+    api.image_from_image = rl_instrumented_image_from_image;
+    api.image_from_channel = rl_instrumented_image_from_channel;
+    api.image_text = rl_instrumented_image_text;
+    api.image_text_ex = rl_instrumented_image_text_ex;
+    api.image_format = rl_instrumented_image_format;
+    api.image_to_pot = rl_instrumented_image_to_pot;
+    api.image_crop = rl_instrumented_image_crop;
+    api.image_alpha_crop = rl_instrumented_image_alpha_crop;
+    api.image_alpha_clear = rl_instrumented_image_alpha_clear;
+    api.image_alpha_mask = rl_instrumented_image_alpha_mask;
+    api.image_alpha_premultiply = rl_instrumented_image_alpha_premultiply;
+    api.image_blur_gaussian = rl_instrumented_image_blur_gaussian;
+    api.image_kernel_convolution = rl_instrumented_image_kernel_convolution;
+    api.image_resize = rl_instrumented_image_resize;
+    api.image_resize_nn = rl_instrumented_image_resize_nn;
+    api.image_resize_canvas = rl_instrumented_image_resize_canvas;
+    api.image_mipmaps = rl_instrumented_image_mipmaps;
+    api.image_dither = rl_instrumented_image_dither;
+    api.image_flip_vertical = rl_instrumented_image_flip_vertical;
+    api.image_flip_horizontal = rl_instrumented_image_flip_horizontal;
+    api.image_rotate = rl_instrumented_image_rotate;
+    api.image_rotate_cw = rl_instrumented_image_rotate_cw;
+    api.image_rotate_ccw = rl_instrumented_image_rotate_ccw;
+    api.image_color_tint = rl_instrumented_image_color_tint;
+    api.image_color_invert = rl_instrumented_image_color_invert;
+    api.image_color_grayscale = rl_instrumented_image_color_grayscale;
+    api.image_color_contrast = rl_instrumented_image_color_contrast;
+    api.image_color_brightness = rl_instrumented_image_color_brightness;
+    api.image_color_replace = rl_instrumented_image_color_replace;
+    api.load_image_colors = rl_instrumented_load_image_colors;
+    api.load_image_palette = rl_instrumented_load_image_palette;
+    api.unload_image_colors = rl_instrumented_unload_image_colors;
+    api.unload_image_palette = rl_instrumented_unload_image_palette;
+    api.get_image_alpha_border = rl_instrumented_get_image_alpha_border;
+    api.get_image_color = rl_instrumented_get_image_color;
+    api.image_clear_background = rl_instrumented_image_clear_background;
+    api.image_draw_pixel = rl_instrumented_image_draw_pixel;
+    api.image_draw_pixel_v = rl_instrumented_image_draw_pixel_v;
+    api.image_draw_line = rl_instrumented_image_draw_line;
+    api.image_draw_line_v = rl_instrumented_image_draw_line_v;
+    api.image_draw_line_ex = rl_instrumented_image_draw_line_ex;
+    api.image_draw_circle = rl_instrumented_image_draw_circle;
+    api.image_draw_circle_v = rl_instrumented_image_draw_circle_v;
+    api.image_draw_circle_lines = rl_instrumented_image_draw_circle_lines;
+    api.image_draw_circle_lines_v = rl_instrumented_image_draw_circle_lines_v;
+    api.image_draw_rectangle = rl_instrumented_image_draw_rectangle;
+    api.image_draw_rectangle_v = rl_instrumented_image_draw_rectangle_v;
+    api.image_draw_rectangle_rec = rl_instrumented_image_draw_rectangle_rec;
+    api.image_draw_rectangle_lines = rl_instrumented_image_draw_rectangle_lines;
+    api.image_draw_triangle = rl_instrumented_image_draw_triangle;
+    api.image_draw_triangle_ex = rl_instrumented_image_draw_triangle_ex;
+    api.image_draw_triangle_lines = rl_instrumented_image_draw_triangle_lines;
+    api.image_draw_triangle_fan = rl_instrumented_image_draw_triangle_fan;
+    api.image_draw_triangle_strip = rl_instrumented_image_draw_triangle_strip;
+    api.image_draw = rl_instrumented_image_draw;
+    api.image_draw_text = rl_instrumented_image_draw_text;
+    api.image_draw_text_ex = rl_instrumented_image_draw_text_ex;
+    api.load_texture = rl_instrumented_load_texture;
+    api.load_texture_from_image = rl_instrumented_load_texture_from_image;
+    api.load_texture_cubemap = rl_instrumented_load_texture_cubemap;
+    api.load_render_texture = rl_instrumented_load_render_texture;
+    api.is_texture_valid = rl_instrumented_is_texture_valid;
+    api.unload_texture = rl_instrumented_unload_texture;
+    api.is_render_texture_valid = rl_instrumented_is_render_texture_valid;
+    api.unload_render_texture = rl_instrumented_unload_render_texture;
+    api.update_texture = rl_instrumented_update_texture;
+    api.update_texture_rec = rl_instrumented_update_texture_rec;
+    api.gen_texture_mipmaps = rl_instrumented_gen_texture_mipmaps;
+    api.set_texture_filter = rl_instrumented_set_texture_filter;
+    api.set_texture_wrap = rl_instrumented_set_texture_wrap;
+    api.draw_texture = rl_instrumented_draw_texture;
+    api.draw_texture_v = rl_instrumented_draw_texture_v;
+    api.draw_texture_ex = rl_instrumented_draw_texture_ex;
+    api.draw_texture_rec = rl_instrumented_draw_texture_rec;
+    api.draw_texture_pro = rl_instrumented_draw_texture_pro;
+    api.draw_texture_n_patch = rl_instrumented_draw_texture_n_patch;
+    api.color_is_equal = rl_instrumented_color_is_equal;
+    api.fade = rl_instrumented_fade;
+    api.color_to_int = rl_instrumented_color_to_int;
+    api.color_normalize = rl_instrumented_color_normalize;
+    api.color_from_normalized = rl_instrumented_color_from_normalized;
+    api.color_to_hsv = rl_instrumented_color_to_hsv;
+    api.color_from_hsv = rl_instrumented_color_from_hsv;
+    api.color_tint = rl_instrumented_color_tint;
+    api.color_brightness = rl_instrumented_color_brightness;
+    api.color_contrast = rl_instrumented_color_contrast;
+    api.color_alpha = rl_instrumented_color_alpha;
+    api.color_alpha_blend = rl_instrumented_color_alpha_blend;
+    api.color_lerp = rl_instrumented_color_lerp;
+    api.get_color = rl_instrumented_get_color;
+    api.get_pixel_color = rl_instrumented_get_pixel_color;
+    api.set_pixel_color = rl_instrumented_set_pixel_color;
+    api.get_pixel_data_size = rl_instrumented_get_pixel_data_size;
+    api.get_font_default = rl_instrumented_get_font_default;
+    api.load_font = rl_instrumented_load_font;
+    api.load_font_ex = rl_instrumented_load_font_ex;
+    api.load_font_from_image = rl_instrumented_load_font_from_image;
+    api.load_font_from_memory = rl_instrumented_load_font_from_memory;
+    api.is_font_valid = rl_instrumented_is_font_valid;
+    api.load_font_data = rl_instrumented_load_font_data;
+    api.gen_image_font_atlas = rl_instrumented_gen_image_font_atlas;
+    api.unload_font_data = rl_instrumented_unload_font_data;
+    api.unload_font = rl_instrumented_unload_font;
+    api.export_font_as_code = rl_instrumented_export_font_as_code;
+    api.draw_fps = rl_instrumented_draw_fps;
+    api.draw_text = rl_instrumented_draw_text;
+    api.draw_text_ex = rl_instrumented_draw_text_ex;
+    api.draw_text_pro = rl_instrumented_draw_text_pro;
+    api.draw_text_codepoint = rl_instrumented_draw_text_codepoint;
+    api.draw_text_codepoints = rl_instrumented_draw_text_codepoints;
+    api.set_text_line_spacing = rl_instrumented_set_text_line_spacing;
+    api.measure_text = rl_instrumented_measure_text;
+    api.measure_text_ex = rl_instrumented_measure_text_ex;
+    api.get_glyph_index = rl_instrumented_get_glyph_index;
+    api.get_glyph_info = rl_instrumented_get_glyph_info;
+    api.get_glyph_atlas_rec = rl_instrumented_get_glyph_atlas_rec;
+    api.load_utf8 = rl_instrumented_load_utf8;
+    api.unload_utf8 = rl_instrumented_unload_utf8;
+    api.load_codepoints = rl_instrumented_load_codepoints;
+    api.unload_codepoints = rl_instrumented_unload_codepoints;
+    api.get_codepoint_count = rl_instrumented_get_codepoint_count;
+    api.get_codepoint = rl_instrumented_get_codepoint;
+    api.get_codepoint_next = rl_instrumented_get_codepoint_next;
+    api.get_codepoint_previous = rl_instrumented_get_codepoint_previous;
+    api.codepoint_to_utf8 = rl_instrumented_codepoint_to_utf8;
+    api.text_copy = rl_instrumented_text_copy;
+    api.text_is_equal = rl_instrumented_text_is_equal;
+    api.text_length = rl_instrumented_text_length;
+    api.text_subtext = rl_instrumented_text_subtext;
+    api.text_replace = rl_instrumented_text_replace;
+    api.text_insert = rl_instrumented_text_insert;
+    api.text_join = rl_instrumented_text_join;
+    api.text_split = rl_instrumented_text_split;
+    api.text_append = rl_instrumented_text_append;
+    api.text_find_index = rl_instrumented_text_find_index;
+    api.text_to_upper = rl_instrumented_text_to_upper;
+    api.text_to_lower = rl_instrumented_text_to_lower;
+    api.text_to_pascal = rl_instrumented_text_to_pascal;
+    api.text_to_snake = rl_instrumented_text_to_snake;
+    api.text_to_camel = rl_instrumented_text_to_camel;
+    api.text_to_integer = rl_instrumented_text_to_integer;
+    api.text_to_float = rl_instrumented_text_to_float;
+    api.draw_line3_d = rl_instrumented_draw_line3_d;
+    api.draw_point3_d = rl_instrumented_draw_point3_d;
+    api.draw_circle3_d = rl_instrumented_draw_circle3_d;
+    api.draw_triangle3_d = rl_instrumented_draw_triangle3_d;
+    api.draw_triangle_strip3_d = rl_instrumented_draw_triangle_strip3_d;
+    api.draw_cube = rl_instrumented_draw_cube;
+    api.draw_cube_v = rl_instrumented_draw_cube_v;
+    api.draw_cube_wires = rl_instrumented_draw_cube_wires;
+    api.draw_cube_wires_v = rl_instrumented_draw_cube_wires_v;
+    api.draw_sphere = rl_instrumented_draw_sphere;
+    api.draw_sphere_ex = rl_instrumented_draw_sphere_ex;
+    api.draw_sphere_wires = rl_instrumented_draw_sphere_wires;
+    api.draw_cylinder = rl_instrumented_draw_cylinder;
+    api.draw_cylinder_ex = rl_instrumented_draw_cylinder_ex;
+    api.draw_cylinder_wires = rl_instrumented_draw_cylinder_wires;
+    api.draw_cylinder_wires_ex = rl_instrumented_draw_cylinder_wires_ex;
+    api.draw_capsule = rl_instrumented_draw_capsule;
+    api.draw_capsule_wires = rl_instrumented_draw_capsule_wires;
+    api.draw_plane = rl_instrumented_draw_plane;
+    api.draw_ray = rl_instrumented_draw_ray;
+    api.draw_grid = rl_instrumented_draw_grid;
+    api.load_model = rl_instrumented_load_model;
+    api.load_model_from_mesh = rl_instrumented_load_model_from_mesh;
+    api.is_model_valid = rl_instrumented_is_model_valid;
+    api.unload_model = rl_instrumented_unload_model;
+    api.get_model_bounding_box = rl_instrumented_get_model_bounding_box;
+    api.draw_model = rl_instrumented_draw_model;
+    api.draw_model_ex = rl_instrumented_draw_model_ex;
+    api.draw_model_wires = rl_instrumented_draw_model_wires;
+    api.draw_model_wires_ex = rl_instrumented_draw_model_wires_ex;
+    api.draw_model_points = rl_instrumented_draw_model_points;
+    api.draw_model_points_ex = rl_instrumented_draw_model_points_ex;
+    api.draw_bounding_box = rl_instrumented_draw_bounding_box;
+    api.draw_billboard = rl_instrumented_draw_billboard;
+    api.draw_billboard_rec = rl_instrumented_draw_billboard_rec;
+    api.draw_billboard_pro = rl_instrumented_draw_billboard_pro;
+    api.upload_mesh = rl_instrumented_upload_mesh;
+    api.update_mesh_buffer = rl_instrumented_update_mesh_buffer;
+    api.unload_mesh = rl_instrumented_unload_mesh;
+    api.draw_mesh = rl_instrumented_draw_mesh;
+    api.draw_mesh_instanced = rl_instrumented_draw_mesh_instanced;
+    api.get_mesh_bounding_box = rl_instrumented_get_mesh_bounding_box;
+    api.gen_mesh_tangents = rl_instrumented_gen_mesh_tangents;
+    api.export_mesh = rl_instrumented_export_mesh;
+    api.export_mesh_as_code = rl_instrumented_export_mesh_as_code;
+    api.gen_mesh_poly = rl_instrumented_gen_mesh_poly;
+    api.gen_mesh_plane = rl_instrumented_gen_mesh_plane;
+    api.gen_mesh_cube = rl_instrumented_gen_mesh_cube;
+    api.gen_mesh_sphere = rl_instrumented_gen_mesh_sphere;
+    api.gen_mesh_hemi_sphere = rl_instrumented_gen_mesh_hemi_sphere;
+    api.gen_mesh_cylinder = rl_instrumented_gen_mesh_cylinder;
+    api.gen_mesh_cone = rl_instrumented_gen_mesh_cone;
+    api.gen_mesh_torus = rl_instrumented_gen_mesh_torus;
+    api.gen_mesh_knot = rl_instrumented_gen_mesh_knot;
+    api.gen_mesh_heightmap = rl_instrumented_gen_mesh_heightmap;
+    api.gen_mesh_cubicmap = rl_instrumented_gen_mesh_cubicmap;
+    api.load_materials = rl_instrumented_load_materials;
+    api.load_material_default = rl_instrumented_load_material_default;
+    api.is_material_valid = rl_instrumented_is_material_valid;
+    api.unload_material = rl_instrumented_unload_material;
+    api.set_material_texture = rl_instrumented_set_material_texture;
+    api.set_model_mesh_material = rl_instrumented_set_model_mesh_material;
+    api.load_model_animations = rl_instrumented_load_model_animations;
+    api.update_model_animation = rl_instrumented_update_model_animation;
+    api.update_model_animation_bones = rl_instrumented_update_model_animation_bones;
+    api.unload_model_animation = rl_instrumented_unload_model_animation;
+    api.unload_model_animations = rl_instrumented_unload_model_animations;
+    api.is_model_animation_valid = rl_instrumented_is_model_animation_valid;
+    api.check_collision_spheres = rl_instrumented_check_collision_spheres;
+    api.check_collision_boxes = rl_instrumented_check_collision_boxes;
+    api.check_collision_box_sphere = rl_instrumented_check_collision_box_sphere;
+    api.get_ray_collision_sphere = rl_instrumented_get_ray_collision_sphere;
+    api.get_ray_collision_box = rl_instrumented_get_ray_collision_box;
+    api.get_ray_collision_mesh = rl_instrumented_get_ray_collision_mesh;
+    api.get_ray_collision_triangle = rl_instrumented_get_ray_collision_triangle;
+    api.get_ray_collision_quad = rl_instrumented_get_ray_collision_quad;
+    api.init_audio_device = rl_instrumented_init_audio_device;
+    api.close_audio_device = rl_instrumented_close_audio_device;
+    api.is_audio_device_ready = rl_instrumented_is_audio_device_ready;
+    api.set_master_volume = rl_instrumented_set_master_volume;
+    api.get_master_volume = rl_instrumented_get_master_volume;
+    api.load_wave = rl_instrumented_load_wave;
+    api.load_wave_from_memory = rl_instrumented_load_wave_from_memory;
+    api.is_wave_valid = rl_instrumented_is_wave_valid;
+    api.load_sound = rl_instrumented_load_sound;
+    api.load_sound_from_wave = rl_instrumented_load_sound_from_wave;
+    api.load_sound_alias = rl_instrumented_load_sound_alias;
+    api.is_sound_valid = rl_instrumented_is_sound_valid;
+    api.update_sound = rl_instrumented_update_sound;
+    api.unload_wave = rl_instrumented_unload_wave;
+    api.unload_sound = rl_instrumented_unload_sound;
+    api.unload_sound_alias = rl_instrumented_unload_sound_alias;
+    api.export_wave = rl_instrumented_export_wave;
+    api.export_wave_as_code = rl_instrumented_export_wave_as_code;
+    api.play_sound = rl_instrumented_play_sound;
+    api.stop_sound = rl_instrumented_stop_sound;
+    api.pause_sound = rl_instrumented_pause_sound;
+    api.resume_sound = rl_instrumented_resume_sound;
+    api.is_sound_playing = rl_instrumented_is_sound_playing;
+    api.set_sound_volume = rl_instrumented_set_sound_volume;
+    api.set_sound_pitch = rl_instrumented_set_sound_pitch;
+    api.set_sound_pan = rl_instrumented_set_sound_pan;
+    api.wave_copy = rl_instrumented_wave_copy;
+    api.wave_crop = rl_instrumented_wave_crop;
+    api.wave_format = rl_instrumented_wave_format;
+    api.load_wave_samples = rl_instrumented_load_wave_samples;
+    api.unload_wave_samples = rl_instrumented_unload_wave_samples;
+    api.load_music_stream = rl_instrumented_load_music_stream;
+    api.load_music_stream_from_memory = rl_instrumented_load_music_stream_from_memory;
+    api.is_music_valid = rl_instrumented_is_music_valid;
+    api.unload_music_stream = rl_instrumented_unload_music_stream;
+    api.play_music_stream = rl_instrumented_play_music_stream;
+    api.is_music_stream_playing = rl_instrumented_is_music_stream_playing;
+    api.update_music_stream = rl_instrumented_update_music_stream;
+    api.stop_music_stream = rl_instrumented_stop_music_stream;
+    api.pause_music_stream = rl_instrumented_pause_music_stream;
+    api.resume_music_stream = rl_instrumented_resume_music_stream;
+    api.seek_music_stream = rl_instrumented_seek_music_stream;
+    api.set_music_volume = rl_instrumented_set_music_volume;
+    api.set_music_pitch = rl_instrumented_set_music_pitch;
+    api.set_music_pan = rl_instrumented_set_music_pan;
+    api.get_music_time_length = rl_instrumented_get_music_time_length;
+    api.get_music_time_played = rl_instrumented_get_music_time_played;
+    api.load_audio_stream = rl_instrumented_load_audio_stream;
+    api.is_audio_stream_valid = rl_instrumented_is_audio_stream_valid;
+    api.unload_audio_stream = rl_instrumented_unload_audio_stream;
+    api.update_audio_stream = rl_instrumented_update_audio_stream;
+    api.is_audio_stream_processed = rl_instrumented_is_audio_stream_processed;
+    api.play_audio_stream = rl_instrumented_play_audio_stream;
+    api.pause_audio_stream = rl_instrumented_pause_audio_stream;
+    api.resume_audio_stream = rl_instrumented_resume_audio_stream;
+    api.is_audio_stream_playing = rl_instrumented_is_audio_stream_playing;
+    api.stop_audio_stream = rl_instrumented_stop_audio_stream;
+    api.set_audio_stream_volume = rl_instrumented_set_audio_stream_volume;
+    api.set_audio_stream_pitch = rl_instrumented_set_audio_stream_pitch;
+    api.set_audio_stream_pan = rl_instrumented_set_audio_stream_pan;
+    api.set_audio_stream_buffer_size_default = rl_instrumented_set_audio_stream_buffer_size_default;
+    api.set_audio_stream_callback = rl_instrumented_set_audio_stream_callback;
+    api.attach_audio_stream_processor = rl_instrumented_attach_audio_stream_processor;
+    api.detach_audio_stream_processor = rl_instrumented_detach_audio_stream_processor;
+    api.attach_audio_mixed_processor = rl_instrumented_attach_audio_mixed_processor;
+    api.detach_audio_mixed_processor = rl_instrumented_detach_audio_mixed_processor;
+    api.clamp = rl_instrumented_clamp;
+    api.lerp = rl_instrumented_lerp;
+    api.normalize = rl_instrumented_normalize;
+    api.remap = rl_instrumented_remap;
+    api.wrap = rl_instrumented_wrap;
+    api.float_equals = rl_instrumented_float_equals;
+    api.vector2_zero = rl_instrumented_vector2_zero;
+    api.vector2_one = rl_instrumented_vector2_one;
+    api.vector2_add = rl_instrumented_vector2_add;
+    api.vector2_add_value = rl_instrumented_vector2_add_value;
+    api.vector2_subtract = rl_instrumented_vector2_subtract;
+    api.vector2_subtract_value = rl_instrumented_vector2_subtract_value;
+    api.vector2_length = rl_instrumented_vector2_length;
+    api.vector2_length_sqr = rl_instrumented_vector2_length_sqr;
+    api.vector2_dot_product = rl_instrumented_vector2_dot_product;
+    api.vector2_distance = rl_instrumented_vector2_distance;
+    api.vector2_distance_sqr = rl_instrumented_vector2_distance_sqr;
+    api.vector2_angle = rl_instrumented_vector2_angle;
+    api.vector2_line_angle = rl_instrumented_vector2_line_angle;
+    api.vector2_scale = rl_instrumented_vector2_scale;
+    api.vector2_multiply = rl_instrumented_vector2_multiply;
+    api.vector2_negate = rl_instrumented_vector2_negate;
+    api.vector2_divide = rl_instrumented_vector2_divide;
+    api.vector2_normalize = rl_instrumented_vector2_normalize;
+    api.vector2_transform = rl_instrumented_vector2_transform;
+    api.vector2_lerp = rl_instrumented_vector2_lerp;
+    api.vector2_reflect = rl_instrumented_vector2_reflect;
+    api.vector2_min = rl_instrumented_vector2_min;
+    api.vector2_max = rl_instrumented_vector2_max;
+    api.vector2_rotate = rl_instrumented_vector2_rotate;
+    api.vector2_move_towards = rl_instrumented_vector2_move_towards;
+    api.vector2_invert = rl_instrumented_vector2_invert;
+    api.vector2_clamp = rl_instrumented_vector2_clamp;
+    api.vector2_clamp_value = rl_instrumented_vector2_clamp_value;
+    api.vector2_equals = rl_instrumented_vector2_equals;
+    api.vector2_refract = rl_instrumented_vector2_refract;
+    api.vector3_zero = rl_instrumented_vector3_zero;
+    api.vector3_one = rl_instrumented_vector3_one;
+    api.vector3_add = rl_instrumented_vector3_add;
+    api.vector3_add_value = rl_instrumented_vector3_add_value;
+    api.vector3_subtract = rl_instrumented_vector3_subtract;
+    api.vector3_subtract_value = rl_instrumented_vector3_subtract_value;
+    api.vector3_scale = rl_instrumented_vector3_scale;
+    api.vector3_multiply = rl_instrumented_vector3_multiply;
+    api.vector3_cross_product = rl_instrumented_vector3_cross_product;
+    api.vector3_perpendicular = rl_instrumented_vector3_perpendicular;
+    api.vector3_length = rl_instrumented_vector3_length;
+    api.vector3_length_sqr = rl_instrumented_vector3_length_sqr;
+    api.vector3_dot_product = rl_instrumented_vector3_dot_product;
+    api.vector3_distance = rl_instrumented_vector3_distance;
+    api.vector3_distance_sqr = rl_instrumented_vector3_distance_sqr;
+    api.vector3_angle = rl_instrumented_vector3_angle;
+    api.vector3_negate = rl_instrumented_vector3_negate;
+    api.vector3_divide = rl_instrumented_vector3_divide;
+    api.vector3_normalize = rl_instrumented_vector3_normalize;
+    api.vector3_project = rl_instrumented_vector3_project;
+    api.vector3_reject = rl_instrumented_vector3_reject;
+    api.vector3_ortho_normalize = rl_instrumented_vector3_ortho_normalize;
+    api.vector3_transform = rl_instrumented_vector3_transform;
+    api.vector3_rotate_by_quaternion = rl_instrumented_vector3_rotate_by_quaternion;
+    api.vector3_rotate_by_axis_angle = rl_instrumented_vector3_rotate_by_axis_angle;
+    api.vector3_move_towards = rl_instrumented_vector3_move_towards;
+    api.vector3_lerp = rl_instrumented_vector3_lerp;
+    api.vector3_cubic_hermite = rl_instrumented_vector3_cubic_hermite;
+    api.vector3_reflect = rl_instrumented_vector3_reflect;
+    api.vector3_min = rl_instrumented_vector3_min;
+    api.vector3_max = rl_instrumented_vector3_max;
+    api.vector3_barycenter = rl_instrumented_vector3_barycenter;
+    api.vector3_unproject = rl_instrumented_vector3_unproject;
+    api.vector3_to_float_v = rl_instrumented_vector3_to_float_v;
+    api.vector3_invert = rl_instrumented_vector3_invert;
+    api.vector3_clamp = rl_instrumented_vector3_clamp;
+    api.vector3_clamp_value = rl_instrumented_vector3_clamp_value;
+    api.vector3_equals = rl_instrumented_vector3_equals;
+    api.vector3_refract = rl_instrumented_vector3_refract;
+    api.vector4_zero = rl_instrumented_vector4_zero;
+    api.vector4_one = rl_instrumented_vector4_one;
+    api.vector4_add = rl_instrumented_vector4_add;
+    api.vector4_add_value = rl_instrumented_vector4_add_value;
+    api.vector4_subtract = rl_instrumented_vector4_subtract;
+    api.vector4_subtract_value = rl_instrumented_vector4_subtract_value;
+    api.vector4_length = rl_instrumented_vector4_length;
+    api.vector4_length_sqr = rl_instrumented_vector4_length_sqr;
+    api.vector4_dot_product = rl_instrumented_vector4_dot_product;
+    api.vector4_distance = rl_instrumented_vector4_distance;
+    api.vector4_distance_sqr = rl_instrumented_vector4_distance_sqr;
+    api.vector4_scale = rl_instrumented_vector4_scale;
+    api.vector4_multiply = rl_instrumented_vector4_multiply;
+    api.vector4_negate = rl_instrumented_vector4_negate;
+    api.vector4_divide = rl_instrumented_vector4_divide;
+    api.vector4_normalize = rl_instrumented_vector4_normalize;
+    api.vector4_min = rl_instrumented_vector4_min;
+    api.vector4_max = rl_instrumented_vector4_max;
+    api.vector4_lerp = rl_instrumented_vector4_lerp;
+    api.vector4_move_towards = rl_instrumented_vector4_move_towards;
+    api.vector4_invert = rl_instrumented_vector4_invert;
+    api.vector4_equals = rl_instrumented_vector4_equals;
+    api.matrix_determinant = rl_instrumented_matrix_determinant;
+    api.matrix_trace = rl_instrumented_matrix_trace;
+    api.matrix_transpose = rl_instrumented_matrix_transpose;
+    api.matrix_invert = rl_instrumented_matrix_invert;
+    api.matrix_identity = rl_instrumented_matrix_identity;
+    api.matrix_add = rl_instrumented_matrix_add;
+    api.matrix_subtract = rl_instrumented_matrix_subtract;
+    api.matrix_multiply = rl_instrumented_matrix_multiply;
+    api.matrix_translate = rl_instrumented_matrix_translate;
+    api.matrix_rotate = rl_instrumented_matrix_rotate;
+    api.matrix_rotate_x = rl_instrumented_matrix_rotate_x;
+    api.matrix_rotate_y = rl_instrumented_matrix_rotate_y;
+    api.matrix_rotate_z = rl_instrumented_matrix_rotate_z;
+    api.matrix_rotate_xyz = rl_instrumented_matrix_rotate_xyz;
+    api.matrix_rotate_zyx = rl_instrumented_matrix_rotate_zyx;
+    api.matrix_scale = rl_instrumented_matrix_scale;
+    api.matrix_frustum = rl_instrumented_matrix_frustum;
+    api.matrix_perspective = rl_instrumented_matrix_perspective;
+    api.matrix_ortho = rl_instrumented_matrix_ortho;
+    api.matrix_look_at = rl_instrumented_matrix_look_at;
+    api.matrix_to_float_v = rl_instrumented_matrix_to_float_v;
+    api.quaternion_add = rl_instrumented_quaternion_add;
+    api.quaternion_add_value = rl_instrumented_quaternion_add_value;
+    api.quaternion_subtract = rl_instrumented_quaternion_subtract;
+    api.quaternion_subtract_value = rl_instrumented_quaternion_subtract_value;
+    api.quaternion_identity = rl_instrumented_quaternion_identity;
+    api.quaternion_length = rl_instrumented_quaternion_length;
+    api.quaternion_normalize = rl_instrumented_quaternion_normalize;
+    api.quaternion_invert = rl_instrumented_quaternion_invert;
+    api.quaternion_multiply = rl_instrumented_quaternion_multiply;
+    api.quaternion_scale = rl_instrumented_quaternion_scale;
+    api.quaternion_divide = rl_instrumented_quaternion_divide;
+    api.quaternion_lerp = rl_instrumented_quaternion_lerp;
+    api.quaternion_nlerp = rl_instrumented_quaternion_nlerp;
+    api.quaternion_slerp = rl_instrumented_quaternion_slerp;
+    api.quaternion_cubic_hermite_spline = rl_instrumented_quaternion_cubic_hermite_spline;
+    api.quaternion_from_vector3_to_vector3 = rl_instrumented_quaternion_from_vector3_to_vector3;
+    api.quaternion_from_matrix = rl_instrumented_quaternion_from_matrix;
+    api.quaternion_to_matrix = rl_instrumented_quaternion_to_matrix;
+    api.quaternion_from_axis_angle = rl_instrumented_quaternion_from_axis_angle;
+    api.quaternion_to_axis_angle = rl_instrumented_quaternion_to_axis_angle;
+    api.quaternion_from_euler = rl_instrumented_quaternion_from_euler;
+    api.quaternion_to_euler = rl_instrumented_quaternion_to_euler;
+    api.quaternion_transform = rl_instrumented_quaternion_transform;
+    api.quaternion_equals = rl_instrumented_quaternion_equals;
+    api.matrix_decompose = rl_instrumented_matrix_decompose;
+    return &api;
+}
+
+#endif // RAYLIB_API_INSTRUMENTED_GEN_H
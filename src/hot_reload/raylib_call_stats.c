@@ -0,0 +1,187 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "raylib_call_stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <time.h>
+#endif
+
+RaylibCallStats raylib_call_stats = {0};
+
+uint64_t raylib_call_stats_now_ns(void) {
+#ifdef _WIN32
+    static LARGE_INTEGER frequency = {0};
+    LARGE_INTEGER counter;
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+void raylib_call_stats_init(const char** names, int count) {
+    RaylibCallStats* stats = &raylib_call_stats;
+
+    if (stats->count != count) {
+        free(stats->frame_calls);
+
+        // One block for all counters, split in six arrays of `count` entries
+        uint64_t* block = calloc((size_t)count * 6, sizeof(uint64_t));
+        if (!block) {
+            printf("[RAYLIB_CALLS] Failed to allocate call counters\n");
+            exit(1);
+        }
+
+        stats->frame_calls = block;
+        stats->frame_ns = block + count;
+        stats->last_frame_calls = block + count * 2;
+        stats->last_frame_ns = block + count * 3;
+        stats->total_calls = block + count * 4;
+        stats->total_ns = block + count * 5;
+        stats->count = count;
+    }
+
+    stats->names = names;
+
+    const char* timing = getenv("HOT_RELOAD_CALL_TIMING");
+    stats->timing = !timing || strcmp(timing, "0") != 0;
+
+    raylib_call_stats_reset();
+}
+
+void raylib_call_stats_reset(void) {
+    RaylibCallStats* stats = &raylib_call_stats;
+    if (stats->frame_calls) {
+        memset(stats->frame_calls, 0, (size_t)stats->count * 6 * sizeof(uint64_t));
+    }
+    stats->frames = 0;
+}
+
+void raylib_call_stats_frame_end(void) {
+    RaylibCallStats* stats = &raylib_call_stats;
+
+    for (int i = 0; i < stats->count; i++) {
+        stats->last_frame_calls[i] = stats->frame_calls[i];
+        stats->last_frame_ns[i] = stats->frame_ns[i];
+        stats->total_calls[i] += stats->frame_calls[i];
+        stats->total_ns[i] += stats->frame_ns[i];
+    }
+
+    memset(stats->frame_calls, 0, (size_t)stats->count * sizeof(uint64_t));
+    memset(stats->frame_ns, 0, (size_t)stats->count * sizeof(uint64_t));
+    stats->frames++;
+}
+
+// qsort has no user data argument, so the sort key is passed through here
+static const uint64_t* sort_key = NULL;
+
+static int compare_by_key_desc(const void* a, const void* b) {
+    uint64_t ka = sort_key[*(const int*)a];
+    uint64_t kb = sort_key[*(const int*)b];
+    return (ka < kb) - (ka > kb);
+}
+
+static int sorted_by(const uint64_t* key, int* order) {
+    int used = 0;
+    for (int i = 0; i < raylib_call_stats.count; i++) {
+        if (key[i] > 0) {
+            order[used++] = i;
+        }
+    }
+
+    sort_key = key;
+    qsort(order, used, sizeof(int), compare_by_key_desc);
+    return used;
+}
+
+void raylib_call_stats_print_top(int n) {
+    RaylibCallStats* stats = &raylib_call_stats;
+    if (!stats->count) return;
+
+    int* order = malloc((size_t)stats->count * sizeof(int));
+    if (!order) return;
+
+    uint64_t calls = 0;
+    uint64_t ns = 0;
+    for (int i = 0; i < stats->count; i++) {
+        calls += stats->last_frame_calls[i];
+        ns += stats->last_frame_ns[i];
+    }
+
+    printf("[RAYLIB_CALLS] Frame %llu: %llu calls", (unsigned long long)stats->frames, (unsigned long long)calls);
+    if (stats->timing) {
+        printf(", %.3f ms inside raylib", ns / 1e6);
+    }
+    printf("\n");
+
+    int used = sorted_by(stats->last_frame_calls, order);
+    for (int i = 0; i < used && i < n; i++) {
+        int id = order[i];
+        printf("[RAYLIB_CALLS]   %-28s %6llu calls", stats->names[id], (unsigned long long)stats->last_frame_calls[id]);
+        if (stats->timing) {
+            printf(" %9.3f us", stats->last_frame_ns[id] / 1e3);
+        }
+        printf("\n");
+    }
+
+    if (stats->timing) {
+        printf("[RAYLIB_CALLS] Top by time over %llu frames:\n", (unsigned long long)stats->frames);
+        used = sorted_by(stats->total_ns, order);
+        for (int i = 0; i < used && i < n; i++) {
+            int id = order[i];
+            printf("[RAYLIB_CALLS]   %-28s %9.3f us/frame\n", stats->names[id],
+                   stats->total_ns[id] / 1e3 / (double)(stats->frames ? stats->frames : 1));
+        }
+    }
+
+    free(order);
+}
+
+bool raylib_call_stats_write_csv(const char* path) {
+    RaylibCallStats* stats = &raylib_call_stats;
+
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        printf("[RAYLIB_CALLS] Failed to open %s\n", path);
+        return false;
+    }
+
+    int* order = malloc((size_t)stats->count * sizeof(int));
+    if (!order) {
+        fclose(file);
+        return false;
+    }
+
+    double frames = (double)(stats->frames ? stats->frames : 1);
+
+    fprintf(file, "function,calls,calls_per_frame,total_ns,ns_per_frame,ns_per_call,last_frame_calls,last_frame_ns\n");
+    int used = sorted_by(stats->total_calls, order);
+    for (int i = 0; i < used; i++) {
+        int id = order[i];
+        fprintf(file, "%s,%llu,%.2f,%llu,%.1f,%.1f,%llu,%llu\n",
+                stats->names[id],
+                (unsigned long long)stats->total_calls[id],
+                stats->total_calls[id] / frames,
+                (unsigned long long)stats->total_ns[id],
+                stats->total_ns[id] / frames,
+                stats->total_ns[id] / (double)stats->total_calls[id],
+                (unsigned long long)stats->last_frame_calls[id],
+                (unsigned long long)stats->last_frame_ns[id]);
+    }
+
+    free(order);
+    fclose(file);
+
+    printf("[RAYLIB_CALLS] Wrote %d functions over %llu frames to %s\n", used, (unsigned long long)stats->frames, path);
+    return true;
+}
@@ -0,0 +1,42 @@
+#ifndef HOT_RELOAD_RAYLIB_CALL_STATS_H
+#define HOT_RELOAD_RAYLIB_CALL_STATS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Per-function call counters filled by the instrumented RaylibAPI table
+// (raylib_api_instrumented.gen.h). All arrays are indexed by call id.
+typedef struct {
+    const char** names;
+    int count;
+    bool timing;
+    uint64_t frames;
+    uint64_t* frame_calls;
+    uint64_t* frame_ns;
+    uint64_t* last_frame_calls;
+    uint64_t* last_frame_ns;
+    uint64_t* total_calls;
+    uint64_t* total_ns;
+} RaylibCallStats;
+
+extern RaylibCallStats raylib_call_stats;
+
+void raylib_call_stats_init(const char** names, int count);
+void raylib_call_stats_reset(void);
+void raylib_call_stats_frame_end(void);
+void raylib_call_stats_print_top(int n);
+bool raylib_call_stats_write_csv(const char* path);
+uint64_t raylib_call_stats_now_ns(void);
+
+#define RL_CALL_BEGIN(id) \
+    uint64_t rl_call_start = raylib_call_stats.timing ? raylib_call_stats_now_ns() : 0
+
+#define RL_CALL_END(id) \
+    do { \
+        raylib_call_stats.frame_calls[id]++; \
+        if (raylib_call_stats.timing) { \
+            raylib_call_stats.frame_ns[id] += raylib_call_stats_now_ns() - rl_call_start; \
+        } \
+    } while (0)
+
+#endif // HOT_RELOAD_RAYLIB_CALL_STATS_H
@@ -0,0 +1,249 @@
+#include "raylib_capture.h"
+#include "raylib_trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CAPTURE_FILE_BUFFER_SIZE (1 << 20)
+
+// Resource ids already described in the trace. GL reuses ids after an unload,
+// so they are forgotten again when the game unloads them.
+typedef struct {
+    unsigned int* ids;
+    int count;
+    int capacity;
+} CaptureIdSet;
+
+typedef struct {
+    FILE* file;
+    char* file_buffer;
+    unsigned char* payload;
+    size_t payload_size;
+    size_t payload_capacity;
+    int call_id;
+    // The payload of the current call couldn't grow, it's incomplete
+    bool payload_failed;
+    CaptureIdSet textures;
+    CaptureIdSet render_textures;
+    unsigned long long calls;
+    unsigned long long unsupported_calls;
+    unsigned long long textures_read_back;
+} RaylibCapture;
+
+static RaylibCapture capture = {0};
+
+static bool id_set_contains(CaptureIdSet* set, unsigned int id) {
+    for (int i = 0; i < set->count; i++) {
+        if (set->ids[i] == id) return true;
+    }
+    return false;
+}
+
+static void id_set_add(CaptureIdSet* set, unsigned int id) {
+    if (id_set_contains(set, id)) return;
+
+    if (set->count >= set->capacity) {
+        int capacity = set->capacity ? set->capacity * 2 : 64;
+        unsigned int* ids = realloc(set->ids, capacity * sizeof(unsigned int));
+        if (!ids) return;
+        set->ids = ids;
+        set->capacity = capacity;
+    }
+    set->ids[set->count++] = id;
+}
+
+static void id_set_remove(CaptureIdSet* set, unsigned int id) {
+    for (int i = 0; i < set->count; i++) {
+        if (set->ids[i] == id) {
+            set->ids[i] = set->ids[--set->count];
+            return;
+        }
+    }
+}
+
+static void write_u8(unsigned char value) { fwrite(&value, 1, 1, capture.file); }
+static void write_u16(uint16_t value) { fwrite(&value, sizeof(value), 1, capture.file); }
+static void write_u32(uint32_t value) { fwrite(&value, sizeof(value), 1, capture.file); }
+static void write_i32(int32_t value) { fwrite(&value, sizeof(value), 1, capture.file); }
+
+bool raylib_capture_start(const char* path, const char** call_names, int call_count) {
+    if (capture.file) return true;
+
+    capture.file = fopen(path, "wb");
+    if (!capture.file) {
+        printf("[RAYLIB_CAPTURE] Failed to open %s\n", path);
+        return false;
+    }
+
+    capture.file_buffer = malloc(CAPTURE_FILE_BUFFER_SIZE);
+    if (capture.file_buffer) {
+        setvbuf(capture.file, capture.file_buffer, _IOFBF, CAPTURE_FILE_BUFFER_SIZE);
+    }
+
+    fwrite(RL_TRACE_MAGIC, 1, sizeof(RL_TRACE_MAGIC), capture.file);
+    write_u32(RL_TRACE_VERSION);
+    write_i32(GetScreenWidth());
+    write_i32(GetScreenHeight());
+    write_u32((uint32_t)call_count);
+    for (int i = 0; i < call_count; i++) {
+        uint16_t length = (uint16_t)strlen(call_names[i]);
+        write_u16(length);
+        fwrite(call_names[i], 1, length, capture.file);
+    }
+
+    capture.textures.count = 0;
+    capture.render_textures.count = 0;
+    capture.calls = 0;
+    capture.unsupported_calls = 0;
+    capture.textures_read_back = 0;
+
+    printf("[RAYLIB_CAPTURE] Capturing raylib calls to %s\n", path);
+    return true;
+}
+
+void raylib_capture_stop(void) {
+    if (!capture.file) return;
+
+    long size = ftell(capture.file);
+    fclose(capture.file);
+    capture.file = NULL;
+    free(capture.file_buffer);
+    capture.file_buffer = NULL;
+
+    printf("[RAYLIB_CAPTURE] Captured %llu calls (%llu unsupported), %llu textures, %.2f MB\n",
+           capture.calls, capture.unsupported_calls, capture.textures_read_back, size / (1024.0 * 1024.0));
+}
+
+bool raylib_capture_active(void) {
+    return capture.file != NULL;
+}
+
+void rl_capture_begin(int call_id) {
+    capture.call_id = call_id;
+    capture.payload_size = 0;
+    capture.payload_failed = false;
+}
+
+void rl_capture_value(const void* value, size_t size) {
+    if (capture.payload_size + size > capture.payload_capacity) {
+        size_t capacity = capture.payload_capacity ? capture.payload_capacity : 256;
+        while (capacity < capture.payload_size + size) capacity *= 2;
+
+        unsigned char* payload = realloc(capture.payload, capacity);
+        if (!payload) {
+            capture.payload_failed = true;
+            return;
+        }
+        capture.payload = payload;
+        capture.payload_capacity = capacity;
+    }
+
+    memcpy(capture.payload + capture.payload_size, value, size);
+    capture.payload_size += size;
+}
+
+void rl_capture_string(const char* text) {
+    uint32_t length = text ? (uint32_t)strlen(text) + 1 : RL_TRACE_NULL_STRING;
+    rl_capture_value(&length, sizeof(length));
+    if (text) {
+        rl_capture_value(text, length);
+    }
+}
+
+// A texture the trace hasn't seen yet (e.g. loaded before the capture started)
+// is read back from the GPU, so the replayer can recreate it.
+void rl_capture_texture(Texture2D texture) {
+    if (capture.file && texture.id != 0 && !id_set_contains(&capture.textures, texture.id)) {
+        id_set_add(&capture.textures, texture.id);
+
+        Image image = LoadImageFromTexture(texture);
+        uint32_t pixel_bytes = 0;
+        if (image.data) {
+            ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            pixel_bytes = (uint32_t)(image.width * image.height * 4);
+        }
+
+        write_u8(RL_TRACE_TEXTURE);
+        fwrite(&texture, sizeof(texture), 1, capture.file);
+        write_u32(pixel_bytes);
+        if (pixel_bytes) {
+            fwrite(image.data, 1, pixel_bytes, capture.file);
+        }
+
+        UnloadImage(image);
+        capture.textures_read_back++;
+    }
+
+    rl_capture_value(&texture, sizeof(texture));
+}
+
+void rl_capture_render_texture(RenderTexture2D target) {
+    if (capture.file && target.id != 0 && !id_set_contains(&capture.render_textures, target.id)) {
+        id_set_add(&capture.render_textures, target.id);
+        id_set_add(&capture.textures, target.texture.id);
+
+        write_u8(RL_TRACE_RENDER_TEXTURE);
+        fwrite(&target, sizeof(target), 1, capture.file);
+    }
+
+    rl_capture_value(&target, sizeof(target));
+}
+
+// Shaders can't be read back, only the ones loaded while capturing are replayed
+void rl_capture_shader(Shader shader) {
+    rl_capture_value(&shader, sizeof(shader));
+}
+
+void rl_capture_result_texture(Texture2D texture) {
+    id_set_add(&capture.textures, texture.id);
+    rl_capture_value(&texture, sizeof(texture));
+}
+
+void rl_capture_result_render_texture(RenderTexture2D target) {
+    id_set_add(&capture.render_textures, target.id);
+    id_set_add(&capture.textures, target.texture.id);
+    rl_capture_value(&target, sizeof(target));
+}
+
+void rl_capture_result_shader(Shader shader) {
+    rl_capture_value(&shader, sizeof(shader));
+}
+
+void rl_capture_forget_texture(Texture2D texture) {
+    id_set_remove(&capture.textures, texture.id);
+}
+
+void rl_capture_forget_render_texture(RenderTexture2D target) {
+    id_set_remove(&capture.render_textures, target.id);
+    id_set_remove(&capture.textures, target.texture.id);
+}
+
+void rl_capture_forget_shader(Shader shader) {
+    (void)shader;
+}
+
+void rl_capture_unsupported(int call_id) {
+    if (!capture.file) return;
+
+    write_u8(RL_TRACE_UNSUPPORTED);
+    write_u16((uint16_t)call_id);
+    capture.unsupported_calls++;
+}
+
+// A call that couldn't be recorded whole ends the capture, so the trace
+// stops at the last complete record instead of replaying garbage
+void rl_capture_end(void) {
+    if (!capture.file) return;
+
+    if (capture.payload_failed) {
+        printf("[RAYLIB_CAPTURE] Out of memory recording call %d, stopping the capture\n", capture.call_id);
+        raylib_capture_stop();
+        return;
+    }
+
+    write_u8(RL_TRACE_CALL);
+    write_u16((uint16_t)capture.call_id);
+    write_u32((uint32_t)capture.payload_size);
+    fwrite(capture.payload, 1, capture.payload_size, capture.file);
+    capture.calls++;
+}
@@ -0,0 +1,30 @@
+#ifndef HOT_RELOAD_RAYLIB_CAPTURE_H
+#define HOT_RELOAD_RAYLIB_CAPTURE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "raylib.h"
+
+// Records the calls going through the capture RaylibAPI table
+// (raylib_api_capture.gen.h) into a trace file, see raylib_trace.h.
+bool raylib_capture_start(const char* path, const char** call_names, int call_count);
+void raylib_capture_stop(void);
+bool raylib_capture_active(void);
+
+// Used by raylib_api_capture.gen.h
+void rl_capture_begin(int call_id);
+void rl_capture_value(const void* value, size_t size);
+void rl_capture_string(const char* text);
+void rl_capture_texture(Texture2D texture);
+void rl_capture_render_texture(RenderTexture2D target);
+void rl_capture_shader(Shader shader);
+void rl_capture_result_texture(Texture2D texture);
+void rl_capture_result_render_texture(RenderTexture2D target);
+void rl_capture_result_shader(Shader shader);
+void rl_capture_forget_texture(Texture2D texture);
+void rl_capture_forget_render_texture(RenderTexture2D target);
+void rl_capture_forget_shader(Shader shader);
+void rl_capture_unsupported(int call_id);
+void rl_capture_end(void);
+
+#endif // HOT_RELOAD_RAYLIB_CAPTURE_H
@@ -0,0 +1,2877 @@
+#ifndef RAYLIB_REPLAY_GEN_H
+#define RAYLIB_REPLAY_GEN_H
+
+// DO NOT EDIT THIS FILE, CHANGES WILL BE LOST
+// Auto-generated by generate_raylib_api.py from raylib.h
+// Timestamp: 2026-10-19 10:29:30
+//
+// Decodes a captured call (see raylib_capture.h) and issues it against raylib.
+// Used by the standalone replayer, tools/raylib_replay.c, which defines the
+// rl_replay_* readers.
+
+#include "raylib.h"
+#include "raymath.h"
+#include "raylib_api_calls.gen.h"
+#include "raylib_trace.h"
+
+// Returns false when the call is not replayed (unsupported or skipped)
+static bool rl_replay_call(int call_id, RlTraceReader* reader) {
+    switch (call_id) {
+        case RL_CALL_WINDOW_SHOULD_CLOSE: {
+            (void)WindowShouldClose();
+        } return true;
+        case RL_CALL_IS_WINDOW_READY: {
+            (void)IsWindowReady();
+        } return true;
+        case RL_CALL_IS_WINDOW_FULLSCREEN: {
+            (void)IsWindowFullscreen();
+        } return true;
+        case RL_CALL_IS_WINDOW_HIDDEN: {
+            (void)IsWindowHidden();
+        } return true;
+        case RL_CALL_IS_WINDOW_MINIMIZED: {
+            (void)IsWindowMinimized();
+        } return true;
+        case RL_CALL_IS_WINDOW_MAXIMIZED: {
+            (void)IsWindowMaximized();
+        } return true;
+        case RL_CALL_IS_WINDOW_FOCUSED: {
+            (void)IsWindowFocused();
+        } return true;
+        case RL_CALL_IS_WINDOW_RESIZED: {
+            (void)IsWindowResized();
+        } return true;
+        case RL_CALL_IS_WINDOW_STATE: {
+            unsigned int flag;
+            rl_replay_value(reader, &flag, sizeof(flag));
+            (void)IsWindowState(flag);
+        } return true;
+        case RL_CALL_SET_WINDOW_TITLE: {
+            const char *title = rl_replay_string(reader);
+            SetWindowTitle(title);
+        } return true;
+        case RL_CALL_SET_WINDOW_MIN_SIZE: {
+            int width;
+            rl_replay_value(reader, &width, sizeof(width));
+            int height;
+            rl_replay_value(reader, &height, sizeof(height));
+            SetWindowMinSize(width, height);
+        } return true;
+        case RL_CALL_SET_WINDOW_MAX_SIZE: {
+            int width;
+            rl_replay_value(reader, &width, sizeof(width));
+            int height;
+            rl_replay_value(reader, &height, sizeof(height));
+            SetWindowMaxSize(width, height);
+        } return true;
+        case RL_CALL_SET_WINDOW_OPACITY: {
+            float opacity;
+            rl_replay_value(reader, &opacity, sizeof(opacity));
+            SetWindowOpacity(opacity);
+        } return true;
+        case RL_CALL_SET_WINDOW_FOCUSED: {
+            SetWindowFocused();
+        } return true;
+        case RL_CALL_GET_SCREEN_WIDTH: {
+            (void)GetScreenWidth();
+        } return true;
+        case RL_CALL_GET_SCREEN_HEIGHT: {
+            (void)GetScreenHeight();
+        } return true;
+        case RL_CALL_GET_RENDER_WIDTH: {
+            (void)GetRenderWidth();
+        } return true;
+        case RL_CALL_GET_RENDER_HEIGHT: {
+            (void)GetRenderHeight();
+        } return true;
+        case RL_CALL_GET_MONITOR_COUNT: {
+            (void)GetMonitorCount();
+        } return true;
+        case RL_CALL_GET_CURRENT_MONITOR: {
+            (void)GetCurrentMonitor();
+        } return true;
+        case RL_CALL_GET_MONITOR_POSITION: {
+            int monitor;
+            rl_replay_value(reader, &monitor, sizeof(monitor));
+            (void)GetMonitorPosition(monitor);
+        } return true;
+        case RL_CALL_GET_MONITOR_WIDTH: {
+            int monitor;
+            rl_replay_value(reader, &monitor, sizeof(monitor));
+            (void)GetMonitorWidth(monitor);
+        } return true;
+        case RL_CALL_GET_MONITOR_HEIGHT: {
+            int monitor;
+            rl_replay_value(reader, &monitor, sizeof(monitor));
+            (void)GetMonitorHeight(monitor);
+        } return true;
+        case RL_CALL_GET_MONITOR_PHYSICAL_WIDTH: {
+            int monitor;
+            rl_replay_value(reader, &monitor, sizeof(monitor));
+            (void)GetMonitorPhysicalWidth(monitor);
+        } return true;
+        case RL_CALL_GET_MONITOR_PHYSICAL_HEIGHT: {
+            int monitor;
+            rl_replay_value(reader, &monitor, sizeof(monitor));
+            (void)GetMonitorPhysicalHeight(monitor);
+        } return true;
+        case RL_CALL_GET_MONITOR_REFRESH_RATE: {
+            int monitor;
+            rl_replay_value(reader, &monitor, sizeof(monitor));
+            (void)GetMonitorRefreshRate(monitor);
+        } return true;
+        case RL_CALL_GET_WINDOW_POSITION: {
+            (void)GetWindowPosition();
+        } return true;
+        case RL_CALL_GET_WINDOW_SCALE_DPI: {
+            (void)GetWindowScaleDPI();
+        } return true;
+        case RL_CALL_GET_MONITOR_NAME: {
+            int monitor;
+            rl_replay_value(reader, &monitor, sizeof(monitor));
+            (void)GetMonitorName(monitor);
+        } return true;
+        case RL_CALL_SET_CLIPBOARD_TEXT: {
+            const char *text = rl_replay_string(reader);
+            SetClipboardText(text);
+        } return true;
+        case RL_CALL_GET_CLIPBOARD_TEXT: {
+            (void)GetClipboardText();
+        } return true;
+        case RL_CALL_DISABLE_EVENT_WAITING: {
+            DisableEventWaiting();
+        } return true;
+        case RL_CALL_SHOW_CURSOR: {
+            ShowCursor();
+        } return true;
+        case RL_CALL_HIDE_CURSOR: {
+            HideCursor();
+        } return true;
+        case RL_CALL_IS_CURSOR_HIDDEN: {
+            (void)IsCursorHidden();
+        } return true;
+        case RL_CALL_ENABLE_CURSOR: {
+            EnableCursor();
+        } return true;
+        case RL_CALL_DISABLE_CURSOR: {
+            DisableCursor();
+        } return true;
+        case RL_CALL_IS_CURSOR_ON_SCREEN: {
+            (void)IsCursorOnScreen();
+        } return true;
+        case RL_CALL_CLEAR_BACKGROUND: {
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            ClearBackground(color);
+        } return true;
+        case RL_CALL_BEGIN_DRAWING: {
+            BeginDrawing();
+        } return true;
+        case RL_CALL_END_DRAWING: {
+            EndDrawing();
+        } return true;
+        case RL_CALL_BEGIN_MODE2_D: {
+            Camera2D camera;
+            rl_replay_value(reader, &camera, sizeof(camera));
+            BeginMode2D(camera);
+        } return true;
+        case RL_CALL_END_MODE2_D: {
+            EndMode2D();
+        } return true;
+        case RL_CALL_BEGIN_MODE3_D: {
+            Camera3D camera;
+            rl_replay_value(reader, &camera, sizeof(camera));
+            BeginMode3D(camera);
+        } return true;
+        case RL_CALL_END_MODE3_D: {
+            EndMode3D();
+        } return true;
+        case RL_CALL_BEGIN_TEXTURE_MODE: {
+            RenderTexture2D target = rl_replay_render_texture(reader);
+            BeginTextureMode(target);
+        } return true;
+        case RL_CALL_END_TEXTURE_MODE: {
+            EndTextureMode();
+        } return true;
+        case RL_CALL_BEGIN_SHADER_MODE: {
+            Shader shader = rl_replay_shader(reader);
+            BeginShaderMode(shader);
+        } return true;
+        case RL_CALL_END_SHADER_MODE: {
+            EndShaderMode();
+        } return true;
+        case RL_CALL_BEGIN_BLEND_MODE: {
+            int mode;
+            rl_replay_value(reader, &mode, sizeof(mode));
+            BeginBlendMode(mode);
+        } return true;
+        case RL_CALL_END_BLEND_MODE: {
+            EndBlendMode();
+        } return true;
+        case RL_CALL_BEGIN_SCISSOR_MODE: {
+            int x;
+            rl_replay_value(reader, &x, sizeof(x));
+            int y;
+            rl_replay_value(reader, &y, sizeof(y));
+            int width;
+            rl_replay_value(reader, &width, sizeof(width));
+            int height;
+            rl_replay_value(reader, &height, sizeof(height));
+            BeginScissorMode(x, y, width, height);
+        } return true;
+        case RL_CALL_END_SCISSOR_MODE: {
+            EndScissorMode();
+        } return true;
+        case RL_CALL_END_VR_STEREO_MODE: {
+            EndVrStereoMode();
+        } return true;
+        case RL_CALL_LOAD_SHADER: {
+            const char *vsFileName = rl_replay_string(reader);
+            const char *fsFileName = rl_replay_string(reader);
+            Shader result = LoadShader(vsFileName, fsFileName);
+            rl_replay_result_shader(reader, result);
+        } return true;
+        case RL_CALL_LOAD_SHADER_FROM_MEMORY: {
+            const char *vsCode = rl_replay_string(reader);
+            const char *fsCode = rl_replay_string(reader);
+            Shader result = LoadShaderFromMemory(vsCode, fsCode);
+            rl_replay_result_shader(reader, result);
+        } return true;
+        case RL_CALL_IS_SHADER_VALID: {
+            Shader shader = rl_replay_shader(reader);
+            (void)IsShaderValid(shader);
+        } return true;
+        case RL_CALL_GET_SHADER_LOCATION: {
+            Shader shader = rl_replay_shader(reader);
+            const char *uniformName = rl_replay_string(reader);
+            (void)GetShaderLocation(shader, uniformName);
+        } return true;
+        case RL_CALL_GET_SHADER_LOCATION_ATTRIB: {
+            Shader shader = rl_replay_shader(reader);
+            const char *attribName = rl_replay_string(reader);
+            (void)GetShaderLocationAttrib(shader, attribName);
+        } return true;
+        case RL_CALL_SET_SHADER_VALUE_MATRIX: {
+            Shader shader = rl_replay_shader(reader);
+            int locIndex;
+            rl_replay_value(reader, &locIndex, sizeof(locIndex));
+            Matrix mat;
+            rl_replay_value(reader, &mat, sizeof(mat));
+            SetShaderValueMatrix(shader, locIndex, mat);
+        } return true;
+        case RL_CALL_SET_SHADER_VALUE_TEXTURE: {
+            Shader shader = rl_replay_shader(reader);
+            int locIndex;
+            rl_replay_value(reader, &locIndex, sizeof(locIndex));
+            Texture2D texture = rl_replay_texture(reader);
+            SetShaderValueTexture(shader, locIndex, texture);
+        } return true;
+        case RL_CALL_UNLOAD_SHADER: {
+            Shader shader = rl_replay_shader(reader);
+            UnloadShader(shader);
+            rl_replay_forget_shader(shader);
+        } return true;
+        case RL_CALL_GET_SCREEN_TO_WORLD_RAY: {
+            Vector2 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            Camera camera;
+            rl_replay_value(reader, &camera, sizeof(camera));
+            (void)GetScreenToWorldRay(position, camera);
+        } return true;
+        case RL_CALL_GET_SCREEN_TO_WORLD_RAY_EX: {
+            Vector2 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            Camera camera;
+            rl_replay_value(reader, &camera, sizeof(camera));
+            int width;
+            rl_replay_value(reader, &width, sizeof(width));
+            int height;
+            rl_replay_value(reader, &height, sizeof(height));
+            (void)GetScreenToWorldRayEx(position, camera, width, height);
+        } return true;
+        case RL_CALL_GET_WORLD_TO_SCREEN: {
+            Vector3 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            Camera camera;
+            rl_replay_value(reader, &camera, sizeof(camera));
+            (void)GetWorldToScreen(position, camera);
+        } return true;
+        case RL_CALL_GET_WORLD_TO_SCREEN_EX: {
+            Vector3 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            Camera camera;
+            rl_replay_value(reader, &camera, sizeof(camera));
+            int width;
+            rl_replay_value(reader, &width, sizeof(width));
+            int height;
+            rl_replay_value(reader, &height, sizeof(height));
+            (void)GetWorldToScreenEx(position, camera, width, height);
+        } return true;
+        case RL_CALL_GET_WORLD_TO_SCREEN2_D: {
+            Vector2 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            Camera2D camera;
+            rl_replay_value(reader, &camera, sizeof(camera));
+            (void)GetWorldToScreen2D(position, camera);
+        } return true;
+        case RL_CALL_GET_SCREEN_TO_WORLD2_D: {
+            Vector2 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            Camera2D camera;
+            rl_replay_value(reader, &camera, sizeof(camera));
+            (void)GetScreenToWorld2D(position, camera);
+        } return true;
+        case RL_CALL_GET_CAMERA_MATRIX: {
+            Camera camera;
+            rl_replay_value(reader, &camera, sizeof(camera));
+            (void)GetCameraMatrix(camera);
+        } return true;
+        case RL_CALL_GET_CAMERA_MATRIX2_D: {
+            Camera2D camera;
+            rl_replay_value(reader, &camera, sizeof(camera));
+            (void)GetCameraMatrix2D(camera);
+        } return true;
+        case RL_CALL_GET_FRAME_TIME: {
+            (void)GetFrameTime();
+        } return true;
+        case RL_CALL_GET_TIME: {
+            (void)GetTime();
+        } return true;
+        case RL_CALL_GET_FPS: {
+            (void)GetFPS();
+        } return true;
+        case RL_CALL_SWAP_SCREEN_BUFFER: {
+            SwapScreenBuffer();
+        } return true;
+        case RL_CALL_POLL_INPUT_EVENTS: {
+            PollInputEvents();
+        } return true;
+        case RL_CALL_SET_RANDOM_SEED: {
+            unsigned int seed;
+            rl_replay_value(reader, &seed, sizeof(seed));
+            SetRandomSeed(seed);
+        } return true;
+        case RL_CALL_GET_RANDOM_VALUE: {
+            int min;
+            rl_replay_value(reader, &min, sizeof(min));
+            int max;
+            rl_replay_value(reader, &max, sizeof(max));
+            (void)GetRandomValue(min, max);
+        } return true;
+        case RL_CALL_SET_TRACE_LOG_LEVEL: {
+            int logLevel;
+            rl_replay_value(reader, &logLevel, sizeof(logLevel));
+            SetTraceLogLevel(logLevel);
+        } return true;
+        case RL_CALL_FILE_EXISTS: {
+            const char *fileName = rl_replay_string(reader);
+            (void)FileExists(fileName);
+        } return true;
+        case RL_CALL_DIRECTORY_EXISTS: {
+            const char *dirPath = rl_replay_string(reader);
+            (void)DirectoryExists(dirPath);
+        } return true;
+        case RL_CALL_IS_FILE_EXTENSION: {
+            const char *fileName = rl_replay_string(reader);
+            const char *ext = rl_replay_string(reader);
+            (void)IsFileExtension(fileName, ext);
+        } return true;
+        case RL_CALL_GET_FILE_LENGTH: {
+            const char *fileName = rl_replay_string(reader);
+            (void)GetFileLength(fileName);
+        } return true;
+        case RL_CALL_GET_FILE_EXTENSION: {
+            const char *fileName = rl_replay_string(reader);
+            (void)GetFileExtension(fileName);
+        } return true;
+        case RL_CALL_GET_FILE_NAME: {
+            const char *filePath = rl_replay_string(reader);
+            (void)GetFileName(filePath);
+        } return true;
+        case RL_CALL_GET_FILE_NAME_WITHOUT_EXT: {
+            const char *filePath = rl_replay_string(reader);
+            (void)GetFileNameWithoutExt(filePath);
+        } return true;
+        case RL_CALL_GET_DIRECTORY_PATH: {
+            const char *filePath = rl_replay_string(reader);
+            (void)GetDirectoryPath(filePath);
+        } return true;
+        case RL_CALL_GET_PREV_DIRECTORY_PATH: {
+            const char *dirPath = rl_replay_string(reader);
+            (void)GetPrevDirectoryPath(dirPath);
+        } return true;
+        case RL_CALL_GET_WORKING_DIRECTORY: {
+            (void)GetWorkingDirectory();
+        } return true;
+        case RL_CALL_GET_APPLICATION_DIRECTORY: {
+            (void)GetApplicationDirectory();
+        } return true;
+        case RL_CALL_IS_PATH_FILE: {
+            const char *path = rl_replay_string(reader);
+            (void)IsPathFile(path);
+        } return true;
+        case RL_CALL_IS_FILE_NAME_VALID: {
+            const char *fileName = rl_replay_string(reader);
+            (void)IsFileNameValid(fileName);
+        } return true;
+        case RL_CALL_IS_FILE_DROPPED: {
+            (void)IsFileDropped();
+        } return true;
+        case RL_CALL_SET_AUTOMATION_EVENT_BASE_FRAME: {
+            int frame;
+            rl_replay_value(reader, &frame, sizeof(frame));
+            SetAutomationEventBaseFrame(frame);
+        } return true;
+        case RL_CALL_START_AUTOMATION_EVENT_RECORDING: {
+            StartAutomationEventRecording();
+        } return true;
+        case RL_CALL_STOP_AUTOMATION_EVENT_RECORDING: {
+            StopAutomationEventRecording();
+        } return true;
+        case RL_CALL_IS_KEY_PRESSED: {
+            int key;
+            rl_replay_value(reader, &key, sizeof(key));
+            (void)IsKeyPressed(key);
+        } return true;
+        case RL_CALL_IS_KEY_PRESSED_REPEAT: {
+            int key;
+            rl_replay_value(reader, &key, sizeof(key));
+            (void)IsKeyPressedRepeat(key);
+        } return true;
+        case RL_CALL_IS_KEY_DOWN: {
+            int key;
+            rl_replay_value(reader, &key, sizeof(key));
+            (void)IsKeyDown(key);
+        } return true;
+        case RL_CALL_IS_KEY_RELEASED: {
+            int key;
+            rl_replay_value(reader, &key, sizeof(key));
+            (void)IsKeyReleased(key);
+        } return true;
+        case RL_CALL_IS_KEY_UP: {
+            int key;
+            rl_replay_value(reader, &key, sizeof(key));
+            (void)IsKeyUp(key);
+        } return true;
+        case RL_CALL_GET_KEY_PRESSED: {
+            (void)GetKeyPressed();
+        } return true;
+        case RL_CALL_GET_CHAR_PRESSED: {
+            (void)GetCharPressed();
+        } return true;
+        case RL_CALL_SET_EXIT_KEY: {
+            int key;
+            rl_replay_value(reader, &key, sizeof(key));
+            SetExitKey(key);
+        } return true;
+        case RL_CALL_IS_GAMEPAD_AVAILABLE: {
+            int gamepad;
+            rl_replay_value(reader, &gamepad, sizeof(gamepad));
+            (void)IsGamepadAvailable(gamepad);
+        } return true;
+        case RL_CALL_GET_GAMEPAD_NAME: {
+            int gamepad;
+            rl_replay_value(reader, &gamepad, sizeof(gamepad));
+            (void)GetGamepadName(gamepad);
+        } return true;
+        case RL_CALL_IS_GAMEPAD_BUTTON_PRESSED: {
+            int gamepad;
+            rl_replay_value(reader, &gamepad, sizeof(gamepad));
+            int button;
+            rl_replay_value(reader, &button, sizeof(button));
+            (void)IsGamepadButtonPressed(gamepad, button);
+        } return true;
+        case RL_CALL_IS_GAMEPAD_BUTTON_DOWN: {
+            int gamepad;
+            rl_replay_value(reader, &gamepad, sizeof(gamepad));
+            int button;
+            rl_replay_value(reader, &button, sizeof(button));
+            (void)IsGamepadButtonDown(gamepad, button);
+        } return true;
+        case RL_CALL_IS_GAMEPAD_BUTTON_RELEASED: {
+            int gamepad;
+            rl_replay_value(reader, &gamepad, sizeof(gamepad));
+            int button;
+            rl_replay_value(reader, &button, sizeof(button));
+            (void)IsGamepadButtonReleased(gamepad, button);
+        } return true;
+        case RL_CALL_IS_GAMEPAD_BUTTON_UP: {
+            int gamepad;
+            rl_replay_value(reader, &gamepad, sizeof(gamepad));
+            int button;
+            rl_replay_value(reader, &button, sizeof(button));
+            (void)IsGamepadButtonUp(gamepad, button);
+        } return true;
+        case RL_CALL_GET_GAMEPAD_BUTTON_PRESSED: {
+            (void)GetGamepadButtonPressed();
+        } return true;
+        case RL_CALL_GET_GAMEPAD_AXIS_COUNT: {
+            int gamepad;
+            rl_replay_value(reader, &gamepad, sizeof(gamepad));
+            (void)GetGamepadAxisCount(gamepad);
+        } return true;
+        case RL_CALL_GET_GAMEPAD_AXIS_MOVEMENT: {
+            int gamepad;
+            rl_replay_value(reader, &gamepad, sizeof(gamepad));
+            int axis;
+            rl_replay_value(reader, &axis, sizeof(axis));
+            (void)GetGamepadAxisMovement(gamepad, axis);
+        } return true;
+        case RL_CALL_SET_GAMEPAD_MAPPINGS: {
+            const char *mappings = rl_replay_string(reader);
+            (void)SetGamepadMappings(mappings);
+        } return true;
+        case RL_CALL_SET_GAMEPAD_VIBRATION: {
+            int gamepad;
+            rl_replay_value(reader, &gamepad, sizeof(gamepad));
+            float leftMotor;
+            rl_replay_value(reader, &leftMotor, sizeof(leftMotor));
+            float rightMotor;
+            rl_replay_value(reader, &rightMotor, sizeof(rightMotor));
+            float duration;
+            rl_replay_value(reader, &duration, sizeof(duration));
+            SetGamepadVibration(gamepad, leftMotor, rightMotor, duration);
+        } return true;
+        case RL_CALL_IS_MOUSE_BUTTON_PRESSED: {
+            int button;
+            rl_replay_value(reader, &button, sizeof(button));
+            (void)IsMouseButtonPressed(button);
+        } return true;
+        case RL_CALL_IS_MOUSE_BUTTON_DOWN: {
+            int button;
+            rl_replay_value(reader, &button, sizeof(button));
+            (void)IsMouseButtonDown(button);
+        } return true;
+        case RL_CALL_IS_MOUSE_BUTTON_RELEASED: {
+            int button;
+            rl_replay_value(reader, &button, sizeof(button));
+            (void)IsMouseButtonReleased(button);
+        } return true;
+        case RL_CALL_IS_MOUSE_BUTTON_UP: {
+            int button;
+            rl_replay_value(reader, &button, sizeof(button));
+            (void)IsMouseButtonUp(button);
+        } return true;
+        case RL_CALL_GET_MOUSE_X: {
+            (void)GetMouseX();
+        } return true;
+        case RL_CALL_GET_MOUSE_Y: {
+            (void)GetMouseY();
+        } return true;
+        case RL_CALL_GET_MOUSE_POSITION: {
+            (void)GetMousePosition();
+        } return true;
+        case RL_CALL_GET_MOUSE_DELTA: {
+            (void)GetMouseDelta();
+        } return true;
+        case RL_CALL_SET_MOUSE_POSITION: {
+            int x;
+            rl_replay_value(reader, &x, sizeof(x));
+            int y;
+            rl_replay_value(reader, &y, sizeof(y));
+            SetMousePosition(x, y);
+        } return true;
+        case RL_CALL_SET_MOUSE_OFFSET: {
+            int offsetX;
+            rl_replay_value(reader, &offsetX, sizeof(offsetX));
+            int offsetY;
+            rl_replay_value(reader, &offsetY, sizeof(offsetY));
+            SetMouseOffset(offsetX, offsetY);
+        } return true;
+        case RL_CALL_SET_MOUSE_SCALE: {
+            float scaleX;
+            rl_replay_value(reader, &scaleX, sizeof(scaleX));
+            float scaleY;
+            rl_replay_value(reader, &scaleY, sizeof(scaleY));
+            SetMouseScale(scaleX, scaleY);
+        } return true;
+        case RL_CALL_GET_MOUSE_WHEEL_MOVE: {
+            (void)GetMouseWheelMove();
+        } return true;
+        case RL_CALL_GET_MOUSE_WHEEL_MOVE_V: {
+            (void)GetMouseWheelMoveV();
+        } return true;
+        case RL_CALL_SET_MOUSE_CURSOR: {
+            int cursor;
+            rl_replay_value(reader, &cursor, sizeof(cursor));
+            SetMouseCursor(cursor);
+        } return true;
+        case RL_CALL_GET_TOUCH_X: {
+            (void)GetTouchX();
+        } return true;
+        case RL_CALL_GET_TOUCH_Y: {
+            (void)GetTouchY();
+        } return true;
+        case RL_CALL_GET_TOUCH_POSITION: {
+            int index;
+            rl_replay_value(reader, &index, sizeof(index));
+            (void)GetTouchPosition(index);
+        } return true;
+        case RL_CALL_GET_TOUCH_POINT_ID: {
+            int index;
+            rl_replay_value(reader, &index, sizeof(index));
+            (void)GetTouchPointId(index);
+        } return true;
+        case RL_CALL_GET_TOUCH_POINT_COUNT: {
+            (void)GetTouchPointCount();
+        } return true;
+        case RL_CALL_SET_GESTURES_ENABLED: {
+            unsigned int flags;
+            rl_replay_value(reader, &flags, sizeof(flags));
+            SetGesturesEnabled(flags);
+        } return true;
+        case RL_CALL_IS_GESTURE_DETECTED: {
+            unsigned int gesture;
+            rl_replay_value(reader, &gesture, sizeof(gesture));
+            (void)IsGestureDetected(gesture);
+        } return true;
+        case RL_CALL_GET_GESTURE_DETECTED: {
+            (void)GetGestureDetected();
+        } return true;
+        case RL_CALL_GET_GESTURE_HOLD_DURATION: {
+            (void)GetGestureHoldDuration();
+        } return true;
+        case RL_CALL_GET_GESTURE_DRAG_VECTOR: {
+            (void)GetGestureDragVector();
+        } return true;
+        case RL_CALL_GET_GESTURE_DRAG_ANGLE: {
+            (void)GetGestureDragAngle();
+        } return true;
+        case RL_CALL_GET_GESTURE_PINCH_VECTOR: {
+            (void)GetGesturePinchVector();
+        } return true;
+        case RL_CALL_GET_GESTURE_PINCH_ANGLE: {
+            (void)GetGesturePinchAngle();
+        } return true;
+        case RL_CALL_SET_SHAPES_TEXTURE: {
+            Texture2D texture = rl_replay_texture(reader);
+            Rectangle source;
+            rl_replay_value(reader, &source, sizeof(source));
+            SetShapesTexture(texture, source);
+        } return true;
+        case RL_CALL_GET_SHAPES_TEXTURE: {
+            Texture2D result = GetShapesTexture();
+            rl_replay_result_texture(reader, result);
+        } return true;
+        case RL_CALL_GET_SHAPES_TEXTURE_RECTANGLE: {
+            (void)GetShapesTextureRectangle();
+        } return true;
+        case RL_CALL_DRAW_PIXEL: {
+            int posX;
+            rl_replay_value(reader, &posX, sizeof(posX));
+            int posY;
+            rl_replay_value(reader, &posY, sizeof(posY));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawPixel(posX, posY, color);
+        } return true;
+        case RL_CALL_DRAW_PIXEL_V: {
+            Vector2 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawPixelV(position, color);
+        } return true;
+        case RL_CALL_DRAW_LINE: {
+            int startPosX;
+            rl_replay_value(reader, &startPosX, sizeof(startPosX));
+            int startPosY;
+            rl_replay_value(reader, &startPosY, sizeof(startPosY));
+            int endPosX;
+            rl_replay_value(reader, &endPosX, sizeof(endPosX));
+            int endPosY;
+            rl_replay_value(reader, &endPosY, sizeof(endPosY));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawLine(startPosX, startPosY, endPosX, endPosY, color);
+        } return true;
+        case RL_CALL_DRAW_LINE_V: {
+            Vector2 startPos;
+            rl_replay_value(reader, &startPos, sizeof(startPos));
+            Vector2 endPos;
+            rl_replay_value(reader, &endPos, sizeof(endPos));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawLineV(startPos, endPos, color);
+        } return true;
+        case RL_CALL_DRAW_LINE_EX: {
+            Vector2 startPos;
+            rl_replay_value(reader, &startPos, sizeof(startPos));
+            Vector2 endPos;
+            rl_replay_value(reader, &endPos, sizeof(endPos));
+            float thick;
+            rl_replay_value(reader, &thick, sizeof(thick));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawLineEx(startPos, endPos, thick, color);
+        } return true;
+        case RL_CALL_DRAW_LINE_BEZIER: {
+            Vector2 startPos;
+            rl_replay_value(reader, &startPos, sizeof(startPos));
+            Vector2 endPos;
+            rl_replay_value(reader, &endPos, sizeof(endPos));
+            float thick;
+            rl_replay_value(reader, &thick, sizeof(thick));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawLineBezier(startPos, endPos, thick, color);
+        } return true;
+        case RL_CALL_DRAW_CIRCLE: {
+            int centerX;
+            rl_replay_value(reader, &centerX, sizeof(centerX));
+            int centerY;
+            rl_replay_value(reader, &centerY, sizeof(centerY));
+            float radius;
+            rl_replay_value(reader, &radius, sizeof(radius));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawCircle(centerX, centerY, radius, color);
+        } return true;
+        case RL_CALL_DRAW_CIRCLE_SECTOR: {
+            Vector2 center;
+            rl_replay_value(reader, &center, sizeof(center));
+            float radius;
+            rl_replay_value(reader, &radius, sizeof(radius));
+            float startAngle;
+            rl_replay_value(reader, &startAngle, sizeof(startAngle));
+            float endAngle;
+            rl_replay_value(reader, &endAngle, sizeof(endAngle));
+            int segments;
+            rl_replay_value(reader, &segments, sizeof(segments));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawCircleSector(center, radius, startAngle, endAngle, segments, color);
+        } return true;
+        case RL_CALL_DRAW_CIRCLE_SECTOR_LINES: {
+            Vector2 center;
+            rl_replay_value(reader, &center, sizeof(center));
+            float radius;
+            rl_replay_value(reader, &radius, sizeof(radius));
+            float startAngle;
+            rl_replay_value(reader, &startAngle, sizeof(startAngle));
+            float endAngle;
+            rl_replay_value(reader, &endAngle, sizeof(endAngle));
+            int segments;
+            rl_replay_value(reader, &segments, sizeof(segments));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawCircleSectorLines(center, radius, startAngle, endAngle, segments, color);
+        } return true;
+        case RL_CALL_DRAW_CIRCLE_GRADIENT: {
+            int centerX;
+            rl_replay_value(reader, &centerX, sizeof(centerX));
+            int centerY;
+            rl_replay_value(reader, &centerY, sizeof(centerY));
+            float radius;
+            rl_replay_value(reader, &radius, sizeof(radius));
+            Color inner;
+            rl_replay_value(reader, &inner, sizeof(inner));
+            Color outer;
+            rl_replay_value(reader, &outer, sizeof(outer));
+            DrawCircleGradient(centerX, centerY, radius, inner, outer);
+        } return true;
+        case RL_CALL_DRAW_CIRCLE_V: {
+            Vector2 center;
+            rl_replay_value(reader, &center, sizeof(center));
+            float radius;
+            rl_replay_value(reader, &radius, sizeof(radius));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawCircleV(center, radius, color);
+        } return true;
+        case RL_CALL_DRAW_CIRCLE_LINES: {
+            int centerX;
+            rl_replay_value(reader, &centerX, sizeof(centerX));
+            int centerY;
+            rl_replay_value(reader, &centerY, sizeof(centerY));
+            float radius;
+            rl_replay_value(reader, &radius, sizeof(radius));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawCircleLines(centerX, centerY, radius, color);
+        } return true;
+        case RL_CALL_DRAW_CIRCLE_LINES_V: {
+            Vector2 center;
+            rl_replay_value(reader, &center, sizeof(center));
+            float radius;
+            rl_replay_value(reader, &radius, sizeof(radius));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawCircleLinesV(center, radius, color);
+        } return true;
+        case RL_CALL_DRAW_ELLIPSE: {
+            int centerX;
+            rl_replay_value(reader, &centerX, sizeof(centerX));
+            int centerY;
+            rl_replay_value(reader, &centerY, sizeof(centerY));
+            float radiusH;
+            rl_replay_value(reader, &radiusH, sizeof(radiusH));
+            float radiusV;
+            rl_replay_value(reader, &radiusV, sizeof(radiusV));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawEllipse(centerX, centerY, radiusH, radiusV, color);
+        } return true;
+        case RL_CALL_DRAW_ELLIPSE_LINES: {
+            int centerX;
+            rl_replay_value(reader, &centerX, sizeof(centerX));
+            int centerY;
+            rl_replay_value(reader, &centerY, sizeof(centerY));
+            float radiusH;
+            rl_replay_value(reader, &radiusH, sizeof(radiusH));
+            float radiusV;
+            rl_replay_value(reader, &radiusV, sizeof(radiusV));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawEllipseLines(centerX, centerY, radiusH, radiusV, color);
+        } return true;
+        case RL_CALL_DRAW_RING: {
+            Vector2 center;
+            rl_replay_value(reader, &center, sizeof(center));
+            float innerRadius;
+            rl_replay_value(reader, &innerRadius, sizeof(innerRadius));
+            float outerRadius;
+            rl_replay_value(reader, &outerRadius, sizeof(outerRadius));
+            float startAngle;
+            rl_replay_value(reader, &startAngle, sizeof(startAngle));
+            float endAngle;
+            rl_replay_value(reader, &endAngle, sizeof(endAngle));
+            int segments;
+            rl_replay_value(reader, &segments, sizeof(segments));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawRing(center, innerRadius, outerRadius, startAngle, endAngle, segments, color);
+        } return true;
+        case RL_CALL_DRAW_RING_LINES: {
+            Vector2 center;
+            rl_replay_value(reader, &center, sizeof(center));
+            float innerRadius;
+            rl_replay_value(reader, &innerRadius, sizeof(innerRadius));
+            float outerRadius;
+            rl_replay_value(reader, &outerRadius, sizeof(outerRadius));
+            float startAngle;
+            rl_replay_value(reader, &startAngle, sizeof(startAngle));
+            float endAngle;
+            rl_replay_value(reader, &endAngle, sizeof(endAngle));
+            int segments;
+            rl_replay_value(reader, &segments, sizeof(segments));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawRingLines(center, innerRadius, outerRadius, startAngle, endAngle, segments, color);
+        } return true;
+        case RL_CALL_DRAW_RECTANGLE: {
+            int posX;
+            rl_replay_value(reader, &posX, sizeof(posX));
+            int posY;
+            rl_replay_value(reader, &posY, sizeof(posY));
+            int width;
+            rl_replay_value(reader, &width, sizeof(width));
+            int height;
+            rl_replay_value(reader, &height, sizeof(height));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawRectangle(posX, posY, width, height, color);
+        } return true;
+        case RL_CALL_DRAW_RECTANGLE_V: {
+            Vector2 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            Vector2 size;
+            rl_replay_value(reader, &size, sizeof(size));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawRectangleV(position, size, color);
+        } return true;
+        case RL_CALL_DRAW_RECTANGLE_REC: {
+            Rectangle rec;
+            rl_replay_value(reader, &rec, sizeof(rec));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawRectangleRec(rec, color);
+        } return true;
+        case RL_CALL_DRAW_RECTANGLE_PRO: {
+            Rectangle rec;
+            rl_replay_value(reader, &rec, sizeof(rec));
+            Vector2 origin;
+            rl_replay_value(reader, &origin, sizeof(origin));
+            float rotation;
+            rl_replay_value(reader, &rotation, sizeof(rotation));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawRectanglePro(rec, origin, rotation, color);
+        } return true;
+        case RL_CALL_DRAW_RECTANGLE_GRADIENT_V: {
+            int posX;
+            rl_replay_value(reader, &posX, sizeof(posX));
+            int posY;
+            rl_replay_value(reader, &posY, sizeof(posY));
+            int width;
+            rl_replay_value(reader, &width, sizeof(width));
+            int height;
+            rl_replay_value(reader, &height, sizeof(height));
+            Color top;
+            rl_replay_value(reader, &top, sizeof(top));
+            Color bottom;
+            rl_replay_value(reader, &bottom, sizeof(bottom));
+            DrawRectangleGradientV(posX, posY, width, height, top, bottom);
+        } return true;
+        case RL_CALL_DRAW_RECTANGLE_GRADIENT_H: {
+            int posX;
+            rl_replay_value(reader, &posX, sizeof(posX));
+            int posY;
+            rl_replay_value(reader, &posY, sizeof(posY));
+            int width;
+            rl_replay_value(reader, &width, sizeof(width));
+            int height;
+            rl_replay_value(reader, &height, sizeof(height));
+            Color left;
+            rl_replay_value(reader, &left, sizeof(left));
+            Color right;
+            rl_replay_value(reader, &right, sizeof(right));
+            DrawRectangleGradientH(posX, posY, width, height, left, right);
+        } return true;
+        case RL_CALL_DRAW_RECTANGLE_GRADIENT_EX: {
+            Rectangle rec;
+            rl_replay_value(reader, &rec, sizeof(rec));
+            Color topLeft;
+            rl_replay_value(reader, &topLeft, sizeof(topLeft));
+            Color bottomLeft;
+            rl_replay_value(reader, &bottomLeft, sizeof(bottomLeft));
+            Color topRight;
+            rl_replay_value(reader, &topRight, sizeof(topRight));
+            Color bottomRight;
+            rl_replay_value(reader, &bottomRight, sizeof(bottomRight));
+            DrawRectangleGradientEx(rec, topLeft, bottomLeft, topRight, bottomRight);
+        } return true;
+        case RL_CALL_DRAW_RECTANGLE_LINES: {
+            int posX;
+            rl_replay_value(reader, &posX, sizeof(posX));
+            int posY;
+            rl_replay_value(reader, &posY, sizeof(posY));
+            int width;
+            rl_replay_value(reader, &width, sizeof(width));
+            int height;
+            rl_replay_value(reader, &height, sizeof(height));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawRectangleLines(posX, posY, width, height, color);
+        } return true;
+        case RL_CALL_DRAW_RECTANGLE_LINES_EX: {
+            Rectangle rec;
+            rl_replay_value(reader, &rec, sizeof(rec));
+            float lineThick;
+            rl_replay_value(reader, &lineThick, sizeof(lineThick));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawRectangleLinesEx(rec, lineThick, color);
+        } return true;
+        case RL_CALL_DRAW_RECTANGLE_ROUNDED: {
+            Rectangle rec;
+            rl_replay_value(reader, &rec, sizeof(rec));
+            float roundness;
+            rl_replay_value(reader, &roundness, sizeof(roundness));
+            int segments;
+            rl_replay_value(reader, &segments, sizeof(segments));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawRectangleRounded(rec, roundness, segments, color);
+        } return true;
+        case RL_CALL_DRAW_RECTANGLE_ROUNDED_LINES: {
+            Rectangle rec;
+            rl_replay_value(reader, &rec, sizeof(rec));
+            float roundness;
+            rl_replay_value(reader, &roundness, sizeof(roundness));
+            int segments;
+            rl_replay_value(reader, &segments, sizeof(segments));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawRectangleRoundedLines(rec, roundness, segments, color);
+        } return true;
+        case RL_CALL_DRAW_RECTANGLE_ROUNDED_LINES_EX: {
+            Rectangle rec;
+            rl_replay_value(reader, &rec, sizeof(rec));
+            float roundness;
+            rl_replay_value(reader, &roundness, sizeof(roundness));
+            int segments;
+            rl_replay_value(reader, &segments, sizeof(segments));
+            float lineThick;
+            rl_replay_value(reader, &lineThick, sizeof(lineThick));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawRectangleRoundedLinesEx(rec, roundness, segments, lineThick, color);
+        } return true;
+        case RL_CALL_DRAW_TRIANGLE: {
+            Vector2 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector2 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            Vector2 v3;
+            rl_replay_value(reader, &v3, sizeof(v3));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawTriangle(v1, v2, v3, color);
+        } return true;
+        case RL_CALL_DRAW_TRIANGLE_LINES: {
+            Vector2 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector2 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            Vector2 v3;
+            rl_replay_value(reader, &v3, sizeof(v3));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawTriangleLines(v1, v2, v3, color);
+        } return true;
+        case RL_CALL_DRAW_POLY: {
+            Vector2 center;
+            rl_replay_value(reader, &center, sizeof(center));
+            int sides;
+            rl_replay_value(reader, &sides, sizeof(sides));
+            float radius;
+            rl_replay_value(reader, &radius, sizeof(radius));
+            float rotation;
+            rl_replay_value(reader, &rotation, sizeof(rotation));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawPoly(center, sides, radius, rotation, color);
+        } return true;
+        case RL_CALL_DRAW_POLY_LINES: {
+            Vector2 center;
+            rl_replay_value(reader, &center, sizeof(center));
+            int sides;
+            rl_replay_value(reader, &sides, sizeof(sides));
+            float radius;
+            rl_replay_value(reader, &radius, sizeof(radius));
+            float rotation;
+            rl_replay_value(reader, &rotation, sizeof(rotation));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawPolyLines(center, sides, radius, rotation, color);
+        } return true;
+        case RL_CALL_DRAW_POLY_LINES_EX: {
+            Vector2 center;
+            rl_replay_value(reader, &center, sizeof(center));
+            int sides;
+            rl_replay_value(reader, &sides, sizeof(sides));
+            float radius;
+            rl_replay_value(reader, &radius, sizeof(radius));
+            float rotation;
+            rl_replay_value(reader, &rotation, sizeof(rotation));
+            float lineThick;
+            rl_replay_value(reader, &lineThick, sizeof(lineThick));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawPolyLinesEx(center, sides, radius, rotation, lineThick, color);
+        } return true;
+        case RL_CALL_DRAW_SPLINE_SEGMENT_LINEAR: {
+            Vector2 p1;
+            rl_replay_value(reader, &p1, sizeof(p1));
+            Vector2 p2;
+            rl_replay_value(reader, &p2, sizeof(p2));
+            float thick;
+            rl_replay_value(reader, &thick, sizeof(thick));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawSplineSegmentLinear(p1, p2, thick, color);
+        } return true;
+        case RL_CALL_DRAW_SPLINE_SEGMENT_BASIS: {
+            Vector2 p1;
+            rl_replay_value(reader, &p1, sizeof(p1));
+            Vector2 p2;
+            rl_replay_value(reader, &p2, sizeof(p2));
+            Vector2 p3;
+            rl_replay_value(reader, &p3, sizeof(p3));
+            Vector2 p4;
+            rl_replay_value(reader, &p4, sizeof(p4));
+            float thick;
+            rl_replay_value(reader, &thick, sizeof(thick));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawSplineSegmentBasis(p1, p2, p3, p4, thick, color);
+        } return true;
+        case RL_CALL_DRAW_SPLINE_SEGMENT_CATMULL_ROM: {
+            Vector2 p1;
+            rl_replay_value(reader, &p1, sizeof(p1));
+            Vector2 p2;
+            rl_replay_value(reader, &p2, sizeof(p2));
+            Vector2 p3;
+            rl_replay_value(reader, &p3, sizeof(p3));
+            Vector2 p4;
+            rl_replay_value(reader, &p4, sizeof(p4));
+            float thick;
+            rl_replay_value(reader, &thick, sizeof(thick));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawSplineSegmentCatmullRom(p1, p2, p3, p4, thick, color);
+        } return true;
+        case RL_CALL_DRAW_SPLINE_SEGMENT_BEZIER_QUADRATIC: {
+            Vector2 p1;
+            rl_replay_value(reader, &p1, sizeof(p1));
+            Vector2 c2;
+            rl_replay_value(reader, &c2, sizeof(c2));
+            Vector2 p3;
+            rl_replay_value(reader, &p3, sizeof(p3));
+            float thick;
+            rl_replay_value(reader, &thick, sizeof(thick));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawSplineSegmentBezierQuadratic(p1, c2, p3, thick, color);
+        } return true;
+        case RL_CALL_DRAW_SPLINE_SEGMENT_BEZIER_CUBIC: {
+            Vector2 p1;
+            rl_replay_value(reader, &p1, sizeof(p1));
+            Vector2 c2;
+            rl_replay_value(reader, &c2, sizeof(c2));
+            Vector2 c3;
+            rl_replay_value(reader, &c3, sizeof(c3));
+            Vector2 p4;
+            rl_replay_value(reader, &p4, sizeof(p4));
+            float thick;
+            rl_replay_value(reader, &thick, sizeof(thick));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawSplineSegmentBezierCubic(p1, c2, c3, p4, thick, color);
+        } return true;
+        case RL_CALL_GET_SPLINE_POINT_LINEAR: {
+            Vector2 startPos;
+            rl_replay_value(reader, &startPos, sizeof(startPos));
+            Vector2 endPos;
+            rl_replay_value(reader, &endPos, sizeof(endPos));
+            float t;
+            rl_replay_value(reader, &t, sizeof(t));
+            (void)GetSplinePointLinear(startPos, endPos, t);
+        } return true;
+        case RL_CALL_GET_SPLINE_POINT_BASIS: {
+            Vector2 p1;
+            rl_replay_value(reader, &p1, sizeof(p1));
+            Vector2 p2;
+            rl_replay_value(reader, &p2, sizeof(p2));
+            Vector2 p3;
+            rl_replay_value(reader, &p3, sizeof(p3));
+            Vector2 p4;
+            rl_replay_value(reader, &p4, sizeof(p4));
+            float t;
+            rl_replay_value(reader, &t, sizeof(t));
+            (void)GetSplinePointBasis(p1, p2, p3, p4, t);
+        } return true;
+        case RL_CALL_GET_SPLINE_POINT_CATMULL_ROM: {
+            Vector2 p1;
+            rl_replay_value(reader, &p1, sizeof(p1));
+            Vector2 p2;
+            rl_replay_value(reader, &p2, sizeof(p2));
+            Vector2 p3;
+            rl_replay_value(reader, &p3, sizeof(p3));
+            Vector2 p4;
+            rl_replay_value(reader, &p4, sizeof(p4));
+            float t;
+            rl_replay_value(reader, &t, sizeof(t));
+            (void)GetSplinePointCatmullRom(p1, p2, p3, p4, t);
+        } return true;
+        case RL_CALL_GET_SPLINE_POINT_BEZIER_QUAD: {
+            Vector2 p1;
+            rl_replay_value(reader, &p1, sizeof(p1));
+            Vector2 c2;
+            rl_replay_value(reader, &c2, sizeof(c2));
+            Vector2 p3;
+            rl_replay_value(reader, &p3, sizeof(p3));
+            float t;
+            rl_replay_value(reader, &t, sizeof(t));
+            (void)GetSplinePointBezierQuad(p1, c2, p3, t);
+        } return true;
+        case RL_CALL_GET_SPLINE_POINT_BEZIER_CUBIC: {
+            Vector2 p1;
+            rl_replay_value(reader, &p1, sizeof(p1));
+            Vector2 c2;
+            rl_replay_value(reader, &c2, sizeof(c2));
+            Vector2 c3;
+            rl_replay_value(reader, &c3, sizeof(c3));
+            Vector2 p4;
+            rl_replay_value(reader, &p4, sizeof(p4));
+            float t;
+            rl_replay_value(reader, &t, sizeof(t));
+            (void)GetSplinePointBezierCubic(p1, c2, c3, p4, t);
+        } return true;
+        case RL_CALL_CHECK_COLLISION_RECS: {
+            Rectangle rec1;
+            rl_replay_value(reader, &rec1, sizeof(rec1));
+            Rectangle rec2;
+            rl_replay_value(reader, &rec2, sizeof(rec2));
+            (void)CheckCollisionRecs(rec1, rec2);
+        } return true;
+        case RL_CALL_CHECK_COLLISION_CIRCLES: {
+            Vector2 center1;
+            rl_replay_value(reader, &center1, sizeof(center1));
+            float radius1;
+            rl_replay_value(reader, &radius1, sizeof(radius1));
+            Vector2 center2;
+            rl_replay_value(reader, &center2, sizeof(center2));
+            float radius2;
+            rl_replay_value(reader, &radius2, sizeof(radius2));
+            (void)CheckCollisionCircles(center1, radius1, center2, radius2);
+        } return true;
+        case RL_CALL_CHECK_COLLISION_CIRCLE_REC: {
+            Vector2 center;
+            rl_replay_value(reader, &center, sizeof(center));
+            float radius;
+            rl_replay_value(reader, &radius, sizeof(radius));
+            Rectangle rec;
+            rl_replay_value(reader, &rec, sizeof(rec));
+            (void)CheckCollisionCircleRec(center, radius, rec);
+        } return true;
+        case RL_CALL_CHECK_COLLISION_CIRCLE_LINE: {
+            Vector2 center;
+            rl_replay_value(reader, &center, sizeof(center));
+            float radius;
+            rl_replay_value(reader, &radius, sizeof(radius));
+            Vector2 p1;
+            rl_replay_value(reader, &p1, sizeof(p1));
+            Vector2 p2;
+            rl_replay_value(reader, &p2, sizeof(p2));
+            (void)CheckCollisionCircleLine(center, radius, p1, p2);
+        } return true;
+        case RL_CALL_CHECK_COLLISION_POINT_REC: {
+            Vector2 point;
+            rl_replay_value(reader, &point, sizeof(point));
+            Rectangle rec;
+            rl_replay_value(reader, &rec, sizeof(rec));
+            (void)CheckCollisionPointRec(point, rec);
+        } return true;
+        case RL_CALL_CHECK_COLLISION_POINT_CIRCLE: {
+            Vector2 point;
+            rl_replay_value(reader, &point, sizeof(point));
+            Vector2 center;
+            rl_replay_value(reader, &center, sizeof(center));
+            float radius;
+            rl_replay_value(reader, &radius, sizeof(radius));
+            (void)CheckCollisionPointCircle(point, center, radius);
+        } return true;
+        case RL_CALL_CHECK_COLLISION_POINT_TRIANGLE: {
+            Vector2 point;
+            rl_replay_value(reader, &point, sizeof(point));
+            Vector2 p1;
+            rl_replay_value(reader, &p1, sizeof(p1));
+            Vector2 p2;
+            rl_replay_value(reader, &p2, sizeof(p2));
+            Vector2 p3;
+            rl_replay_value(reader, &p3, sizeof(p3));
+            (void)CheckCollisionPointTriangle(point, p1, p2, p3);
+        } return true;
+        case RL_CALL_CHECK_COLLISION_POINT_LINE: {
+            Vector2 point;
+            rl_replay_value(reader, &point, sizeof(point));
+            Vector2 p1;
+            rl_replay_value(reader, &p1, sizeof(p1));
+            Vector2 p2;
+            rl_replay_value(reader, &p2, sizeof(p2));
+            int threshold;
+            rl_replay_value(reader, &threshold, sizeof(threshold));
+            (void)CheckCollisionPointLine(point, p1, p2, threshold);
+        } return true;
+        case RL_CALL_GET_COLLISION_REC: {
+            Rectangle rec1;
+            rl_replay_value(reader, &rec1, sizeof(rec1));
+            Rectangle rec2;
+            rl_replay_value(reader, &rec2, sizeof(rec2));
+            (void)GetCollisionRec(rec1, rec2);
+        } return true;
+        case RL_CALL_LOAD_TEXTURE: {
+            const char *fileName = rl_replay_string(reader);
+            Texture2D result = LoadTexture(fileName);
+            rl_replay_result_texture(reader, result);
+        } return true;
+        case RL_CALL_LOAD_RENDER_TEXTURE: {
+            int width;
+            rl_replay_value(reader, &width, sizeof(width));
+            int height;
+            rl_replay_value(reader, &height, sizeof(height));
+            RenderTexture2D result = LoadRenderTexture(width, height);
+            rl_replay_result_render_texture(reader, result);
+        } return true;
+        case RL_CALL_IS_TEXTURE_VALID: {
+            Texture2D texture = rl_replay_texture(reader);
+            (void)IsTextureValid(texture);
+        } return true;
+        case RL_CALL_UNLOAD_TEXTURE: {
+            Texture2D texture = rl_replay_texture(reader);
+            UnloadTexture(texture);
+            rl_replay_forget_texture(texture);
+        } return true;
+        case RL_CALL_IS_RENDER_TEXTURE_VALID: {
+            RenderTexture2D target = rl_replay_render_texture(reader);
+            (void)IsRenderTextureValid(target);
+        } return true;
+        case RL_CALL_UNLOAD_RENDER_TEXTURE: {
+            RenderTexture2D target = rl_replay_render_texture(reader);
+            UnloadRenderTexture(target);
+            rl_replay_forget_render_texture(target);
+        } return true;
+        case RL_CALL_SET_TEXTURE_FILTER: {
+            Texture2D texture = rl_replay_texture(reader);
+            int filter;
+            rl_replay_value(reader, &filter, sizeof(filter));
+            SetTextureFilter(texture, filter);
+        } return true;
+        case RL_CALL_SET_TEXTURE_WRAP: {
+            Texture2D texture = rl_replay_texture(reader);
+            int wrap;
+            rl_replay_value(reader, &wrap, sizeof(wrap));
+            SetTextureWrap(texture, wrap);
+        } return true;
+        case RL_CALL_DRAW_TEXTURE: {
+            Texture2D texture = rl_replay_texture(reader);
+            int posX;
+            rl_replay_value(reader, &posX, sizeof(posX));
+            int posY;
+            rl_replay_value(reader, &posY, sizeof(posY));
+            Color tint;
+            rl_replay_value(reader, &tint, sizeof(tint));
+            DrawTexture(texture, posX, posY, tint);
+        } return true;
+        case RL_CALL_DRAW_TEXTURE_V: {
+            Texture2D texture = rl_replay_texture(reader);
+            Vector2 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            Color tint;
+            rl_replay_value(reader, &tint, sizeof(tint));
+            DrawTextureV(texture, position, tint);
+        } return true;
+        case RL_CALL_DRAW_TEXTURE_EX: {
+            Texture2D texture = rl_replay_texture(reader);
+            Vector2 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            float rotation;
+            rl_replay_value(reader, &rotation, sizeof(rotation));
+            float scale;
+            rl_replay_value(reader, &scale, sizeof(scale));
+            Color tint;
+            rl_replay_value(reader, &tint, sizeof(tint));
+            DrawTextureEx(texture, position, rotation, scale, tint);
+        } return true;
+        case RL_CALL_DRAW_TEXTURE_REC: {
+            Texture2D texture = rl_replay_texture(reader);
+            Rectangle source;
+            rl_replay_value(reader, &source, sizeof(source));
+            Vector2 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            Color tint;
+            rl_replay_value(reader, &tint, sizeof(tint));
+            DrawTextureRec(texture, source, position, tint);
+        } return true;
+        case RL_CALL_DRAW_TEXTURE_PRO: {
+            Texture2D texture = rl_replay_texture(reader);
+            Rectangle source;
+            rl_replay_value(reader, &source, sizeof(source));
+            Rectangle dest;
+            rl_replay_value(reader, &dest, sizeof(dest));
+            Vector2 origin;
+            rl_replay_value(reader, &origin, sizeof(origin));
+            float rotation;
+            rl_replay_value(reader, &rotation, sizeof(rotation));
+            Color tint;
+            rl_replay_value(reader, &tint, sizeof(tint));
+            DrawTexturePro(texture, source, dest, origin, rotation, tint);
+        } return true;
+        case RL_CALL_DRAW_TEXTURE_N_PATCH: {
+            Texture2D texture = rl_replay_texture(reader);
+            NPatchInfo nPatchInfo;
+            rl_replay_value(reader, &nPatchInfo, sizeof(nPatchInfo));
+            Rectangle dest;
+            rl_replay_value(reader, &dest, sizeof(dest));
+            Vector2 origin;
+            rl_replay_value(reader, &origin, sizeof(origin));
+            float rotation;
+            rl_replay_value(reader, &rotation, sizeof(rotation));
+            Color tint;
+            rl_replay_value(reader, &tint, sizeof(tint));
+            DrawTextureNPatch(texture, nPatchInfo, dest, origin, rotation, tint);
+        } return true;
+        case RL_CALL_COLOR_IS_EQUAL: {
+            Color col1;
+            rl_replay_value(reader, &col1, sizeof(col1));
+            Color col2;
+            rl_replay_value(reader, &col2, sizeof(col2));
+            (void)ColorIsEqual(col1, col2);
+        } return true;
+        case RL_CALL_FADE: {
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            float alpha;
+            rl_replay_value(reader, &alpha, sizeof(alpha));
+            (void)Fade(color, alpha);
+        } return true;
+        case RL_CALL_COLOR_TO_INT: {
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            (void)ColorToInt(color);
+        } return true;
+        case RL_CALL_COLOR_NORMALIZE: {
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            (void)ColorNormalize(color);
+        } return true;
+        case RL_CALL_COLOR_FROM_NORMALIZED: {
+            Vector4 normalized;
+            rl_replay_value(reader, &normalized, sizeof(normalized));
+            (void)ColorFromNormalized(normalized);
+        } return true;
+        case RL_CALL_COLOR_TO_HSV: {
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            (void)ColorToHSV(color);
+        } return true;
+        case RL_CALL_COLOR_FROM_HSV: {
+            float hue;
+            rl_replay_value(reader, &hue, sizeof(hue));
+            float saturation;
+            rl_replay_value(reader, &saturation, sizeof(saturation));
+            float value;
+            rl_replay_value(reader, &value, sizeof(value));
+            (void)ColorFromHSV(hue, saturation, value);
+        } return true;
+        case RL_CALL_COLOR_TINT: {
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            Color tint;
+            rl_replay_value(reader, &tint, sizeof(tint));
+            (void)ColorTint(color, tint);
+        } return true;
+        case RL_CALL_COLOR_BRIGHTNESS: {
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            float factor;
+            rl_replay_value(reader, &factor, sizeof(factor));
+            (void)ColorBrightness(color, factor);
+        } return true;
+        case RL_CALL_COLOR_CONTRAST: {
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            float contrast;
+            rl_replay_value(reader, &contrast, sizeof(contrast));
+            (void)ColorContrast(color, contrast);
+        } return true;
+        case RL_CALL_COLOR_ALPHA: {
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            float alpha;
+            rl_replay_value(reader, &alpha, sizeof(alpha));
+            (void)ColorAlpha(color, alpha);
+        } return true;
+        case RL_CALL_COLOR_ALPHA_BLEND: {
+            Color dst;
+            rl_replay_value(reader, &dst, sizeof(dst));
+            Color src;
+            rl_replay_value(reader, &src, sizeof(src));
+            Color tint;
+            rl_replay_value(reader, &tint, sizeof(tint));
+            (void)ColorAlphaBlend(dst, src, tint);
+        } return true;
+        case RL_CALL_COLOR_LERP: {
+            Color color1;
+            rl_replay_value(reader, &color1, sizeof(color1));
+            Color color2;
+            rl_replay_value(reader, &color2, sizeof(color2));
+            float factor;
+            rl_replay_value(reader, &factor, sizeof(factor));
+            (void)ColorLerp(color1, color2, factor);
+        } return true;
+        case RL_CALL_GET_COLOR: {
+            unsigned int hexValue;
+            rl_replay_value(reader, &hexValue, sizeof(hexValue));
+            (void)GetColor(hexValue);
+        } return true;
+        case RL_CALL_GET_PIXEL_DATA_SIZE: {
+            int width;
+            rl_replay_value(reader, &width, sizeof(width));
+            int height;
+            rl_replay_value(reader, &height, sizeof(height));
+            int format;
+            rl_replay_value(reader, &format, sizeof(format));
+            (void)GetPixelDataSize(width, height, format);
+        } return true;
+        case RL_CALL_DRAW_FPS: {
+            int posX;
+            rl_replay_value(reader, &posX, sizeof(posX));
+            int posY;
+            rl_replay_value(reader, &posY, sizeof(posY));
+            DrawFPS(posX, posY);
+        } return true;
+        case RL_CALL_DRAW_TEXT: {
+            const char *text = rl_replay_string(reader);
+            int posX;
+            rl_replay_value(reader, &posX, sizeof(posX));
+            int posY;
+            rl_replay_value(reader, &posY, sizeof(posY));
+            int fontSize;
+            rl_replay_value(reader, &fontSize, sizeof(fontSize));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawText(text, posX, posY, fontSize, color);
+        } return true;
+        case RL_CALL_SET_TEXT_LINE_SPACING: {
+            int spacing;
+            rl_replay_value(reader, &spacing, sizeof(spacing));
+            SetTextLineSpacing(spacing);
+        } return true;
+        case RL_CALL_MEASURE_TEXT: {
+            const char *text = rl_replay_string(reader);
+            int fontSize;
+            rl_replay_value(reader, &fontSize, sizeof(fontSize));
+            (void)MeasureText(text, fontSize);
+        } return true;
+        case RL_CALL_GET_CODEPOINT_COUNT: {
+            const char *text = rl_replay_string(reader);
+            (void)GetCodepointCount(text);
+        } return true;
+        case RL_CALL_TEXT_IS_EQUAL: {
+            const char *text1 = rl_replay_string(reader);
+            const char *text2 = rl_replay_string(reader);
+            (void)TextIsEqual(text1, text2);
+        } return true;
+        case RL_CALL_TEXT_LENGTH: {
+            const char *text = rl_replay_string(reader);
+            (void)TextLength(text);
+        } return true;
+        case RL_CALL_TEXT_SUBTEXT: {
+            const char *text = rl_replay_string(reader);
+            int position;
+            rl_replay_value(reader, &position, sizeof(position));
+            int length;
+            rl_replay_value(reader, &length, sizeof(length));
+            (void)TextSubtext(text, position, length);
+        } return true;
+        case RL_CALL_TEXT_FIND_INDEX: {
+            const char *text = rl_replay_string(reader);
+            const char *find = rl_replay_string(reader);
+            (void)TextFindIndex(text, find);
+        } return true;
+        case RL_CALL_TEXT_TO_UPPER: {
+            const char *text = rl_replay_string(reader);
+            (void)TextToUpper(text);
+        } return true;
+        case RL_CALL_TEXT_TO_LOWER: {
+            const char *text = rl_replay_string(reader);
+            (void)TextToLower(text);
+        } return true;
+        case RL_CALL_TEXT_TO_PASCAL: {
+            const char *text = rl_replay_string(reader);
+            (void)TextToPascal(text);
+        } return true;
+        case RL_CALL_TEXT_TO_SNAKE: {
+            const char *text = rl_replay_string(reader);
+            (void)TextToSnake(text);
+        } return true;
+        case RL_CALL_TEXT_TO_CAMEL: {
+            const char *text = rl_replay_string(reader);
+            (void)TextToCamel(text);
+        } return true;
+        case RL_CALL_TEXT_TO_INTEGER: {
+            const char *text = rl_replay_string(reader);
+            (void)TextToInteger(text);
+        } return true;
+        case RL_CALL_TEXT_TO_FLOAT: {
+            const char *text = rl_replay_string(reader);
+            (void)TextToFloat(text);
+        } return true;
+        case RL_CALL_DRAW_LINE3_D: {
+            Vector3 startPos;
+            rl_replay_value(reader, &startPos, sizeof(startPos));
+            Vector3 endPos;
+            rl_replay_value(reader, &endPos, sizeof(endPos));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawLine3D(startPos, endPos, color);
+        } return true;
+        case RL_CALL_DRAW_POINT3_D: {
+            Vector3 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawPoint3D(position, color);
+        } return true;
+        case RL_CALL_DRAW_CIRCLE3_D: {
+            Vector3 center;
+            rl_replay_value(reader, &center, sizeof(center));
+            float radius;
+            rl_replay_value(reader, &radius, sizeof(radius));
+            Vector3 rotationAxis;
+            rl_replay_value(reader, &rotationAxis, sizeof(rotationAxis));
+            float rotationAngle;
+            rl_replay_value(reader, &rotationAngle, sizeof(rotationAngle));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawCircle3D(center, radius, rotationAxis, rotationAngle, color);
+        } return true;
+        case RL_CALL_DRAW_TRIANGLE3_D: {
+            Vector3 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector3 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            Vector3 v3;
+            rl_replay_value(reader, &v3, sizeof(v3));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawTriangle3D(v1, v2, v3, color);
+        } return true;
+        case RL_CALL_DRAW_CUBE: {
+            Vector3 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            float width;
+            rl_replay_value(reader, &width, sizeof(width));
+            float height;
+            rl_replay_value(reader, &height, sizeof(height));
+            float length;
+            rl_replay_value(reader, &length, sizeof(length));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawCube(position, width, height, length, color);
+        } return true;
+        case RL_CALL_DRAW_CUBE_V: {
+            Vector3 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            Vector3 size;
+            rl_replay_value(reader, &size, sizeof(size));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawCubeV(position, size, color);
+        } return true;
+        case RL_CALL_DRAW_CUBE_WIRES: {
+            Vector3 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            float width;
+            rl_replay_value(reader, &width, sizeof(width));
+            float height;
+            rl_replay_value(reader, &height, sizeof(height));
+            float length;
+            rl_replay_value(reader, &length, sizeof(length));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawCubeWires(position, width, height, length, color);
+        } return true;
+        case RL_CALL_DRAW_CUBE_WIRES_V: {
+            Vector3 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            Vector3 size;
+            rl_replay_value(reader, &size, sizeof(size));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawCubeWiresV(position, size, color);
+        } return true;
+        case RL_CALL_DRAW_SPHERE: {
+            Vector3 centerPos;
+            rl_replay_value(reader, &centerPos, sizeof(centerPos));
+            float radius;
+            rl_replay_value(reader, &radius, sizeof(radius));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawSphere(centerPos, radius, color);
+        } return true;
+        case RL_CALL_DRAW_SPHERE_EX: {
+            Vector3 centerPos;
+            rl_replay_value(reader, &centerPos, sizeof(centerPos));
+            float radius;
+            rl_replay_value(reader, &radius, sizeof(radius));
+            int rings;
+            rl_replay_value(reader, &rings, sizeof(rings));
+            int slices;
+            rl_replay_value(reader, &slices, sizeof(slices));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawSphereEx(centerPos, radius, rings, slices, color);
+        } return true;
+        case RL_CALL_DRAW_SPHERE_WIRES: {
+            Vector3 centerPos;
+            rl_replay_value(reader, &centerPos, sizeof(centerPos));
+            float radius;
+            rl_replay_value(reader, &radius, sizeof(radius));
+            int rings;
+            rl_replay_value(reader, &rings, sizeof(rings));
+            int slices;
+            rl_replay_value(reader, &slices, sizeof(slices));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawSphereWires(centerPos, radius, rings, slices, color);
+        } return true;
+        case RL_CALL_DRAW_CYLINDER: {
+            Vector3 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            float radiusTop;
+            rl_replay_value(reader, &radiusTop, sizeof(radiusTop));
+            float radiusBottom;
+            rl_replay_value(reader, &radiusBottom, sizeof(radiusBottom));
+            float height;
+            rl_replay_value(reader, &height, sizeof(height));
+            int slices;
+            rl_replay_value(reader, &slices, sizeof(slices));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawCylinder(position, radiusTop, radiusBottom, height, slices, color);
+        } return true;
+        case RL_CALL_DRAW_CYLINDER_EX: {
+            Vector3 startPos;
+            rl_replay_value(reader, &startPos, sizeof(startPos));
+            Vector3 endPos;
+            rl_replay_value(reader, &endPos, sizeof(endPos));
+            float startRadius;
+            rl_replay_value(reader, &startRadius, sizeof(startRadius));
+            float endRadius;
+            rl_replay_value(reader, &endRadius, sizeof(endRadius));
+            int sides;
+            rl_replay_value(reader, &sides, sizeof(sides));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawCylinderEx(startPos, endPos, startRadius, endRadius, sides, color);
+        } return true;
+        case RL_CALL_DRAW_CYLINDER_WIRES: {
+            Vector3 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            float radiusTop;
+            rl_replay_value(reader, &radiusTop, sizeof(radiusTop));
+            float radiusBottom;
+            rl_replay_value(reader, &radiusBottom, sizeof(radiusBottom));
+            float height;
+            rl_replay_value(reader, &height, sizeof(height));
+            int slices;
+            rl_replay_value(reader, &slices, sizeof(slices));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawCylinderWires(position, radiusTop, radiusBottom, height, slices, color);
+        } return true;
+        case RL_CALL_DRAW_CYLINDER_WIRES_EX: {
+            Vector3 startPos;
+            rl_replay_value(reader, &startPos, sizeof(startPos));
+            Vector3 endPos;
+            rl_replay_value(reader, &endPos, sizeof(endPos));
+            float startRadius;
+            rl_replay_value(reader, &startRadius, sizeof(startRadius));
+            float endRadius;
+            rl_replay_value(reader, &endRadius, sizeof(endRadius));
+            int sides;
+            rl_replay_value(reader, &sides, sizeof(sides));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawCylinderWiresEx(startPos, endPos, startRadius, endRadius, sides, color);
+        } return true;
+        case RL_CALL_DRAW_CAPSULE: {
+            Vector3 startPos;
+            rl_replay_value(reader, &startPos, sizeof(startPos));
+            Vector3 endPos;
+            rl_replay_value(reader, &endPos, sizeof(endPos));
+            float radius;
+            rl_replay_value(reader, &radius, sizeof(radius));
+            int slices;
+            rl_replay_value(reader, &slices, sizeof(slices));
+            int rings;
+            rl_replay_value(reader, &rings, sizeof(rings));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawCapsule(startPos, endPos, radius, slices, rings, color);
+        } return true;
+        case RL_CALL_DRAW_CAPSULE_WIRES: {
+            Vector3 startPos;
+            rl_replay_value(reader, &startPos, sizeof(startPos));
+            Vector3 endPos;
+            rl_replay_value(reader, &endPos, sizeof(endPos));
+            float radius;
+            rl_replay_value(reader, &radius, sizeof(radius));
+            int slices;
+            rl_replay_value(reader, &slices, sizeof(slices));
+            int rings;
+            rl_replay_value(reader, &rings, sizeof(rings));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawCapsuleWires(startPos, endPos, radius, slices, rings, color);
+        } return true;
+        case RL_CALL_DRAW_PLANE: {
+            Vector3 centerPos;
+            rl_replay_value(reader, &centerPos, sizeof(centerPos));
+            Vector2 size;
+            rl_replay_value(reader, &size, sizeof(size));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawPlane(centerPos, size, color);
+        } return true;
+        case RL_CALL_DRAW_RAY: {
+            Ray ray;
+            rl_replay_value(reader, &ray, sizeof(ray));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawRay(ray, color);
+        } return true;
+        case RL_CALL_DRAW_GRID: {
+            int slices;
+            rl_replay_value(reader, &slices, sizeof(slices));
+            float spacing;
+            rl_replay_value(reader, &spacing, sizeof(spacing));
+            DrawGrid(slices, spacing);
+        } return true;
+        case RL_CALL_DRAW_BOUNDING_BOX: {
+            BoundingBox box;
+            rl_replay_value(reader, &box, sizeof(box));
+            Color color;
+            rl_replay_value(reader, &color, sizeof(color));
+            DrawBoundingBox(box, color);
+        } return true;
+        case RL_CALL_DRAW_BILLBOARD: {
+            Camera camera;
+            rl_replay_value(reader, &camera, sizeof(camera));
+            Texture2D texture = rl_replay_texture(reader);
+            Vector3 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            float scale;
+            rl_replay_value(reader, &scale, sizeof(scale));
+            Color tint;
+            rl_replay_value(reader, &tint, sizeof(tint));
+            DrawBillboard(camera, texture, position, scale, tint);
+        } return true;
+        case RL_CALL_DRAW_BILLBOARD_REC: {
+            Camera camera;
+            rl_replay_value(reader, &camera, sizeof(camera));
+            Texture2D texture = rl_replay_texture(reader);
+            Rectangle source;
+            rl_replay_value(reader, &source, sizeof(source));
+            Vector3 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            Vector2 size;
+            rl_replay_value(reader, &size, sizeof(size));
+            Color tint;
+            rl_replay_value(reader, &tint, sizeof(tint));
+            DrawBillboardRec(camera, texture, source, position, size, tint);
+        } return true;
+        case RL_CALL_DRAW_BILLBOARD_PRO: {
+            Camera camera;
+            rl_replay_value(reader, &camera, sizeof(camera));
+            Texture2D texture = rl_replay_texture(reader);
+            Rectangle source;
+            rl_replay_value(reader, &source, sizeof(source));
+            Vector3 position;
+            rl_replay_value(reader, &position, sizeof(position));
+            Vector3 up;
+            rl_replay_value(reader, &up, sizeof(up));
+            Vector2 size;
+            rl_replay_value(reader, &size, sizeof(size));
+            Vector2 origin;
+            rl_replay_value(reader, &origin, sizeof(origin));
+            float rotation;
+            rl_replay_value(reader, &rotation, sizeof(rotation));
+            Color tint;
+            rl_replay_value(reader, &tint, sizeof(tint));
+            DrawBillboardPro(camera, texture, source, position, up, size, origin, rotation, tint);
+        } return true;
+        case RL_CALL_CHECK_COLLISION_SPHERES: {
+            Vector3 center1;
+            rl_replay_value(reader, &center1, sizeof(center1));
+            float radius1;
+            rl_replay_value(reader, &radius1, sizeof(radius1));
+            Vector3 center2;
+            rl_replay_value(reader, &center2, sizeof(center2));
+            float radius2;
+            rl_replay_value(reader, &radius2, sizeof(radius2));
+            (void)CheckCollisionSpheres(center1, radius1, center2, radius2);
+        } return true;
+        case RL_CALL_CHECK_COLLISION_BOXES: {
+            BoundingBox box1;
+            rl_replay_value(reader, &box1, sizeof(box1));
+            BoundingBox box2;
+            rl_replay_value(reader, &box2, sizeof(box2));
+            (void)CheckCollisionBoxes(box1, box2);
+        } return true;
+        case RL_CALL_CHECK_COLLISION_BOX_SPHERE: {
+            BoundingBox box;
+            rl_replay_value(reader, &box, sizeof(box));
+            Vector3 center;
+            rl_replay_value(reader, &center, sizeof(center));
+            float radius;
+            rl_replay_value(reader, &radius, sizeof(radius));
+            (void)CheckCollisionBoxSphere(box, center, radius);
+        } return true;
+        case RL_CALL_INIT_AUDIO_DEVICE: {
+            InitAudioDevice();
+        } return true;
+        case RL_CALL_CLOSE_AUDIO_DEVICE: {
+            CloseAudioDevice();
+        } return true;
+        case RL_CALL_IS_AUDIO_DEVICE_READY: {
+            (void)IsAudioDeviceReady();
+        } return true;
+        case RL_CALL_SET_MASTER_VOLUME: {
+            float volume;
+            rl_replay_value(reader, &volume, sizeof(volume));
+            SetMasterVolume(volume);
+        } return true;
+        case RL_CALL_GET_MASTER_VOLUME: {
+            (void)GetMasterVolume();
+        } return true;
+        case RL_CALL_SET_AUDIO_STREAM_BUFFER_SIZE_DEFAULT: {
+            int size;
+            rl_replay_value(reader, &size, sizeof(size));
+            SetAudioStreamBufferSizeDefault(size);
+        } return true;
+        case RL_CALL_CLAMP: {
+            float value;
+            rl_replay_value(reader, &value, sizeof(value));
+            float min;
+            rl_replay_value(reader, &min, sizeof(min));
+            float max;
+            rl_replay_value(reader, &max, sizeof(max));
+            (void)Clamp(value, min, max);
+        } return true;
+        case RL_CALL_LERP: {
+            float start;
+            rl_replay_value(reader, &start, sizeof(start));
+            float end;
+            rl_replay_value(reader, &end, sizeof(end));
+            float amount;
+            rl_replay_value(reader, &amount, sizeof(amount));
+            (void)Lerp(start, end, amount);
+        } return true;
+        case RL_CALL_NORMALIZE: {
+            float value;
+            rl_replay_value(reader, &value, sizeof(value));
+            float start;
+            rl_replay_value(reader, &start, sizeof(start));
+            float end;
+            rl_replay_value(reader, &end, sizeof(end));
+            (void)Normalize(value, start, end);
+        } return true;
+        case RL_CALL_REMAP: {
+            float value;
+            rl_replay_value(reader, &value, sizeof(value));
+            float inputStart;
+            rl_replay_value(reader, &inputStart, sizeof(inputStart));
+            float inputEnd;
+            rl_replay_value(reader, &inputEnd, sizeof(inputEnd));
+            float outputStart;
+            rl_replay_value(reader, &outputStart, sizeof(outputStart));
+            float outputEnd;
+            rl_replay_value(reader, &outputEnd, sizeof(outputEnd));
+            (void)Remap(value, inputStart, inputEnd, outputStart, outputEnd);
+        } return true;
+        case RL_CALL_WRAP: {
+            float value;
+            rl_replay_value(reader, &value, sizeof(value));
+            float min;
+            rl_replay_value(reader, &min, sizeof(min));
+            float max;
+            rl_replay_value(reader, &max, sizeof(max));
+            (void)Wrap(value, min, max);
+        } return true;
+        case RL_CALL_FLOAT_EQUALS: {
+            float x;
+            rl_replay_value(reader, &x, sizeof(x));
+            float y;
+            rl_replay_value(reader, &y, sizeof(y));
+            (void)FloatEquals(x, y);
+        } return true;
+        case RL_CALL_VECTOR2_ZERO: {
+            (void)Vector2Zero();
+        } return true;
+        case RL_CALL_VECTOR2_ONE: {
+            (void)Vector2One();
+        } return true;
+        case RL_CALL_VECTOR2_ADD: {
+            Vector2 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector2 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector2Add(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR2_ADD_VALUE: {
+            Vector2 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            float add;
+            rl_replay_value(reader, &add, sizeof(add));
+            (void)Vector2AddValue(v, add);
+        } return true;
+        case RL_CALL_VECTOR2_SUBTRACT: {
+            Vector2 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector2 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector2Subtract(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR2_SUBTRACT_VALUE: {
+            Vector2 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            float sub;
+            rl_replay_value(reader, &sub, sizeof(sub));
+            (void)Vector2SubtractValue(v, sub);
+        } return true;
+        case RL_CALL_VECTOR2_LENGTH: {
+            Vector2 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            (void)Vector2Length(v);
+        } return true;
+        case RL_CALL_VECTOR2_LENGTH_SQR: {
+            Vector2 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            (void)Vector2LengthSqr(v);
+        } return true;
+        case RL_CALL_VECTOR2_DOT_PRODUCT: {
+            Vector2 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector2 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector2DotProduct(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR2_DISTANCE: {
+            Vector2 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector2 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector2Distance(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR2_DISTANCE_SQR: {
+            Vector2 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector2 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector2DistanceSqr(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR2_ANGLE: {
+            Vector2 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector2 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector2Angle(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR2_LINE_ANGLE: {
+            Vector2 start;
+            rl_replay_value(reader, &start, sizeof(start));
+            Vector2 end;
+            rl_replay_value(reader, &end, sizeof(end));
+            (void)Vector2LineAngle(start, end);
+        } return true;
+        case RL_CALL_VECTOR2_SCALE: {
+            Vector2 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            float scale;
+            rl_replay_value(reader, &scale, sizeof(scale));
+            (void)Vector2Scale(v, scale);
+        } return true;
+        case RL_CALL_VECTOR2_MULTIPLY: {
+            Vector2 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector2 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector2Multiply(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR2_NEGATE: {
+            Vector2 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            (void)Vector2Negate(v);
+        } return true;
+        case RL_CALL_VECTOR2_DIVIDE: {
+            Vector2 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector2 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector2Divide(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR2_NORMALIZE: {
+            Vector2 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            (void)Vector2Normalize(v);
+        } return true;
+        case RL_CALL_VECTOR2_TRANSFORM: {
+            Vector2 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            Matrix mat;
+            rl_replay_value(reader, &mat, sizeof(mat));
+            (void)Vector2Transform(v, mat);
+        } return true;
+        case RL_CALL_VECTOR2_LERP: {
+            Vector2 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector2 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            float amount;
+            rl_replay_value(reader, &amount, sizeof(amount));
+            (void)Vector2Lerp(v1, v2, amount);
+        } return true;
+        case RL_CALL_VECTOR2_REFLECT: {
+            Vector2 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            Vector2 normal;
+            rl_replay_value(reader, &normal, sizeof(normal));
+            (void)Vector2Reflect(v, normal);
+        } return true;
+        case RL_CALL_VECTOR2_MIN: {
+            Vector2 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector2 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector2Min(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR2_MAX: {
+            Vector2 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector2 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector2Max(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR2_ROTATE: {
+            Vector2 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            float angle;
+            rl_replay_value(reader, &angle, sizeof(angle));
+            (void)Vector2Rotate(v, angle);
+        } return true;
+        case RL_CALL_VECTOR2_MOVE_TOWARDS: {
+            Vector2 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            Vector2 target;
+            rl_replay_value(reader, &target, sizeof(target));
+            float maxDistance;
+            rl_replay_value(reader, &maxDistance, sizeof(maxDistance));
+            (void)Vector2MoveTowards(v, target, maxDistance);
+        } return true;
+        case RL_CALL_VECTOR2_INVERT: {
+            Vector2 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            (void)Vector2Invert(v);
+        } return true;
+        case RL_CALL_VECTOR2_CLAMP: {
+            Vector2 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            Vector2 min;
+            rl_replay_value(reader, &min, sizeof(min));
+            Vector2 max;
+            rl_replay_value(reader, &max, sizeof(max));
+            (void)Vector2Clamp(v, min, max);
+        } return true;
+        case RL_CALL_VECTOR2_CLAMP_VALUE: {
+            Vector2 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            float min;
+            rl_replay_value(reader, &min, sizeof(min));
+            float max;
+            rl_replay_value(reader, &max, sizeof(max));
+            (void)Vector2ClampValue(v, min, max);
+        } return true;
+        case RL_CALL_VECTOR2_EQUALS: {
+            Vector2 p;
+            rl_replay_value(reader, &p, sizeof(p));
+            Vector2 q;
+            rl_replay_value(reader, &q, sizeof(q));
+            (void)Vector2Equals(p, q);
+        } return true;
+        case RL_CALL_VECTOR2_REFRACT: {
+            Vector2 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            Vector2 n;
+            rl_replay_value(reader, &n, sizeof(n));
+            float r;
+            rl_replay_value(reader, &r, sizeof(r));
+            (void)Vector2Refract(v, n, r);
+        } return true;
+        case RL_CALL_VECTOR3_ZERO: {
+            (void)Vector3Zero();
+        } return true;
+        case RL_CALL_VECTOR3_ONE: {
+            (void)Vector3One();
+        } return true;
+        case RL_CALL_VECTOR3_ADD: {
+            Vector3 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector3 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector3Add(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR3_ADD_VALUE: {
+            Vector3 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            float add;
+            rl_replay_value(reader, &add, sizeof(add));
+            (void)Vector3AddValue(v, add);
+        } return true;
+        case RL_CALL_VECTOR3_SUBTRACT: {
+            Vector3 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector3 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector3Subtract(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR3_SUBTRACT_VALUE: {
+            Vector3 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            float sub;
+            rl_replay_value(reader, &sub, sizeof(sub));
+            (void)Vector3SubtractValue(v, sub);
+        } return true;
+        case RL_CALL_VECTOR3_SCALE: {
+            Vector3 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            float scalar;
+            rl_replay_value(reader, &scalar, sizeof(scalar));
+            (void)Vector3Scale(v, scalar);
+        } return true;
+        case RL_CALL_VECTOR3_MULTIPLY: {
+            Vector3 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector3 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector3Multiply(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR3_CROSS_PRODUCT: {
+            Vector3 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector3 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector3CrossProduct(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR3_PERPENDICULAR: {
+            Vector3 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            (void)Vector3Perpendicular(v);
+        } return true;
+        case RL_CALL_VECTOR3_LENGTH: {
+            Vector3 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            (void)Vector3Length(v);
+        } return true;
+        case RL_CALL_VECTOR3_LENGTH_SQR: {
+            Vector3 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            (void)Vector3LengthSqr(v);
+        } return true;
+        case RL_CALL_VECTOR3_DOT_PRODUCT: {
+            Vector3 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector3 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector3DotProduct(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR3_DISTANCE: {
+            Vector3 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector3 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector3Distance(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR3_DISTANCE_SQR: {
+            Vector3 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector3 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector3DistanceSqr(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR3_ANGLE: {
+            Vector3 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector3 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector3Angle(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR3_NEGATE: {
+            Vector3 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            (void)Vector3Negate(v);
+        } return true;
+        case RL_CALL_VECTOR3_DIVIDE: {
+            Vector3 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector3 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector3Divide(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR3_NORMALIZE: {
+            Vector3 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            (void)Vector3Normalize(v);
+        } return true;
+        case RL_CALL_VECTOR3_PROJECT: {
+            Vector3 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector3 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector3Project(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR3_REJECT: {
+            Vector3 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector3 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector3Reject(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR3_TRANSFORM: {
+            Vector3 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            Matrix mat;
+            rl_replay_value(reader, &mat, sizeof(mat));
+            (void)Vector3Transform(v, mat);
+        } return true;
+        case RL_CALL_VECTOR3_ROTATE_BY_QUATERNION: {
+            Vector3 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            Quaternion q;
+            rl_replay_value(reader, &q, sizeof(q));
+            (void)Vector3RotateByQuaternion(v, q);
+        } return true;
+        case RL_CALL_VECTOR3_ROTATE_BY_AXIS_ANGLE: {
+            Vector3 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            Vector3 axis;
+            rl_replay_value(reader, &axis, sizeof(axis));
+            float angle;
+            rl_replay_value(reader, &angle, sizeof(angle));
+            (void)Vector3RotateByAxisAngle(v, axis, angle);
+        } return true;
+        case RL_CALL_VECTOR3_MOVE_TOWARDS: {
+            Vector3 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            Vector3 target;
+            rl_replay_value(reader, &target, sizeof(target));
+            float maxDistance;
+            rl_replay_value(reader, &maxDistance, sizeof(maxDistance));
+            (void)Vector3MoveTowards(v, target, maxDistance);
+        } return true;
+        case RL_CALL_VECTOR3_LERP: {
+            Vector3 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector3 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            float amount;
+            rl_replay_value(reader, &amount, sizeof(amount));
+            (void)Vector3Lerp(v1, v2, amount);
+        } return true;
+        case RL_CALL_VECTOR3_CUBIC_HERMITE: {
+            Vector3 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector3 tangent1;
+            rl_replay_value(reader, &tangent1, sizeof(tangent1));
+            Vector3 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            Vector3 tangent2;
+            rl_replay_value(reader, &tangent2, sizeof(tangent2));
+            float amount;
+            rl_replay_value(reader, &amount, sizeof(amount));
+            (void)Vector3CubicHermite(v1, tangent1, v2, tangent2, amount);
+        } return true;
+        case RL_CALL_VECTOR3_REFLECT: {
+            Vector3 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            Vector3 normal;
+            rl_replay_value(reader, &normal, sizeof(normal));
+            (void)Vector3Reflect(v, normal);
+        } return true;
+        case RL_CALL_VECTOR3_MIN: {
+            Vector3 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector3 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector3Min(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR3_MAX: {
+            Vector3 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector3 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector3Max(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR3_BARYCENTER: {
+            Vector3 p;
+            rl_replay_value(reader, &p, sizeof(p));
+            Vector3 a;
+            rl_replay_value(reader, &a, sizeof(a));
+            Vector3 b;
+            rl_replay_value(reader, &b, sizeof(b));
+            Vector3 c;
+            rl_replay_value(reader, &c, sizeof(c));
+            (void)Vector3Barycenter(p, a, b, c);
+        } return true;
+        case RL_CALL_VECTOR3_UNPROJECT: {
+            Vector3 source;
+            rl_replay_value(reader, &source, sizeof(source));
+            Matrix projection;
+            rl_replay_value(reader, &projection, sizeof(projection));
+            Matrix view;
+            rl_replay_value(reader, &view, sizeof(view));
+            (void)Vector3Unproject(source, projection, view);
+        } return true;
+        case RL_CALL_VECTOR3_INVERT: {
+            Vector3 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            (void)Vector3Invert(v);
+        } return true;
+        case RL_CALL_VECTOR3_CLAMP: {
+            Vector3 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            Vector3 min;
+            rl_replay_value(reader, &min, sizeof(min));
+            Vector3 max;
+            rl_replay_value(reader, &max, sizeof(max));
+            (void)Vector3Clamp(v, min, max);
+        } return true;
+        case RL_CALL_VECTOR3_CLAMP_VALUE: {
+            Vector3 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            float min;
+            rl_replay_value(reader, &min, sizeof(min));
+            float max;
+            rl_replay_value(reader, &max, sizeof(max));
+            (void)Vector3ClampValue(v, min, max);
+        } return true;
+        case RL_CALL_VECTOR3_EQUALS: {
+            Vector3 p;
+            rl_replay_value(reader, &p, sizeof(p));
+            Vector3 q;
+            rl_replay_value(reader, &q, sizeof(q));
+            (void)Vector3Equals(p, q);
+        } return true;
+        case RL_CALL_VECTOR3_REFRACT: {
+            Vector3 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            Vector3 n;
+            rl_replay_value(reader, &n, sizeof(n));
+            float r;
+            rl_replay_value(reader, &r, sizeof(r));
+            (void)Vector3Refract(v, n, r);
+        } return true;
+        case RL_CALL_VECTOR4_ZERO: {
+            (void)Vector4Zero();
+        } return true;
+        case RL_CALL_VECTOR4_ONE: {
+            (void)Vector4One();
+        } return true;
+        case RL_CALL_VECTOR4_ADD: {
+            Vector4 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector4 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector4Add(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR4_ADD_VALUE: {
+            Vector4 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            float add;
+            rl_replay_value(reader, &add, sizeof(add));
+            (void)Vector4AddValue(v, add);
+        } return true;
+        case RL_CALL_VECTOR4_SUBTRACT: {
+            Vector4 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector4 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector4Subtract(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR4_SUBTRACT_VALUE: {
+            Vector4 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            float add;
+            rl_replay_value(reader, &add, sizeof(add));
+            (void)Vector4SubtractValue(v, add);
+        } return true;
+        case RL_CALL_VECTOR4_LENGTH: {
+            Vector4 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            (void)Vector4Length(v);
+        } return true;
+        case RL_CALL_VECTOR4_LENGTH_SQR: {
+            Vector4 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            (void)Vector4LengthSqr(v);
+        } return true;
+        case RL_CALL_VECTOR4_DOT_PRODUCT: {
+            Vector4 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector4 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector4DotProduct(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR4_DISTANCE: {
+            Vector4 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector4 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector4Distance(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR4_DISTANCE_SQR: {
+            Vector4 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector4 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector4DistanceSqr(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR4_SCALE: {
+            Vector4 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            float scale;
+            rl_replay_value(reader, &scale, sizeof(scale));
+            (void)Vector4Scale(v, scale);
+        } return true;
+        case RL_CALL_VECTOR4_MULTIPLY: {
+            Vector4 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector4 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector4Multiply(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR4_NEGATE: {
+            Vector4 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            (void)Vector4Negate(v);
+        } return true;
+        case RL_CALL_VECTOR4_DIVIDE: {
+            Vector4 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector4 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector4Divide(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR4_NORMALIZE: {
+            Vector4 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            (void)Vector4Normalize(v);
+        } return true;
+        case RL_CALL_VECTOR4_MIN: {
+            Vector4 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector4 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector4Min(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR4_MAX: {
+            Vector4 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector4 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            (void)Vector4Max(v1, v2);
+        } return true;
+        case RL_CALL_VECTOR4_LERP: {
+            Vector4 v1;
+            rl_replay_value(reader, &v1, sizeof(v1));
+            Vector4 v2;
+            rl_replay_value(reader, &v2, sizeof(v2));
+            float amount;
+            rl_replay_value(reader, &amount, sizeof(amount));
+            (void)Vector4Lerp(v1, v2, amount);
+        } return true;
+        case RL_CALL_VECTOR4_MOVE_TOWARDS: {
+            Vector4 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            Vector4 target;
+            rl_replay_value(reader, &target, sizeof(target));
+            float maxDistance;
+            rl_replay_value(reader, &maxDistance, sizeof(maxDistance));
+            (void)Vector4MoveTowards(v, target, maxDistance);
+        } return true;
+        case RL_CALL_VECTOR4_INVERT: {
+            Vector4 v;
+            rl_replay_value(reader, &v, sizeof(v));
+            (void)Vector4Invert(v);
+        } return true;
+        case RL_CALL_VECTOR4_EQUALS: {
+            Vector4 p;
+            rl_replay_value(reader, &p, sizeof(p));
+            Vector4 q;
+            rl_replay_value(reader, &q, sizeof(q));
+            (void)Vector4Equals(p, q);
+        } return true;
+        case RL_CALL_MATRIX_DETERMINANT: {
+            Matrix mat;
+            rl_replay_value(reader, &mat, sizeof(mat));
+            (void)MatrixDeterminant(mat);
+        } return true;
+        case RL_CALL_MATRIX_TRACE: {
+            Matrix mat;
+            rl_replay_value(reader, &mat, sizeof(mat));
+            (void)MatrixTrace(mat);
+        } return true;
+        case RL_CALL_MATRIX_TRANSPOSE: {
+            Matrix mat;
+            rl_replay_value(reader, &mat, sizeof(mat));
+            (void)MatrixTranspose(mat);
+        } return true;
+        case RL_CALL_MATRIX_INVERT: {
+            Matrix mat;
+            rl_replay_value(reader, &mat, sizeof(mat));
+            (void)MatrixInvert(mat);
+        } return true;
+        case RL_CALL_MATRIX_IDENTITY: {
+            (void)MatrixIdentity();
+        } return true;
+        case RL_CALL_MATRIX_ADD: {
+            Matrix left;
+            rl_replay_value(reader, &left, sizeof(left));
+            Matrix right;
+            rl_replay_value(reader, &right, sizeof(right));
+            (void)MatrixAdd(left, right);
+        } return true;
+        case RL_CALL_MATRIX_SUBTRACT: {
+            Matrix left;
+            rl_replay_value(reader, &left, sizeof(left));
+            Matrix right;
+            rl_replay_value(reader, &right, sizeof(right));
+            (void)MatrixSubtract(left, right);
+        } return true;
+        case RL_CALL_MATRIX_MULTIPLY: {
+            Matrix left;
+            rl_replay_value(reader, &left, sizeof(left));
+            Matrix right;
+            rl_replay_value(reader, &right, sizeof(right));
+            (void)MatrixMultiply(left, right);
+        } return true;
+        case RL_CALL_MATRIX_TRANSLATE: {
+            float x;
+            rl_replay_value(reader, &x, sizeof(x));
+            float y;
+            rl_replay_value(reader, &y, sizeof(y));
+            float z;
+            rl_replay_value(reader, &z, sizeof(z));
+            (void)MatrixTranslate(x, y, z);
+        } return true;
+        case RL_CALL_MATRIX_ROTATE: {
+            Vector3 axis;
+            rl_replay_value(reader, &axis, sizeof(axis));
+            float angle;
+            rl_replay_value(reader, &angle, sizeof(angle));
+            (void)MatrixRotate(axis, angle);
+        } return true;
+        case RL_CALL_MATRIX_ROTATE_X: {
+            float angle;
+            rl_replay_value(reader, &angle, sizeof(angle));
+            (void)MatrixRotateX(angle);
+        } return true;
+        case RL_CALL_MATRIX_ROTATE_Y: {
+            float angle;
+            rl_replay_value(reader, &angle, sizeof(angle));
+            (void)MatrixRotateY(angle);
+        } return true;
+        case RL_CALL_MATRIX_ROTATE_Z: {
+            float angle;
+            rl_replay_value(reader, &angle, sizeof(angle));
+            (void)MatrixRotateZ(angle);
+        } return true;
+        case RL_CALL_MATRIX_ROTATE_XYZ: {
+            Vector3 angle;
+            rl_replay_value(reader, &angle, sizeof(angle));
+            (void)MatrixRotateXYZ(angle);
+        } return true;
+        case RL_CALL_MATRIX_ROTATE_ZYX: {
+            Vector3 angle;
+            rl_replay_value(reader, &angle, sizeof(angle));
+            (void)MatrixRotateZYX(angle);
+        } return true;
+        case RL_CALL_MATRIX_SCALE: {
+            float x;
+            rl_replay_value(reader, &x, sizeof(x));
+            float y;
+            rl_replay_value(reader, &y, sizeof(y));
+            float z;
+            rl_replay_value(reader, &z, sizeof(z));
+            (void)MatrixScale(x, y, z);
+        } return true;
+        case RL_CALL_MATRIX_FRUSTUM: {
+            double left;
+            rl_replay_value(reader, &left, sizeof(left));
+            double right;
+            rl_replay_value(reader, &right, sizeof(right));
+            double bottom;
+            rl_replay_value(reader, &bottom, sizeof(bottom));
+            double top;
+            rl_replay_value(reader, &top, sizeof(top));
+            double nearPlane;
+            rl_replay_value(reader, &nearPlane, sizeof(nearPlane));
+            double farPlane;
+            rl_replay_value(reader, &farPlane, sizeof(farPlane));
+            (void)MatrixFrustum(left, right, bottom, top, nearPlane, farPlane);
+        } return true;
+        case RL_CALL_MATRIX_PERSPECTIVE: {
+            double fovY;
+            rl_replay_value(reader, &fovY, sizeof(fovY));
+            double aspect;
+            rl_replay_value(reader, &aspect, sizeof(aspect));
+            double nearPlane;
+            rl_replay_value(reader, &nearPlane, sizeof(nearPlane));
+            double farPlane;
+            rl_replay_value(reader, &farPlane, sizeof(farPlane));
+            (void)MatrixPerspective(fovY, aspect, nearPlane, farPlane);
+        } return true;
+        case RL_CALL_MATRIX_ORTHO: {
+            double left;
+            rl_replay_value(reader, &left, sizeof(left));
+            double right;
+            rl_replay_value(reader, &right, sizeof(right));
+            double bottom;
+            rl_replay_value(reader, &bottom, sizeof(bottom));
+            double top;
+            rl_replay_value(reader, &top, sizeof(top));
+            double nearPlane;
+            rl_replay_value(reader, &nearPlane, sizeof(nearPlane));
+            double farPlane;
+            rl_replay_value(reader, &farPlane, sizeof(farPlane));
+            (void)MatrixOrtho(left, right, bottom, top, nearPlane, farPlane);
+        } return true;
+        case RL_CALL_MATRIX_LOOK_AT: {
+            Vector3 eye;
+            rl_replay_value(reader, &eye, sizeof(eye));
+            Vector3 target;
+            rl_replay_value(reader, &target, sizeof(target));
+            Vector3 up;
+            rl_replay_value(reader, &up, sizeof(up));
+            (void)MatrixLookAt(eye, target, up);
+        } return true;
+        case RL_CALL_QUATERNION_ADD: {
+            Quaternion q1;
+            rl_replay_value(reader, &q1, sizeof(q1));
+            Quaternion q2;
+            rl_replay_value(reader, &q2, sizeof(q2));
+            (void)QuaternionAdd(q1, q2);
+        } return true;
+        case RL_CALL_QUATERNION_ADD_VALUE: {
+            Quaternion q;
+            rl_replay_value(reader, &q, sizeof(q));
+            float add;
+            rl_replay_value(reader, &add, sizeof(add));
+            (void)QuaternionAddValue(q, add);
+        } return true;
+        case RL_CALL_QUATERNION_SUBTRACT: {
+            Quaternion q1;
+            rl_replay_value(reader, &q1, sizeof(q1));
+            Quaternion q2;
+            rl_replay_value(reader, &q2, sizeof(q2));
+            (void)QuaternionSubtract(q1, q2);
+        } return true;
+        case RL_CALL_QUATERNION_SUBTRACT_VALUE: {
+            Quaternion q;
+            rl_replay_value(reader, &q, sizeof(q));
+            float sub;
+            rl_replay_value(reader, &sub, sizeof(sub));
+            (void)QuaternionSubtractValue(q, sub);
+        } return true;
+        case RL_CALL_QUATERNION_IDENTITY: {
+            (void)QuaternionIdentity();
+        } return true;
+        case RL_CALL_QUATERNION_LENGTH: {
+            Quaternion q;
+            rl_replay_value(reader, &q, sizeof(q));
+            (void)QuaternionLength(q);
+        } return true;
+        case RL_CALL_QUATERNION_NORMALIZE: {
+            Quaternion q;
+            rl_replay_value(reader, &q, sizeof(q));
+            (void)QuaternionNormalize(q);
+        } return true;
+        case RL_CALL_QUATERNION_INVERT: {
+            Quaternion q;
+            rl_replay_value(reader, &q, sizeof(q));
+            (void)QuaternionInvert(q);
+        } return true;
+        case RL_CALL_QUATERNION_MULTIPLY: {
+            Quaternion q1;
+            rl_replay_value(reader, &q1, sizeof(q1));
+            Quaternion q2;
+            rl_replay_value(reader, &q2, sizeof(q2));
+            (void)QuaternionMultiply(q1, q2);
+        } return true;
+        case RL_CALL_QUATERNION_SCALE: {
+            Quaternion q;
+            rl_replay_value(reader, &q, sizeof(q));
+            float mul;
+            rl_replay_value(reader, &mul, sizeof(mul));
+            (void)QuaternionScale(q, mul);
+        } return true;
+        case RL_CALL_QUATERNION_DIVIDE: {
+            Quaternion q1;
+            rl_replay_value(reader, &q1, sizeof(q1));
+            Quaternion q2;
+            rl_replay_value(reader, &q2, sizeof(q2));
+            (void)QuaternionDivide(q1, q2);
+        } return true;
+        case RL_CALL_QUATERNION_LERP: {
+            Quaternion q1;
+            rl_replay_value(reader, &q1, sizeof(q1));
+            Quaternion q2;
+            rl_replay_value(reader, &q2, sizeof(q2));
+            float amount;
+            rl_replay_value(reader, &amount, sizeof(amount));
+            (void)QuaternionLerp(q1, q2, amount);
+        } return true;
+        case RL_CALL_QUATERNION_NLERP: {
+            Quaternion q1;
+            rl_replay_value(reader, &q1, sizeof(q1));
+            Quaternion q2;
+            rl_replay_value(reader, &q2, sizeof(q2));
+            float amount;
+            rl_replay_value(reader, &amount, sizeof(amount));
+            (void)QuaternionNlerp(q1, q2, amount);
+        } return true;
+        case RL_CALL_QUATERNION_SLERP: {
+            Quaternion q1;
+            rl_replay_value(reader, &q1, sizeof(q1));
+            Quaternion q2;
+            rl_replay_value(reader, &q2, sizeof(q2));
+            float amount;
+            rl_replay_value(reader, &amount, sizeof(amount));
+            (void)QuaternionSlerp(q1, q2, amount);
+        } return true;
+        case RL_CALL_QUATERNION_CUBIC_HERMITE_SPLINE: {
+            Quaternion q1;
+            rl_replay_value(reader, &q1, sizeof(q1));
+            Quaternion outTangent1;
+            rl_replay_value(reader, &outTangent1, sizeof(outTangent1));
+            Quaternion q2;
+            rl_replay_value(reader, &q2, sizeof(q2));
+            Quaternion inTangent2;
+            rl_replay_value(reader, &inTangent2, sizeof(inTangent2));
+            float t;
+            rl_replay_value(reader, &t, sizeof(t));
+            (void)QuaternionCubicHermiteSpline(q1, outTangent1, q2, inTangent2, t);
+        } return true;
+        case RL_CALL_QUATERNION_FROM_VECTOR3_TO_VECTOR3: {
+            Vector3 from;
+            rl_replay_value(reader, &from, sizeof(from));
+            Vector3 to;
+            rl_replay_value(reader, &to, sizeof(to));
+            (void)QuaternionFromVector3ToVector3(from, to);
+        } return true;
+        case RL_CALL_QUATERNION_FROM_MATRIX: {
+            Matrix mat;
+            rl_replay_value(reader, &mat, sizeof(mat));
+            (void)QuaternionFromMatrix(mat);
+        } return true;
+        case RL_CALL_QUATERNION_TO_MATRIX: {
+            Quaternion q;
+            rl_replay_value(reader, &q, sizeof(q));
+            (void)QuaternionToMatrix(q);
+        } return true;
+        case RL_CALL_QUATERNION_FROM_AXIS_ANGLE: {
+            Vector3 axis;
+            rl_replay_value(reader, &axis, sizeof(axis));
+            float angle;
+            rl_replay_value(reader, &angle, sizeof(angle));
+            (void)QuaternionFromAxisAngle(axis, angle);
+        } return true;
+        case RL_CALL_QUATERNION_FROM_EULER: {
+            float pitch;
+            rl_replay_value(reader, &pitch, sizeof(pitch));
+            float yaw;
+            rl_replay_value(reader, &yaw, sizeof(yaw));
+            float roll;
+            rl_replay_value(reader, &roll, sizeof(roll));
+            (void)QuaternionFromEuler(pitch, yaw, roll);
+        } return true;
+        case RL_CALL_QUATERNION_TO_EULER: {
+            Quaternion q;
+            rl_replay_value(reader, &q, sizeof(q));
+            (void)QuaternionToEuler(q);
+        } return true;
+        case RL_CALL_QUATERNION_TRANSFORM: {
+            Quaternion q;
+            rl_replay_value(reader, &q, sizeof(q));
+            Matrix mat;
+            rl_replay_value(reader, &mat, sizeof(mat));
+            (void)QuaternionTransform(q, mat);
+        } return true;
+        case RL_CALL_QUATERNION_EQUALS: {
+            Quaternion p;
+            rl_replay_value(reader, &p, sizeof(p));
+            Quaternion q;
+            rl_replay_value(reader, &q, sizeof(q));
+            (void)QuaternionEquals(p, q);
+        } return true;
+        default:
+            return false;
+    }
+}
+
+#endif // RAYLIB_REPLAY_GEN_H
@@ -0,0 +1,56 @@
+#ifndef HOT_RELOAD_RAYLIB_TRACE_H
+#define HOT_RELOAD_RAYLIB_TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "raylib.h"
+
+// Binary raylib call trace, written by raylib_capture.c and read by
+// tools/raylib_replay.c. Everything is in native byte order.
+//
+// Header:
+//   char[8] magic, u32 version, i32 screen width, i32 screen height,
+//   u32 call count, then for every call id: u16 name length + name bytes.
+//   Names let a replayer built against another raylib version match calls.
+//
+// Records, each starting with a one byte RlTraceTag:
+//   RL_TRACE_CALL            u16 call id, u32 payload size, payload
+//   RL_TRACE_UNSUPPORTED     u16 call id (arguments can't be serialized)
+//   RL_TRACE_TEXTURE         Texture2D, u32 pixel bytes, RGBA8 pixels of mip 0
+//   RL_TRACE_RENDER_TEXTURE  RenderTexture2D
+//
+// A call payload is the serialized arguments in order, followed by the result
+// when the call returns a texture, render texture or shader. Strings are a u32
+// length (including the NUL, RL_TRACE_NULL_STRING for NULL) and their bytes.
+#define RL_TRACE_MAGIC "RLTRACE"
+#define RL_TRACE_VERSION 1
+#define RL_TRACE_NULL_STRING 0xFFFFFFFFu
+
+typedef enum {
+    RL_TRACE_CALL = 1,
+    RL_TRACE_UNSUPPORTED = 2,
+    RL_TRACE_TEXTURE = 3,
+    RL_TRACE_RENDER_TEXTURE = 4,
+} RlTraceTag;
+
+typedef struct {
+    const unsigned char* data;
+    size_t size;
+    size_t offset;
+} RlTraceReader;
+
+// Implemented by the replayer, used by raylib_replay.gen.h
+void rl_replay_value(RlTraceReader* reader, void* value, size_t size);
+const char* rl_replay_string(RlTraceReader* reader);
+Texture2D rl_replay_texture(RlTraceReader* reader);
+RenderTexture2D rl_replay_render_texture(RlTraceReader* reader);
+Shader rl_replay_shader(RlTraceReader* reader);
+void rl_replay_result_texture(RlTraceReader* reader, Texture2D texture);
+void rl_replay_result_render_texture(RlTraceReader* reader, RenderTexture2D target);
+void rl_replay_result_shader(RlTraceReader* reader, Shader shader);
+void rl_replay_forget_texture(Texture2D texture);
+void rl_replay_forget_render_texture(RenderTexture2D target);
+void rl_replay_forget_shader(Shader shader);
+
+#endif // HOT_RELOAD_RAYLIB_TRACE_H
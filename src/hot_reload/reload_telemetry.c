@@ -0,0 +1,204 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "reload_telemetry.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+
+static const char* reload_stage_names[RELOAD_STAGE_COUNT] = {
+    "build",
+    "copy",
+    "dlopen",
+    "bind",
+    "swap",
+    "first update",
+};
+
+typedef struct {
+    double stage_ms[RELOAD_STAGE_COUNT];
+    bool has_stage[RELOAD_STAGE_COUNT];
+    double total_ms;
+    long long detect_lag_s;
+} ReloadRecord;
+
+typedef struct {
+    bool in_progress;
+    uint64_t start_ns;
+    uint64_t stage_start_ns[RELOAD_STAGE_COUNT];
+    ReloadRecord current;
+
+    ReloadRecord records[RELOAD_TELEMETRY_MAX_RELOADS];
+    int record_count;
+    int failed_count;
+    int skipped_count;
+} ReloadTelemetry;
+
+static ReloadTelemetry reload_telemetry = {0};
+
+static uint64_t reload_telemetry_now_ns(void) {
+#ifdef _WIN32
+    static LARGE_INTEGER frequency = {0};
+    LARGE_INTEGER counter;
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+// Does nothing if a reload is already in progress, e.g. the watcher started
+// it and the new game.so is now being picked up
+void reload_telemetry_begin(time_t saved_time) {
+    if (reload_telemetry.in_progress) return;
+
+    memset(&reload_telemetry.current, 0, sizeof(reload_telemetry.current));
+    reload_telemetry.current.detect_lag_s = saved_time ? (long long)(time(NULL) - saved_time) : -1;
+    reload_telemetry.start_ns = reload_telemetry_now_ns();
+    reload_telemetry.in_progress = true;
+}
+
+void reload_telemetry_stage_begin(ReloadStage stage) {
+    if (!reload_telemetry.in_progress) return;
+    reload_telemetry.stage_start_ns[stage] = reload_telemetry_now_ns();
+}
+
+static void reload_telemetry_print_record(int index, const ReloadRecord* record) {
+    double accounted = 0.0;
+
+    printf("[RELOAD_TELEMETRY] Reload #%d: %.1f ms", index + 1, record->total_ms);
+    if (record->detect_lag_s >= 0) {
+        printf(" (saved ~%lld s before detection)", record->detect_lag_s);
+    }
+    printf("\n   ");
+    for (int i = 0; i < RELOAD_STAGE_COUNT; i++) {
+        if (!record->has_stage[i]) continue;
+        printf(" %s %.2f,", reload_stage_names[i], record->stage_ms[i]);
+        accounted += record->stage_ms[i];
+    }
+    printf(" other %.2f ms\n", record->total_ms - accounted);
+}
+
+// The first update of the new version ends the reload
+void reload_telemetry_stage_end(ReloadStage stage) {
+    if (!reload_telemetry.in_progress) return;
+
+    uint64_t now = reload_telemetry_now_ns();
+    ReloadRecord* record = &reload_telemetry.current;
+    record->stage_ms[stage] += (double)(now - reload_telemetry.stage_start_ns[stage]) / 1e6;
+    record->has_stage[stage] = true;
+
+    if (stage != RELOAD_STAGE_FIRST_UPDATE) return;
+
+    record->total_ms = (double)(now - reload_telemetry.start_ns) / 1e6;
+    reload_telemetry.in_progress = false;
+
+    int index = reload_telemetry.record_count;
+    if (reload_telemetry.record_count < RELOAD_TELEMETRY_MAX_RELOADS) {
+        reload_telemetry.records[reload_telemetry.record_count++] = *record;
+    }
+    reload_telemetry_print_record(index, record);
+}
+
+void reload_telemetry_abort(const char* reason) {
+    if (!reload_telemetry.in_progress) return;
+
+    double elapsed_ms = (double)(reload_telemetry_now_ns() - reload_telemetry.start_ns) / 1e6;
+    printf("[RELOAD_TELEMETRY] Reload failed after %.1f ms: %s\n", elapsed_ms, reason);
+    reload_telemetry.failed_count++;
+    reload_telemetry.in_progress = false;
+}
+
+// The rebuilt library turned out to be the loaded one
+void reload_telemetry_skip(const char* reason) {
+    if (!reload_telemetry.in_progress) return;
+
+    double elapsed_ms = (double)(reload_telemetry_now_ns() - reload_telemetry.start_ns) / 1e6;
+    printf("[RELOAD_TELEMETRY] Reload skipped after %.1f ms: %s\n", elapsed_ms, reason);
+    reload_telemetry.skipped_count++;
+    reload_telemetry.in_progress = false;
+}
+
+static int compare_doubles(const void* a, const void* b) {
+    double da = *(const double*)a;
+    double db = *(const double*)b;
+    return (da > db) - (da < db);
+}
+
+static const char* reload_build_option(const char* name) {
+    const char* value = getenv(name);
+    return value && strcmp(value, "1") == 0 ? "on" : "off";
+}
+
+// Median and max of every stage, and a histogram of the totals
+void reload_telemetry_print_summary(void) {
+    static const double bucket_limits_ms[] = { 100, 250, 500, 1000, 2000, 5000, 10000 };
+    const int bucket_count = (int)(sizeof(bucket_limits_ms) / sizeof(bucket_limits_ms[0]));
+    int buckets[sizeof(bucket_limits_ms) / sizeof(bucket_limits_ms[0]) + 1] = {0};
+
+    int count = reload_telemetry.record_count;
+    if (count == 0) {
+        printf("[RELOAD_TELEMETRY] No reloads measured (%d failed, %d skipped)\n",
+               reload_telemetry.failed_count, reload_telemetry.skipped_count);
+        return;
+    }
+
+    double* values = malloc(sizeof(double) * count);
+    if (!values) return;
+
+    printf("[RELOAD_TELEMETRY] %d reloads (%d failed, %d skipped):\n",
+           count, reload_telemetry.failed_count, reload_telemetry.skipped_count);
+    // build_hot_reload.sh inherits the host's environment, so these are the
+    // modes every reload was built with, to compare sessions with and without
+    printf("  game library build: unity %s, pch %s\n",
+           reload_build_option("HOT_RELOAD_UNITY"), reload_build_option("HOT_RELOAD_PCH"));
+    printf("  %-14s %10s %10s %6s\n", "stage", "median ms", "max ms", "seen");
+
+    for (int stage = 0; stage <= RELOAD_STAGE_COUNT; stage++) {
+        int seen = 0;
+        for (int i = 0; i < count; i++) {
+            const ReloadRecord* record = &reload_telemetry.records[i];
+            if (stage == RELOAD_STAGE_COUNT) {
+                values[seen++] = record->total_ms;
+            } else if (record->has_stage[stage]) {
+                values[seen++] = record->stage_ms[stage];
+            }
+        }
+        if (seen == 0) continue;
+
+        qsort(values, seen, sizeof(double), compare_doubles);
+        printf("  %-14s %10.2f %10.2f %6d\n",
+               stage == RELOAD_STAGE_COUNT ? "total" : reload_stage_names[stage],
+               values[seen / 2], values[seen - 1], seen);
+    }
+
+    for (int i = 0; i < count; i++) {
+        int bucket = 0;
+        while (bucket < bucket_count && reload_telemetry.records[i].total_ms >= bucket_limits_ms[bucket]) bucket++;
+        buckets[bucket]++;
+    }
+
+    printf("  Total latency:\n");
+    for (int i = 0; i <= bucket_count; i++) {
+        char label[32];
+        if (i < bucket_count) {
+            snprintf(label, sizeof(label), "< %.0f ms", bucket_limits_ms[i]);
+        } else {
+            snprintf(label, sizeof(label), ">= %.0f ms", bucket_limits_ms[bucket_count - 1]);
+        }
+        printf("  %12s %4d ", label, buckets[i]);
+        for (int j = 0; j < buckets[i] && j < 50; j++) printf("#");
+        printf("\n");
+    }
+
+    free(values);
+}
@@ -0,0 +1,35 @@
+#ifndef HOT_RELOAD_RELOAD_TELEMETRY_H
+#define HOT_RELOAD_RELOAD_TELEMETRY_H
+
+#include <time.h>
+#include <stdbool.h>
+
+// Hot reload latency, from the change being detected to the end of the first
+// update() of the new game library version.
+//
+// The host calls reload_telemetry_begin() when a reload starts (a watched file
+// changed, F5/F6, or game.so was rebuilt externally) and wraps every step in
+// stage_begin/stage_end. Stages outside a reload are ignored, so the host can
+// wrap update() every frame. Each reload prints its breakdown, and the session
+// summary keeps a histogram of the totals.
+#define RELOAD_TELEMETRY_MAX_RELOADS 1024
+
+typedef enum {
+    RELOAD_STAGE_BUILD = 0,
+    RELOAD_STAGE_COPY,
+    RELOAD_STAGE_DLOPEN,
+    RELOAD_STAGE_BIND,
+    RELOAD_STAGE_SWAP,
+    RELOAD_STAGE_FIRST_UPDATE,
+    RELOAD_STAGE_COUNT
+} ReloadStage;
+
+// saved_time is the modification time of the changed file, 0 if unknown
+void reload_telemetry_begin(time_t saved_time);
+void reload_telemetry_stage_begin(ReloadStage stage);
+void reload_telemetry_stage_end(ReloadStage stage);
+void reload_telemetry_abort(const char* reason);
+void reload_telemetry_skip(const char* reason);
+void reload_telemetry_print_summary(void);
+
+#endif // HOT_RELOAD_RELOAD_TELEMETRY_H
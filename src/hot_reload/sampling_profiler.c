@@ -0,0 +1,404 @@
+#define _GNU_SOURCE
+
+#include "sampling_profiler.h"
+#include "elf_symbols.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+
+#include <stdint.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <dlfcn.h>
+#include <link.h>
+#include <execinfo.h>
+#include <ucontext.h>
+#include <sys/time.h>
+
+#define SAMPLING_DEFAULT_HZ 499
+
+typedef struct {
+    uint32_t epoch;
+    uint32_t depth;
+    void* frames[SAMPLING_MAX_FRAMES];
+} Sample;
+
+// One game library version. Kept after it's unloaded, so older samples can
+// still be resolved. A sample belongs to it if it was taken between the
+// load and unload epochs.
+typedef struct {
+    char name[64];
+    int version;
+    uintptr_t base;
+    uintptr_t start;
+    uintptr_t end;
+    uint32_t loaded_epoch;
+    uint32_t unloaded_epoch;
+    ElfSymbolTable symbols;
+} SamplingModule;
+
+typedef struct {
+    bool active;
+    volatile int paused;
+    volatile uint32_t epoch;
+
+    Sample* samples;
+    volatile uint64_t written;
+    volatile uint64_t dropped;
+
+    SamplingModule modules[SAMPLING_MAX_MODULES];
+    int module_count;
+
+    char perf_map_path[64];
+} SamplingProfiler;
+
+static SamplingProfiler sampling = {0};
+
+static void* sampling_context_pc(void* context) {
+    ucontext_t* uc = (ucontext_t*)context;
+#if defined(__x86_64__)
+    return (void*)uc->uc_mcontext.gregs[REG_RIP];
+#elif defined(__aarch64__)
+    return (void*)uc->uc_mcontext.pc;
+#else
+    (void)uc;
+    return NULL;
+#endif
+}
+
+static void sampling_signal_handler(int signal, siginfo_t* info, void* context) {
+    (void)signal;
+    (void)info;
+    int saved_errno = errno;
+
+    if (sampling.paused) {
+        __sync_fetch_and_add(&sampling.dropped, 1);
+        errno = saved_errno;
+        return;
+    }
+
+    // The first frames are this handler and the kernel's signal trampoline.
+    // Start at the interrupted instruction when it can be found.
+    void* frames[SAMPLING_MAX_FRAMES + 4];
+    int count = backtrace(frames, SAMPLING_MAX_FRAMES + 4);
+    void* pc = sampling_context_pc(context);
+    int first = count > 2 ? 2 : count;
+    for (int i = 0; i < count && i < 6; i++) {
+        if (frames[i] == pc) {
+            first = i;
+            break;
+        }
+    }
+
+    uint64_t index = __sync_fetch_and_add(&sampling.written, 1);
+    Sample* sample = &sampling.samples[index & (SAMPLING_MAX_SAMPLES - 1)];
+    int depth = count - first;
+    if (depth > SAMPLING_MAX_FRAMES) depth = SAMPLING_MAX_FRAMES;
+
+    sample->epoch = sampling.epoch;
+    sample->depth = (uint32_t)depth;
+    memcpy(sample->frames, frames + first, sizeof(void*) * depth);
+
+    errno = saved_errno;
+}
+
+bool sampling_profiler_start(void) {
+    const char* env = getenv("HOT_RELOAD_SAMPLING_HZ");
+    if (!env || sampling.active) return false;
+
+    int hz = atoi(env);
+    if (hz <= 0) hz = SAMPLING_DEFAULT_HZ;
+
+    sampling.samples = calloc(SAMPLING_MAX_SAMPLES, sizeof(Sample));
+    if (!sampling.samples) return false;
+
+    // backtrace() loads libgcc on its first call, which isn't safe inside a
+    // signal handler
+    void* warm_up[4];
+    backtrace(warm_up, 4);
+
+    snprintf(sampling.perf_map_path, sizeof(sampling.perf_map_path), "/tmp/perf-%d.map", (int)getpid());
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = sampling_signal_handler;
+    action.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(SIGPROF, &action, NULL) != 0) {
+        printf("[SAMPLING] Failed to install the SIGPROF handler\n");
+        free(sampling.samples);
+        sampling.samples = NULL;
+        return false;
+    }
+
+    struct itimerval timer;
+    timer.it_interval.tv_sec = 0;
+    timer.it_interval.tv_usec = 1000000 / hz;
+    if (timer.it_interval.tv_usec == 0) timer.it_interval.tv_usec = 1;
+    timer.it_value = timer.it_interval;
+    if (setitimer(ITIMER_PROF, &timer, NULL) != 0) {
+        printf("[SAMPLING] Failed to start the profiling timer\n");
+        signal(SIGPROF, SIG_IGN);
+        free(sampling.samples);
+        sampling.samples = NULL;
+        return false;
+    }
+
+    sampling.active = true;
+    printf("[SAMPLING] Sampling at %d Hz, perf map: %s\n", hz, sampling.perf_map_path);
+    return true;
+}
+
+void sampling_profiler_stop(void) {
+    if (!sampling.active) return;
+
+    struct itimerval timer;
+    memset(&timer, 0, sizeof(timer));
+    setitimer(ITIMER_PROF, &timer, NULL);
+    // A signal might still be pending, and SIGPROF terminates by default
+    signal(SIGPROF, SIG_IGN);
+
+    sampling.active = false;
+}
+
+bool sampling_profiler_active(void) {
+    return sampling.active;
+}
+
+void sampling_profiler_pause(void) {
+    __sync_fetch_and_add(&sampling.paused, 1);
+}
+
+void sampling_profiler_resume(void) {
+    __sync_fetch_and_sub(&sampling.paused, 1);
+}
+
+static const char* path_basename(const char* path) {
+    const char* slash = strrchr(path, '/');
+    return slash ? slash + 1 : path;
+}
+
+typedef struct {
+    const char* name;
+    SamplingModule* module;
+    bool found;
+} SamplingModuleSearch;
+
+static int find_module_mapping(struct dl_phdr_info* info, size_t size, void* data) {
+    (void)size;
+    SamplingModuleSearch* search = (SamplingModuleSearch*)data;
+    if (!info->dlpi_name || strcmp(path_basename(info->dlpi_name), search->name) != 0) return 0;
+
+    uintptr_t start = UINTPTR_MAX;
+    uintptr_t end = 0;
+    for (int i = 0; i < info->dlpi_phnum; i++) {
+        const ElfW(Phdr)* header = &info->dlpi_phdr[i];
+        if (header->p_type != PT_LOAD) continue;
+        uintptr_t segment_start = info->dlpi_addr + header->p_vaddr;
+        uintptr_t segment_end = segment_start + header->p_memsz;
+        if (segment_start < start) start = segment_start;
+        if (segment_end > end) end = segment_end;
+    }
+
+    search->module->base = info->dlpi_addr;
+    search->module->start = start;
+    search->module->end = end;
+    search->found = true;
+    return 1;
+}
+
+// perf reads /tmp/perf-<pid>.map for code it can't find a file for, which is
+// what deleted game libraries look like to it
+static void append_perf_map(const SamplingModule* module) {
+    FILE* file = fopen(sampling.perf_map_path, "a");
+    if (!file) return;
+
+    for (int i = 0; i < module->symbols.count; i++) {
+        const ElfSymbol* symbol = &module->symbols.symbols[i];
+        uint64_t size = symbol->size;
+        if (size == 0 && i + 1 < module->symbols.count) {
+            size = module->symbols.symbols[i + 1].address - symbol->address;
+        }
+        fprintf(file, "%llx %llx %s`%s\n",
+                (unsigned long long)(module->base + symbol->address), (unsigned long long)size,
+                module->name, symbol->name);
+    }
+
+    fclose(file);
+}
+
+// Called right after the library is loaded, while its file still exists
+void sampling_profiler_add_module(const char* path, int version) {
+    if (!sampling.active) return;
+    if (sampling.module_count >= SAMPLING_MAX_MODULES) {
+        printf("[SAMPLING] Too many library versions, %s won't be symbolized\n", path);
+        return;
+    }
+
+    SamplingModule* module = &sampling.modules[sampling.module_count];
+    memset(module, 0, sizeof(*module));
+    snprintf(module->name, sizeof(module->name), "%s", path_basename(path));
+    module->version = version;
+
+    // Paused like dlopen/dlclose: the handler's backtrace() walks the
+    // loader's state, which dl_iterate_phdr() holds locked, and the table is
+    // only complete once module_count says so
+    sampling_profiler_pause();
+    SamplingModuleSearch search = { module->name, module, false };
+    dl_iterate_phdr(find_module_mapping, &search);
+    if (search.found) {
+        elf_symbols_load(path, &module->symbols);
+        module->loaded_epoch = __sync_add_and_fetch(&sampling.epoch, 1);
+        module->unloaded_epoch = UINT32_MAX;
+        sampling.module_count++;
+    }
+    sampling_profiler_resume();
+
+    if (!search.found) {
+        printf("[SAMPLING] %s is not mapped\n", path);
+        return;
+    }
+    append_perf_map(module);
+}
+
+// Called right before the library is unloaded
+void sampling_profiler_remove_module(const char* path) {
+    if (!sampling.active) return;
+
+    const char* name = path_basename(path);
+    for (int i = sampling.module_count - 1; i >= 0; i--) {
+        SamplingModule* module = &sampling.modules[i];
+        if (module->unloaded_epoch == UINT32_MAX && strcmp(module->name, name) == 0) {
+            module->unloaded_epoch = __sync_add_and_fetch(&sampling.epoch, 1);
+            return;
+        }
+    }
+}
+
+static const SamplingModule* find_module(uintptr_t address, uint32_t epoch) {
+    for (int i = sampling.module_count - 1; i >= 0; i--) {
+        const SamplingModule* module = &sampling.modules[i];
+        if (address >= module->start && address < module->end &&
+            epoch >= module->loaded_epoch && epoch < module->unloaded_epoch) {
+            return module;
+        }
+    }
+    return NULL;
+}
+
+static void symbolize_frame(uintptr_t address, uint32_t epoch, char* out, size_t out_size) {
+    const SamplingModule* module = find_module(address, epoch);
+    if (module) {
+        const ElfSymbol* symbol = elf_symbols_find(&module->symbols, address - module->base);
+        if (symbol) {
+            snprintf(out, out_size, "%s`%s", module->name, symbol->name);
+        } else {
+            snprintf(out, out_size, "%s`0x%llx", module->name, (unsigned long long)(address - module->base));
+        }
+        return;
+    }
+
+    Dl_info info;
+    if (dladdr((void*)address, &info) && info.dli_fname) {
+        if (info.dli_sname) {
+            snprintf(out, out_size, "%s", info.dli_sname);
+        } else {
+            snprintf(out, out_size, "%s`0x%llx", path_basename(info.dli_fname),
+                     (unsigned long long)(address - (uintptr_t)info.dli_fbase));
+        }
+        return;
+    }
+
+    snprintf(out, out_size, "0x%llx", (unsigned long long)address);
+}
+
+static int compare_lines(const void* a, const void* b) {
+    return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+// Writes the samples still in the ring as folded stacks, root frame first:
+//   main;game_3.so`game_update;DrawTexture 42
+bool sampling_profiler_write_folded(const char* path) {
+    if (!sampling.samples) return false;
+
+    uint64_t written = sampling.written;
+    uint64_t oldest = written > SAMPLING_MAX_SAMPLES ? written - SAMPLING_MAX_SAMPLES : 0;
+    int count = (int)(written - oldest);
+
+    char** lines = calloc(count > 0 ? count : 1, sizeof(char*));
+    if (!lines) return false;
+
+    size_t line_capacity = SAMPLING_MAX_FRAMES * 128;
+    int line_count = 0;
+    for (uint64_t i = oldest; i < written; i++) {
+        const Sample* sample = &sampling.samples[i & (SAMPLING_MAX_SAMPLES - 1)];
+        if (sample->depth == 0) continue;
+
+        char* line = malloc(line_capacity);
+        if (!line) break;
+        size_t length = 0;
+        line[0] = '\0';
+
+        for (int f = (int)sample->depth - 1; f >= 0; f--) {
+            // Callers are return addresses, step back into the call instruction
+            uintptr_t address = (uintptr_t)sample->frames[f] - (f > 0 ? 1 : 0);
+            char frame[256];
+            symbolize_frame(address, sample->epoch, frame, sizeof(frame));
+
+            // ';' separates frames and ' ' the count, so neither can be in a name
+            for (char* c = frame; *c; c++) {
+                if (*c == ';' || *c == ' ') *c = '_';
+            }
+            int added = snprintf(line + length, line_capacity - length, "%s%s", length ? ";" : "", frame);
+            if (added < 0 || (size_t)added >= line_capacity - length) break;
+            length += (size_t)added;
+        }
+
+        lines[line_count++] = line;
+    }
+
+    qsort(lines, line_count, sizeof(char*), compare_lines);
+
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        printf("[SAMPLING] Failed to open %s\n", path);
+    } else {
+        for (int i = 0; i < line_count;) {
+            int run = 1;
+            while (i + run < line_count && strcmp(lines[i], lines[i + run]) == 0) run++;
+            fprintf(file, "%s %d\n", lines[i], run);
+            i += run;
+        }
+        fclose(file);
+        printf("[SAMPLING] Wrote %d samples (%llu dropped during reloads) to %s\n",
+               line_count, (unsigned long long)sampling.dropped, path);
+    }
+
+    for (int i = 0; i < line_count; i++) {
+        free(lines[i]);
+    }
+    free(lines);
+    return file != NULL;
+}
+
+#else
+
+bool sampling_profiler_start(void) {
+    if (getenv("HOT_RELOAD_SAMPLING_HZ")) {
+        printf("[SAMPLING] The sampling profiler is only supported on Linux\n");
+    }
+    return false;
+}
+
+void sampling_profiler_stop(void) {}
+bool sampling_profiler_active(void) { return false; }
+void sampling_profiler_pause(void) {}
+void sampling_profiler_resume(void) {}
+void sampling_profiler_add_module(const char* path, int version) { (void)path; (void)version; }
+void sampling_profiler_remove_module(const char* path) { (void)path; }
+bool sampling_profiler_write_folded(const char* path) { (void)path; return false; }
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef HOT_RELOAD_SAMPLING_PROFILER_H
+#define HOT_RELOAD_SAMPLING_PROFILER_H
+
+#include <stdbool.h>
+
+// SIGPROF sampling profiler for the hot reload host (Linux only).
+//
+// External profilers lose the game frames after a reload, because every
+// version is a differently named game_N.so that gets deleted when it's
+// unloaded. The host tells this profiler about every library it loads and
+// unloads, and each sample is resolved against the library versions that
+// were mapped when it was taken, using symbols read before the file went
+// away.
+//
+// Enable with HOT_RELOAD_SAMPLING_HZ=<rate>. Samples are written as folded
+// stacks (flamegraph.pl, speedscope, Perfetto...), and game symbols are also
+// appended to /tmp/perf-<pid>.map for perf.
+#define SAMPLING_MAX_FRAMES 48
+#define SAMPLING_MAX_SAMPLES (1 << 15)
+#define SAMPLING_MAX_MODULES 256
+
+bool sampling_profiler_start(void);
+void sampling_profiler_stop(void);
+bool sampling_profiler_active(void);
+
+// Samples taken between pause and resume are dropped. The host pauses around
+// dlopen/dlclose, so the unwinder never walks the loader's half-updated state.
+void sampling_profiler_pause(void);
+void sampling_profiler_resume(void);
+
+void sampling_profiler_add_module(const char* path, int version);
+void sampling_profiler_remove_module(const char* path);
+
+bool sampling_profiler_write_folded(const char* path);
+
+#endif // HOT_RELOAD_SAMPLING_PROFILER_H
@@ -1,13 +1,61 @@
 #include "game.h"
+#include "runtime/perf_counters.h"
+#include "runtime/startup.h"
+#include "runtime/jobs.h"
+#include "runtime/asset_pack.h"
+#include "runtime/input_session.h"
+#include "modules/module_list.h"
+
+// Warms the page cache with the asset pack while the window opens
+static void startup_prefetch_job(void* data) {
+    (void)data;
+    int phase = startup_phase_begin("prefetch asset pack");
+    asset_pack_prefetch(ASSET_PACK_PATH);
+    startup_phase_end(phase);
+}
 
 int main() {
+    profiler_init();
+    startup_begin();
+
+    JobGroup startup_jobs = {0};
+    jobs_submit_group(&startup_jobs, startup_prefetch_job, NULL);
+
+    int phase = startup_phase_begin("init window");
     game_init_window();
+    startup_phase_end(phase);
+
+    phase = startup_phase_begin("game init");
     game_init();
+#define REGISTER_MODULE(name) modules_register(name##_module_get());
+    GAME_MODULES(REGISTER_MODULE)
+#undef REGISTER_MODULE
+    startup_phase_end(phase);
 
-    while (game_should_run()) {
+    perf_counters_init();
+    jobs_wait(&startup_jobs);
+    input_session_begin();
+
+    while (game_should_run() && !input_session_done()) {
+        input_session_frame();
+        profiler_frame_mark();
+        assets_update(ASSETS_UPLOAD_BUDGET_MS);
+        sprites_frame_end();
+        text_cache_frame_end();
         game_update();
+        startup_frame_end(assets_pending());
+
+        if (IsKeyPressed(KEY_F9)) {
+            profiler_export_chrome_trace("profile.json");
+            if (perf_counters_enabled) {
+                perf_counters_print_report();
+                perf_counters_write_csv("perf_counters.csv");
+            }
+        }
     }
-    
+
+    input_session_end();
+    modules_shutdown();
     game_shutdown();
     game_shutdown_window();
     
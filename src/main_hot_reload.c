@@ -8,6 +8,22 @@
 #include "hot_reload/platform_tools.h"
 #include "hot_reload/file_watcher.h"
 #include "hot_reload/raylib_api.gen.h"
+#include "hot_reload/raylib_api_instrumented.gen.h"
+#include "hot_reload/raylib_api_capture.gen.h"
+#include "hot_reload/sampling_profiler.h"
+#include "hot_reload/frame_stats.h"
+#include "hot_reload/reload_telemetry.h"
+#include "hot_reload/live_patch.h"
+#include "hot_reload/dir_watcher.h"
+#include "hot_reload/elf_symbols.h"
+#include "hot_reload/crash_guard.h"
+#include "hot_reload/frame_pacer.h"
+#include "runtime/host_api.h"
+#include "runtime/startup.h"
+#include "runtime/jobs.h"
+#include "runtime/asset_pack.h"
+#include "runtime/runtime_draw.h"
+#include "modules/module_list.h"
 
 #ifdef __APPLE__
     #define DLL_EXT ".dylib"
@@ -28,10 +44,30 @@
 #endif
 
 #define GAME_DLL_PATH GAME_DLL_DIR "game" DLL_EXT
+#define RAYLIB_CALLS_CSV_PATH GAME_DLL_DIR "raylib_calls.csv"
+#define RAYLIB_CALLS_REPORT_TOP 8
+#define RAYLIB_CAPTURE_PATH GAME_DLL_DIR "raylib_capture.rltrace"
+#define PROFILE_TRACE_PATH GAME_DLL_DIR "profile.json"
+#define PERF_COUNTERS_CSV_PATH GAME_DLL_DIR "perf_counters.csv"
+#define SAMPLING_FOLDED_PATH GAME_DLL_DIR "samples.folded"
+#define FRAME_STATS_CSV_PATH GAME_DLL_DIR "frame_stats.csv"
+#define GAME_OPT_LEVELS_PATH GAME_DLL_DIR "game_opt_levels.txt"
+#ifdef _WIN32
+    #define EXE_EXT ".exe"
+#else
+    #define EXE_EXT ""
+#endif
+// Built next to the game library by the build scripts
+#define ATLAS_PACKER_COMMAND GAME_DLL_DIR "atlas_packer" EXE_EXT " resources"
+#define ASSET_PACKER_COMMAND GAME_DLL_DIR "asset_packer" EXE_EXT " resources"
+// Tick rates while the window is unfocused, and minimized or hidden
+#define HOST_IDLE_FPS 10
+#define HOST_HIDDEN_FPS 2
 
 typedef struct {
     dll_handle_t lib;
     void (*set_raylib_api)(RaylibAPI* api);
+    void (*set_host_api)(HostAPI* api);
     void (*init_window)(void);
     void (*init)(void);
     void (*update)(void);
@@ -44,19 +80,12 @@ typedef struct {
     bool (*force_reload)(void);
     bool (*force_restart)(void);
     time_t modification_time;
+    uint64_t content_hash;
     int api_version;
 } GameAPI;
 
 bool copy_dll(const char* to) {
-    char cmd[512];
-#ifdef _WIN32
-    snprintf(cmd, sizeof(cmd), "copy \"%s\" \"%s\" >nul 2>nul", GAME_DLL_PATH, to);
-#else
-    snprintf(cmd, sizeof(cmd), "cp \"%s\" \"%s\"", GAME_DLL_PATH, to);
-#endif
-    int result = system(cmd);
-    
-    if (result != 0) {
+    if (!platform_copy_file(GAME_DLL_PATH, to)) {
         printf("[HOT_RELOAD] Failed to copy %s to %s\n", GAME_DLL_PATH, to);
         return false;
     }
@@ -75,19 +104,30 @@ bool load_game_api(GameAPI* api, int api_version) {
     char game_dll_name[256];
     snprintf(game_dll_name, sizeof(game_dll_name), GAME_DLL_DIR "game_%d" DLL_EXT, api_version);
     
-    if (!copy_dll(game_dll_name)) {
+    reload_telemetry_stage_begin(RELOAD_STAGE_COPY);
+    bool copied = copy_dll(game_dll_name);
+    api->content_hash = 0;
+    if (copied) elf_content_hash(game_dll_name, &api->content_hash);
+    reload_telemetry_stage_end(RELOAD_STAGE_COPY);
+    if (!copied) {
         return false;
     }
     
     // Load the library
+    reload_telemetry_stage_begin(RELOAD_STAGE_DLOPEN);
+    sampling_profiler_pause();
     api->lib = platform_load_library(game_dll_name);
+    sampling_profiler_resume();
+    reload_telemetry_stage_end(RELOAD_STAGE_DLOPEN);
     if (!api->lib) {
         printf("[HOT_RELOAD] Failed to load library: %s\n", game_dll_name);
         return false;
     }
     
     // Load symbols
+    reload_telemetry_stage_begin(RELOAD_STAGE_BIND);
     api->set_raylib_api = (void(*)(RaylibAPI*))platform_get_symbol(api->lib, "game_set_raylib_api");
+    api->set_host_api = (void(*)(HostAPI*))platform_get_symbol(api->lib, "game_set_host_api");
     api->init_window = (void(*)(void))platform_get_symbol(api->lib, "game_init_window");
     api->init = (void(*)(void))platform_get_symbol(api->lib, "game_init");
     api->update = (void(*)(void))platform_get_symbol(api->lib, "game_update");
@@ -99,63 +139,460 @@ bool load_game_api(GameAPI* api, int api_version) {
     api->hot_reloaded = (void(*)(void*))platform_get_symbol(api->lib, "game_hot_reloaded");
     api->force_reload = (bool(*)(void))platform_get_symbol(api->lib, "game_force_reload");
     api->force_restart = (bool(*)(void))platform_get_symbol(api->lib, "game_force_restart");
+    reload_telemetry_stage_end(RELOAD_STAGE_BIND);
     
     api->api_version = api_version;
     api->modification_time = mod_time;
+
+    // Symbols are read now, the copy is deleted when this version is unloaded
+    sampling_profiler_add_module(game_dll_name, api_version);
+    live_patch_add_library("game", game_dll_name, api->lib);
+    frame_stats_load_opt_levels(GAME_OPT_LEVELS_PATH);
     
     return true;
 }
 
 void unload_game_api(GameAPI* api) {
+    char game_dll_name[256];
+    snprintf(game_dll_name, sizeof(game_dll_name), GAME_DLL_DIR "game_%d" DLL_EXT, api->api_version);
+
     if (api->lib) {
+        sampling_profiler_remove_module(game_dll_name);
+        live_patch_remove_library(game_dll_name);
+        sampling_profiler_pause();
         platform_free_library(api->lib);
+        sampling_profiler_resume();
         api->lib = NULL;
     }
     
     // Remove the copied DLL
-    char game_dll_name[256];
-    snprintf(game_dll_name, sizeof(game_dll_name), GAME_DLL_DIR "game_%d" DLL_EXT, api->api_version);
     platform_delete_file(game_dll_name);
 }
 
+// Game memory as it was before a new version got it, put back if that
+// version crashes
+typedef struct {
+    void* memory;
+    void* copy;
+    int size;
+    bool valid;
+} GameSnapshot;
+
+void game_snapshot_take(GameSnapshot* snapshot, GameAPI* api) {
+    snapshot->valid = false;
+    if (!api->memory || !api->memory_size) return;
+
+    void* memory = api->memory();
+    int size = api->memory_size();
+    if (!memory || size <= 0) return;
+
+    if (size > snapshot->size) {
+        void* copy = realloc(snapshot->copy, (size_t)size);
+        if (!copy) return;
+        snapshot->copy = copy;
+        snapshot->size = size;
+    }
+    memcpy(snapshot->copy, memory, (size_t)size);
+    snapshot->memory = memory;
+    snapshot->size = size;
+    snapshot->valid = true;
+}
+
+// A snapshot is only restored once
+bool game_snapshot_restore(GameSnapshot* snapshot) {
+    if (!snapshot->valid) return false;
+    memcpy(snapshot->memory, snapshot->copy, (size_t)snapshot->size);
+    snapshot->valid = false;
+    return true;
+}
+
+// A new version that crashed before it got control (in hot_reloaded()) is
+// dropped, the current one keeps running on the memory it had
+void reject_game_api(GameAPI* api, GameAPI* current, GameSnapshot* snapshot) {
+    char message[256];
+    snprintf(message, sizeof(message), "game_%d crashed in game_hot_reloaded() (%s at %p), kept game_%d",
+             api->api_version, crash_guard_signal_name(), crash_guard_fault_address(), current->api_version);
+    printf("[HOT_RELOAD] %s\n", message);
+    frame_stats_report_error(message);
+
+    game_snapshot_restore(snapshot);
+    // Not loaded again until it's rebuilt
+    current->modification_time = api->modification_time;
+    unload_game_api(api);
+}
+
+// A game module library (src/modules/<name>), reloaded on its own. Every
+// version stays loaded until exit, like old game library versions.
+#define GAME_MODULE_VERSIONS 32
+
+typedef struct {
+    const char* name;
+    dll_handle_t libs[GAME_MODULE_VERSIONS];
+    int version_count;
+    time_t modification_time;
+    uint64_t content_hash;
+    void (*set_raylib_api)(RaylibAPI*);
+} GameModuleLib;
+
+#define GAME_MODULE_LIB(module) { .name = #module },
+static GameModuleLib game_modules[] = { GAME_MODULES(GAME_MODULE_LIB) { 0 } };
+#define GAME_MODULE_COUNT ((int)(sizeof(game_modules) / sizeof(game_modules[0])) - 1)
+
+// The library built by the build script, or the copy of a loaded version
+static void game_module_path(char* path, size_t size, const GameModuleLib* module, int version) {
+    if (version < 0) {
+        snprintf(path, size, GAME_DLL_DIR "module_%s" DLL_EXT, module->name);
+    } else {
+        snprintf(path, size, GAME_DLL_DIR "module_%s_%d" DLL_EXT, module->name, version);
+    }
+}
+
+bool load_game_module(GameModuleLib* module, RaylibAPI* raylib_api, HostAPI* host_api) {
+    char path[256];
+    game_module_path(path, sizeof(path), module, -1);
+    time_t mod_time = platform_get_modification_time(path);
+    if (mod_time == 0) {
+        printf("[HOT_RELOAD] Module library %s not found\n", path);
+        return false;
+    }
+
+    // Not retried until the library changes again
+    module->modification_time = mod_time;
+    if (module->version_count == GAME_MODULE_VERSIONS) {
+        printf("[HOT_RELOAD] Module %s was reloaded too many times, restart to reload it again\n", module->name);
+        return false;
+    }
+
+    char copy_path[256];
+    game_module_path(copy_path, sizeof(copy_path), module, module->version_count);
+
+    reload_telemetry_stage_begin(RELOAD_STAGE_COPY);
+    bool copied = platform_copy_file(path, copy_path);
+    uint64_t content_hash = 0;
+    if (copied) elf_content_hash(copy_path, &content_hash);
+    reload_telemetry_stage_end(RELOAD_STAGE_COPY);
+    if (!copied) {
+        printf("[HOT_RELOAD] Failed to copy %s to %s\n", path, copy_path);
+        return false;
+    }
+
+    reload_telemetry_stage_begin(RELOAD_STAGE_DLOPEN);
+    sampling_profiler_pause();
+    dll_handle_t lib = platform_load_library(copy_path);
+    sampling_profiler_resume();
+    reload_telemetry_stage_end(RELOAD_STAGE_DLOPEN);
+    if (!lib) {
+        printf("[HOT_RELOAD] Failed to load module library: %s\n", copy_path);
+        platform_delete_file(copy_path);
+        return false;
+    }
+
+    reload_telemetry_stage_begin(RELOAD_STAGE_BIND);
+    char entry_name[128];
+    snprintf(entry_name, sizeof(entry_name), "%s_module_get", module->name);
+    const GameModuleAPI* (*module_get)(void) = (const GameModuleAPI*(*)(void))platform_get_symbol(lib, entry_name);
+    void (*set_raylib_api)(RaylibAPI*) = (void(*)(RaylibAPI*))platform_get_symbol(lib, "game_set_raylib_api");
+    void (*set_host_api)(HostAPI*) = (void(*)(HostAPI*))platform_get_symbol(lib, "game_set_host_api");
+    reload_telemetry_stage_end(RELOAD_STAGE_BIND);
+    if (!module_get) {
+        printf("[HOT_RELOAD] %s doesn't export %s\n", copy_path, entry_name);
+        platform_free_library(lib);
+        platform_delete_file(copy_path);
+        return false;
+    }
+
+    reload_telemetry_stage_begin(RELOAD_STAGE_SWAP);
+    if (set_raylib_api) set_raylib_api(raylib_api);
+    if (set_host_api) set_host_api(host_api);
+    module->set_raylib_api = set_raylib_api;
+    module->content_hash = content_hash;
+    module->libs[module->version_count++] = lib;
+    modules_register(module_get());
+
+    // Like game library copies: symbols are read now, and function pointers
+    // into older versions run the new code when live patching
+    char group[64];
+    snprintf(group, sizeof(group), "module_%s", module->name);
+    sampling_profiler_add_module(copy_path, module->version_count - 1);
+    live_patch_add_library(group, copy_path, lib);
+    if (module->version_count > 1 && live_patch_enabled()) live_patch_apply(copy_path);
+    reload_telemetry_stage_end(RELOAD_STAGE_SWAP);
+    return true;
+}
+
+void unload_game_modules(void) {
+    for (int i = 0; i < GAME_MODULE_COUNT; i++) {
+        GameModuleLib* module = &game_modules[i];
+        for (int version = 0; version < module->version_count; version++) {
+            char copy_path[256];
+            game_module_path(copy_path, sizeof(copy_path), module, version);
+            sampling_profiler_remove_module(copy_path);
+            live_patch_remove_library(copy_path);
+            sampling_profiler_pause();
+            platform_free_library(module->libs[version]);
+            sampling_profiler_resume();
+            platform_delete_file(copy_path);
+        }
+        module->version_count = 0;
+    }
+}
+
+// Startup work that needs neither the game library nor the window, run on
+// workers while the main thread loads the library and opens the window
+static void startup_file_watcher_job(void* data) {
+    (void)data;
+    int phase = startup_phase_begin("file versions");
+    file_watcher_reload();
+    startup_phase_end(phase);
+}
+
+// Directories the main loop looks at only after they changed, -1 for the
+// ones it has to poll
+static int library_watch = -1;
+static int source_watch = -1;
+static int resource_watch = -1;
+
+static void startup_dir_watcher_job(void* data) {
+    (void)data;
+    int phase = startup_phase_begin("watch directories");
+    library_watch = dir_watcher_add(GAME_DLL_DIR, false);
+#ifdef HOT_RELOAD_FILE_WATCHER
+    source_watch = dir_watcher_add("src", true);
+#endif
+    resource_watch = dir_watcher_add("resources", true);
+    if (!dir_watcher_start()) {
+        library_watch = source_watch = resource_watch = -1;
+    }
+    startup_phase_end(phase);
+}
+
+static void startup_prefetch_job(void* data) {
+    (void)data;
+    int phase = startup_phase_begin("prefetch asset pack");
+    asset_pack_prefetch(ASSET_PACK_PATH);
+    startup_phase_end(phase);
+}
+
+// Repacks the atlas after an image packed in it was saved. The page and index
+// writes show up as another resources/ change, which reloads them.
+static void repack_resources(void) {
+    printf("[HOT_RELOAD] Atlas image changed, repacking...\n");
+    double repack_start = GetTime();
+    if (system(ATLAS_PACKER_COMMAND) != 0) {
+        printf("[HOT_RELOAD] Failed to run %s\n", ATLAS_PACKER_COMMAND);
+        return;
+    }
+#ifndef _WIN32
+    // The pack is replaced by a rename, the one mapped by the registry stays
+    // valid. On Windows it can't be replaced while mapped.
+    if (system(ASSET_PACKER_COMMAND) != 0) {
+        printf("[HOT_RELOAD] Failed to run %s\n", ASSET_PACKER_COMMAND);
+    }
+#endif
+    sprites_check_changes();
+    frame_stats_mark(FRAME_MARK_REBUILD, GetTime() - repack_start);
+}
+
+// Runtime draws (sprite_draw()...) go through the same table as the game's,
+// so F7 and F8 see them too
+static void set_runtime_draw(RaylibAPI* api, bool direct) {
+    runtime_draw.draw_texture_pro = api->draw_texture_pro;
+    runtime_draw.draw_text_ex = api->draw_text_ex;
+    runtime_draw.direct = direct;
+}
+
+// A crash in the game skips its PROFILE_ZONE_END()s, the zones it left open
+// are dropped so the host's own zones still pair up
+static bool game_call_guarded(void (*fn)(void)) {
+    int depth = profiler_depth();
+    if (crash_guard_call(fn)) return true;
+    profiler_unwind(depth);
+    return false;
+}
+
+static bool game_call_guarded_arg(void (*fn)(void*), void* arg) {
+    int depth = profiler_depth();
+    if (crash_guard_call_arg(fn, arg)) return true;
+    profiler_unwind(depth);
+    return false;
+}
+
+// 0 when the window is in the foreground. Set HOT_RELOAD_IDLE=0 to always
+// run at full rate.
+static int host_idle_fps(void) {
+    static int enabled = -1;
+    if (enabled < 0) {
+        const char* value = getenv("HOT_RELOAD_IDLE");
+        enabled = !(value && strcmp(value, "0") == 0);
+    }
+    if (!enabled) return 0;
+    if (IsWindowMinimized() || IsWindowHidden()) return HOST_HIDDEN_FPS;
+    if (!IsWindowFocused()) return HOST_IDLE_FPS;
+    return 0;
+}
+
 int main() {
+    profiler_init();
+    startup_begin();
+
+    int phase = startup_phase_begin("create directory");
     platform_create_directory(GAME_DLL_DIR);
+    startup_phase_end(phase);
+
+    // Before the first load, so every game library version gets registered
+    sampling_profiler_start();
+
+    JobGroup startup_jobs = {0};
+    jobs_submit_group(&startup_jobs, startup_file_watcher_job, NULL);
+    jobs_submit_group(&startup_jobs, startup_prefetch_job, NULL);
+    jobs_submit_group(&startup_jobs, startup_dir_watcher_job, NULL);
     
     int game_api_version = 0;
     GameAPI game_api = {0};
     
-    if (!load_game_api(&game_api, game_api_version)) {
+    phase = startup_phase_begin("load game library");
+    bool loaded = load_game_api(&game_api, game_api_version);
+    startup_phase_end(phase);
+    if (!loaded) {
         printf("[HOT_RELOAD] Failed to load Game API\n");
+        jobs_wait(&startup_jobs);
         return 1;
     }
     
     game_api_version++;
+    // Of the newest version loaded, to tell rebuilds that changed nothing
+    uint64_t loaded_game_hash = game_api.content_hash;
     
-    // Set up raylib API for the shared library
+    // Set up raylib API for the shared library.
+    //
+    // The game only ever sees `active_raylib_api`, which is either the direct table,
+    // the instrumented one (F7) or the capturing one (F8). Swapping it is just another
+    // set_raylib_api call. Whichever it is, it's wrapped by frame_stats to time the
+    // game's drawing.
     RaylibAPI* raylib_api = create_raylib_api();
-    game_api.set_raylib_api(raylib_api);
+    // Before the game sets its target FPS, the host waits for it instead of raylib
+    frame_pacer_hook(raylib_api);
+    RaylibAPI* instrumented_raylib_api = NULL;
+    RaylibAPI* capture_raylib_api = NULL;
+    RaylibAPI* active_raylib_api = raylib_api;
+    game_api.set_raylib_api(frame_stats_wrap(active_raylib_api));
+    set_runtime_draw(frame_stats_wrap(active_raylib_api), active_raylib_api == raylib_api);
+
+    // Runtime services (profiler...) are owned by the host, so they survive reloads
+    HostAPI* host_api = create_host_api();
+    if (game_api.set_host_api) game_api.set_host_api(host_api);
+    perf_counters_init();
+    perf_counters_set_generation(game_api.api_version);
 
+    phase = startup_phase_begin("init window");
     game_api.init_window();
+    startup_phase_end(phase);
+
+    phase = startup_phase_begin("game init");
     game_api.init();
+    startup_phase_end(phase);
 
-    file_watcher_reload();
+    phase = startup_phase_begin("load modules");
+    for (int i = 0; i < GAME_MODULE_COUNT; i++) {
+        load_game_module(&game_modules[i], frame_stats_wrap(active_raylib_api), host_api);
+    }
+    startup_phase_end(phase);
+
+    // The file watcher is read by the loop below
+    phase = startup_phase_begin("wait for workers");
+    jobs_wait(&startup_jobs);
+    startup_phase_end(phase);
     
     printf("[HOT_RELOAD] Hot reload system started. Press F5 to force reload, F6 to restart.\n");
     
     // Keep track of old APIs for cleanup
     GameAPI old_game_apis[32];
     int old_api_count = 0;
+    // Versions that live patches jump into, loaded until the next restart
+    GameAPI patch_game_apis[32];
+    int patch_api_count = 0;
+    // The newest version crashing rolls back to the one before it: the old
+    // library, or the code its live patch overwrote
+    GameSnapshot game_snapshot = {0};
+    bool last_reload_patched = false;
     time_t last_rebuild_time = 0;
     const time_t rebuild_cooldown = 2;
+    time_t last_call_report_time = 0;
+    time_t last_resource_poll_time = 0;
+    int asset_check_frames = 0;
+    int idle_fps = 0;
     
     // Main game loop with hot reload
     while (game_api.should_run()) {
         time_t current_time = time(NULL);
+        bool game_updated = true;
+        // In the background the loop ticks slowly, but a change in a watched
+        // directory (a saved source, a rebuilt library) wakes it at once
+        int new_idle_fps = host_idle_fps();
+        if (new_idle_fps != idle_fps) {
+            if (new_idle_fps > 0) {
+                printf("[HOT_RELOAD] Window in the background, ticking at %d FPS\n", new_idle_fps);
+            } else {
+                printf("[HOT_RELOAD] Window in the foreground, full rate\n");
+            }
+            idle_fps = new_idle_fps;
+        }
+        if (idle_fps > 0) {
+            double idle_start = GetTime();
+            if (!dir_watcher_wait(1.0 / idle_fps)) WaitTime(1.0 / idle_fps);
+            frame_pacer_reset();
+            frame_stats_mark(FRAME_MARK_IDLE, GetTime() - idle_start);
+        } else {
+            // Frames start on time, whatever the host did at the end of the last one
+            frame_pacer_wait();
+        }
+        profiler_frame_mark();
+        frame_stats_frame_begin();
+        // With the watcher, assets are checked for one full round after
+        // something in resources/ changed, instead of a few every frame.
+        // Without it, the atlas is checked once a second.
+        bool resources_changed = dir_watcher_changed(resource_watch);
+        if (resource_watch < 0 && current_time != last_resource_poll_time) {
+            last_resource_poll_time = current_time;
+            resources_changed = true;
+        }
+        if (resources_changed) {
+            asset_check_frames = ASSETS_MAX / ASSETS_CHECKS_PER_FRAME;
+            if (sprites_atlas_stale()) {
+                repack_resources();
+            } else {
+                sprites_check_changes();
+            }
+        }
+        if (resource_watch < 0 || asset_check_frames > 0) {
+            assets_check_changes();
+            if (asset_check_frames > 0) asset_check_frames--;
+        }
+        assets_update(ASSETS_UPLOAD_BUDGET_MS);
+        sprites_frame_end();
+        text_cache_frame_end();
         
 #ifdef HOT_RELOAD_FILE_WATCHER
-        if ((current_time - last_rebuild_time) >= rebuild_cooldown && file_watcher_check()) {
+        bool files_changed = false;
+        if ((current_time - last_rebuild_time) >= rebuild_cooldown &&
+            (source_watch < 0 || dir_watcher_changed(source_watch))) {
+            PROFILE_ZONE_BEGIN(watcher_check);
+            double watcher_start = GetTime();
+            files_changed = file_watcher_check();
+            frame_stats_mark(FRAME_MARK_WATCHER, GetTime() - watcher_start);
+            PROFILE_ZONE_END(watcher_check);
+        }
+
+        // A build that relinks nothing leaves its reload record to be ended
+        // below, once the libraries were checked
+        bool build_succeeded = false;
+        if (files_changed) {
             printf("[HOT_RELOAD] Files changed, rebuilding...\n");
             last_rebuild_time = current_time;
+            reload_telemetry_begin(file_watcher_changed_time);
+            PROFILE_ZONE_BEGIN(rebuild);
+            double rebuild_start = GetTime();
+            reload_telemetry_stage_begin(RELOAD_STAGE_BUILD);
             
         #ifdef BUILD_TYPE_DEBUG
             #ifndef _WIN32
@@ -165,10 +602,23 @@ int main() {
             #ifdef _WIN32
             int build_result = system("build_hot_reload.bat");
             #else
-            int build_result = system("./build_hot_reload.sh");
+            int build_result;
+            if (file_watcher_changed_module[0]) {
+                // Only that module's library is rebuilt, the game library stays as it is
+                char build_command[128];
+                snprintf(build_command, sizeof(build_command), "./build_hot_reload.sh module %s", file_watcher_changed_module);
+                build_result = system(build_command);
+            } else {
+                build_result = system("./build_hot_reload.sh");
+            }
             #endif
         #endif
+            reload_telemetry_stage_end(RELOAD_STAGE_BUILD);
+            PROFILE_ZONE_END(rebuild);
+            frame_stats_mark(FRAME_MARK_REBUILD, GetTime() - rebuild_start);
+
             if (build_result == 0) {
+                build_succeeded = true;
                 // Build successful, reload file versions
                 //
                 // This is needed, because when a file changes, the hot reload system rebuilds
@@ -186,53 +636,285 @@ int main() {
                 }
             } else {
                 printf("[HOT_RELOAD] Build failed with exit code: %d\n", build_result);
+                reload_telemetry_abort("build failed");
             }
         } else {
-            game_api.update();
+            PROFILE_ZONE_BEGIN(game_update);
+            reload_telemetry_stage_begin(RELOAD_STAGE_FIRST_UPDATE);
+            game_updated = game_call_guarded(game_api.update);
+            if (!game_updated) reload_telemetry_abort("game_update() crashed");
+            reload_telemetry_stage_end(RELOAD_STAGE_FIRST_UPDATE);
+            PROFILE_ZONE_END(game_update);
         }
 #else
-        game_api.update();
+        PROFILE_ZONE_BEGIN(game_update);
+        reload_telemetry_stage_begin(RELOAD_STAGE_FIRST_UPDATE);
+        game_updated = game_call_guarded(game_api.update);
+        if (!game_updated) reload_telemetry_abort("game_update() crashed");
+        reload_telemetry_stage_end(RELOAD_STAGE_FIRST_UPDATE);
+        PROFILE_ZONE_END(game_update);
 #endif
+
+        // Roll back to the previous version and the memory it had, instead of
+        // losing everything to a typo
+        if (!game_updated) {
+            double rollback_start = GetTime();
+            GameAPI crashed = {0};
+            bool rolled_back = false;
+            if (game_snapshot.valid && last_reload_patched && patch_api_count > 0) {
+                crashed = patch_game_apis[patch_api_count - 1];
+                char crashed_dll_name[256];
+                snprintf(crashed_dll_name, sizeof(crashed_dll_name), GAME_DLL_DIR "game_%d" DLL_EXT, crashed.api_version);
+                if (live_patch_revert(crashed_dll_name)) {
+                    patch_api_count--;
+                    rolled_back = true;
+                }
+            } else if (game_snapshot.valid && !last_reload_patched && old_api_count > 0) {
+                crashed = game_api;
+                game_api = old_game_apis[--old_api_count];
+                game_api.set_raylib_api(frame_stats_wrap(active_raylib_api));
+                if (game_api.set_host_api) game_api.set_host_api(host_api);
+                // Not loaded again until it's rebuilt
+                game_api.modification_time = crashed.modification_time;
+                rolled_back = true;
+            }
+
+            if (!rolled_back) {
+                printf("[HOT_RELOAD] game_%d crashed in game_update() (%s at %p), no version to roll back to\n",
+                       game_api.api_version, crash_guard_signal_name(), crash_guard_fault_address());
+                crash_guard_fatal();
+            }
+
+            void* game_memory = game_snapshot.memory;
+            game_snapshot_restore(&game_snapshot);
+            if (!last_reload_patched && !game_call_guarded_arg(game_api.hot_reloaded, game_memory)) {
+                printf("[HOT_RELOAD] game_%d crashed again while rolling back\n", game_api.api_version);
+                crash_guard_fatal();
+            }
+            unload_game_api(&crashed);
+
+            char message[256];
+            snprintf(message, sizeof(message), "game_%d crashed in game_update() (%s at %p), rolled back to the previous version",
+                     crashed.api_version, crash_guard_signal_name(), crash_guard_fault_address());
+            printf("[HOT_RELOAD] %s\n", message);
+            frame_stats_report_error(message);
+            frame_stats_mark(FRAME_MARK_ROLLBACK, GetTime() - rollback_start);
+            continue;
+        }
+
+        startup_frame_end(assets_pending());
+
+        if (IsKeyPressed(KEY_F9)) {
+            profiler_export_chrome_trace(PROFILE_TRACE_PATH);
+            if (perf_counters_enabled) {
+                perf_counters_print_report();
+                perf_counters_write_csv(PERF_COUNTERS_CSV_PATH);
+            }
+            if (sampling_profiler_active()) {
+                sampling_profiler_write_folded(SAMPLING_FOLDED_PATH);
+            }
+            frame_stats_write_csv(FRAME_STATS_CSV_PATH);
+            reload_telemetry_print_summary();
+            frame_pacer_print_summary();
+            assets_print_stats();
+            text_cache_print_stats();
+        }
+
+        if (IsKeyPressed(KEY_F10)) {
+            frame_stats_toggle_overlay();
+        }
         
+        // Both diagnostic tables wrap the direct one, so turning one on turns the other off
+        bool toggle_call_stats = IsKeyPressed(KEY_F7);
+        // A capture that stopped on an error switches back like F8
+        bool toggle_capture = IsKeyPressed(KEY_F8) ||
+                              (active_raylib_api == capture_raylib_api && !raylib_capture_active());
+        if (toggle_call_stats || toggle_capture) {
+            bool call_stats_was_on = active_raylib_api == instrumented_raylib_api;
+            bool capture_was_on = active_raylib_api == capture_raylib_api;
+
+            if (call_stats_was_on) {
+                raylib_call_stats_print_top(RAYLIB_CALLS_REPORT_TOP);
+                raylib_call_stats_write_csv(RAYLIB_CALLS_CSV_PATH);
+                printf("[HOT_RELOAD] raylib call instrumentation OFF\n");
+            }
+            if (capture_was_on) {
+                raylib_capture_stop();
+            }
+            active_raylib_api = raylib_api;
+
+            if (toggle_call_stats && !call_stats_was_on) {
+                if (!instrumented_raylib_api) {
+                    instrumented_raylib_api = create_raylib_api_instrumented(raylib_api);
+                }
+                raylib_call_stats_reset();
+                active_raylib_api = instrumented_raylib_api;
+                printf("[HOT_RELOAD] raylib call instrumentation ON (timing %s)\n", raylib_call_stats.timing ? "on" : "off");
+            } else if (toggle_capture && !capture_was_on) {
+                if (!capture_raylib_api) {
+                    capture_raylib_api = create_raylib_api_capture(raylib_api);
+                }
+                if (raylib_capture_start(RAYLIB_CAPTURE_PATH, raylib_call_names, RL_CALL_COUNT)) {
+                    active_raylib_api = capture_raylib_api;
+                }
+            }
+
+            game_api.set_raylib_api(frame_stats_wrap(active_raylib_api));
+            set_runtime_draw(frame_stats_wrap(active_raylib_api), active_raylib_api == raylib_api);
+            for (int i = 0; i < patch_api_count; i++) {
+                patch_game_apis[i].set_raylib_api(frame_stats_wrap(active_raylib_api));
+            }
+            for (int i = 0; i < GAME_MODULE_COUNT; i++) {
+                if (game_modules[i].set_raylib_api) game_modules[i].set_raylib_api(frame_stats_wrap(active_raylib_api));
+            }
+        }
+
+        if (active_raylib_api == instrumented_raylib_api) {
+            raylib_call_stats_frame_end();
+            if (current_time != last_call_report_time) {
+                last_call_report_time = current_time;
+                raylib_call_stats_print_top(RAYLIB_CALLS_REPORT_TOP);
+            }
+        }
+
         bool force_reload = game_api.force_reload ? game_api.force_reload() : false;
         bool force_restart = game_api.force_restart ? game_api.force_restart() : false;
         bool reload = force_reload || force_restart;
         
-        // Check if DLL/lib has been modified
-        time_t current_mod_time = platform_get_modification_time(GAME_DLL_PATH);
+        // Libraries are only looked at after something in their directory changed
+        bool libraries_changed = library_watch < 0 || dir_watcher_changed(library_watch);
+
+        // Modules are reloaded on their own, without touching the game library
+        bool module_reloaded = false;
+        for (int i = 0; i < GAME_MODULE_COUNT && libraries_changed; i++) {
+            GameModuleLib* module = &game_modules[i];
+            char module_path[256];
+            game_module_path(module_path, sizeof(module_path), module, -1);
+            time_t module_mod_time = platform_get_modification_time(module_path);
+            if (module_mod_time == 0 || module_mod_time == module->modification_time) continue;
+
+            uint64_t module_hash = 0;
+            if (elf_content_hash(module_path, &module_hash) && module_hash == module->content_hash) {
+                printf("[HOT_RELOAD] Module %s rebuilt without changes, reload skipped\n", module->name);
+                module->modification_time = module_mod_time;
+                reload_telemetry_skip("module library unchanged");
+                continue;
+            }
+
+            printf("[HOT_RELOAD] Reloading module %s...\n", module->name);
+            double module_reload_start = GetTime();
+            reload_telemetry_begin(0);
+            module_reloaded = true;
+            if (!load_game_module(module, frame_stats_wrap(active_raylib_api), host_api)) {
+                reload_telemetry_abort("failed to load the new module");
+            }
+            frame_stats_mark(FRAME_MARK_SWAP, GetTime() - module_reload_start);
+        }
+
+        // Check if DLL/lib has been modified. Rebuilds after comment or
+        // whitespace edits link the same code and data again, and are skipped.
+        time_t current_mod_time = libraries_changed ? platform_get_modification_time(GAME_DLL_PATH) : 0;
         if (current_mod_time != 0 && game_api.modification_time != current_mod_time) {
-            reload = true;
+            uint64_t hash = 0;
+            if (!reload && elf_content_hash(GAME_DLL_PATH, &hash) && hash == loaded_game_hash) {
+                printf("[HOT_RELOAD] %s rebuilt without changes, reload skipped\n", GAME_DLL_PATH);
+                game_api.modification_time = current_mod_time;
+                reload_telemetry_skip("library unchanged");
+            } else {
+                reload = true;
+            }
         }
         
+        // Skipped rebuilds already ended their record
+        if (build_succeeded && !module_reloaded && !reload) {
+            reload_telemetry_abort("the build produced no new library");
+        }
+
         if (reload) {
             printf("[HOT_RELOAD] Reloading game library...\n");
+            PROFILE_ZONE_BEGIN(reload);
+            double reload_start = GetTime();
+            reload_telemetry_begin(0);
             
             GameAPI new_game_api = {0};
             if (load_game_api(&new_game_api, game_api_version)) {
+                loaded_game_hash = new_game_api.content_hash;
                 // Check if we need a full restart
                 bool need_restart = force_restart;
                 if (game_api.memory_size && new_game_api.memory_size) {
                     need_restart = need_restart || (game_api.memory_size() != new_game_api.memory_size());
                 }
                 
-                if (!need_restart) {
+                // Live patching: the host keeps calling the current version, and the
+                // changed functions jump into the new one, which is set up as if it
+                // was swapped in. F5 still swaps the whole library.
+                bool live_patched = false;
+                bool rejected = false;
+                // game_hot_reloaded() already ran on the game memory, and the
+                // snapshot holds the memory from before it
+                bool took_memory = false;
+                if (!need_restart && !force_reload && live_patch_enabled() && patch_api_count < 32) {
+                    reload_telemetry_stage_begin(RELOAD_STAGE_SWAP);
+                    game_snapshot_take(&game_snapshot, &game_api);
+                    new_game_api.set_raylib_api(frame_stats_wrap(active_raylib_api));
+                    if (new_game_api.set_host_api) new_game_api.set_host_api(host_api);
+
+                    char new_game_dll_name[256];
+                    snprintf(new_game_dll_name, sizeof(new_game_dll_name), GAME_DLL_DIR "game_%d" DLL_EXT, new_game_api.api_version);
+                    if (!game_call_guarded_arg(new_game_api.hot_reloaded, game_api.memory())) {
+                        rejected = true;
+                    } else {
+                        took_memory = true;
+                        if (live_patch_apply(new_game_dll_name) >= 0) {
+                            printf("[HOT_RELOAD] Live patched (function pointers stay valid)...\n");
+                            patch_game_apis[patch_api_count++] = new_game_api;
+                            game_api.modification_time = new_game_api.modification_time;
+                            live_patched = true;
+                            last_reload_patched = true;
+                        }
+                    }
+                    reload_telemetry_stage_end(RELOAD_STAGE_SWAP);
+                }
+
+                if (rejected) {
+                    reject_game_api(&new_game_api, &game_api, &game_snapshot);
+                    reload_telemetry_abort("game_hot_reloaded() crashed");
+                } else if (live_patched) {
+                    // Nothing to swap
+                } else if (!need_restart) {
                     printf("[HOT_RELOAD] Hot reloading (preserving state)...\n");
                     
-                    if (old_api_count < 32) {
-                        old_game_apis[old_api_count++] = game_api;
+                    // The new version is only swapped in once it took the game memory.
+                    // After a failed live patch it already did, and the swap stage
+                    // was timed with the patch.
+                    bool took = took_memory;
+                    if (!took) {
+                        reload_telemetry_stage_begin(RELOAD_STAGE_SWAP);
+                        void* game_memory = game_api.memory();
+                        game_snapshot_take(&game_snapshot, &game_api);
+                        new_game_api.set_raylib_api(frame_stats_wrap(active_raylib_api));
+                        if (new_game_api.set_host_api) new_game_api.set_host_api(host_api);
+                        took = game_call_guarded_arg(new_game_api.hot_reloaded, game_memory);
+                    }
+                    if (took) {
+                        if (old_api_count < 32) {
+                            old_game_apis[old_api_count++] = game_api;
+                        } else {
+                            unload_game_api(&old_game_apis[0]);
+                            memmove(old_game_apis, old_game_apis + 1, sizeof(GameAPI) * 31);
+                            old_game_apis[31] = game_api;
+                        }
+                        game_api = new_game_api;
+                        last_reload_patched = false;
                     } else {
-                        unload_game_api(&old_game_apis[0]);
-                        memmove(old_game_apis, old_game_apis + 1, sizeof(GameAPI) * 31);
-                        old_game_apis[31] = game_api;
+                        reject_game_api(&new_game_api, &game_api, &game_snapshot);
+                        reload_telemetry_abort("game_hot_reloaded() crashed");
                     }
-                    
-                    void* game_memory = game_api.memory();
-                    game_api = new_game_api;
-                    game_api.set_raylib_api(raylib_api);
-                    game_api.hot_reloaded(game_memory);
+                    if (!took_memory) reload_telemetry_stage_end(RELOAD_STAGE_SWAP);
                 } else {
                     printf("[HOT_RELOAD] Full restart (losing state)...\n");
                     
+                    reload_telemetry_stage_begin(RELOAD_STAGE_SWAP);
                     game_api.shutdown();
                     
                     // Clean up old APIs
@@ -240,22 +922,48 @@ int main() {
                         unload_game_api(&old_game_apis[i]);
                     }
                     old_api_count = 0;
+                    for (int i = 0; i < patch_api_count; i++) {
+                        unload_game_api(&patch_game_apis[i]);
+                    }
+                    patch_api_count = 0;
                     
                     unload_game_api(&game_api);
                     game_api = new_game_api;
-                    game_api.set_raylib_api(raylib_api);
+                    game_api.set_raylib_api(frame_stats_wrap(active_raylib_api));
+                    if (game_api.set_host_api) game_api.set_host_api(host_api);
+                    // Nothing left to roll back to
+                    game_snapshot.valid = false;
 
                     game_api.init();
+                    // Whatever the new init didn't load again is gone for good
+                    assets_collect_unused();
+                    reload_telemetry_stage_end(RELOAD_STAGE_SWAP);
                 }
                 
                 game_api_version++;
+
+                // Counters of the new library are kept apart, to compare them with the old one
+                perf_counters_set_generation(game_api.api_version);
             } else {
                 printf("[HOT_RELOAD] Failed to load new game API, continuing with old one...\n");
+                reload_telemetry_abort("failed to load the new library");
             }
+
+            frame_stats_mark(FRAME_MARK_SWAP, GetTime() - reload_start);
+            PROFILE_ZONE_END(reload);
         }
     }
     
     // Cleanup
+    raylib_capture_stop();
+    reload_telemetry_print_summary();
+    frame_pacer_print_summary();
+    if (sampling_profiler_active()) {
+        sampling_profiler_stop();
+        sampling_profiler_write_folded(SAMPLING_FOLDED_PATH);
+    }
+    modules_shutdown();
+    unload_game_modules();
     game_api.shutdown();
     
     for (int i = 0; i < old_api_count; i++) {
@@ -264,6 +972,12 @@ int main() {
     
     game_api.shutdown_window();
     unload_game_api(&game_api);
+
+    // Last, the functions of the game library may jump into them
+    for (int i = 0; i < patch_api_count; i++) {
+        unload_game_api(&patch_game_apis[i]);
+    }
+    free(game_snapshot.copy);
     
     return 0;
 }
\ No newline at end of file
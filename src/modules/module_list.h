@@ -0,0 +1,16 @@
+#ifndef MODULES_MODULE_LIST_H
+#define MODULES_MODULE_LIST_H
+
+#include "../runtime/modules.h"
+
+// Every game module, X(name) for the one in src/modules/<name>/. The hot
+// reload host loads module_<name> for each, regular builds register them
+// from main.c.
+#define GAME_MODULES(X) \
+    X(spinner)
+
+#define GAME_MODULE_DECLARE(name) const GameModuleAPI* name##_module_get(void);
+GAME_MODULES(GAME_MODULE_DECLARE)
+#undef GAME_MODULE_DECLARE
+
+#endif // MODULES_MODULE_LIST_H
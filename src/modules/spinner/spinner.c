@@ -0,0 +1,30 @@
+// Example module: a spinning square in the top bar. Edit it while the game
+// runs, only module_spinner is rebuilt and reloaded, and the angle is kept.
+#include "game.h"
+
+typedef struct {
+    float angle;
+} Spinner;
+
+static void spinner_update(void* memory) {
+    Spinner* spinner = memory;
+    spinner->angle += 180.0f * GetFrameTime();
+    if (spinner->angle > 360.0f) spinner->angle -= 360.0f;
+}
+
+static void spinner_draw(void* memory) {
+    Spinner* spinner = memory;
+    Rectangle square = { (float)GetScreenWidth() - 30.0f, 25.0f, 20.0f, 20.0f };
+    Vector2 center = { 10.0f, 10.0f };
+    DrawRectanglePro(square, center, spinner->angle, GOLD);
+}
+
+GAME_MODULE_ENTRY(spinner) {
+    static const GameModuleAPI api = {
+        .name = "spinner",
+        .memory_size = sizeof(Spinner),
+        .update = spinner_update,
+        .draw = spinner_draw,
+    };
+    return &api;
+}
@@ -0,0 +1,176 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "asset_pack.h"
+#include "raylib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+typedef struct {
+    const unsigned char* base;
+    size_t size;
+    const AssetPackEntry* entries;
+    uint32_t count;
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE mapping;
+#endif
+} AssetPack;
+
+static AssetPack asset_pack = {0};
+// Of the last file asset_pack_open() was called on, valid or not
+static long asset_pack_mod_time = 0;
+
+static bool asset_pack_map(const char* path) {
+#ifdef _WIN32
+    asset_pack.file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL,
+                                  OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, NULL);
+    if (asset_pack.file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    asset_pack.mapping = GetFileSizeEx(asset_pack.file, &size)
+        ? CreateFileMappingA(asset_pack.file, NULL, PAGE_READONLY, 0, 0, NULL) : NULL;
+    asset_pack.base = asset_pack.mapping ? MapViewOfFile(asset_pack.mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+    if (!asset_pack.base) {
+        if (asset_pack.mapping) CloseHandle(asset_pack.mapping);
+        CloseHandle(asset_pack.file);
+        return false;
+    }
+    asset_pack.size = (size_t)size.QuadPart;
+    return true;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+
+    // The mapping stays valid after close(), and after the packer replaces
+    // the file, since it writes a new one and renames it over this one
+    void* base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) return false;
+
+    // Everything in the pack is about to be uploaded, start paging it in
+    posix_madvise(base, (size_t)st.st_size, POSIX_MADV_WILLNEED);
+
+    asset_pack.base = (const unsigned char*)base;
+    asset_pack.size = (size_t)st.st_size;
+    return true;
+#endif
+}
+
+void asset_pack_close(void) {
+    if (!asset_pack.base) return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(asset_pack.base);
+    CloseHandle(asset_pack.mapping);
+    CloseHandle(asset_pack.file);
+#else
+    munmap((void*)asset_pack.base, asset_pack.size);
+#endif
+    memset(&asset_pack, 0, sizeof(asset_pack));
+}
+
+// Same size as the packer writes: every mip level, one after another. 0 for
+// sizes or formats raylib can't upload.
+static uint64_t asset_pack_entry_data_size(const AssetPackEntry* entry) {
+    if (entry->width <= 0 || entry->height <= 0 || entry->mipmaps <= 0 ||
+        entry->width > ASSET_PACK_MAX_DIMENSION || entry->height > ASSET_PACK_MAX_DIMENSION) {
+        return 0;
+    }
+
+    uint64_t size = 0;
+    int width = entry->width;
+    int height = entry->height;
+    for (int level = 0; level < entry->mipmaps; level++) {
+        int level_size = GetPixelDataSize(width, height, entry->format);
+        if (level_size <= 0) return 0;
+        size += (uint64_t)level_size;
+        width = width > 1 ? width / 2 : 1;
+        height = height > 1 ? height / 2 : 1;
+    }
+    return size;
+}
+
+// Maps the pack and checks that the index and every entry are inside the
+// file, at the packer's alignment, and large enough for the pixels their
+// size and format describe. Returns false (and no pack is used) on any
+// mismatch, e.g. a pack written by an older packer.
+bool asset_pack_open(const char* path) {
+    asset_pack_close();
+    asset_pack_mod_time = GetFileModTime(path);
+    if (!asset_pack_map(path)) return false;
+
+    const AssetPackHeader* header = (const AssetPackHeader*)asset_pack.base;
+    bool valid = asset_pack.size >= sizeof(AssetPackHeader) &&
+                 header->magic == ASSET_PACK_MAGIC &&
+                 header->version == ASSET_PACK_VERSION &&
+                 header->count <= (asset_pack.size - sizeof(AssetPackHeader)) / sizeof(AssetPackEntry);
+
+    const AssetPackEntry* entries = (const AssetPackEntry*)(asset_pack.base + sizeof(AssetPackHeader));
+    for (uint32_t i = 0; valid && i < header->count; i++) {
+        uint64_t data_size = asset_pack_entry_data_size(&entries[i]);
+        valid = entries[i].offset <= asset_pack.size &&
+                entries[i].offset % ASSET_PACK_ALIGNMENT == 0 &&
+                entries[i].size <= asset_pack.size - entries[i].offset &&
+                data_size > 0 && entries[i].size >= data_size &&
+                memchr(entries[i].path, '\0', ASSET_PACK_PATH_LENGTH) != NULL;
+    }
+
+    if (!valid) {
+        printf("[ASSET_PACK] %s is not a valid version %d pack, ignoring it\n", path, ASSET_PACK_VERSION);
+        asset_pack_close();
+        return false;
+    }
+
+    asset_pack.entries = entries;
+    asset_pack.count = header->count;
+    printf("[ASSET_PACK] Mapped %s: %u entries, %.1f MB\n", path, asset_pack.count,
+           (double)asset_pack.size / (1024.0 * 1024.0));
+    return true;
+}
+
+// Whether the file was rewritten since asset_pack_open() last looked at it
+bool asset_pack_changed(const char* path) {
+    return GetFileModTime(path) != asset_pack_mod_time;
+}
+
+static int compare_entry_path(const void* key, const void* entry) {
+    return strcmp((const char*)key, ((const AssetPackEntry*)entry)->path);
+}
+
+const AssetPackEntry* asset_pack_find(const char* path) {
+    if (!asset_pack.entries) return NULL;
+    return bsearch(path, asset_pack.entries, asset_pack.count, sizeof(AssetPackEntry), compare_entry_path);
+}
+
+const void* asset_pack_data(const AssetPackEntry* entry) {
+    return asset_pack.base + entry->offset;
+}
+
+void asset_pack_prefetch(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return;
+
+    const size_t chunk = 256 * 1024;
+    char* buffer = malloc(chunk);
+    if (buffer) {
+        while (fread(buffer, 1, chunk, file) == chunk) {}
+        free(buffer);
+    }
+    fclose(file);
+}
@@ -0,0 +1,62 @@
+#ifndef RUNTIME_ASSET_PACK_H
+#define RUNTIME_ASSET_PACK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Precompiled asset pack.
+//
+// tools/asset_packer.c decodes every image under resources/ once, at build
+// time, into GPU-ready pixels (RGBA8, optionally premultiplied and with
+// mipmaps) and writes them into a single file behind a sorted index. The
+// registry maps that file and uploads textures straight from the mapping,
+// so loading a packed texture is one lookup and one upload: no open(), no
+// read and no decode per texture.
+//
+// File layout: AssetPackHeader, then `count` AssetPackEntry sorted by path,
+// then the pixel data of every entry at ASSET_PACK_ALIGNMENT. Offsets are
+// from the start of the file.
+#define ASSET_PACK_PATH "resources/assets.pack"
+#define ASSET_PACK_MAGIC 0x4B505241 // "ARPK"
+#define ASSET_PACK_VERSION 1
+#define ASSET_PACK_PATH_LENGTH 256
+#define ASSET_PACK_ALIGNMENT 64
+// Larger entries are rejected, their size wouldn't fit raylib's int sizes
+#define ASSET_PACK_MAX_DIMENSION 16384
+
+// Entry flags
+#define ASSET_PACK_PREMULTIPLIED 1
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;
+    uint32_t reserved;
+} AssetPackHeader;
+
+typedef struct {
+    char path[ASSET_PACK_PATH_LENGTH];
+    uint64_t offset;
+    uint64_t size;
+    // FNV-1a of the source file, and its modification time when packed
+    uint64_t content_hash;
+    int64_t mod_time;
+    int32_t width;
+    int32_t height;
+    int32_t format;
+    int32_t mipmaps;
+    uint32_t flags;
+    uint32_t reserved;
+} AssetPackEntry;
+
+bool asset_pack_open(const char* path);
+void asset_pack_close(void);
+const AssetPackEntry* asset_pack_find(const char* path);
+const void* asset_pack_data(const AssetPackEntry* entry);
+bool asset_pack_changed(const char* path);
+
+// Reads the whole file once, so its pages are in the OS page cache before the
+// registry maps it. Touches no registry state and is safe from a worker thread.
+void asset_pack_prefetch(const char* path);
+
+#endif // RUNTIME_ASSET_PACK_H
@@ -0,0 +1,666 @@
+#include "assets.h"
+#include "jobs.h"
+#include "asset_pack.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ASSET_PATH_LENGTH 256
+
+typedef struct {
+    char path[ASSET_PATH_LENGTH];
+    uint64_t path_hash;
+    uint64_t content_hash;
+    long mod_time;
+    AssetType type;
+    int refs;
+    int pending;
+    bool loaded;
+    // Unloaded to stay within the residency budget, reloaded when drawn
+    bool evicted;
+    uint64_t last_used_frame;
+    union {
+        Texture2D texture;
+        Font font;
+        Sound sound;
+    } data;
+} Asset;
+
+// Read and decoded on a worker, uploaded by assets_update() on the main thread
+typedef struct AssetJob {
+    uint32_t id;
+    AssetType type;
+    char path[ASSET_PATH_LENGTH];
+    uint64_t known_hash;
+    bool known_loaded;
+
+    long mod_time;
+    uint64_t content_hash;
+    bool unchanged;
+    bool decoded;
+    // image points into the asset pack, nothing to unload
+    const AssetPackEntry* packed;
+    bool from_pack;
+    Image image;
+    Wave wave;
+
+    struct AssetJob* next;
+} AssetJob;
+
+typedef struct {
+    Asset assets[ASSETS_MAX];
+    int count;
+
+    Texture2D placeholder;
+    JobLock finished_lock;
+    AssetJob* finished;
+    int in_flight;
+    int next_check;
+    bool pack_opened;
+    // The packer rewrote the pack, it's mapped again once no job points into it
+    bool pack_stale;
+
+    size_t budget_bytes;
+    uint64_t frame;
+    AssetsFrameStats frame_stats;
+    AssetsFrameStats last_frame_stats;
+    uint64_t evictions;
+    uint64_t misses;
+
+    // Loads answered without touching the file contents, loads where the
+    // file was read but turned out unchanged, uploads straight from the
+    // asset pack, and actual decodes
+    uint64_t hits;
+    uint64_t unchanged;
+    uint64_t pack_uploads;
+    uint64_t decodes;
+} Assets;
+
+static Assets assets = {
+    .budget_bytes = (size_t)ASSETS_DEFAULT_BUDGET_MB * 1024 * 1024,
+};
+
+static const char* asset_type_names[] = { "texture", "font", "sound" };
+
+static size_t texture_bytes(Texture2D texture) {
+    size_t size = 0;
+    int width = texture.width;
+    int height = texture.height;
+    for (int level = 0; level < texture.mipmaps; level++) {
+        size += (size_t)GetPixelDataSize(width, height, texture.format);
+        width = width > 1 ? width / 2 : 1;
+        height = height > 1 ? height / 2 : 1;
+    }
+    return size;
+}
+
+static size_t asset_gpu_bytes(const Asset* asset) {
+    if (!asset->loaded) return 0;
+
+    switch (asset->type) {
+        case ASSET_TEXTURE: return texture_bytes(asset->data.texture);
+        case ASSET_FONT: return texture_bytes(asset->data.font.texture);
+        case ASSET_SOUND: return 0;
+    }
+    return 0;
+}
+
+// Fonts keep their glyph images, sounds their samples (in the device format)
+static size_t asset_cpu_bytes(const Asset* asset) {
+    if (!asset->loaded) return 0;
+
+    size_t size = 0;
+    if (asset->type == ASSET_FONT && asset->data.font.glyphs) {
+        for (int i = 0; i < asset->data.font.glyphCount; i++) {
+            Image image = asset->data.font.glyphs[i].image;
+            size += (size_t)GetPixelDataSize(image.width, image.height, image.format);
+        }
+    } else if (asset->type == ASSET_SOUND) {
+        const AudioStream* stream = &asset->data.sound.stream;
+        size = (size_t)asset->data.sound.frameCount * stream->channels * stream->sampleSize / 8;
+    }
+    return size;
+}
+
+// FNV-1a, good enough to tell file versions apart
+static uint64_t hash_bytes(const unsigned char* data, size_t size) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static Asset* asset_get(AssetHandle handle) {
+    if (handle.id == 0 || handle.id > (uint32_t)assets.count) return NULL;
+    return &assets.assets[handle.id - 1];
+}
+
+static AssetHandle asset_handle(const Asset* asset) {
+    return (AssetHandle){ (uint32_t)(asset - assets.assets) + 1 };
+}
+
+static Asset* asset_find(const char* path, AssetType type) {
+    uint64_t path_hash = hash_bytes((const unsigned char*)path, strlen(path));
+    for (int i = 0; i < assets.count; i++) {
+        Asset* asset = &assets.assets[i];
+        if (asset->path_hash == path_hash && asset->type == type && strcmp(asset->path, path) == 0) {
+            return asset;
+        }
+    }
+    return NULL;
+}
+
+static void asset_unload_data(Asset* asset) {
+    if (!asset->loaded) return;
+
+    switch (asset->type) {
+        case ASSET_TEXTURE: UnloadTexture(asset->data.texture); break;
+        case ASSET_FONT: UnloadFont(asset->data.font); break;
+        case ASSET_SOUND: UnloadSound(asset->data.sound); break;
+    }
+    memset(&asset->data, 0, sizeof(asset->data));
+    asset->loaded = false;
+}
+
+// Replaces the texture contents. When the new image has the same size and
+// format the texture is updated in place, so even its GL id stays the same.
+static bool asset_set_texture(Asset* asset, Image image) {
+    Texture2D* current = &asset->data.texture;
+    if (asset->loaded && current->width == image.width && current->height == image.height &&
+        current->format == image.format && current->mipmaps == 1 && image.mipmaps == 1) {
+        UpdateTexture(*current, image.data);
+        return true;
+    }
+
+    Texture2D texture = LoadTextureFromImage(image);
+    if (texture.id == 0) return false;
+    asset_unload_data(asset);
+    asset->data.texture = texture;
+    asset->loaded = true;
+    asset->evicted = false;
+    return true;
+}
+
+// The version of a texture in the asset pack, if any. The pack is mapped on
+// first use.
+static const AssetPackEntry* asset_packed_entry(const Asset* asset) {
+    if (asset->type != ASSET_TEXTURE) return NULL;
+
+    if (!assets.pack_opened) {
+        assets.pack_opened = true;
+        asset_pack_open(ASSET_PACK_PATH);
+    }
+    return asset_pack_find(asset->path);
+}
+
+static Image asset_packed_image(const AssetPackEntry* packed) {
+    return (Image){
+        .data = (void*)asset_pack_data(packed),
+        .width = packed->width,
+        .height = packed->height,
+        .mipmaps = packed->mipmaps,
+        .format = packed->format,
+    };
+}
+
+// A packed entry can be used without reading the file when the file wasn't
+// touched since it was packed, or isn't shipped at all
+static bool asset_packed_is_current(const AssetPackEntry* packed, long mod_time) {
+    return mod_time == 0 || mod_time == packed->mod_time;
+}
+
+static void asset_upload_packed(Asset* asset, const AssetPackEntry* packed, long mod_time) {
+    if (asset->loaded && asset->content_hash == packed->content_hash) {
+        assets.unchanged++;
+    } else if (asset_set_texture(asset, asset_packed_image(packed))) {
+        asset->content_hash = packed->content_hash;
+        assets.pack_uploads++;
+    } else {
+        printf("[ASSETS] Failed to upload packed texture %s\n", asset->path);
+    }
+    asset->mod_time = mod_time;
+}
+
+// Textures and sounds are decoded from the bytes that were just hashed.
+// Fonts go through the path, since BMFont files reference their atlas image.
+static bool asset_decode(Asset* asset, const unsigned char* file_data, int file_size) {
+    const char* extension = GetFileExtension(asset->path);
+
+    switch (asset->type) {
+        case ASSET_TEXTURE: {
+            Image image = LoadImageFromMemory(extension, file_data, file_size);
+            if (!image.data) return false;
+            bool uploaded = asset_set_texture(asset, image);
+            UnloadImage(image);
+            if (!uploaded) return false;
+            break;
+        }
+        case ASSET_FONT: {
+            Font font = LoadFont(asset->path);
+            if (font.texture.id == 0) return false;
+            asset_unload_data(asset);
+            asset->data.font = font;
+            break;
+        }
+        case ASSET_SOUND: {
+            Wave wave = LoadWaveFromMemory(extension, file_data, file_size);
+            if (!wave.data) return false;
+            Sound sound = LoadSoundFromWave(wave);
+            UnloadWave(wave);
+            asset_unload_data(asset);
+            asset->data.sound = sound;
+            break;
+        }
+    }
+
+    asset->loaded = true;
+    return true;
+}
+
+// Brings the asset in line with the file on disk. Nothing is read when the
+// modification time didn't change, and nothing is decoded when the contents
+// didn't or the asset pack holds them. On failure the previous version (if
+// any) stays loaded.
+static void asset_refresh(Asset* asset) {
+    long mod_time = GetFileModTime(asset->path);
+    if (asset->loaded && mod_time == asset->mod_time) {
+        assets.hits++;
+        return;
+    }
+
+    const AssetPackEntry* packed = asset_packed_entry(asset);
+    if (packed && asset_packed_is_current(packed, mod_time)) {
+        asset_upload_packed(asset, packed, mod_time);
+        return;
+    }
+
+    int file_size = 0;
+    unsigned char* file_data = LoadFileData(asset->path, &file_size);
+    if (!file_data) {
+        printf("[ASSETS] Failed to read %s\n", asset->path);
+        return;
+    }
+
+    uint64_t content_hash = hash_bytes(file_data, (size_t)file_size);
+    if (asset->loaded && content_hash == asset->content_hash) {
+        asset->mod_time = mod_time;
+        assets.unchanged++;
+    } else if (packed && content_hash == packed->content_hash) {
+        // Only the modification time changed, e.g. the file was copied
+        asset_upload_packed(asset, packed, mod_time);
+    } else if (asset_decode(asset, file_data, file_size)) {
+        asset->content_hash = content_hash;
+        asset->mod_time = mod_time;
+        assets.decodes++;
+    } else {
+        printf("[ASSETS] Failed to decode %s %s\n", asset_type_names[asset->type], asset->path);
+        asset->mod_time = mod_time;
+    }
+
+    UnloadFileData(file_data);
+}
+
+static Asset* asset_register(const char* path, AssetType type) {
+    Asset* asset = asset_find(path, type);
+    if (asset) return asset;
+
+    if (assets.count >= ASSETS_MAX || strlen(path) >= ASSET_PATH_LENGTH) {
+        printf("[ASSETS] Can't register %s\n", path);
+        return NULL;
+    }
+
+    asset = &assets.assets[assets.count++];
+    memset(asset, 0, sizeof(*asset));
+    strcpy(asset->path, path);
+    asset->path_hash = hash_bytes((const unsigned char*)path, strlen(path));
+    asset->type = type;
+    return asset;
+}
+
+// Always returns a handle, even if the file can't be loaded yet, so it can be
+// fixed on disk without changing the game
+static AssetHandle asset_load(const char* path, AssetType type) {
+    Asset* asset = asset_register(path, type);
+    if (!asset) return (AssetHandle){0};
+
+    asset_refresh(asset);
+    asset->refs++;
+    return asset_handle(asset);
+}
+
+AssetHandle asset_load_texture(const char* path) {
+    return asset_load(path, ASSET_TEXTURE);
+}
+
+AssetHandle asset_load_font(const char* path) {
+    return asset_load(path, ASSET_FONT);
+}
+
+AssetHandle asset_load_sound(const char* path) {
+    return asset_load(path, ASSET_SOUND);
+}
+
+static void asset_job_push_finished(AssetJob* job) {
+    job_lock(&assets.finished_lock);
+    job->next = assets.finished;
+    assets.finished = job;
+    job_unlock(&assets.finished_lock);
+}
+
+static void asset_job_run(void* data) {
+    AssetJob* job = (AssetJob*)data;
+    const char* extension = GetFileExtension(job->path);
+
+    job->mod_time = GetFileModTime(job->path);
+
+    int file_size = 0;
+    unsigned char* file_data = LoadFileData(job->path, &file_size);
+    if (file_data) {
+        job->content_hash = hash_bytes(file_data, (size_t)file_size);
+        job->unchanged = job->known_loaded && job->content_hash == job->known_hash;
+
+        if (!job->unchanged && job->packed && job->content_hash == job->packed->content_hash) {
+            job->image = asset_packed_image(job->packed);
+            job->decoded = true;
+            job->from_pack = true;
+        } else if (!job->unchanged) {
+            if (job->type == ASSET_TEXTURE) {
+                job->image = LoadImageFromMemory(extension, file_data, file_size);
+                job->decoded = job->image.data != NULL;
+            } else if (job->type == ASSET_SOUND) {
+                job->wave = LoadWaveFromMemory(extension, file_data, file_size);
+                job->decoded = job->wave.data != NULL;
+            }
+        }
+        UnloadFileData(file_data);
+    }
+
+    asset_job_push_finished(job);
+}
+
+// Queues a read and decode of the asset. Fonts have no async path and are
+// refreshed right away.
+static void asset_request(Asset* asset) {
+    AssetJob* job = asset->type != ASSET_FONT ? calloc(1, sizeof(AssetJob)) : NULL;
+    if (!job) {
+        asset_refresh(asset);
+        return;
+    }
+
+    job->id = asset_handle(asset).id;
+    job->type = asset->type;
+    strcpy(job->path, asset->path);
+    job->known_hash = asset->content_hash;
+    job->known_loaded = asset->loaded;
+    job->packed = asset_packed_entry(asset);
+
+    asset->pending++;
+    assets.in_flight++;
+
+    // Current in the asset pack: no read or decode, straight to the upload
+    if (job->packed) {
+        job->mod_time = GetFileModTime(asset->path);
+        if (asset_packed_is_current(job->packed, job->mod_time)) {
+            job->content_hash = job->packed->content_hash;
+            job->unchanged = job->known_loaded && job->content_hash == job->known_hash;
+            job->image = asset_packed_image(job->packed);
+            job->decoded = true;
+            job->from_pack = true;
+            asset_job_push_finished(job);
+            return;
+        }
+    }
+
+    jobs_submit(asset_job_run, job);
+}
+
+// Registers the asset and returns right away. The file is read and decoded
+// on a worker thread and uploaded by assets_update(), until then textures
+// are drawn with a placeholder.
+static AssetHandle asset_load_async(const char* path, AssetType type) {
+    Asset* asset = asset_register(path, type);
+    if (!asset) return (AssetHandle){0};
+    asset->refs++;
+
+    if (type == ASSET_TEXTURE && assets.placeholder.id == 0) {
+        Image checked = GenImageChecked(16, 16, 4, 4, MAGENTA, BLACK);
+        assets.placeholder = LoadTextureFromImage(checked);
+        UnloadImage(checked);
+    }
+
+    if (asset->pending > 0) return asset_handle(asset);
+    if (asset->loaded && GetFileModTime(path) == asset->mod_time) {
+        assets.hits++;
+        return asset_handle(asset);
+    }
+
+    asset_request(asset);
+    return asset_handle(asset);
+}
+
+AssetHandle asset_load_texture_async(const char* path) {
+    return asset_load_async(path, ASSET_TEXTURE);
+}
+
+AssetHandle asset_load_sound_async(const char* path) {
+    return asset_load_async(path, ASSET_SOUND);
+}
+
+static void asset_job_finish(AssetJob* job) {
+    Asset* asset = asset_get((AssetHandle){ job->id });
+
+    bool uploaded = false;
+
+    if (job->unchanged) {
+        asset->mod_time = job->mod_time;
+        assets.unchanged++;
+    } else if (job->decoded && job->type == ASSET_TEXTURE) {
+        uploaded = asset_set_texture(asset, job->image);
+    } else if (job->decoded && job->type == ASSET_SOUND) {
+        asset_unload_data(asset);
+        asset->data.sound = LoadSoundFromWave(job->wave);
+        asset->loaded = true;
+        uploaded = true;
+    }
+
+    if (uploaded) {
+        asset->content_hash = job->content_hash;
+        asset->mod_time = job->mod_time;
+        if (job->from_pack) {
+            assets.pack_uploads++;
+        } else {
+            assets.decodes++;
+        }
+    } else if (!job->unchanged) {
+        printf("[ASSETS] Failed to load %s %s\n", asset_type_names[job->type], job->path);
+        // Don't retry the same broken file every check (or every draw, once
+        // evicted), wait for the next save
+        asset->mod_time = job->mod_time;
+        asset->evicted = false;
+    }
+
+    if (job->image.data && !job->from_pack) UnloadImage(job->image);
+    if (job->wave.data) UnloadWave(job->wave);
+
+    asset->pending--;
+    assets.in_flight--;
+    free(job);
+}
+
+// Unloads the least recently drawn textures until the resident textures fit
+// in the budget. Textures drawn in the last frame are never evicted, so an
+// undersized budget doesn't make them reload every frame.
+static void assets_enforce_budget(void) {
+    size_t gpu_bytes = 0;
+    for (int i = 0; i < assets.count; i++) {
+        gpu_bytes += asset_gpu_bytes(&assets.assets[i]);
+    }
+
+    while (assets.budget_bytes > 0 && gpu_bytes > assets.budget_bytes) {
+        Asset* oldest = NULL;
+        for (int i = 0; i < assets.count; i++) {
+            Asset* asset = &assets.assets[i];
+            if (asset->type != ASSET_TEXTURE || !asset->loaded || asset->pending > 0) continue;
+            if (asset->last_used_frame + 1 >= assets.frame) continue;
+            if (!oldest || asset->last_used_frame < oldest->last_used_frame) oldest = asset;
+        }
+        if (!oldest) break;
+
+        gpu_bytes -= asset_gpu_bytes(oldest);
+        asset_unload_data(oldest);
+        oldest->mod_time = 0;
+        oldest->evicted = true;
+        assets.frame_stats.evictions++;
+        assets.evictions++;
+    }
+
+    assets.frame_stats.gpu_bytes = gpu_bytes;
+}
+
+void assets_set_budget(size_t gpu_bytes) {
+    assets.budget_bytes = gpu_bytes;
+}
+
+// Stats of the last completed frame
+AssetsFrameStats assets_frame_stats(void) {
+    return assets.last_frame_stats;
+}
+
+// Uploads decoded assets until budget_ms is spent. At least one upload is
+// done per call, so loading always moves forward. Being called once per
+// frame, it also closes the frame stats and enforces the residency budget.
+void assets_update(double budget_ms) {
+    double start = GetTime();
+
+    assets_enforce_budget();
+    assets.frame_stats.budget_bytes = assets.budget_bytes;
+    assets.frame_stats.cpu_bytes = 0;
+    for (int i = 0; i < assets.count; i++) {
+        assets.frame_stats.cpu_bytes += asset_cpu_bytes(&assets.assets[i]);
+    }
+    assets.last_frame_stats = assets.frame_stats;
+    memset(&assets.frame_stats, 0, sizeof(assets.frame_stats));
+    assets.frame++;
+
+    for (;;) {
+        job_lock(&assets.finished_lock);
+        AssetJob* job = assets.finished;
+        if (job) assets.finished = job->next;
+        job_unlock(&assets.finished_lock);
+        if (!job) break;
+
+        asset_job_finish(job);
+
+        if ((GetTime() - start) * 1000.0 >= budget_ms) break;
+    }
+
+    if (assets.pack_stale && assets.in_flight == 0) {
+        assets.pack_stale = false;
+        printf("[ASSETS] %s changed, mapping it again\n", ASSET_PACK_PATH);
+        asset_pack_open(ASSET_PACK_PATH);
+    }
+}
+
+// Checks a slice of the loaded assets for changes on disk each call, and
+// reloads the changed ones in place through the async path. Handles, and
+// texture ids when the size is unchanged, stay the same, so neither the game
+// library nor game memory are involved.
+void assets_check_changes(void) {
+    if (assets.count == 0) return;
+    if (assets.pack_opened && !assets.pack_stale && asset_pack_changed(ASSET_PACK_PATH)) {
+        assets.pack_stale = true;
+    }
+
+    int checks = assets.count < ASSETS_CHECKS_PER_FRAME ? assets.count : ASSETS_CHECKS_PER_FRAME;
+    for (int i = 0; i < checks; i++) {
+        assets.next_check = (assets.next_check + 1) % assets.count;
+        Asset* asset = &assets.assets[assets.next_check];
+        if (asset->pending > 0 || asset->evicted || (!asset->loaded && asset->refs == 0)) continue;
+
+        long mod_time = GetFileModTime(asset->path);
+        if (mod_time != 0 && mod_time != asset->mod_time) {
+            printf("[ASSETS] %s changed, reloading\n", asset->path);
+            asset_request(asset);
+        }
+    }
+}
+
+int assets_pending(void) {
+    return assets.in_flight;
+}
+
+void asset_release(AssetHandle handle) {
+    Asset* asset = asset_get(handle);
+    if (asset && asset->refs > 0) {
+        asset->refs--;
+    }
+}
+
+// Assets still loading (or that failed to) are drawn with the placeholder.
+// Textures evicted by the residency budget are requested again, through the
+// asset pack when they're in it.
+Texture2D asset_texture(AssetHandle handle) {
+    Asset* asset = asset_get(handle);
+    if (!asset || asset->type != ASSET_TEXTURE) return (Texture2D){0};
+
+    asset->last_used_frame = assets.frame;
+    if (asset->loaded) {
+        assets.frame_stats.hits++;
+        return asset->data.texture;
+    }
+
+    assets.frame_stats.misses++;
+    assets.misses++;
+    if (asset->evicted && asset->pending == 0) {
+        asset_request(asset);
+    }
+    return assets.placeholder;
+}
+
+Font asset_font(AssetHandle handle) {
+    Asset* asset = asset_get(handle);
+    return (asset && asset->type == ASSET_FONT) ? asset->data.font : GetFontDefault();
+}
+
+Sound asset_sound(AssetHandle handle) {
+    Asset* asset = asset_get(handle);
+    return (asset && asset->type == ASSET_SOUND) ? asset->data.sound : (Sound){0};
+}
+
+// Unloads everything nobody holds a handle to. The entries (and handles)
+// stay valid, the next load of the same path decodes it again.
+void assets_collect_unused(void) {
+    int collected = 0;
+    for (int i = 0; i < assets.count; i++) {
+        Asset* asset = &assets.assets[i];
+        if (asset->refs == 0 && asset->loaded && asset->pending == 0) {
+            asset_unload_data(asset);
+            asset->mod_time = 0;
+            asset->evicted = false;
+            collected++;
+        }
+    }
+
+    if (collected > 0) {
+        printf("[ASSETS] Unloaded %d unused assets\n", collected);
+    }
+}
+
+void assets_print_stats(void) {
+    int resident = 0;
+    for (int i = 0; i < assets.count; i++) {
+        if (assets.assets[i].loaded) resident++;
+    }
+
+    printf("[ASSETS] %d registered, %d resident, %llu cache hits, %llu unchanged reads, %llu pack uploads, %llu decodes\n",
+           assets.count, resident, (unsigned long long)assets.hits, (unsigned long long)assets.unchanged,
+           (unsigned long long)assets.pack_uploads, (unsigned long long)assets.decodes);
+
+    const AssetsFrameStats* frame = &assets.last_frame_stats;
+    printf("[ASSETS] GPU %.1f MB of %.1f MB budget, CPU %.1f MB, %llu evictions, %llu draws of non-resident textures\n",
+           (double)frame->gpu_bytes / (1024.0 * 1024.0), (double)frame->budget_bytes / (1024.0 * 1024.0),
+           (double)frame->cpu_bytes / (1024.0 * 1024.0),
+           (unsigned long long)assets.evictions, (unsigned long long)assets.misses);
+}
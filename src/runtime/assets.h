@@ -0,0 +1,87 @@
+#ifndef RUNTIME_ASSETS_H
+#define RUNTIME_ASSETS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "raylib.h"
+
+// Asset registry.
+//
+// Assets are keyed by path and hold the hash of the file contents they were
+// loaded from. Loading an asset that is already resident and unchanged on
+// disk only bumps its reference count, so a game restart (which releases
+// everything in game_shutdown() and loads it again in game_init()) doesn't
+// decode or upload anything. In the hot reload workflow the registry lives
+// in the host, so it survives library reloads and restarts.
+//
+// Handles are stable for the whole run. Fetch the raylib object with
+// asset_texture() and friends when drawing instead of keeping a copy, so the
+// game always sees the current one.
+//
+// Released assets stay resident until assets_collect_unused(), which the host
+// calls once a restart has finished loading.
+//
+// The _async loaders read and decode on worker threads (see jobs.h) and return
+// immediately. Decoded assets are uploaded by assets_update(), called once per
+// frame by the host (or main.c) with ASSETS_UPLOAD_BUDGET_MS.
+//
+// The hot reload host also calls assets_check_changes() every frame, which
+// reloads assets edited on disk in place.
+//
+// Textures found in the asset pack (asset_pack.h) are uploaded straight from
+// it, without reading or decoding the file, as long as the file on disk is
+// the version that was packed or is missing.
+//
+// Resident textures are kept within a GPU memory budget (set with
+// assets_set_budget(), 0 for none). assets_update() unloads the least
+// recently drawn ones when it's exceeded, and drawing an evicted texture
+// (asset_texture()) loads it again through the async path, with the
+// placeholder in the meantime. assets_frame_stats() has the residency stats
+// of the last frame.
+#define ASSETS_MAX 1024
+#define ASSETS_UPLOAD_BUDGET_MS 2.0
+#define ASSETS_CHECKS_PER_FRAME 32
+#define ASSETS_DEFAULT_BUDGET_MB 512
+
+typedef struct {
+    uint32_t id;
+} AssetHandle;
+
+typedef enum {
+    ASSET_TEXTURE = 0,
+    ASSET_FONT,
+    ASSET_SOUND,
+} AssetType;
+
+typedef struct {
+    // Texture lookups that found it resident or not, and textures evicted
+    int hits;
+    int misses;
+    int evictions;
+    size_t gpu_bytes;
+    size_t cpu_bytes;
+    size_t budget_bytes;
+} AssetsFrameStats;
+
+AssetHandle asset_load_texture(const char* path);
+AssetHandle asset_load_font(const char* path);
+AssetHandle asset_load_sound(const char* path);
+AssetHandle asset_load_texture_async(const char* path);
+AssetHandle asset_load_sound_async(const char* path);
+int assets_pending(void);
+void asset_release(AssetHandle handle);
+
+Texture2D asset_texture(AssetHandle handle);
+Font asset_font(AssetHandle handle);
+Sound asset_sound(AssetHandle handle);
+
+void assets_set_budget(size_t gpu_bytes);
+AssetsFrameStats assets_frame_stats(void);
+
+void assets_update(double budget_ms);
+void assets_check_changes(void);
+void assets_collect_unused(void);
+void assets_print_stats(void);
+
+#endif // RUNTIME_ASSETS_H
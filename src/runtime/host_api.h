@@ -0,0 +1,124 @@
+#ifndef RUNTIME_HOST_API_H
+#define RUNTIME_HOST_API_H
+
+// Runtime services implemented in src/runtime. Regular builds link them into
+// the executable. In the hot reload workflow they live in the host, so their
+// state survives reloads, and the game library reaches them through this
+// table, the same way it reaches raylib through RaylibAPI.
+
+#include "profiler.h"
+#include "perf_counters.h"
+#include "assets.h"
+#include "sprites.h"
+#include "text_cache.h"
+#include "modules.h"
+
+typedef struct {
+    int (*profiler_zone_id)(const char* name);
+    void (*profiler_zone_begin)(int zone);
+    void (*profiler_zone_end)(int zone);
+    void (*profiler_frame_mark)(void);
+    bool (*profiler_export_chrome_trace)(const char* path);
+
+    AssetHandle (*asset_load_texture)(const char* path);
+    AssetHandle (*asset_load_font)(const char* path);
+    AssetHandle (*asset_load_sound)(const char* path);
+    AssetHandle (*asset_load_texture_async)(const char* path);
+    AssetHandle (*asset_load_sound_async)(const char* path);
+    int (*assets_pending)(void);
+    void (*asset_release)(AssetHandle handle);
+    Texture2D (*asset_texture)(AssetHandle handle);
+    Font (*asset_font)(AssetHandle handle);
+    Sound (*asset_sound)(AssetHandle handle);
+    void (*assets_set_budget)(size_t gpu_bytes);
+    AssetsFrameStats (*assets_frame_stats)(void);
+
+    bool (*sprites_load_atlas)(const char* index_path);
+    SpriteHandle (*sprite_load)(const char* path);
+    Rectangle (*sprite_rect)(SpriteHandle handle);
+    void (*sprite_draw)(SpriteHandle handle, Vector2 position, float rotation, float scale, Color tint);
+    int (*sprites_batch_breaks)(void);
+
+    void (*text_draw)(const char* text, int x, int y, int font_size, Color color);
+    void (*text_draw_ex)(Font font, const char* text, Vector2 position, float font_size, float spacing, Color tint);
+    TextCacheStats (*text_cache_stats)(void);
+
+    void (*modules_update)(void);
+    void (*modules_draw)(void);
+} HostAPI;
+
+// Global API pointer (set by main executable)
+extern HostAPI* host;
+
+static inline HostAPI* create_host_api(void) {
+    static HostAPI api = {
+        .profiler_zone_id = profiler_zone_id,
+        .profiler_zone_begin = profiler_zone_begin,
+        .profiler_zone_end = profiler_zone_end,
+        .profiler_frame_mark = profiler_frame_mark,
+        .profiler_export_chrome_trace = profiler_export_chrome_trace,
+
+        .asset_load_texture = asset_load_texture,
+        .asset_load_font = asset_load_font,
+        .asset_load_sound = asset_load_sound,
+        .asset_load_texture_async = asset_load_texture_async,
+        .asset_load_sound_async = asset_load_sound_async,
+        .assets_pending = assets_pending,
+        .asset_release = asset_release,
+        .asset_texture = asset_texture,
+        .asset_font = asset_font,
+        .asset_sound = asset_sound,
+        .assets_set_budget = assets_set_budget,
+        .assets_frame_stats = assets_frame_stats,
+
+        .sprites_load_atlas = sprites_load_atlas,
+        .sprite_load = sprite_load,
+        .sprite_rect = sprite_rect,
+        .sprite_draw = sprite_draw,
+        .sprites_batch_breaks = sprites_batch_breaks,
+
+        .text_draw = text_draw,
+        .text_draw_ex = text_draw_ex,
+        .text_cache_stats = text_cache_stats,
+
+        .modules_update = modules_update,
+        .modules_draw = modules_draw,
+    };
+    return &api;
+}
+
+#ifdef HOT_RELOAD
+#define profiler_zone_id(name) host->profiler_zone_id(name)
+#define profiler_zone_begin(zone) host->profiler_zone_begin(zone)
+#define profiler_zone_end(zone) host->profiler_zone_end(zone)
+#define profiler_frame_mark() host->profiler_frame_mark()
+#define profiler_export_chrome_trace(path) host->profiler_export_chrome_trace(path)
+
+#define asset_load_texture(path) host->asset_load_texture(path)
+#define asset_load_font(path) host->asset_load_font(path)
+#define asset_load_sound(path) host->asset_load_sound(path)
+#define asset_load_texture_async(path) host->asset_load_texture_async(path)
+#define asset_load_sound_async(path) host->asset_load_sound_async(path)
+#define assets_pending() host->assets_pending()
+#define asset_release(handle) host->asset_release(handle)
+#define asset_texture(handle) host->asset_texture(handle)
+#define asset_font(handle) host->asset_font(handle)
+#define asset_sound(handle) host->asset_sound(handle)
+#define assets_set_budget(gpu_bytes) host->assets_set_budget(gpu_bytes)
+#define assets_frame_stats() host->assets_frame_stats()
+
+#define sprites_load_atlas(index_path) host->sprites_load_atlas(index_path)
+#define sprite_load(path) host->sprite_load(path)
+#define sprite_rect(handle) host->sprite_rect(handle)
+#define sprite_draw(handle, position, rotation, scale, tint) host->sprite_draw(handle, position, rotation, scale, tint)
+#define sprites_batch_breaks() host->sprites_batch_breaks()
+
+#define text_draw(text, x, y, font_size, color) host->text_draw(text, x, y, font_size, color)
+#define text_draw_ex(font, text, position, font_size, spacing, tint) host->text_draw_ex(font, text, position, font_size, spacing, tint)
+#define text_cache_stats() host->text_cache_stats()
+
+#define modules_update() host->modules_update()
+#define modules_draw() host->modules_draw()
+#endif
+
+#endif // RUNTIME_HOST_API_H
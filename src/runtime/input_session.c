@@ -0,0 +1,149 @@
+#include "input_session.h"
+#include "raylib.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct {
+    const char* record_path;
+    bool replaying;
+    AutomationEventList events;
+    unsigned int next_event;
+    unsigned int last_event_frame;
+
+    unsigned int frame;
+    unsigned int frame_limit;
+    bool active;
+
+    // Milliseconds, the first frame (asset loading, shader compilation) is left out
+    const char* frame_times_path;
+    float* frame_times;
+    int frame_time_count;
+    int frame_time_capacity;
+    double frame_start;
+} InputSession;
+
+static InputSession input_session = {0};
+
+static int compare_floats(const void* a, const void* b) {
+    float x = *(const float*)a;
+    float y = *(const float*)b;
+    return (x > y) - (x < y);
+}
+
+void input_session_begin(void) {
+    input_session.record_path = getenv("GAME_RECORD_INPUT");
+    input_session.frame_times_path = getenv("GAME_FRAME_TIMES");
+    const char* replay_path = getenv("GAME_REPLAY_INPUT");
+    const char* frames = getenv("GAME_BENCHMARK_FRAMES");
+    if (frames) input_session.frame_limit = (unsigned int)strtoul(frames, NULL, 10);
+
+    if (replay_path) {
+        input_session.events = LoadAutomationEventList(replay_path);
+        if (input_session.events.count > 0) {
+            input_session.replaying = true;
+            input_session.last_event_frame = input_session.events.events[input_session.events.count - 1].frame;
+            printf("[SESSION] Replaying %u input events over %u frames from %s\n",
+                   input_session.events.count, input_session.last_event_frame + 1, replay_path);
+        } else {
+            printf("[SESSION] No input events in %s, nothing to replay\n", replay_path);
+            UnloadAutomationEventList(input_session.events);
+            input_session.events = (AutomationEventList){0};
+        }
+    } else if (input_session.record_path) {
+        input_session.events = LoadAutomationEventList(NULL);
+        SetAutomationEventList(&input_session.events);
+        SetAutomationEventBaseFrame(0);
+        StartAutomationEventRecording();
+        printf("[SESSION] Recording input to %s\n", input_session.record_path);
+    }
+
+    input_session.active = input_session.replaying || input_session.frame_limit > 0 ||
+                           input_session.record_path || input_session.frame_times_path;
+    if (input_session.replaying || input_session.frame_limit > 0) {
+        SetTargetFPS(0);
+    }
+}
+
+// Plays the events recorded for this frame, before the game reads its input
+void input_session_frame(void) {
+    if (!input_session.active) return;
+
+    double now = GetTime();
+    if (input_session.frame > 1) {
+        if (input_session.frame_time_count == input_session.frame_time_capacity) {
+            int capacity = input_session.frame_time_capacity ? input_session.frame_time_capacity * 2 : 4096;
+            float* frame_times = realloc(input_session.frame_times, (size_t)capacity * sizeof(float));
+            if (frame_times) {
+                input_session.frame_times = frame_times;
+                input_session.frame_time_capacity = capacity;
+            }
+        }
+        if (input_session.frame_time_count < input_session.frame_time_capacity) {
+            input_session.frame_times[input_session.frame_time_count++] = (float)((now - input_session.frame_start) * 1000.0);
+        }
+    }
+    input_session.frame_start = now;
+
+    if (input_session.replaying) {
+        AutomationEventList* events = &input_session.events;
+        while (input_session.next_event < events->count &&
+               events->events[input_session.next_event].frame <= input_session.frame) {
+            PlayAutomationEvent(events->events[input_session.next_event]);
+            input_session.next_event++;
+        }
+    }
+
+    input_session.frame++;
+}
+
+bool input_session_done(void) {
+    if (input_session.frame_limit > 0 && input_session.frame >= input_session.frame_limit) return true;
+    return input_session.replaying && input_session.frame > input_session.last_event_frame;
+}
+
+static void input_session_report(void) {
+    int count = input_session.frame_time_count;
+    if (count == 0) return;
+
+    if (input_session.frame_times_path) {
+        FILE* file = fopen(input_session.frame_times_path, "w");
+        if (file) {
+            fprintf(file, "frame,ms\n");
+            for (int i = 0; i < count; i++) {
+                fprintf(file, "%d,%.4f\n", i, input_session.frame_times[i]);
+            }
+            fclose(file);
+        } else {
+            printf("[SESSION] Failed to write %s\n", input_session.frame_times_path);
+        }
+    }
+
+    double total = 0.0;
+    for (int i = 0; i < count; i++) total += input_session.frame_times[i];
+
+    qsort(input_session.frame_times, (size_t)count, sizeof(float), compare_floats);
+    const float* sorted = input_session.frame_times;
+    printf("[SESSION] %d frames, mean %.3f ms, p50 %.3f ms, p95 %.3f ms, p99 %.3f ms, max %.3f ms\n",
+           count, total / count, sorted[(count - 1) / 2], sorted[(int)((count - 1) * 0.95)],
+           sorted[(int)((count - 1) * 0.99)], sorted[count - 1]);
+}
+
+void input_session_end(void) {
+    if (!input_session.active) return;
+
+    if (input_session.record_path && !input_session.replaying) {
+        StopAutomationEventRecording();
+        if (ExportAutomationEventList(input_session.events, input_session.record_path)) {
+            printf("[SESSION] Recorded %u input events over %u frames to %s\n",
+                   input_session.events.count, input_session.frame, input_session.record_path);
+        } else {
+            printf("[SESSION] Failed to write %s\n", input_session.record_path);
+        }
+    }
+
+    input_session_report();
+
+    if (input_session.events.events) UnloadAutomationEventList(input_session.events);
+    free(input_session.frame_times);
+    input_session = (InputSession){0};
+}
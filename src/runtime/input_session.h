@@ -0,0 +1,29 @@
+#ifndef RUNTIME_INPUT_SESSION_H
+#define RUNTIME_INPUT_SESSION_H
+
+#include <stdbool.h>
+
+// Recorded input sessions and frame timing, for benchmarks and PGO training
+// runs (see build_shipping.sh). Configured through environment variables:
+//
+//   GAME_RECORD_INPUT=<file>     record all input with raylib automation
+//                                events, written to <file> on exit
+//   GAME_REPLAY_INPUT=<file>     replay a recorded session, and quit when it
+//                                is over
+//   GAME_BENCHMARK_FRAMES=<n>    quit after n frames (with or without replay)
+//   GAME_FRAME_TIMES=<csv>       write the time of every frame to <csv>
+//
+// While replaying or benchmarking the target FPS is lifted, so frame times
+// measure the work and not the wait. On exit the frame time percentiles are
+// printed.
+//
+// main.c calls input_session_begin() once the window is open,
+// input_session_frame() at the start of every frame and input_session_end()
+// before closing the window. Needs raylib built with SUPPORT_AUTOMATION_EVENTS
+// (on by default).
+void input_session_begin(void);
+void input_session_frame(void);
+bool input_session_done(void);
+void input_session_end(void);
+
+#endif // RUNTIME_INPUT_SESSION_H
@@ -0,0 +1,134 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "jobs.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef _WIN32
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+typedef struct Job {
+    JobFunction function;
+    void* data;
+    JobGroup* group;
+    struct Job* next;
+} Job;
+
+typedef struct {
+    pthread_t threads[JOBS_MAX_THREADS];
+    int thread_count;
+    bool started;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t available;
+    Job* head;
+    Job* tail;
+} Jobs;
+
+static Jobs jobs = { .mutex = PTHREAD_MUTEX_INITIALIZER, .available = PTHREAD_COND_INITIALIZER };
+
+static void* jobs_worker(void* arg) {
+    (void)arg;
+
+    for (;;) {
+        pthread_mutex_lock(&jobs.mutex);
+        while (!jobs.head) {
+            pthread_cond_wait(&jobs.available, &jobs.mutex);
+        }
+        Job* job = jobs.head;
+        jobs.head = job->next;
+        if (!jobs.head) jobs.tail = NULL;
+        pthread_mutex_unlock(&jobs.mutex);
+
+        job->function(job->data);
+        if (job->group) __sync_fetch_and_sub(&job->group->pending, 1);
+        free(job);
+    }
+    return NULL;
+}
+
+static void jobs_start(void) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int count = cores > 1 ? (int)cores - 1 : 1;
+    if (count > JOBS_MAX_THREADS) count = JOBS_MAX_THREADS;
+
+    for (int i = 0; i < count; i++) {
+        if (pthread_create(&jobs.threads[jobs.thread_count], NULL, jobs_worker, NULL) == 0) {
+            pthread_detach(jobs.threads[jobs.thread_count]);
+            jobs.thread_count++;
+        }
+    }
+
+    printf("[JOBS] Started %d worker threads\n", jobs.thread_count);
+}
+
+void jobs_submit_group(JobGroup* group, JobFunction function, void* data) {
+    // Only the main thread submits, so starting lazily needs no lock
+    if (!jobs.started) {
+        jobs.started = true;
+        jobs_start();
+    }
+
+    Job* job = malloc(sizeof(Job));
+    if (!job || jobs.thread_count == 0) {
+        free(job);
+        function(data);
+        return;
+    }
+
+    if (group) __sync_fetch_and_add(&group->pending, 1);
+    job->function = function;
+    job->data = data;
+    job->group = group;
+    job->next = NULL;
+
+    pthread_mutex_lock(&jobs.mutex);
+    if (jobs.tail) {
+        jobs.tail->next = job;
+    } else {
+        jobs.head = job;
+    }
+    jobs.tail = job;
+    pthread_cond_signal(&jobs.available);
+    pthread_mutex_unlock(&jobs.mutex);
+}
+
+void jobs_submit(JobFunction function, void* data) {
+    jobs_submit_group(NULL, function, data);
+}
+
+// Waits on the calling thread for every job of the group to finish. Only
+// meant for short waits, like joining startup work.
+void jobs_wait(JobGroup* group) {
+    while (__sync_fetch_and_add(&group->pending, 0) > 0) {
+        sched_yield();
+    }
+}
+
+int jobs_thread_count(void) {
+    return jobs.thread_count;
+}
+
+#else
+
+void jobs_submit(JobFunction function, void* data) {
+    function(data);
+}
+
+void jobs_submit_group(JobGroup* group, JobFunction function, void* data) {
+    (void)group;
+    function(data);
+}
+
+void jobs_wait(JobGroup* group) {
+    (void)group;
+}
+
+int jobs_thread_count(void) {
+    return 0;
+}
+
+#endif
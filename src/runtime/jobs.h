@@ -0,0 +1,41 @@
+#ifndef RUNTIME_JOBS_H
+#define RUNTIME_JOBS_H
+
+#include <stdbool.h>
+
+// Small worker thread pool for runtime services (asset decoding...).
+//
+// Workers start on the first submitted job, one per core minus the main
+// thread (at least one). On Windows jobs run inline on the submitting thread,
+// so callers have to work either way.
+//
+// Jobs must not call into the GPU: raylib's GL context belongs to the main
+// thread.
+#define JOBS_MAX_THREADS 16
+
+typedef void (*JobFunction)(void* data);
+
+// Counts the unfinished jobs submitted with it, for jobs_wait()
+typedef struct {
+    volatile int pending;
+} JobGroup;
+
+void jobs_submit(JobFunction function, void* data);
+void jobs_submit_group(JobGroup* group, JobFunction function, void* data);
+void jobs_wait(JobGroup* group);
+int jobs_thread_count(void);
+
+// Spinlock for the small critical sections between jobs and the main thread
+typedef struct {
+    volatile int locked;
+} JobLock;
+
+static inline void job_lock(JobLock* lock) {
+    while (__sync_lock_test_and_set(&lock->locked, 1)) {}
+}
+
+static inline void job_unlock(JobLock* lock) {
+    __sync_lock_release(&lock->locked);
+}
+
+#endif // RUNTIME_JOBS_H
@@ -0,0 +1,91 @@
+#include "modules.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    const GameModuleAPI* api;
+    void* memory;
+    int memory_size;
+} GameModule;
+
+typedef struct {
+    GameModule modules[MODULES_MAX];
+    int count;
+} Modules;
+
+static Modules modules = {0};
+
+static bool module_init(GameModule* module, const GameModuleAPI* api) {
+    module->memory_size = api->memory_size;
+    module->memory = api->memory_size > 0 ? calloc(1, (size_t)api->memory_size) : NULL;
+    if (api->memory_size > 0 && !module->memory) {
+        printf("[MODULES] Failed to allocate %d bytes for %s\n", api->memory_size, api->name);
+        return false;
+    }
+
+    module->api = api;
+    if (api->init) api->init(module->memory);
+    return true;
+}
+
+static void module_shutdown(GameModule* module) {
+    if (module->api && module->api->shutdown) module->api->shutdown(module->memory);
+    free(module->memory);
+    module->memory = NULL;
+    module->api = NULL;
+}
+
+// A new version of a registered module replaces it. The previous version's
+// code must still be loaded, its shutdown() runs when the memory size changed.
+void modules_register(const GameModuleAPI* api) {
+    if (!api || !api->name) return;
+
+    for (int i = 0; i < modules.count; i++) {
+        GameModule* module = &modules.modules[i];
+        if (strcmp(module->api->name, api->name) != 0) continue;
+
+        if (api->memory_size == module->memory_size) {
+            module->api = api;
+            if (api->hot_reloaded) api->hot_reloaded(module->memory);
+        } else {
+            printf("[MODULES] %s memory size changed (%d to %d bytes), restarting it\n",
+                   api->name, module->memory_size, api->memory_size);
+            module_shutdown(module);
+            if (!module_init(module, api)) {
+                modules.modules[i] = modules.modules[--modules.count];
+            }
+        }
+        return;
+    }
+
+    if (modules.count == MODULES_MAX) {
+        printf("[MODULES] Too many modules, %s is not registered\n", api->name);
+        return;
+    }
+    if (module_init(&modules.modules[modules.count], api)) {
+        modules.count++;
+    }
+}
+
+void modules_update(void) {
+    for (int i = 0; i < modules.count; i++) {
+        GameModule* module = &modules.modules[i];
+        if (module->api->update) module->api->update(module->memory);
+    }
+}
+
+void modules_draw(void) {
+    for (int i = 0; i < modules.count; i++) {
+        GameModule* module = &modules.modules[i];
+        if (module->api->draw) module->api->draw(module->memory);
+    }
+}
+
+void modules_shutdown(void) {
+    for (int i = modules.count - 1; i >= 0; i--) {
+        module_shutdown(&modules.modules[i]);
+    }
+    modules.count = 0;
+}
@@ -0,0 +1,43 @@
+#ifndef RUNTIME_MODULES_H
+#define RUNTIME_MODULES_H
+
+// Game modules.
+//
+// Parts of the game that, in the hot reload workflow, are built as their own
+// shared library (build/hot_reload/module_<name>.so) and reloaded on their
+// own when one of their sources changes, so a reload only costs the module
+// being edited, however large the rest of the game gets.
+//
+// A module lives in src/modules/<name>/, is listed in
+// src/modules/module_list.h and returns its entry table from
+// GAME_MODULE_ENTRY(name). The registry owns a memory block of memory_size
+// bytes per module, which survives reloads as long as its size doesn't
+// change. The hot reload host registers every version it loads, regular
+// builds link the modules in and main.c registers them. The game runs them
+// with modules_update() and modules_draw() (inside BeginDrawing()).
+#define MODULES_MAX 16
+
+typedef struct {
+    const char* name;
+    int memory_size;
+    // Zeroed memory: the first load, or a reload that changed memory_size
+    void (*init)(void* memory);
+    // A new version of the module, with the memory of the previous one
+    void (*hot_reloaded)(void* memory);
+    void (*update)(void* memory);
+    void (*draw)(void* memory);
+    void (*shutdown)(void* memory);
+} GameModuleAPI;
+
+#if defined(HOT_RELOAD) && defined(_WIN32)
+    #define GAME_MODULE_ENTRY(name) __declspec(dllexport) const GameModuleAPI* name##_module_get(void)
+#else
+    #define GAME_MODULE_ENTRY(name) const GameModuleAPI* name##_module_get(void)
+#endif
+
+void modules_register(const GameModuleAPI* api);
+void modules_update(void);
+void modules_draw(void);
+void modules_shutdown(void);
+
+#endif // RUNTIME_MODULES_H
@@ -0,0 +1,332 @@
+#define _GNU_SOURCE
+
+#include "perf_counters.h"
+#include "profiler.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+    #include <errno.h>
+    #include <unistd.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <linux/perf_event.h>
+#endif
+
+static const char* perf_counter_names[PERF_COUNTER_COUNT] = {
+    "cycles",
+    "instructions",
+    "l1d_misses",
+    "llc_misses",
+    "branch_misses",
+};
+
+typedef struct {
+    uint64_t calls;
+    uint64_t totals[PERF_COUNTER_COUNT];
+} PerfZoneTotals;
+
+typedef struct {
+    int label;
+    bool used;
+    PerfZoneTotals zones[PROFILER_MAX_ZONES];
+} PerfGeneration;
+
+typedef struct {
+    PerfGeneration generations[PERF_COUNTERS_MAX_GENERATIONS];
+    int current;
+    int generation_count;
+
+    // Which counters the first thread managed to open, for the report
+    bool available[PERF_COUNTER_COUNT];
+} PerfCounters;
+
+bool perf_counters_enabled = false;
+static PerfCounters perf_counters = {0};
+
+#ifdef __linux__
+
+typedef struct {
+    int leader;
+    int fds[PERF_COUNTER_COUNT];
+    // Position of each counter in the group read, -1 if it couldn't be opened
+    int slot[PERF_COUNTER_COUNT];
+    int opened;
+    bool failed;
+} PerfThreadCounters;
+
+static __thread PerfThreadCounters perf_thread = {0};
+static __thread bool perf_thread_ready = false;
+
+static int perf_event_open(struct perf_event_attr* attr, int group) {
+    // This thread, any CPU
+    return (int)syscall(SYS_perf_event_open, attr, 0, -1, group, 0);
+}
+
+static void perf_counter_attr(PerfCounter counter, struct perf_event_attr* attr) {
+    memset(attr, 0, sizeof(*attr));
+    attr->size = sizeof(*attr);
+    attr->read_format = PERF_FORMAT_GROUP;
+    // User space only, so it works with the default perf_event_paranoid=2
+    attr->exclude_kernel = 1;
+    attr->exclude_hv = 1;
+
+    switch (counter) {
+        case PERF_COUNTER_CYCLES:
+            attr->type = PERF_TYPE_HARDWARE;
+            attr->config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case PERF_COUNTER_INSTRUCTIONS:
+            attr->type = PERF_TYPE_HARDWARE;
+            attr->config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case PERF_COUNTER_L1D_MISSES:
+            attr->type = PERF_TYPE_HW_CACHE;
+            attr->config = PERF_COUNT_HW_CACHE_L1D |
+                           (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                           (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            break;
+        case PERF_COUNTER_LLC_MISSES:
+            attr->type = PERF_TYPE_HARDWARE;
+            attr->config = PERF_COUNT_HW_CACHE_MISSES;
+            break;
+        case PERF_COUNTER_BRANCH_MISSES:
+            attr->type = PERF_TYPE_HARDWARE;
+            attr->config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        default:
+            break;
+    }
+}
+
+// Opens the counter group of the calling thread. Cycles lead the group, the
+// rest are optional since many CPUs (and most VMs) lack some of them.
+static bool perf_thread_open(PerfThreadCounters* thread) {
+    struct perf_event_attr attr;
+
+    thread->leader = -1;
+    thread->opened = 0;
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+        thread->fds[i] = -1;
+        thread->slot[i] = -1;
+    }
+
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+        perf_counter_attr((PerfCounter)i, &attr);
+        if (i == 0) attr.disabled = 1;
+
+        int fd = perf_event_open(&attr, thread->leader);
+        if (fd < 0) {
+            if (i == 0) {
+                printf("[PERF_COUNTERS] perf_event_open failed (%s), counters disabled. "
+                       "Check /proc/sys/kernel/perf_event_paranoid\n", strerror(errno));
+                return false;
+            }
+            continue;
+        }
+
+        if (i == 0) thread->leader = fd;
+        thread->fds[i] = fd;
+        thread->slot[i] = thread->opened++;
+    }
+
+    ioctl(thread->leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(thread->leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    return true;
+}
+
+bool perf_counters_read(uint64_t values[PERF_COUNTER_COUNT]) {
+    PerfThreadCounters* thread = &perf_thread;
+
+    if (!perf_thread_ready) {
+        perf_thread_ready = true;
+        thread->failed = !perf_thread_open(thread);
+        if (!thread->failed && perf_counters.available[PERF_COUNTER_CYCLES] == false) {
+            for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+                perf_counters.available[i] = thread->slot[i] >= 0;
+            }
+        }
+    }
+    if (thread->failed) return false;
+
+    // PERF_FORMAT_GROUP layout: nr, then one value per group member
+    uint64_t buffer[1 + PERF_COUNTER_COUNT];
+    if (read(thread->leader, buffer, sizeof(buffer)) < (ssize_t)sizeof(uint64_t)) return false;
+
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+        int slot = thread->slot[i];
+        values[i] = (slot >= 0 && (uint64_t)slot < buffer[0]) ? buffer[1 + slot] : 0;
+    }
+    return true;
+}
+
+bool perf_counters_init(void) {
+    const char* env = getenv("PROFILER_PERF_COUNTERS");
+    if (!env || strcmp(env, "1") != 0) return false;
+
+    // Open the main thread's group up front, so a forbidden kernel is
+    // reported at startup instead of on the first zone
+    uint64_t values[PERF_COUNTER_COUNT];
+    if (!perf_counters_read(values)) return false;
+
+    perf_counters.generations[0].used = true;
+    perf_counters.generation_count = 1;
+    perf_counters_enabled = true;
+
+    printf("[PERF_COUNTERS] Enabled:");
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+        if (perf_counters.available[i]) printf(" %s", perf_counter_names[i]);
+    }
+    printf("\n");
+    return true;
+}
+
+#else
+
+bool perf_counters_read(uint64_t values[PERF_COUNTER_COUNT]) {
+    (void)values;
+    return false;
+}
+
+bool perf_counters_init(void) {
+    const char* env = getenv("PROFILER_PERF_COUNTERS");
+    if (env && strcmp(env, "1") == 0) {
+        printf("[PERF_COUNTERS] Hardware counters are only supported on Linux\n");
+    }
+    return false;
+}
+
+#endif
+
+void perf_counters_accumulate(int zone, const uint64_t begin[PERF_COUNTER_COUNT], const uint64_t end[PERF_COUNTER_COUNT]) {
+    if (zone < 0 || zone >= PROFILER_MAX_ZONES) return;
+
+    PerfZoneTotals* totals = &perf_counters.generations[perf_counters.current].zones[zone];
+    __sync_fetch_and_add(&totals->calls, 1);
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+        __sync_fetch_and_add(&totals->totals[i], end[i] - begin[i]);
+    }
+}
+
+// Starts a new set of totals, called by the host after each game library reload.
+// The oldest generation is dropped once PERF_COUNTERS_MAX_GENERATIONS is reached.
+void perf_counters_set_generation(int generation) {
+    if (!perf_counters_enabled) return;
+
+    PerfGeneration* current = &perf_counters.generations[perf_counters.current];
+    if (current->label == generation) return;
+
+    perf_counters.current = (perf_counters.current + 1) % PERF_COUNTERS_MAX_GENERATIONS;
+    PerfGeneration* next = &perf_counters.generations[perf_counters.current];
+    memset(next, 0, sizeof(*next));
+    next->label = generation;
+    next->used = true;
+    if (perf_counters.generation_count < PERF_COUNTERS_MAX_GENERATIONS) {
+        perf_counters.generation_count++;
+    }
+}
+
+static PerfGeneration* perf_generation_at(int age) {
+    int index = (perf_counters.current - age + PERF_COUNTERS_MAX_GENERATIONS) % PERF_COUNTERS_MAX_GENERATIONS;
+    return &perf_counters.generations[index];
+}
+
+static double perf_per_kilo_instruction(const PerfZoneTotals* totals, PerfCounter counter) {
+    uint64_t instructions = totals->totals[PERF_COUNTER_INSTRUCTIONS];
+    return instructions ? (double)totals->totals[counter] * 1000.0 / (double)instructions : 0.0;
+}
+
+static double perf_ipc(const PerfZoneTotals* totals) {
+    uint64_t cycles = totals->totals[PERF_COUNTER_CYCLES];
+    return cycles ? (double)totals->totals[PERF_COUNTER_INSTRUCTIONS] / (double)cycles : 0.0;
+}
+
+static void perf_print_rate(PerfCounter counter, double value) {
+    if (perf_counters.available[counter]) {
+        printf(" %9.2f", value);
+    } else {
+        printf(" %9s", "n/a");
+    }
+}
+
+// Prints every zone once per generation, oldest first, with the IPC change
+// relative to the previous generation that ran the zone.
+void perf_counters_print_report(void) {
+    if (!perf_counters_enabled) {
+        printf("[PERF_COUNTERS] Not enabled (set PROFILER_PERF_COUNTERS=1)\n");
+        return;
+    }
+
+    int zone_count = profiler_zone_count();
+    printf("[PERF_COUNTERS] Per zone, per game library version (rates per 1000 instructions):\n");
+    printf("  %-20s %7s %9s %12s %6s %8s %9s %9s %9s\n",
+           "zone", "version", "calls", "cycles/call", "IPC", "dIPC", "L1D", "LLC", "branch");
+
+    for (int zone = 0; zone < zone_count; zone++) {
+        const PerfZoneTotals* previous = NULL;
+
+        for (int age = perf_counters.generation_count - 1; age >= 0; age--) {
+            PerfGeneration* generation = perf_generation_at(age);
+            const PerfZoneTotals* totals = &generation->zones[zone];
+            if (!generation->used || totals->calls == 0) continue;
+
+            double ipc = perf_ipc(totals);
+            printf("  %-20.20s %7d %9llu %12.0f %6.2f", profiler_zone_name(zone), generation->label,
+                   (unsigned long long)totals->calls,
+                   (double)totals->totals[PERF_COUNTER_CYCLES] / (double)totals->calls, ipc);
+            if (previous && perf_ipc(previous) > 0.0) {
+                printf(" %+7.1f%%", (ipc / perf_ipc(previous) - 1.0) * 100.0);
+            } else {
+                printf(" %8s", "");
+            }
+            perf_print_rate(PERF_COUNTER_L1D_MISSES, perf_per_kilo_instruction(totals, PERF_COUNTER_L1D_MISSES));
+            perf_print_rate(PERF_COUNTER_LLC_MISSES, perf_per_kilo_instruction(totals, PERF_COUNTER_LLC_MISSES));
+            perf_print_rate(PERF_COUNTER_BRANCH_MISSES, perf_per_kilo_instruction(totals, PERF_COUNTER_BRANCH_MISSES));
+            printf("\n");
+
+            previous = totals;
+        }
+    }
+}
+
+bool perf_counters_write_csv(const char* path) {
+    if (!perf_counters_enabled) return false;
+
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        printf("[PERF_COUNTERS] Failed to open %s\n", path);
+        return false;
+    }
+
+    fprintf(file, "zone,version,calls");
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+        fprintf(file, ",%s", perf_counter_names[i]);
+    }
+    fprintf(file, "\n");
+
+    int zone_count = profiler_zone_count();
+    for (int age = perf_counters.generation_count - 1; age >= 0; age--) {
+        PerfGeneration* generation = perf_generation_at(age);
+        if (!generation->used) continue;
+
+        for (int zone = 0; zone < zone_count; zone++) {
+            const PerfZoneTotals* totals = &generation->zones[zone];
+            if (totals->calls == 0) continue;
+
+            fprintf(file, "%s,%d,%llu", profiler_zone_name(zone), generation->label, (unsigned long long)totals->calls);
+            for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+                if (perf_counters.available[i]) {
+                    fprintf(file, ",%llu", (unsigned long long)totals->totals[i]);
+                } else {
+                    fprintf(file, ",");
+                }
+            }
+            fprintf(file, "\n");
+        }
+    }
+
+    fclose(file);
+    printf("[PERF_COUNTERS] Wrote %s\n", path);
+    return true;
+}
@@ -0,0 +1,42 @@
+#ifndef RUNTIME_PERF_COUNTERS_H
+#define RUNTIME_PERF_COUNTERS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Hardware performance counters per profiler zone (Linux only).
+//
+// When enabled, every profiler zone also reads a per-thread perf_event_open
+// group (cycles, instructions, L1D read misses, LLC misses, branch misses) on
+// begin and end, and adds the deltas to the zone's totals. Totals are kept per
+// generation, a generation being one version of the game library, so the
+// same zone can be compared across hot reloads.
+//
+// Reading the group is a read() syscall, so enabled zones cost around a
+// microsecond each. Keep it off unless you're looking at counters.
+//
+// Enable with PROFILER_PERF_COUNTERS=1. If the kernel forbids counters
+// (perf_event_paranoid, containers, VMs without a PMU) it prints why and
+// stays off. Counters the CPU doesn't have are reported as n/a.
+#define PERF_COUNTERS_MAX_GENERATIONS 32
+
+typedef enum {
+    PERF_COUNTER_CYCLES = 0,
+    PERF_COUNTER_INSTRUCTIONS,
+    PERF_COUNTER_L1D_MISSES,
+    PERF_COUNTER_LLC_MISSES,
+    PERF_COUNTER_BRANCH_MISSES,
+    PERF_COUNTER_COUNT
+} PerfCounter;
+
+// Checked by the profiler on every zone, so it's a plain flag
+extern bool perf_counters_enabled;
+
+bool perf_counters_init(void);
+bool perf_counters_read(uint64_t values[PERF_COUNTER_COUNT]);
+void perf_counters_accumulate(int zone, const uint64_t begin[PERF_COUNTER_COUNT], const uint64_t end[PERF_COUNTER_COUNT]);
+void perf_counters_set_generation(int generation);
+void perf_counters_print_report(void);
+bool perf_counters_write_csv(const char* path);
+
+#endif // RUNTIME_PERF_COUNTERS_H
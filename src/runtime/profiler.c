@@ -0,0 +1,288 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "profiler.h"
+#include "perf_counters.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <time.h>
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #include <x86intrin.h>
+    #define PROFILER_USE_TSC
+#endif
+
+#define PROFILER_ZONE_NAME_LENGTH 64
+
+typedef struct {
+    uint64_t start;
+    uint64_t end;
+    uint16_t zone;
+    uint16_t depth;
+} ProfilerEvent;
+
+typedef struct {
+    uint64_t start;
+    uint16_t zone;
+    bool has_counters;
+    uint64_t counters[PERF_COUNTER_COUNT];
+} ProfilerOpenZone;
+
+typedef struct {
+    ProfilerEvent* events;
+    uint64_t written;
+    ProfilerOpenZone stack[PROFILER_MAX_DEPTH];
+    int depth;
+} ProfilerThread;
+
+typedef struct {
+    ProfilerThread threads[PROFILER_MAX_THREADS];
+    int thread_count;
+
+    char zone_names[PROFILER_MAX_ZONES][PROFILER_ZONE_NAME_LENGTH];
+    int zone_count;
+    int zone_lock;
+
+    uint64_t frames[PROFILER_MAX_FRAMES];
+    uint64_t frame_count;
+
+    // Slot of the thread that called profiler_init(), -1 before
+    int main_thread;
+
+    // First timestamp, used to convert ticks to nanoseconds at export time
+    uint64_t base_ticks;
+    uint64_t base_ns;
+} Profiler;
+
+static Profiler profiler = { .main_thread = -1 };
+
+// Threads past PROFILER_MAX_THREADS (or failing to allocate) only track depth
+static ProfilerThread profiler_overflow_thread = {0};
+static __thread ProfilerThread* profiler_thread = NULL;
+
+static uint64_t profiler_now_ns(void) {
+#ifdef _WIN32
+    static LARGE_INTEGER frequency = {0};
+    LARGE_INTEGER counter;
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+// rdtsc is a few ns, while even a vDSO clock_gettime is ~20 ns. Two of those
+// per zone would eat most of the budget, so ticks are only converted on export.
+static inline uint64_t profiler_ticks(void) {
+#ifdef PROFILER_USE_TSC
+    return __rdtsc();
+#else
+    return profiler_now_ns();
+#endif
+}
+
+static void profiler_calibrate(void) {
+    if (profiler.base_ns == 0) {
+        profiler.base_ns = profiler_now_ns();
+        profiler.base_ticks = profiler_ticks();
+    }
+}
+
+static double profiler_ns_per_tick(void) {
+#ifdef PROFILER_USE_TSC
+    uint64_t ns = profiler_now_ns();
+    uint64_t ticks = profiler_ticks();
+    if (ticks <= profiler.base_ticks || ns <= profiler.base_ns) return 1.0;
+    return (double)(ns - profiler.base_ns) / (double)(ticks - profiler.base_ticks);
+#else
+    return 1.0;
+#endif
+}
+
+static ProfilerThread* profiler_register_thread(void) {
+    profiler_calibrate();
+
+    int index = __sync_fetch_and_add(&profiler.thread_count, 1);
+    if (index >= PROFILER_MAX_THREADS) {
+        profiler_thread = &profiler_overflow_thread;
+        return profiler_thread;
+    }
+
+    ProfilerThread* thread = &profiler.threads[index];
+    thread->events = calloc(PROFILER_EVENTS_PER_THREAD, sizeof(ProfilerEvent));
+    profiler_thread = thread->events ? thread : &profiler_overflow_thread;
+    return profiler_thread;
+}
+
+// Called by main() before anything else records zones. Worker threads take
+// their slot on their first zone, in any order, so the main thread is told
+// apart by the slot it got here.
+void profiler_init(void) {
+    ProfilerThread* thread = profiler_thread ? profiler_thread : profiler_register_thread();
+    if (thread != &profiler_overflow_thread) profiler.main_thread = (int)(thread - profiler.threads);
+}
+
+int profiler_zone_id(const char* name) {
+    while (__sync_lock_test_and_set(&profiler.zone_lock, 1)) {}
+
+    int id = -1;
+    for (int i = 0; i < profiler.zone_count; i++) {
+        if (strncmp(profiler.zone_names[i], name, PROFILER_ZONE_NAME_LENGTH - 1) == 0) {
+            id = i;
+            break;
+        }
+    }
+
+    if (id < 0 && profiler.zone_count < PROFILER_MAX_ZONES) {
+        id = profiler.zone_count;
+        strncpy(profiler.zone_names[id], name, PROFILER_ZONE_NAME_LENGTH - 1);
+        profiler.zone_count++;
+    }
+
+    __sync_lock_release(&profiler.zone_lock);
+
+    // Out of zones: everything else is recorded under the last one
+    return id >= 0 ? id : PROFILER_MAX_ZONES - 1;
+}
+
+void profiler_zone_begin(int zone) {
+    ProfilerThread* thread = profiler_thread ? profiler_thread : profiler_register_thread();
+
+    if (thread->depth < PROFILER_MAX_DEPTH) {
+        ProfilerOpenZone* open = &thread->stack[thread->depth];
+        open->zone = (uint16_t)zone;
+        open->has_counters = perf_counters_enabled && perf_counters_read(open->counters);
+        open->start = profiler_ticks();
+    }
+    thread->depth++;
+}
+
+void profiler_zone_end(int zone) {
+    uint64_t end = profiler_ticks();
+    ProfilerThread* thread = profiler_thread;
+    (void)zone;
+
+    if (!thread || thread->depth == 0) return;
+
+    thread->depth--;
+    if (thread->depth >= PROFILER_MAX_DEPTH) return;
+
+    ProfilerOpenZone* open = &thread->stack[thread->depth];
+    if (open->has_counters) {
+        uint64_t counters[PERF_COUNTER_COUNT];
+        if (perf_counters_read(counters)) {
+            perf_counters_accumulate(open->zone, open->counters, counters);
+        }
+    }
+    if (!thread->events) return;
+
+    ProfilerEvent* event = &thread->events[thread->written & (PROFILER_EVENTS_PER_THREAD - 1)];
+    event->start = open->start;
+    event->end = end;
+    event->zone = open->zone;
+    event->depth = (uint16_t)thread->depth;
+    thread->written++;
+}
+
+// Zones open on the calling thread
+int profiler_depth(void) {
+    return profiler_thread ? profiler_thread->depth : 0;
+}
+
+// Drops the zones opened since profiler_depth() returned depth, unrecorded,
+// for code that was cut short before its PROFILE_ZONE_END()s
+void profiler_unwind(int depth) {
+    ProfilerThread* thread = profiler_thread;
+    if (thread && depth >= 0 && thread->depth > depth) thread->depth = depth;
+}
+
+int profiler_zone_count(void) {
+    return profiler.zone_count;
+}
+
+const char* profiler_zone_name(int zone) {
+    return (zone >= 0 && zone < profiler.zone_count) ? profiler.zone_names[zone] : "";
+}
+
+void profiler_frame_mark(void) {
+    profiler_calibrate();
+    profiler.frames[profiler.frame_count % PROFILER_MAX_FRAMES] = profiler_ticks();
+    profiler.frame_count++;
+}
+
+static void write_json_string(FILE* file, const char* text) {
+    fputc('"', file);
+    for (; *text; text++) {
+        if (*text == '"' || *text == '\\') fputc('\\', file);
+        if ((unsigned char)*text >= 0x20) fputc(*text, file);
+    }
+    fputc('"', file);
+}
+
+// Writes everything still in the ring buffers as Chrome trace events, which
+// Perfetto (ui.perfetto.dev) and chrome://tracing open directly. Threads keep
+// recording while this runs, so the newest events may be slightly torn.
+bool profiler_export_chrome_trace(const char* path) {
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        printf("[PROFILER] Failed to open %s\n", path);
+        return false;
+    }
+
+    double ns_per_tick = profiler_ns_per_tick();
+    int thread_count = profiler.thread_count < PROFILER_MAX_THREADS ? profiler.thread_count : PROFILER_MAX_THREADS;
+    uint64_t event_count = 0;
+    bool first = true;
+
+    fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+
+    for (int t = 0; t < thread_count; t++) {
+        ProfilerThread* thread = &profiler.threads[t];
+        if (!thread->events) continue;
+
+        fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s %d\"}}",
+                first ? "" : ",\n", t, t == profiler.main_thread ? "main" : "thread", t);
+        first = false;
+
+        uint64_t written = thread->written;
+        uint64_t oldest = written > PROFILER_EVENTS_PER_THREAD ? written - PROFILER_EVENTS_PER_THREAD : 0;
+
+        for (uint64_t i = oldest; i < written; i++) {
+            ProfilerEvent* event = &thread->events[i & (PROFILER_EVENTS_PER_THREAD - 1)];
+            double start_us = (double)(event->start - profiler.base_ticks) * ns_per_tick / 1000.0;
+            double duration_us = (double)(event->end - event->start) * ns_per_tick / 1000.0;
+
+            fprintf(file, ",\n{\"name\":");
+            write_json_string(file, profiler.zone_names[event->zone]);
+            fprintf(file, ",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"depth\":%d}}",
+                    t, start_us, duration_us, event->depth);
+            event_count++;
+        }
+    }
+
+    uint64_t frame_count = profiler.frame_count;
+    uint64_t oldest_frame = frame_count > PROFILER_MAX_FRAMES ? frame_count - PROFILER_MAX_FRAMES : 0;
+    for (uint64_t i = oldest_frame; i < frame_count; i++) {
+        uint64_t ticks = profiler.frames[i % PROFILER_MAX_FRAMES];
+        fprintf(file, "%s{\"name\":\"frame %llu\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":%.3f}",
+                first ? "" : ",\n", (unsigned long long)i, (double)(ticks - profiler.base_ticks) * ns_per_tick / 1000.0);
+        first = false;
+    }
+
+    fprintf(file, "\n]}\n");
+    fclose(file);
+
+    printf("[PROFILER] Exported %llu zones over %llu frames to %s\n",
+           (unsigned long long)event_count, (unsigned long long)(frame_count - oldest_frame), path);
+    return true;
+}
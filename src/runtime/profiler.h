@@ -0,0 +1,44 @@
+#ifndef RUNTIME_PROFILER_H
+#define RUNTIME_PROFILER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Hierarchical zone profiler.
+//
+// Every thread records finished zones into its own ring buffer. The buffers
+// live in the host (or in the executable, for regular builds), so zones
+// recorded by the game library survive hot reloads. Zone names are interned
+// by the profiler, so they don't point into an unloaded library either.
+//
+// Usage:
+//   PROFILE_ZONE_BEGIN(draw);
+//   ...
+//   PROFILE_ZONE_END(draw);
+#define PROFILER_MAX_THREADS 16
+#define PROFILER_MAX_ZONES 256
+#define PROFILER_MAX_DEPTH 64
+#define PROFILER_EVENTS_PER_THREAD (1 << 16)
+#define PROFILER_MAX_FRAMES 4096
+
+void profiler_init(void);
+int profiler_zone_id(const char* name);
+void profiler_zone_begin(int zone);
+void profiler_zone_end(int zone);
+int profiler_depth(void);
+void profiler_unwind(int depth);
+int profiler_zone_count(void);
+const char* profiler_zone_name(int zone);
+void profiler_frame_mark(void);
+bool profiler_export_chrome_trace(const char* path);
+
+// The zone id is cached in a static per call site. After a hot reload the new
+// library starts with -1 again and gets the same id back for the same name.
+#define PROFILE_ZONE_BEGIN(zone) \
+    static int zone##_profile_zone = -1; \
+    if (zone##_profile_zone < 0) zone##_profile_zone = profiler_zone_id(#zone); \
+    profiler_zone_begin(zone##_profile_zone)
+
+#define PROFILE_ZONE_END(zone) profiler_zone_end(zone##_profile_zone)
+
+#endif // RUNTIME_PROFILER_H
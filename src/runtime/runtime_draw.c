@@ -0,0 +1,7 @@
+#include "runtime_draw.h"
+
+RuntimeDraw runtime_draw = {
+    .draw_texture_pro = DrawTexturePro,
+    .draw_text_ex = DrawTextEx,
+    .direct = true,
+};
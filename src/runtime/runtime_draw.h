@@ -0,0 +1,24 @@
+#ifndef RUNTIME_RUNTIME_DRAW_H
+#define RUNTIME_RUNTIME_DRAW_H
+
+#include <stdbool.h>
+#include "raylib.h"
+
+// raylib draw calls made by runtime services on behalf of the game
+// (sprite_draw()...).
+//
+// They go through this table rather than straight to raylib, so in the hot
+// reload workflow the host can point it at the table the game is using, and
+// F7 (call stats) and F8 (capture) see them like the game's own draws. It
+// starts out on raylib, which is all regular builds ever use.
+typedef struct {
+    void (*draw_texture_pro)(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint);
+    void (*draw_text_ex)(Font font, const char* text, Vector2 position, float font_size, float spacing, Color tint);
+    // False while the calls are counted or captured. Services that submit to
+    // rlgl themselves (text_cache.c) then fall back to the calls above.
+    bool direct;
+} RuntimeDraw;
+
+extern RuntimeDraw runtime_draw;
+
+#endif // RUNTIME_RUNTIME_DRAW_H
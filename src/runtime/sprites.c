@@ -0,0 +1,206 @@
+#include "sprites.h"
+#include "assets.h"
+#include "runtime_draw.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SPRITE_PATH_LENGTH 256
+
+typedef struct {
+    char path[SPRITE_PATH_LENGTH];
+    // Atlas page, or -1 when the sprite is drawn from its own texture
+    int page;
+    Rectangle rect;
+    AssetHandle texture;
+    // Handed out by sprite_load(), not only listed in the index
+    bool used;
+} Sprite;
+
+typedef struct {
+    Sprite sprites[SPRITES_MAX];
+    int count;
+
+    char index_path[SPRITE_PATH_LENGTH];
+    long index_mod_time;
+    AssetHandle pages[SPRITES_ATLAS_MAX_PAGES];
+    int page_count;
+
+    unsigned int last_texture_id;
+    int frame_breaks;
+    int last_frame_breaks;
+} Sprites;
+
+static Sprites sprites = {0};
+
+static Sprite* sprite_get(SpriteHandle handle) {
+    if (handle.id == 0 || handle.id > (uint32_t)sprites.count) return NULL;
+    return &sprites.sprites[handle.id - 1];
+}
+
+static Sprite* sprite_find(const char* path) {
+    for (int i = 0; i < sprites.count; i++) {
+        if (strcmp(sprites.sprites[i].path, path) == 0) return &sprites.sprites[i];
+    }
+    return NULL;
+}
+
+static Sprite* sprite_register(const char* path) {
+    Sprite* sprite = sprite_find(path);
+    if (sprite) return sprite;
+
+    if (sprites.count >= SPRITES_MAX || strlen(path) >= SPRITE_PATH_LENGTH) {
+        printf("[SPRITES] Can't register %s\n", path);
+        return NULL;
+    }
+
+    sprite = &sprites.sprites[sprites.count++];
+    memset(sprite, 0, sizeof(*sprite));
+    strcpy(sprite->path, path);
+    sprite->page = -1;
+    return sprite;
+}
+
+// Reads the index written by atlas_packer. Does nothing when the index didn't
+// change since the last call, so game_init() can call it on every restart.
+// Sprites already handed out are moved into the atlas, to their new rect, or
+// back to their own texture, in place.
+bool sprites_load_atlas(const char* index_path) {
+    long mod_time = GetFileModTime(index_path);
+    if (mod_time != 0 && mod_time == sprites.index_mod_time && strcmp(index_path, sprites.index_path) == 0) {
+        return true;
+    }
+
+    char* text = LoadFileText(index_path);
+    if (!text) {
+        printf("[SPRITES] No atlas index at %s, sprites use their own textures\n", index_path);
+        return false;
+    }
+
+    if (index_path != sprites.index_path && strlen(index_path) < SPRITE_PATH_LENGTH) {
+        strcpy(sprites.index_path, index_path);
+    }
+    sprites.index_mod_time = mod_time;
+
+    // Images no longer in the atlas go back to their own texture, and pages
+    // past the new last one aren't used anymore
+    for (int i = 0; i < sprites.count; i++) {
+        sprites.sprites[i].page = -1;
+    }
+    sprites.page_count = 0;
+
+    int sprite_count = 0;
+    char* line = text;
+    while (line && *line) {
+        char* next = strchr(line, '\n');
+        if (next) *next++ = '\0';
+
+        int page = 0, x = 0, y = 0, width = 0, height = 0, offset = 0;
+        if (sscanf(line, "page %d %n", &page, &offset) == 1 && offset > 0) {
+            if (page >= 0 && page < SPRITES_ATLAS_MAX_PAGES) {
+                // Page textures are watched by the registry like any other asset
+                if (sprites.pages[page].id == 0) {
+                    sprites.pages[page] = asset_load_texture_async(line + offset);
+                }
+                if (page >= sprites.page_count) sprites.page_count = page + 1;
+            }
+        } else if (sscanf(line, "sprite %d %d %d %d %d %n", &page, &x, &y, &width, &height, &offset) == 5 && offset > 0) {
+            Sprite* sprite = page >= 0 && page < SPRITES_ATLAS_MAX_PAGES ? sprite_register(line + offset) : NULL;
+            if (sprite) {
+                sprite->page = page;
+                sprite->rect = (Rectangle){ (float)x, (float)y, (float)width, (float)height };
+                sprite_count++;
+            }
+        }
+
+        line = next;
+    }
+
+    UnloadFileText(text);
+
+    for (int i = 0; i < sprites.count; i++) {
+        Sprite* sprite = &sprites.sprites[i];
+        if (sprite->used && sprite->page < 0 && sprite->texture.id == 0) {
+            sprite->texture = asset_load_texture_async(sprite->path);
+        }
+    }
+
+    printf("[SPRITES] Atlas %s: %d sprites on %d pages\n", index_path, sprite_count, sprites.page_count);
+    return true;
+}
+
+// Sprites are never released, they stay resident for the whole run like
+// the atlas pages
+SpriteHandle sprite_load(const char* path) {
+    Sprite* sprite = sprite_register(path);
+    if (!sprite) return (SpriteHandle){0};
+
+    sprite->used = true;
+    if (sprite->page < 0 && sprite->texture.id == 0) {
+        sprite->texture = asset_load_texture_async(path);
+    }
+    return (SpriteHandle){ (uint32_t)(sprite - sprites.sprites) + 1 };
+}
+
+static Texture2D sprite_texture(const Sprite* sprite) {
+    return asset_texture(sprite->page >= 0 ? sprites.pages[sprite->page] : sprite->texture);
+}
+
+// Loose sprites change size once their texture is uploaded
+Rectangle sprite_rect(SpriteHandle handle) {
+    Sprite* sprite = sprite_get(handle);
+    if (!sprite) return (Rectangle){0};
+    if (sprite->page >= 0) return sprite->rect;
+
+    Texture2D texture = sprite_texture(sprite);
+    return (Rectangle){ 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+}
+
+// Same placement as DrawTextureEx(): rotation and scale around the top left corner
+void sprite_draw(SpriteHandle handle, Vector2 position, float rotation, float scale, Color tint) {
+    Sprite* sprite = sprite_get(handle);
+    if (!sprite) return;
+
+    Texture2D texture = sprite_texture(sprite);
+    Rectangle source = sprite_rect(handle);
+
+    if (texture.id != sprites.last_texture_id) {
+        if (sprites.last_texture_id != 0) sprites.frame_breaks++;
+        sprites.last_texture_id = texture.id;
+    }
+
+    Rectangle destination = { position.x, position.y, source.width * scale, source.height * scale };
+    runtime_draw.draw_texture_pro(texture, source, destination, (Vector2){ 0.0f, 0.0f }, rotation, tint);
+}
+
+void sprites_frame_end(void) {
+    sprites.last_frame_breaks = sprites.frame_breaks;
+    sprites.frame_breaks = 0;
+    sprites.last_texture_id = 0;
+}
+
+// Whether an image packed in the atlas was saved after the index was written.
+// A stat per packed sprite, so only called when resources/ changed.
+bool sprites_atlas_stale(void) {
+    if (sprites.index_mod_time == 0) return false;
+
+    for (int i = 0; i < sprites.count; i++) {
+        const Sprite* sprite = &sprites.sprites[i];
+        if (sprite->page >= 0 && GetFileModTime(sprite->path) > sprites.index_mod_time) return true;
+    }
+    return false;
+}
+
+// Picks up a rewritten atlas index
+void sprites_check_changes(void) {
+    if (sprites.index_mod_time == 0) return;
+
+    long mod_time = GetFileModTime(sprites.index_path);
+    if (mod_time != 0 && mod_time != sprites.index_mod_time) {
+        sprites_load_atlas(sprites.index_path);
+    }
+}
+
+int sprites_batch_breaks(void) {
+    return sprites.last_frame_breaks;
+}
@@ -0,0 +1,44 @@
+#ifndef RUNTIME_SPRITES_H
+#define RUNTIME_SPRITES_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "raylib.h"
+
+// Atlas-aware sprites.
+//
+// tools/atlas_packer.c packs resources/ into atlas pages at build time and
+// writes an index of where every image went. Once sprites_load_atlas() has
+// read that index, sprite_load() of a packed image returns a sub-rect of its
+// page, so sprites from the same page draw in a single raylib batch. Images
+// that aren't in the index (or builds without an atlas) fall back to their
+// own texture through the asset registry.
+//
+// sprite_draw() counts batch breaks: draws that use a different texture than
+// the previous sprite draw. sprites_frame_end(), called once per frame by the
+// host (or main.c), publishes the count as sprites_batch_breaks().
+// The draw itself goes through runtime_draw (runtime_draw.h), so F7 and F8
+// see sprites like the game's own raylib calls.
+//
+// A packed image only changes on screen once the atlas is repacked. When
+// something in resources/ changed, the hot reload host asks
+// sprites_atlas_stale() whether a packed image is newer than the index, runs
+// the packers if so, and calls sprites_check_changes() to read the new index.
+#define SPRITES_MAX 1024
+#define SPRITES_ATLAS_INDEX "resources/atlas/atlas.txt"
+#define SPRITES_ATLAS_MAX_PAGES 16
+
+typedef struct {
+    uint32_t id;
+} SpriteHandle;
+
+bool sprites_load_atlas(const char* index_path);
+SpriteHandle sprite_load(const char* path);
+Rectangle sprite_rect(SpriteHandle handle);
+void sprite_draw(SpriteHandle handle, Vector2 position, float rotation, float scale, Color tint);
+void sprites_frame_end(void);
+bool sprites_atlas_stale(void);
+void sprites_check_changes(void);
+int sprites_batch_breaks(void);
+
+#endif // RUNTIME_SPRITES_H
@@ -0,0 +1,142 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "startup.h"
+#include "jobs.h"
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+
+#define STARTUP_TIMELINE_WIDTH 40
+
+typedef struct {
+    const char* name;
+    double start_ms;
+    double end_ms;
+} StartupPhaseRecord;
+
+typedef struct {
+    uint64_t start_ns;
+    StartupPhaseRecord phases[STARTUP_MAX_PHASES];
+    int phase_count;
+    JobLock lock;
+
+    double first_frame_ms;
+    double assets_ready_ms;
+    bool reported;
+} Startup;
+
+static Startup startup = {0};
+
+// raylib's GetTime() only works once the window is up
+static uint64_t startup_now_ns(void) {
+#ifdef _WIN32
+    static LARGE_INTEGER frequency = {0};
+    LARGE_INTEGER counter;
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static double startup_elapsed_ms(void) {
+    return (double)(startup_now_ns() - startup.start_ns) / 1e6;
+}
+
+void startup_begin(void) {
+    startup.start_ns = startup_now_ns();
+}
+
+// Thread safe, phases can start and end on worker threads
+int startup_phase_begin(const char* name) {
+    double now = startup_elapsed_ms();
+
+    job_lock(&startup.lock);
+    int phase = startup.phase_count < STARTUP_MAX_PHASES ? startup.phase_count++ : -1;
+    if (phase >= 0) {
+        startup.phases[phase] = (StartupPhaseRecord){ name, now, -1.0 };
+    }
+    job_unlock(&startup.lock);
+    return phase;
+}
+
+void startup_phase_end(int phase) {
+    if (phase < 0) return;
+    startup.phases[phase].end_ms = startup_elapsed_ms();
+}
+
+// Length of the union of the phase intervals. Phases are recorded in start
+// order, so a single sweep merges them.
+static double startup_busy_ms(void) {
+    double busy = 0.0;
+    double covered_until = 0.0;
+    for (int i = 0; i < startup.phase_count; i++) {
+        const StartupPhaseRecord* phase = &startup.phases[i];
+        if (phase->end_ms < 0.0) continue;
+
+        double start = phase->start_ms > covered_until ? phase->start_ms : covered_until;
+        if (phase->end_ms > start) {
+            busy += phase->end_ms - start;
+            covered_until = phase->end_ms;
+        }
+    }
+    return busy;
+}
+
+static void startup_print_report(void) {
+    double total = startup.assets_ready_ms > startup.first_frame_ms ? startup.assets_ready_ms : startup.first_frame_ms;
+    if (total <= 0.0) total = startup_elapsed_ms();
+
+    printf("[STARTUP] Time to first frame %.1f ms, assets ready at %.1f ms\n",
+           startup.first_frame_ms, startup.assets_ready_ms);
+    printf("  %-20s %9s %9s  timeline (%.0f ms)\n", "phase", "start ms", "ms", total);
+
+    double sum = 0.0;
+    for (int i = 0; i < startup.phase_count; i++) {
+        const StartupPhaseRecord* phase = &startup.phases[i];
+        if (phase->end_ms < 0.0) continue;
+
+        double duration = phase->end_ms - phase->start_ms;
+        sum += duration;
+
+        // At least one column per phase, however short
+        char bar[STARTUP_TIMELINE_WIDTH + 1];
+        int from = (int)(phase->start_ms / total * (STARTUP_TIMELINE_WIDTH - 1));
+        int to = (int)(phase->end_ms / total * (STARTUP_TIMELINE_WIDTH - 1));
+        if (to > STARTUP_TIMELINE_WIDTH - 1) to = STARTUP_TIMELINE_WIDTH - 1;
+        if (from > to) from = to;
+        memset(bar, ' ', (size_t)from);
+        memset(bar + from, '#', (size_t)(to - from + 1));
+        bar[to + 1] = '\0';
+
+        printf("  %-20s %9.1f %9.1f  |%s\n", phase->name, phase->start_ms, duration, bar);
+    }
+
+    double busy = startup_busy_ms();
+    printf("  Phases add up to %.1f ms, %.1f ms saved by running them in parallel\n", sum, sum - busy);
+}
+
+// Takes assets_pending(). Asset uploads happen on the main thread, so assets
+// are ready by the end of the frame that uploaded the last one.
+void startup_frame_end(int assets_pending) {
+    if (startup.reported) return;
+
+    double now = startup_elapsed_ms();
+    if (startup.first_frame_ms == 0.0) startup.first_frame_ms = now;
+    if (assets_pending > 0) return;
+
+    startup.assets_ready_ms = now;
+    startup.reported = true;
+    startup_print_report();
+}
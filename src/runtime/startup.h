@@ -0,0 +1,20 @@
+#ifndef RUNTIME_STARTUP_H
+#define RUNTIME_STARTUP_H
+
+// Startup timing.
+//
+// main() (or the hot reload host) calls startup_begin() first, wraps every
+// startup phase in startup_phase_begin()/startup_phase_end(), and calls
+// startup_frame_end(assets_pending()) after every frame. Phases can run on
+// worker threads, overlapping the main thread ones, but shouldn't nest. Once
+// the first frame is done and every asset requested so far is loaded, a
+// report is printed with the timeline of the phases, the time to first frame
+// and the time saved by overlapping.
+#define STARTUP_MAX_PHASES 32
+
+void startup_begin(void);
+int startup_phase_begin(const char* name);
+void startup_phase_end(int phase);
+void startup_frame_end(int assets_pending);
+
+#endif // RUNTIME_STARTUP_H
@@ -0,0 +1,218 @@
+#include "text_cache.h"
+#include "runtime_draw.h"
+#include "rlgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Glyph quad relative to the line origin, with normalized texture coordinates
+typedef struct {
+    float x0, y0, x1, y1;
+    float u0, v0, u1, v1;
+} TextQuad;
+
+typedef struct TextCacheEntry {
+    struct TextCacheEntry* next;
+    uint64_t hash;
+    const void* font_glyphs;
+    unsigned int texture_id;
+    float font_size;
+    float spacing;
+    uint64_t last_used_frame;
+    int quad_count;
+    size_t length;
+    TextQuad* quads;
+    char* text;
+} TextCacheEntry;
+
+typedef struct {
+    TextCacheEntry* buckets[TEXT_CACHE_BUCKETS];
+    uint64_t frame;
+    TextCacheStats frame_stats;
+    TextCacheStats last_frame_stats;
+} TextCache;
+
+static TextCache text_cache = {0};
+
+// FNV-1a over the line and the layout parameters
+static uint64_t text_cache_hash(const char* text, size_t length, const void* glyphs, float font_size, float spacing) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)text[i];
+        hash *= 1099511628211ULL;
+    }
+    hash ^= (uint64_t)(uintptr_t)glyphs;
+    hash *= 1099511628211ULL;
+    hash ^= (uint64_t)(font_size * 64.0f) << 20 ^ (uint64_t)(spacing * 64.0f);
+    hash *= 1099511628211ULL;
+    return hash;
+}
+
+// Same placement as DrawTextEx() and DrawTextCodepoint(), for a single line
+static TextCacheEntry* text_cache_layout(Font font, const char* text, size_t length, float font_size, float spacing) {
+    // At most one quad per byte, the quads and the text share one allocation
+    TextCacheEntry* entry = malloc(sizeof(TextCacheEntry) + length * sizeof(TextQuad) + length + 1);
+    if (!entry) return NULL;
+
+    entry->quads = (TextQuad*)(entry + 1);
+    entry->text = (char*)(entry->quads + length);
+    memcpy(entry->text, text, length);
+    entry->text[length] = '\0';
+    entry->length = length;
+    entry->quad_count = 0;
+
+    float scale = font_size / (float)font.baseSize;
+    float padding = (float)font.glyphPadding;
+    float texture_width = (float)font.texture.width;
+    float texture_height = (float)font.texture.height;
+    float offset_x = 0.0f;
+
+    for (size_t i = 0; i < length;) {
+        int codepoint_size = 0;
+        int codepoint = GetCodepointNext(entry->text + i, &codepoint_size);
+        int index = GetGlyphIndex(font, codepoint);
+        Rectangle rec = font.recs[index];
+        GlyphInfo glyph = font.glyphs[index];
+
+        if (codepoint != ' ' && codepoint != '\t') {
+            TextQuad* quad = &entry->quads[entry->quad_count++];
+            quad->x0 = offset_x + ((float)glyph.offsetX - padding) * scale;
+            quad->y0 = ((float)glyph.offsetY - padding) * scale;
+            quad->x1 = quad->x0 + (rec.width + 2.0f * padding) * scale;
+            quad->y1 = quad->y0 + (rec.height + 2.0f * padding) * scale;
+            quad->u0 = (rec.x - padding) / texture_width;
+            quad->v0 = (rec.y - padding) / texture_height;
+            quad->u1 = (rec.x + rec.width + padding) / texture_width;
+            quad->v1 = (rec.y + rec.height + padding) / texture_height;
+        }
+
+        offset_x += (glyph.advanceX == 0 ? rec.width : (float)glyph.advanceX) * scale + spacing;
+        i += codepoint_size > 0 ? (size_t)codepoint_size : 1;
+    }
+
+    return entry;
+}
+
+static TextCacheEntry* text_cache_get(Font font, const char* text, size_t length, float font_size, float spacing) {
+    uint64_t hash = text_cache_hash(text, length, font.glyphs, font_size, spacing);
+    TextCacheEntry** bucket = &text_cache.buckets[hash % TEXT_CACHE_BUCKETS];
+
+    for (TextCacheEntry* entry = *bucket; entry; entry = entry->next) {
+        if (entry->hash == hash && entry->length == length && entry->font_glyphs == font.glyphs &&
+            entry->texture_id == font.texture.id && entry->font_size == font_size &&
+            entry->spacing == spacing && memcmp(entry->text, text, length) == 0) {
+            text_cache.frame_stats.hits++;
+            return entry;
+        }
+    }
+
+    TextCacheEntry* entry = text_cache_layout(font, text, length, font_size, spacing);
+    if (!entry) return NULL;
+
+    entry->hash = hash;
+    entry->font_glyphs = font.glyphs;
+    entry->texture_id = font.texture.id;
+    entry->font_size = font_size;
+    entry->spacing = spacing;
+    entry->next = *bucket;
+    *bucket = entry;
+    text_cache.frame_stats.layouts++;
+    return entry;
+}
+
+static void text_cache_submit(const TextCacheEntry* entry, Vector2 position, Color tint) {
+    if (entry->quad_count == 0) return;
+
+    rlCheckRenderBatchLimit(4 * entry->quad_count);
+    rlSetTexture(entry->texture_id);
+    rlBegin(RL_QUADS);
+    rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+    rlNormal3f(0.0f, 0.0f, 1.0f);
+
+    for (int i = 0; i < entry->quad_count; i++) {
+        const TextQuad* quad = &entry->quads[i];
+        float x0 = position.x + quad->x0, y0 = position.y + quad->y0;
+        float x1 = position.x + quad->x1, y1 = position.y + quad->y1;
+
+        rlTexCoord2f(quad->u0, quad->v0); rlVertex2f(x0, y0);
+        rlTexCoord2f(quad->u0, quad->v1); rlVertex2f(x0, y1);
+        rlTexCoord2f(quad->u1, quad->v1); rlVertex2f(x1, y1);
+        rlTexCoord2f(quad->u1, quad->v0); rlVertex2f(x1, y0);
+    }
+
+    rlEnd();
+    rlSetTexture(0);
+}
+
+void text_draw_ex(Font font, const char* text, Vector2 position, float font_size, float spacing, Color tint) {
+    if (!text) return;
+    if (font.texture.id == 0) font = GetFontDefault();
+    if (font.texture.id == 0) return;
+
+    // rlgl submissions aren't raylib calls, F7 and F8 wouldn't see the text
+    if (!runtime_draw.direct) {
+        runtime_draw.draw_text_ex(font, text, position, font_size, spacing, tint);
+        return;
+    }
+
+    float line_y = position.y;
+    const char* line = text;
+    for (;;) {
+        const char* end = strchr(line, '\n');
+        size_t length = end ? (size_t)(end - line) : strlen(line);
+
+        if (length > 0) {
+            TextCacheEntry* entry = text_cache_get(font, line, length, font_size, spacing);
+            if (entry) {
+                entry->last_used_frame = text_cache.frame;
+                text_cache_submit(entry, (Vector2){ position.x, line_y }, tint);
+            }
+        }
+
+        if (!end) break;
+        line = end + 1;
+        line_y += font_size + TEXT_CACHE_LINE_SPACING;
+    }
+}
+
+// Same font size and spacing rules as DrawText()
+void text_draw(const char* text, int x, int y, int font_size, Color color) {
+    if (font_size < 10) font_size = 10;
+    text_draw_ex(GetFontDefault(), text, (Vector2){ (float)x, (float)y }, (float)font_size, (float)(font_size / 10), color);
+}
+
+// Drops the lines that weren't drawn for TEXT_CACHE_MAX_AGE frames
+void text_cache_frame_end(void) {
+    int entries = 0;
+
+    for (int i = 0; i < TEXT_CACHE_BUCKETS; i++) {
+        TextCacheEntry** link = &text_cache.buckets[i];
+        while (*link) {
+            TextCacheEntry* entry = *link;
+            if (text_cache.frame - entry->last_used_frame > TEXT_CACHE_MAX_AGE) {
+                *link = entry->next;
+                free(entry);
+                text_cache.frame_stats.evictions++;
+            } else {
+                link = &entry->next;
+                entries++;
+            }
+        }
+    }
+
+    text_cache.frame_stats.entries = entries;
+    text_cache.frame_stats.evictions += text_cache.last_frame_stats.evictions;
+    text_cache.last_frame_stats = text_cache.frame_stats;
+    memset(&text_cache.frame_stats, 0, sizeof(text_cache.frame_stats));
+    text_cache.frame++;
+}
+
+TextCacheStats text_cache_stats(void) {
+    return text_cache.last_frame_stats;
+}
+
+void text_cache_print_stats(void) {
+    const TextCacheStats* stats = &text_cache.last_frame_stats;
+    printf("[TEXT_CACHE] %d cached lines, last frame %d hits and %d layouts, %llu lines dropped\n",
+           stats->entries, stats->hits, stats->layouts, (unsigned long long)stats->evictions);
+}
@@ -0,0 +1,46 @@
+#ifndef RUNTIME_TEXT_CACHE_H
+#define RUNTIME_TEXT_CACHE_H
+
+#include <stdint.h>
+#include "raylib.h"
+
+// Cached text layout.
+//
+// text_draw() and text_draw_ex() draw like DrawText() and DrawTextEx(), but
+// every line of text is laid out once into positioned glyph quads, keyed by
+// its contents, font and size. Drawing a line that was drawn recently only
+// looks it up and submits its quads to rlgl in one go, with one texture bind.
+// Lines are cached separately, so in a HUD only the lines whose text changed
+// are laid out again.
+//
+// Lines not drawn for TEXT_CACHE_MAX_AGE frames are dropped by
+// text_cache_frame_end(), which the host (or main.c) calls once per frame.
+//
+// Any raylib Font works: the default bitmap font (text_draw()), loaded
+// bitmap fonts, and SDF fonts (FONT_SDF) drawn inside BeginShaderMode() with
+// an SDF shader. Line spacing follows raylib's default (SetTextLineSpacing()
+// isn't readable back).
+//
+// While the hot reload host counts (F7) or captures (F8) raylib calls, lines
+// are drawn with DrawTextEx() through runtime_draw instead, uncached, so they
+// show up in the stats and the trace.
+#define TEXT_CACHE_BUCKETS 1024
+#define TEXT_CACHE_MAX_AGE 120
+#define TEXT_CACHE_LINE_SPACING 2
+
+typedef struct {
+    // Lines found in the cache and lines laid out in the last frame, lines
+    // cached at its end, and lines dropped since the start
+    int hits;
+    int layouts;
+    int entries;
+    uint64_t evictions;
+} TextCacheStats;
+
+void text_draw(const char* text, int x, int y, int font_size, Color color);
+void text_draw_ex(Font font, const char* text, Vector2 position, float font_size, float spacing, Color tint);
+void text_cache_frame_end(void);
+TextCacheStats text_cache_stats(void);
+void text_cache_print_stats(void);
+
+#endif // RUNTIME_TEXT_CACHE_H
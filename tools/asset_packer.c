@@ -0,0 +1,213 @@
+// Build-time asset packer.
+//
+// Decodes every PNG under a resources directory (atlas pages included) and
+// writes the pixels, ready to upload, into a single pack file that the asset
+// registry maps at runtime (see src/runtime/asset_pack.h). Images are stored
+// as RGBA8, optionally premultiplied and with a full mipmap chain.
+//
+// The pack is only rewritten when a source image is newer than it. It is
+// written next to the target and renamed over it, so a running game keeps
+// its mapping of the previous version.
+//
+// Usage: asset_packer [resources_dir] [--output path] [--mips] [--premultiply] [--force]
+//   Output: <resources_dir>/assets.pack by default
+//
+// Textures packed with --premultiply must be drawn with
+// BLEND_ALPHA_PREMULTIPLY.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "raylib.h"
+#include "runtime/asset_pack.h"
+
+typedef struct {
+    AssetPackEntry entry;
+    Image image;
+} PackedAsset;
+
+// Same hash as the asset registry, so it can tell a packed version from the
+// file on disk
+static uint64_t hash_bytes(const unsigned char* data, size_t size) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static int compare_by_path(const void* a, const void* b) {
+    return strcmp(((const PackedAsset*)a)->entry.path, ((const PackedAsset*)b)->entry.path);
+}
+
+// Size of all mip levels, which raylib stores one after another
+static uint64_t image_data_size(const Image* image) {
+    uint64_t size = 0;
+    int width = image->width;
+    int height = image->height;
+    for (int level = 0; level < image->mipmaps; level++) {
+        size += (uint64_t)GetPixelDataSize(width, height, image->format);
+        width = width > 1 ? width / 2 : 1;
+        height = height > 1 ? height / 2 : 1;
+    }
+    return size;
+}
+
+static bool write_padding(FILE* file, uint64_t* offset) {
+    static const unsigned char zeros[ASSET_PACK_ALIGNMENT] = {0};
+    uint64_t padding = (ASSET_PACK_ALIGNMENT - *offset % ASSET_PACK_ALIGNMENT) % ASSET_PACK_ALIGNMENT;
+    *offset += padding;
+    return fwrite(zeros, 1, (size_t)padding, file) == padding;
+}
+
+int main(int argc, char** argv) {
+    const char* resources_dir = "resources";
+    const char* output = NULL;
+    bool mips = false;
+    bool premultiply = false;
+    bool force = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else if (strcmp(argv[i], "--mips") == 0) {
+            mips = true;
+        } else if (strcmp(argv[i], "--premultiply") == 0) {
+            premultiply = true;
+        } else if (strcmp(argv[i], "--force") == 0) {
+            force = true;
+        } else {
+            resources_dir = argv[i];
+        }
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    char pack_path[512];
+    char tmp_path[520];
+    if (output) {
+        snprintf(pack_path, sizeof(pack_path), "%s", output);
+    } else {
+        snprintf(pack_path, sizeof(pack_path), "%s/assets.pack", resources_dir);
+    }
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", pack_path);
+
+    FilePathList files = LoadDirectoryFilesEx(resources_dir, ".png", true);
+
+    long pack_time = FileExists(pack_path) ? GetFileModTime(pack_path) : 0;
+    bool changed = force || pack_time == 0;
+    for (unsigned int i = 0; i < files.count && !changed; i++) {
+        if (GetFileModTime(files.paths[i]) >= pack_time) changed = true;
+    }
+
+    if (!changed) {
+        printf("[ASSET_PACK] %s is up to date\n", pack_path);
+        UnloadDirectoryFiles(files);
+        return 0;
+    }
+
+    PackedAsset* assets = calloc(files.count > 0 ? files.count : 1, sizeof(PackedAsset));
+    int count = 0;
+
+    for (unsigned int i = 0; i < files.count; i++) {
+        const char* path = files.paths[i];
+        if (strlen(path) >= ASSET_PACK_PATH_LENGTH) {
+            printf("[ASSET_PACK] Path too long, skipping %s\n", path);
+            continue;
+        }
+
+        int file_size = 0;
+        unsigned char* file_data = LoadFileData(path, &file_size);
+        if (!file_data) continue;
+
+        PackedAsset* asset = &assets[count];
+        asset->image = LoadImageFromMemory(GetFileExtension(path), file_data, file_size);
+        asset->entry.content_hash = hash_bytes(file_data, (size_t)file_size);
+        UnloadFileData(file_data);
+
+        if (!asset->image.data) {
+            printf("[ASSET_PACK] Failed to decode %s, skipping it\n", path);
+            continue;
+        }
+
+        ImageFormat(&asset->image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        if (premultiply) {
+            ImageAlphaPremultiply(&asset->image);
+            asset->entry.flags |= ASSET_PACK_PREMULTIPLIED;
+        }
+        if (mips) {
+            ImageMipmaps(&asset->image);
+        }
+
+        strcpy(asset->entry.path, path);
+        asset->entry.mod_time = GetFileModTime(path);
+        asset->entry.width = asset->image.width;
+        asset->entry.height = asset->image.height;
+        asset->entry.format = asset->image.format;
+        asset->entry.mipmaps = asset->image.mipmaps;
+        asset->entry.size = image_data_size(&asset->image);
+        count++;
+    }
+
+    // The runtime looks entries up with a binary search
+    qsort(assets, count, sizeof(PackedAsset), compare_by_path);
+
+    uint64_t offset = sizeof(AssetPackHeader) + sizeof(AssetPackEntry) * (uint64_t)count;
+    uint64_t data_size = 0;
+    for (int i = 0; i < count; i++) {
+        offset += (ASSET_PACK_ALIGNMENT - offset % ASSET_PACK_ALIGNMENT) % ASSET_PACK_ALIGNMENT;
+        assets[i].entry.offset = offset;
+        offset += assets[i].entry.size;
+        data_size += assets[i].entry.size;
+    }
+
+    FILE* file = fopen(tmp_path, "wb");
+    if (!file) {
+        printf("[ASSET_PACK] Failed to open %s\n", tmp_path);
+        return 1;
+    }
+
+    AssetPackHeader header = { ASSET_PACK_MAGIC, ASSET_PACK_VERSION, (uint32_t)count, 0 };
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1;
+    for (int i = 0; i < count && written; i++) {
+        written = fwrite(&assets[i].entry, sizeof(AssetPackEntry), 1, file) == 1;
+    }
+
+    offset = sizeof(AssetPackHeader) + sizeof(AssetPackEntry) * (uint64_t)count;
+    for (int i = 0; i < count && written; i++) {
+        written = write_padding(file, &offset) &&
+                  fwrite(assets[i].image.data, 1, (size_t)assets[i].entry.size, file) == assets[i].entry.size;
+        offset += assets[i].entry.size;
+    }
+    written = fclose(file) == 0 && written;
+
+    for (int i = 0; i < count; i++) {
+        UnloadImage(assets[i].image);
+    }
+    free(assets);
+    UnloadDirectoryFiles(files);
+
+    if (!written) {
+        printf("[ASSET_PACK] Failed to write %s\n", tmp_path);
+        remove(tmp_path);
+        return 1;
+    }
+
+#ifdef _WIN32
+    // rename() doesn't replace existing files on Windows
+    remove(pack_path);
+#endif
+    if (rename(tmp_path, pack_path) != 0) {
+        printf("[ASSET_PACK] Failed to replace %s (is it in use?)\n", pack_path);
+        remove(tmp_path);
+        return 1;
+    }
+
+    printf("[ASSET_PACK] Packed %d images (%.1f MB of pixels) into %s\n", count,
+           (double)data_size / (1024.0 * 1024.0), pack_path);
+    return 0;
+}
@@ -0,0 +1,279 @@
+// Build-time texture atlas packer.
+//
+// Packs every PNG under a resources directory into one or more atlas pages and
+// writes an index with the rect of every source image, which the sprite
+// runtime (src/runtime/sprites.h) reads to draw sprites from the atlas. Drawing
+// many different sprites from the same page keeps raylib's batch intact.
+//
+// Pages are only rewritten when a source image is newer than the index, or when
+// images were added, deleted or renamed since. Pages and then the index are
+// written to .tmp files and renamed over the previous ones, so a running game
+// never loads them half written. Pages the new atlas doesn't use are deleted.
+//
+// Usage: atlas_packer [resources_dir] [--size N] [--padding N] [--force]
+//   Output: <resources_dir>/atlas/atlas.txt and atlas_<page>.png
+//
+// Index format, one entry per line, paths last so they can contain spaces:
+//   page <page> <png path>
+//   sprite <page> <x> <y> <width> <height> <source png path>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "raylib.h"
+
+#define ATLAS_DIR_NAME "atlas"
+#define ATLAS_MAX_PAGES 16
+
+typedef struct {
+    const char* path;
+    Image image;
+    int page;
+    int x;
+    int y;
+} PackedImage;
+
+static int compare_by_height(const void* a, const void* b) {
+    const PackedImage* ia = (const PackedImage*)a;
+    const PackedImage* ib = (const PackedImage*)b;
+    if (ia->image.height != ib->image.height) return ib->image.height - ia->image.height;
+    return ib->image.width - ia->image.width;
+}
+
+// Shelf packing: images sorted by height fill rows left to right, a new row
+// starts below the tallest image of the previous one, and a new page when the
+// page is full. Images bigger than a page get a page of their own size.
+static int pack(PackedImage* images, int count, int page_size, int padding, int* page_widths, int* page_heights) {
+    int page = -1;
+    int shelf_x = 0, shelf_y = 0, shelf_height = 0;
+
+    for (int i = 0; i < count; i++) {
+        int width = images[i].image.width + padding;
+        int height = images[i].image.height + padding;
+
+        if (width > page_size || height > page_size) {
+            if (page + 1 >= ATLAS_MAX_PAGES) return -1;
+            page++;
+            images[i].page = page;
+            images[i].x = 0;
+            images[i].y = 0;
+            page_widths[page] = images[i].image.width;
+            page_heights[page] = images[i].image.height;
+            // Nothing else goes on this page
+            shelf_x = page_size;
+            shelf_y = page_size;
+            continue;
+        }
+
+        if (page < 0 || shelf_x + width > page_size) {
+            shelf_x = 0;
+            shelf_y += shelf_height;
+            shelf_height = 0;
+        }
+        if (page < 0 || shelf_y + height > page_size) {
+            if (page + 1 >= ATLAS_MAX_PAGES) return -1;
+            page++;
+            shelf_x = 0;
+            shelf_y = 0;
+            shelf_height = 0;
+            page_widths[page] = 0;
+            page_heights[page] = 0;
+        }
+
+        images[i].page = page;
+        images[i].x = shelf_x;
+        images[i].y = shelf_y;
+
+        shelf_x += width;
+        if (height > shelf_height) shelf_height = height;
+        if (shelf_x > page_widths[page]) page_widths[page] = shelf_x;
+        if (shelf_y + height > page_heights[page]) page_heights[page] = shelf_y + height;
+    }
+
+    return page + 1;
+}
+
+// Straight copy, ImageDraw() would blend with the transparent page
+static void copy_image(Image* page, const Image* image, int x, int y) {
+    unsigned char* destination = (unsigned char*)page->data;
+    const unsigned char* source = (const unsigned char*)image->data;
+    for (int row = 0; row < image->height; row++) {
+        memcpy(destination + ((size_t)(y + row) * page->width + x) * 4,
+               source + (size_t)row * image->width * 4,
+               (size_t)image->width * 4);
+    }
+}
+
+// Whether the index lists exactly these source images
+static bool index_has_same_paths(const char* index_path, const PackedImage* images, int count) {
+    FILE* index = fopen(index_path, "r");
+    if (!index) return false;
+
+    int listed = 0;
+    bool same = true;
+    char line[1024];
+    while (same && fgets(line, sizeof(line), index)) {
+        int page, x, y, width, height, offset = 0;
+        if (sscanf(line, "sprite %d %d %d %d %d %n", &page, &x, &y, &width, &height, &offset) != 5 || offset == 0) continue;
+
+        char* path = line + offset;
+        path[strcspn(path, "\r\n")] = '\0';
+        listed++;
+
+        same = false;
+        for (int i = 0; i < count; i++) {
+            if (strcmp(images[i].path, path) == 0) {
+                same = true;
+                break;
+            }
+        }
+    }
+    fclose(index);
+    return same && listed == count;
+}
+
+// Renames a finished file over the previous version, so the running game
+// never reads one half written
+static bool replace_file(const char* tmp_path, const char* path) {
+#ifdef _WIN32
+    // rename() doesn't replace existing files on Windows
+    remove(path);
+#endif
+    if (rename(tmp_path, path) == 0) return true;
+
+    printf("[ATLAS] Failed to replace %s\n", path);
+    remove(tmp_path);
+    return false;
+}
+
+static bool export_page(Image page_image, const char* page_path) {
+    char tmp_path[520];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", page_path);
+
+    int size = 0;
+    unsigned char* data = ExportImageToMemory(page_image, ".png", &size);
+    bool saved = data && SaveFileData(tmp_path, data, size);
+    MemFree(data);
+    if (!saved) {
+        printf("[ATLAS] Failed to write %s\n", tmp_path);
+        remove(tmp_path);
+        return false;
+    }
+    return replace_file(tmp_path, page_path);
+}
+
+int main(int argc, char** argv) {
+    const char* resources_dir = "resources";
+    int page_size = 2048;
+    int padding = 2;
+    bool force = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            page_size = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--padding") == 0 && i + 1 < argc) {
+            padding = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--force") == 0) {
+            force = true;
+        } else {
+            resources_dir = argv[i];
+        }
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    char atlas_dir[256];
+    char index_path[512];
+    snprintf(atlas_dir, sizeof(atlas_dir), "%s/" ATLAS_DIR_NAME, resources_dir);
+    snprintf(index_path, sizeof(index_path), "%s/atlas.txt", atlas_dir);
+
+    FilePathList files = LoadDirectoryFilesEx(resources_dir, ".png", true);
+
+    // Skip previous output, and check whether anything changed since
+    long index_time = FileExists(index_path) ? GetFileModTime(index_path) : 0;
+    PackedImage* images = calloc(files.count > 0 ? files.count : 1, sizeof(PackedImage));
+    int count = 0;
+    bool changed = force || index_time == 0;
+
+    for (unsigned int i = 0; i < files.count; i++) {
+        if (strstr(files.paths[i], "/" ATLAS_DIR_NAME "/")) continue;
+        if (GetFileModTime(files.paths[i]) > index_time) changed = true;
+        images[count++].path = files.paths[i];
+    }
+    if (!changed && !index_has_same_paths(index_path, images, count)) changed = true;
+
+    if (!changed) {
+        printf("[ATLAS] %s is up to date\n", index_path);
+        free(images);
+        UnloadDirectoryFiles(files);
+        return 0;
+    }
+
+    for (int i = 0; i < count; i++) {
+        images[i].image = LoadImage(images[i].path);
+        ImageFormat(&images[i].image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    }
+
+    qsort(images, count, sizeof(PackedImage), compare_by_height);
+
+    int page_widths[ATLAS_MAX_PAGES] = {0};
+    int page_heights[ATLAS_MAX_PAGES] = {0};
+    int page_count = pack(images, count, page_size, padding, page_widths, page_heights);
+    if (page_count < 0) {
+        printf("[ATLAS] Doesn't fit in %d pages of %dx%d\n", ATLAS_MAX_PAGES, page_size, page_size);
+        return 1;
+    }
+
+    MakeDirectory(atlas_dir);
+
+    // Pages first and the index last, the game reloads the index when it changes
+    char index_tmp_path[520];
+    snprintf(index_tmp_path, sizeof(index_tmp_path), "%s.tmp", index_path);
+    FILE* index = fopen(index_tmp_path, "w");
+    if (!index) {
+        printf("[ATLAS] Failed to open %s\n", index_tmp_path);
+        return 1;
+    }
+    fprintf(index, "# Generated by atlas_packer, do not edit\n");
+
+    bool written = true;
+    for (int page = 0; page < page_count && written; page++) {
+        Image page_image = GenImageColor(page_widths[page], page_heights[page], BLANK);
+        for (int i = 0; i < count; i++) {
+            if (images[i].page == page) copy_image(&page_image, &images[i].image, images[i].x, images[i].y);
+        }
+
+        char page_path[512];
+        snprintf(page_path, sizeof(page_path), "%s/atlas_%d.png", atlas_dir, page);
+        written = export_page(page_image, page_path);
+        UnloadImage(page_image);
+
+        fprintf(index, "page %d %s\n", page, page_path);
+    }
+
+    for (int i = 0; i < count; i++) {
+        fprintf(index, "sprite %d %d %d %d %d %s\n", images[i].page, images[i].x, images[i].y,
+                images[i].image.width, images[i].image.height, images[i].path);
+        UnloadImage(images[i].image);
+    }
+    written = fclose(index) == 0 && written;
+    free(images);
+    UnloadDirectoryFiles(files);
+
+    if (!written) {
+        remove(index_tmp_path);
+        return 1;
+    }
+    if (!replace_file(index_tmp_path, index_path)) return 1;
+
+    // Pages of a previous, larger atlas aren't listed anymore
+    for (int page = page_count; page < ATLAS_MAX_PAGES; page++) {
+        char page_path[512];
+        snprintf(page_path, sizeof(page_path), "%s/atlas_%d.png", atlas_dir, page);
+        if (FileExists(page_path)) remove(page_path);
+    }
+
+    printf("[ATLAS] Packed %d images into %d pages, index: %s\n", count, page_count, index_path);
+    return 0;
+}
@@ -0,0 +1,442 @@
+// Standalone replayer for raylib call traces captured by the hot reload host (F8).
+//
+// Re-issues every recorded call against the raylib this tool is linked with, as
+// fast as possible, and reports frame times. Use it to benchmark the render path
+// without gameplay code, or to compare raylib versions on the same workload.
+//
+// Usage: raylib_replay <trace> [--loops N] [--vsync] [--csv frame_times.csv]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "raylib.h"
+#include "rlgl.h"
+#include "hot_reload/raylib_replay.gen.h"
+
+typedef struct {
+    unsigned int recorded_id;
+    Texture2D texture;
+} TextureMapping;
+
+typedef struct {
+    unsigned int recorded_id;
+    RenderTexture2D target;
+} RenderTextureMapping;
+
+typedef struct {
+    unsigned int recorded_id;
+    Shader shader;
+} ShaderMapping;
+
+// Recorded resource ids -> resources created by the replayer
+static TextureMapping* textures = NULL;
+static int texture_count = 0;
+static RenderTextureMapping* render_textures = NULL;
+static int render_texture_count = 0;
+static ShaderMapping* shaders = NULL;
+static int shader_count = 0;
+
+static void* grow(void* items, int count, size_t item_size) {
+    // Capacity doubles at every power of two
+    if (count == 0 || (count & (count - 1)) == 0) {
+        items = realloc(items, (count ? count * 2 : 16) * item_size);
+        if (!items) {
+            printf("[REPLAY] Out of memory\n");
+            exit(1);
+        }
+    }
+    return items;
+}
+
+static void map_texture(unsigned int recorded_id, Texture2D texture) {
+    for (int i = 0; i < texture_count; i++) {
+        if (textures[i].recorded_id == recorded_id) {
+            textures[i].texture = texture;
+            return;
+        }
+    }
+    textures = grow(textures, texture_count, sizeof(TextureMapping));
+    textures[texture_count++] = (TextureMapping){ recorded_id, texture };
+}
+
+static void map_render_texture(RenderTexture2D recorded, RenderTexture2D target) {
+    for (int i = 0; i < render_texture_count; i++) {
+        if (render_textures[i].recorded_id == recorded.id) {
+            render_textures[i].target = target;
+            return;
+        }
+    }
+    render_textures = grow(render_textures, render_texture_count, sizeof(RenderTextureMapping));
+    render_textures[render_texture_count++] = (RenderTextureMapping){ recorded.id, target };
+
+    // The color attachment can be drawn as a regular texture
+    map_texture(recorded.texture.id, target.texture);
+}
+
+static void map_shader(unsigned int recorded_id, Shader shader) {
+    shaders = grow(shaders, shader_count, sizeof(ShaderMapping));
+    shaders[shader_count++] = (ShaderMapping){ recorded_id, shader };
+}
+
+void rl_replay_value(RlTraceReader* reader, void* value, size_t size) {
+    if (reader->offset + size > reader->size) {
+        memset(value, 0, size);
+        reader->offset = reader->size;
+        return;
+    }
+    memcpy(value, reader->data + reader->offset, size);
+    reader->offset += size;
+}
+
+const char* rl_replay_string(RlTraceReader* reader) {
+    uint32_t length;
+    rl_replay_value(reader, &length, sizeof(length));
+    if (length == RL_TRACE_NULL_STRING || reader->offset + length > reader->size) {
+        return NULL;
+    }
+
+    // Strings are stored with their terminator, so they are used in place
+    const char* text = (const char*)(reader->data + reader->offset);
+    reader->offset += length;
+    return text;
+}
+
+Texture2D rl_replay_texture(RlTraceReader* reader) {
+    Texture2D recorded;
+    rl_replay_value(reader, &recorded, sizeof(recorded));
+
+    for (int i = 0; i < texture_count; i++) {
+        if (textures[i].recorded_id == recorded.id) return textures[i].texture;
+    }
+
+    // Unknown textures (e.g. never described by the trace) draw with the default one
+    if (recorded.id != 0) {
+        recorded.id = rlGetTextureIdDefault();
+    }
+    return recorded;
+}
+
+RenderTexture2D rl_replay_render_texture(RlTraceReader* reader) {
+    RenderTexture2D recorded;
+    rl_replay_value(reader, &recorded, sizeof(recorded));
+
+    for (int i = 0; i < render_texture_count; i++) {
+        if (render_textures[i].recorded_id == recorded.id) return render_textures[i].target;
+    }
+
+    RenderTexture2D target = LoadRenderTexture(recorded.texture.width, recorded.texture.height);
+    map_render_texture(recorded, target);
+    return target;
+}
+
+Shader rl_replay_shader(RlTraceReader* reader) {
+    Shader recorded;
+    rl_replay_value(reader, &recorded, sizeof(recorded));
+
+    for (int i = 0; i < shader_count; i++) {
+        if (shaders[i].recorded_id == recorded.id) return shaders[i].shader;
+    }
+
+    // Shaders loaded before the capture started can't be recreated
+    return (Shader){ rlGetShaderIdDefault(), rlGetShaderLocsDefault() };
+}
+
+void rl_replay_result_texture(RlTraceReader* reader, Texture2D texture) {
+    Texture2D recorded;
+    rl_replay_value(reader, &recorded, sizeof(recorded));
+    map_texture(recorded.id, texture);
+}
+
+void rl_replay_result_render_texture(RlTraceReader* reader, RenderTexture2D target) {
+    RenderTexture2D recorded;
+    rl_replay_value(reader, &recorded, sizeof(recorded));
+    map_render_texture(recorded, target);
+}
+
+void rl_replay_result_shader(RlTraceReader* reader, Shader shader) {
+    Shader recorded;
+    rl_replay_value(reader, &recorded, sizeof(recorded));
+    map_shader(recorded.id, shader);
+}
+
+void rl_replay_forget_texture(Texture2D texture) {
+    for (int i = 0; i < texture_count; i++) {
+        if (textures[i].texture.id == texture.id) {
+            textures[i--] = textures[--texture_count];
+        }
+    }
+}
+
+void rl_replay_forget_render_texture(RenderTexture2D target) {
+    for (int i = 0; i < render_texture_count; i++) {
+        if (render_textures[i].target.id == target.id) {
+            render_textures[i--] = render_textures[--render_texture_count];
+        }
+    }
+    rl_replay_forget_texture(target.texture);
+}
+
+void rl_replay_forget_shader(Shader shader) {
+    for (int i = 0; i < shader_count; i++) {
+        if (shaders[i].shader.id == shader.id) {
+            shaders[i--] = shaders[--shader_count];
+        }
+    }
+}
+
+// Resources are recreated on every loop, so each run replays the same work
+static void unload_replay_resources(void) {
+    for (int i = 0; i < render_texture_count; i++) {
+        rl_replay_forget_texture(render_textures[i].target.texture);
+        UnloadRenderTexture(render_textures[i].target);
+    }
+    for (int i = 0; i < texture_count; i++) {
+        UnloadTexture(textures[i].texture);
+    }
+    for (int i = 0; i < shader_count; i++) {
+        UnloadShader(shaders[i].shader);
+    }
+    texture_count = 0;
+    render_texture_count = 0;
+    shader_count = 0;
+}
+
+static unsigned char* read_whole_file(const char* path, size_t* size) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return NULL;
+
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    unsigned char* data = length > 0 ? malloc((size_t)length) : NULL;
+    if (data && fread(data, 1, (size_t)length, file) != (size_t)length) {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+
+    *size = data ? (size_t)length : 0;
+    return data;
+}
+
+int main(int argc, char** argv) {
+    const char* trace_path = NULL;
+    const char* csv_path = NULL;
+    int loops = 1;
+    bool vsync = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--loops") == 0 && i + 1 < argc) {
+            loops = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+            csv_path = argv[++i];
+        } else if (strcmp(argv[i], "--vsync") == 0) {
+            vsync = true;
+        } else {
+            trace_path = argv[i];
+        }
+    }
+
+    if (!trace_path || loops < 1) {
+        printf("Usage: %s <trace> [--loops N] [--vsync] [--csv frame_times.csv]\n", argv[0]);
+        return 1;
+    }
+
+    size_t size = 0;
+    unsigned char* data = read_whole_file(trace_path, &size);
+    if (!data) {
+        printf("[REPLAY] Failed to read %s\n", trace_path);
+        return 1;
+    }
+
+    RlTraceReader file = { data, size, 0 };
+
+    char magic[sizeof(RL_TRACE_MAGIC)];
+    uint32_t version, call_count;
+    int32_t screen_width, screen_height;
+    rl_replay_value(&file, magic, sizeof(magic));
+    rl_replay_value(&file, &version, sizeof(version));
+    rl_replay_value(&file, &screen_width, sizeof(screen_width));
+    rl_replay_value(&file, &screen_height, sizeof(screen_height));
+    rl_replay_value(&file, &call_count, sizeof(call_count));
+
+    if (memcmp(magic, RL_TRACE_MAGIC, sizeof(magic)) != 0 || version != RL_TRACE_VERSION) {
+        printf("[REPLAY] %s is not a version %d raylib trace\n", trace_path, RL_TRACE_VERSION);
+        free(data);
+        return 1;
+    }
+
+    // Every name takes at least its length
+    if (call_count > (file.size - file.offset) / sizeof(uint16_t)) {
+        printf("[REPLAY] Corrupted trace, %u call names don't fit in %s\n", call_count, trace_path);
+        free(data);
+        return 1;
+    }
+
+    // Match recorded call ids to this build's ids by name
+    int* call_map = malloc((call_count > 0 ? call_count : 1) * sizeof(int));
+    if (!call_map) {
+        printf("[REPLAY] Out of memory for %u call names\n", call_count);
+        free(data);
+        return 1;
+    }
+    int missing_calls = 0;
+    for (uint32_t i = 0; i < call_count; i++) {
+        uint16_t length = 0;
+        bool fits = file.size - file.offset >= sizeof(length);
+        if (fits) {
+            rl_replay_value(&file, &length, sizeof(length));
+            fits = length <= file.size - file.offset;
+        }
+        if (!fits) {
+            printf("[REPLAY] Corrupted trace, call name %u past the end at offset %zu\n", i, file.offset);
+            free(call_map);
+            free(data);
+            return 1;
+        }
+
+        call_map[i] = -1;
+        for (int id = 0; id < RL_CALL_COUNT; id++) {
+            if (strlen(raylib_call_names[id]) == length &&
+                memcmp(raylib_call_names[id], file.data + file.offset, length) == 0) {
+                call_map[i] = id;
+                break;
+            }
+        }
+        if (call_map[i] < 0) missing_calls++;
+        file.offset += length;
+    }
+    if (missing_calls > 0) {
+        printf("[REPLAY] %d recorded functions don't exist in this raylib version\n", missing_calls);
+    }
+
+    size_t records_start = file.offset;
+
+    if (vsync) SetConfigFlags(FLAG_VSYNC_HINT);
+    InitWindow(screen_width, screen_height, "raylib replay");
+    SetTargetFPS(0);
+
+    double* frame_times = NULL;
+    int frame_count = 0;
+    unsigned long long replayed = 0;
+    unsigned long long skipped = 0;
+    double replay_start = GetTime();
+
+    for (int loop = 0; loop < loops && !WindowShouldClose(); loop++) {
+        file.offset = records_start;
+        double frame_start = GetTime();
+
+        while (file.offset < file.size) {
+            unsigned char tag = file.data[file.offset++];
+
+            if (tag == RL_TRACE_CALL) {
+                uint16_t recorded_id;
+                uint32_t payload_size;
+                rl_replay_value(&file, &recorded_id, sizeof(recorded_id));
+                rl_replay_value(&file, &payload_size, sizeof(payload_size));
+                // A host killed mid-capture leaves the last record cut short
+                if (payload_size > file.size - file.offset) {
+                    printf("[REPLAY] Corrupted trace, call payload past the end at offset %zu\n", file.offset);
+                    break;
+                }
+
+                RlTraceReader payload = { file.data + file.offset, payload_size, 0 };
+                file.offset += payload_size;
+
+                int call_id = recorded_id < call_count ? call_map[recorded_id] : -1;
+                if (call_id >= 0 && rl_replay_call(call_id, &payload)) {
+                    replayed++;
+                } else {
+                    skipped++;
+                }
+
+                if (call_id == RL_CALL_END_DRAWING) {
+                    double now = GetTime();
+                    frame_times = grow(frame_times, frame_count, sizeof(double));
+                    frame_times[frame_count++] = now - frame_start;
+                    frame_start = now;
+                }
+            } else if (tag == RL_TRACE_UNSUPPORTED) {
+                file.offset += sizeof(uint16_t);
+                skipped++;
+            } else if (tag == RL_TRACE_TEXTURE) {
+                Texture2D recorded;
+                uint32_t pixel_bytes;
+                rl_replay_value(&file, &recorded, sizeof(recorded));
+                rl_replay_value(&file, &pixel_bytes, sizeof(pixel_bytes));
+                // Pixels are stored as RGBA8, or not at all
+                size_t expected_bytes = recorded.width > 0 && recorded.height > 0 ?
+                                        (size_t)recorded.width * (size_t)recorded.height * 4 : 0;
+                if (pixel_bytes > file.size - file.offset || (pixel_bytes > 0 && pixel_bytes != expected_bytes)) {
+                    printf("[REPLAY] Corrupted trace, bad texture pixels at offset %zu\n", file.offset);
+                    break;
+                }
+
+                Image image;
+                if (pixel_bytes > 0) {
+                    image = (Image){
+                        .data = (void*)(file.data + file.offset),
+                        .width = recorded.width,
+                        .height = recorded.height,
+                        .mipmaps = 1,
+                        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+                    };
+                    map_texture(recorded.id, LoadTextureFromImage(image));
+                } else {
+                    image = GenImageColor(recorded.width, recorded.height, MAGENTA);
+                    map_texture(recorded.id, LoadTextureFromImage(image));
+                    UnloadImage(image);
+                }
+                file.offset += pixel_bytes;
+            } else if (tag == RL_TRACE_RENDER_TEXTURE) {
+                RenderTexture2D recorded;
+                rl_replay_value(&file, &recorded, sizeof(recorded));
+                map_render_texture(recorded, LoadRenderTexture(recorded.texture.width, recorded.texture.height));
+            } else {
+                printf("[REPLAY] Corrupted trace, unknown record %d at offset %zu\n", tag, file.offset - 1);
+                break;
+            }
+        }
+
+        unload_replay_resources();
+    }
+
+    double total_time = GetTime() - replay_start;
+    CloseWindow();
+
+    if (frame_count > 0) {
+        double min = frame_times[0], max = frame_times[0], sum = 0;
+        for (int i = 0; i < frame_count; i++) {
+            if (frame_times[i] < min) min = frame_times[i];
+            if (frame_times[i] > max) max = frame_times[i];
+            sum += frame_times[i];
+        }
+
+        printf("[REPLAY] %d frames, %llu calls replayed, %llu skipped, %.3f s total\n",
+               frame_count, replayed, skipped, total_time);
+        printf("[REPLAY] frame avg %.3f ms, min %.3f ms, max %.3f ms, %.1f fps\n",
+               sum / frame_count * 1000.0, min * 1000.0, max * 1000.0, frame_count / sum);
+    } else {
+        printf("[REPLAY] No frames in %s\n", trace_path);
+    }
+
+    if (csv_path) {
+        FILE* csv = fopen(csv_path, "w");
+        if (csv) {
+            fprintf(csv, "frame,ms\n");
+            for (int i = 0; i < frame_count; i++) {
+                fprintf(csv, "%d,%.4f\n", i, frame_times[i] * 1000.0);
+            }
+            fclose(csv);
+        } else {
+            printf("[REPLAY] Failed to write %s\n", csv_path);
+        }
+    }
+
+    free(frame_times);
+    free(call_map);
+    free(data);
+    return 0;
+}
@@ -0,0 +1,278 @@
+// Headless batch runner for the game library built by the hot reload workflow.
+//
+// Loads game.so once, allocates one game memory block per instance and steps
+// them all through the game_sim_* entry points (src/game_sim.h) on the job
+// workers, with random key presses seeded per instance. No window is opened.
+// Reports throughput in simulated frames per second and writes the result of
+// every instance. Instance 0 is run a second time to check the game is
+// deterministic.
+//
+// Usage: sim_runner [--lib build/hot_reload/game.so] [--instances N] [--frames N]
+//                   [--seed N] [--dt SECONDS] [--csv results.csv]
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "game_sim.h"
+#include "hot_reload/platform_tools.h"
+#include "runtime/jobs.h"
+
+#ifdef __APPLE__
+    #define DLL_EXT ".dylib"
+#elif _WIN32
+    #define DLL_EXT ".dll"
+#else
+    #define DLL_EXT ".so"
+#endif
+
+#define SIM_DEFAULT_LIB "build/hot_reload/game" DLL_EXT
+// Instance blocks start on their own cache line, so threads don't share lines
+#define SIM_ALIGNMENT 64
+// Random keys are held for this many frames, at most
+#define SIM_MAX_HOLD_FRAMES 60
+// Results printed, the CSV has all of them
+#define SIM_PRINTED_INSTANCES 8
+
+typedef struct {
+    int (*memory_size)(void);
+    void (*init)(void* mem);
+    bool (*step)(void* mem, unsigned int keys, float dt);
+    void (*result)(void* mem, GameSimResult* result);
+} GameSimAPI;
+
+typedef struct {
+    uint64_t seed;
+    GameSimResult result;
+    uint64_t checksum;
+} SimInstance;
+
+typedef struct {
+    GameSimAPI api;
+    unsigned char* memory;
+    size_t stride;
+    SimInstance* instances;
+    int instance_count;
+    int frames;
+    float dt;
+    volatile int next_instance;
+} SimBatch;
+
+static double sim_now(void) {
+#ifdef _WIN32
+    return (double)clock() / CLOCKS_PER_SEC;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+#endif
+}
+
+// splitmix64, the same seed always gives the same keys
+static uint64_t sim_random(uint64_t* state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+static uint64_t sim_checksum(const unsigned char* data, size_t size) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+static void sim_run_instance(const SimBatch* batch, SimInstance* instance, unsigned char* memory) {
+    // The block is zeroed first, so padding bytes don't change the checksum
+    memset(memory, 0, batch->stride);
+    batch->api.init(memory);
+
+    uint64_t random = instance->seed;
+    unsigned int keys = 0;
+    int hold = 0;
+    // Quitting is left to the frame limit
+    const unsigned int key_mask = GAME_SIM_KEY_UP | GAME_SIM_KEY_DOWN | GAME_SIM_KEY_LEFT | GAME_SIM_KEY_RIGHT |
+                                  GAME_SIM_KEY_ROTATE_LEFT | GAME_SIM_KEY_ROTATE_RIGHT;
+    for (int frame = 0; frame < batch->frames; frame++) {
+        if (hold-- <= 0) {
+            uint64_t value = sim_random(&random);
+            keys = (unsigned int)value & key_mask;
+            hold = (int)((value >> 32) % SIM_MAX_HOLD_FRAMES);
+        }
+        if (!batch->api.step(memory, keys, batch->dt)) break;
+    }
+
+    batch->api.result(memory, &instance->result);
+    instance->checksum = sim_checksum(memory, (size_t)batch->api.memory_size());
+}
+
+// Every worker, and the main thread, takes the next instance until none are left
+static void sim_worker(void* data) {
+    SimBatch* batch = (SimBatch*)data;
+    for (;;) {
+        int index = __sync_fetch_and_add(&batch->next_instance, 1);
+        if (index >= batch->instance_count) break;
+        sim_run_instance(batch, &batch->instances[index], batch->memory + (size_t)index * batch->stride);
+    }
+}
+
+static void sim_warmup(void* data) {
+    (void)data;
+}
+
+static bool sim_load_api(dll_handle_t lib, GameSimAPI* api) {
+    api->memory_size = (int (*)(void))platform_get_symbol(lib, "game_sim_memory_size");
+    api->init = (void (*)(void*))platform_get_symbol(lib, "game_sim_init");
+    api->step = (bool (*)(void*, unsigned int, float))platform_get_symbol(lib, "game_sim_step");
+    api->result = (void (*)(void*, GameSimResult*))platform_get_symbol(lib, "game_sim_result");
+    return api->memory_size && api->init && api->step && api->result;
+}
+
+static bool sim_write_csv(const char* path, const SimBatch* batch) {
+    FILE* file = fopen(path, "w");
+    if (!file) return false;
+
+    fprintf(file, "instance,seed,frames,x,y,rotation,checksum\n");
+    for (int i = 0; i < batch->instance_count; i++) {
+        const SimInstance* instance = &batch->instances[i];
+        fprintf(file, "%d,%llu,%d,%.3f,%.3f,%.3f,%016llx\n", i, (unsigned long long)instance->seed,
+                instance->result.frames, instance->result.x, instance->result.y, instance->result.rotation,
+                (unsigned long long)instance->checksum);
+    }
+    fclose(file);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    const char* lib_path = SIM_DEFAULT_LIB;
+    const char* csv_path = NULL;
+    int instance_count = 1000;
+    int frames = 3600;
+    unsigned long long seed = 1;
+    float dt = 1.0f / 60.0f;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--lib") == 0 && i + 1 < argc) {
+            lib_path = argv[++i];
+        } else if (strcmp(argv[i], "--instances") == 0 && i + 1 < argc) {
+            instance_count = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frames = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--dt") == 0 && i + 1 < argc) {
+            dt = (float)atof(argv[++i]);
+        } else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+            csv_path = argv[++i];
+        } else {
+            printf("Usage: %s [--lib %s] [--instances N] [--frames N] [--seed N] [--dt SECONDS] [--csv results.csv]\n",
+                   argv[0], SIM_DEFAULT_LIB);
+            return 1;
+        }
+    }
+
+    if (instance_count < 1 || frames < 1 || dt <= 0.0f) {
+        printf("[SIM] --instances, --frames and --dt must be positive\n");
+        return 1;
+    }
+
+    dll_handle_t lib = platform_load_library(lib_path);
+    if (!lib) {
+        printf("[SIM] Failed to load %s\n", lib_path);
+        return 1;
+    }
+
+    SimBatch batch = {0};
+    if (!sim_load_api(lib, &batch.api)) {
+        printf("[SIM] %s has no game_sim_* entry points\n", lib_path);
+        platform_free_library(lib);
+        return 1;
+    }
+
+    int memory_size = batch.api.memory_size();
+    batch.stride = ((size_t)memory_size + SIM_ALIGNMENT - 1) / SIM_ALIGNMENT * SIM_ALIGNMENT;
+    batch.instance_count = instance_count;
+    batch.frames = frames;
+    batch.dt = dt;
+
+    // One more block, for the determinism check
+    size_t memory_bytes = batch.stride * ((size_t)instance_count + 1);
+    batch.memory = malloc(memory_bytes + SIM_ALIGNMENT);
+    batch.instances = calloc((size_t)instance_count, sizeof(SimInstance));
+    if (!batch.memory || !batch.instances) {
+        printf("[SIM] Out of memory for %d instances of %d bytes\n", instance_count, memory_size);
+        free(batch.memory);
+        free(batch.instances);
+        platform_free_library(lib);
+        return 1;
+    }
+    unsigned char* allocation = batch.memory;
+    batch.memory = (unsigned char*)(((uintptr_t)allocation + SIM_ALIGNMENT - 1) & ~(uintptr_t)(SIM_ALIGNMENT - 1));
+
+    uint64_t seeds = seed;
+    for (int i = 0; i < instance_count; i++) {
+        batch.instances[i].seed = sim_random(&seeds);
+    }
+
+    // Workers start on the first job, before the clock starts
+    JobGroup warmup = {0};
+    jobs_submit_group(&warmup, sim_warmup, NULL);
+    jobs_wait(&warmup);
+
+    int thread_count = jobs_thread_count();
+    printf("[SIM] %d instances of %d bytes, %d frames at %.4f s, on %d threads\n",
+           instance_count, memory_size, frames, dt, thread_count + 1);
+
+    double start = sim_now();
+    JobGroup group = {0};
+    for (int i = 0; i < thread_count; i++) {
+        jobs_submit_group(&group, sim_worker, &batch);
+    }
+    sim_worker(&batch);
+    jobs_wait(&group);
+    double seconds = sim_now() - start;
+
+    unsigned long long simulated = 0;
+    for (int i = 0; i < instance_count; i++) {
+        simulated += (unsigned long long)batch.instances[i].result.frames;
+    }
+
+    // Same seed, same memory: anything else means the game reads state it wasn't given
+    SimInstance rerun = batch.instances[0];
+    sim_run_instance(&batch, &rerun, batch.memory + (size_t)instance_count * batch.stride);
+    bool deterministic = rerun.checksum == batch.instances[0].checksum;
+
+    for (int i = 0; i < instance_count && i < SIM_PRINTED_INSTANCES; i++) {
+        const SimInstance* instance = &batch.instances[i];
+        printf("[SIM] #%d: %d frames, bunny at (%.1f, %.1f) rotation %.1f, checksum %016llx\n",
+               i, instance->result.frames, instance->result.x, instance->result.y, instance->result.rotation,
+               (unsigned long long)instance->checksum);
+    }
+    if (instance_count > SIM_PRINTED_INSTANCES) {
+        printf("[SIM] ... %d more\n", instance_count - SIM_PRINTED_INSTANCES);
+    }
+
+    printf("[SIM] %llu frames in %.3f s: %.0f simulated frames/s, %.0f per thread\n",
+           simulated, seconds, seconds > 0.0 ? (double)simulated / seconds : 0.0,
+           seconds > 0.0 ? (double)simulated / seconds / (thread_count + 1) : 0.0);
+    printf("[SIM] Determinism check: %s\n", deterministic ? "instance 0 ran the same twice" : "instance 0 DIFFERED on a second run");
+
+    if (csv_path) {
+        if (sim_write_csv(csv_path, &batch)) {
+            printf("[SIM] Results written to %s\n", csv_path);
+        } else {
+            printf("[SIM] Failed to write %s\n", csv_path);
+        }
+    }
+
+    free(allocation);
+    free(batch.instances);
+    platform_free_library(lib);
+    return deterministic ? 0 : 2;
+}